@@ -47,6 +47,11 @@ struct ApiCallInfo
 
     /// Thread id of captured function call.
     format::ThreadId thread_id{ 0 };
+
+    /// Parameters were encoded with variable length values. Stream processors
+    /// like FileProcessor set this from the format::FileOption::kCompactEncoding
+    /// option of the capture file that the call was read from.
+    bool compact_encoding{ false };
 };
 
 class ApiDecoder
@@ -0,0 +1,484 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/block_read_ahead_queue.h"
+
+#include "format/format_util.h"
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Limits the amount of block data read ahead of the consumer, so that a sequence of large resource initialization
+// blocks does not require max_queued_blocks_ large buffers.  A single block larger than the limit is still read.
+const size_t kMaxQueuedBytes = 64 * 1024 * 1024;
+
+// Buffers larger than this are released after use instead of being recycled for subsequent blocks.
+const size_t kMaxRecycledBlockSize = 4 * 1024 * 1024;
+
+BlockReadAheadQueue::BlockReadAheadQueue(size_t max_queued_blocks, size_t decompression_thread_count) :
+    max_queued_blocks_(std::max(max_queued_blocks, static_cast<size_t>(1))), file_(nullptr), start_file_offset_(0),
+    compressor_(nullptr),
+    decompression_pool_(decompression_thread_count), use_decompression_pool_(decompression_thread_count > 0),
+    queued_bytes_(0), stop_reading_(false), reader_finished_(false), file_error_(false), current_offset_(0),
+    at_end_(false), stream_error_(false)
+{}
+
+BlockReadAheadQueue::~BlockReadAheadQueue()
+{
+    Stop();
+}
+
+void BlockReadAheadQueue::Start(FILE* file, util::Compressor* compressor)
+{
+    assert((file != nullptr) && !reader_thread_.joinable());
+
+    file_              = file;
+    start_file_offset_ = util::platform::FileTell(file);
+    compressor_        = compressor;
+    stop_reading_      = false;
+    reader_finished_   = false;
+    file_error_        = false;
+    at_end_            = false;
+    stream_error_      = false;
+
+    reader_thread_ = std::thread(&BlockReadAheadQueue::ReadBlocks, this);
+}
+
+void BlockReadAheadQueue::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_reading_ = true;
+    }
+
+    block_consumed_.notify_all();
+
+    if (reader_thread_.joinable())
+    {
+        reader_thread_.join();
+    }
+
+    // Wait for in-progress decompression to complete before releasing the blocks being decompressed.  The pool is
+    // kept running so that the queue can be restarted.
+    for (const auto& block : queued_blocks_)
+    {
+        if (block->ready.valid())
+        {
+            block->ready.wait();
+        }
+    }
+
+    queued_blocks_.clear();
+    free_blocks_.clear();
+    current_block_.reset();
+    queued_bytes_ = 0;
+}
+
+bool BlockReadAheadQueue::ReadBytes(void* buffer, size_t buffer_size)
+{
+    uint8_t* destination = reinterpret_cast<uint8_t*>(buffer);
+
+    while (buffer_size > 0)
+    {
+        if ((current_block_ == nullptr) || (current_offset_ == current_block_->size))
+        {
+            if (!AdvanceBlock())
+            {
+                return false;
+            }
+        }
+
+        size_t copy_size = std::min(buffer_size, current_block_->size - current_offset_);
+
+        util::platform::MemoryCopy(destination, buffer_size, current_block_->data + current_offset_, copy_size);
+
+        destination += copy_size;
+        buffer_size -= copy_size;
+        current_offset_ += copy_size;
+    }
+
+    return true;
+}
+
+const uint8_t* BlockReadAheadQueue::ReadBytesInPlace(size_t read_size)
+{
+    if ((current_block_ == nullptr) || (current_offset_ == current_block_->size))
+    {
+        if (!AdvanceBlock())
+        {
+            return nullptr;
+        }
+    }
+
+    if (read_size > (current_block_->size - current_offset_))
+    {
+        return nullptr;
+    }
+
+    const uint8_t* data = current_block_->data + current_offset_;
+    current_offset_ += read_size;
+
+    return data;
+}
+
+int64_t BlockReadAheadQueue::GetNextBlockFileOffset() const
+{
+    if (current_block_ != nullptr)
+    {
+        assert(current_offset_ == current_block_->size);
+        return current_block_->file_offset + static_cast<int64_t>(current_block_->file_size);
+    }
+
+    return start_file_offset_;
+}
+
+bool BlockReadAheadQueue::SkipBytes(size_t skip_size)
+{
+    while (skip_size > 0)
+    {
+        if ((current_block_ == nullptr) || (current_offset_ == current_block_->size))
+        {
+            if (!AdvanceBlock())
+            {
+                return false;
+            }
+        }
+
+        size_t block_skip_size = std::min(skip_size, current_block_->size - current_offset_);
+
+        skip_size -= block_skip_size;
+        current_offset_ += block_skip_size;
+    }
+
+    return true;
+}
+
+void BlockReadAheadQueue::ReadBlocks()
+{
+    int64_t file_offset = start_file_offset_;
+
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            block_consumed_.wait(lock, [this]() {
+                return stop_reading_ || ((queued_blocks_.size() < max_queued_blocks_) &&
+                                         (queued_blocks_.empty() || (queued_bytes_ < kMaxQueuedBytes)));
+            });
+
+            if (stop_reading_)
+            {
+                break;
+            }
+        }
+
+        std::unique_ptr<Block> block = AcquireBlock();
+        format::BlockHeader    block_header{};
+
+        bool success = util::platform::FileRead(&block_header, sizeof(block_header), file_);
+
+        if (success)
+        {
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+
+            size_t body_size = static_cast<size_t>(block_header.size);
+            block->file_size = sizeof(block_header) + body_size;
+
+            if (block->file_data.size() < block->file_size)
+            {
+                block->file_data.resize(block->file_size);
+            }
+
+            util::platform::MemoryCopy(
+                block->file_data.data(), block->file_data.size(), &block_header, sizeof(block_header));
+
+            success = (body_size == 0) ||
+                      util::platform::FileRead(block->file_data.data() + sizeof(block_header), body_size, file_);
+        }
+
+        if (!success)
+        {
+            // An incomplete block at the end of the file is not delivered to the consumer, which will encounter the
+            // end of the stream when it attempts to read the block header.
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                file_error_      = (ferror(file_) != 0);
+                reader_finished_ = true;
+            }
+
+            block_queued_.notify_one();
+            break;
+        }
+
+        block->file_offset = file_offset;
+        block->data        = block->file_data.data();
+        block->size        = block->file_size;
+
+        file_offset += static_cast<int64_t>(block->file_size);
+
+        if ((compressor_ != nullptr) && format::IsBlockCompressed(block_header.type))
+        {
+            if (use_decompression_pool_)
+            {
+                Block* pending_block = block.get();
+                block->ready         = decompression_pool_.post(
+                    [compressor = compressor_, pending_block]() { DecompressBlock(compressor, pending_block); });
+            }
+            else
+            {
+                DecompressBlock(compressor_, block.get());
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            queued_bytes_ += block->file_size;
+            queued_blocks_.push_back(std::move(block));
+        }
+
+        block_queued_.notify_one();
+    }
+}
+
+std::unique_ptr<BlockReadAheadQueue::Block> BlockReadAheadQueue::AcquireBlock()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (!free_blocks_.empty())
+    {
+        std::unique_ptr<Block> block = std::move(free_blocks_.back());
+        free_blocks_.pop_back();
+        return block;
+    }
+
+    return std::make_unique<Block>();
+}
+
+void BlockReadAheadQueue::ReleaseBlock(std::unique_ptr<Block> block)
+{
+    if ((block->file_data.capacity() + block->uncompressed_data.capacity()) <= kMaxRecycledBlockSize)
+    {
+        block->file_size = 0;
+        block->data      = nullptr;
+        block->size      = 0;
+        block->ready     = std::future<void>();
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        free_blocks_.push_back(std::move(block));
+    }
+}
+
+bool BlockReadAheadQueue::AdvanceBlock()
+{
+    if (current_block_ != nullptr)
+    {
+        ReleaseBlock(std::move(current_block_));
+        current_offset_ = 0;
+    }
+
+    std::unique_ptr<Block> block;
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        block_queued_.wait(lock, [this]() { return !queued_blocks_.empty() || reader_finished_ || stop_reading_; });
+
+        if (queued_blocks_.empty())
+        {
+            // Match the behavior of a short fread, which sets the EOF indicator.
+            at_end_       = true;
+            stream_error_ = file_error_;
+            return false;
+        }
+
+        block = std::move(queued_blocks_.front());
+        queued_blocks_.pop_front();
+        queued_bytes_ -= block->file_size;
+    }
+
+    block_consumed_.notify_one();
+
+    if (block->ready.valid())
+    {
+        block->ready.wait();
+    }
+
+    current_block_  = std::move(block);
+    current_offset_ = 0;
+
+    return true;
+}
+
+void BlockReadAheadQueue::DecompressBlock(util::Compressor* compressor, Block* block)
+{
+    size_t header_size              = 0;
+    size_t retained_header_size     = 0;
+    size_t uncompressed_size_offset = 0;
+
+    if (GetCompressedBlockLayout(block, &header_size, &retained_header_size, &uncompressed_size_offset))
+    {
+        const uint8_t* header_data       = block->file_data.data() + sizeof(format::BlockHeader);
+        uint64_t       uncompressed_size = 0;
+
+        util::platform::MemoryCopy(&uncompressed_size,
+                                   sizeof(uncompressed_size),
+                                   header_data + uncompressed_size_offset,
+                                   sizeof(uncompressed_size));
+
+        if ((uncompressed_size > 0) && (uncompressed_size < std::numeric_limits<size_t>::max() - header_size))
+        {
+            size_t compressed_size = block->file_size - sizeof(format::BlockHeader) - header_size;
+            size_t data_offset     = sizeof(format::BlockHeader) + retained_header_size;
+            size_t block_size      = data_offset + static_cast<size_t>(uncompressed_size);
+
+            if (block->uncompressed_data.size() < block_size)
+            {
+                block->uncompressed_data.resize(block_size);
+            }
+
+            size_t result = compressor->Decompress(compressed_size,
+                                                   header_data + header_size,
+                                                   static_cast<size_t>(uncompressed_size),
+                                                   block->uncompressed_data.data() + data_offset);
+
+            if (result == uncompressed_size)
+            {
+                format::BlockHeader block_header{};
+                util::platform::MemoryCopy(
+                    &block_header, sizeof(block_header), block->file_data.data(), sizeof(block_header));
+
+                block_header.size = retained_header_size + uncompressed_size;
+                block_header.type = format::RemoveCompressedBlockBit(block_header.type);
+
+                util::platform::MemoryCopy(
+                    block->uncompressed_data.data(), block_size, &block_header, sizeof(block_header));
+                util::platform::MemoryCopy(block->uncompressed_data.data() + sizeof(block_header),
+                                           retained_header_size,
+                                           header_data,
+                                           retained_header_size);
+
+                block->data = block->uncompressed_data.data();
+                block->size = block_size;
+            }
+        }
+    }
+}
+
+bool BlockReadAheadQueue::GetCompressedBlockLayout(const Block* block,
+                                                   size_t*      header_size,
+                                                   size_t*      retained_header_size,
+                                                   size_t*      uncompressed_size_offset)
+{
+    assert((block != nullptr) && (header_size != nullptr) && (retained_header_size != nullptr) &&
+           (uncompressed_size_offset != nullptr));
+
+    const size_t      body_size  = block->file_size - sizeof(format::BlockHeader);
+    format::BlockType block_type = format::BlockType::kUnknownBlock;
+
+    util::platform::MemoryCopy(&block_type,
+                               sizeof(block_type),
+                               block->file_data.data() + offsetof(format::BlockHeader, type),
+                               sizeof(block_type));
+
+    if (block_type == format::BlockType::kCompressedFunctionCallBlock)
+    {
+        *header_size              = sizeof(format::CompressedFunctionCallHeader) - sizeof(format::BlockHeader);
+        *retained_header_size     = sizeof(format::FunctionCallHeader) - sizeof(format::BlockHeader);
+        *uncompressed_size_offset = *header_size - sizeof(uint64_t);
+    }
+    else if (block_type == format::BlockType::kCompressedMethodCallBlock)
+    {
+        *header_size              = sizeof(format::CompressedMethodCallHeader) - sizeof(format::BlockHeader);
+        *retained_header_size     = sizeof(format::MethodCallHeader) - sizeof(format::BlockHeader);
+        *uncompressed_size_offset = *header_size - sizeof(uint64_t);
+    }
+    else if ((block_type == format::BlockType::kCompressedMetaDataBlock) && (body_size >= sizeof(format::MetaDataId)))
+    {
+        format::MetaDataId meta_data_id = 0;
+        util::platform::MemoryCopy(&meta_data_id,
+                                   sizeof(meta_data_id),
+                                   block->file_data.data() + sizeof(format::BlockHeader),
+                                   sizeof(meta_data_id));
+
+        // The headers of these metadata blocks end with the size of the uncompressed data, except for the init image
+        // header, which is followed by a variable length array of mip level sizes.
+        switch (format::GetMetaDataType(meta_data_id))
+        {
+            case format::MetaDataType::kFillMemoryCommand:
+                *header_size              = sizeof(format::FillMemoryCommandHeader) - sizeof(format::BlockHeader);
+                *uncompressed_size_offset = *header_size - sizeof(uint64_t);
+                break;
+            case format::MetaDataType::kContentDataCommand:
+                *header_size              = sizeof(format::ContentDataCommandHeader) - sizeof(format::BlockHeader);
+                *uncompressed_size_offset = *header_size - sizeof(uint64_t);
+                break;
+            case format::MetaDataType::kInitBufferCommand:
+                *header_size              = sizeof(format::InitBufferCommandHeader) - sizeof(format::BlockHeader);
+                *uncompressed_size_offset = *header_size - sizeof(uint64_t);
+                break;
+            case format::MetaDataType::kInitSubresourceCommand:
+                *header_size              = sizeof(format::InitSubresourceCommandHeader) - sizeof(format::BlockHeader);
+                *uncompressed_size_offset = *header_size - sizeof(uint64_t);
+                break;
+            case format::MetaDataType::kInitImageCommand:
+            {
+                const size_t level_count_offset = offsetof(format::InitImageCommandHeader, level_count);
+                uint32_t     level_count        = 0;
+
+                if (block->file_size < (level_count_offset + sizeof(level_count)))
+                {
+                    return false;
+                }
+
+                util::platform::MemoryCopy(&level_count,
+                                           sizeof(level_count),
+                                           block->file_data.data() + level_count_offset,
+                                           sizeof(level_count));
+
+                *header_size = sizeof(format::InitImageCommandHeader) - sizeof(format::BlockHeader) +
+                               (static_cast<size_t>(level_count) * sizeof(uint64_t));
+                *uncompressed_size_offset =
+                    offsetof(format::InitImageCommandHeader, data_size) - sizeof(format::BlockHeader);
+                break;
+            }
+            default:
+                return false;
+        }
+
+        *retained_header_size = *header_size;
+    }
+    else
+    {
+        return false;
+    }
+
+    return (body_size >= *header_size);
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,144 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_BLOCK_READ_AHEAD_QUEUE_H
+#define GFXRECON_DECODE_BLOCK_READ_AHEAD_QUEUE_H
+
+#include "format/format.h"
+#include "util/compressor.h"
+#include "util/defines.h"
+#include "util/threadpool.h"
+
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Reads capture file blocks on a background thread, ahead of the thread that processes them.  Compressed function
+// call, method call, and fill memory/resource initialization blocks are decompressed by a pool of worker threads and
+// rewritten as the equivalent uncompressed blocks, so the consumer only sees compressed blocks when decompression
+// fails.  Blocks are returned to the consumer in file order, as a byte stream with the same read semantics as the
+// file it was read from.
+class BlockReadAheadQueue
+{
+  public:
+    // max_queued_blocks limits the number of blocks that may be read ahead of the consumer.  When
+    // decompression_thread_count is zero, blocks are decompressed by the reader thread.
+    BlockReadAheadQueue(size_t max_queued_blocks, size_t decompression_thread_count);
+
+    ~BlockReadAheadQueue();
+
+    // Starts reading from the current position of file.  The file must not be accessed by the caller until the queue
+    // has been stopped.  The compressor may be null for uncompressed files.
+    void Start(FILE* file, util::Compressor* compressor);
+
+    void Stop();
+
+    // Returns false if fewer than buffer_size bytes remain in the stream.  As with fread, the remaining bytes are
+    // consumed and IsAtEnd() will return true.
+    bool ReadBytes(void* buffer, size_t buffer_size);
+
+    // Returns a pointer to the next read_size bytes of the stream, which remains valid until the next read from the
+    // queue.  Returns nullptr without consuming any data when the bytes are not contiguous in memory, in which case
+    // ReadBytes() must be used instead.
+    const uint8_t* ReadBytesInPlace(size_t read_size);
+
+    bool SkipBytes(size_t skip_size);
+
+    // Returns the file offset of the first block that has not been returned to the consumer.  The current block must
+    // have been completely consumed, so that the offset can be used to resume reading from the file after the queue
+    // has been stopped.
+    int64_t GetNextBlockFileOffset() const;
+
+    bool IsAtEnd() const { return at_end_; }
+
+    bool IsError() const { return stream_error_; }
+
+  private:
+    struct Block
+    {
+        std::vector<uint8_t> file_data;         // Block data as read from the file.
+        std::vector<uint8_t> uncompressed_data; // Uncompressed representation of a compressed block.
+        int64_t              file_offset{ 0 };  // Offset of the block in the file.
+        size_t               file_size{ 0 };    // Size of the block data read from the file.
+        const uint8_t*       data{ nullptr };   // Block data to return to the consumer.
+        size_t               size{ 0 };         // Size of the block data to return to the consumer.
+        std::future<void>    ready;             // Valid when the block is being decompressed by the thread pool.
+    };
+
+  private:
+    void ReadBlocks();
+
+    std::unique_ptr<Block> AcquireBlock();
+
+    void ReleaseBlock(std::unique_ptr<Block> block);
+
+    // Waits for the next block to become available and makes it the current block.  Returns false at the end of the
+    // stream.
+    bool AdvanceBlock();
+
+    static void DecompressBlock(util::Compressor* compressor, Block* block);
+
+    // Determines the size of the data that precedes the compressed parameter data in a compressed block, the size of
+    // the portion of that data that is retained by the uncompressed block, and the offset of the uncompressed data size
+    // within that data.  Returns false for blocks that the queue does not decompress.
+    static bool GetCompressedBlockLayout(const Block* block,
+                                         size_t*      header_size,
+                                         size_t*      retained_header_size,
+                                         size_t*      uncompressed_size_offset);
+
+  private:
+    const size_t                        max_queued_blocks_;
+    FILE*                               file_;
+    int64_t                             start_file_offset_;
+    util::Compressor*                   compressor_;
+    std::thread                         reader_thread_;
+    util::ThreadPool                    decompression_pool_;
+    bool                                use_decompression_pool_;
+    std::mutex                          mutex_;
+    std::condition_variable             block_queued_;
+    std::condition_variable             block_consumed_;
+    std::deque<std::unique_ptr<Block>>  queued_blocks_;
+    std::vector<std::unique_ptr<Block>> free_blocks_;
+    size_t                              queued_bytes_;
+    bool                                stop_reading_;
+    bool                                reader_finished_;
+    bool                                file_error_;
+
+    // Consumer state, only accessed by the thread processing the blocks.
+    std::unique_ptr<Block> current_block_;
+    size_t                 current_offset_;
+    bool                   at_end_;
+    bool                   stream_error_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_BLOCK_READ_AHEAD_QUEUE_H
@@ -0,0 +1,79 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/columnar_call_decoder.h"
+#include "decode/value_decoder.h"
+#include "format/api_call_id.h"
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+void ColumnarCallDecoder::DecodeFunctionCall(format::ApiCallId  id,
+                                             const ApiCallInfo& call_info,
+                                             const uint8_t*     buffer,
+                                             size_t             buffer_size)
+{
+    format::HandleId handle_id = format::kNullHandleId;
+
+    // Apart from the global commands, the first parameter of each Vulkan command is the dispatchable handle that the
+    // command is called on, which is encoded ahead of the other parameters.
+    if ((format::GetApiCallFamily(id) == format::ApiFamilyId::ApiFamily_Vulkan) &&
+        (id != format::ApiCallId::ApiCall_vkCreateInstance) &&
+        (id != format::ApiCallId::ApiCall_vkEnumerateInstanceExtensionProperties) &&
+        (id != format::ApiCallId::ApiCall_vkEnumerateInstanceLayerProperties) &&
+        (id != format::ApiCallId::ApiCall_vkEnumerateInstanceVersion))
+    {
+        ValueDecoder::DecodeHandleIdValue(buffer, buffer_size, call_info.compact_encoding, &handle_id);
+    }
+
+    AddRow(id, handle_id, call_info, buffer_size);
+}
+
+void ColumnarCallDecoder::DecodeMethodCall(format::ApiCallId  call_id,
+                                           format::HandleId   object_id,
+                                           const ApiCallInfo& call_options,
+                                           const uint8_t*     parameter_buffer,
+                                           size_t             buffer_size)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(parameter_buffer);
+
+    AddRow(call_id, object_id, call_options, buffer_size);
+}
+
+void ColumnarCallDecoder::AddRow(format::ApiCallId  call_id,
+                                 format::HandleId   handle_id,
+                                 const ApiCallInfo& call_info,
+                                 size_t             buffer_size)
+{
+    ColumnarCallRow row;
+    row.block_index  = call_info.index;
+    row.call_id      = call_id;
+    row.thread_id    = call_info.thread_id;
+    row.frame_number = frame_number_;
+    row.handle_id    = handle_id;
+    row.payload_size = buffer_size;
+
+    writer_->AddRow(row);
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
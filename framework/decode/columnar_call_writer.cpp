@@ -0,0 +1,193 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/columnar_call_writer.h"
+#include "format/format_util.h"
+#include "util/logging.h"
+
+#include <cassert>
+#include <cinttypes>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+static const uint32_t kColumnValueSizes[kColumnCount] = {
+    sizeof(uint64_t),          // kColumnBlockIndex
+    sizeof(format::ApiCallId), // kColumnApiCallId
+    sizeof(format::ThreadId),  // kColumnThreadId
+    sizeof(uint32_t),          // kColumnFrameNumber
+    sizeof(format::HandleId),  // kColumnHandleId
+    sizeof(uint64_t)           // kColumnPayloadSize
+};
+
+ColumnarCallWriter::ColumnarCallWriter(util::OutputStream*     stream,
+                                       format::CompressionType compression_type,
+                                       uint32_t                chunk_rows) :
+    stream_(stream), compression_type_(compression_type), chunk_rows_(chunk_rows), row_count_(0), success_(true),
+    column_headers_{}, column_write_data_{}
+{
+    assert((stream_ != nullptr) && (chunk_rows_ > 0));
+
+    if (compression_type_ != format::CompressionType::kNone)
+    {
+        compressor_.reset(format::CreateCompressor(compression_type_));
+    }
+
+    block_indices_.reserve(chunk_rows_);
+    call_ids_.reserve(chunk_rows_);
+    thread_ids_.reserve(chunk_rows_);
+    frame_numbers_.reserve(chunk_rows_);
+    handle_ids_.reserve(chunk_rows_);
+    payload_sizes_.reserve(chunk_rows_);
+}
+
+bool ColumnarCallWriter::WriteHeader()
+{
+    ColumnarFileHeader file_header;
+    file_header.fourcc       = GFXRECON_COLUMNAR_FOURCC;
+    file_header.version      = kColumnarVersion;
+    file_header.column_count = kColumnCount;
+    file_header.reserved     = 0;
+
+    Write(&file_header, sizeof(file_header));
+
+    for (uint32_t i = 0; i < kColumnCount; ++i)
+    {
+        ColumnarColumnInfo column_info;
+        column_info.column     = i;
+        column_info.value_size = kColumnValueSizes[i];
+
+        Write(&column_info, sizeof(column_info));
+    }
+
+    return success_;
+}
+
+void ColumnarCallWriter::AddRow(const ColumnarCallRow& row)
+{
+    block_indices_.push_back(row.block_index);
+    call_ids_.push_back(row.call_id);
+    thread_ids_.push_back(row.thread_id);
+    frame_numbers_.push_back(row.frame_number);
+    handle_ids_.push_back(row.handle_id);
+    payload_sizes_.push_back(row.payload_size);
+
+    ++row_count_;
+
+    if (block_indices_.size() >= chunk_rows_)
+    {
+        WriteChunk();
+    }
+}
+
+bool ColumnarCallWriter::Flush()
+{
+    if (!block_indices_.empty())
+    {
+        WriteChunk();
+    }
+
+    stream_->Flush();
+
+    return success_;
+}
+
+bool ColumnarCallWriter::WriteChunk()
+{
+    const uint32_t row_count = static_cast<uint32_t>(block_indices_.size());
+
+    PrepareColumn(kColumnBlockIndex, block_indices_.data(), row_count);
+    PrepareColumn(kColumnApiCallId, call_ids_.data(), row_count);
+    PrepareColumn(kColumnThreadId, thread_ids_.data(), row_count);
+    PrepareColumn(kColumnFrameNumber, frame_numbers_.data(), row_count);
+    PrepareColumn(kColumnHandleId, handle_ids_.data(), row_count);
+    PrepareColumn(kColumnPayloadSize, payload_sizes_.data(), row_count);
+
+    ColumnarChunkHeader chunk_header;
+    chunk_header.row_count    = row_count;
+    chunk_header.column_count = kColumnCount;
+
+    Write(&chunk_header, sizeof(chunk_header));
+    Write(column_headers_, sizeof(column_headers_));
+
+    for (uint32_t i = 0; i < kColumnCount; ++i)
+    {
+        static const uint8_t kPadding[kColumnarAlignment] = {};
+
+        const size_t data_size = static_cast<size_t>(column_headers_[i].data_size);
+
+        Write(column_write_data_[i], data_size);
+
+        if ((data_size % kColumnarAlignment) != 0)
+        {
+            Write(kPadding, kColumnarAlignment - (data_size % kColumnarAlignment));
+        }
+    }
+
+    block_indices_.clear();
+    call_ids_.clear();
+    thread_ids_.clear();
+    frame_numbers_.clear();
+    handle_ids_.clear();
+    payload_sizes_.clear();
+
+    return success_;
+}
+
+void ColumnarCallWriter::PrepareColumn(ColumnarColumn column, const void* values, uint32_t row_count)
+{
+    const size_t size = static_cast<size_t>(kColumnValueSizes[column]) * row_count;
+
+    ColumnarColumnChunkHeader& header = column_headers_[column];
+    header.column                     = column;
+    header.compression_type           = format::CompressionType::kNone;
+    header.data_size                  = size;
+
+    column_write_data_[column] = static_cast<const uint8_t*>(values);
+
+    if (compressor_ != nullptr)
+    {
+        size_t compressed_size =
+            compressor_->Compress(size, static_cast<const uint8_t*>(values), &compressed_data_[column], 0);
+
+        if ((compressed_size > 0) && (compressed_size < size))
+        {
+            header.compression_type    = compression_type_;
+            header.data_size           = compressed_size;
+            column_write_data_[column] = compressed_data_[column].data();
+        }
+    }
+}
+
+bool ColumnarCallWriter::Write(const void* data, size_t size)
+{
+    if (success_ && !stream_->Write(data, size))
+    {
+        GFXRECON_LOG_ERROR("Failed to write %" PRIuPTR " bytes of columnar call data", size);
+        success_ = false;
+    }
+
+    return success_;
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
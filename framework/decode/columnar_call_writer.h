@@ -0,0 +1,166 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+/// @file Writing a table of the API calls in a capture file, with the values of
+/// each column stored together.
+
+#ifndef GFXRECON_DECODE_COLUMNAR_CALL_WRITER_H
+#define GFXRECON_DECODE_COLUMNAR_CALL_WRITER_H
+
+#include "format/format.h"
+#include "util/compressor.h"
+#include "util/defines.h"
+#include "util/output_stream.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#define GFXRECON_COLUMNAR_FOURCC GFXRECON_MAKE_FOURCC('G', 'F', 'X', 'C')
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// A columnar call file starts with a ColumnarFileHeader and a ColumnarColumnInfo for each column, followed by chunks of
+// rows. Each chunk starts with a ColumnarChunkHeader and a ColumnarColumnChunkHeader for each column, followed by the
+// data for each column in the same order. The data for a column is an array of row_count values, which is compressed
+// as a unit when compression reduces its size. Column data is padded to a multiple of kColumnarAlignment bytes so that
+// uncompressed columns can be read in place from a memory mapped file. Values are written in the byte order of the
+// host, as in capture files.
+
+const uint32_t kColumnarVersion          = 1;
+const uint32_t kColumnarAlignment        = 8;
+const uint32_t kColumnarDefaultChunkRows = 64 * 1024;
+
+enum ColumnarColumn : uint32_t
+{
+    kColumnBlockIndex  = 0, // uint64_t: Index of the block containing the call.
+    kColumnApiCallId   = 1, // uint32_t: format::ApiCallId of the call.
+    kColumnThreadId    = 2, // uint64_t: Thread that made the call.
+    kColumnFrameNumber = 3, // uint32_t: Frame that the call belongs to.
+    kColumnHandleId    = 4, // uint64_t: Dispatchable handle or object that the call was made on, or 0.
+    kColumnPayloadSize = 5, // uint64_t: Size of the encoded parameter data.
+    kColumnCount
+};
+
+#pragma pack(push)
+#pragma pack(4)
+
+struct ColumnarFileHeader
+{
+    uint32_t fourcc;
+    uint32_t version;
+    uint32_t column_count;
+    uint32_t reserved;
+};
+
+struct ColumnarColumnInfo
+{
+    uint32_t column;
+    uint32_t value_size;
+};
+
+struct ColumnarChunkHeader
+{
+    uint32_t row_count;
+    uint32_t column_count;
+};
+
+struct ColumnarColumnChunkHeader
+{
+    uint32_t column;
+    uint32_t compression_type; // format::CompressionType of the column data.
+    uint64_t data_size;        // Size of the column data, excluding padding.
+};
+
+#pragma pack(pop)
+
+struct ColumnarCallRow
+{
+    uint64_t          block_index{ 0 };
+    format::ApiCallId call_id{ format::ApiCallId::ApiCall_Unknown };
+    format::ThreadId  thread_id{ 0 };
+    uint32_t          frame_number{ 0 };
+    format::HandleId  handle_id{ format::kNullHandleId };
+    uint64_t          payload_size{ 0 };
+};
+
+/// @brief Collects call rows and writes them to an output stream in chunks of
+/// compressed columns.
+///
+/// Writing stops at the first failure, which is reported by Flush().
+class ColumnarCallWriter
+{
+  public:
+    /// @param compression_type Compression to try for each column of each
+    /// chunk. Columns are written uncompressed when compression does not reduce
+    /// their size, or when the compressor is not available in this build.
+    ColumnarCallWriter(util::OutputStream*     stream,
+                       format::CompressionType compression_type,
+                       uint32_t                chunk_rows = kColumnarDefaultChunkRows);
+
+    /// Write the file header, which must precede the first row.
+    bool WriteHeader();
+
+    /// Add a row, writing a chunk once chunk_rows rows have been added.
+    void AddRow(const ColumnarCallRow& row);
+
+    /// Write the rows that have not been written yet as a final, shorter chunk.
+    /// @return false if any write has failed.
+    bool Flush();
+
+    uint64_t GetRowCount() const { return row_count_; }
+
+  private:
+    bool WriteChunk();
+
+    /// Compress the data for a column of the current chunk, setting its header
+    /// and the data to write for it.
+    void PrepareColumn(ColumnarColumn column, const void* values, uint32_t row_count);
+
+    bool Write(const void* data, size_t size);
+
+  private:
+    util::OutputStream*               stream_;
+    std::unique_ptr<util::Compressor> compressor_;
+    format::CompressionType           compression_type_;
+    uint32_t                          chunk_rows_;
+    uint64_t                          row_count_;
+    bool                              success_;
+
+    std::vector<uint64_t>          block_indices_;
+    std::vector<format::ApiCallId> call_ids_;
+    std::vector<format::ThreadId>  thread_ids_;
+    std::vector<uint32_t>          frame_numbers_;
+    std::vector<format::HandleId>  handle_ids_;
+    std::vector<uint64_t>          payload_sizes_;
+
+    // Headers and data for each column of the current chunk, which are written after all columns have been compressed.
+    ColumnarColumnChunkHeader column_headers_[kColumnCount];
+    const uint8_t*            column_write_data_[kColumnCount];
+    std::vector<uint8_t>      compressed_data_[kColumnCount];
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_COLUMNAR_CALL_WRITER_H
@@ -96,19 +96,23 @@ AgsDecoder::Decode_agsInitialize(const ApiCallInfo& call_info, const uint8_t* pa
     AGSContext*   context    = nullptr;
     AGSReturnCode result     = AGSReturnCode::AGS_SUCCESS;
 
-    bytes_read +=
-        ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &agsVersion);
+    bytes_read += ValueDecoder::DecodeInt32Value(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &agsVersion);
 
     StructPointerDecoder<Decoded_AGS_CONFIGURATION> pConfiguration;
 
-    bytes_read += pConfiguration.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read +=
+        pConfiguration.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
     bytes_read += ValueDecoder::DecodeVoidPtr(
         (parameter_buffer + bytes_read), (buffer_size - bytes_read), reinterpret_cast<uint64_t*>(&context));
 
     StructPointerDecoder<Decoded_AGS_GPU_INFO> pGPUInfo;
-    bytes_read += pGPUInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value(
-        (parameter_buffer + bytes_read), (buffer_size - bytes_read), reinterpret_cast<int32_t*>(&result));
+    bytes_read +=
+        pGPUInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read),
+                                                 (buffer_size - bytes_read),
+                                                 call_info.compact_encoding,
+                                                 reinterpret_cast<int32_t*>(&result));
 
     AGSConfiguration* ags_config = nullptr;
     if (!pConfiguration.IsNull())
@@ -133,8 +137,10 @@ AgsDecoder::Decode_agsDeInitialize(const ApiCallInfo& call_info, const uint8_t*
     AGSReturnCode result  = AGS_SUCCESS;
     bytes_read += ValueDecoder::DecodeVoidPtr(
         (parameter_buffer + bytes_read), (buffer_size - bytes_read), reinterpret_cast<uint64_t*>(&context));
-    bytes_read += ValueDecoder::DecodeInt32Value(
-        (parameter_buffer + bytes_read), (buffer_size - bytes_read), reinterpret_cast<int32_t*>(&result));
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read),
+                                                 (buffer_size - bytes_read),
+                                                 call_info.compact_encoding,
+                                                 reinterpret_cast<int32_t*>(&result));
 
     for (auto consumer : GetConsumers())
     {
@@ -157,16 +163,21 @@ size_t AgsDecoder::Decode_agsDriverExtensionsDX12_CreateDevice_620(const ApiCall
         (parameter_buffer + bytes_read), (buffer_size - bytes_read), reinterpret_cast<uint64_t*>(&context));
 
     StructPointerDecoder<Decoded_AGS_DX12_DEVICE_CREATION_PARAMS> pCreationParams;
-    bytes_read += pCreationParams.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read +=
+        pCreationParams.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     StructPointerDecoder<Decoded_AGS_DX12_EXTENSION_PARAMS> pExtensionParams;
-    bytes_read += pExtensionParams.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += pExtensionParams.Decode(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     StructPointerDecoder<Decoded_AGS_DX12_RETURN_PARAMS> pReturnParams;
-    bytes_read += pReturnParams.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read +=
+        pReturnParams.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
-    bytes_read += ValueDecoder::DecodeInt32Value(
-        (parameter_buffer + bytes_read), (buffer_size - bytes_read), reinterpret_cast<int32_t*>(&result));
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read),
+                                                 (buffer_size - bytes_read),
+                                                 call_info.compact_encoding,
+                                                 reinterpret_cast<int32_t*>(&result));
 
     for (auto consumer : GetConsumers())
     {
@@ -200,11 +211,14 @@ size_t AgsDecoder::Decode_agsDriverExtensionsDX12_DestroyDevice(const ApiCallInf
 
     bytes_read += ValueDecoder::DecodeVoidPtr(
         (parameter_buffer + bytes_read), (buffer_size - bytes_read), reinterpret_cast<uint64_t*>(&context));
-    bytes_read +=
-        ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pDevice);
-    bytes_read += pDeviceReferences.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value(
-        (parameter_buffer + bytes_read), (buffer_size - bytes_read), reinterpret_cast<int32_t*>(&result));
+    bytes_read += ValueDecoder::DecodeHandleIdValue(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pDevice);
+    bytes_read += pDeviceReferences.DecodeUInt32(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read),
+                                                 (buffer_size - bytes_read),
+                                                 call_info.compact_encoding,
+                                                 reinterpret_cast<int32_t*>(&result));
 
     for (auto consumer : GetConsumers())
     {
@@ -226,13 +240,17 @@ size_t AgsDecoder::Decode_agsCheckDriverVersion(const ApiCallInfo& call_info,
     char*        pRadeonSoftwareVersionReported = DecodeAllocator::Allocate<char>(kDriverSoftwareStringSize, true);
     unsigned int radeonSoftwareVersionRequired  = 0;
     radeonSoftwareVersionReported.SetExternalMemory(pRadeonSoftwareVersionReported, kDriverSoftwareStringSize);
-    bytes_read += radeonSoftwareVersionReported.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += radeonSoftwareVersionReported.Decode(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read),
                                                   (buffer_size - bytes_read),
+                                                  call_info.compact_encoding,
                                                   reinterpret_cast<uint32_t*>(&radeonSoftwareVersionRequired));
-    bytes_read += ValueDecoder::DecodeInt32Value(
-        (parameter_buffer + bytes_read), (buffer_size - bytes_read), reinterpret_cast<int32_t*>(&result));
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read),
+                                                 (buffer_size - bytes_read),
+                                                 call_info.compact_encoding,
+                                                 reinterpret_cast<int32_t*>(&result));
 
     for (auto consumer : GetConsumers())
     {
@@ -250,8 +268,10 @@ size_t AgsDecoder::Decode_agsGetVersionNumber(const ApiCallInfo& call_info,
     size_t bytes_read = 0;
 
     int result = 0;
-    bytes_read += ValueDecoder::DecodeInt32Value(
-        (parameter_buffer + bytes_read), (buffer_size - bytes_read), reinterpret_cast<int32_t*>(&result));
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read),
+                                                 (buffer_size - bytes_read),
+                                                 call_info.compact_encoding,
+                                                 reinterpret_cast<int32_t*>(&result));
 
     for (auto consumer : GetConsumers())
     {
@@ -273,17 +293,20 @@ AgsDecoder::Decode_agsSetDisplayMode(const ApiCallInfo& call_info, const uint8_t
 
     bytes_read += ValueDecoder::DecodeVoidPtr(
         (parameter_buffer + bytes_read), (buffer_size - bytes_read), reinterpret_cast<uint64_t*>(&context));
-    bytes_read +=
-        ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &deviceIndex);
-    bytes_read +=
-        ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &displayIndex);
+    bytes_read += ValueDecoder::DecodeInt32Value(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &deviceIndex);
+    bytes_read += ValueDecoder::DecodeInt32Value(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &displayIndex);
 
     Decoded_AGS_DISPLAY_SETTINGS settings;
     settings.decoded_value = DecodeAllocator::Allocate<AGSDisplaySettings>();
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &settings);
+    bytes_read += DecodeStruct(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &settings);
 
-    bytes_read += ValueDecoder::DecodeInt32Value(
-        (parameter_buffer + bytes_read), (buffer_size - bytes_read), reinterpret_cast<int32_t*>(&result));
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read),
+                                                 (buffer_size - bytes_read),
+                                                 call_info.compact_encoding,
+                                                 reinterpret_cast<int32_t*>(&result));
 
     for (auto consumer : GetConsumers())
     {
@@ -309,12 +332,15 @@ size_t AgsDecoder::Decode_agsDriverExtensionsDX12_PushMarker(const ApiCallInfo&
 
     bytes_read += ValueDecoder::DecodeVoidPtr(
         (parameter_buffer + bytes_read), (buffer_size - bytes_read), reinterpret_cast<uint64_t*>(&context));
-    bytes_read +=
-        ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pCommandList);
-    bytes_read += markerDataDecoder.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += ValueDecoder::DecodeHandleIdValue(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pCommandList);
+    bytes_read += markerDataDecoder.Decode(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
-    bytes_read += ValueDecoder::DecodeInt32Value(
-        (parameter_buffer + bytes_read), (buffer_size - bytes_read), reinterpret_cast<int32_t*>(&result));
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read),
+                                                 (buffer_size - bytes_read),
+                                                 call_info.compact_encoding,
+                                                 reinterpret_cast<int32_t*>(&result));
 
     for (auto consumer : GetConsumers())
     {
@@ -336,11 +362,13 @@ size_t AgsDecoder::Decode_agsDriverExtensionsDX12_PopMarker(const ApiCallInfo& c
 
     bytes_read += ValueDecoder::DecodeVoidPtr(
         (parameter_buffer + bytes_read), (buffer_size - bytes_read), reinterpret_cast<uint64_t*>(&context));
-    bytes_read +=
-        ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pCommandList);
+    bytes_read += ValueDecoder::DecodeHandleIdValue(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pCommandList);
 
-    bytes_read += ValueDecoder::DecodeInt32Value(
-        (parameter_buffer + bytes_read), (buffer_size - bytes_read), reinterpret_cast<int32_t*>(&result));
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read),
+                                                 (buffer_size - bytes_read),
+                                                 call_info.compact_encoding,
+                                                 reinterpret_cast<int32_t*>(&result));
 
     for (auto consumer : GetConsumers())
     {
@@ -365,12 +393,15 @@ size_t AgsDecoder::Decode_agsDriverExtensionsDX12_SetMarker(const ApiCallInfo& c
 
     bytes_read += ValueDecoder::DecodeVoidPtr(
         (parameter_buffer + bytes_read), (buffer_size - bytes_read), reinterpret_cast<uint64_t*>(&context));
-    bytes_read +=
-        ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pCommandList);
-    bytes_read += markerDataDecoder.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-
-    bytes_read += ValueDecoder::DecodeInt32Value(
-        (parameter_buffer + bytes_read), (buffer_size - bytes_read), reinterpret_cast<int32_t*>(&result));
+    bytes_read += ValueDecoder::DecodeHandleIdValue(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pCommandList);
+    bytes_read += markerDataDecoder.Decode(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read),
+                                                 (buffer_size - bytes_read),
+                                                 call_info.compact_encoding,
+                                                 reinterpret_cast<int32_t*>(&result));
 
     for (auto consumer : GetConsumers())
     {
@@ -119,16 +119,29 @@ struct Decoded_AGS_DISPLAY_SETTINGS
     AGSDisplaySettings* decoded_value{ nullptr };
 };
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_AGS_RECT* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_AGS_DISPLAY_INFO* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_AGS_DEVICE_INFO* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_AGS_DX12_DEVICE_CREATION_PARAMS* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_AGS_DX12_EXTENSION_PARAMS* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_AGS_DX12_EXTENSIONS_SUPPORTED* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_AGS_DX12_RETURN_PARAMS* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_AGS_CONFIGURATION* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_AGS_GPU_INFO* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_AGS_DISPLAY_SETTINGS* wrapper);
+size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_AGS_RECT* wrapper);
+size_t
+DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_AGS_DISPLAY_INFO* wrapper);
+size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_AGS_DEVICE_INFO* wrapper);
+size_t DecodeStruct(const uint8_t*                           buffer,
+                    size_t                                   buffer_size,
+                    bool                                     compact_encoding,
+                    Decoded_AGS_DX12_DEVICE_CREATION_PARAMS* wrapper);
+size_t DecodeStruct(const uint8_t*                     buffer,
+                    size_t                             buffer_size,
+                    bool                               compact_encoding,
+                    Decoded_AGS_DX12_EXTENSION_PARAMS* wrapper);
+size_t DecodeStruct(const uint8_t*                         buffer,
+                    size_t                                 buffer_size,
+                    bool                                   compact_encoding,
+                    Decoded_AGS_DX12_EXTENSIONS_SUPPORTED* wrapper);
+size_t
+DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_AGS_DX12_RETURN_PARAMS* wrapper);
+size_t
+DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_AGS_CONFIGURATION* wrapper);
+size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_AGS_GPU_INFO* wrapper);
+size_t
+DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_AGS_DISPLAY_SETTINGS* wrapper);
 
 GFXRECON_END_NAMESPACE(decode)
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -28,488 +28,584 @@ GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
 template <typename T>
-size_t DecodeDescriptorStruct(const uint8_t* buffer, size_t buffer_size, T* wrapper)
+size_t DecodeDescriptorStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, T* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t                   bytes_read = 0;
     typename T::struct_type* value      = wrapper->decoded_value;
 
-    bytes_read +=
-        ValueDecoder::DecodeHandleIdValue((buffer + bytes_read), (buffer_size - bytes_read), &(wrapper->heap_id));
+    bytes_read += ValueDecoder::DecodeHandleIdValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(wrapper->heap_id));
     value->ptr = 0;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((buffer + bytes_read), (buffer_size - bytes_read), &(wrapper->index));
+    bytes_read += ValueDecoder::DecodeUInt32Value(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(wrapper->index));
 
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_CPU_DESCRIPTOR_HANDLE* wrapper)
+size_t DecodeStruct(const uint8_t*                       buffer,
+                    size_t                               buffer_size,
+                    bool                                 compact_encoding,
+                    Decoded_D3D12_CPU_DESCRIPTOR_HANDLE* wrapper)
 {
-    return DecodeDescriptorStruct(buffer, buffer_size, wrapper);
+    return DecodeDescriptorStruct(buffer, buffer_size, compact_encoding, wrapper);
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_CLEAR_VALUE* wrapper)
+size_t
+DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_D3D12_CLEAR_VALUE* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t             bytes_read = 0;
     D3D12_CLEAR_VALUE* value      = wrapper->decoded_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->Format));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->Format));
 
     wrapper->Color.SetExternalMemory(value->Color, 4);
-    bytes_read += wrapper->Color.DecodeFloat((buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += wrapper->Color.DecodeFloat((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding);
 
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_RESOURCE_BARRIER* wrapper)
+size_t
+DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_D3D12_RESOURCE_BARRIER* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t                  bytes_read = 0;
     D3D12_RESOURCE_BARRIER* value      = wrapper->decoded_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->Type));
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->Flags));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->Type));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->Flags));
 
     switch (value->Type)
     {
         case D3D12_RESOURCE_BARRIER_TYPE_TRANSITION:
             wrapper->Transition                = DecodeAllocator::Allocate<Decoded_D3D12_RESOURCE_TRANSITION_BARRIER>();
             wrapper->Transition->decoded_value = &(value->Transition);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Transition);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Transition);
             break;
         case D3D12_RESOURCE_BARRIER_TYPE_ALIASING:
             wrapper->Aliasing                = DecodeAllocator::Allocate<Decoded_D3D12_RESOURCE_ALIASING_BARRIER>();
             wrapper->Aliasing->decoded_value = &(value->Aliasing);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Aliasing);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Aliasing);
             break;
         case D3D12_RESOURCE_BARRIER_TYPE_UAV:
             wrapper->UAV                = DecodeAllocator::Allocate<Decoded_D3D12_RESOURCE_UAV_BARRIER>();
             wrapper->UAV->decoded_value = &(value->UAV);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->UAV);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->UAV);
             break;
     }
 
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_TEXTURE_COPY_LOCATION* wrapper)
+size_t DecodeStruct(const uint8_t*                       buffer,
+                    size_t                               buffer_size,
+                    bool                                 compact_encoding,
+                    Decoded_D3D12_TEXTURE_COPY_LOCATION* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t                       bytes_read = 0;
     D3D12_TEXTURE_COPY_LOCATION* value      = wrapper->decoded_value;
 
-    bytes_read +=
-        ValueDecoder::DecodeHandleIdValue((buffer + bytes_read), (buffer_size - bytes_read), &(wrapper->pResource));
+    bytes_read += ValueDecoder::DecodeHandleIdValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(wrapper->pResource));
     value->pResource = nullptr;
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->Type));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->Type));
 
     switch (value->Type)
     {
         case D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX:
             bytes_read += ValueDecoder::DecodeUInt32Value(
-                (buffer + bytes_read), (buffer_size - bytes_read), &(value->SubresourceIndex));
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->SubresourceIndex));
             break;
         case D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT:
             wrapper->PlacedFootprint = DecodeAllocator::Allocate<Decoded_D3D12_PLACED_SUBRESOURCE_FOOTPRINT>();
             wrapper->PlacedFootprint->decoded_value = &(value->PlacedFootprint);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->PlacedFootprint);
+            bytes_read += DecodeStruct(
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->PlacedFootprint);
             break;
     }
 
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_SHADER_RESOURCE_VIEW_DESC* wrapper)
+size_t DecodeStruct(const uint8_t*                           buffer,
+                    size_t                                   buffer_size,
+                    bool                                     compact_encoding,
+                    Decoded_D3D12_SHADER_RESOURCE_VIEW_DESC* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t                           bytes_read = 0;
     D3D12_SHADER_RESOURCE_VIEW_DESC* value      = wrapper->decoded_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->Format));
-    bytes_read +=
-        ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->ViewDimension));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->Format));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->ViewDimension));
     bytes_read += ValueDecoder::DecodeUInt32Value(
-        (buffer + bytes_read), (buffer_size - bytes_read), &(value->Shader4ComponentMapping));
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->Shader4ComponentMapping));
 
     switch (value->ViewDimension)
     {
         case D3D12_SRV_DIMENSION_BUFFER:
             wrapper->Buffer                = DecodeAllocator::Allocate<Decoded_D3D12_BUFFER_SRV>();
             wrapper->Buffer->decoded_value = &(value->Buffer);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Buffer);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Buffer);
             break;
         case D3D12_SRV_DIMENSION_TEXTURE1D:
             wrapper->Texture1D                = DecodeAllocator::Allocate<Decoded_D3D12_TEX1D_SRV>();
             wrapper->Texture1D->decoded_value = &(value->Texture1D);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Texture1D);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Texture1D);
             break;
         case D3D12_SRV_DIMENSION_TEXTURE1DARRAY:
             wrapper->Texture1DArray                = DecodeAllocator::Allocate<Decoded_D3D12_TEX1D_ARRAY_SRV>();
             wrapper->Texture1DArray->decoded_value = &(value->Texture1DArray);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Texture1DArray);
+            bytes_read += DecodeStruct(
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Texture1DArray);
             break;
         case D3D12_SRV_DIMENSION_TEXTURE2D:
             wrapper->Texture2D                = DecodeAllocator::Allocate<Decoded_D3D12_TEX2D_SRV>();
             wrapper->Texture2D->decoded_value = &(value->Texture2D);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Texture2D);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Texture2D);
             break;
         case D3D12_SRV_DIMENSION_TEXTURE2DARRAY:
             wrapper->Texture2DArray                = DecodeAllocator::Allocate<Decoded_D3D12_TEX2D_ARRAY_SRV>();
             wrapper->Texture2DArray->decoded_value = &(value->Texture2DArray);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Texture2DArray);
+            bytes_read += DecodeStruct(
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Texture2DArray);
             break;
         case D3D12_SRV_DIMENSION_TEXTURE2DMS:
             wrapper->Texture2DMS                = DecodeAllocator::Allocate<Decoded_D3D12_TEX2DMS_SRV>();
             wrapper->Texture2DMS->decoded_value = &(value->Texture2DMS);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Texture2DMS);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Texture2DMS);
             break;
         case D3D12_SRV_DIMENSION_TEXTURE2DMSARRAY:
             wrapper->Texture2DMSArray                = DecodeAllocator::Allocate<Decoded_D3D12_TEX2DMS_ARRAY_SRV>();
             wrapper->Texture2DMSArray->decoded_value = &(value->Texture2DMSArray);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Texture2DMSArray);
+            bytes_read += DecodeStruct(
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Texture2DMSArray);
             break;
         case D3D12_SRV_DIMENSION_TEXTURE3D:
             wrapper->Texture3D                = DecodeAllocator::Allocate<Decoded_D3D12_TEX3D_SRV>();
             wrapper->Texture3D->decoded_value = &(value->Texture3D);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Texture3D);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Texture3D);
             break;
         case D3D12_SRV_DIMENSION_TEXTURECUBE:
             wrapper->TextureCube                = DecodeAllocator::Allocate<Decoded_D3D12_TEXCUBE_SRV>();
             wrapper->TextureCube->decoded_value = &(value->TextureCube);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->TextureCube);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->TextureCube);
             break;
         case D3D12_SRV_DIMENSION_TEXTURECUBEARRAY:
             wrapper->TextureCubeArray                = DecodeAllocator::Allocate<Decoded_D3D12_TEXCUBE_ARRAY_SRV>();
             wrapper->TextureCubeArray->decoded_value = &(value->TextureCubeArray);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->TextureCubeArray);
+            bytes_read += DecodeStruct(
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->TextureCubeArray);
             break;
         case D3D12_SRV_DIMENSION_RAYTRACING_ACCELERATION_STRUCTURE:
             wrapper->RaytracingAccelerationStructure =
                 DecodeAllocator::Allocate<Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_SRV>();
             wrapper->RaytracingAccelerationStructure->decoded_value = &(value->RaytracingAccelerationStructure);
-            bytes_read += DecodeStruct(
-                (buffer + bytes_read), (buffer_size - bytes_read), wrapper->RaytracingAccelerationStructure);
+            bytes_read += DecodeStruct((buffer + bytes_read),
+                                       (buffer_size - bytes_read),
+                                       compact_encoding,
+                                       wrapper->RaytracingAccelerationStructure);
             break;
     }
 
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_UNORDERED_ACCESS_VIEW_DESC* wrapper)
+size_t DecodeStruct(const uint8_t*                            buffer,
+                    size_t                                    buffer_size,
+                    bool                                      compact_encoding,
+                    Decoded_D3D12_UNORDERED_ACCESS_VIEW_DESC* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t                            bytes_read = 0;
     D3D12_UNORDERED_ACCESS_VIEW_DESC* value      = wrapper->decoded_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->Format));
-    bytes_read +=
-        ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->ViewDimension));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->Format));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->ViewDimension));
 
     switch (value->ViewDimension)
     {
         case D3D12_UAV_DIMENSION_BUFFER:
             wrapper->Buffer                = DecodeAllocator::Allocate<Decoded_D3D12_BUFFER_UAV>();
             wrapper->Buffer->decoded_value = &(value->Buffer);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Buffer);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Buffer);
             break;
         case D3D12_UAV_DIMENSION_TEXTURE1D:
             wrapper->Texture1D                = DecodeAllocator::Allocate<Decoded_D3D12_TEX1D_UAV>();
             wrapper->Texture1D->decoded_value = &(value->Texture1D);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Texture1D);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Texture1D);
             break;
         case D3D12_UAV_DIMENSION_TEXTURE1DARRAY:
             wrapper->Texture1DArray                = DecodeAllocator::Allocate<Decoded_D3D12_TEX1D_ARRAY_UAV>();
             wrapper->Texture1DArray->decoded_value = &(value->Texture1DArray);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Texture1DArray);
+            bytes_read += DecodeStruct(
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Texture1DArray);
             break;
         case D3D12_UAV_DIMENSION_TEXTURE2D:
             wrapper->Texture2D                = DecodeAllocator::Allocate<Decoded_D3D12_TEX2D_UAV>();
             wrapper->Texture2D->decoded_value = &(value->Texture2D);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Texture2D);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Texture2D);
             break;
         case D3D12_UAV_DIMENSION_TEXTURE2DARRAY:
             wrapper->Texture2DArray                = DecodeAllocator::Allocate<Decoded_D3D12_TEX2D_ARRAY_UAV>();
             wrapper->Texture2DArray->decoded_value = &(value->Texture2DArray);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Texture2DArray);
+            bytes_read += DecodeStruct(
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Texture2DArray);
             break;
         case D3D12_UAV_DIMENSION_TEXTURE2DMS:
             wrapper->Texture2DMS                = DecodeAllocator::Allocate<Decoded_D3D12_TEX2DMS_UAV>();
             wrapper->Texture2DMS->decoded_value = &(value->Texture2DMS);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Texture2DMS);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Texture2DMS);
             break;
         case D3D12_UAV_DIMENSION_TEXTURE2DMSARRAY:
             wrapper->Texture2DMSArray                = DecodeAllocator::Allocate<Decoded_D3D12_TEX2DMS_ARRAY_UAV>();
             wrapper->Texture2DMSArray->decoded_value = &(value->Texture2DMSArray);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Texture2DMSArray);
+            bytes_read += DecodeStruct(
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Texture2DMSArray);
             break;
         case D3D12_UAV_DIMENSION_TEXTURE3D:
             wrapper->Texture3D                = DecodeAllocator::Allocate<Decoded_D3D12_TEX3D_UAV>();
             wrapper->Texture3D->decoded_value = &(value->Texture3D);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Texture3D);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Texture3D);
             break;
     }
 
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_RENDER_TARGET_VIEW_DESC* wrapper)
+size_t DecodeStruct(const uint8_t*                         buffer,
+                    size_t                                 buffer_size,
+                    bool                                   compact_encoding,
+                    Decoded_D3D12_RENDER_TARGET_VIEW_DESC* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t                         bytes_read = 0;
     D3D12_RENDER_TARGET_VIEW_DESC* value      = wrapper->decoded_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->Format));
-    bytes_read +=
-        ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->ViewDimension));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->Format));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->ViewDimension));
 
     switch (value->ViewDimension)
     {
         case D3D12_RTV_DIMENSION_BUFFER:
             wrapper->Buffer                = DecodeAllocator::Allocate<Decoded_D3D12_BUFFER_RTV>();
             wrapper->Buffer->decoded_value = &(value->Buffer);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Buffer);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Buffer);
             break;
         case D3D12_RTV_DIMENSION_TEXTURE1D:
             wrapper->Texture1D                = DecodeAllocator::Allocate<Decoded_D3D12_TEX1D_RTV>();
             wrapper->Texture1D->decoded_value = &(value->Texture1D);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Texture1D);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Texture1D);
             break;
         case D3D12_RTV_DIMENSION_TEXTURE1DARRAY:
             wrapper->Texture1DArray                = DecodeAllocator::Allocate<Decoded_D3D12_TEX1D_ARRAY_RTV>();
             wrapper->Texture1DArray->decoded_value = &(value->Texture1DArray);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Texture1DArray);
+            bytes_read += DecodeStruct(
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Texture1DArray);
             break;
         case D3D12_RTV_DIMENSION_TEXTURE2D:
             wrapper->Texture2D                = DecodeAllocator::Allocate<Decoded_D3D12_TEX2D_RTV>();
             wrapper->Texture2D->decoded_value = &(value->Texture2D);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Texture2D);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Texture2D);
             break;
         case D3D12_RTV_DIMENSION_TEXTURE2DARRAY:
             wrapper->Texture2DArray                = DecodeAllocator::Allocate<Decoded_D3D12_TEX2D_ARRAY_RTV>();
             wrapper->Texture2DArray->decoded_value = &(value->Texture2DArray);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Texture2DArray);
+            bytes_read += DecodeStruct(
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Texture2DArray);
             break;
         case D3D12_RTV_DIMENSION_TEXTURE2DMS:
             wrapper->Texture2DMS                = DecodeAllocator::Allocate<Decoded_D3D12_TEX2DMS_RTV>();
             wrapper->Texture2DMS->decoded_value = &(value->Texture2DMS);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Texture2DMS);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Texture2DMS);
             break;
         case D3D12_RTV_DIMENSION_TEXTURE2DMSARRAY:
             wrapper->Texture2DMSArray                = DecodeAllocator::Allocate<Decoded_D3D12_TEX2DMS_ARRAY_RTV>();
             wrapper->Texture2DMSArray->decoded_value = &(value->Texture2DMSArray);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Texture2DMSArray);
+            bytes_read += DecodeStruct(
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Texture2DMSArray);
             break;
         case D3D12_RTV_DIMENSION_TEXTURE3D:
             wrapper->Texture3D                = DecodeAllocator::Allocate<Decoded_D3D12_TEX3D_RTV>();
             wrapper->Texture3D->decoded_value = &(value->Texture3D);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Texture3D);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Texture3D);
             break;
     }
 
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_DEPTH_STENCIL_VIEW_DESC* wrapper)
+size_t DecodeStruct(const uint8_t*                         buffer,
+                    size_t                                 buffer_size,
+                    bool                                   compact_encoding,
+                    Decoded_D3D12_DEPTH_STENCIL_VIEW_DESC* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t                         bytes_read = 0;
     D3D12_DEPTH_STENCIL_VIEW_DESC* value      = wrapper->decoded_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->Format));
-    bytes_read +=
-        ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->ViewDimension));
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->Flags));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->Format));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->ViewDimension));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->Flags));
 
     switch (value->ViewDimension)
     {
         case D3D12_DSV_DIMENSION_TEXTURE1D:
             wrapper->Texture1D                = DecodeAllocator::Allocate<Decoded_D3D12_TEX1D_DSV>();
             wrapper->Texture1D->decoded_value = &(value->Texture1D);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Texture1D);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Texture1D);
             break;
         case D3D12_DSV_DIMENSION_TEXTURE1DARRAY:
             wrapper->Texture1DArray                = DecodeAllocator::Allocate<Decoded_D3D12_TEX1D_ARRAY_DSV>();
             wrapper->Texture1DArray->decoded_value = &(value->Texture1DArray);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Texture1DArray);
+            bytes_read += DecodeStruct(
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Texture1DArray);
             break;
         case D3D12_DSV_DIMENSION_TEXTURE2D:
             wrapper->Texture2D                = DecodeAllocator::Allocate<Decoded_D3D12_TEX2D_DSV>();
             wrapper->Texture2D->decoded_value = &(value->Texture2D);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Texture2D);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Texture2D);
             break;
         case D3D12_DSV_DIMENSION_TEXTURE2DARRAY:
             wrapper->Texture2DArray                = DecodeAllocator::Allocate<Decoded_D3D12_TEX2D_ARRAY_DSV>();
             wrapper->Texture2DArray->decoded_value = &(value->Texture2DArray);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Texture2DArray);
+            bytes_read += DecodeStruct(
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Texture2DArray);
             break;
         case D3D12_DSV_DIMENSION_TEXTURE2DMS:
             wrapper->Texture2DMS                = DecodeAllocator::Allocate<Decoded_D3D12_TEX2DMS_DSV>();
             wrapper->Texture2DMS->decoded_value = &(value->Texture2DMS);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Texture2DMS);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Texture2DMS);
             break;
         case D3D12_DSV_DIMENSION_TEXTURE2DMSARRAY:
             wrapper->Texture2DMSArray                = DecodeAllocator::Allocate<Decoded_D3D12_TEX2DMS_ARRAY_DSV>();
             wrapper->Texture2DMSArray->decoded_value = &(value->Texture2DMSArray);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Texture2DMSArray);
+            bytes_read += DecodeStruct(
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Texture2DMSArray);
             break;
     }
 
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_ROOT_PARAMETER* wrapper)
+size_t
+DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_D3D12_ROOT_PARAMETER* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t                bytes_read = 0;
     D3D12_ROOT_PARAMETER* value      = wrapper->decoded_value;
 
-    bytes_read +=
-        ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->ParameterType));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->ParameterType));
 
     switch (value->ParameterType)
     {
         case D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE:
             wrapper->DescriptorTable                = DecodeAllocator::Allocate<Decoded_D3D12_ROOT_DESCRIPTOR_TABLE>();
             wrapper->DescriptorTable->decoded_value = &(value->DescriptorTable);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->DescriptorTable);
+            bytes_read += DecodeStruct(
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->DescriptorTable);
             break;
         case D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS:
             wrapper->Constants                = DecodeAllocator::Allocate<Decoded_D3D12_ROOT_CONSTANTS>();
             wrapper->Constants->decoded_value = &(value->Constants);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Constants);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Constants);
             break;
         case D3D12_ROOT_PARAMETER_TYPE_CBV:
         case D3D12_ROOT_PARAMETER_TYPE_SRV:
         case D3D12_ROOT_PARAMETER_TYPE_UAV:
             wrapper->Descriptor                = DecodeAllocator::Allocate<Decoded_D3D12_ROOT_DESCRIPTOR>();
             wrapper->Descriptor->decoded_value = &(value->Descriptor);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Descriptor);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Descriptor);
             break;
     }
 
-    bytes_read +=
-        ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->ShaderVisibility));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->ShaderVisibility));
 
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_ROOT_PARAMETER1* wrapper)
+size_t
+DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_D3D12_ROOT_PARAMETER1* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t                 bytes_read = 0;
     D3D12_ROOT_PARAMETER1* value      = wrapper->decoded_value;
 
-    bytes_read +=
-        ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->ParameterType));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->ParameterType));
 
     switch (value->ParameterType)
     {
         case D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE:
             wrapper->DescriptorTable                = DecodeAllocator::Allocate<Decoded_D3D12_ROOT_DESCRIPTOR_TABLE1>();
             wrapper->DescriptorTable->decoded_value = &(value->DescriptorTable);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->DescriptorTable);
+            bytes_read += DecodeStruct(
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->DescriptorTable);
             break;
         case D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS:
             wrapper->Constants                = DecodeAllocator::Allocate<Decoded_D3D12_ROOT_CONSTANTS>();
             wrapper->Constants->decoded_value = &(value->Constants);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Constants);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Constants);
             break;
         case D3D12_ROOT_PARAMETER_TYPE_CBV:
         case D3D12_ROOT_PARAMETER_TYPE_SRV:
         case D3D12_ROOT_PARAMETER_TYPE_UAV:
             wrapper->Descriptor                = DecodeAllocator::Allocate<Decoded_D3D12_ROOT_DESCRIPTOR1>();
             wrapper->Descriptor->decoded_value = &(value->Descriptor);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Descriptor);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Descriptor);
             break;
     }
 
-    bytes_read +=
-        ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->ShaderVisibility));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->ShaderVisibility));
 
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_VERSIONED_ROOT_SIGNATURE_DESC* wrapper)
+size_t DecodeStruct(const uint8_t*                               buffer,
+                    size_t                                       buffer_size,
+                    bool                                         compact_encoding,
+                    Decoded_D3D12_VERSIONED_ROOT_SIGNATURE_DESC* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t                               bytes_read = 0;
     D3D12_VERSIONED_ROOT_SIGNATURE_DESC* value      = wrapper->decoded_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->Version));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->Version));
 
     switch (value->Version)
     {
         case D3D_ROOT_SIGNATURE_VERSION_1_0:
             wrapper->Desc_1_0                = DecodeAllocator::Allocate<Decoded_D3D12_ROOT_SIGNATURE_DESC>();
             wrapper->Desc_1_0->decoded_value = &(value->Desc_1_0);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Desc_1_0);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Desc_1_0);
             break;
         case D3D_ROOT_SIGNATURE_VERSION_1_1:
             wrapper->Desc_1_1                = DecodeAllocator::Allocate<Decoded_D3D12_ROOT_SIGNATURE_DESC1>();
             wrapper->Desc_1_1->decoded_value = &(value->Desc_1_1);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Desc_1_1);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Desc_1_1);
             break;
         case D3D_ROOT_SIGNATURE_VERSION_1_2:
             wrapper->Desc_1_2                = DecodeAllocator::Allocate<Decoded_D3D12_ROOT_SIGNATURE_DESC2>();
             wrapper->Desc_1_2->decoded_value = &(value->Desc_1_2);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Desc_1_2);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Desc_1_2);
             break;
     }
 
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_INDIRECT_ARGUMENT_DESC* wrapper)
+size_t DecodeStruct(const uint8_t*                        buffer,
+                    size_t                                buffer_size,
+                    bool                                  compact_encoding,
+                    Decoded_D3D12_INDIRECT_ARGUMENT_DESC* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t                        bytes_read = 0;
     D3D12_INDIRECT_ARGUMENT_DESC* value      = wrapper->decoded_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->Type));
-    bytes_read += ValueDecoder::DecodeUInt32Value(
-        (buffer + bytes_read), (buffer_size - bytes_read), &(value->Constant.RootParameterIndex));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->Type));
     bytes_read += ValueDecoder::DecodeUInt32Value(
-        (buffer + bytes_read), (buffer_size - bytes_read), &(value->Constant.DestOffsetIn32BitValues));
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->Constant.RootParameterIndex));
+    bytes_read += ValueDecoder::DecodeUInt32Value((buffer + bytes_read),
+                                                  (buffer_size - bytes_read),
+                                                  compact_encoding,
+                                                  &(value->Constant.DestOffsetIn32BitValues));
     bytes_read += ValueDecoder::DecodeUInt32Value(
-        (buffer + bytes_read), (buffer_size - bytes_read), &(value->Constant.Num32BitValuesToSet));
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->Constant.Num32BitValuesToSet));
 
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_RAYTRACING_GEOMETRY_DESC* wrapper)
+size_t DecodeStruct(const uint8_t*                          buffer,
+                    size_t                                  buffer_size,
+                    bool                                    compact_encoding,
+                    Decoded_D3D12_RAYTRACING_GEOMETRY_DESC* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t                          bytes_read = 0;
     D3D12_RAYTRACING_GEOMETRY_DESC* value      = wrapper->decoded_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->Type));
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->Flags));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->Type));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->Flags));
 
     switch (value->Type)
     {
         case D3D12_RAYTRACING_GEOMETRY_TYPE_TRIANGLES:
             wrapper->Triangles = DecodeAllocator::Allocate<Decoded_D3D12_RAYTRACING_GEOMETRY_TRIANGLES_DESC>();
             wrapper->Triangles->decoded_value = &(value->Triangles);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Triangles);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Triangles);
             break;
         case D3D12_RAYTRACING_GEOMETRY_TYPE_PROCEDURAL_PRIMITIVE_AABBS:
             wrapper->AABBs                = DecodeAllocator::Allocate<Decoded_D3D12_RAYTRACING_GEOMETRY_AABBS_DESC>();
             wrapper->AABBs->decoded_value = &(value->AABBs);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->AABBs);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->AABBs);
             break;
     }
 
@@ -518,6 +614,7 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_RAY
 
 size_t DecodeStruct(const uint8_t*                                                buffer,
                     size_t                                                        buffer_size,
+                    bool                                                          compact_encoding,
                     Decoded_D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
@@ -525,18 +622,20 @@ size_t DecodeStruct(const uint8_t*
     size_t                                                bytes_read = 0;
     D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS* value      = wrapper->decoded_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->Type));
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->Flags));
-    bytes_read +=
-        ValueDecoder::DecodeUInt32Value((buffer + bytes_read), (buffer_size - bytes_read), &(value->NumDescs));
-    bytes_read +=
-        ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->DescsLayout));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->Type));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->Flags));
+    bytes_read += ValueDecoder::DecodeUInt32Value(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->NumDescs));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->DescsLayout));
 
     switch (value->Type)
     {
         case D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL:
             bytes_read += ValueDecoder::DecodeUInt64Value(
-                (buffer + bytes_read), (buffer_size - bytes_read), &(value->InstanceDescs));
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->InstanceDescs));
             break;
         case D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL:
             switch (value->DescsLayout)
@@ -544,13 +643,15 @@ size_t DecodeStruct(const uint8_t*
                 case D3D12_ELEMENTS_LAYOUT_ARRAY:
                     wrapper->pGeometryDescs =
                         DecodeAllocator::Allocate<StructPointerDecoder<Decoded_D3D12_RAYTRACING_GEOMETRY_DESC>>();
-                    bytes_read += wrapper->pGeometryDescs->Decode((buffer + bytes_read), (buffer_size - bytes_read));
+                    bytes_read += wrapper->pGeometryDescs->Decode(
+                        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding);
                     value->pGeometryDescs = wrapper->pGeometryDescs->GetPointer();
                     break;
                 case D3D12_ELEMENTS_LAYOUT_ARRAY_OF_POINTERS:
                     wrapper->ppGeometryDescs =
                         DecodeAllocator::Allocate<StructPointerDecoder<Decoded_D3D12_RAYTRACING_GEOMETRY_DESC*>>();
-                    bytes_read += wrapper->ppGeometryDescs->Decode((buffer + bytes_read), (buffer_size - bytes_read));
+                    bytes_read += wrapper->ppGeometryDescs->Decode(
+                        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding);
                     value->ppGeometryDescs = wrapper->ppGeometryDescs->GetPointer();
                     break;
             }
@@ -560,58 +661,70 @@ size_t DecodeStruct(const uint8_t*
     return bytes_read;
 }
 
-size_t
-DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_VERSIONED_DEVICE_REMOVED_EXTENDED_DATA* wrapper)
+size_t DecodeStruct(const uint8_t*                                        buffer,
+                    size_t                                                buffer_size,
+                    bool                                                  compact_encoding,
+                    Decoded_D3D12_VERSIONED_DEVICE_REMOVED_EXTENDED_DATA* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t                                        bytes_read = 0;
     D3D12_VERSIONED_DEVICE_REMOVED_EXTENDED_DATA* value      = wrapper->decoded_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->Version));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->Version));
 
     switch (value->Version)
     {
         case D3D12_DRED_VERSION_1_0:
             wrapper->Dred_1_0                = DecodeAllocator::Allocate<Decoded_D3D12_DEVICE_REMOVED_EXTENDED_DATA>();
             wrapper->Dred_1_0->decoded_value = &(value->Dred_1_0);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Dred_1_0);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Dred_1_0);
             break;
         case D3D12_DRED_VERSION_1_1:
             wrapper->Dred_1_1                = DecodeAllocator::Allocate<Decoded_D3D12_DEVICE_REMOVED_EXTENDED_DATA1>();
             wrapper->Dred_1_1->decoded_value = &(value->Dred_1_1);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Dred_1_1);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Dred_1_1);
             break;
         case D3D12_DRED_VERSION_1_2:
             wrapper->Dred_1_2                = DecodeAllocator::Allocate<Decoded_D3D12_DEVICE_REMOVED_EXTENDED_DATA2>();
             wrapper->Dred_1_2->decoded_value = &(value->Dred_1_2);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Dred_1_2);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Dred_1_2);
             break;
         case D3D12_DRED_VERSION_1_3:
             wrapper->Dred_1_3                = DecodeAllocator::Allocate<Decoded_D3D12_DEVICE_REMOVED_EXTENDED_DATA3>();
             wrapper->Dred_1_3->decoded_value = &(value->Dred_1_3);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Dred_1_3);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Dred_1_3);
             break;
     }
 
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_RENDER_PASS_BEGINNING_ACCESS* wrapper)
+size_t DecodeStruct(const uint8_t*                              buffer,
+                    size_t                                      buffer_size,
+                    bool                                        compact_encoding,
+                    Decoded_D3D12_RENDER_PASS_BEGINNING_ACCESS* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t                              bytes_read = 0;
     D3D12_RENDER_PASS_BEGINNING_ACCESS* value      = wrapper->decoded_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->Type));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->Type));
 
     switch (value->Type)
     {
         case D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_CLEAR:
             wrapper->Clear = DecodeAllocator::Allocate<Decoded_D3D12_RENDER_PASS_BEGINNING_ACCESS_CLEAR_PARAMETERS>();
             wrapper->Clear->decoded_value = &(value->Clear);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Clear);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Clear);
             break;
         case D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_PRESERVE_LOCAL_RENDER:
         case D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_PRESERVE_LOCAL_SRV:
@@ -619,7 +732,8 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_REN
             wrapper->PreserveLocal =
                 DecodeAllocator::Allocate<Decoded_D3D12_RENDER_PASS_BEGINNING_ACCESS_PRESERVE_LOCAL_PARAMETERS>();
             wrapper->PreserveLocal->decoded_value = &(value->PreserveLocal);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->PreserveLocal);
+            bytes_read += DecodeStruct(
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->PreserveLocal);
             break;
         case D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_DISCARD:
         case D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_PRESERVE:
@@ -634,21 +748,26 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_REN
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_RENDER_PASS_ENDING_ACCESS* wrapper)
+size_t DecodeStruct(const uint8_t*                           buffer,
+                    size_t                                   buffer_size,
+                    bool                                     compact_encoding,
+                    Decoded_D3D12_RENDER_PASS_ENDING_ACCESS* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t                           bytes_read = 0;
     D3D12_RENDER_PASS_ENDING_ACCESS* value      = wrapper->decoded_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->Type));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->Type));
 
     switch (value->Type)
     {
         case D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_RESOLVE:
             wrapper->Resolve = DecodeAllocator::Allocate<Decoded_D3D12_RENDER_PASS_ENDING_ACCESS_RESOLVE_PARAMETERS>();
             wrapper->Resolve->decoded_value = &(value->Resolve);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->Resolve);
+            bytes_read +=
+                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->Resolve);
             break;
         case D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_PRESERVE_LOCAL_RENDER:
         case D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_PRESERVE_LOCAL_SRV:
@@ -656,7 +775,8 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_REN
             wrapper->PreserveLocal =
                 DecodeAllocator::Allocate<Decoded_D3D12_RENDER_PASS_ENDING_ACCESS_PRESERVE_LOCAL_PARAMETERS>();
             wrapper->PreserveLocal->decoded_value = &(value->PreserveLocal);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->PreserveLocal);
+            bytes_read += DecodeStruct(
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->PreserveLocal);
             break;
         case D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_DISCARD:
         case D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_PRESERVE:
@@ -671,27 +791,31 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_REN
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_LARGE_INTEGER* wrapper)
+size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_LARGE_INTEGER* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t         bytes_read = 0;
     LARGE_INTEGER* value      = wrapper->decoded_value;
 
-    bytes_read += ValueDecoder::DecodeInt64Value((buffer + bytes_read), (buffer_size - bytes_read), &(value->QuadPart));
+    bytes_read += ValueDecoder::DecodeInt64Value(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->QuadPart));
 
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_PIPELINE_STATE_STREAM_DESC* wrapper)
+size_t DecodeStruct(const uint8_t*                            buffer,
+                    size_t                                    buffer_size,
+                    bool                                      compact_encoding,
+                    Decoded_D3D12_PIPELINE_STATE_STREAM_DESC* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t                            bytes_read = 0;
     D3D12_PIPELINE_STATE_STREAM_DESC* value      = wrapper->decoded_value;
 
-    bytes_read +=
-        ValueDecoder::DecodeSizeTValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->SizeInBytes));
+    bytes_read += ValueDecoder::DecodeSizeTValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->SizeInBytes));
 
     size_t   offset = 0;
     uint8_t* start  = DecodeAllocator::Allocate<uint8_t>(value->SizeInBytes, false);
@@ -703,7 +827,8 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_PIP
         D3D12_PIPELINE_STATE_SUBOBJECT_TYPE type{};
         auto                                current = start + offset;
 
-        bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &type);
+        bytes_read +=
+            ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &type);
 
         switch (type)
         {
@@ -717,7 +842,7 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_PIP
                 wrapper->root_signature_ptr = &subobject->value;
 
                 bytes_read += ValueDecoder::DecodeHandleIdValue(
-                    (buffer + bytes_read), (buffer_size - bytes_read), &(wrapper->root_signature));
+                    (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(wrapper->root_signature));
 
                 offset += sizeof(*subobject);
                 break;
@@ -728,7 +853,8 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_PIP
                 subobject->type                    = type;
                 wrapper->vs_bytecode.decoded_value = &subobject->value;
 
-                bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), &(wrapper->vs_bytecode));
+                bytes_read += DecodeStruct(
+                    (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(wrapper->vs_bytecode));
 
                 offset += sizeof(*subobject);
                 break;
@@ -739,7 +865,8 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_PIP
                 subobject->type                    = type;
                 wrapper->ps_bytecode.decoded_value = &subobject->value;
 
-                bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), &(wrapper->ps_bytecode));
+                bytes_read += DecodeStruct(
+                    (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(wrapper->ps_bytecode));
 
                 offset += sizeof(*subobject);
                 break;
@@ -750,7 +877,8 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_PIP
                 subobject->type                    = type;
                 wrapper->ds_bytecode.decoded_value = &subobject->value;
 
-                bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), &(wrapper->ds_bytecode));
+                bytes_read += DecodeStruct(
+                    (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(wrapper->ds_bytecode));
 
                 offset += sizeof(*subobject);
                 break;
@@ -761,7 +889,8 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_PIP
                 subobject->type                    = type;
                 wrapper->hs_bytecode.decoded_value = &subobject->value;
 
-                bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), &(wrapper->hs_bytecode));
+                bytes_read += DecodeStruct(
+                    (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(wrapper->hs_bytecode));
 
                 offset += sizeof(*subobject);
                 break;
@@ -772,7 +901,8 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_PIP
                 subobject->type                    = type;
                 wrapper->gs_bytecode.decoded_value = &subobject->value;
 
-                bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), &(wrapper->gs_bytecode));
+                bytes_read += DecodeStruct(
+                    (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(wrapper->gs_bytecode));
 
                 offset += sizeof(*subobject);
                 break;
@@ -783,7 +913,8 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_PIP
                 subobject->type                    = type;
                 wrapper->cs_bytecode.decoded_value = &subobject->value;
 
-                bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), &(wrapper->cs_bytecode));
+                bytes_read += DecodeStruct(
+                    (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(wrapper->cs_bytecode));
 
                 offset += sizeof(*subobject);
                 break;
@@ -794,7 +925,8 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_PIP
                 subobject->type                    = type;
                 wrapper->as_bytecode.decoded_value = &subobject->value;
 
-                bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), &(wrapper->as_bytecode));
+                bytes_read += DecodeStruct(
+                    (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(wrapper->as_bytecode));
 
                 offset += sizeof(*subobject);
                 break;
@@ -805,7 +937,8 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_PIP
                 subobject->type                    = type;
                 wrapper->ms_bytecode.decoded_value = &subobject->value;
 
-                bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), &(wrapper->ms_bytecode));
+                bytes_read += DecodeStruct(
+                    (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(wrapper->ms_bytecode));
 
                 offset += sizeof(*subobject);
                 break;
@@ -816,8 +949,8 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_PIP
                 subobject->type                      = type;
                 wrapper->stream_output.decoded_value = &subobject->value;
 
-                bytes_read +=
-                    DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), &(wrapper->stream_output));
+                bytes_read += DecodeStruct(
+                    (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(wrapper->stream_output));
 
                 offset += sizeof(*subobject);
                 break;
@@ -828,7 +961,8 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_PIP
                 subobject->type              = type;
                 wrapper->blend.decoded_value = &subobject->value;
 
-                bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), &(wrapper->blend));
+                bytes_read += DecodeStruct(
+                    (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(wrapper->blend));
 
                 offset += sizeof(*subobject);
                 break;
@@ -839,7 +973,7 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_PIP
                 subobject->type = type;
 
                 bytes_read += ValueDecoder::DecodeUInt32Value(
-                    (buffer + bytes_read), (buffer_size - bytes_read), &(subobject->value));
+                    (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(subobject->value));
 
                 offset += sizeof(*subobject);
                 break;
@@ -850,7 +984,8 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_PIP
                 subobject->type                   = type;
                 wrapper->rasterizer.decoded_value = &subobject->value;
 
-                bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), &(wrapper->rasterizer));
+                bytes_read += DecodeStruct(
+                    (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(wrapper->rasterizer));
 
                 offset += sizeof(*subobject);
                 break;
@@ -861,8 +996,8 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_PIP
                 subobject->type                      = type;
                 wrapper->depth_stencil.decoded_value = &subobject->value;
 
-                bytes_read +=
-                    DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), &(wrapper->depth_stencil));
+                bytes_read += DecodeStruct(
+                    (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(wrapper->depth_stencil));
 
                 offset += sizeof(*subobject);
                 break;
@@ -873,7 +1008,8 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_PIP
                 subobject->type                     = type;
                 wrapper->input_layout.decoded_value = &subobject->value;
 
-                bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), &(wrapper->input_layout));
+                bytes_read += DecodeStruct(
+                    (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(wrapper->input_layout));
 
                 offset += sizeof(*subobject);
                 break;
@@ -884,7 +1020,7 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_PIP
                 subobject->type = type;
 
                 bytes_read += ValueDecoder::DecodeEnumValue(
-                    (buffer + bytes_read), (buffer_size - bytes_read), &(subobject->value));
+                    (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(subobject->value));
 
                 offset += sizeof(*subobject);
                 break;
@@ -895,7 +1031,7 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_PIP
                 subobject->type = type;
 
                 bytes_read += ValueDecoder::DecodeEnumValue(
-                    (buffer + bytes_read), (buffer_size - bytes_read), &(subobject->value));
+                    (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(subobject->value));
 
                 offset += sizeof(*subobject);
                 break;
@@ -906,8 +1042,10 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_PIP
                 subobject->type = type;
                 wrapper->render_target_formats.decoded_value = &subobject->value;
 
-                bytes_read +=
-                    DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), &(wrapper->render_target_formats));
+                bytes_read += DecodeStruct((buffer + bytes_read),
+                                           (buffer_size - bytes_read),
+                                           compact_encoding,
+                                           &(wrapper->render_target_formats));
 
                 offset += sizeof(*subobject);
                 break;
@@ -918,7 +1056,7 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_PIP
                 subobject->type = type;
 
                 bytes_read += ValueDecoder::DecodeEnumValue(
-                    (buffer + bytes_read), (buffer_size - bytes_read), &(subobject->value));
+                    (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(subobject->value));
 
                 offset += sizeof(*subobject);
                 break;
@@ -929,7 +1067,8 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_PIP
                 subobject->type                    = type;
                 wrapper->sample_desc.decoded_value = &subobject->value;
 
-                bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), &(wrapper->sample_desc));
+                bytes_read += DecodeStruct(
+                    (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(wrapper->sample_desc));
 
                 offset += sizeof(*subobject);
                 break;
@@ -940,7 +1079,7 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_PIP
                 subobject->type = type;
 
                 bytes_read += ValueDecoder::DecodeUInt32Value(
-                    (buffer + bytes_read), (buffer_size - bytes_read), &(subobject->value));
+                    (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(subobject->value));
 
                 offset += sizeof(*subobject);
                 break;
@@ -951,7 +1090,8 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_PIP
                 subobject->type                   = type;
                 wrapper->cached_pso.decoded_value = &subobject->value;
 
-                bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), &(wrapper->cached_pso));
+                bytes_read += DecodeStruct(
+                    (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(wrapper->cached_pso));
 
                 offset += sizeof(*subobject);
                 break;
@@ -962,7 +1102,7 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_PIP
                 subobject->type = type;
 
                 bytes_read += ValueDecoder::DecodeEnumValue(
-                    (buffer + bytes_read), (buffer_size - bytes_read), &(subobject->value));
+                    (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(subobject->value));
 
                 offset += sizeof(*subobject);
                 break;
@@ -973,8 +1113,8 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_PIP
                 subobject->type                       = type;
                 wrapper->depth_stencil1.decoded_value = &subobject->value;
 
-                bytes_read +=
-                    DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), &(wrapper->depth_stencil1));
+                bytes_read += DecodeStruct(
+                    (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(wrapper->depth_stencil1));
 
                 offset += sizeof(*subobject);
                 break;
@@ -985,8 +1125,8 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_PIP
                 subobject->type = type;
                 wrapper->view_instancing.decoded_value = &subobject->value;
 
-                bytes_read +=
-                    DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), &(wrapper->view_instancing));
+                bytes_read += DecodeStruct(
+                    (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(wrapper->view_instancing));
 
                 offset += sizeof(*subobject);
                 break;
@@ -1017,36 +1157,40 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_PIP
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_STATE_OBJECT_DESC* wrapper)
+size_t
+DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_D3D12_STATE_OBJECT_DESC* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t                   bytes_read = 0;
     D3D12_STATE_OBJECT_DESC* value      = wrapper->decoded_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->Type));
-    bytes_read +=
-        ValueDecoder::DecodeUInt32Value((buffer + bytes_read), (buffer_size - bytes_read), &(value->NumSubobjects));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->Type));
+    bytes_read += ValueDecoder::DecodeUInt32Value(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->NumSubobjects));
 
     // Decode the D3D12_STATE_SUBOBJECT array stride value, which is added by the capture encoder.
-    bytes_read +=
-        ValueDecoder::DecodeSizeTValue((buffer + bytes_read), (buffer_size - bytes_read), &(wrapper->subobject_stride));
+    bytes_read += ValueDecoder::DecodeSizeTValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(wrapper->subobject_stride));
 
     wrapper->pSubobjects = DecodeAllocator::Allocate<StructPointerDecoder<Decoded_D3D12_STATE_SUBOBJECT>>();
-    bytes_read += wrapper->pSubobjects->Decode((buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += wrapper->pSubobjects->Decode((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding);
     value->pSubobjects = wrapper->pSubobjects->GetPointer();
 
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_STATE_SUBOBJECT* wrapper)
+size_t
+DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_D3D12_STATE_SUBOBJECT* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t                 bytes_read = 0;
     D3D12_STATE_SUBOBJECT* value      = wrapper->decoded_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->Type));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->Type));
     auto buffer2      = buffer + bytes_read;
     auto buffer_size2 = buffer_size - bytes_read;
     switch (value->Type)
@@ -1054,72 +1198,73 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_STA
         case D3D12_STATE_SUBOBJECT_TYPE_STATE_OBJECT_CONFIG:
             wrapper->state_object_config =
                 +DecodeAllocator::Allocate<StructPointerDecoder<Decoded_D3D12_STATE_OBJECT_CONFIG>>();
-            bytes_read += wrapper->state_object_config->Decode(buffer2, buffer_size2);
+            bytes_read += wrapper->state_object_config->Decode(buffer2, buffer_size2, compact_encoding);
             value->pDesc = wrapper->state_object_config->GetPointer();
             break;
         case D3D12_STATE_SUBOBJECT_TYPE_GLOBAL_ROOT_SIGNATURE:
             wrapper->global_root_signature =
                 DecodeAllocator::Allocate<StructPointerDecoder<Decoded_D3D12_GLOBAL_ROOT_SIGNATURE>>();
-            bytes_read += wrapper->global_root_signature->Decode(buffer2, buffer_size2);
+            bytes_read += wrapper->global_root_signature->Decode(buffer2, buffer_size2, compact_encoding);
             value->pDesc = wrapper->global_root_signature->GetPointer();
             break;
         case D3D12_STATE_SUBOBJECT_TYPE_LOCAL_ROOT_SIGNATURE:
             wrapper->local_root_signature =
                 DecodeAllocator::Allocate<StructPointerDecoder<Decoded_D3D12_LOCAL_ROOT_SIGNATURE>>();
-            bytes_read += wrapper->local_root_signature->Decode(buffer2, buffer_size2);
+            bytes_read += wrapper->local_root_signature->Decode(buffer2, buffer_size2, compact_encoding);
             value->pDesc = wrapper->local_root_signature->GetPointer();
             break;
         case D3D12_STATE_SUBOBJECT_TYPE_NODE_MASK:
             wrapper->node_mask = DecodeAllocator::Allocate<StructPointerDecoder<Decoded_D3D12_NODE_MASK>>();
-            bytes_read += wrapper->node_mask->Decode(buffer2, buffer_size2);
+            bytes_read += wrapper->node_mask->Decode(buffer2, buffer_size2, compact_encoding);
             value->pDesc = wrapper->node_mask->GetPointer();
             break;
         case D3D12_STATE_SUBOBJECT_TYPE_DXIL_LIBRARY:
             wrapper->dxil_library_desc =
                 DecodeAllocator::Allocate<StructPointerDecoder<Decoded_D3D12_DXIL_LIBRARY_DESC>>();
-            bytes_read += wrapper->dxil_library_desc->Decode(buffer2, buffer_size2);
+            bytes_read += wrapper->dxil_library_desc->Decode(buffer2, buffer_size2, compact_encoding);
             value->pDesc = wrapper->dxil_library_desc->GetPointer();
             break;
         case D3D12_STATE_SUBOBJECT_TYPE_EXISTING_COLLECTION:
             wrapper->existing_collection_desc =
                 DecodeAllocator::Allocate<StructPointerDecoder<Decoded_D3D12_EXISTING_COLLECTION_DESC>>();
-            bytes_read += wrapper->existing_collection_desc->Decode(buffer2, buffer_size2);
+            bytes_read += wrapper->existing_collection_desc->Decode(buffer2, buffer_size2, compact_encoding);
             value->pDesc = wrapper->existing_collection_desc->GetPointer();
             break;
         case D3D12_STATE_SUBOBJECT_TYPE_SUBOBJECT_TO_EXPORTS_ASSOCIATION:
             wrapper->subobject_to_exports_association =
                 DecodeAllocator::Allocate<StructPointerDecoder<Decoded_D3D12_SUBOBJECT_TO_EXPORTS_ASSOCIATION>>();
-            bytes_read += wrapper->subobject_to_exports_association->Decode(buffer2, buffer_size2);
+            bytes_read += wrapper->subobject_to_exports_association->Decode(buffer2, buffer_size2, compact_encoding);
             value->pDesc = wrapper->subobject_to_exports_association->GetPointer();
             break;
             break;
         case D3D12_STATE_SUBOBJECT_TYPE_DXIL_SUBOBJECT_TO_EXPORTS_ASSOCIATION:
             wrapper->dxil_subobject_to_exports_association =
                 DecodeAllocator::Allocate<StructPointerDecoder<Decoded_D3D12_DXIL_SUBOBJECT_TO_EXPORTS_ASSOCIATION>>();
-            bytes_read += wrapper->dxil_subobject_to_exports_association->Decode(buffer2, buffer_size2);
+            bytes_read +=
+                wrapper->dxil_subobject_to_exports_association->Decode(buffer2, buffer_size2, compact_encoding);
             value->pDesc = wrapper->dxil_subobject_to_exports_association->GetPointer();
             break;
         case D3D12_STATE_SUBOBJECT_TYPE_RAYTRACING_SHADER_CONFIG:
             wrapper->raytracing_shader_config =
                 DecodeAllocator::Allocate<StructPointerDecoder<Decoded_D3D12_RAYTRACING_SHADER_CONFIG>>();
-            bytes_read += wrapper->raytracing_shader_config->Decode(buffer2, buffer_size2);
+            bytes_read += wrapper->raytracing_shader_config->Decode(buffer2, buffer_size2, compact_encoding);
             value->pDesc = wrapper->raytracing_shader_config->GetPointer();
             break;
         case D3D12_STATE_SUBOBJECT_TYPE_RAYTRACING_PIPELINE_CONFIG:
             wrapper->raytracing_pipeline_config =
                 DecodeAllocator::Allocate<StructPointerDecoder<Decoded_D3D12_RAYTRACING_PIPELINE_CONFIG>>();
-            bytes_read += wrapper->raytracing_pipeline_config->Decode(buffer2, buffer_size2);
+            bytes_read += wrapper->raytracing_pipeline_config->Decode(buffer2, buffer_size2, compact_encoding);
             value->pDesc = wrapper->raytracing_pipeline_config->GetPointer();
             break;
         case D3D12_STATE_SUBOBJECT_TYPE_HIT_GROUP:
             wrapper->hit_group_desc = DecodeAllocator::Allocate<StructPointerDecoder<Decoded_D3D12_HIT_GROUP_DESC>>();
-            bytes_read += wrapper->hit_group_desc->Decode(buffer2, buffer_size2);
+            bytes_read += wrapper->hit_group_desc->Decode(buffer2, buffer_size2, compact_encoding);
             value->pDesc = wrapper->hit_group_desc->GetPointer();
             break;
         case D3D12_STATE_SUBOBJECT_TYPE_RAYTRACING_PIPELINE_CONFIG1:
             wrapper->raytracing_pipeline_config1 =
                 DecodeAllocator::Allocate<StructPointerDecoder<Decoded_D3D12_RAYTRACING_PIPELINE_CONFIG1>>();
-            bytes_read += wrapper->raytracing_pipeline_config1->Decode(buffer2, buffer_size2);
+            bytes_read += wrapper->raytracing_pipeline_config1->Decode(buffer2, buffer_size2, compact_encoding);
             value->pDesc = wrapper->raytracing_pipeline_config1->GetPointer();
             break;
         case D3D12_STATE_SUBOBJECT_TYPE_MAX_VALID:
@@ -1129,7 +1274,10 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_STA
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_SUBOBJECT_TO_EXPORTS_ASSOCIATION* wrapper)
+size_t DecodeStruct(const uint8_t*                                  buffer,
+                    size_t                                          buffer_size,
+                    bool                                            compact_encoding,
+                    Decoded_D3D12_SUBOBJECT_TO_EXPORTS_ASSOCIATION* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
@@ -1137,43 +1285,49 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_SUB
     D3D12_SUBOBJECT_TO_EXPORTS_ASSOCIATION* value      = wrapper->decoded_value;
 
     wrapper->pSubobjectToAssociate = DecodeAllocator::Allocate<StructPointerDecoder<Decoded_D3D12_STATE_SUBOBJECT>>();
-    bytes_read += wrapper->pSubobjectToAssociate->Decode((buffer + bytes_read), (buffer_size - bytes_read));
-    value->pSubobjectToAssociate = wrapper->pSubobjectToAssociate->GetPointer();
     bytes_read +=
-        ValueDecoder::DecodeUInt32Value((buffer + bytes_read), (buffer_size - bytes_read), &(value->NumExports));
-    bytes_read += wrapper->pExports.Decode((buffer + bytes_read), (buffer_size - bytes_read));
+        wrapper->pSubobjectToAssociate->Decode((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding);
+    value->pSubobjectToAssociate = wrapper->pSubobjectToAssociate->GetPointer();
+    bytes_read += ValueDecoder::DecodeUInt32Value(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->NumExports));
+    bytes_read += wrapper->pExports.Decode((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding);
     value->pExports = const_cast<LPCWSTR*>(wrapper->pExports.GetPointer());
 
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_BARRIER_GROUP* wrapper)
+size_t
+DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_D3D12_BARRIER_GROUP* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t               bytes_read = 0;
     D3D12_BARRIER_GROUP* value      = wrapper->decoded_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->Type));
-    bytes_read +=
-        ValueDecoder::DecodeUInt32Value((buffer + bytes_read), (buffer_size - bytes_read), &(value->NumBarriers));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->Type));
+    bytes_read += ValueDecoder::DecodeUInt32Value(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->NumBarriers));
 
     switch (value->Type)
     {
         case D3D12_BARRIER_TYPE_GLOBAL:
             wrapper->global_barriers = DecodeAllocator::Allocate<StructPointerDecoder<Decoded_D3D12_GLOBAL_BARRIER>>();
-            bytes_read += wrapper->global_barriers->Decode((buffer + bytes_read), (buffer_size - bytes_read));
+            bytes_read +=
+                wrapper->global_barriers->Decode((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding);
             value->pGlobalBarriers = wrapper->global_barriers->GetPointer();
             break;
         case D3D12_BARRIER_TYPE_TEXTURE:
             wrapper->texture_barriers =
                 DecodeAllocator::Allocate<StructPointerDecoder<Decoded_D3D12_TEXTURE_BARRIER>>();
-            bytes_read += wrapper->texture_barriers->Decode((buffer + bytes_read), (buffer_size - bytes_read));
+            bytes_read +=
+                wrapper->texture_barriers->Decode((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding);
             value->pTextureBarriers = wrapper->texture_barriers->GetPointer();
             break;
         case D3D12_BARRIER_TYPE_BUFFER:
             wrapper->buffer_barriers = DecodeAllocator::Allocate<StructPointerDecoder<Decoded_D3D12_BUFFER_BARRIER>>();
-            bytes_read += wrapper->buffer_barriers->Decode((buffer + bytes_read), (buffer_size - bytes_read));
+            bytes_read +=
+                wrapper->buffer_barriers->Decode((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding);
             value->pBufferBarriers = wrapper->buffer_barriers->GetPointer();
             break;
     }
@@ -1181,28 +1335,37 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_BAR
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_SAMPLER_DESC2* wrapper)
+size_t
+DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_D3D12_SAMPLER_DESC2* wrapper)
 {
     size_t               bytes_read = 0;
     D3D12_SAMPLER_DESC2* value      = wrapper->decoded_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->Filter));
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->AddressU));
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->AddressV));
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->AddressW));
-    bytes_read +=
-        ValueDecoder::DecodeFloatValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->MipLODBias));
-    bytes_read +=
-        ValueDecoder::DecodeUInt32Value((buffer + bytes_read), (buffer_size - bytes_read), &(value->MaxAnisotropy));
-    bytes_read +=
-        ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->ComparisonFunc));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->Filter));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->AddressU));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->AddressV));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->AddressW));
+    bytes_read += ValueDecoder::DecodeFloatValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->MipLODBias));
+    bytes_read += ValueDecoder::DecodeUInt32Value(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->MaxAnisotropy));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->ComparisonFunc));
 
     wrapper->FloatBorderColor.SetExternalMemory(value->FloatBorderColor, 4);
-    bytes_read += wrapper->FloatBorderColor.DecodeFloat((buffer + bytes_read), (buffer_size - bytes_read));
-
-    bytes_read += ValueDecoder::DecodeFloatValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->MinLOD));
-    bytes_read += ValueDecoder::DecodeFloatValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->MaxLOD));
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->Flags));
+    bytes_read +=
+        wrapper->FloatBorderColor.DecodeFloat((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding);
+
+    bytes_read += ValueDecoder::DecodeFloatValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->MinLOD));
+    bytes_read += ValueDecoder::DecodeFloatValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->MaxLOD));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->Flags));
 
     return bytes_read;
 }
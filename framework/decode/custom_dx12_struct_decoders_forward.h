@@ -32,7 +32,10 @@ GFXRECON_BEGIN_NAMESPACE(decode)
 // Descriptor handles.
 struct Decoded_D3D12_CPU_DESCRIPTOR_HANDLE;
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_CPU_DESCRIPTOR_HANDLE* wrapper);
+size_t DecodeStruct(const uint8_t*                       buffer,
+                    size_t                               buffer_size,
+                    bool                                 compact_encoding,
+                    Decoded_D3D12_CPU_DESCRIPTOR_HANDLE* wrapper);
 
 // Unions.
 struct Decoded_D3D12_CLEAR_VALUE;
@@ -52,30 +55,67 @@ struct Decoded_D3D12_VERSIONED_DEVICE_REMOVED_EXTENDED_DATA;
 struct Decoded_D3D12_RENDER_PASS_BEGINNING_ACCESS;
 struct Decoded_D3D12_RENDER_PASS_ENDING_ACCESS;
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_CLEAR_VALUE* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_RESOURCE_BARRIER* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_TEXTURE_COPY_LOCATION* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_SHADER_RESOURCE_VIEW_DESC* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_UNORDERED_ACCESS_VIEW_DESC* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_RENDER_TARGET_VIEW_DESC* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_DEPTH_STENCIL_VIEW_DESC* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_ROOT_PARAMETER* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_ROOT_PARAMETER1* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_VERSIONED_ROOT_SIGNATURE_DESC* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_INDIRECT_ARGUMENT_DESC* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_RAYTRACING_GEOMETRY_DESC* wrapper);
+size_t
+DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_D3D12_CLEAR_VALUE* wrapper);
+size_t
+DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_D3D12_RESOURCE_BARRIER* wrapper);
+size_t DecodeStruct(const uint8_t*                       buffer,
+                    size_t                               buffer_size,
+                    bool                                 compact_encoding,
+                    Decoded_D3D12_TEXTURE_COPY_LOCATION* wrapper);
+size_t DecodeStruct(const uint8_t*                           buffer,
+                    size_t                                   buffer_size,
+                    bool                                     compact_encoding,
+                    Decoded_D3D12_SHADER_RESOURCE_VIEW_DESC* wrapper);
+size_t DecodeStruct(const uint8_t*                            buffer,
+                    size_t                                    buffer_size,
+                    bool                                      compact_encoding,
+                    Decoded_D3D12_UNORDERED_ACCESS_VIEW_DESC* wrapper);
+size_t DecodeStruct(const uint8_t*                         buffer,
+                    size_t                                 buffer_size,
+                    bool                                   compact_encoding,
+                    Decoded_D3D12_RENDER_TARGET_VIEW_DESC* wrapper);
+size_t DecodeStruct(const uint8_t*                         buffer,
+                    size_t                                 buffer_size,
+                    bool                                   compact_encoding,
+                    Decoded_D3D12_DEPTH_STENCIL_VIEW_DESC* wrapper);
+size_t
+DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_D3D12_ROOT_PARAMETER* wrapper);
+size_t
+DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_D3D12_ROOT_PARAMETER1* wrapper);
+size_t DecodeStruct(const uint8_t*                               buffer,
+                    size_t                                       buffer_size,
+                    bool                                         compact_encoding,
+                    Decoded_D3D12_VERSIONED_ROOT_SIGNATURE_DESC* wrapper);
+size_t DecodeStruct(const uint8_t*                        buffer,
+                    size_t                                buffer_size,
+                    bool                                  compact_encoding,
+                    Decoded_D3D12_INDIRECT_ARGUMENT_DESC* wrapper);
+size_t DecodeStruct(const uint8_t*                          buffer,
+                    size_t                                  buffer_size,
+                    bool                                    compact_encoding,
+                    Decoded_D3D12_RAYTRACING_GEOMETRY_DESC* wrapper);
 size_t DecodeStruct(const uint8_t*                                                buffer,
                     size_t                                                        buffer_size,
+                    bool                                                          compact_encoding,
                     Decoded_D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS* wrapper);
-size_t
-       DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_VERSIONED_DEVICE_REMOVED_EXTENDED_DATA* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_RENDER_PASS_BEGINNING_ACCESS* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_RENDER_PASS_ENDING_ACCESS* wrapper);
+size_t DecodeStruct(const uint8_t*                                        buffer,
+                    size_t                                                buffer_size,
+                    bool                                                  compact_encoding,
+                    Decoded_D3D12_VERSIONED_DEVICE_REMOVED_EXTENDED_DATA* wrapper);
+size_t DecodeStruct(const uint8_t*                              buffer,
+                    size_t                                      buffer_size,
+                    bool                                        compact_encoding,
+                    Decoded_D3D12_RENDER_PASS_BEGINNING_ACCESS* wrapper);
+size_t DecodeStruct(const uint8_t*                           buffer,
+                    size_t                                   buffer_size,
+                    bool                                     compact_encoding,
+                    Decoded_D3D12_RENDER_PASS_ENDING_ACCESS* wrapper);
 
 // Platform types.
 struct Decoded_LARGE_INTEGER;
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_LARGE_INTEGER* wrapper);
+size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_LARGE_INTEGER* wrapper);
 
 // Types requiring special processing.
 struct Decoded_D3D12_PIPELINE_STATE_STREAM_DESC;
@@ -85,12 +125,24 @@ struct Decoded_D3D12_SUBOBJECT_TO_EXPORTS_ASSOCIATION;
 struct Decoded_D3D12_BARRIER_GROUP;
 struct Decoded_D3D12_SAMPLER_DESC2;
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_PIPELINE_STATE_STREAM_DESC* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_STATE_OBJECT_DESC* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_STATE_SUBOBJECT* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_SUBOBJECT_TO_EXPORTS_ASSOCIATION* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_BARRIER_GROUP* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_D3D12_SAMPLER_DESC2* wrapper);
+size_t DecodeStruct(const uint8_t*                            buffer,
+                    size_t                                    buffer_size,
+                    bool                                      compact_encoding,
+                    Decoded_D3D12_PIPELINE_STATE_STREAM_DESC* wrapper);
+size_t DecodeStruct(const uint8_t*                   buffer,
+                    size_t                           buffer_size,
+                    bool                             compact_encoding,
+                    Decoded_D3D12_STATE_OBJECT_DESC* wrapper);
+size_t
+DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_D3D12_STATE_SUBOBJECT* wrapper);
+size_t DecodeStruct(const uint8_t*                                  buffer,
+                    size_t                                          buffer_size,
+                    bool                                            compact_encoding,
+                    Decoded_D3D12_SUBOBJECT_TO_EXPORTS_ASSOCIATION* wrapper);
+size_t
+DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_D3D12_BARRIER_GROUP* wrapper);
+size_t
+DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_D3D12_SAMPLER_DESC2* wrapper);
 
 GFXRECON_END_NAMESPACE(decode)
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -34,9 +34,10 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
-size_t DecodePNextStruct(const uint8_t* buffer, size_t buffer_size, PNextNode** pNext);
+size_t DecodePNextStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, PNextNode** pNext);
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkClearColorValue* wrapper)
+size_t
+DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_VkClearColorValue* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
@@ -44,12 +45,12 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkClearCo
     VkClearColorValue* value      = wrapper->decoded_value;
 
     wrapper->uint32.SetExternalMemory(value->uint32, 4);
-    bytes_read += wrapper->uint32.DecodeUInt32((buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += wrapper->uint32.DecodeUInt32((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding);
 
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkClearValue* wrapper)
+size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_VkClearValue* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
@@ -58,87 +59,107 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkClearVa
 
     wrapper->color                = DecodeAllocator::Allocate<Decoded_VkClearColorValue>();
     wrapper->color->decoded_value = &(value->color);
-    bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->color);
+    bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->color);
 
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkPipelineExecutableStatisticValueKHR* wrapper)
+size_t DecodeStruct(const uint8_t*                                 buffer,
+                    size_t                                         buffer_size,
+                    bool                                           compact_encoding,
+                    Decoded_VkPipelineExecutableStatisticValueKHR* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t                                 bytes_read = 0;
     VkPipelineExecutableStatisticValueKHR* value      = wrapper->decoded_value;
 
-    bytes_read += ValueDecoder::DecodeUInt64Value((buffer + bytes_read), (buffer_size - bytes_read), &(value->u64));
+    bytes_read += ValueDecoder::DecodeUInt64Value(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->u64));
 
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkDeviceOrHostAddressKHR* wrapper)
+size_t DecodeStruct(const uint8_t*                    buffer,
+                    size_t                            buffer_size,
+                    bool                              compact_encoding,
+                    Decoded_VkDeviceOrHostAddressKHR* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t                    bytes_read = 0;
     VkDeviceOrHostAddressKHR* value      = wrapper->decoded_value;
 
-    bytes_read +=
-        ValueDecoder::DecodeUInt64Value((buffer + bytes_read), (buffer_size - bytes_read), &(value->deviceAddress));
+    bytes_read += ValueDecoder::DecodeUInt64Value(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->deviceAddress));
     wrapper->hostAddress = value->deviceAddress;
 
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkDeviceOrHostAddressConstKHR* wrapper)
+size_t DecodeStruct(const uint8_t*                         buffer,
+                    size_t                                 buffer_size,
+                    bool                                   compact_encoding,
+                    Decoded_VkDeviceOrHostAddressConstKHR* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t                         bytes_read = 0;
     VkDeviceOrHostAddressConstKHR* value      = wrapper->decoded_value;
 
-    bytes_read +=
-        ValueDecoder::DecodeUInt64Value((buffer + bytes_read), (buffer_size - bytes_read), &(value->deviceAddress));
+    bytes_read += ValueDecoder::DecodeUInt64Value(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->deviceAddress));
     wrapper->hostAddress = value->deviceAddress;
 
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkAccelerationStructureGeometryDataKHR* wrapper)
+size_t DecodeStruct(const uint8_t*                                  buffer,
+                    size_t                                          buffer_size,
+                    bool                                            compact_encoding,
+                    Decoded_VkAccelerationStructureGeometryDataKHR* wrapper)
 {
     // TODO
     GFXRECON_LOG_ERROR("VkAccelerationStructureGeometryDataKHR is not supported");
     return 0;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkAccelerationStructureMotionInstanceNV* wrapper)
+size_t DecodeStruct(const uint8_t*                                   buffer,
+                    size_t                                           buffer_size,
+                    bool                                             compact_encoding,
+                    Decoded_VkAccelerationStructureMotionInstanceNV* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t                                   bytes_read = 0;
     VkAccelerationStructureMotionInstanceNV* value      = wrapper->decoded_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->type));
-    bytes_read += ValueDecoder::DecodeFlagsValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->flags));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->type));
+    bytes_read += ValueDecoder::DecodeFlagsValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->flags));
 
     switch (value->type)
     {
         case VK_ACCELERATION_STRUCTURE_MOTION_INSTANCE_TYPE_STATIC_NV:
             wrapper->staticInstance = DecodeAllocator::Allocate<Decoded_VkAccelerationStructureInstanceKHR>();
             wrapper->staticInstance->decoded_value = &value->data.staticInstance;
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->staticInstance);
+            bytes_read += DecodeStruct(
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->staticInstance);
             break;
         case VK_ACCELERATION_STRUCTURE_MOTION_INSTANCE_TYPE_MATRIX_MOTION_NV:
             wrapper->matrixMotionInstance =
                 DecodeAllocator::Allocate<Decoded_VkAccelerationStructureMatrixMotionInstanceNV>();
             wrapper->matrixMotionInstance->decoded_value = &value->data.matrixMotionInstance;
-            bytes_read +=
-                DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->matrixMotionInstance);
+            bytes_read += DecodeStruct(
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->matrixMotionInstance);
             break;
         case VK_ACCELERATION_STRUCTURE_MOTION_INSTANCE_TYPE_SRT_MOTION_NV:
             wrapper->srtMotionInstance =
                 DecodeAllocator::Allocate<Decoded_VkAccelerationStructureSRTMotionInstanceNV>();
             wrapper->srtMotionInstance->decoded_value = &value->data.srtMotionInstance;
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->srtMotionInstance);
+            bytes_read += DecodeStruct(
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->srtMotionInstance);
             break;
         default:
             break;
@@ -146,101 +167,113 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkAcceler
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkDescriptorImageInfo* wrapper)
+size_t
+DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_VkDescriptorImageInfo* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t                 bytes_read = 0;
     VkDescriptorImageInfo* value      = wrapper->decoded_value;
 
-    bytes_read +=
-        ValueDecoder::DecodeHandleIdValue((buffer + bytes_read), (buffer_size - bytes_read), &(wrapper->sampler));
+    bytes_read += ValueDecoder::DecodeHandleIdValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(wrapper->sampler));
     value->sampler = VK_NULL_HANDLE;
-    bytes_read +=
-        ValueDecoder::DecodeHandleIdValue((buffer + bytes_read), (buffer_size - bytes_read), &(wrapper->imageView));
+    bytes_read += ValueDecoder::DecodeHandleIdValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(wrapper->imageView));
     value->imageView = VK_NULL_HANDLE;
-    bytes_read +=
-        ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->imageLayout));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->imageLayout));
 
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkWriteDescriptorSet* wrapper)
+size_t
+DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_VkWriteDescriptorSet* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t                bytes_read = 0;
     VkWriteDescriptorSet* value      = wrapper->decoded_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->sType));
-    bytes_read += DecodePNextStruct((buffer + bytes_read), (buffer_size - bytes_read), &(wrapper->pNext));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->sType));
+    bytes_read +=
+        DecodePNextStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(wrapper->pNext));
     value->pNext = wrapper->pNext ? wrapper->pNext->GetPointer() : nullptr;
 
-    bytes_read +=
-        ValueDecoder::DecodeHandleIdValue((buffer + bytes_read), (buffer_size - bytes_read), &(wrapper->dstSet));
+    bytes_read += ValueDecoder::DecodeHandleIdValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(wrapper->dstSet));
     value->dstSet = VK_NULL_HANDLE;
-    bytes_read +=
-        ValueDecoder::DecodeUInt32Value((buffer + bytes_read), (buffer_size - bytes_read), &(value->dstBinding));
-    bytes_read +=
-        ValueDecoder::DecodeUInt32Value((buffer + bytes_read), (buffer_size - bytes_read), &(value->dstArrayElement));
-    bytes_read +=
-        ValueDecoder::DecodeUInt32Value((buffer + bytes_read), (buffer_size - bytes_read), &(value->descriptorCount));
-    bytes_read +=
-        ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->descriptorType));
+    bytes_read += ValueDecoder::DecodeUInt32Value(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->dstBinding));
+    bytes_read += ValueDecoder::DecodeUInt32Value(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->dstArrayElement));
+    bytes_read += ValueDecoder::DecodeUInt32Value(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->descriptorCount));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->descriptorType));
 
     wrapper->pImageInfo = DecodeAllocator::Allocate<StructPointerDecoder<Decoded_VkDescriptorImageInfo>>();
-    bytes_read += wrapper->pImageInfo->Decode((buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += wrapper->pImageInfo->Decode((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding);
     value->pImageInfo = wrapper->pImageInfo->GetPointer();
 
     wrapper->pBufferInfo = DecodeAllocator::Allocate<StructPointerDecoder<Decoded_VkDescriptorBufferInfo>>();
-    bytes_read += wrapper->pBufferInfo->Decode((buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += wrapper->pBufferInfo->Decode((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding);
     value->pBufferInfo = wrapper->pBufferInfo->GetPointer();
 
-    bytes_read += wrapper->pTexelBufferView.Decode((buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += wrapper->pTexelBufferView.Decode((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding);
     value->pTexelBufferView = wrapper->pTexelBufferView.GetHandlePointer();
 
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkPerformanceValueINTEL* wrapper)
+size_t
+DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_VkPerformanceValueINTEL* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t                   bytes_read = 0;
     VkPerformanceValueINTEL* value      = wrapper->decoded_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->type));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->type));
 
     wrapper->data                = DecodeAllocator::Allocate<Decoded_VkPerformanceValueDataINTEL>();
     wrapper->data->decoded_value = &(value->data);
 
     if (value->type == VK_PERFORMANCE_VALUE_TYPE_STRING_INTEL)
     {
-        bytes_read += wrapper->data->valueString.Decode((buffer + bytes_read), (buffer_size - bytes_read));
+        bytes_read +=
+            wrapper->data->valueString.Decode((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding);
         value->data.valueString = wrapper->data->valueString.GetPointer();
     }
     else
     {
-        bytes_read +=
-            ValueDecoder::DecodeUInt64Value((buffer + bytes_read), (buffer_size - bytes_read), &(value->data.value64));
+        bytes_read += ValueDecoder::DecodeUInt64Value(
+            (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->data.value64));
     }
 
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkAccelerationStructureGeometryKHR* wrapper)
+size_t DecodeStruct(const uint8_t*                              buffer,
+                    size_t                                      buffer_size,
+                    bool                                        compact_encoding,
+                    Decoded_VkAccelerationStructureGeometryKHR* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t                              bytes_read = 0;
     VkAccelerationStructureGeometryKHR* value      = wrapper->decoded_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->sType));
-    bytes_read += DecodePNextStruct((buffer + bytes_read), (buffer_size - bytes_read), &(wrapper->pNext));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->sType));
+    bytes_read +=
+        DecodePNextStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(wrapper->pNext));
     value->pNext = wrapper->pNext ? wrapper->pNext->GetPointer() : nullptr;
 
-    bytes_read +=
-        ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->geometryType));
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->geometryType));
 
     wrapper->geometry = DecodeAllocator::Allocate<Decoded_VkAccelerationStructureGeometryDataKHR>();
 
@@ -250,42 +283,52 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkAcceler
             wrapper->geometry->triangles =
                 DecodeAllocator::Allocate<Decoded_VkAccelerationStructureGeometryTrianglesDataKHR>();
             wrapper->geometry->triangles->decoded_value = &(value->geometry.triangles);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->geometry->triangles);
+            bytes_read += DecodeStruct(
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->geometry->triangles);
             break;
         case VK_GEOMETRY_TYPE_AABBS_KHR:
             wrapper->geometry->aabbs = DecodeAllocator::Allocate<Decoded_VkAccelerationStructureGeometryAabbsDataKHR>();
             wrapper->geometry->aabbs->decoded_value = &(value->geometry.aabbs);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->geometry->aabbs);
+            bytes_read += DecodeStruct(
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->geometry->aabbs);
             break;
         case VK_GEOMETRY_TYPE_INSTANCES_KHR:
             wrapper->geometry->instances =
                 DecodeAllocator::Allocate<Decoded_VkAccelerationStructureGeometryInstancesDataKHR>();
             wrapper->geometry->instances->decoded_value = &(value->geometry.instances);
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->geometry->instances);
+            bytes_read += DecodeStruct(
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->geometry->instances);
             break;
         default:
             break;
     }
 
-    bytes_read += ValueDecoder::DecodeFlagsValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->flags));
+    bytes_read += ValueDecoder::DecodeFlagsValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->flags));
 
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkPushDescriptorSetWithTemplateInfoKHR* wrapper)
+size_t DecodeStruct(const uint8_t*                                  buffer,
+                    size_t                                          buffer_size,
+                    bool                                            compact_encoding,
+                    Decoded_VkPushDescriptorSetWithTemplateInfoKHR* wrapper)
 {
     GFXRECON_ASSERT((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t                                  bytes_read = 0;
     VkPushDescriptorSetWithTemplateInfoKHR* value      = wrapper->decoded_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &value->sType);
-    bytes_read += DecodePNextStruct((buffer + bytes_read), (buffer_size - bytes_read), &wrapper->pNext);
-    bytes_read += ValueDecoder::DecodeHandleIdValue(
-        (buffer + bytes_read), (buffer_size - bytes_read), &wrapper->descriptorUpdateTemplate);
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &value->sType);
     bytes_read +=
-        ValueDecoder::DecodeHandleIdValue((buffer + bytes_read), (buffer_size - bytes_read), &wrapper->layout);
-    bytes_read += ValueDecoder::DecodeUInt32Value((buffer + bytes_read), (buffer_size - bytes_read), &value->set);
+        DecodePNextStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &wrapper->pNext);
+    bytes_read += ValueDecoder::DecodeHandleIdValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &wrapper->descriptorUpdateTemplate);
+    bytes_read += ValueDecoder::DecodeHandleIdValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &wrapper->layout);
+    bytes_read += ValueDecoder::DecodeUInt32Value(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &value->set);
 
     if (wrapper->pNext != nullptr)
         value->pNext = wrapper->pNext->GetPointer();
@@ -316,56 +359,64 @@ static uint8_t* unpack_sid_struct(const PointerDecoder<uint8_t>& packed_value)
     return unpacked_memory;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_ACL* wrapper)
+size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_ACL* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t bytes_read = 0;
     ACL*   value      = wrapper->decoded_value;
 
-    bytes_read +=
-        ValueDecoder::DecodeUInt8Value((buffer + bytes_read), (buffer_size - bytes_read), &(value->AclRevision));
-    bytes_read += ValueDecoder::DecodeUInt8Value((buffer + bytes_read), (buffer_size - bytes_read), &(value->Sbz1));
-    bytes_read += ValueDecoder::DecodeUInt16Value((buffer + bytes_read), (buffer_size - bytes_read), &(value->AclSize));
-    bytes_read +=
-        ValueDecoder::DecodeUInt16Value((buffer + bytes_read), (buffer_size - bytes_read), &(value->AceCount));
-    bytes_read += ValueDecoder::DecodeUInt16Value((buffer + bytes_read), (buffer_size - bytes_read), &(value->Sbz2));
+    bytes_read += ValueDecoder::DecodeUInt8Value(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->AclRevision));
+    bytes_read += ValueDecoder::DecodeUInt8Value(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->Sbz1));
+    bytes_read += ValueDecoder::DecodeUInt16Value(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->AclSize));
+    bytes_read += ValueDecoder::DecodeUInt16Value(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->AceCount));
+    bytes_read += ValueDecoder::DecodeUInt16Value(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->Sbz2));
 
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_SECURITY_DESCRIPTOR* wrapper)
+size_t
+DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_SECURITY_DESCRIPTOR* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t               bytes_read = 0;
     SECURITY_DESCRIPTOR* value      = wrapper->decoded_value;
 
-    bytes_read += ValueDecoder::DecodeUInt8Value((buffer + bytes_read), (buffer_size - bytes_read), &(value->Revision));
-    bytes_read += ValueDecoder::DecodeUInt8Value((buffer + bytes_read), (buffer_size - bytes_read), &(value->Sbz1));
-    bytes_read += ValueDecoder::DecodeUInt16Value((buffer + bytes_read), (buffer_size - bytes_read), &(value->Control));
+    bytes_read += ValueDecoder::DecodeUInt8Value(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->Revision));
+    bytes_read += ValueDecoder::DecodeUInt8Value(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->Sbz1));
+    bytes_read += ValueDecoder::DecodeUInt16Value(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->Control));
 
     // The SID structure has a variable size, so has been packed into an array of bytes.
-    bytes_read += wrapper->PackedOwner.DecodeUInt8((buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += wrapper->PackedOwner.DecodeUInt8((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding);
     wrapper->Owner = unpack_sid_struct(wrapper->PackedOwner);
     value->Owner   = wrapper->Owner;
 
-    bytes_read += wrapper->PackedGroup.DecodeUInt8((buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += wrapper->PackedGroup.DecodeUInt8((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding);
     wrapper->Group = unpack_sid_struct(wrapper->PackedOwner);
     value->Group   = wrapper->Group;
 
     wrapper->Sacl = DecodeAllocator::Allocate<StructPointerDecoder<Decoded_ACL>>();
-    bytes_read += wrapper->Sacl->Decode((buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += wrapper->Sacl->Decode((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding);
     value->Sacl = wrapper->Sacl->GetPointer();
 
     wrapper->Dacl = DecodeAllocator::Allocate<StructPointerDecoder<Decoded_ACL>>();
-    bytes_read += wrapper->Dacl->Decode((buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += wrapper->Dacl->Decode((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding);
     value->Dacl = wrapper->Dacl->GetPointer();
 
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_SECURITY_ATTRIBUTES* wrapper)
+size_t
+DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_SECURITY_ATTRIBUTES* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
@@ -373,40 +424,49 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_SECURITY_
     SECURITY_ATTRIBUTES* value      = wrapper->decoded_value;
 
     uint32_t nLength = 0;
-    bytes_read += ValueDecoder::DecodeUInt32Value((buffer + bytes_read), (buffer_size - bytes_read), &nLength);
+    bytes_read +=
+        ValueDecoder::DecodeUInt32Value((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &nLength);
     value->nLength = nLength;
 
     wrapper->lpSecurityDescriptor = DecodeAllocator::Allocate<StructPointerDecoder<Decoded_SECURITY_DESCRIPTOR>>();
-    bytes_read += wrapper->lpSecurityDescriptor->Decode((buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read +=
+        wrapper->lpSecurityDescriptor->Decode((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding);
     value->lpSecurityDescriptor = wrapper->lpSecurityDescriptor->GetPointer();
 
-    bytes_read +=
-        ValueDecoder::DecodeInt32Value((buffer + bytes_read), (buffer_size - bytes_read), &(value->bInheritHandle));
+    bytes_read += ValueDecoder::DecodeInt32Value(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->bInheritHandle));
 
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkIndirectExecutionSetCreateInfoEXT* wrapper)
+size_t DecodeStruct(const uint8_t*                               buffer,
+                    size_t                                       buffer_size,
+                    bool                                         compact_encoding,
+                    Decoded_VkIndirectExecutionSetCreateInfoEXT* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t                               bytes_read = 0;
     VkIndirectExecutionSetCreateInfoEXT* value      = wrapper->decoded_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->sType));
-    bytes_read += DecodePNextStruct((buffer + bytes_read), (buffer_size - bytes_read), &wrapper->pNext);
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->sType));
     bytes_read +=
-        ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &wrapper->decoded_type);
+        DecodePNextStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &wrapper->pNext);
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &wrapper->decoded_type);
 
     switch (wrapper->decoded_type)
     {
         case VK_INDIRECT_EXECUTION_SET_INFO_TYPE_PIPELINES_EXT:
             wrapper->info->pPipelineInfo = DecodeAllocator::Allocate<Decoded_VkIndirectExecutionSetPipelineInfoEXT>();
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->info->pPipelineInfo);
+            bytes_read += DecodeStruct(
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->info->pPipelineInfo);
             break;
         case VK_INDIRECT_EXECUTION_SET_INFO_TYPE_SHADER_OBJECTS_EXT:
             wrapper->info->pShaderInfo = DecodeAllocator::Allocate<Decoded_VkIndirectExecutionSetShaderInfoEXT>();
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->info->pShaderInfo);
+            bytes_read += DecodeStruct(
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->info->pShaderInfo);
             break;
         default:
             break;
@@ -415,42 +475,52 @@ size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkIndirec
     return bytes_read;
 }
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkIndirectCommandsLayoutTokenEXT* wrapper)
+size_t DecodeStruct(const uint8_t*                            buffer,
+                    size_t                                    buffer_size,
+                    bool                                      compact_encoding,
+                    Decoded_VkIndirectCommandsLayoutTokenEXT* wrapper)
 {
     assert((wrapper != nullptr) && (wrapper->decoded_value != nullptr));
 
     size_t                            bytes_read = 0;
     VkIndirectCommandsLayoutTokenEXT* value      = wrapper->decoded_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &(value->sType));
-    bytes_read += DecodePNextStruct((buffer + bytes_read), (buffer_size - bytes_read), &wrapper->pNext);
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(value->sType));
     bytes_read +=
-        ValueDecoder::DecodeEnumValue((buffer + bytes_read), (buffer_size - bytes_read), &wrapper->decoded_type);
+        DecodePNextStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &wrapper->pNext);
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &wrapper->decoded_type);
 
     switch (wrapper->decoded_type)
     {
         case VK_INDIRECT_COMMANDS_TOKEN_TYPE_PUSH_CONSTANT_EXT:
         case VK_INDIRECT_COMMANDS_TOKEN_TYPE_SEQUENCE_INDEX_EXT:
             wrapper->data->pPushConstant = DecodeAllocator::Allocate<Decoded_VkIndirectCommandsPushConstantTokenEXT>();
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->data->pPushConstant);
+            bytes_read += DecodeStruct(
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->data->pPushConstant);
             break;
         case VK_INDIRECT_COMMANDS_TOKEN_TYPE_VERTEX_BUFFER_EXT:
             wrapper->data->pVertexBuffer = DecodeAllocator::Allocate<Decoded_VkIndirectCommandsVertexBufferTokenEXT>();
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->data->pVertexBuffer);
+            bytes_read += DecodeStruct(
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->data->pVertexBuffer);
             break;
         case VK_INDIRECT_COMMANDS_TOKEN_TYPE_INDEX_BUFFER_EXT:
             wrapper->data->pIndexBuffer = DecodeAllocator::Allocate<Decoded_VkIndirectCommandsIndexBufferTokenEXT>();
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->data->pIndexBuffer);
+            bytes_read += DecodeStruct(
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->data->pIndexBuffer);
             break;
         case VK_INDIRECT_COMMANDS_TOKEN_TYPE_EXECUTION_SET_EXT:
             wrapper->data->pExecutionSet = DecodeAllocator::Allocate<Decoded_VkIndirectCommandsExecutionSetTokenEXT>();
-            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), wrapper->data->pExecutionSet);
+            bytes_read += DecodeStruct(
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, wrapper->data->pExecutionSet);
             break;
         default:
             break;
     }
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((buffer + bytes_read), (buffer_size - bytes_read), &wrapper->offset);
+    bytes_read += ValueDecoder::DecodeUInt32Value(
+        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &wrapper->offset);
 
     return bytes_read;
 }
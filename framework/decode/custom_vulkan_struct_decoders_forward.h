@@ -42,14 +42,29 @@ struct Decoded_VkPerformanceValueDataINTEL;
 struct Decoded_VkIndirectExecutionSetInfoEXT;
 struct Decoded_VkIndirectCommandsTokenDataEXT;
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkClearColorValue* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkClearValue* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkPipelineExecutableStatisticValueKHR* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkDeviceOrHostAddressKHR* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkDeviceOrHostAddressConstKHR* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkAccelerationStructureGeometryDataKHR* wrapper);
 size_t
-DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkAccelerationStructureMotionInstanceNV* wrapper);
+DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_VkClearColorValue* wrapper);
+size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_VkClearValue* wrapper);
+size_t DecodeStruct(const uint8_t*                                 buffer,
+                    size_t                                         buffer_size,
+                    bool                                           compact_encoding,
+                    Decoded_VkPipelineExecutableStatisticValueKHR* wrapper);
+size_t DecodeStruct(const uint8_t*                    buffer,
+                    size_t                            buffer_size,
+                    bool                              compact_encoding,
+                    Decoded_VkDeviceOrHostAddressKHR* wrapper);
+size_t DecodeStruct(const uint8_t*                         buffer,
+                    size_t                                 buffer_size,
+                    bool                                   compact_encoding,
+                    Decoded_VkDeviceOrHostAddressConstKHR* wrapper);
+size_t DecodeStruct(const uint8_t*                                  buffer,
+                    size_t                                          buffer_size,
+                    bool                                            compact_encoding,
+                    Decoded_VkAccelerationStructureGeometryDataKHR* wrapper);
+size_t DecodeStruct(const uint8_t*                                   buffer,
+                    size_t                                           buffer_size,
+                    bool                                             compact_encoding,
+                    Decoded_VkAccelerationStructureMotionInstanceNV* wrapper);
 
 // Decoded struct wrappers for Vulkan structures that require special processing.
 struct Decoded_VkDescriptorImageInfo;
@@ -60,22 +75,45 @@ struct Decoded_VkPushDescriptorSetWithTemplateInfoKHR;
 struct Decoded_VkIndirectExecutionSetCreateInfoEXT;
 struct Decoded_VkIndirectCommandsLayoutTokenEXT;
 
-size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkDescriptorImageInfo* wrapper);
-size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkWriteDescriptorSet* wrapper);
-size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_VkPerformanceValueINTEL* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkAccelerationStructureGeometryKHR* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkPushDescriptorSetWithTemplateInfoKHR* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkIndirectExecutionSetCreateInfoEXT* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_VkIndirectCommandsLayoutTokenEXT* wrapper);
+size_t DecodeStruct(const uint8_t*                 parameter_buffer,
+                    size_t                         buffer_size,
+                    bool                           compact_encoding,
+                    Decoded_VkDescriptorImageInfo* wrapper);
+size_t DecodeStruct(const uint8_t*                parameter_buffer,
+                    size_t                        buffer_size,
+                    bool                          compact_encoding,
+                    Decoded_VkWriteDescriptorSet* wrapper);
+size_t DecodeStruct(const uint8_t*                   parameter_buffer,
+                    size_t                           buffer_size,
+                    bool                             compact_encoding,
+                    Decoded_VkPerformanceValueINTEL* wrapper);
+size_t DecodeStruct(const uint8_t*                              buffer,
+                    size_t                                      buffer_size,
+                    bool                                        compact_encoding,
+                    Decoded_VkAccelerationStructureGeometryKHR* wrapper);
+size_t DecodeStruct(const uint8_t*                                  buffer,
+                    size_t                                          buffer_size,
+                    bool                                            compact_encoding,
+                    Decoded_VkPushDescriptorSetWithTemplateInfoKHR* wrapper);
+size_t DecodeStruct(const uint8_t*                               buffer,
+                    size_t                                       buffer_size,
+                    bool                                         compact_encoding,
+                    Decoded_VkIndirectExecutionSetCreateInfoEXT* wrapper);
+size_t DecodeStruct(const uint8_t*                            buffer,
+                    size_t                                    buffer_size,
+                    bool                                      compact_encoding,
+                    Decoded_VkIndirectCommandsLayoutTokenEXT* wrapper);
 
 // Decoded struct wrappers for SECURITY_ATTRIBUTES and related WIN32 structures.
 struct Decoded_ACL;
 struct Decoded_SECURITY_DESCRIPTOR;
 struct Decoded_SECURITY_ATTRIBUTES;
 
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_ACL* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_SECURITY_DESCRIPTOR* wrapper);
-size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_SECURITY_ATTRIBUTES* wrapper);
+size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_ACL* wrapper);
+size_t
+DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_SECURITY_DESCRIPTOR* wrapper);
+size_t
+DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_SECURITY_ATTRIBUTES* wrapper);
 
 GFXRECON_END_NAMESPACE(decode)
 GFXRECON_END_NAMESPACE(gfxrecon)
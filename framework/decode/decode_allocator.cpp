@@ -23,16 +23,22 @@
 
 #include "decode/decode_allocator.h"
 
+#include <algorithm>
+#include <memory>
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
-DecodeAllocator* DecodeAllocator::instance_{ nullptr };
+thread_local DecodeAllocator* DecodeAllocator::instance_{ nullptr };
+
+static thread_local std::unique_ptr<DecodeAllocator> thread_instance;
 
 void DecodeAllocator::Begin()
 {
     if (instance_ == nullptr)
     {
-        instance_ = new DecodeAllocator();
+        thread_instance.reset(new DecodeAllocator());
+        instance_ = thread_instance.get();
     }
     assert(!instance_->can_allocate_);
     instance_->can_allocate_ = true;
@@ -41,6 +47,13 @@ void DecodeAllocator::Begin()
 void DecodeAllocator::End()
 {
     assert((instance_ != nullptr) && instance_->can_allocate_);
+
+    Statistics& statistics = instance_->statistics_;
+    size_t      size       = instance_->allocator_.GetAllocatedSize();
+    ++statistics.scope_count;
+    statistics.total_size += size;
+    statistics.peak_size = std::max(statistics.peak_size, size);
+
     if (instance_->end_can_clear_)
     {
         instance_->allocator_.Clear(false);
@@ -66,9 +79,14 @@ void DecodeAllocator::FreeSystemMemory()
 
 void DecodeAllocator::DestroyInstance()
 {
-    delete instance_;
+    thread_instance.reset();
     instance_ = nullptr;
 }
 
+DecodeAllocator::Statistics DecodeAllocator::GetStatistics()
+{
+    return (instance_ != nullptr) ? instance_->statistics_ : Statistics();
+}
+
 GFXRECON_END_NAMESPACE(decode)
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -27,14 +27,33 @@
 #include "util/defines.h"
 #include "util/monotonic_allocator.h"
 
+#include <cstdint>
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+// Each thread has its own allocator instance, so blocks may be decoded on more than one thread at a time. The static
+// functions operate on the instance for the calling thread, which is freed when the thread exits.
 class DecodeAllocator
 {
+  public:
+    // Sizes of the allocations made between each call to Begin and the matching call to End on a thread.
+    struct Statistics
+    {
+        uint64_t scope_count{ 0 };
+        uint64_t total_size{ 0 };
+        size_t   peak_size{ 0 };
+
+        size_t GetAverageSize() const
+        {
+            return (scope_count > 0) ? static_cast<size_t>(total_size / scope_count) : 0;
+        }
+    };
+
   public:
     // Begin must be called before any calls to Allocate (either initially or since End was called). This ensures
-    // allocations are not made outside the intended scope. Also creates the allocator instance if it is nullptr.
+    // allocations are not made outside the intended scope. Also creates the allocator instance for the calling thread
+    // if it is nullptr.
     static void Begin();
 
     template <typename T>
@@ -52,20 +71,31 @@ class DecodeAllocator
 
     static void TurnOffEndCanClear();
 
+    // Decoders may reference data in the parameter buffer instead of copying it only when End releases the allocations
+    // made since Begin, as the parameter buffer is only guaranteed to remain valid until End is called.
+    static bool CanReferenceParameterData() { return (instance_ != nullptr) && instance_->end_can_clear_; }
+
     // Free system memory blocks. Must not be called between Begin and End
     static void FreeSystemMemory();
 
-    // Destroy the allocator instance. This will also frees all allocated memory.
+    // Destroy the allocator instance for the calling thread. This will also frees all allocated memory.
     static void DestroyInstance();
 
+    // Statistics for the calling thread since its allocator instance was created.
+    static Statistics GetStatistics();
+
   private:
     DecodeAllocator() : allocator_(kAllocatorBlockSize), can_allocate_(false), end_can_clear_(true) {}
 
   private:
-    static const size_t     kAllocatorBlockSize{ 64 * 1024 };
-    static DecodeAllocator* instance_;
+    static const size_t kAllocatorBlockSize{ 64 * 1024 };
+
+    // Not owned; the instance is owned by a thread_local in decode_allocator.cpp, which frees it when the thread exits.
+    // A plain pointer keeps the access in Allocate from going through a thread_local initialization wrapper.
+    static thread_local DecodeAllocator* instance_;
 
     util::MonotonicAllocator allocator_;
+    Statistics               statistics_;
     bool                     can_allocate_;
     bool                     end_can_clear_;
 };
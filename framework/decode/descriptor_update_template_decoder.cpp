@@ -45,9 +45,12 @@ DescriptorUpdateTemplateDecoder::DescriptorUpdateTemplateDecoder() :
 
 DescriptorUpdateTemplateDecoder::~DescriptorUpdateTemplateDecoder() {}
 
-size_t DescriptorUpdateTemplateDecoder::Decode(const uint8_t* buffer, size_t buffer_size)
+size_t DescriptorUpdateTemplateDecoder::Decode(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)
 {
-    size_t bytes_read = DecodeAttributes(buffer, buffer_size);
+    size_t bytes_read = DecodeAttributes(buffer, buffer_size, compact_encoding);
+
+    // The template data is written with fixed size values, even when the capture file uses compact encoding.
+    constexpr bool kTemplateDataCompactEncoding = false;
 
     // The update template should identify as a struct pointer.
     assert(((GetAttributeMask() & format::PointerAttributes::kIsStruct) == format::PointerAttributes::kIsStruct) &&
@@ -56,12 +59,12 @@ size_t DescriptorUpdateTemplateDecoder::Decode(const uint8_t* buffer, size_t buf
     if (!IsNull() && HasData())
     {
         // Get the total number of encoded values and allocate memory.
-        bytes_read +=
-            ValueDecoder::DecodeSizeTValue((buffer + bytes_read), (buffer_size - bytes_read), &image_info_count_);
-        bytes_read +=
-            ValueDecoder::DecodeSizeTValue((buffer + bytes_read), (buffer_size - bytes_read), &buffer_info_count_);
         bytes_read += ValueDecoder::DecodeSizeTValue(
-            (buffer + bytes_read), (buffer_size - bytes_read), &texel_buffer_view_count_);
+            (buffer + bytes_read), (buffer_size - bytes_read), kTemplateDataCompactEncoding, &image_info_count_);
+        bytes_read += ValueDecoder::DecodeSizeTValue(
+            (buffer + bytes_read), (buffer_size - bytes_read), kTemplateDataCompactEncoding, &buffer_info_count_);
+        bytes_read += ValueDecoder::DecodeSizeTValue(
+            (buffer + bytes_read), (buffer_size - bytes_read), kTemplateDataCompactEncoding, &texel_buffer_view_count_);
 
         // Offsets of the various result structures in the allocated block that is used to store the decoded
         // descriptor template information.
@@ -97,8 +100,10 @@ size_t DescriptorUpdateTemplateDecoder::Decode(const uint8_t* buffer, size_t buf
             size_t       required_alloc_memory_size = 0;
             size_t       required_read_memory_size  = 0;
             size_t       optional_data_count        = 0;
-            size_t       optional_read_len          = ValueDecoder::DecodeSizeTValue(
-                (buffer + optional_start), (buffer_size - optional_start), &optional_data_count);
+            size_t       optional_read_len          = ValueDecoder::DecodeSizeTValue((buffer + optional_start),
+                                                                               (buffer_size - optional_start),
+                                                                               kTemplateDataCompactEncoding,
+                                                                               &optional_data_count);
             if (optional_start + optional_read_len == buffer_size)
             {
                 optional_data_count = 0;
@@ -115,8 +120,10 @@ size_t DescriptorUpdateTemplateDecoder::Decode(const uint8_t* buffer, size_t buf
                 cur_type.count = optional_data_count;
 
                 const size_t offset_to_type = optional_start + optional_read_len;
-                optional_read_len += ValueDecoder::DecodeEnumValue(
-                    (buffer + offset_to_type), (buffer_size - offset_to_type), &cur_type.type);
+                optional_read_len += ValueDecoder::DecodeEnumValue((buffer + offset_to_type),
+                                                                   (buffer_size - offset_to_type),
+                                                                   kTemplateDataCompactEncoding,
+                                                                   &cur_type.type);
                 bool invalid_optional_desc = false;
                 switch (cur_type.type)
                 {
@@ -181,7 +188,10 @@ size_t DescriptorUpdateTemplateDecoder::Decode(const uint8_t* buffer, size_t buf
             for (size_t i = 0; i < image_info_count_; ++i)
             {
                 decoded_image_info_[i].decoded_value = &image_info_[i];
-                bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), &decoded_image_info_[i]);
+                bytes_read += DecodeStruct((buffer + bytes_read),
+                                           (buffer_size - bytes_read),
+                                           kTemplateDataCompactEncoding,
+                                           &decoded_image_info_[i]);
             }
         }
 
@@ -193,7 +203,10 @@ size_t DescriptorUpdateTemplateDecoder::Decode(const uint8_t* buffer, size_t buf
             for (size_t i = 0; i < buffer_info_count_; ++i)
             {
                 decoded_buffer_info_[i].decoded_value = &buffer_info_[i];
-                bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), &decoded_buffer_info_[i]);
+                bytes_read += DecodeStruct((buffer + bytes_read),
+                                           (buffer_size - bytes_read),
+                                           kTemplateDataCompactEncoding,
+                                           &decoded_buffer_info_[i]);
             }
         }
 
@@ -205,6 +218,7 @@ size_t DescriptorUpdateTemplateDecoder::Decode(const uint8_t* buffer, size_t buf
 
             bytes_read += ValueDecoder::DecodeHandleIdArray((buffer + bytes_read),
                                                             (buffer_size - bytes_read),
+                                                            kTemplateDataCompactEncoding,
                                                             decoded_texel_buffer_view_handle_ids_,
                                                             texel_buffer_view_count_);
         }
@@ -217,11 +231,13 @@ size_t DescriptorUpdateTemplateDecoder::Decode(const uint8_t* buffer, size_t buf
             // Read the descriptor count and type again and verify it matches what was pre-read.
             // This is just to make sure the previous read actual read the data properly.
             size_t current_count = 0;
-            bytes_read +=
-                ValueDecoder::DecodeSizeTValue((buffer + bytes_read), (buffer_size - bytes_read), &current_count);
+            bytes_read += ValueDecoder::DecodeSizeTValue(
+                (buffer + bytes_read), (buffer_size - bytes_read), kTemplateDataCompactEncoding, &current_count);
             VkDescriptorType current_descriptor_type;
-            bytes_read += ValueDecoder::DecodeEnumValue(
-                (buffer + bytes_read), (buffer_size - bytes_read), &current_descriptor_type);
+            bytes_read += ValueDecoder::DecodeEnumValue((buffer + bytes_read),
+                                                        (buffer_size - bytes_read),
+                                                        kTemplateDataCompactEncoding,
+                                                        &current_descriptor_type);
             assert(current_count == cur_type.count);
             assert(current_descriptor_type == cur_type.type);
 
@@ -240,6 +256,7 @@ size_t DescriptorUpdateTemplateDecoder::Decode(const uint8_t* buffer, size_t buf
 
                     bytes_read += ValueDecoder::DecodeHandleIdArray((buffer + bytes_read),
                                                                     (buffer_size - bytes_read),
+                                                                    kTemplateDataCompactEncoding,
                                                                     decoded_acceleration_structure_khr_handle_ids_,
                                                                     acceleration_structure_khr_count_);
                     break;
@@ -264,6 +281,7 @@ size_t DescriptorUpdateTemplateDecoder::Decode(const uint8_t* buffer, size_t buf
             }
         }
     }
+
     assert(bytes_read <= buffer_size);
     return bytes_read;
 }
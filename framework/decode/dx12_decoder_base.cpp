@@ -346,173 +346,175 @@ void Dx12DecoderBase::SetCurrentApiCallId(format::ApiCallId api_call_id)
     }
 }
 
-size_t Dx12DecoderBase::Decode_ID3D12Device_CheckFeatureSupport(format::HandleId object_id,
-                                                                const uint8_t*   parameter_buffer,
-                                                                size_t           buffer_size)
+size_t Dx12DecoderBase::Decode_ID3D12Device_CheckFeatureSupport(format::HandleId   object_id,
+                                                                const ApiCallInfo& call_info,
+                                                                const uint8_t*     parameter_buffer,
+                                                                size_t             buffer_size)
 {
     size_t        bytes_read = 0;
     D3D12_FEATURE feature{};
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &feature);
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &feature);
 
     switch (feature)
     {
         case D3D12_FEATURE_D3D12_OPTIONS:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_ARCHITECTURE:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_ARCHITECTURE>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_FEATURE_LEVELS:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_FEATURE_LEVELS>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_FORMAT_SUPPORT:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_FORMAT_SUPPORT>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_MULTISAMPLE_QUALITY_LEVELS:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_MULTISAMPLE_QUALITY_LEVELS>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_FORMAT_INFO:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_FORMAT_INFO>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_GPU_VIRTUAL_ADDRESS_SUPPORT:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_GPU_VIRTUAL_ADDRESS_SUPPORT>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_SHADER_MODEL:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_SHADER_MODEL>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_D3D12_OPTIONS1:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS1>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_PROTECTED_RESOURCE_SESSION_SUPPORT:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_PROTECTED_RESOURCE_SESSION_SUPPORT>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_ROOT_SIGNATURE:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_ROOT_SIGNATURE>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_ARCHITECTURE1:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_ARCHITECTURE1>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_D3D12_OPTIONS2:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS2>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_SHADER_CACHE:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_SHADER_CACHE>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_COMMAND_QUEUE_PRIORITY:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_COMMAND_QUEUE_PRIORITY>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_D3D12_OPTIONS3:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS3>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_EXISTING_HEAPS:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_EXISTING_HEAPS>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_D3D12_OPTIONS4:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS4>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_SERIALIZATION:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_SERIALIZATION>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_CROSS_NODE:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_CROSS_NODE>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_D3D12_OPTIONS5:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS5>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_DISPLAYABLE:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_DISPLAYABLE>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_D3D12_OPTIONS6:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS6>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_QUERY_META_COMMAND:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_QUERY_META_COMMAND>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_D3D12_OPTIONS7:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS7>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_PROTECTED_RESOURCE_SESSION_TYPE_COUNT:
             bytes_read +=
                 DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_PROTECTED_RESOURCE_SESSION_TYPE_COUNT>(
-                    object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                    object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_PROTECTED_RESOURCE_SESSION_TYPES:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_PROTECTED_RESOURCE_SESSION_TYPES>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_D3D12_OPTIONS8:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS8>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_D3D12_OPTIONS9:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS9>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_D3D12_OPTIONS10:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS10>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_D3D12_OPTIONS11:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS11>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_D3D12_OPTIONS12:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS12>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_D3D12_OPTIONS13:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS13>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_D3D12_OPTIONS14:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS14>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_D3D12_OPTIONS15:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS15>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_D3D12_OPTIONS16:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS16>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_D3D12_OPTIONS17:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS17>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_D3D12_OPTIONS18:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS18>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         case D3D12_FEATURE_D3D12_OPTIONS19:
             bytes_read += DecodeCheckD3D12FeatureSupport<Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS19>(
-                object_id, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+                object_id, call_info, feature, (parameter_buffer + bytes_read), (buffer_size - bytes_read));
             break;
         default:
             GFXRECON_LOG_FATAL("Failed to decode ID3D12Device::CheckFeatureSupport pFeatureData parameter with "
@@ -524,28 +526,34 @@ size_t Dx12DecoderBase::Decode_ID3D12Device_CheckFeatureSupport(format::HandleId
     return bytes_read;
 }
 
-size_t Dx12DecoderBase::Decode_IDXGIFactory5_CheckFeatureSupport(format::HandleId object_id,
-                                                                 const uint8_t*   parameter_buffer,
-                                                                 size_t           buffer_size)
+size_t Dx12DecoderBase::Decode_IDXGIFactory5_CheckFeatureSupport(format::HandleId   object_id,
+                                                                 const ApiCallInfo& call_info,
+                                                                 const uint8_t*     parameter_buffer,
+                                                                 size_t             buffer_size)
 {
     size_t       bytes_read = 0;
     DXGI_FEATURE feature{};
     UINT         feature_data_size = 0;
     HRESULT      return_value      = E_FAIL;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &feature);
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &feature);
 
     switch (feature)
     {
         case DXGI_FEATURE_PRESENT_ALLOW_TEARING:
         {
             BOOL allow_tearing = FALSE;
+            bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read),
+                                                         (buffer_size - bytes_read),
+                                                         call_info.compact_encoding,
+                                                         &allow_tearing);
+            bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read),
+                                                          (buffer_size - bytes_read),
+                                                          call_info.compact_encoding,
+                                                          &feature_data_size);
             bytes_read += ValueDecoder::DecodeInt32Value(
-                (parameter_buffer + bytes_read), (buffer_size - bytes_read), &allow_tearing);
-            bytes_read += ValueDecoder::DecodeUInt32Value(
-                (parameter_buffer + bytes_read), (buffer_size - bytes_read), &feature_data_size);
-            bytes_read += ValueDecoder::DecodeInt32Value(
-                (parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+                (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
             for (auto consumer : GetConsumers())
             {
@@ -567,9 +575,10 @@ size_t Dx12DecoderBase::Decode_IDXGIFactory5_CheckFeatureSupport(format::HandleI
     return bytes_read;
 }
 
-size_t Dx12DecoderBase::Decode_ID3D12Resource_WriteToSubresource(format::HandleId object_id,
-                                                                 const uint8_t*   parameter_buffer,
-                                                                 size_t           buffer_size)
+size_t Dx12DecoderBase::Decode_ID3D12Resource_WriteToSubresource(format::HandleId   object_id,
+                                                                 const ApiCallInfo& call_info,
+                                                                 const uint8_t*     parameter_buffer,
+                                                                 size_t             buffer_size)
 {
     size_t bytes_read = 0;
 
@@ -580,17 +589,19 @@ size_t Dx12DecoderBase::Decode_ID3D12Resource_WriteToSubresource(format::HandleI
     UINT                                    SrcDepthPitch;
     HRESULT                                 return_value;
 
+    bytes_read += ValueDecoder::DecodeUInt32Value(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DstSubresource);
     bytes_read +=
-        ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DstSubresource);
-    bytes_read += pDstBox.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pSrcData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-
-    bytes_read +=
-        ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &SrcRowPitch);
+        pDstBox.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
     bytes_read +=
-        ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &SrcDepthPitch);
-    bytes_read +=
-        ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+        pSrcData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+
+    bytes_read += ValueDecoder::DecodeUInt32Value(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &SrcRowPitch);
+    bytes_read += ValueDecoder::DecodeUInt32Value(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &SrcDepthPitch);
+    bytes_read += ValueDecoder::DecodeInt32Value(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -602,22 +613,20 @@ size_t Dx12DecoderBase::Decode_ID3D12Resource_WriteToSubresource(format::HandleI
 
 void Dx12DecoderBase::DecodeMethodCall(format::ApiCallId  call_id,
                                        format::HandleId   object_id,
-                                       const ApiCallInfo& call_options,
+                                       const ApiCallInfo& call_info,
                                        const uint8_t*     parameter_buffer,
                                        size_t             buffer_size)
 {
-    GFXRECON_UNREFERENCED_PARAMETER(call_options);
-
     switch (call_id)
     {
         case format::ApiCallId::ApiCall_ID3D12Device_CheckFeatureSupport:
-            Decode_ID3D12Device_CheckFeatureSupport(object_id, parameter_buffer, buffer_size);
+            Decode_ID3D12Device_CheckFeatureSupport(object_id, call_info, parameter_buffer, buffer_size);
             break;
         case format::ApiCallId::ApiCall_IDXGIFactory5_CheckFeatureSupport:
-            Decode_IDXGIFactory5_CheckFeatureSupport(object_id, parameter_buffer, buffer_size);
+            Decode_IDXGIFactory5_CheckFeatureSupport(object_id, call_info, parameter_buffer, buffer_size);
             break;
         case format::ApiCallId::ApiCall_ID3D12Resource_WriteToSubresource:
-            Decode_ID3D12Resource_WriteToSubresource(object_id, parameter_buffer, buffer_size);
+            Decode_ID3D12Resource_WriteToSubresource(object_id, call_info, parameter_buffer, buffer_size);
             break;
         default:
             break;
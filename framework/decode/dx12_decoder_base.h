@@ -77,7 +77,7 @@ class Dx12DecoderBase : public ApiDecoder
 
     virtual void DecodeMethodCall(format::ApiCallId  call_id,
                                   format::HandleId   object_id,
-                                  const ApiCallInfo& call_options,
+                                  const ApiCallInfo& call_info,
                                   const uint8_t*     parameter_buffer,
                                   size_t             buffer_size) override;
 
@@ -222,10 +222,11 @@ class Dx12DecoderBase : public ApiDecoder
 
   private:
     template <typename T>
-    size_t DecodeCheckD3D12FeatureSupport(format::HandleId object_id,
-                                          D3D12_FEATURE    feature,
-                                          const uint8_t*   parameter_buffer,
-                                          size_t           buffer_size)
+    size_t DecodeCheckD3D12FeatureSupport(format::HandleId   object_id,
+                                          const ApiCallInfo& call_info,
+                                          D3D12_FEATURE      feature,
+                                          const uint8_t*     parameter_buffer,
+                                          size_t             buffer_size)
     {
         size_t bytes_read = 0;
 
@@ -233,11 +234,14 @@ class Dx12DecoderBase : public ApiDecoder
         UINT                    feature_data_size;
         HRESULT                 return_value;
 
-        bytes_read += feature_data.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-        bytes_read += ValueDecoder::DecodeUInt32Value(
-            (parameter_buffer + bytes_read), (buffer_size - bytes_read), &feature_data_size);
-        bytes_read +=
-            ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+        bytes_read += feature_data.Decode(
+            (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+        bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read),
+                                                      (buffer_size - bytes_read),
+                                                      call_info.compact_encoding,
+                                                      &feature_data_size);
+        bytes_read += ValueDecoder::DecodeInt32Value(
+            (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
         auto* capture_data = feature_data.GetPointer();
         if (capture_data != nullptr)
@@ -254,17 +258,20 @@ class Dx12DecoderBase : public ApiDecoder
         return bytes_read;
     }
 
-    size_t Decode_ID3D12Device_CheckFeatureSupport(format::HandleId object_id,
-                                                   const uint8_t*   parameter_buffer,
-                                                   size_t           buffer_size);
+    size_t Decode_ID3D12Device_CheckFeatureSupport(format::HandleId   object_id,
+                                                   const ApiCallInfo& call_info,
+                                                   const uint8_t*     parameter_buffer,
+                                                   size_t             buffer_size);
 
-    size_t Decode_IDXGIFactory5_CheckFeatureSupport(format::HandleId object_id,
-                                                    const uint8_t*   parameter_buffer,
-                                                    size_t           buffer_size);
+    size_t Decode_IDXGIFactory5_CheckFeatureSupport(format::HandleId   object_id,
+                                                    const ApiCallInfo& call_info,
+                                                    const uint8_t*     parameter_buffer,
+                                                    size_t             buffer_size);
 
-    size_t Decode_ID3D12Resource_WriteToSubresource(format::HandleId object_id,
-                                                    const uint8_t*   parameter_buffer,
-                                                    size_t           buffer_size);
+    size_t Decode_ID3D12Resource_WriteToSubresource(format::HandleId   object_id,
+                                                    const ApiCallInfo& call_info,
+                                                    const uint8_t*     parameter_buffer,
+                                                    size_t             buffer_size);
 
   private:
     std::vector<Dx12Consumer*> consumers_;
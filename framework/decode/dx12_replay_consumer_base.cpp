@@ -79,7 +79,7 @@ Dx12ReplayConsumerBase::Dx12ReplayConsumerBase(std::shared_ptr<application::Appl
     options_(options), current_message_length_(0), info_queue_(nullptr), resource_data_util_(nullptr),
     frame_buffer_renderer_(nullptr), debug_layer_enabled_(false), set_auto_breadcrumbs_enablement_(false),
     set_breadcrumb_context_enablement_(false), set_page_fault_enablement_(false), loading_trim_state_(false),
-    fps_info_(nullptr), frame_end_marker_count_(0)
+    fps_info_(nullptr), replay_profiler_(nullptr), frame_end_marker_count_(0)
 {
     if (options_.enable_validation_layer)
     {
@@ -790,6 +790,8 @@ HRESULT Dx12ReplayConsumerBase::OverridePresent(DxObjectInfo* replay_object_info
                                                 UINT          sync_interval,
                                                 UINT          flags)
 {
+    ReplayProfiler::ScopedDriverTimer driver_timer(replay_profiler_);
+
     auto replay_object = static_cast<IDXGISwapChain*>(replay_object_info->object);
     PrePresent(replay_object_info, flags);
     auto result = replay_object->Present(sync_interval, flags);
@@ -805,6 +807,8 @@ Dx12ReplayConsumerBase::OverridePresent1(DxObjectInfo*
                                          UINT                                                   flags,
                                          StructPointerDecoder<Decoded_DXGI_PRESENT_PARAMETERS>* present_parameters)
 {
+    ReplayProfiler::ScopedDriverTimer driver_timer(replay_profiler_);
+
     auto replay_object = static_cast<IDXGISwapChain1*>(replay_object_info->object);
     PrePresent(replay_object_info, flags);
     auto result = replay_object->Present1(sync_interval, flags, present_parameters->GetPointer());
@@ -2134,6 +2138,8 @@ void Dx12ReplayConsumerBase::OverrideExecuteCommandLists(DxObjectInfo*
 {
     assert((replay_object_info != nullptr) && (replay_object_info->object != nullptr) && (command_lists != nullptr));
 
+    ReplayProfiler::ScopedDriverTimer driver_timer(replay_profiler_);
+
     auto replay_object = static_cast<ID3D12CommandQueue*>(replay_object_info->object);
 
     bool needs_mapping = false;
@@ -3107,6 +3113,8 @@ HANDLE Dx12ReplayConsumerBase::GetEventObject(uint64_t event_id, bool reset)
 
 void Dx12ReplayConsumerBase::WaitForFenceEvent(format::HandleId fence_id, HANDLE event_object)
 {
+    ReplayProfiler::ScopedDriverTimer driver_timer(replay_profiler_);
+
     auto wait_result = WaitForSingleObject(event_object, kDefaultWaitTimeout);
 
     if (wait_result == WAIT_TIMEOUT)
@@ -37,6 +37,7 @@
 #include "graphics/dx12_gpu_va_map.h"
 #include "graphics/dx12_resource_data_util.h"
 #include "graphics/dx12_image_renderer.h"
+#include "decode/replay_profiler.h"
 #include "decode/screenshot_handler_base.h"
 #include "graphics/fps_info.h"
 #include "graphics/dx12_util.h"
@@ -68,6 +69,10 @@ class Dx12ReplayConsumerBase : public Dx12Consumer
 
     void SetFpsInfo(graphics::FpsInfo* fps_info) { fps_info_ = fps_info; }
 
+    // When profiler is not null, the time spent in command list execution, presentation, and fence waits is recorded
+    // as driver time by the profiler.
+    void SetReplayProfiler(ReplayProfiler* profiler) { replay_profiler_ = profiler; }
+
     void PostReplay();
 
     virtual void ProcessStateBeginMarker(uint64_t frame_number) override;
@@ -1094,6 +1099,7 @@ class Dx12ReplayConsumerBase : public Dx12Consumer
     bool                                                  set_page_fault_enablement_;
     bool                                                  loading_trim_state_;
     graphics::FpsInfo*                                    fps_info_;
+    ReplayProfiler*                                       replay_profiler_;
     std::unique_ptr<Dx12ResourceValueMapper>              resource_value_mapper_;
     std::unique_ptr<Dx12AccelerationStructureBuilder>     accel_struct_builder_;
     graphics::Dx12ShaderIdMap                             shader_id_map_;
@@ -27,10 +27,14 @@
 #include "decode/decode_allocator.h"
 #include "format/format_util.h"
 #include "util/compressor.h"
+#include "util/date_time.h"
 #include "util/logging.h"
 #include "util/platform.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cinttypes>
+#include <limits>
 #include <numeric>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -39,10 +43,18 @@ GFXRECON_BEGIN_NAMESPACE(decode)
 // TODO GH #1195: frame numbering should be 1-based.
 const uint32_t kFirstFrame = 0;
 
+// Size of the region ahead of the current read position that the OS is asked to prefetch for memory mapped files.
+const size_t kMappedFileReadAheadSize = 32 * 1024 * 1024;
+
+// Maximum number of blocks read ahead of the block being processed during a state snapshot's resource initialization
+// section.  The read-ahead queue also limits the total size of the blocks that are read ahead.
+const size_t kStateSnapshotReadAheadBlocks = 256;
+
 FileProcessor::FileProcessor() :
     file_header_{}, file_descriptor_(nullptr), current_frame_number_(kFirstFrame), bytes_read_(0),
-    error_state_(kErrorInvalidFileDescriptor), annotation_handler_(nullptr), compressor_(nullptr), block_index_(0),
-    api_call_index_(0), block_limit_(0), capture_uses_frame_markers_(false), first_frame_(kFirstFrame + 1)
+    error_state_(kErrorInvalidFileDescriptor), annotation_handler_(nullptr), replay_profiler_(nullptr),
+    compressor_(nullptr), block_index_(0), api_call_index_(0), block_limit_(0), capture_uses_frame_markers_(false),
+    first_frame_(kFirstFrame + 1), parameter_data_(nullptr)
 {}
 
 FileProcessor::FileProcessor(uint64_t block_limit) : FileProcessor()
@@ -52,17 +64,32 @@ FileProcessor::FileProcessor(uint64_t block_limit) : FileProcessor()
 
 FileProcessor::~FileProcessor()
 {
+    // The read-ahead queue references the file and compressor, and must be stopped first.
+    read_ahead_queue_.reset();
+
     if (nullptr != compressor_)
     {
         delete compressor_;
         compressor_ = nullptr;
     }
 
+    UnmapFile();
+
     if (file_descriptor_)
     {
         fclose(file_descriptor_);
     }
 
+    const DecodeAllocator::Statistics decode_statistics = DecodeAllocator::GetStatistics();
+    if (decode_statistics.scope_count > 0)
+    {
+        GFXRECON_LOG_DEBUG("Decode allocator: %" PRIu64 " calls decoded, peak size %" PRIuPTR
+                           " bytes, average size %" PRIuPTR " bytes",
+                           decode_statistics.scope_count,
+                           decode_statistics.peak_size,
+                           decode_statistics.GetAverageSize());
+    }
+
     DecodeAllocator::DestroyInstance();
 }
 
@@ -82,15 +109,26 @@ bool FileProcessor::Initialize(const std::string& filename)
 
     if ((result == 0) && (file_descriptor_ != nullptr))
     {
+        if (use_memory_mapped_file_)
+        {
+            MapFile(filename);
+        }
+
         success = ProcessFileHeader();
 
         if (success)
         {
             filename_    = filename;
             error_state_ = kErrorNone;
+
+            if ((read_ahead_queue_depth_ > 0) && !IsFileMemoryMapped())
+            {
+                StartBlockReadAhead();
+            }
         }
         else
         {
+            UnmapFile();
             fclose(file_descriptor_);
             file_descriptor_ = nullptr;
         }
@@ -119,7 +157,7 @@ bool FileProcessor::ProcessNextFrame()
         {
             error_state_ = kErrorInvalidFileDescriptor;
         }
-        else if (ferror(file_descriptor_))
+        else if (IsFileError())
         {
             error_state_ = kErrorReadingFile;
         }
@@ -203,6 +241,12 @@ bool FileProcessor::ProcessFileHeader()
                         case format::FileOption::kCompressionType:
                             enabled_options_.compression_type = static_cast<format::CompressionType>(option.value);
                             break;
+                        case format::FileOption::kContentDeduplication:
+                            enabled_options_.content_deduplication_limit = option.value;
+                            break;
+                        case format::FileOption::kCompactEncoding:
+                            enabled_options_.compact_encoding = (option.value != 0);
+                            break;
                         default:
                             GFXRECON_LOG_WARNING("Ignoring unrecognized file header option %u", option.key);
                             break;
@@ -236,6 +280,427 @@ bool FileProcessor::ProcessFileHeader()
     return success;
 }
 
+void FileProcessor::StartBlockReadAhead()
+{
+    assert(read_ahead_queue_ == nullptr);
+
+    read_ahead_queue_ = std::make_unique<BlockReadAheadQueue>(read_ahead_queue_depth_, decompression_thread_count_);
+    read_ahead_queue_->Start(file_descriptor_, compressor_);
+}
+
+void FileProcessor::StartStateSnapshotReadAhead()
+{
+    if (enable_state_snapshot_read_ahead_ && (read_ahead_queue_ == nullptr) && (file_descriptor_ != nullptr) &&
+        !IsFileMemoryMapped())
+    {
+        // Uncompressed blocks only benefit from the overlapped file reads.
+        size_t thread_count = (compressor_ != nullptr) ? decompression_thread_count_ : 0;
+
+        read_ahead_queue_ = std::make_unique<BlockReadAheadQueue>(kStateSnapshotReadAheadBlocks, thread_count);
+        read_ahead_queue_->Start(file_descriptor_, compressor_);
+
+        state_snapshot_read_ahead_ = true;
+    }
+}
+
+void FileProcessor::StopStateSnapshotReadAhead()
+{
+    if (state_snapshot_read_ahead_)
+    {
+        // The blocks that were read ahead of the end of the resource initialization section are discarded, and will
+        // be read from the file again.
+        int64_t offset = read_ahead_queue_->GetNextBlockFileOffset();
+
+        read_ahead_queue_.reset();
+        state_snapshot_read_ahead_ = false;
+
+        if (!util::platform::FileSeek(file_descriptor_, offset, util::platform::FileSeekSet))
+        {
+            HandleBlockReadError(kErrorReadingFile, "Failed to seek to the end of the state snapshot resource data");
+        }
+    }
+}
+
+const format::FileIndex* FileProcessor::GetFileIndex()
+{
+    if (file_index_.IsEmpty() && (file_descriptor_ != nullptr))
+    {
+        std::string index_filename = format::FileIndex::GetIndexFilename(filename_);
+
+        if (file_index_.Load(index_filename, filename_))
+        {
+            GFXRECON_LOG_INFO("Loaded file index %s", index_filename.c_str());
+        }
+        else
+        {
+            GFXRECON_LOG_INFO("Building file index for %s", filename_.c_str());
+            file_index_.Build(filename_);
+        }
+    }
+
+    return file_index_.IsEmpty() ? nullptr : &file_index_;
+}
+
+bool FileProcessor::SeekToFrame(uint64_t frame_number)
+{
+    const format::FileIndex* file_index = GetFileIndex();
+    format::FileIndexEntry   entry;
+
+    if ((file_index == nullptr) || !file_index->FindFrame(frame_number, &entry))
+    {
+        GFXRECON_LOG_ERROR("Failed to seek to frame %" PRIu64 ": the frame was not found in the file index",
+                           frame_number);
+        return false;
+    }
+
+    return SeekToIndexEntry(entry);
+}
+
+bool FileProcessor::SeekToBlock(uint64_t block_index)
+{
+    const format::FileIndex* file_index = GetFileIndex();
+    format::FileIndexEntry   entry;
+
+    if ((file_index == nullptr) || !file_index->FindBlock(block_index, &entry))
+    {
+        GFXRECON_LOG_ERROR("Failed to seek to block %" PRIu64 ": the block was not found in the file index",
+                           block_index);
+        return false;
+    }
+
+    // Content data blocks between the indexed block and the requested block are skipped below, so are read first.
+    bool success = LoadContentBlocks(block_index) && SeekToIndexEntry(entry);
+
+    // The index only records the location of some blocks, so skip forward from the closest indexed block.
+    while (success && (block_index_ < block_index))
+    {
+        success = SkipBlock();
+    }
+
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Failed to seek to block %" PRIu64, block_index);
+    }
+
+    return success;
+}
+
+bool FileProcessor::SeekToIndexEntry(const format::FileIndexEntry& entry)
+{
+    if (!LoadContentBlocks(entry.block_index))
+    {
+        GFXRECON_LOG_ERROR("Failed to seek to block %" PRIu64 ": the content data blocks that precede it could not be "
+                           "read from capture file %s",
+                           entry.block_index,
+                           filename_.c_str());
+        return false;
+    }
+
+    if (SeekToFileOffset(entry.offset))
+    {
+        current_frame_number_       = entry.frame_number;
+        block_index_                = entry.block_index;
+        capture_uses_frame_markers_ = file_index_.UsesFrameMarkersAt(entry);
+
+        // Frame end markers are numbered from the frame at which a preceding state snapshot was captured.
+        first_frame_ = kFirstFrame + 1;
+        for (const auto& state_marker : file_index_.GetStateMarkers())
+        {
+            if ((state_marker.marker_type == format::kEndMarker) &&
+                (state_marker.location.block_index < entry.block_index))
+            {
+                first_frame_ = state_marker.captured_frame_number;
+            }
+        }
+
+        return true;
+    }
+
+    GFXRECON_LOG_ERROR("Failed to seek to offset %" PRIu64 " of capture file %s", entry.offset, filename_.c_str());
+    return false;
+}
+
+bool FileProcessor::LoadContentBlocks(uint64_t block_index)
+{
+    const std::vector<format::FileIndexContentBlock>& content_blocks = file_index_.GetContentBlocks();
+
+    auto is_loaded = [this, block_index](const format::FileIndexContentBlock& content_block) {
+        return (content_block.location.block_index >= block_index) ||
+               (content_data_.find(content_block.content_id) != content_data_.end());
+    };
+
+    if (std::all_of(content_blocks.begin(), content_blocks.end(), is_loaded))
+    {
+        return true;
+    }
+
+    // The read-ahead thread must not access the file while the content data blocks are read.  The queue is restored
+    // for the seek that follows, which restarts it at the new file position.
+    std::unique_ptr<BlockReadAheadQueue> read_ahead_queue          = std::move(read_ahead_queue_);
+    bool                                 state_snapshot_read_ahead = state_snapshot_read_ahead_;
+
+    if (read_ahead_queue != nullptr)
+    {
+        read_ahead_queue->Stop();
+    }
+
+    state_snapshot_read_ahead_ = false;
+
+    bool success = true;
+
+    for (auto iter = content_blocks.begin(); success && (iter != content_blocks.end()); ++iter)
+    {
+        if (!is_loaded(*iter))
+        {
+            format::BlockHeader block_header;
+            format::MetaDataId  meta_data_id = 0;
+
+            // The content data block stores its data in content_data_ when it is processed.
+            success = SeekToFileOffset(iter->location.offset) && ReadBlockHeader(&block_header) &&
+                      (format::RemoveCompressedBlockBit(block_header.type) == format::BlockType::kMetaDataBlock) &&
+                      ReadBytes(&meta_data_id, sizeof(meta_data_id)) &&
+                      (format::GetMetaDataType(meta_data_id) == format::MetaDataType::kContentDataCommand) &&
+                      ProcessMetaData(block_header, meta_data_id);
+        }
+    }
+
+    read_ahead_queue_          = std::move(read_ahead_queue);
+    state_snapshot_read_ahead_ = state_snapshot_read_ahead;
+
+    return success;
+}
+
+bool FileProcessor::StoreContentData(const format::BlockHeader& block_header, uint64_t content_id, size_t data_size)
+{
+    ContentData& content = content_data_[content_id];
+
+    content_data_copy_size_ -= content.copy.size();
+    content.copy.clear();
+    content.copy.shrink_to_fit();
+
+    // Data in the mapped file remains valid until the file is closed, so it does not need to be copied.
+    if (IsFileMemoryMapped() && !format::IsBlockCompressed(block_header.type) &&
+        (parameter_data_ >= mapped_file_data_) && (parameter_data_ < (mapped_file_data_ + mapped_file_size_)))
+    {
+        content.data = parameter_data_;
+        content.size = data_size;
+        return true;
+    }
+
+    // Writers stop storing content when the limit would be exceeded, so a file that exceeds it is invalid.
+    const uint64_t copy_limit = static_cast<uint64_t>(enabled_options_.content_deduplication_limit) << 20;
+
+    if ((content_data_copy_size_ + data_size) > copy_limit)
+    {
+        GFXRECON_LOG_ERROR("Content data block for content ID %" PRIu64
+                           " exceeds the content deduplication limit of %u MiB (frame %" PRIu64 " block %" PRIu64 ")",
+                           content_id,
+                           enabled_options_.content_deduplication_limit,
+                           current_frame_number_,
+                           block_index_);
+        content_data_.erase(content_id);
+        error_state_ = kErrorReadingBlockData;
+        return false;
+    }
+
+    content.copy.assign(parameter_data_, parameter_data_ + data_size);
+    content.data = content.copy.data();
+    content.size = data_size;
+    content_data_copy_size_ += data_size;
+
+    return true;
+}
+
+bool FileProcessor::SeekToFileOffset(uint64_t offset)
+{
+    bool success = false;
+
+    if (mapped_file_data_ != nullptr)
+    {
+        if (offset <= mapped_file_size_)
+        {
+            mapped_file_offset_        = static_cast<size_t>(offset);
+            mapped_file_advise_offset_ = 0;
+            mapped_file_eof_           = false;
+            success                    = true;
+        }
+    }
+    else if (file_descriptor_ != nullptr)
+    {
+        // The read-ahead thread must not access the file while it is being repositioned.
+        bool restart_read_ahead = (read_ahead_queue_ != nullptr) && !state_snapshot_read_ahead_;
+        read_ahead_queue_.reset();
+        state_snapshot_read_ahead_ = false;
+
+        success = util::platform::FileSeek(file_descriptor_, static_cast<int64_t>(offset), util::platform::FileSeekSet);
+
+        if (restart_read_ahead)
+        {
+            StartBlockReadAhead();
+        }
+    }
+
+    return success;
+}
+
+bool FileProcessor::SkipBlock()
+{
+    format::BlockHeader block_header;
+    bool                is_delimiter = false;
+    bool                success      = ReadBlockHeader(&block_header);
+
+    if (success)
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+        size_t skip_size = static_cast<size_t>(block_header.size);
+
+        format::BlockType base_type = format::RemoveCompressedBlockBit(block_header.type);
+
+        if (((base_type == format::BlockType::kFunctionCallBlock) ||
+             (base_type == format::BlockType::kMethodCallBlock)) &&
+            (skip_size >= sizeof(format::ApiCallId)))
+        {
+            format::ApiCallId api_call_id = format::ApiCallId::ApiCall_Unknown;
+
+            success      = ReadBytes(&api_call_id, sizeof(api_call_id));
+            is_delimiter = success && IsFrameDelimiter(api_call_id);
+            skip_size -= sizeof(api_call_id);
+        }
+        else if ((block_header.type == format::BlockType::kFrameMarkerBlock) &&
+                 (skip_size >= sizeof(format::MarkerType)))
+        {
+            format::MarkerType marker_type = format::MarkerType::kUnknownMarker;
+
+            success      = ReadBytes(&marker_type, sizeof(marker_type));
+            is_delimiter = success && IsFrameDelimiter(block_header.type, marker_type);
+            skip_size -= sizeof(marker_type);
+
+            if (is_delimiter && !capture_uses_frame_markers_)
+            {
+                capture_uses_frame_markers_ = true;
+                current_frame_number_       = kFirstFrame;
+            }
+        }
+
+        success = success && SkipBytes(skip_size);
+    }
+
+    if (success)
+    {
+        ++block_index_;
+
+        if (is_delimiter)
+        {
+            ++current_frame_number_;
+        }
+    }
+
+    return success;
+}
+
+void FileProcessor::MapFile(const std::string& filename)
+{
+    assert((file_descriptor_ != nullptr) && (mapped_file_data_ == nullptr));
+
+    if (util::platform::FileSeek(file_descriptor_, 0, util::platform::FileSeekEnd))
+    {
+        int64_t file_size = util::platform::FileTell(file_descriptor_);
+
+        if (util::platform::FileSeek(file_descriptor_, 0, util::platform::FileSeekSet) && (file_size > 0) &&
+            (static_cast<uint64_t>(file_size) <= std::numeric_limits<size_t>::max()))
+        {
+            mapped_file_size_ = static_cast<size_t>(file_size);
+            mapped_file_data_ =
+                reinterpret_cast<const uint8_t*>(util::platform::MapFile(file_descriptor_, mapped_file_size_));
+        }
+    }
+
+    if (mapped_file_data_ != nullptr)
+    {
+        mapped_file_offset_        = 0;
+        mapped_file_advise_offset_ = 0;
+        mapped_file_eof_           = false;
+
+        util::platform::AdviseSequentialAccess(mapped_file_data_, mapped_file_size_);
+    }
+    else
+    {
+        GFXRECON_LOG_WARNING("Failed to memory map file %s, falling back to buffered file reads", filename.c_str());
+        mapped_file_size_ = 0;
+    }
+}
+
+void FileProcessor::UnmapFile()
+{
+    if (mapped_file_data_ != nullptr)
+    {
+        util::platform::UnmapFile(mapped_file_data_, mapped_file_size_);
+        mapped_file_data_ = nullptr;
+        mapped_file_size_ = 0;
+    }
+}
+
+const uint8_t* FileProcessor::ReadMappedBytes(size_t read_size)
+{
+    assert(mapped_file_data_ != nullptr);
+
+    if (read_size > (mapped_file_size_ - mapped_file_offset_))
+    {
+        // Match the behavior of a short fread, which consumes the remainder of the file and sets the EOF indicator.
+        mapped_file_offset_ = mapped_file_size_;
+        mapped_file_eof_    = true;
+        return nullptr;
+    }
+
+    const uint8_t* data = mapped_file_data_ + mapped_file_offset_;
+    mapped_file_offset_ += read_size;
+
+    // Once the read position passes the middle of the previously prefetched region, ask the OS to start loading the
+    // next region so that page faults for upcoming blocks are satisfied from the page cache.
+    if (mapped_file_offset_ > mapped_file_advise_offset_)
+    {
+        size_t page_size    = util::platform::GetSystemPageSize();
+        size_t advise_start = mapped_file_offset_ - (mapped_file_offset_ % page_size);
+        size_t advise_size  = std::min(kMappedFileReadAheadSize, mapped_file_size_ - advise_start);
+
+        util::platform::AdviseWillNeed(mapped_file_data_ + advise_start, advise_size);
+        mapped_file_advise_offset_ = advise_start + (advise_size / 2);
+    }
+
+    return data;
+}
+
+bool FileProcessor::IsFileAtEnd() const
+{
+    if (mapped_file_data_ != nullptr)
+    {
+        return mapped_file_eof_;
+    }
+
+    if (read_ahead_queue_ != nullptr)
+    {
+        return read_ahead_queue_->IsAtEnd();
+    }
+
+    return (feof(file_descriptor_) != 0);
+}
+
+bool FileProcessor::IsFileError() const
+{
+    if (mapped_file_data_ != nullptr)
+    {
+        // Errors reading mapped memory are reported through signals rather than an error indicator.
+        return false;
+    }
+
+    if (read_ahead_queue_ != nullptr)
+    {
+        return read_ahead_queue_->IsError();
+    }
+
+    return (ferror(file_descriptor_) != 0);
+}
+
 bool FileProcessor::ProcessBlocks()
 {
     format::BlockHeader block_header;
@@ -391,7 +856,7 @@ bool FileProcessor::ProcessBlocks()
             }
             else
             {
-                if (!feof(file_descriptor_))
+                if (!IsFileAtEnd())
                 {
                     // No data has been read for the current block, so we don't use 'HandleBlockReadError' here, as it
                     // assumes that the block header has been successfully read and will print an incomplete block at
@@ -425,13 +890,43 @@ bool FileProcessor::ReadBlockHeader(format::BlockHeader* block_header)
     return success;
 }
 
+const uint8_t* FileProcessor::ReadBytesInPlace(size_t buffer_size)
+{
+    if (mapped_file_data_ != nullptr)
+    {
+        // Reference the block data directly from the mapped file instead of copying it.
+        return ReadMappedBytes(buffer_size);
+    }
+
+    if (read_ahead_queue_ != nullptr)
+    {
+        // Reference the block data directly from the read-ahead queue when it is not split across blocks.
+        return read_ahead_queue_->ReadBytesInPlace(buffer_size);
+    }
+
+    return nullptr;
+}
+
 bool FileProcessor::ReadParameterBuffer(size_t buffer_size)
 {
+    if (CanReadInPlace())
+    {
+        parameter_data_ = ReadBytesInPlace(buffer_size);
+
+        if (parameter_data_ != nullptr)
+        {
+            bytes_read_ += buffer_size;
+            return true;
+        }
+    }
+
     if (buffer_size > parameter_buffer_.size())
     {
         parameter_buffer_.resize(buffer_size);
     }
 
+    parameter_data_ = parameter_buffer_.data();
+
     return ReadBytes(parameter_buffer_.data(), buffer_size);
 }
 
@@ -458,6 +953,7 @@ bool FileProcessor::ReadCompressedParameterBuffer(size_t  compressed_buffer_size
             compressed_buffer_size, compressed_parameter_buffer_, expected_uncompressed_size, &parameter_buffer_);
         if ((0 < uncompressed_size) && (uncompressed_size == expected_uncompressed_size))
         {
+            parameter_data_           = parameter_buffer_.data();
             *uncompressed_buffer_size = uncompressed_size;
             return true;
         }
@@ -467,6 +963,29 @@ bool FileProcessor::ReadCompressedParameterBuffer(size_t  compressed_buffer_size
 
 bool FileProcessor::ReadBytes(void* buffer, size_t buffer_size)
 {
+    if (mapped_file_data_ != nullptr)
+    {
+        const uint8_t* data = ReadMappedBytes(buffer_size);
+
+        if (data != nullptr)
+        {
+            util::platform::MemoryCopy(buffer, buffer_size, data, buffer_size);
+            bytes_read_ += buffer_size;
+            return true;
+        }
+        return false;
+    }
+
+    if (read_ahead_queue_ != nullptr)
+    {
+        if (read_ahead_queue_->ReadBytes(buffer, buffer_size))
+        {
+            bytes_read_ += buffer_size;
+            return true;
+        }
+        return false;
+    }
+
     if (util::platform::FileRead(buffer, buffer_size, file_descriptor_))
     {
         bytes_read_ += buffer_size;
@@ -477,7 +996,20 @@ bool FileProcessor::ReadBytes(void* buffer, size_t buffer_size)
 
 bool FileProcessor::SkipBytes(size_t skip_size)
 {
-    bool success = util::platform::FileSeek(file_descriptor_, skip_size, util::platform::FileSeekCurrent);
+    bool success = false;
+
+    if (mapped_file_data_ != nullptr)
+    {
+        success = (ReadMappedBytes(skip_size) != nullptr);
+    }
+    else if (read_ahead_queue_ != nullptr)
+    {
+        success = read_ahead_queue_->SkipBytes(skip_size);
+    }
+    else
+    {
+        success = util::platform::FileSeek(file_descriptor_, skip_size, util::platform::FileSeekCurrent);
+    }
 
     if (success)
     {
@@ -491,7 +1023,7 @@ bool FileProcessor::SkipBytes(size_t skip_size)
 void FileProcessor::HandleBlockReadError(Error error_code, const char* error_message)
 {
     // Report incomplete block at end of file as a warning, other I/O errors as an error.
-    if (feof(file_descriptor_) && !ferror(file_descriptor_))
+    if (IsFileAtEnd() && !IsFileError())
     {
         GFXRECON_LOG_WARNING("Incomplete block at end of file");
     }
@@ -502,6 +1034,35 @@ void FileProcessor::HandleBlockReadError(Error error_code, const char* error_mes
     }
 }
 
+int64_t FileProcessor::BeginProfiledRead()
+{
+    if (replay_profiler_ != nullptr)
+    {
+        // Frame numbers are reported as 1-based, matching the trim and measurement range frame numbers.
+        replay_profiler_->SetFrame(current_frame_number_ + 1);
+        return util::datetime::GetTimestamp();
+    }
+
+    return 0;
+}
+
+void FileProcessor::BeginProfiledCall(int64_t read_start_time)
+{
+    if (replay_profiler_ != nullptr)
+    {
+        replay_profiler_->AddReadTime(util::datetime::DiffTimestamps(read_start_time, util::datetime::GetTimestamp()));
+        replay_profiler_->BeginCall();
+    }
+}
+
+void FileProcessor::EndProfiledCall(format::ApiCallId call_id)
+{
+    if (replay_profiler_ != nullptr)
+    {
+        replay_profiler_->EndCall(call_id);
+    }
+}
+
 bool FileProcessor::ProcessFunctionCall(const format::BlockHeader& block_header,
                                         format::ApiCallId          call_id,
                                         bool&                      should_break)
@@ -509,7 +1070,8 @@ bool FileProcessor::ProcessFunctionCall(const format::BlockHeader& block_header,
     size_t      parameter_buffer_size = static_cast<size_t>(block_header.size) - sizeof(call_id);
     uint64_t    uncompressed_size     = 0;
     ApiCallInfo call_info{ block_index_ };
-    bool        success = ReadBytes(&call_info.thread_id, sizeof(call_info.thread_id));
+    int64_t     read_start_time = BeginProfiledRead();
+    bool        success         = ReadBytes(&call_info.thread_id, sizeof(call_info.thread_id));
 
     if (success)
     {
@@ -557,16 +1119,22 @@ bool FileProcessor::ProcessFunctionCall(const format::BlockHeader& block_header,
 
         if (success)
         {
+            BeginProfiledCall(read_start_time);
+
+            call_info.compact_encoding = enabled_options_.compact_encoding;
+
             for (auto decoder : decoders_)
             {
                 if (decoder->SupportsApiCall(call_id))
                 {
                     DecodeAllocator::Begin();
                     decoder->SetCurrentApiCallId(call_id);
-                    decoder->DecodeFunctionCall(call_id, call_info, parameter_buffer_.data(), parameter_buffer_size);
+                    decoder->DecodeFunctionCall(call_id, call_info, parameter_data_, parameter_buffer_size);
                     DecodeAllocator::End();
                 }
             }
+
+            EndProfiledCall(call_id);
         }
     }
     else
@@ -593,6 +1161,7 @@ bool FileProcessor::ProcessMethodCall(const format::BlockHeader& block_header,
     uint64_t         uncompressed_size     = 0;
     format::HandleId object_id             = 0;
     ApiCallInfo      call_info{ block_index_ };
+    int64_t          read_start_time = BeginProfiledRead();
 
     bool success = ReadBytes(&object_id, sizeof(object_id));
     success      = success && ReadBytes(&call_info.thread_id, sizeof(call_info.thread_id));
@@ -643,6 +1212,10 @@ bool FileProcessor::ProcessMethodCall(const format::BlockHeader& block_header,
 
         if (success)
         {
+            BeginProfiledCall(read_start_time);
+
+            call_info.compact_encoding = enabled_options_.compact_encoding;
+
             for (auto decoder : decoders_)
             {
                 if (decoder->SupportsApiCall(call_id))
@@ -650,11 +1223,13 @@ bool FileProcessor::ProcessMethodCall(const format::BlockHeader& block_header,
                     DecodeAllocator::Begin();
                     decoder->SetCurrentApiCallId(call_id);
                     decoder->DecodeMethodCall(
-                        call_id, object_id, call_info, parameter_buffer_.data(), parameter_buffer_size);
+                        call_id, object_id, call_info, parameter_data_, parameter_buffer_size);
                     DecodeAllocator::End();
                 }
             }
 
+            EndProfiledCall(call_id);
+
             ++api_call_index_;
         }
     }
@@ -718,7 +1293,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                                                            header.memory_id,
                                                            header.memory_offset,
                                                            header.memory_size,
-                                                           parameter_buffer_.data());
+                                                           parameter_data_);
                     }
                 }
             }
@@ -740,6 +1315,101 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
             HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read fill memory meta-data block header");
         }
     }
+    else if (meta_data_type == format::MetaDataType::kContentDataCommand)
+    {
+        format::ContentDataCommandHeader header;
+
+        success = ReadBytes(&header.thread_id, sizeof(header.thread_id));
+        success = success && ReadBytes(&header.content_id, sizeof(header.content_id));
+        success = success && ReadBytes(&header.data_size, sizeof(header.data_size));
+
+        if (success)
+        {
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.data_size);
+
+            if (format::IsBlockCompressed(block_header.type))
+            {
+                size_t uncompressed_size = 0;
+                size_t compressed_size =
+                    static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(header));
+
+                success = ReadCompressedParameterBuffer(
+                    compressed_size, static_cast<size_t>(header.data_size), &uncompressed_size);
+            }
+            else
+            {
+                success = ReadParameterBuffer(static_cast<size_t>(header.data_size));
+            }
+
+            if (success)
+            {
+                // Content data is not dispatched to the decoders.  It is provided to them by the fill memory content
+                // blocks that reference it.
+                success = StoreContentData(block_header, header.content_id, static_cast<size_t>(header.data_size));
+            }
+            else
+            {
+                if (format::IsBlockCompressed(block_header.type))
+                {
+                    HandleBlockReadError(kErrorReadingCompressedBlockData,
+                                         "Failed to read content data meta-data block");
+                }
+                else
+                {
+                    HandleBlockReadError(kErrorReadingBlockData, "Failed to read content data meta-data block");
+                }
+            }
+        }
+        else
+        {
+            HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read content data meta-data block header");
+        }
+    }
+    else if (meta_data_type == format::MetaDataType::kFillMemoryContentCommand)
+    {
+        format::FillMemoryContentCommandHeader header;
+
+        success = ReadBytes(&header.thread_id, sizeof(header.thread_id));
+        success = success && ReadBytes(&header.memory_id, sizeof(header.memory_id));
+        success = success && ReadBytes(&header.memory_offset, sizeof(header.memory_offset));
+        success = success && ReadBytes(&header.memory_size, sizeof(header.memory_size));
+        success = success && ReadBytes(&header.content_id, sizeof(header.content_id));
+
+        if (success)
+        {
+            auto content = content_data_.find(header.content_id);
+
+            if ((content != content_data_.end()) && (content->second.size == header.memory_size))
+            {
+                for (auto decoder : decoders_)
+                {
+                    if (decoder->SupportsMetaDataId(meta_data_id))
+                    {
+                        decoder->DispatchFillMemoryCommand(header.thread_id,
+                                                           header.memory_id,
+                                                           header.memory_offset,
+                                                           header.memory_size,
+                                                           content->second.data);
+                    }
+                }
+            }
+            else
+            {
+                GFXRECON_LOG_ERROR("Fill memory content block references missing content ID %" PRIu64
+                                   " (frame %" PRIu64 " block %" PRIu64 ")",
+                                   header.content_id,
+                                   current_frame_number_,
+                                   block_index_);
+                error_state_ = kErrorReadingBlockData;
+                success      = false;
+            }
+        }
+        else
+        {
+            HandleBlockReadError(kErrorReadingBlockHeader,
+                                 "Failed to read fill memory content meta-data block header");
+        }
+    }
     else if (meta_data_type == format::MetaDataType::kFillMemoryResourceValueCommand)
     {
         format::FillMemoryResourceValueCommandHeader header;
@@ -771,7 +1441,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                 {
                     if (decoder->SupportsMetaDataId(meta_data_id))
                     {
-                        decoder->DispatchFillMemoryResourceValueCommand(header, parameter_buffer_.data());
+                        decoder->DispatchFillMemoryResourceValueCommand(header, parameter_data_);
                     }
                 }
             }
@@ -909,8 +1579,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
 
             if (success)
             {
-                auto        message_start = parameter_buffer_.begin();
-                std::string message(message_start, std::next(message_start, static_cast<size_t>(message_size)));
+                std::string message(reinterpret_cast<const char*>(parameter_data_), static_cast<size_t>(message_size));
 
                 for (auto decoder : decoders_)
                 {
@@ -1298,7 +1967,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                                                                             header.device_id,
                                                                             header.pipeline_id,
                                                                             static_cast<size_t>(header.data_size),
-                                                                            parameter_buffer_.data());
+                                                                            parameter_data_);
                 }
             }
         }
@@ -1386,6 +2055,8 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                         header.thread_id, header.device_id, header.max_resource_size, header.max_copy_size);
                 }
             }
+
+            StartStateSnapshotReadAhead();
         }
         else
         {
@@ -1411,6 +2082,8 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                     decoder->DispatchEndResourceInitCommand(header.thread_id, header.device_id);
                 }
             }
+
+            StopStateSnapshotReadAhead();
         }
         else
         {
@@ -1454,7 +2127,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                                                            header.device_id,
                                                            header.buffer_id,
                                                            header.data_size,
-                                                           parameter_buffer_.data());
+                                                           parameter_data_);
                     }
                 }
             }
@@ -1529,7 +2202,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                                                       header.aspect,
                                                       header.layout,
                                                       level_sizes,
-                                                      parameter_buffer_.data());
+                                                      parameter_data_);
                 }
             }
         }
@@ -1583,7 +2256,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                 {
                     if (decoder->SupportsMetaDataId(meta_data_id))
                     {
-                        decoder->DispatchInitSubresourceCommand(header, parameter_buffer_.data());
+                        decoder->DispatchInitSubresourceCommand(header, parameter_data_);
                     }
                 }
             }
@@ -1679,7 +2352,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                     if (decoder->SupportsMetaDataId(meta_data_id))
                     {
                         decoder->DispatchInitDx12AccelerationStructureCommand(
-                            header, geom_descs, parameter_buffer_.data());
+                            header, geom_descs, parameter_data_);
                     }
                 }
             }
@@ -1836,7 +2509,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
             return success;
         }
 
-        const char* env_string = (const char*)parameter_buffer_.data();
+        const char* env_string = (const char*)parameter_data_;
         for (auto decoder : decoders_)
         {
             decoder->DispatchSetEnvironmentVariablesCommand(header, env_string);
@@ -1980,15 +2653,14 @@ bool FileProcessor::ProcessAnnotation(const format::BlockHeader& block_header, f
             {
                 if (label_length > 0)
                 {
-                    auto label_start = parameter_buffer_.begin();
-                    label.assign(label_start, std::next(label_start, label_length));
+                    label.assign(reinterpret_cast<const char*>(parameter_data_), label_length);
                 }
 
                 if (data_length > 0)
                 {
-                    auto data_start = std::next(parameter_buffer_.begin(), label_length);
                     GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, data_length);
-                    data.assign(data_start, std::next(data_start, static_cast<size_t>(data_length)));
+                    data.assign(reinterpret_cast<const char*>(parameter_data_) + label_length,
+                                static_cast<size_t>(data_length));
                 }
 
                 assert(annotation_handler_ != nullptr);
@@ -2021,12 +2693,9 @@ bool FileProcessor::IsFrameDelimiter(format::ApiCallId call_id) const
     }
     else
     {
-        // This code is deprecated and no new API calls should be added. Instead, end of frame markers are used to track
-        // the file processor's frame count.
-        return ((call_id == format::ApiCallId::ApiCall_vkQueuePresentKHR) ||
-                (call_id == format::ApiCallId::ApiCall_vkFrameBoundaryANDROID) ||
-                (call_id == format::ApiCallId::ApiCall_IDXGISwapChain_Present) ||
-                (call_id == format::ApiCallId::ApiCall_IDXGISwapChain1_Present1));
+        // Frame ending API calls are deprecated. Instead, end of frame markers are used to track the file processor's
+        // frame count.
+        return format::FileIndex::IsFrameDelimiterApiCall(call_id);
     }
 }
 
@@ -25,15 +25,20 @@
 #define GFXRECON_DECODE_FILE_PROCESSOR_H
 
 #include "format/api_call_id.h"
+#include "format/file_index.h"
 #include "format/format.h"
 #include "decode/annotation_handler.h"
 #include "decode/api_decoder.h"
+#include "decode/block_read_ahead_queue.h"
+#include "decode/replay_profiler.h"
 #include "util/compressor.h"
 #include "util/defines.h"
 
 #include <algorithm>
 #include <cstdio>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -76,6 +81,9 @@ class FileProcessor
 
     void SetAnnotationProcessor(AnnotationHandler* handler) { annotation_handler_ = handler; }
 
+    // When profiler is not null, the time spent reading and decoding each API call block is recorded by the profiler.
+    void SetReplayProfiler(ReplayProfiler* profiler) { replay_profiler_ = profiler; }
+
     void AddDecoder(ApiDecoder* decoder) { decoders_.push_back(decoder); }
 
     void RemoveDecoder(ApiDecoder* decoder)
@@ -83,6 +91,28 @@ class FileProcessor
         decoders_.erase(std::remove(decoders_.begin(), decoders_.end(), decoder), decoders_.end());
     }
 
+    // Memory mapped file access must be selected before calling Initialize.  When enabled, uncompressed block data
+    // is passed to the decoders directly from the mapped file, without an intermediate copy.  Falls back to regular
+    // file reads if the file cannot be mapped.
+    void SetUseMemoryMappedFile(bool enable) { use_memory_mapped_file_ = enable; }
+
+    bool IsFileMemoryMapped() const { return (mapped_file_data_ != nullptr); }
+
+    // Block read-ahead must be configured before calling Initialize.  When queue_depth is not zero, blocks are read
+    // from the file and decompressed by background threads, up to queue_depth blocks ahead of the block being
+    // processed.  When decompression_thread_count is zero, blocks are decompressed by the thread reading the file.
+    // Block read-ahead is not used for memory mapped files.
+    void SetBlockReadAhead(size_t queue_depth, size_t decompression_thread_count)
+    {
+        read_ahead_queue_depth_     = queue_depth;
+        decompression_thread_count_ = decompression_thread_count;
+    }
+
+    // When enabled and block read-ahead is not, the blocks of a state snapshot's resource initialization section are
+    // read from the file on a background thread, and decompressed by the decompression threads configured with
+    // SetBlockReadAhead, so that resource data is decompressed ahead of its upload.  Disabled by default.
+    void SetStateSnapshotReadAhead(bool enable) { enable_state_snapshot_read_ahead_ = enable; }
+
     bool Initialize(const std::string& filename);
 
     // Returns true if there are more frames to process, false if all frames have been processed or an error has
@@ -92,6 +122,25 @@ class FileProcessor
     // Returns false if processing failed.  Use GetErrorState() to determine error condition for failure case.
     bool ProcessAllFrames();
 
+    // Returns the index of frame and block locations for the capture file, which is loaded from the index file next
+    // to the capture file when it matches the capture file, and is otherwise built by reading the capture file's block
+    // headers.  Returns nullptr if the index could not be loaded or built.
+    const format::FileIndex* GetFileIndex();
+
+    // Uses an index that has already been loaded or built for the capture file, so that processors reading the same
+    // file do not each load or build their own.
+    void SetFileIndex(const format::FileIndex& file_index) { file_index_ = file_index; }
+
+    // Positions the file so that the next call to ProcessNextFrame() processes the specified frame.  Blocks preceding
+    // the frame are not processed, so decoders that depend on state from earlier frames will not have that state.  The
+    // content data blocks preceding the frame are read, so that the fill memory content blocks that reference them can
+    // be processed.
+    bool SeekToFrame(uint64_t frame_number);
+
+    // Positions the file so that the block with the specified index is the next block processed.  Content data blocks
+    // are read as they are for SeekToFrame().
+    bool SeekToBlock(uint64_t block_index);
+
     const format::FileHeader& GetFileHeader() const { return file_header_; }
 
     const std::vector<format::FileOptionPair>& GetFileOptions() const { return file_options_; }
@@ -102,7 +151,7 @@ class FileProcessor
 
     Error GetErrorState() const { return error_state_; }
 
-    bool EntireFileWasProcessed() const { return (feof(file_descriptor_) != 0); }
+    bool EntireFileWasProcessed() const { return IsFileAtEnd(); }
 
     bool UsesFrameMarkers() const { return capture_uses_frame_markers_; }
 
@@ -116,12 +165,45 @@ class FileProcessor
   protected:
     bool ContinueDecoding();
 
+    virtual bool ProcessBlocks();
+
     bool ReadBlockHeader(format::BlockHeader* block_header);
 
     virtual bool ReadBytes(void* buffer, size_t buffer_size);
 
     bool SkipBytes(size_t skip_size);
 
+    // Returns true if ReadParameterBuffer may reference block data in place, rather than copying it to
+    // parameter_buffer_.
+    virtual bool CanReadInPlace() const { return IsFileMemoryMapped() || (read_ahead_queue_ != nullptr); }
+
+    // Returns a pointer to the next buffer_size bytes of block data and advances the read position, or nullptr if the
+    // data cannot be referenced in place.  Only called when CanReadInPlace() returns true.
+    virtual const uint8_t* ReadBytesInPlace(size_t buffer_size);
+
+    bool ReadParameterBuffer(size_t buffer_size);
+
+    bool ReadCompressedParameterBuffer(size_t  compressed_buffer_size,
+                                       size_t  expected_uncompressed_size,
+                                       size_t* uncompressed_buffer_size);
+
+    // Returns the block data read by the last call to ReadParameterBuffer or ReadCompressedParameterBuffer.
+    const uint8_t* GetParameterData() const { return parameter_data_; }
+
+    // Returns the file index if it has already been loaded, built, or set, without loading or building it.
+    const format::FileIndex* GetLoadedFileIndex() const { return file_index_.IsEmpty() ? nullptr : &file_index_; }
+
+    bool IsFileAtEnd() const;
+
+    bool IsFileError() const;
+
+    // Returns the start time for the block read when a replay profiler is set.
+    int64_t BeginProfiledRead();
+
+    void BeginProfiledCall(int64_t read_start_time);
+
+    void EndProfiledCall(format::ApiCallId call_id);
+
     bool ProcessFunctionCall(const format::BlockHeader& block_header, format::ApiCallId call_id, bool& should_break);
 
     bool ProcessMethodCall(const format::BlockHeader& block_header, format::ApiCallId call_id, bool& should_break);
@@ -148,6 +230,7 @@ class FileProcessor
     uint64_t                 current_frame_number_;
     std::vector<ApiDecoder*> decoders_;
     AnnotationHandler*       annotation_handler_;
+    ReplayProfiler*          replay_profiler_;
     Error                    error_state_;
     uint64_t                 bytes_read_;
 
@@ -157,33 +240,86 @@ class FileProcessor
   private:
     bool ProcessFileHeader();
 
-    virtual bool ProcessBlocks();
+    void StartBlockReadAhead();
 
-    bool ReadParameterBuffer(size_t buffer_size);
+    // Starts reading the blocks of a state snapshot's resource initialization section on background threads, when
+    // state snapshot read-ahead is enabled and block read-ahead is not.
+    void StartStateSnapshotReadAhead();
 
-    bool ReadCompressedParameterBuffer(size_t  compressed_buffer_size,
-                                       size_t  expected_uncompressed_size,
-                                       size_t* uncompressed_buffer_size);
+    // Stops the state snapshot read-ahead started by StartStateSnapshotReadAhead() and repositions the file to the
+    // first block that was not processed.
+    void StopStateSnapshotReadAhead();
+
+    bool SeekToFileOffset(uint64_t offset);
+
+    bool SeekToIndexEntry(const format::FileIndexEntry& entry);
+
+    // Reads the indexed content data blocks that precede the specified block and have not already been read.  Leaves
+    // the file positioned at an arbitrary block, so must be followed by a seek.
+    bool LoadContentBlocks(uint64_t block_index);
+
+    // Skips the next block, updating the frame count if the block is a frame delimiter.
+    bool SkipBlock();
+
+    void MapFile(const std::string& filename);
+
+    void UnmapFile();
+
+    // Returns a pointer to the next read_size bytes of the mapped file and advances the read position, or nullptr if
+    // the remaining file data is smaller than read_size.
+    const uint8_t* ReadMappedBytes(size_t read_size);
 
     bool IsFileHeaderValid() const { return (file_header_.fourcc == GFXRECON_FOURCC); }
 
-    bool IsFileValid() const { return (file_descriptor_ && !feof(file_descriptor_) && !ferror(file_descriptor_)); }
+    bool IsFileValid() const { return (file_descriptor_ && !IsFileAtEnd() && !IsFileError()); }
+
+    // Stores the data of the content data block that was just read, returning false if the copied data would exceed
+    // the content deduplication limit of the file.
+    bool StoreContentData(const format::BlockHeader& block_header, uint64_t content_id, size_t data_size);
+
+  private:
+    // Data from a content data block.  Uncompressed blocks of memory mapped files are referenced in place, and other
+    // blocks are copied.
+    struct ContentData
+    {
+        std::vector<uint8_t> copy;
+        const uint8_t*       data{ nullptr };
+        size_t               size{ 0 };
+    };
 
   private:
-    std::string                         filename_;
-    format::FileHeader                  file_header_;
-    std::vector<format::FileOptionPair> file_options_;
-    format::EnabledOptions              enabled_options_;
-    std::vector<uint8_t>                parameter_buffer_;
-    std::vector<uint8_t>                compressed_parameter_buffer_;
-    util::Compressor*                   compressor_;
-    uint64_t                            api_call_index_;
-    uint64_t                            block_limit_;
-    bool                                capture_uses_frame_markers_;
-    uint64_t                            first_frame_;
-    bool                                enable_print_block_info_{ false };
-    int64_t                             block_index_from_{ 0 };
-    int64_t                             block_index_to_{ 0 };
+    std::string                          filename_;
+    format::FileHeader                   file_header_;
+    std::vector<format::FileOptionPair>  file_options_;
+    format::EnabledOptions               enabled_options_;
+    std::vector<uint8_t>                 parameter_buffer_;
+    const uint8_t*                       parameter_data_;
+    std::vector<uint8_t>                 compressed_parameter_buffer_;
+    util::Compressor*                    compressor_;
+    uint64_t                             api_call_index_;
+    uint64_t                             block_limit_;
+    bool                                 capture_uses_frame_markers_;
+    uint64_t                             first_frame_;
+    bool                                 enable_print_block_info_{ false };
+    int64_t                              block_index_from_{ 0 };
+    int64_t                              block_index_to_{ 0 };
+    bool                                 use_memory_mapped_file_{ false };
+    const uint8_t*                       mapped_file_data_{ nullptr };
+    size_t                               mapped_file_size_{ 0 };
+    size_t                               mapped_file_offset_{ 0 };
+    size_t                               mapped_file_advise_offset_{ 0 };
+    bool                                 mapped_file_eof_{ false };
+    size_t                               read_ahead_queue_depth_{ 0 };
+    size_t                               decompression_thread_count_{ 0 };
+    std::unique_ptr<BlockReadAheadQueue> read_ahead_queue_;
+    bool                                 enable_state_snapshot_read_ahead_{ false };
+    bool                                 state_snapshot_read_ahead_{ false };
+    format::FileIndex                    file_index_;
+
+    // Data from content data blocks, which is kept for the fill memory content blocks that reference it.  The total
+    // size of the copied data is limited to the size declared by the file's content deduplication option.
+    std::unordered_map<uint64_t, ContentData> content_data_;
+    uint64_t                                  content_data_copy_size_{ 0 };
 };
 
 GFXRECON_END_NAMESPACE(decode)
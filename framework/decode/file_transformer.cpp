@@ -139,6 +139,9 @@ bool FileTransformer::Process()
         block_index_++;
     }
 
+    // Pending output is written even when processing stopped at an error.
+    FlushOutput();
+
     if (!success && (error_state_ == kErrorNone))
     {
         // If a failure occured, but no error code was set, check for a file error.
@@ -184,6 +187,12 @@ bool FileTransformer::ProcessFileHeader()
                         case format::FileOption::kCompressionType:
                             enabled_options_.compression_type = static_cast<format::CompressionType>(option.value);
                             break;
+                        case format::FileOption::kContentDeduplication:
+                            enabled_options_.content_deduplication_limit = option.value;
+                            break;
+                        case format::FileOption::kCompactEncoding:
+                            enabled_options_.compact_encoding = (option.value != 0);
+                            break;
                         default:
                             GFXRECON_LOG_WARNING("Ignoring unrecognized file header option %u", option.key);
                             break;
@@ -459,13 +468,15 @@ void FileTransformer::HandleBlockCopyError(Error error_code, const char* error_m
     }
 }
 
-bool FileTransformer::CreateCompressor(format::CompressionType type, std::unique_ptr<util::Compressor>* compressor)
+bool FileTransformer::CreateCompressor(format::CompressionType            type,
+                                       std::unique_ptr<util::Compressor>* compressor,
+                                       int32_t                            compression_level)
 {
     assert(compressor != nullptr);
 
     if (type != format::CompressionType::kNone)
     {
-        (*compressor) = std::unique_ptr<util::Compressor>(format::CreateCompressor(type));
+        (*compressor) = std::unique_ptr<util::Compressor>(format::CreateCompressor(type, compression_level));
 
         if ((*compressor) == nullptr)
         {
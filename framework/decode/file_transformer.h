@@ -111,7 +111,8 @@ class FileTransformer
 
     bool ReadBytes(void* buffer, size_t buffer_size);
 
-    bool WriteBytes(const void* buffer, size_t buffer_size);
+    // Derived classes that write the output file from other threads override this to order the data.
+    virtual bool WriteBytes(const void* buffer, size_t buffer_size);
 
     bool SkipBytes(uint64_t skip_size);
 
@@ -123,7 +124,9 @@ class FileTransformer
 
     void HandleBlockCopyError(Error error_code, const char* error_message);
 
-    bool CreateCompressor(format::CompressionType type, std::unique_ptr<util::Compressor>* compressor);
+    bool CreateCompressor(format::CompressionType            type,
+                          std::unique_ptr<util::Compressor>* compressor,
+                          int32_t                            compression_level = util::kDefaultCompressionLevel);
 
     virtual bool WriteFileHeader(const format::FileHeader& header, const std::vector<format::FileOptionPair>& options);
 
@@ -136,6 +139,10 @@ class FileTransformer
 
     virtual bool ProcessStateMarker(const format::BlockHeader& block_header, format::MarkerType marker_type);
 
+    // Called after the last block has been processed, to write any output that is still pending.  Failures are
+    // reported through the error state.
+    virtual void FlushOutput() {}
+
     uint64_t GetCurrentBlockIndex() { return block_index_; }
 
   private:
@@ -0,0 +1,263 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_HANDLE_INFO_TABLE_H
+#define GFXRECON_DECODE_HANDLE_INFO_TABLE_H
+
+#include "format/format.h"
+#include "util/defines.h"
+
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+enum class HandleTableType
+{
+    // Capture IDs index pages of entries, which avoids hashing for the monotonically increasing IDs assigned by the
+    // capture layer.  IDs that are too large for the pages are stored in a hash table.
+    kDense,
+    // All entries are stored in a hash table.
+    kSparse
+};
+
+// Sets the type of the handle info tables that are created after the call.
+void SetHandleTableType(HandleTableType type);
+
+HandleTableType GetHandleTableType();
+
+// Stores object info structures by capture ID.  Entry addresses remain valid until the entry is erased.
+template <typename T>
+class HandleInfoTable
+{
+  public:
+    typedef std::pair<const format::HandleId, T> value_type;
+
+    // IDs at or above this value are stored in the hash table by dense tables.
+    static const format::HandleId kMaxDenseId = format::HandleId{ 1 } << 26;
+
+  private:
+    static const size_t kPageBits = 10;
+    static const size_t kPageSize = size_t{ 1 } << kPageBits;
+
+    typedef std::unique_ptr<value_type>                    EntryPtr;
+    typedef std::unique_ptr<EntryPtr[]>                    Page;
+    typedef std::unordered_map<format::HandleId, EntryPtr> SparseMap;
+
+    template <bool IsConst>
+    class Iterator
+    {
+      public:
+        typedef std::forward_iterator_tag                                             iterator_category;
+        typedef typename HandleInfoTable::value_type                                  value_type;
+        typedef std::ptrdiff_t                                                        difference_type;
+        typedef std::conditional_t<IsConst, const value_type*, value_type*>           pointer;
+        typedef std::conditional_t<IsConst, const value_type&, value_type&>           reference;
+        typedef std::conditional_t<IsConst, const HandleInfoTable*, HandleInfoTable*> TablePtr;
+        typedef std::conditional_t<IsConst, typename SparseMap::const_iterator, typename SparseMap::iterator>
+            SparseIterator;
+
+        Iterator(TablePtr table, size_t page, size_t slot, SparseIterator sparse_iter) :
+            table_(table), page_(page), slot_(slot), sparse_iter_(sparse_iter)
+        {
+            SkipEmptySlots();
+        }
+
+        reference operator*() const { return *operator->(); }
+
+        pointer operator->() const
+        {
+            return (page_ < table_->pages_.size()) ? table_->pages_[page_][slot_].get() : sparse_iter_->second.get();
+        }
+
+        Iterator& operator++()
+        {
+            if (page_ < table_->pages_.size())
+            {
+                ++slot_;
+                SkipEmptySlots();
+            }
+            else
+            {
+                ++sparse_iter_;
+            }
+
+            return *this;
+        }
+
+        bool operator==(const Iterator& other) const
+        {
+            return (page_ == other.page_) && (slot_ == other.slot_) && (sparse_iter_ == other.sparse_iter_);
+        }
+
+        bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+      private:
+        void SkipEmptySlots()
+        {
+            while (page_ < table_->pages_.size())
+            {
+                const auto& page = table_->pages_[page_];
+                if (page != nullptr)
+                {
+                    for (; slot_ < kPageSize; ++slot_)
+                    {
+                        if (page[slot_] != nullptr)
+                        {
+                            return;
+                        }
+                    }
+                }
+
+                ++page_;
+                slot_ = 0;
+            }
+        }
+
+      private:
+        TablePtr       table_;
+        size_t         page_;
+        size_t         slot_;
+        SparseIterator sparse_iter_;
+    };
+
+  public:
+    typedef Iterator<false> iterator;
+    typedef Iterator<true>  const_iterator;
+
+  public:
+    HandleInfoTable() : dense_(GetHandleTableType() == HandleTableType::kDense), size_(0) {}
+
+    // Adds an entry for the ID, returning the entry and true when the ID was not already in the table.  Returns the
+    // existing entry and false when the ID was already in the table.
+    std::pair<value_type*, bool> Emplace(format::HandleId id, T&& info)
+    {
+        EntryPtr* slot = FindSlot(id, true);
+
+        if (*slot != nullptr)
+        {
+            return std::make_pair(slot->get(), false);
+        }
+
+        *slot = std::make_unique<value_type>(id, std::forward<T>(info));
+        ++size_;
+
+        return std::make_pair(slot->get(), true);
+    }
+
+    T* Find(format::HandleId id)
+    {
+        EntryPtr* slot = FindSlot(id, false);
+        return ((slot != nullptr) && (*slot != nullptr)) ? &(*slot)->second : nullptr;
+    }
+
+    const T* Find(format::HandleId id) const { return const_cast<HandleInfoTable*>(this)->Find(id); }
+
+    void erase(format::HandleId id)
+    {
+        if (IsDenseId(id))
+        {
+            EntryPtr* slot = FindSlot(id, false);
+            if ((slot != nullptr) && (*slot != nullptr))
+            {
+                slot->reset();
+                --size_;
+            }
+        }
+        else
+        {
+            size_ -= sparse_map_.erase(id);
+        }
+    }
+
+    size_t size() const { return size_; }
+
+    bool empty() const { return size_ == 0; }
+
+    iterator begin() { return iterator(this, 0, 0, sparse_map_.begin()); }
+
+    iterator end() { return iterator(this, pages_.size(), 0, sparse_map_.end()); }
+
+    const_iterator begin() const { return const_iterator(this, 0, 0, sparse_map_.begin()); }
+
+    const_iterator end() const { return const_iterator(this, pages_.size(), 0, sparse_map_.end()); }
+
+  private:
+    bool IsDenseId(format::HandleId id) const { return dense_ && (id < kMaxDenseId); }
+
+    EntryPtr* FindSlot(format::HandleId id, bool create)
+    {
+        if (IsDenseId(id))
+        {
+            const size_t page_index = static_cast<size_t>(id >> kPageBits);
+
+            if (page_index >= pages_.size())
+            {
+                if (!create)
+                {
+                    return nullptr;
+                }
+
+                pages_.resize(page_index + 1);
+            }
+
+            Page& page = pages_[page_index];
+
+            if (page == nullptr)
+            {
+                if (!create)
+                {
+                    return nullptr;
+                }
+
+                page = std::make_unique<EntryPtr[]>(kPageSize);
+            }
+
+            return &page[id & (kPageSize - 1)];
+        }
+        else if (create)
+        {
+            return &sparse_map_[id];
+        }
+        else
+        {
+            auto entry = sparse_map_.find(id);
+            return (entry != sparse_map_.end()) ? &entry->second : nullptr;
+        }
+    }
+
+  private:
+    const bool        dense_;
+    std::vector<Page> pages_;
+    SparseMap         sparse_map_;
+    size_t            size_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_HANDLE_INFO_TABLE_H
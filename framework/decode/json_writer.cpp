@@ -32,10 +32,14 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+// Streamed text is handed to the output stream once it reaches this size, so that blocks are written in large writes
+// without holding more than one large block in memory.
+static constexpr size_t kStreamWriteSize = 64 * 1024;
+
 JsonWriter::JsonWriter(const util::JsonOptions& options,
                        const std::string_view   gfxrVersion,
                        const std::string_view   inputFilepath) :
-    json_options_(options)
+    json_options_(options), stream_(options.format == util::JsonFormat::JSONL ? -1 : util::kJsonIndentWidth)
 {
     header_["source-path"]      = inputFilepath;
     header_["gfxrecon-version"] = std::string(gfxrVersion);
@@ -45,6 +49,7 @@ JsonWriter::~JsonWriter()
 {
     if (os_)
     {
+        WriteBuffer();
         os_->Flush();
     }
 }
@@ -57,13 +62,15 @@ void JsonWriter::StartStream(util::OutputStream* os)
 
     if (json_options_.format == util::JsonFormat::JSON)
     {
-        Write(*os_, "[\n");
+        stream_.WriteRaw("[\n");
     }
 
     // Emit the header object as the first line of the file:
-    WriteBlockStart();
-    json_data_["header"] = header_;
-    WriteBlockEnd();
+    BeginBlock();
+    stream_.BeginObject();
+    stream_.Key("header");
+    stream_.Value(header_);
+    EndBlock();
 
     ++num_streams_;
 }
@@ -74,12 +81,13 @@ void JsonWriter::EndStream()
     {
         if (json_options_.format == util::JsonFormat::JSON)
         {
-            Write(*os_, "\n]\n");
+            stream_.WriteRaw("\n]\n");
         }
         else
         {
-            Write(*os_, "\n");
+            stream_.WriteRaw("\n");
         }
+        WriteBuffer();
         os_->Flush();
         os_ = nullptr;
     }
@@ -97,38 +105,42 @@ bool JsonWriter::IsValid() const
 
 nlohmann::ordered_json& JsonWriter::WriteBlockStart()
 {
-    // Dominates profiling (1/2):
-    json_data_.clear();
+    BeginBlock();
+    ClearBlockJson();
+    json_data_is_members_ = false;
     return json_data_;
 }
 
 void JsonWriter::WriteBlockEnd()
 {
-    if (!first_)
+    if (json_data_is_members_)
     {
-        Write(*os_, json_options_.format == util::JsonFormat::JSONL ? "\n" : ",\n");
+        stream_.Members(json_data_);
     }
-    first_ = false;
-    /// @todo Hand the tree over to a backend thread which dumps it to a string and streams it
-    /// while the main thread gets on with building the tree for the next block.
-    // Dominates profiling (2/2):
-    const std::string block =
-        json_data_.dump(json_options_.format == util::JsonFormat::JSONL ? -1 : util::kJsonIndentWidth);
-    Write(*os_, block);
-    os_->Flush();
+    else
+    {
+        stream_.Value(json_data_);
+    }
+
+    EndBlock();
 }
 
 nlohmann::ordered_json& JsonWriter::WriteApiCallStart(const ApiCallInfo& call_info, const std::string_view command_name)
 {
-    auto& json_data = WriteBlockStart();
+    BeginBlock();
 
-    json_data[format::kNameIndex] = call_info.index;
+    stream_.BeginObject();
+    stream_.Key(format::kNameIndex);
+    stream_.UInt(call_info.index);
 
-    nlohmann::ordered_json& function = json_data[format::kNameFunction];
-    function[format::kNameName]      = command_name;
-    function[format::kNameThread]    = call_info.thread_id;
+    stream_.Key(format::kNameFunction);
+    stream_.BeginObject();
+    stream_.Key(format::kNameName);
+    stream_.String(command_name);
+    stream_.Key(format::kNameThread);
+    stream_.UInt(call_info.thread_id);
 
-    return function;
+    return StartBlockMembers();
 }
 
 nlohmann::ordered_json& JsonWriter::WriteApiCallStart(const ApiCallInfo&     call_info,
@@ -136,19 +148,29 @@ nlohmann::ordered_json& JsonWriter::WriteApiCallStart(const ApiCallInfo&     cal
                                                       const format::HandleId object_id,
                                                       const std::string_view command_name)
 {
-    auto& json_data = WriteBlockStart();
-
-    json_data[format::kNameIndex] = call_info.index;
-
-    nlohmann::ordered_json& method = json_data[format::kNameMethod];
-    method[format::kNameName]      = command_name;
-    method[format::kNameThread]    = call_info.thread_id;
-
-    nlohmann::ordered_json& object  = method[format::kNameObject];
-    object[format::kNameObjectType] = object_type;
-    FieldToJson(object[format::kNameObjectHandle], object_id, GetOptions());
-
-    return method;
+    BeginBlock();
+
+    stream_.BeginObject();
+    stream_.Key(format::kNameIndex);
+    stream_.UInt(call_info.index);
+
+    stream_.Key(format::kNameMethod);
+    stream_.BeginObject();
+    stream_.Key(format::kNameName);
+    stream_.String(command_name);
+    stream_.Key(format::kNameThread);
+    stream_.UInt(call_info.thread_id);
+
+    stream_.Key(format::kNameObject);
+    stream_.BeginObject();
+    stream_.Key(format::kNameObjectType);
+    stream_.String(object_type);
+    stream_.Key(format::kNameObjectHandle);
+    FieldToJson(field_json_, object_id, GetOptions());
+    stream_.Value(field_json_);
+    stream_.EndObject();
+
+    return StartBlockMembers();
 }
 
 void JsonWriter::WriteMarker(const char* const name, const std::string_view marker_type, uint64_t frame_number)
@@ -157,13 +179,17 @@ void JsonWriter::WriteMarker(const char* const name, const std::string_view mark
     // output in case the build has multiple JSON consumers for different APIs enabled.
     if (frame_number != last_frame_number_ || name != last_marker_name_ || marker_type != last_marker_type_)
     {
-        auto& json_data = WriteBlockStart();
+        BeginBlock();
 
-        nlohmann::ordered_json& state = json_data[name];
-        state["marker_type"]          = marker_type;
-        state["frame_number"]         = frame_number;
+        stream_.BeginObject();
+        stream_.Key(name);
+        stream_.BeginObject();
+        stream_.Key("marker_type");
+        stream_.String(marker_type);
+        stream_.Key("frame_number");
+        stream_.UInt(frame_number);
 
-        WriteBlockEnd();
+        EndBlock();
 
         last_marker_name_  = name;
         last_marker_type_  = marker_type;
@@ -173,12 +199,22 @@ void JsonWriter::WriteMarker(const char* const name, const std::string_view mark
 
 nlohmann::ordered_json& JsonWriter::WriteMetaCommandStart(const std::string_view command_name)
 {
-    auto& json_data = WriteBlockStart();
+    BeginBlock();
+
+    stream_.BeginObject();
+    stream_.Key(format::kNameIndex);
+    stream_.UInt(block_index_);
+
+    stream_.Key(format::kNameMeta);
+    stream_.BeginObject();
+    stream_.Key(format::kNameName);
+    stream_.String(command_name);
+    stream_.Key(format::kNameArgs);
 
-    json_data[format::kNameIndex] = block_index_;
-    nlohmann::ordered_json& meta = json_data[format::kNameMeta];
-    meta[format::kNameName]      = command_name;
-    return meta[format::kNameArgs];
+    json_data_            = nullptr;
+    json_data_is_members_ = false;
+
+    return json_data_;
 }
 
 void JsonWriter::ProcessAnnotation(uint64_t               block_index,
@@ -186,19 +222,82 @@ void JsonWriter::ProcessAnnotation(uint64_t               block_index,
                                    const std::string&     label,
                                    const std::string&     data)
 {
-    auto& json_data     = WriteBlockStart();
-    json_data["index"]  = block_index;
-    auto& annotation    = json_data["annotation"];
-    annotation["type"]  = util::AnnotationTypeToString(type);
-    annotation["label"] = label;
-    annotation["data"]  = data;
-    WriteBlockEnd();
+    BeginBlock();
+
+    stream_.BeginObject();
+    stream_.Key("index");
+    stream_.UInt(block_index);
+    stream_.Key("annotation");
+    stream_.BeginObject();
+    stream_.Key("type");
+    stream_.String(util::AnnotationTypeToString(type));
+    stream_.Key("label");
+    stream_.String(label);
+    stream_.Key("data");
+    stream_.String(data);
+
+    EndBlock();
+}
+
+void JsonWriter::BeginBlock()
+{
+    GFXRECON_ASSERT(stream_.GetDepth() == 0);
+
+    if (!first_)
+    {
+        stream_.WriteRaw(json_options_.format == util::JsonFormat::JSONL ? "\n" : ",\n");
+    }
+    first_ = false;
+}
+
+nlohmann::ordered_json& JsonWriter::StartBlockMembers()
+{
+    ClearBlockJson();
+    json_data_is_members_ = true;
+    return json_data_;
+}
+
+void JsonWriter::ClearBlockJson()
+{
+    // Clearing an object keeps the storage of the previous block's members for reuse.
+    if (json_data_.is_object())
+    {
+        json_data_.clear();
+    }
+    else
+    {
+        json_data_ = nlohmann::ordered_json::object();
+    }
+}
+
+void JsonWriter::EndBlock()
+{
+    while (stream_.GetDepth() > 0)
+    {
+        stream_.EndObject();
+    }
+
+    if (stream_.GetBuffer().size() >= kStreamWriteSize)
+    {
+        WriteBuffer();
+    }
+}
+
+void JsonWriter::WriteBuffer()
+{
+    GFXRECON_ASSERT(os_ != nullptr);
+
+    if (!stream_.GetBuffer().empty())
+    {
+        Write(*os_, stream_.GetBuffer());
+        stream_.ClearBuffer();
+    }
 }
 
 std::string JsonWriter::GenerateFilename(const std::string_view filename)
 {
     num_files_++;
-    return std::to_string(num_files_).append("_").append(filename);
+    return std::string(filename_prefix_).append(std::to_string(num_files_)).append("_").append(filename);
 }
 
 bool JsonWriter::WriteBinaryFile(const std::string& filename, uint64_t data_size, const uint8_t* data)
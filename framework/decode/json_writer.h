@@ -28,6 +28,7 @@
 #define GFXRECON_DECODE_JSON_WRITER_H
 
 #include "annotation_handler.h"
+#include "util/json_stream_writer.h"
 #include "util/json_util.h"
 #include "util/platform.h"
 #include "util/defines.h"
@@ -44,6 +45,12 @@ GFXRECON_BEGIN_NAMESPACE(decode)
 struct ApiCallInfo;
 
 /// Manages writing
+///
+/// The fixed parts of each block, such as the index and name of a call, are
+/// streamed straight into a reusable buffer which is handed to the output stream
+/// in large writes. Only the parts that consumers populate are built as trees,
+/// but the generated consumers still build a tree for the arguments of every
+/// call, so most of the per-call cost of building trees remains.
 class JsonWriter : public AnnotationHandler
 {
   public:
@@ -67,16 +74,16 @@ class JsonWriter : public AnnotationHandler
     /// Finalise the current block and stream it out.
     void WriteBlockEnd();
 
-    /// Start the JSON tree for a function call, building the top-level object
-    /// with index and function fields, adding name and thread to the function.
-    /// @return The "function" object field for the caller to populate further
-    /// with return value if any and arguments.
+    /// Start a function call, streaming the top-level object with index and
+    /// function fields, adding name and thread to the function.
+    /// @return A tree for the caller to populate with the remaining fields of
+    /// the "function" object, the return value if any and the arguments.
     nlohmann::ordered_json& WriteApiCallStart(const ApiCallInfo& call_info, const std::string_view command_name);
 
-    /// Start the JSON tree for a method call, building the top-level object
-    /// with index and function fields, adding name and thread to the function.
-    /// @return The "method" object field for the caller to populate further
-    /// with return value if any and arguments.
+    /// Start a method call, streaming the top-level object with index and
+    /// method fields, adding name, thread, and object to the method.
+    /// @return A tree for the caller to populate with the remaining fields of
+    /// the "method" object, the return value if any and the arguments.
     nlohmann::ordered_json& WriteApiCallStart(const ApiCallInfo&     call_info,
                                               const std::string_view object_type,
                                               const format::HandleId object_id,
@@ -85,16 +92,22 @@ class JsonWriter : public AnnotationHandler
     void WriteMarker(const char* name, const std::string_view marker_type, uint64_t frame_number);
 
     /// @brief Output the boilerplate for representing a metadata block in JSON,
-    /// returning the root of the empty "args" JSON sub-tree for the caller to populate.
+    /// returning an empty tree for the caller to populate as the value of "args".
     nlohmann::ordered_json& WriteMetaCommandStart(const std::string_view command_name);
 
     /// Get the JSON object used to output the per-stream header
     /// Consumers can add their own fields to it.
     nlohmann::ordered_json& GetHeaderJson() { return header_; }
 
-    /// Get the root of the JSON tree for the current block.
+    /// Get the tree being built for the current block.
     nlohmann::ordered_json& GetBlockJson() { return json_data_; }
 
+    /// Get the writer that the current block is streamed to. Between
+    /// WriteApiCallStart() and WriteBlockEnd(), members written to it are added
+    /// to the call's object ahead of those in the returned tree, so consumers
+    /// can stream fields rather than building them as a tree.
+    util::JsonStreamWriter& GetStreamWriter() { return stream_; }
+
     const util::JsonOptions& GetOptions() const { return json_options_; }
 
     uint32_t GetNumStreams() const { return num_streams_; }
@@ -108,17 +121,48 @@ class JsonWriter : public AnnotationHandler
     std::string GenerateFilename(const std::string_view filename);
     bool        WriteBinaryFile(const std::string& filename, uint64_t data_size, const uint8_t* data);
 
+    /// Set a prefix for the names returned by GenerateFilename() and restart
+    /// their numbering, so that writers sharing a directory generate distinct
+    /// names that do not depend on the order in which they run.
+    void SetFilenamePrefix(const std::string_view prefix)
+    {
+        filename_prefix_ = prefix;
+        num_files_       = 0;
+    }
+
     inline void SetCurrentBlockIndex(uint64_t block_index) { block_index_ = block_index; }
 
   private:
-    util::OutputStream*    os_;
+    /// Write the separator that precedes each block after the first.
+    void BeginBlock();
+
+    /// Prepare json_data_ for the caller to add members to the innermost
+    /// streamed object.
+    nlohmann::ordered_json& StartBlockMembers();
+
+    /// Make json_data_ an empty object.
+    void ClearBlockJson();
+
+    /// Close the objects left open by the block and hand the buffer to the
+    /// output stream once it has grown large enough.
+    void EndBlock();
+
+    void WriteBuffer();
+
+  private:
+    util::OutputStream*    os_{ nullptr };
     nlohmann::ordered_json header_;
     util::JsonOptions      json_options_;
+    util::JsonStreamWriter stream_;
     nlohmann::ordered_json json_data_;
-    uint64_t               block_index_;
+    /// Scratch value for fields which are formatted by FieldToJson().
+    nlohmann::ordered_json field_json_;
+    uint64_t               block_index_{ 0 };
     uint32_t               num_streams_{ 0 };
     /// Number of side-files generated for dumping binary blobs etc.
     uint32_t num_files_{ 0 };
+    /// Prefix for the names of side-files, set by SetFilenamePrefix().
+    std::string filename_prefix_;
 
     // Account for markers being broadcast to all decoders, all consumers, unlike functions and metadata blocks which
     // are tagged with an API family. A marker is only converted if it differs in one of these three attributes.
@@ -127,6 +171,10 @@ class JsonWriter : public AnnotationHandler
     uint64_t    last_frame_number_{ 0 };
 
     bool first_{ true };
+
+    /// Whether json_data_ holds the remaining members of the innermost object
+    /// streamed for the current block, rather than a value to stream whole.
+    bool json_data_is_members_{ false };
 };
 
 /// Either write the binary data to a file, and put the filename in the tree or
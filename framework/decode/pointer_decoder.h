@@ -31,8 +31,11 @@
 #include "util/defines.h"
 #include "util/logging.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <memory>
+#include <type_traits>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
@@ -41,10 +44,28 @@ template <typename T, typename OutputT = T>
 class PointerDecoder : public PointerDecoderBase
 {
   public:
-    PointerDecoder() : data_(nullptr), capacity_(0), is_memory_external_(false), output_len_(0) {}
+    PointerDecoder() :
+        data_(nullptr), capacity_(0), is_memory_external_(false), is_parameter_data_(false), output_len_(0)
+    {}
 
-    T* GetPointer() { return data_; }
+    // Returns data that the caller may modify. Data that references the parameter buffer, which may be a read-only
+    // mapping of the capture file, is copied to a decode allocation first.
+    T* GetPointer()
+    {
+        if (is_parameter_data_)
+        {
+            size_t len  = GetLength();
+            T*     data = DecodeAllocator::Allocate<T>(len, false);
+            std::copy(data_, data_ + len, data);
+
+            data_              = data;
+            is_parameter_data_ = false;
+        }
+
+        return data_;
+    }
 
+    // Returns data for read-only access, which may reference the parameter buffer.
     const T* GetPointer() const { return data_; }
 
     size_t GetOutputLength() const { return output_len_; }
@@ -112,37 +133,39 @@ class PointerDecoder : public PointerDecoderBase
     }
 
     // clang-format off
-    size_t DecodeInt8(const uint8_t* buffer, size_t buffer_size)         { return DecodeFrom<int8_t>(buffer, buffer_size); }
-    size_t DecodeInt16(const uint8_t* buffer, size_t buffer_size)        { return DecodeFrom<int16_t>(buffer, buffer_size); }
-    size_t DecodeUInt16(const uint8_t* buffer, size_t buffer_size)       { return DecodeFrom<uint16_t>(buffer, buffer_size); }
-    size_t DecodeInt32(const uint8_t* buffer, size_t buffer_size)        { return DecodeFrom<int32_t>(buffer, buffer_size); }
-    size_t DecodeUInt32(const uint8_t* buffer, size_t buffer_size)       { return DecodeFrom<uint32_t>(buffer, buffer_size); }
-    size_t DecodeInt64(const uint8_t* buffer, size_t buffer_size)        { return DecodeFrom<int64_t>(buffer, buffer_size); }
-    size_t DecodeUInt64(const uint8_t* buffer, size_t buffer_size)       { return DecodeFrom<uint64_t>(buffer, buffer_size); }
-    size_t DecodeFloat(const uint8_t* buffer, size_t buffer_size)        { return DecodeFrom<float>(buffer, buffer_size); }
+    size_t DecodeInt8(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)            { return DecodeFrom<int8_t>(buffer, buffer_size, compact_encoding); }
+    size_t DecodeInt16(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)           { return DecodeFrom<int16_t>(buffer, buffer_size, compact_encoding); }
+    size_t DecodeUInt16(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)          { return DecodeFrom<uint16_t>(buffer, buffer_size, compact_encoding); }
+    size_t DecodeInt32(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)           { return DecodeFrom<int32_t>(buffer, buffer_size, compact_encoding); }
+    size_t DecodeUInt32(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)          { return DecodeFrom<uint32_t>(buffer, buffer_size, compact_encoding); }
+    size_t DecodeInt64(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)           { return DecodeFrom<int64_t>(buffer, buffer_size, compact_encoding); }
+    size_t DecodeUInt64(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)          { return DecodeFrom<uint64_t>(buffer, buffer_size, compact_encoding); }
+    size_t DecodeFloat(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)           { return DecodeFrom<float>(buffer, buffer_size, compact_encoding); }
 
     // Decode pointer to a void pointer, encoded with ParameterEncoder::EncodeVoidPtrPtr.
-    size_t DecodeVoidPtr(const uint8_t* buffer, size_t buffer_size)      { return DecodeFrom<format::AddressEncodeType>(buffer, buffer_size); }
+    size_t DecodeVoidPtr(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)         { return DecodeFrom<format::AddressEncodeType>(buffer, buffer_size, compact_encoding); }
 
     // Decode for array of bytes.
-    size_t DecodeUInt8(const uint8_t* buffer, size_t buffer_size)        { return DecodeFrom<uint8_t>(buffer, buffer_size); }
-    size_t DecodeVoid(const uint8_t* buffer, size_t buffer_size)         { return DecodeFrom<uint8_t>(buffer, buffer_size); }
+    size_t DecodeUInt8(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)           { return DecodeFrom<uint8_t>(buffer, buffer_size, compact_encoding); }
+    size_t DecodeVoid(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)            { return DecodeFrom<uint8_t>(buffer, buffer_size, compact_encoding); }
 
     // Decode for special types that may require conversion.
-    size_t DecodeEnum(const uint8_t* buffer, size_t buffer_size)            { return DecodeFrom<format::EnumEncodeType>(buffer, buffer_size); }
-    size_t DecodeFlags(const uint8_t* buffer, size_t buffer_size)           { return DecodeFrom<format::FlagsEncodeType>(buffer, buffer_size); }
-    size_t DecodeVkSampleMask(const uint8_t* buffer, size_t buffer_size)    { return DecodeFrom<format::SampleMaskEncodeType>(buffer, buffer_size); }
-    size_t DecodeHandleId(const uint8_t* buffer, size_t buffer_size)        { return DecodeFrom<format::HandleEncodeType>(buffer, buffer_size); }
-    size_t DecodeVkDeviceSize(const uint8_t* buffer, size_t buffer_size)    { return DecodeFrom<format::DeviceSizeEncodeType>(buffer, buffer_size); }
-    size_t DecodeVkDeviceAddress(const uint8_t* buffer, size_t buffer_size) { return DecodeFrom<format::DeviceAddressEncodeType>(buffer, buffer_size); }
-    size_t DecodeSizeT(const uint8_t* buffer, size_t buffer_size)           { return DecodeFrom<format::SizeTEncodeType>(buffer, buffer_size); }
+    size_t DecodeEnum(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)            { return DecodeFrom<format::EnumEncodeType>(buffer, buffer_size, compact_encoding); }
+    size_t DecodeFlags(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)           { return DecodeFrom<format::FlagsEncodeType>(buffer, buffer_size, compact_encoding); }
+    size_t DecodeVkSampleMask(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)    { return DecodeFrom<format::SampleMaskEncodeType>(buffer, buffer_size, compact_encoding); }
+    size_t DecodeHandleId(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)        { return DecodeFrom<format::HandleEncodeType, true>(buffer, buffer_size, compact_encoding); }
+    size_t DecodeVkDeviceSize(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)    { return DecodeFrom<format::DeviceSizeEncodeType>(buffer, buffer_size, compact_encoding); }
+    size_t DecodeVkDeviceAddress(const uint8_t* buffer, size_t buffer_size, bool compact_encoding) { return DecodeFrom<format::DeviceAddressEncodeType>(buffer, buffer_size, compact_encoding); }
+    size_t DecodeSizeT(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)           { return DecodeFrom<format::SizeTEncodeType>(buffer, buffer_size, compact_encoding); }
     // clang-format on
 
   private:
-    template <typename SrcT>
-    size_t DecodeFrom(const uint8_t* buffer, size_t buffer_size)
+    // Handle IDs are decoded with ValueDecoder::DecodeHandleIdArray when kHandleIds is true, because they are delta
+    // coded with compact encoding.
+    template <typename SrcT, bool kHandleIds = false>
+    size_t DecodeFrom(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)
     {
-        size_t bytes_read = DecodeAttributes(buffer, buffer_size);
+        size_t bytes_read = DecodeAttributes(buffer, buffer_size, compact_encoding);
 
         // We should not be decoding string arrays or structs.
         assert((GetAttributeMask() & (format::PointerAttributes::kIsString | format::PointerAttributes::kIsArray)) !=
@@ -155,19 +178,21 @@ class PointerDecoder : public PointerDecoderBase
         {
             if (!is_memory_external_)
             {
-                bytes_read += DecodeInternal<SrcT>((buffer + bytes_read), (buffer_size - bytes_read));
+                bytes_read += DecodeInternal<SrcT, kHandleIds>(
+                    (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding);
             }
             else
             {
-                bytes_read += DecodeExternal<SrcT>((buffer + bytes_read), (buffer_size - bytes_read));
+                bytes_read += DecodeExternal<SrcT, kHandleIds>(
+                    (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding);
             }
         }
 
         return bytes_read;
     }
 
-    template <typename SrcT>
-    size_t DecodeInternal(const uint8_t* buffer, size_t buffer_size)
+    template <typename SrcT, bool kHandleIds>
+    size_t DecodeInternal(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)
     {
         assert(data_ == nullptr);
 
@@ -176,8 +201,27 @@ class PointerDecoder : public PointerDecoderBase
 
         if (HasData())
         {
-            data_      = DecodeAllocator::Allocate<T>(len, false);
-            bytes_read = ValueDecoder::DecodeArrayFrom<SrcT>(buffer, buffer_size, data_, len);
+            if constexpr (kHandleIds)
+            {
+                if (compact_encoding)
+                {
+                    data_ = DecodeAllocator::Allocate<T>(len, false);
+                    return ValueDecoder::DecodeHandleIdArray(buffer, buffer_size, compact_encoding, data_, len);
+                }
+            }
+
+            data_ = GetParameterData<SrcT>(buffer, buffer_size, len);
+
+            if (data_ != nullptr)
+            {
+                bytes_read         = len * sizeof(SrcT);
+                is_parameter_data_ = true;
+            }
+            else
+            {
+                data_      = DecodeAllocator::Allocate<T>(len, false);
+                bytes_read = ValueDecoder::DecodeArrayFrom<SrcT>(buffer, buffer_size, data_, len);
+            }
         }
         else
         {
@@ -188,8 +232,35 @@ class PointerDecoder : public PointerDecoderBase
         return bytes_read;
     }
 
+    // Returns a pointer to the encoded array in the parameter buffer when its elements have the same size as T, so that
+    // they would be copied without conversion, and are suitably aligned for T. Returns nullptr when the array must be
+    // copied. The parameter buffer may be a read-only mapping of the capture file, so the referenced data is only
+    // exposed through the const GetPointer(), and is copied before the non-const GetPointer() returns it.
     template <typename SrcT>
-    size_t DecodeExternal(const uint8_t* buffer, size_t buffer_size)
+    typename std::enable_if<(sizeof(SrcT) == sizeof(T)) && std::is_trivially_copyable<T>::value, T*>::type
+    GetParameterData(const uint8_t* buffer, size_t buffer_size, size_t len) const
+    {
+        if ((len > 0) && (buffer_size >= (len * sizeof(SrcT))) &&
+            ((reinterpret_cast<uintptr_t>(buffer) % alignof(T)) == 0) && DecodeAllocator::CanReferenceParameterData())
+        {
+            return reinterpret_cast<T*>(const_cast<uint8_t*>(buffer));
+        }
+
+        return nullptr;
+    }
+
+    template <typename SrcT>
+    typename std::enable_if<(sizeof(SrcT) != sizeof(T)) || !std::is_trivially_copyable<T>::value, T*>::type
+    GetParameterData(const uint8_t* buffer, size_t buffer_size, size_t len) const
+    {
+        GFXRECON_UNREFERENCED_PARAMETER(buffer);
+        GFXRECON_UNREFERENCED_PARAMETER(buffer_size);
+        GFXRECON_UNREFERENCED_PARAMETER(len);
+        return nullptr;
+    }
+
+    template <typename SrcT, bool kHandleIds>
+    size_t DecodeExternal(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)
     {
         assert(data_ != nullptr);
 
@@ -199,21 +270,30 @@ class PointerDecoder : public PointerDecoderBase
         {
             size_t len = GetLength();
 
-            if (len <= capacity_)
-            {
-                ValueDecoder::DecodeArrayFrom<SrcT>(buffer, buffer_size, data_, len);
-            }
-            else
+            if (len > capacity_)
             {
                 // The external memory cacpacity is not large enough to contain the full decoded array.
-                ValueDecoder::DecodeArrayFrom<SrcT>(buffer, buffer_size, data_, capacity_);
-
                 GFXRECON_LOG_WARNING("Pointer decoder's external memory capacity (%" PRIuPTR
                                      ") is smaller than the decoded array size (%" PRIuPTR "); data will be truncated",
                                      capacity_,
                                      len);
             }
 
+            if constexpr (kHandleIds)
+            {
+                if (compact_encoding)
+                {
+                    // The size of delta coded IDs is only known after all of them have been decoded.
+                    T* handle_ids = DecodeAllocator::Allocate<T>(len, false);
+                    bytes_read    = ValueDecoder::DecodeHandleIdArray(
+                        buffer, buffer_size, compact_encoding, handle_ids, len);
+                    std::copy(handle_ids, handle_ids + std::min(len, capacity_), data_);
+                    return bytes_read;
+                }
+            }
+
+            ValueDecoder::DecodeArrayFrom<SrcT>(buffer, buffer_size, data_, std::min(len, capacity_));
+
             // We always need to advance the position within the buffer by the amount of data that was expected to
             // be decoded, not the actual amount of data decoded if capacity is too small to hold all of the data.
             bytes_read = sizeof(SrcT) * len;
@@ -228,6 +308,7 @@ class PointerDecoder : public PointerDecoderBase
     T*     data_;
     size_t capacity_; ///< Size of external memory allocation referenced by #data_ when #is_memory_external_ is true.
     bool   is_memory_external_; ///< Indicates that the memory referenced by #data_ is an external allocation.
+    bool   is_parameter_data_;  ///< Indicates that #data_ references read-only data in the parameter buffer.
 
     /// Optional memory allocated for output pramaters when retrieving data from a function call. Allows both the data
     /// read from the file and the data retrieved from an API call to exist simultaneously, allowing the values to be
@@ -252,34 +333,34 @@ class PointerDecoder<T*> : public PointerDecoderBase
     }
 
     // clang-format off
-    size_t DecodeInt32(const uint8_t* buffer, size_t buffer_size)           { return DecodeFrom<int32_t>(buffer, buffer_size); }
-    size_t DecodeUInt32(const uint8_t* buffer, size_t buffer_size)          { return DecodeFrom<uint32_t>(buffer, buffer_size); }
-    size_t DecodeInt64(const uint8_t* buffer, size_t buffer_size)           { return DecodeFrom<int64_t>(buffer, buffer_size); }
-    size_t DecodeUInt64(const uint8_t* buffer, size_t buffer_size)          { return DecodeFrom<uint64_t>(buffer, buffer_size); }
-    size_t DecodeFloat(const uint8_t* buffer, size_t buffer_size)           { return DecodeFrom<float>(buffer, buffer_size); }
+    size_t DecodeInt32(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)           { return DecodeFrom<int32_t>(buffer, buffer_size, compact_encoding); }
+    size_t DecodeUInt32(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)          { return DecodeFrom<uint32_t>(buffer, buffer_size, compact_encoding); }
+    size_t DecodeInt64(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)           { return DecodeFrom<int64_t>(buffer, buffer_size, compact_encoding); }
+    size_t DecodeUInt64(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)          { return DecodeFrom<uint64_t>(buffer, buffer_size, compact_encoding); }
+    size_t DecodeFloat(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)           { return DecodeFrom<float>(buffer, buffer_size, compact_encoding); }
 
     // Decode pointer to a void pointer, encoded with ParameterEncoder::EncodeVoidPtrPtr.
-    size_t DecodeVoidPtr(const uint8_t* buffer, size_t buffer_size)         { return DecodeFrom<format::AddressEncodeType>(buffer, buffer_size); }
+    size_t DecodeVoidPtr(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)         { return DecodeFrom<format::AddressEncodeType>(buffer, buffer_size, compact_encoding); }
 
     // Decode for array of bytes.
-    size_t DecodeUInt8(const uint8_t* buffer, size_t buffer_size)           { return DecodeFrom<uint8_t>(buffer, buffer_size); }
-    size_t DecodeVoid(const uint8_t* buffer, size_t buffer_size)            { return DecodeFrom<uint8_t>(buffer, buffer_size); }
+    size_t DecodeUInt8(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)           { return DecodeFrom<uint8_t>(buffer, buffer_size, compact_encoding); }
+    size_t DecodeVoid(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)            { return DecodeFrom<uint8_t>(buffer, buffer_size, compact_encoding); }
 
     // Decode for special types that may require conversion.
-    size_t DecodeEnum(const uint8_t* buffer, size_t buffer_size)            { return DecodeFrom<format::EnumEncodeType>(buffer, buffer_size); }
-    size_t DecodeFlags(const uint8_t* buffer, size_t buffer_size)           { return DecodeFrom<format::FlagsEncodeType>(buffer, buffer_size); }
-    size_t DecodeVkSampleMask(const uint8_t* buffer, size_t buffer_size)    { return DecodeFrom<format::SampleMaskEncodeType>(buffer, buffer_size); }
-    size_t DecodeHandleId(const uint8_t* buffer, size_t buffer_size)        { return DecodeFrom<format::HandleEncodeType>(buffer, buffer_size); }
-    size_t DecodeVkDeviceSize(const uint8_t* buffer, size_t buffer_size)    { return DecodeFrom<format::DeviceSizeEncodeType>(buffer, buffer_size); }
-    size_t DecodeVkDeviceAddress(const uint8_t* buffer, size_t buffer_size) { return DecodeFrom<format::DeviceAddressEncodeType>(buffer, buffer_size); }
-    size_t DecodeSizeT(const uint8_t* buffer, size_t buffer_size)           { return DecodeFrom<format::SizeTEncodeType>(buffer, buffer_size); }
+    size_t DecodeEnum(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)            { return DecodeFrom<format::EnumEncodeType>(buffer, buffer_size, compact_encoding); }
+    size_t DecodeFlags(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)           { return DecodeFrom<format::FlagsEncodeType>(buffer, buffer_size, compact_encoding); }
+    size_t DecodeVkSampleMask(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)    { return DecodeFrom<format::SampleMaskEncodeType>(buffer, buffer_size, compact_encoding); }
+    size_t DecodeHandleId(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)        { return DecodeFrom<format::HandleEncodeType>(buffer, buffer_size, compact_encoding); }
+    size_t DecodeVkDeviceSize(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)    { return DecodeFrom<format::DeviceSizeEncodeType>(buffer, buffer_size, compact_encoding); }
+    size_t DecodeVkDeviceAddress(const uint8_t* buffer, size_t buffer_size, bool compact_encoding) { return DecodeFrom<format::DeviceAddressEncodeType>(buffer, buffer_size, compact_encoding); }
+    size_t DecodeSizeT(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)           { return DecodeFrom<format::SizeTEncodeType>(buffer, buffer_size, compact_encoding); }
     // clang-format on
 
   private:
     template <typename SrcT>
-    size_t DecodeFrom(const uint8_t* buffer, size_t buffer_size)
+    size_t DecodeFrom(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)
     {
-        size_t bytes_read = DecodeAttributes(buffer, buffer_size);
+        size_t bytes_read = DecodeAttributes(buffer, buffer_size, compact_encoding);
 
         // We should not be decoding pointers, arrays, or structs.
         assert((GetAttributeMask() & format::PointerAttributes::kIsSingle) != format::PointerAttributes::kIsSingle);
@@ -291,14 +372,14 @@ class PointerDecoder<T*> : public PointerDecoderBase
 
         if (!IsNull() && HasData())
         {
-            bytes_read += DecodeInternal<SrcT>((buffer + bytes_read), (buffer_size - bytes_read));
+            bytes_read += DecodeInternal<SrcT>((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding);
         }
 
         return bytes_read;
     }
 
     template <typename SrcT>
-    size_t DecodeInternal(const uint8_t* buffer, size_t buffer_size)
+    size_t DecodeInternal(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)
     {
         assert(data_ == nullptr);
 
@@ -311,7 +392,8 @@ class PointerDecoder<T*> : public PointerDecoderBase
         for (size_t i = 0; i < len; ++i)
         {
             uint32_t attrib = 0;
-            bytes_read += ValueDecoder::DecodeUInt32Value((buffer + bytes_read), (buffer_size - bytes_read), &attrib);
+            bytes_read += ValueDecoder::DecodeUInt32Value(
+                (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &attrib);
 
             if ((attrib & format::PointerAttributes::kIsNull) != format::PointerAttributes::kIsNull)
             {
@@ -333,8 +415,8 @@ class PointerDecoder<T*> : public PointerDecoderBase
                        format::PointerAttributes::kIsStruct);
 
                 size_t inner_len = 0;
-                bytes_read +=
-                    ValueDecoder::DecodeSizeTValue((buffer + bytes_read), (buffer_size - bytes_read), &inner_len);
+                bytes_read += ValueDecoder::DecodeSizeTValue(
+                    (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &inner_len);
 
                 T* inner_data = DecodeAllocator::Allocate<T>(inner_len);
                 bytes_read += ValueDecoder::DecodeArrayFrom<SrcT>(
@@ -72,11 +72,12 @@ class PointerDecoderBase
     size_t GetLength() const { return len_; }
 
   protected:
-    size_t DecodeAttributes(const uint8_t* buffer, size_t buffer_size)
+    size_t DecodeAttributes(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)
     {
         size_t bytes_read = 0;
 
-        bytes_read += ValueDecoder::DecodeUInt32Value((buffer + bytes_read), (buffer_size - bytes_read), &attrib_);
+        bytes_read += ValueDecoder::DecodeUInt32Value(
+            (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &attrib_);
 
         if ((attrib_ & format::PointerAttributes::kIsNull) != format::PointerAttributes::kIsNull)
         {
@@ -90,7 +91,8 @@ class PointerDecoderBase
                 ((attrib_ & format::PointerAttributes::kIsString) == format::PointerAttributes::kIsString) ||
                 ((attrib_ & format::PointerAttributes::kIsWString) == format::PointerAttributes::kIsWString))
             {
-                bytes_read += ValueDecoder::DecodeSizeTValue((buffer + bytes_read), (buffer_size - bytes_read), &len_);
+                bytes_read += ValueDecoder::DecodeSizeTValue(
+                    (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &len_);
             }
             else
             {
@@ -22,323 +22,435 @@
 */
 
 #include "decode/preload_file_processor.h"
+#include "util/date_time.h"
 #include "util/logging.h"
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
-PreloadFileProcessor::PreloadFileProcessor() : status_(PreloadStatus::kInactive) {}
+// Size of the memory blocks allocated for preloaded block data.  Larger blocks are allocated individually.
+const size_t kPreloadArenaBlockSize = 32 * 1024 * 1024;
+
+PreloadFileProcessor::PreloadFileProcessor() :
+    status_(PreloadStatus::kInactive), preload_arena_(kPreloadArenaBlockSize), preload_size_(0),
+    preload_memory_budget_(0), replay_block_index_(0), replay_data_(nullptr), replay_data_size_(0)
+{}
 
 void PreloadFileProcessor::PreloadNextFrames(size_t count)
 {
+    int64_t start_time  = util::datetime::GetTimestamp();
+    size_t  frame_count = 0;
+
     status_ = PreloadStatus::kRecord;
-    while (--count != 0U)
+
+    const format::FileIndex* file_index = GetLoadedFileIndex();
+
+    if ((file_index != nullptr) && (count > 1))
     {
-        ProcessNextFrame();
+        // The index locates the blocks of the frames to preload, so that the block list is allocated once and a range
+        // that cannot fit in the memory budget is reported before it is read.
+        const auto& frames      = file_index->GetFrames();
+        size_t      last_frame  = frames.size() - 1;
+        size_t      first_frame = std::min(static_cast<size_t>(current_frame_number_), last_frame);
+        size_t      end_frame   = std::min(first_frame + count - 1, last_frame);
+        uint64_t    block_count = frames[end_frame].block_index - frames[first_frame].block_index;
+        uint64_t    data_size   = frames[end_frame].offset - frames[first_frame].offset;
+
+        preloaded_blocks_.reserve(preloaded_blocks_.size() + static_cast<size_t>(block_count));
+
+        if ((preload_memory_budget_ != 0) && (data_size > preload_memory_budget_))
+        {
+            GFXRECON_LOG_WARNING("The %" PRIu64 " frames to preload contain %" PRIu64
+                                 " bytes of capture file data, which exceeds the preload memory budget of %" PRIu64
+                                 " bytes",
+                                 static_cast<uint64_t>(end_frame - first_frame),
+                                 data_size,
+                                 static_cast<uint64_t>(preload_memory_budget_));
+        }
     }
-    status_ = PreloadStatus::kReplay;
-}
 
-PreloadFileProcessor::PreloadBuffer::PreloadBuffer() : replay_offset_(0) {}
+    for (size_t i = 1; (i < count) && !IsPreloadBudgetExceeded(); ++i)
+    {
+        if (!ProcessNextFrame())
+        {
+            break;
+        }
+
+        ++frame_count;
+    }
+
+    status_ = preloaded_blocks_.empty() ? PreloadStatus::kInactive : PreloadStatus::kReplay;
+
+    GFXRECON_LOG_INFO("Preloaded %" PRIu64 " frames (%" PRIu64 " blocks, %" PRIu64 " bytes) in %.3f ms",
+                      static_cast<uint64_t>(frame_count),
+                      static_cast<uint64_t>(preloaded_blocks_.size()),
+                      static_cast<uint64_t>(preload_size_),
+                      util::datetime::ConvertTimestampToMilliseconds(
+                          util::datetime::DiffTimestamps(start_time, util::datetime::GetTimestamp())));
+
+    if (IsPreloadBudgetExceeded())
+    {
+        GFXRECON_LOG_WARNING("Preloading stopped at the memory budget of %" PRIu64
+                             " bytes; the remaining frames will be read from the capture file",
+                             static_cast<uint64_t>(preload_memory_budget_));
+    }
+}
 
-void PreloadFileProcessor::PreloadBuffer::Reserve(size_t size)
+bool PreloadFileProcessor::ProcessBlocks()
 {
-    container_.reserve(container_.size() + size);
+    if (status_ == PreloadStatus::kRecord)
+    {
+        return PreloadBlocks();
+    }
+    else if (status_ == PreloadStatus::kReplay)
+    {
+        return ReplayBlocks();
+    }
+
+    return FileProcessor::ProcessBlocks();
 }
 
-size_t PreloadFileProcessor::PreloadBuffer::Read(void* destination, size_t destination_size)
+bool PreloadFileProcessor::ReadBytes(void* buffer, size_t buffer_size)
 {
-    auto remaining_buffer_data = container_.size() - replay_offset_;
-    auto read_size             = destination_size > remaining_buffer_data ? remaining_buffer_data : destination_size;
-    memcpy(destination, &container_[replay_offset_], read_size);
-    replay_offset_ += read_size;
-    return read_size;
+    if (status_ == PreloadStatus::kReplay)
+    {
+        const uint8_t* data = ReadBytesInPlace(buffer_size);
+
+        if (data != nullptr)
+        {
+            util::platform::MemoryCopy(buffer, buffer_size, data, buffer_size);
+            bytes_read_ += buffer_size;
+            return true;
+        }
+
+        return false;
+    }
+
+    return FileProcessor::ReadBytes(buffer, buffer_size);
 }
 
-void PreloadFileProcessor::PreloadBuffer::Reset()
+const uint8_t* PreloadFileProcessor::ReadBytesInPlace(size_t buffer_size)
 {
-    container_.clear();
-    container_.shrink_to_fit();
-    replay_offset_ = 0;
+    if (status_ == PreloadStatus::kReplay)
+    {
+        if (buffer_size > replay_data_size_)
+        {
+            return nullptr;
+        }
+
+        const uint8_t* data = replay_data_;
+        replay_data_ += buffer_size;
+        replay_data_size_ -= buffer_size;
+        return data;
+    }
+
+    return FileProcessor::ReadBytesInPlace(buffer_size);
 }
 
-bool PreloadFileProcessor::ProcessBlocks()
+bool PreloadFileProcessor::PreloadBlocks()
 {
     format::BlockHeader block_header;
     bool                success = true;
 
     while (success)
     {
-        PrintBlockInfo();
         success = ContinueDecoding();
 
         if (success)
         {
             success = ReadBlockHeader(&block_header);
 
-            if (status_ != PreloadStatus::kRecord)
-            {
-                // Since block_index isn't relevant during recording, skip setting it in the decoders
-                for (auto* decoder : decoders_)
-                {
-                    decoder->SetCurrentBlockIndex(block_index_);
-                }
-            }
-
             if (success)
             {
-                if (format::RemoveCompressedBlockBit(block_header.type) == format::BlockType::kFunctionCallBlock)
-                {
-                    format::ApiCallId api_call_id = format::ApiCallId::ApiCall_Unknown;
-
-                    success = ReadBytes(&api_call_id, sizeof(api_call_id));
-
-                    if (success)
-                    {
-                        const auto is_frame_delimiter = IsFrameDelimiter(api_call_id);
-                        if (status_ == PreloadStatus::kRecord)
-                        {
-                            success = ReadParameterBytes(block_header, api_call_id, preload_buffer_);
-                            if (!success)
-                            {
-                                HandleBlockReadError(kErrorReadingBlockData, "Failed to read function call block data");
-                            }
-
-                            if (is_frame_delimiter)
-                            {
-                                break;
-                            }
-                        }
-                        else
-                        {
-                            bool should_break = false;
-                            success           = ProcessFunctionCall(block_header, api_call_id, should_break);
-                            if (should_break)
-                            {
-                                break;
-                            }
-                        }
-                    }
-                    else
-                    {
-                        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read function call block header");
-                    }
-                }
-                else if (format::RemoveCompressedBlockBit(block_header.type) == format::BlockType::kMethodCallBlock)
-                {
-                    format::ApiCallId api_call_id = format::ApiCallId::ApiCall_Unknown;
-
-                    success = ReadBytes(&api_call_id, sizeof(api_call_id));
-
-                    if (success)
-                    {
-                        const auto is_frame_delimiter = IsFrameDelimiter(api_call_id);
-                        if (status_ == PreloadStatus::kRecord)
-                        {
-                            success = ReadParameterBytes(block_header, api_call_id, preload_buffer_);
-                            if (!success)
-                            {
-                                HandleBlockReadError(kErrorReadingBlockData,
-                                                     "Failed to preload method call block data");
-                            }
-                            if (is_frame_delimiter)
-                            {
-                                break;
-                            }
-                        }
-                        else
-                        {
-                            bool should_break = false;
-                            success           = ProcessMethodCall(block_header, api_call_id, should_break);
-                            if (should_break)
-                            {
-                                break;
-                            }
-                        }
-                    }
-                    else
-                    {
-                        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read function call block header");
-                    }
-                }
-                else if (format::RemoveCompressedBlockBit(block_header.type) == format::BlockType::kMetaDataBlock)
-                {
-                    if (status_ == PreloadStatus::kRecord)
-                    {
-                        success = ReadParameterBytes(block_header, preload_buffer_);
-                        if (!success)
-                        {
-                            HandleBlockReadError(kErrorReadingBlockData, "Failed to preload meta-data block");
-                        }
-                    }
-                    else
-                    {
-                        format::MetaDataId meta_data_id = format::MakeMetaDataId(
-                            format::ApiFamilyId::ApiFamily_None, format::MetaDataType::kUnknownMetaDataType);
-
-                        success = ReadBytes(&meta_data_id, sizeof(meta_data_id));
-
-                        if (success)
-                        {
-                            success = ProcessMetaData(block_header, meta_data_id);
-                        }
-                        else
-                        {
-                            HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read meta-data block header");
-                        }
-                    }
-                }
-                else if (block_header.type == format::BlockType::kFrameMarkerBlock)
-                {
-                    format::MarkerType marker_type  = format::MarkerType::kUnknownMarker;
-                    uint64_t           frame_number = 0;
-
-                    success = ReadBytes(&marker_type, sizeof(marker_type));
-
-                    if (success)
-                    {
-                        if (status_ == PreloadStatus::kRecord)
-                        {
-                            const auto is_frame_delimiter = IsFrameDelimiter(block_header.type, marker_type);
-                            success = ReadParameterBytes(block_header, marker_type, preload_buffer_);
-                            if (!success)
-                            {
-                                HandleBlockReadError(kErrorReadingBlockData, "Failed to preload frame marker block");
-                            }
-                            if (is_frame_delimiter)
-                            {
-                                break;
-                            }
-                        }
-                        else
-                        {
-                            bool should_break = false;
-                            success           = ProcessFrameMarker(block_header, marker_type, should_break);
-
-                            if (should_break)
-                            {
-                                break;
-                            }
-                        }
-                    }
-                    else
-                    {
-                        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read frame marker header");
-                    }
-                }
-                else if (block_header.type == format::BlockType::kStateMarkerBlock)
-                {
-                    format::MarkerType marker_type  = format::MarkerType::kUnknownMarker;
-                    uint64_t           frame_number = 0;
-
-                    if (status_ == PreloadStatus::kRecord)
-                    {
-                        success = ReadParameterBytes(block_header, preload_buffer_);
-                        if (!success)
-                        {
-                            HandleBlockReadError(kErrorReadingBlockData, "Failed to preload state marker block data");
-                        }
-                    }
-                    else
-                    {
-                        success = ReadBytes(&marker_type, sizeof(marker_type));
-
-                        if (success)
-                        {
-                            success = ProcessStateMarker(block_header, marker_type);
-                        }
-                        else
-                        {
-                            HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read state marker header");
-                        }
-                    }
-                }
-                else if (block_header.type == format::BlockType::kAnnotation)
+                bool is_frame_delimiter = false;
+
+                success = PreloadBlock(block_header, &is_frame_delimiter);
+
+                if (!success)
                 {
-                    if (annotation_handler_ != nullptr)
-                    {
-                        if (status_ == PreloadStatus::kRecord)
-                        {
-                            success = ReadParameterBytes(block_header, preload_buffer_);
-                            if (!success)
-                            {
-                                HandleBlockReadError(kErrorReadingBlockData, "Failed to preload annotation block data");
-                            }
-                        }
-                        else
-                        {
-                            format::AnnotationType annotation_type = format::AnnotationType::kUnknown;
-
-                            success = ReadBytes(&annotation_type, sizeof(annotation_type));
-
-                            if (success)
-                            {
-                                success = ProcessAnnotation(block_header, annotation_type);
-                            }
-                            else
-                            {
-                                HandleBlockReadError(kErrorReadingBlockHeader,
-                                                     "Failed to read annotation block header");
-                            }
-                        }
-                    }
-                    else
-                    {
-                        // If there is no annotation handler to process the annotation, we can skip the annotation
-                        // block.
-                        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
-                        success = SkipBytes(static_cast<size_t>(block_header.size));
-                    }
+                    HandleBlockReadError(kErrorReadingBlockData, "Failed to preload block data");
                 }
-                else
+                else if (is_frame_delimiter || IsPreloadBudgetExceeded())
                 {
-                    // Unrecognized block type.
-                    GFXRECON_LOG_WARNING("Skipping unrecognized file block with type %u", block_header.type);
-                    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
-                    success = SkipBytes(static_cast<size_t>(block_header.size));
+                    break;
                 }
             }
             else
             {
-                if (feof(file_descriptor_) == 0)
+                if (!IsFileAtEnd())
                 {
                     // No data has been read for the current block, so we don't use 'HandleBlockReadError' here, as
                     // it assumes that the block header has been successfully read and will print an incomplete
-                    // block at end of file warning when the file is at EOF without an error. For this case (the
-                    // normal EOF case) we print nothing at EOF, or print an error message and set the error code
-                    // directly when not at EOF.
+                    // block at end of file warning when the file is at EOF without an error.
                     GFXRECON_LOG_ERROR("Failed to read block header");
                     error_state_ = kErrorReadingBlockHeader;
                 }
             }
         }
-        if (status_ != PreloadStatus::kRecord)
+    }
+
+    return success;
+}
+
+bool PreloadFileProcessor::PreloadBlock(const format::BlockHeader& block_header, bool* is_frame_delimiter)
+{
+    assert(is_frame_delimiter != nullptr);
+
+    format::BlockType base_type = format::RemoveCompressedBlockBit(block_header.type);
+    bool              success   = false;
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+
+    if ((base_type == format::BlockType::kFunctionCallBlock) || (base_type == format::BlockType::kMethodCallBlock))
+    {
+        format::ApiCallId call_id = format::ApiCallId::ApiCall_Unknown;
+
+        success = ReadBytes(&call_id, sizeof(call_id));
+
+        if (success)
+        {
+            *is_frame_delimiter = IsFrameDelimiter(call_id);
+
+            if (format::IsBlockCompressed(block_header.type))
+            {
+                size_t prefix_size = sizeof(format::ThreadId);
+
+                if (base_type == format::BlockType::kMethodCallBlock)
+                {
+                    prefix_size += sizeof(format::HandleId);
+                }
+
+                success = PreloadCompressedCallBlock(block_header, call_id, prefix_size);
+            }
+            else
+            {
+                uint8_t* data = AddPreloadedBlock(block_header);
+                util::platform::MemoryCopy(data, sizeof(call_id), &call_id, sizeof(call_id));
+                success = ReadBytes(data + sizeof(call_id), static_cast<size_t>(block_header.size) - sizeof(call_id));
+            }
+        }
+    }
+    else if ((base_type == format::BlockType::kMetaDataBlock) ||
+             (block_header.type == format::BlockType::kFrameMarkerBlock) ||
+             (block_header.type == format::BlockType::kStateMarkerBlock) ||
+             ((block_header.type == format::BlockType::kAnnotation) && (annotation_handler_ != nullptr)))
+    {
+        // Meta-data blocks are stored as they were read, and are decompressed when they are replayed.
+        uint8_t* data = AddPreloadedBlock(block_header);
+        success       = ReadBytes(data, static_cast<size_t>(block_header.size));
+
+        if (success && (block_header.type == format::BlockType::kFrameMarkerBlock) &&
+            (block_header.size >= sizeof(format::MarkerType)))
+        {
+            format::MarkerType marker_type = format::MarkerType::kUnknownMarker;
+            util::platform::MemoryCopy(&marker_type, sizeof(marker_type), data, sizeof(marker_type));
+            *is_frame_delimiter = IsFrameDelimiter(block_header.type, marker_type);
+        }
+    }
+    else
+    {
+        if (block_header.type != format::BlockType::kAnnotation)
+        {
+            GFXRECON_LOG_WARNING("Skipping unrecognized file block with type %u", block_header.type);
+        }
+
+        // Annotations are skipped when there is no annotation handler to process them.
+        success = SkipBytes(static_cast<size_t>(block_header.size));
+    }
+
+    return success;
+}
+
+bool PreloadFileProcessor::PreloadCompressedCallBlock(const format::BlockHeader& block_header,
+                                                      format::ApiCallId          call_id,
+                                                      size_t                     prefix_size)
+{
+    uint8_t  prefix[sizeof(format::HandleId) + sizeof(format::ThreadId)];
+    uint64_t uncompressed_size = 0;
+    size_t   actual_size       = 0;
+
+    assert(prefix_size <= sizeof(prefix));
+
+    bool success = ReadBytes(prefix, prefix_size) && ReadBytes(&uncompressed_size, sizeof(uncompressed_size));
+
+    if (success)
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, uncompressed_size);
+
+        size_t compressed_size =
+            static_cast<size_t>(block_header.size) - sizeof(call_id) - prefix_size - sizeof(uncompressed_size);
+
+        success = ReadCompressedParameterBuffer(compressed_size, static_cast<size_t>(uncompressed_size), &actual_size);
+    }
+
+    if (success)
+    {
+        // Store the block as an uncompressed call block, without the uncompressed size.
+        format::BlockHeader uncompressed_header = block_header;
+        uncompressed_header.type                = format::RemoveCompressedBlockBit(block_header.type);
+        uncompressed_header.size                = sizeof(call_id) + prefix_size + actual_size;
+
+        uint8_t* data = AddPreloadedBlock(uncompressed_header);
+        util::platform::MemoryCopy(data, sizeof(call_id), &call_id, sizeof(call_id));
+        util::platform::MemoryCopy(data + sizeof(call_id), prefix_size, prefix, prefix_size);
+        util::platform::MemoryCopy(
+            data + sizeof(call_id) + prefix_size, actual_size, GetParameterData(), actual_size);
+    }
+
+    return success;
+}
+
+uint8_t* PreloadFileProcessor::AddPreloadedBlock(const format::BlockHeader& block_header)
+{
+    size_t size       = static_cast<size_t>(block_header.size);
+    size_t word_count = std::max((size + sizeof(uint64_t) - 1) / sizeof(uint64_t), size_t{ 1 });
+
+    // Allocate whole 64-bit words so that the block data is aligned for the decoders.
+    uint8_t* data = reinterpret_cast<uint8_t*>(preload_arena_.Allocate<uint64_t>(word_count, false));
+
+    preloaded_blocks_.push_back({ block_header, data });
+    preload_size_ += sizeof(PreloadedBlock) + size;
+
+    return data;
+}
+
+bool PreloadFileProcessor::ReplayBlocks()
+{
+    bool success      = true;
+    bool should_break = false;
+
+    while (success && !should_break && (replay_block_index_ < preloaded_blocks_.size()))
+    {
+        PrintBlockInfo();
+        success = ContinueDecoding();
+
+        if (success)
+        {
+            for (auto decoder : decoders_)
+            {
+                decoder->SetCurrentBlockIndex(block_index_);
+            }
+
+            const PreloadedBlock& block = preloaded_blocks_[replay_block_index_++];
+            replay_data_                = block.data;
+            replay_data_size_           = static_cast<size_t>(block.header.size);
+
+            success = ReplayBlock(block.header, &should_break);
+
+            if (!should_break)
+            {
+                ++block_index_;
+            }
+        }
+    }
+
+    if (replay_block_index_ == preloaded_blocks_.size())
+    {
+        ResetPreload();
+        status_ = PreloadStatus::kInactive;
+
+        if (success && !should_break)
         {
-            ++block_index_;
+            // Preloading stopped before the end of the frame, so process the rest of the frame from the file.
+            success = FileProcessor::ProcessBlocks();
         }
     }
 
     return success;
 }
 
-bool PreloadFileProcessor::ReadBytes(void* buffer, size_t buffer_size)
+bool PreloadFileProcessor::ReplayBlock(const format::BlockHeader& block_header, bool* should_break)
 {
-    size_t bytes_read = 0;
-    if (status_ == PreloadStatus::kReplay)
+    assert(should_break != nullptr);
+
+    format::BlockType base_type = format::RemoveCompressedBlockBit(block_header.type);
+    bool              success   = false;
+
+    if ((base_type == format::BlockType::kFunctionCallBlock) || (base_type == format::BlockType::kMethodCallBlock))
     {
-        bytes_read = preload_buffer_.Read(buffer, buffer_size);
-        bytes_read_ += bytes_read;
-        if (preload_buffer_.ReplayFinished())
+        format::ApiCallId api_call_id = format::ApiCallId::ApiCall_Unknown;
+
+        success = ReadBytes(&api_call_id, sizeof(api_call_id));
+
+        if (success)
         {
-            status_ = PreloadStatus::kInactive;
+            success = (base_type == format::BlockType::kFunctionCallBlock)
+                          ? ProcessFunctionCall(block_header, api_call_id, *should_break)
+                          : ProcessMethodCall(block_header, api_call_id, *should_break);
+        }
+        else
+        {
+            HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read preloaded call block header");
         }
     }
-    else
+    else if (base_type == format::BlockType::kMetaDataBlock)
+    {
+        format::MetaDataId meta_data_id = format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_None,
+                                                                 format::MetaDataType::kUnknownMetaDataType);
+
+        success = ReadBytes(&meta_data_id, sizeof(meta_data_id));
+
+        if (success)
+        {
+            success = ProcessMetaData(block_header, meta_data_id);
+        }
+        else
+        {
+            HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read preloaded meta-data block header");
+        }
+    }
+    else if ((block_header.type == format::BlockType::kFrameMarkerBlock) ||
+             (block_header.type == format::BlockType::kStateMarkerBlock))
     {
-        bytes_read = util::platform::FileRead(buffer, buffer_size, file_descriptor_);
-        bytes_read_ += bytes_read;
+        format::MarkerType marker_type = format::MarkerType::kUnknownMarker;
+
+        success = ReadBytes(&marker_type, sizeof(marker_type));
+
+        if (success)
+        {
+            success = (block_header.type == format::BlockType::kFrameMarkerBlock)
+                          ? ProcessFrameMarker(block_header, marker_type, *should_break)
+                          : ProcessStateMarker(block_header, marker_type);
+        }
+        else
+        {
+            HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read preloaded marker block header");
+        }
     }
-    return bytes_read == buffer_size;
+    else if (block_header.type == format::BlockType::kAnnotation)
+    {
+        format::AnnotationType annotation_type = format::AnnotationType::kUnknown;
+
+        success = ReadBytes(&annotation_type, sizeof(annotation_type));
+
+        if (success)
+        {
+            success = ProcessAnnotation(block_header, annotation_type);
+        }
+        else
+        {
+            HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read preloaded annotation block header");
+        }
+    }
+
+    return success;
+}
+
+void PreloadFileProcessor::ResetPreload()
+{
+    preload_arena_.Clear(true);
+    preloaded_blocks_.clear();
+    preloaded_blocks_.shrink_to_fit();
+
+    preload_size_       = 0;
+    replay_block_index_ = 0;
+    replay_data_        = nullptr;
+    replay_data_size_   = 0;
 }
 
 GFXRECON_END_NAMESPACE(decode)
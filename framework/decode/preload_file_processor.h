@@ -26,6 +26,9 @@
 
 #include "decode/file_processor.h"
 #include "format/format_util.h"
+#include "util/monotonic_allocator.h"
+
+#include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
@@ -35,77 +38,78 @@ class PreloadFileProcessor : public FileProcessor
   public:
     PreloadFileProcessor();
 
-    // Preloads *count* frames to continuous, expandable memory buffer
-    void PreloadNextFrames(size_t count);
-
-  private:
-    class PreloadBuffer
-    {
-      public:
-        PreloadBuffer();
-
-        // Ensures the buffer can store additional *size* bytes
-        void Reserve(size_t size);
-
-        // Copies the preloaded data from the internal container into the provided destination buffer
-        // Accounts for current replay position
-        size_t Read(void* destination, size_t destination_size);
+    // Limits the memory used to store preloaded blocks.  Preloading stops at the first block that exceeds the budget,
+    // and the blocks that follow are processed from the file.  A budget of zero does not limit preloading.
+    void SetPreloadMemoryBudget(size_t budget) { preload_memory_budget_ = budget; }
 
-        // Copies provided object of type T into the preload buffer
-        // Returns a pointer to inserted object in the container
-        template <typename T>
-        inline void* Add(T* data)
-        {
-            return &*container_.insert(
-                container_.end(), reinterpret_cast<char*>(data), reinterpret_cast<char*>(data) + sizeof(T));
-        }
-
-        // Allocates *size* bytes in the preload buffer
-        // Returns the pointer to initialized memory
-        inline void* Add(size_t size) { return &*container_.insert(container_.end(), size, 0); }
+    // Preloads the blocks of the next *count* frames to memory.  Call blocks are decompressed as they are preloaded, so
+    // that replaying the preloaded frames only dispatches the calls from memory.
+    void PreloadNextFrames(size_t count);
 
-        // Indicates whether the preloaded calls have been replayed in full
-        inline bool ReplayFinished() { return !container_.empty() && replay_offset_ >= container_.size(); }
+  protected:
+    bool ProcessBlocks() override;
 
-        // Clears the preload buffer, resets internal state
-        void Reset();
+    bool ReadBytes(void* buffer, size_t buffer_size) override;
 
-      private:
-        std::vector<char> container_;
-        size_t            replay_offset_;
+    // Block data replayed from the preload arena is referenced in place.
+    bool CanReadInPlace() const override
+    {
+        return (status_ == PreloadStatus::kReplay) || FileProcessor::CanReadInPlace();
+    }
 
-    } preload_buffer_;
+    const uint8_t* ReadBytesInPlace(size_t buffer_size) override;
 
+  private:
     enum class PreloadStatus
     {
         kInactive,
         kRecord,
         kReplay
-    } status_;
+    };
 
-    template <typename T>
-    bool ReadParameterBytes(format::BlockHeader& block_header, T& data, PreloadBuffer& preload_buffer)
+    // Block stored in the preload arena.  The header of a compressed call block is modified to describe the
+    // uncompressed block data stored in the arena.
+    struct PreloadedBlock
     {
-        preload_buffer.Reserve(sizeof(block_header) + block_header.size);
-        preload_buffer.Add(&block_header);
-        preload_buffer.Add(&data);
-        size_t parameters_size  = block_header.size - sizeof(T);
-        void*  parameter_buffer = preload_buffer.Add(parameters_size);
-        return ReadBytes(parameter_buffer, parameters_size);
-    }
+        format::BlockHeader header;
+        const uint8_t*      data;
+    };
+
+  private:
+    // Preloads the blocks of the next frame.
+    bool PreloadBlocks();
+
+    bool PreloadBlock(const format::BlockHeader& block_header, bool* is_frame_delimiter);
+
+    // Decompresses the parameter data of a call block.  prefix_size is the size of the object and thread IDs that
+    // precede the uncompressed size in the block.
+    bool PreloadCompressedCallBlock(const format::BlockHeader& block_header,
+                                    format::ApiCallId          call_id,
+                                    size_t                     prefix_size);
 
-    bool ReadParameterBytes(format::BlockHeader& block_header, PreloadBuffer& preload_buffer)
+    uint8_t* AddPreloadedBlock(const format::BlockHeader& block_header);
+
+    bool IsPreloadBudgetExceeded() const
     {
-        preload_buffer.Reserve(sizeof(block_header) + block_header.size);
-        preload_buffer.Add(&block_header);
-        size_t parameters_size  = block_header.size;
-        void*  parameter_buffer = preload_buffer.Add(parameters_size);
-        return ReadBytes(parameter_buffer, parameters_size);
+        return (preload_memory_budget_ != 0) && (preload_size_ >= preload_memory_budget_);
     }
 
-    bool ProcessBlocks() override;
+    // Replays the preloaded blocks of the next frame.
+    bool ReplayBlocks();
 
-    bool ReadBytes(void* buffer, size_t buffer_size) override;
+    bool ReplayBlock(const format::BlockHeader& block_header, bool* should_break);
+
+    void ResetPreload();
+
+  private:
+    PreloadStatus               status_;
+    util::MonotonicAllocator    preload_arena_;
+    std::vector<PreloadedBlock> preloaded_blocks_;
+    size_t                      preload_size_;
+    size_t                      preload_memory_budget_;
+    size_t                      replay_block_index_;
+    const uint8_t*              replay_data_;
+    size_t                      replay_data_size_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
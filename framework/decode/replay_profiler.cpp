@@ -0,0 +1,268 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/replay_profiler.h"
+
+#include "util/json_util.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include "nlohmann/json.hpp"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Number of API calls listed by LogToConsole().
+const size_t kConsoleCallCount = 10;
+
+static double ConvertTimestampToMicroseconds(int64_t timestamp)
+{
+    return static_cast<double>(timestamp) / 1000.0;
+}
+
+static std::string FormatApiCallId(format::ApiCallId call_id)
+{
+    char buffer[16];
+    std::snprintf(buffer, sizeof(buffer), "0x%08x", static_cast<uint32_t>(call_id));
+    return buffer;
+}
+
+ReplayProfiler::ReplayProfiler() : frame_started_(false), call_start_time_(0), call_start_driver_time_(0) {}
+
+void ReplayProfiler::SetFrame(uint64_t frame_number)
+{
+    if (!frame_started_ || (frame_number != current_frame_.frame_number))
+    {
+        int64_t timestamp = util::datetime::GetTimestamp();
+
+        if (frame_started_)
+        {
+            CompleteFrame(timestamp);
+        }
+
+        current_frame_              = FrameStats{};
+        current_frame_.frame_number = frame_number;
+        current_frame_.start_time   = timestamp;
+        frame_started_              = true;
+    }
+}
+
+void ReplayProfiler::BeginCall()
+{
+    call_start_driver_time_ = current_frame_.driver_time;
+    call_start_time_        = util::datetime::GetTimestamp();
+}
+
+void ReplayProfiler::EndCall(format::ApiCallId call_id)
+{
+    int64_t duration    = util::datetime::DiffTimestamps(call_start_time_, util::datetime::GetTimestamp());
+    int64_t driver_time = current_frame_.driver_time - call_start_driver_time_;
+
+    current_frame_.decode_time += std::max(duration - driver_time, int64_t{ 0 });
+
+    CallStats& stats = call_stats_[call_id];
+
+    if ((stats.count == 0) || (duration < stats.min_time))
+    {
+        stats.min_time = duration;
+    }
+
+    if (duration > stats.max_time)
+    {
+        stats.max_time = duration;
+    }
+
+    ++stats.count;
+    stats.total_time += duration;
+    stats.driver_time += driver_time;
+    ++stats.histogram[GetHistogramBucket(duration)];
+}
+
+void ReplayProfiler::EndFile()
+{
+    if (frame_started_)
+    {
+        CompleteFrame(util::datetime::GetTimestamp());
+        frame_started_ = false;
+    }
+}
+
+void ReplayProfiler::LogToConsole() const
+{
+    int64_t total_time  = 0;
+    int64_t read_time   = 0;
+    int64_t decode_time = 0;
+    int64_t driver_time = 0;
+
+    for (const auto& frame : frame_stats_)
+    {
+        total_time += frame.total_time;
+        read_time += frame.read_time;
+        decode_time += frame.decode_time;
+        driver_time += frame.driver_time;
+    }
+
+    GFXRECON_WRITE_CONSOLE("Replay profile: %" PRIu64 " frames, %.3f ms total, %.3f ms read, %.3f ms decode and "
+                           "dispatch, %.3f ms driver",
+                           static_cast<uint64_t>(frame_stats_.size()),
+                           util::datetime::ConvertTimestampToMilliseconds(total_time),
+                           util::datetime::ConvertTimestampToMilliseconds(read_time),
+                           util::datetime::ConvertTimestampToMilliseconds(decode_time),
+                           util::datetime::ConvertTimestampToMilliseconds(driver_time));
+
+    std::vector<std::pair<format::ApiCallId, const CallStats*>> calls;
+    calls.reserve(call_stats_.size());
+
+    for (const auto& entry : call_stats_)
+    {
+        calls.emplace_back(entry.first, &entry.second);
+    }
+
+    size_t call_count = std::min(calls.size(), kConsoleCallCount);
+    std::partial_sort(calls.begin(), calls.begin() + call_count, calls.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.second->total_time > rhs.second->total_time;
+    });
+
+    for (size_t i = 0; i < call_count; ++i)
+    {
+        const CallStats* stats = calls[i].second;
+        GFXRECON_WRITE_CONSOLE("  API call %s: %" PRIu64 " calls, %.3f ms total, %.3f us mean, %.3f us p99",
+                               FormatApiCallId(calls[i].first).c_str(),
+                               stats->count,
+                               util::datetime::ConvertTimestampToMilliseconds(stats->total_time),
+                               ConvertTimestampToMicroseconds(stats->total_time) / stats->count,
+                               ConvertTimestampToMicroseconds(GetPercentile(*stats, 0.99)));
+    }
+}
+
+bool ReplayProfiler::WriteReport(const std::string& filename) const
+{
+    nlohmann::json frames = nlohmann::json::array();
+    for (const auto& frame : frame_stats_)
+    {
+        frames.push_back({ { "frame", frame.frame_number },
+                           { "total_ms", util::datetime::ConvertTimestampToMilliseconds(frame.total_time) },
+                           { "read_ms", util::datetime::ConvertTimestampToMilliseconds(frame.read_time) },
+                           { "decode_ms", util::datetime::ConvertTimestampToMilliseconds(frame.decode_time) },
+                           { "driver_ms", util::datetime::ConvertTimestampToMilliseconds(frame.driver_time) } });
+    }
+
+    nlohmann::json calls = nlohmann::json::array();
+    for (const auto& entry : call_stats_)
+    {
+        const CallStats& stats     = entry.second;
+        nlohmann::json   histogram = nlohmann::json::array();
+
+        for (size_t i = 0; i < kHistogramBucketCount; ++i)
+        {
+            if (stats.histogram[i] > 0)
+            {
+                histogram.push_back({ { "min_ns", uint64_t{ 1 } << i }, { "count", stats.histogram[i] } });
+            }
+        }
+
+        calls.push_back({ { "call_id", FormatApiCallId(entry.first) },
+                          { "api_family", format::GetApiCallFamily(entry.first) },
+                          { "count", stats.count },
+                          { "total_ms", util::datetime::ConvertTimestampToMilliseconds(stats.total_time) },
+                          { "driver_ms", util::datetime::ConvertTimestampToMilliseconds(stats.driver_time) },
+                          { "mean_us", ConvertTimestampToMicroseconds(stats.total_time) / stats.count },
+                          { "min_us", ConvertTimestampToMicroseconds(stats.min_time) },
+                          { "max_us", ConvertTimestampToMicroseconds(stats.max_time) },
+                          { "p50_us", ConvertTimestampToMicroseconds(GetPercentile(stats, 0.50)) },
+                          { "p95_us", ConvertTimestampToMicroseconds(GetPercentile(stats, 0.95)) },
+                          { "p99_us", ConvertTimestampToMicroseconds(GetPercentile(stats, 0.99)) },
+                          { "histogram", histogram } });
+    }
+
+    nlohmann::json file_content = { { "frames", frames }, { "api_calls", calls } };
+
+    bool    success      = false;
+    FILE*   file_pointer = nullptr;
+    int32_t result       = util::platform::FileOpen(&file_pointer, filename.c_str(), "w");
+    if (result == 0)
+    {
+        const std::string json_string = file_content.dump(util::kJsonIndentWidth);
+
+        success = util::platform::FileWrite(json_string.data(), json_string.size(), file_pointer);
+        if (!success)
+        {
+            GFXRECON_LOG_ERROR("Failed to write to replay profile file '%s'.", filename.c_str());
+        }
+
+        util::platform::FileClose(file_pointer);
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("Failed to open replay profile file '%s' (Error %i).", filename.c_str(), result);
+        GFXRECON_LOG_ERROR("%s", std::strerror(result));
+    }
+
+    return success;
+}
+
+size_t ReplayProfiler::GetHistogramBucket(int64_t duration)
+{
+    size_t   bucket = 0;
+    uint64_t value  = static_cast<uint64_t>(std::max(duration, int64_t{ 1 })) >> 1;
+
+    while (value != 0)
+    {
+        ++bucket;
+        value >>= 1;
+    }
+
+    return bucket;
+}
+
+int64_t ReplayProfiler::GetPercentile(const CallStats& stats, double percentile)
+{
+    uint64_t target     = static_cast<uint64_t>(std::ceil(static_cast<double>(stats.count) * percentile));
+    uint64_t cumulative = 0;
+
+    for (size_t i = 0; i < kHistogramBucketCount; ++i)
+    {
+        cumulative += stats.histogram[i];
+        if (cumulative >= target)
+        {
+            // Bucket upper bounds past the range of int64_t are limited to the maximum recorded time.
+            return (i < 62) ? std::min(int64_t{ 1 } << (i + 1), stats.max_time) : stats.max_time;
+        }
+    }
+
+    return stats.max_time;
+}
+
+void ReplayProfiler::CompleteFrame(int64_t end_time)
+{
+    current_frame_.total_time = util::datetime::DiffTimestamps(current_frame_.start_time, end_time);
+    frame_stats_.push_back(current_frame_);
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,131 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_REPLAY_PROFILER_H
+#define GFXRECON_DECODE_REPLAY_PROFILER_H
+
+#include "format/api_call_id.h"
+#include "util/date_time.h"
+#include "util/defines.h"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Records the CPU time spent replaying each API call and each frame.  Frame time is split into the time spent reading
+// and decompressing blocks, the time spent decoding and dispatching API calls, and the time spent in the driver calls
+// that are timed by the replay consumers.  All times are recorded by the thread processing the capture file.
+class ReplayProfiler
+{
+  public:
+    // Adds the duration of the enclosing scope to the driver time of the API call being replayed.
+    class ScopedDriverTimer
+    {
+      public:
+        ScopedDriverTimer(ReplayProfiler* profiler) :
+            profiler_(profiler), start_time_((profiler != nullptr) ? util::datetime::GetTimestamp() : 0)
+        {}
+
+        ~ScopedDriverTimer()
+        {
+            if (profiler_ != nullptr)
+            {
+                profiler_->AddDriverTime(util::datetime::DiffTimestamps(start_time_, util::datetime::GetTimestamp()));
+            }
+        }
+
+      private:
+        ReplayProfiler* profiler_;
+        int64_t         start_time_;
+    };
+
+  public:
+    ReplayProfiler();
+
+    // Starts a new frame record when frame_number differs from the frame being recorded.
+    void SetFrame(uint64_t frame_number);
+
+    void AddReadTime(int64_t duration) { current_frame_.read_time += duration; }
+
+    void AddDriverTime(int64_t duration) { current_frame_.driver_time += duration; }
+
+    void BeginCall();
+
+    void EndCall(format::ApiCallId call_id);
+
+    // Completes the frame being recorded.  Must be called before the report is written.
+    void EndFile();
+
+    void LogToConsole() const;
+
+    bool WriteReport(const std::string& filename) const;
+
+  private:
+    // Histogram bucket N counts the calls with durations in the range [2^N, 2^(N+1)) nanoseconds.
+    static const size_t kHistogramBucketCount = 64;
+
+    struct CallStats
+    {
+        uint64_t                                    count{ 0 };
+        int64_t                                     total_time{ 0 };
+        int64_t                                     driver_time{ 0 };
+        int64_t                                     min_time{ 0 };
+        int64_t                                     max_time{ 0 };
+        std::array<uint64_t, kHistogramBucketCount> histogram{};
+    };
+
+    struct FrameStats
+    {
+        uint64_t frame_number{ 0 };
+        int64_t  start_time{ 0 };
+        int64_t  total_time{ 0 };
+        int64_t  read_time{ 0 };
+        int64_t  decode_time{ 0 };
+        int64_t  driver_time{ 0 };
+    };
+
+  private:
+    static size_t GetHistogramBucket(int64_t duration);
+
+    // Returns the upper bound of the histogram bucket containing the specified percentile, in nanoseconds.
+    static int64_t GetPercentile(const CallStats& stats, double percentile);
+
+    void CompleteFrame(int64_t end_time);
+
+  private:
+    std::unordered_map<format::ApiCallId, CallStats> call_stats_;
+    std::vector<FrameStats>                          frame_stats_;
+    FrameStats                                       current_frame_;
+    bool                                             frame_started_;
+    int64_t                                          call_start_time_;
+    int64_t                                          call_start_driver_time_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_REPLAY_PROFILER_H
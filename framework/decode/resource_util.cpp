@@ -22,7 +22,7 @@
 
 #include "decode/resource_util.h"
 
-#include "util/platform.h"
+#include "util/memory_copy.h"
 
 #include <algorithm>
 
@@ -47,7 +47,7 @@ void CopyImageSubresourceMemory(uint8_t*       dst,
         size_t copy_size        = std::min(size, (subresource_size - offset));
 
         // Copy entire range without adjustment.
-        util::platform::MemoryCopy(dst + offset, copy_size, src, copy_size);
+        util::StreamingMemoryCopy(dst + offset, src, copy_size);
     }
     else
     {
@@ -75,7 +75,7 @@ void CopyImageSubresourceMemory(uint8_t*       dst,
         {
             // Handle row with both partial begin and end positions.
             size_t copy_size = std::min(copy_row_pitch - row_offset, size);
-            util::platform::MemoryCopy(copy_dst, copy_size, copy_src, copy_size);
+            util::StreamingMemoryCopy(copy_dst, copy_src, copy_size);
 
             copy_src += src_row_pitch - row_offset;
             copy_dst += dst_row_pitch - row_offset;
@@ -104,7 +104,7 @@ void CopyImageSubresourceMemory(uint8_t*       dst,
             for (size_t i = 0; i < total_rows; ++i)
             {
                 size_t copy_size = copy_row_pitch;
-                util::platform::MemoryCopy(copy_dst, copy_size, copy_src, copy_size);
+                util::StreamingMemoryCopy(copy_dst, copy_src, copy_size);
 
                 copy_src += src_row_pitch;
                 copy_dst += dst_row_pitch;
@@ -114,7 +114,7 @@ void CopyImageSubresourceMemory(uint8_t*       dst,
             if (row_remainder != 0)
             {
                 size_t copy_size = std::min(copy_row_pitch, row_remainder);
-                util::platform::MemoryCopy(copy_dst, copy_size, copy_src, copy_size);
+                util::StreamingMemoryCopy(copy_dst, copy_src, copy_size);
             }
         }
     }
@@ -51,9 +51,9 @@ class BasicStringArrayDecoder : public PointerDecoderBase
 
     const CharT* const* GetPointer() const { return strings_; }
 
-    size_t Decode(const uint8_t* buffer, size_t buffer_size)
+    size_t Decode(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)
     {
-        size_t bytes_read = DecodeAttributes(buffer, buffer_size);
+        size_t bytes_read = DecodeAttributes(buffer, buffer_size, compact_encoding);
 
         // We should only be decoding string arrays.
         assert((GetAttributeMask() & (DecodeAttrib | format::PointerAttributes::kIsArray)) ==
@@ -70,8 +70,8 @@ class BasicStringArrayDecoder : public PointerDecoderBase
             for (size_t i = 0; i < len; ++i)
             {
                 uint32_t attrib = 0;
-                bytes_read +=
-                    ValueDecoder::DecodeUInt32Value((buffer + bytes_read), (buffer_size - bytes_read), &attrib);
+                bytes_read += ValueDecoder::DecodeUInt32Value(
+                    (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &attrib);
 
                 if ((attrib & format::PointerAttributes::kIsNull) != format::PointerAttributes::kIsNull)
                 {
@@ -84,8 +84,8 @@ class BasicStringArrayDecoder : public PointerDecoderBase
                     assert((attrib & DecodeAttrib) == DecodeAttrib);
 
                     size_t slen = 0;
-                    bytes_read +=
-                        ValueDecoder::DecodeSizeTValue((buffer + bytes_read), (buffer_size - bytes_read), &slen);
+                    bytes_read += ValueDecoder::DecodeSizeTValue(
+                        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &slen);
 
                     CharT* value = DecodeAllocator::Allocate<CharT>(slen + 1, false);
 
@@ -60,9 +60,9 @@ class BasicStringDecoder : public PointerDecoderBase
         }
     }
 
-    size_t Decode(const uint8_t* buffer, size_t buffer_size)
+    size_t Decode(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)
     {
-        size_t bytes_read = DecodeAttributes(buffer, buffer_size);
+        size_t bytes_read = DecodeAttributes(buffer, buffer_size, compact_encoding);
 
         // We should only be decoding individual strings.
         assert((GetAttributeMask() & DecodeAttrib) == DecodeAttrib);
@@ -99,9 +99,9 @@ class StructPointerDecoder : public PointerDecoderBase
         }
     }
 
-    size_t Decode(const uint8_t* buffer, size_t buffer_size)
+    size_t Decode(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)
     {
-        size_t bytes_read = DecodeAttributes(buffer, buffer_size);
+        size_t bytes_read = DecodeAttributes(buffer, buffer_size, compact_encoding);
 
         // We should only be decoding structs.
         assert((GetAttributeMask() & format::PointerAttributes::kIsStruct) == format::PointerAttributes::kIsStruct);
@@ -147,7 +147,8 @@ class StructPointerDecoder : public PointerDecoderBase
                     // Note: We only expect this class to be used with structs that have a decode_struct function.
                     //       If an error is encoutered here due to a new struct type, the struct decoders need to be
                     //       updated to support the new type.
-                    bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), &decoded_structs_[i]);
+                    bytes_read += DecodeStruct(
+                        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &decoded_structs_[i]);
                 }
             }
         }
@@ -184,9 +185,9 @@ class StructPointerDecoder<T*> : public PointerDecoderBase
 
     const typename T::struct_type** GetPointer() const { return struct_memory_; }
 
-    size_t Decode(const uint8_t* buffer, size_t buffer_size)
+    size_t Decode(const uint8_t* buffer, size_t buffer_size, bool compact_encoding)
     {
-        size_t bytes_read = DecodeAttributes(buffer, buffer_size);
+        size_t bytes_read = DecodeAttributes(buffer, buffer_size, compact_encoding);
 
         // We should only be decoding 2D struct arrays.
         assert((GetAttributeMask() & (format::PointerAttributes::kIsStruct | format::PointerAttributes::kIsArray2D)) ==
@@ -203,8 +204,8 @@ class StructPointerDecoder<T*> : public PointerDecoderBase
             for (size_t i = 0; i < len; ++i)
             {
                 uint32_t attrib = 0;
-                bytes_read +=
-                    ValueDecoder::DecodeUInt32Value((buffer + bytes_read), (buffer_size - bytes_read), &attrib);
+                bytes_read += ValueDecoder::DecodeUInt32Value(
+                    (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &attrib);
 
                 if ((attrib & format::PointerAttributes::kIsNull) != format::PointerAttributes::kIsNull)
                 {
@@ -218,7 +219,7 @@ class StructPointerDecoder<T*> : public PointerDecoderBase
                     assert((attrib & format::PointerAttributes::kIsStruct) == format::PointerAttributes::kIsStruct);
 
                     bytes_read += ValueDecoder::DecodeSizeTValue(
-                        (buffer + bytes_read), (buffer_size - bytes_read), &inner_lens_[i]);
+                        (buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &inner_lens_[i]);
 
                     typename T::struct_type* inner_struct_memory =
                         DecodeAllocator::Allocate<typename T::struct_type>(inner_lens_[i]);
@@ -230,8 +231,10 @@ class StructPointerDecoder<T*> : public PointerDecoderBase
                         // Note: We only expect this class to be used with structs that have a decode_struct function.
                         //       If an error is encoutered here due to a new struct type, the struct decoders need to be
                         //       updated to support the new type.
-                        bytes_read +=
-                            DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), &inner_decoded_structs[j]);
+                        bytes_read += DecodeStruct((buffer + bytes_read),
+                                                   (buffer_size - bytes_read),
+                                                   compact_encoding,
+                                                   &inner_decoded_structs[j]);
                     }
 
                     struct_memory_[i]   = inner_struct_memory;
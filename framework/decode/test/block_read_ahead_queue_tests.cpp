@@ -0,0 +1,339 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/block_read_ahead_queue.h"
+#include "format/format.h"
+#include "util/compressor.h"
+#include "util/platform.h"
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace gfxrecon;
+
+namespace
+{
+
+const uint8_t kCompressionKey = 0x5a;
+
+// Reversible stand-in for a real compressor, so that the tests do not depend on the compression libraries in the
+// build. Records the threads that decompress data.
+class XorCompressor : public util::Compressor
+{
+  public:
+    virtual size_t Compress(const size_t          uncompressed_size,
+                            const uint8_t*        uncompressed_data,
+                            std::vector<uint8_t>* compressed_data,
+                            size_t                compressed_data_offset) override
+    {
+        compressed_data->resize(compressed_data_offset + uncompressed_size);
+        for (size_t i = 0; i < uncompressed_size; ++i)
+        {
+            (*compressed_data)[compressed_data_offset + i] = uncompressed_data[i] ^ kCompressionKey;
+        }
+
+        return uncompressed_size;
+    }
+
+    virtual size_t Decompress(const size_t   compressed_size,
+                              const uint8_t* compressed_data,
+                              const size_t   expected_uncompressed_size,
+                              uint8_t*       uncompressed_data) override
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            decompression_threads_.insert(std::this_thread::get_id());
+        }
+
+        if (compressed_size != expected_uncompressed_size)
+        {
+            return 0;
+        }
+
+        for (size_t i = 0; i < compressed_size; ++i)
+        {
+            uncompressed_data[i] = compressed_data[i] ^ kCompressionKey;
+        }
+
+        return compressed_size;
+    }
+
+    std::set<std::thread::id> GetDecompressionThreads()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return decompression_threads_;
+    }
+
+  private:
+    std::mutex                mutex_;
+    std::set<std::thread::id> decompression_threads_;
+};
+
+std::vector<uint8_t> MakePayload(size_t size, uint8_t seed)
+{
+    std::vector<uint8_t> payload(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        payload[i] = static_cast<uint8_t>(seed + i);
+    }
+
+    return payload;
+}
+
+// Builds a capture block stream in a file, and the stream that the queue is expected to return for it, in which
+// compressed blocks have been replaced by uncompressed blocks.
+class BlockStream
+{
+  public:
+    BlockStream() : file_(std::tmpfile()) { REQUIRE(file_ != nullptr); }
+
+    ~BlockStream() { fclose(file_); }
+
+    FILE* GetFile() { return file_; }
+
+    const std::vector<uint8_t>& GetExpected() const { return expected_; }
+
+    const std::vector<int64_t>& GetBlockOffsets() const { return block_offsets_; }
+
+    void AddFunctionCall(const std::vector<uint8_t>& payload, bool compress)
+    {
+        format::FunctionCallHeader header{};
+        header.block_header.size = sizeof(header.api_call_id) + sizeof(header.thread_id) + payload.size();
+        header.block_header.type = format::BlockType::kFunctionCallBlock;
+        header.api_call_id       = format::ApiCallId::ApiCall_vkCmdDraw;
+        header.thread_id         = 1;
+
+        Append(&expected_, &header, sizeof(header));
+        Append(&expected_, payload.data(), payload.size());
+
+        block_offsets_.push_back(util::platform::FileTell(file_));
+
+        if (compress)
+        {
+            std::vector<uint8_t> compressed;
+            compressor_.Compress(payload.size(), payload.data(), &compressed, 0);
+
+            format::CompressedFunctionCallHeader compressed_header{};
+            compressed_header.block_header.size =
+                sizeof(compressed_header) - sizeof(format::BlockHeader) + compressed.size();
+            compressed_header.block_header.type = format::BlockType::kCompressedFunctionCallBlock;
+            compressed_header.api_call_id       = header.api_call_id;
+            compressed_header.thread_id         = header.thread_id;
+            compressed_header.uncompressed_size = payload.size();
+
+            WriteFile(&compressed_header, sizeof(compressed_header));
+            WriteFile(compressed.data(), compressed.size());
+        }
+        else
+        {
+            WriteFile(&header, sizeof(header));
+            WriteFile(payload.data(), payload.size());
+        }
+    }
+
+    // Writes a block header and only part of the block body, as at the end of a capture that was not closed.
+    void AddTruncatedBlock()
+    {
+        format::BlockHeader header{};
+        header.size = 100;
+        header.type = format::BlockType::kFunctionCallBlock;
+
+        std::vector<uint8_t> partial_body(10, 0xff);
+
+        WriteFile(&header, sizeof(header));
+        WriteFile(partial_body.data(), partial_body.size());
+    }
+
+    void Rewind() { REQUIRE(util::platform::FileSeek(file_, 0, util::platform::FileSeekSet)); }
+
+  private:
+    static void Append(std::vector<uint8_t>* data, const void* source, size_t size)
+    {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(source);
+        data->insert(data->end(), bytes, bytes + size);
+    }
+
+    void WriteFile(const void* data, size_t size) { REQUIRE(fwrite(data, 1, size, file_) == size); }
+
+  private:
+    FILE*                file_;
+    XorCompressor        compressor_;
+    std::vector<uint8_t> expected_;
+    std::vector<int64_t> block_offsets_;
+};
+
+std::vector<uint8_t> ReadToEnd(decode::BlockReadAheadQueue* queue)
+{
+    std::vector<uint8_t> data;
+    format::BlockHeader  header{};
+
+    while (queue->ReadBytes(&header, sizeof(header)))
+    {
+        const uint8_t* header_bytes = reinterpret_cast<const uint8_t*>(&header);
+        data.insert(data.end(), header_bytes, header_bytes + sizeof(header));
+
+        // Block bodies are contiguous, so they can be read in place.
+        const uint8_t* body = queue->ReadBytesInPlace(static_cast<size_t>(header.size));
+        REQUIRE(body != nullptr);
+        data.insert(data.end(), body, body + header.size);
+    }
+
+    return data;
+}
+
+} // namespace
+
+TEST_CASE("BlockReadAheadQueue returns blocks in file order", "[block_read_ahead_queue][pre_submit]")
+{
+    // Decompression on the reader thread, and on a pool of decompression threads.
+    const size_t decompression_thread_count = GENERATE(0, 3);
+
+    BlockStream stream;
+    for (uint32_t i = 0; i < 200; ++i)
+    {
+        stream.AddFunctionCall(MakePayload(16 + (i * 37) % 1000, static_cast<uint8_t>(i)), (i % 3) != 0);
+    }
+
+    stream.Rewind();
+
+    XorCompressor               compressor;
+    decode::BlockReadAheadQueue queue(8, decompression_thread_count);
+    queue.Start(stream.GetFile(), &compressor);
+
+    REQUIRE(ReadToEnd(&queue) == stream.GetExpected());
+    REQUIRE(queue.IsAtEnd());
+    REQUIRE(!queue.IsError());
+
+    queue.Stop();
+
+    const auto threads = compressor.GetDecompressionThreads();
+    REQUIRE(!threads.empty());
+    REQUIRE(threads.count(std::this_thread::get_id()) == 0);
+
+    if (decompression_thread_count == 0)
+    {
+        // Every block was decompressed by the single reader thread.
+        REQUIRE(threads.size() == 1);
+    }
+}
+
+TEST_CASE("BlockReadAheadQueue reads across block boundaries", "[block_read_ahead_queue][pre_submit]")
+{
+    BlockStream stream;
+    stream.AddFunctionCall(MakePayload(64, 1), false);
+    stream.AddFunctionCall(MakePayload(64, 2), true);
+    stream.Rewind();
+
+    XorCompressor               compressor;
+    decode::BlockReadAheadQueue queue(4, 0);
+    queue.Start(stream.GetFile(), &compressor);
+
+    const std::vector<uint8_t>& expected   = stream.GetExpected();
+    const size_t                first_size = sizeof(format::FunctionCallHeader) + 64;
+    const size_t                skip_size  = first_size - 8;
+
+    REQUIRE(queue.SkipBytes(skip_size));
+
+    // The next 16 bytes are the end of the first block and the start of the second, which are not contiguous.
+    REQUIRE(queue.ReadBytesInPlace(16) == nullptr);
+
+    uint8_t spanning[16] = {};
+    REQUIRE(queue.ReadBytes(spanning, sizeof(spanning)));
+    REQUIRE(std::vector<uint8_t>(spanning, spanning + sizeof(spanning)) ==
+            std::vector<uint8_t>(expected.begin() + skip_size, expected.begin() + skip_size + sizeof(spanning)));
+
+    const size_t   remaining_size = expected.size() - skip_size - sizeof(spanning);
+    const uint8_t* remaining      = queue.ReadBytesInPlace(remaining_size);
+    REQUIRE(remaining != nullptr);
+    REQUIRE(std::vector<uint8_t>(remaining, remaining + remaining_size) ==
+            std::vector<uint8_t>(expected.end() - remaining_size, expected.end()));
+
+    uint8_t byte = 0;
+    REQUIRE(!queue.ReadBytes(&byte, sizeof(byte)));
+    REQUIRE(queue.IsAtEnd());
+}
+
+TEST_CASE("BlockReadAheadQueue stops at a truncated final block", "[block_read_ahead_queue][pre_submit]")
+{
+    BlockStream stream;
+    stream.AddFunctionCall(MakePayload(32, 1), false);
+    stream.AddFunctionCall(MakePayload(32, 2), true);
+    stream.AddTruncatedBlock();
+    stream.Rewind();
+
+    XorCompressor               compressor;
+    decode::BlockReadAheadQueue queue(4, 2);
+    queue.Start(stream.GetFile(), &compressor);
+
+    // The complete blocks are returned, and the truncated block is not.
+    REQUIRE(ReadToEnd(&queue) == stream.GetExpected());
+    REQUIRE(queue.IsAtEnd());
+    REQUIRE(!queue.IsError());
+}
+
+TEST_CASE("BlockReadAheadQueue resumes from the next block file offset", "[block_read_ahead_queue][pre_submit]")
+{
+    const uint32_t kBlockCount = 20;
+
+    BlockStream stream;
+    for (uint32_t i = 0; i < kBlockCount; ++i)
+    {
+        stream.AddFunctionCall(MakePayload(100 + i, static_cast<uint8_t>(i)), (i % 2) == 0);
+    }
+
+    stream.Rewind();
+
+    XorCompressor               compressor;
+    decode::BlockReadAheadQueue queue(8, 2);
+    queue.Start(stream.GetFile(), &compressor);
+
+    REQUIRE(queue.GetNextBlockFileOffset() == 0);
+
+    // Consume the first three blocks completely. The reader has read further ahead in the file.
+    format::BlockHeader header{};
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        REQUIRE(queue.ReadBytes(&header, sizeof(header)));
+        REQUIRE(queue.SkipBytes(static_cast<size_t>(header.size)));
+    }
+
+    const int64_t next_offset = queue.GetNextBlockFileOffset();
+    REQUIRE(next_offset == stream.GetBlockOffsets()[3]);
+
+    queue.Stop();
+
+    // Reading resumes with the fourth block, from a file position set by the caller.
+    REQUIRE(util::platform::FileSeek(stream.GetFile(), next_offset, util::platform::FileSeekSet));
+    queue.Start(stream.GetFile(), &compressor);
+
+    REQUIRE(queue.GetNextBlockFileOffset() == next_offset);
+
+    const std::vector<uint8_t>& expected      = stream.GetExpected();
+    const size_t                consumed_size = 3 * sizeof(format::FunctionCallHeader) + 100 + 101 + 102;
+    REQUIRE(ReadToEnd(&queue) == std::vector<uint8_t>(expected.begin() + consumed_size, expected.end()));
+}
@@ -0,0 +1,154 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/columnar_call_writer.h"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+using namespace gfxrecon;
+
+namespace
+{
+
+class VectorOutputStream : public util::OutputStream
+{
+  public:
+    virtual bool IsValid() override { return true; }
+
+    virtual bool Write(const void* data, size_t len) override
+    {
+        auto bytes = static_cast<const uint8_t*>(data);
+        output.insert(output.end(), bytes, bytes + len);
+        return true;
+    }
+
+    std::vector<uint8_t> output;
+};
+
+template <typename T>
+T Read(const std::vector<uint8_t>& data, size_t& offset)
+{
+    T value;
+    REQUIRE(offset + sizeof(T) <= data.size());
+    std::memcpy(&value, data.data() + offset, sizeof(T));
+    offset += sizeof(T);
+    return value;
+}
+
+decode::ColumnarCallRow MakeRow(uint32_t i)
+{
+    decode::ColumnarCallRow row;
+    row.block_index  = 10 + i;
+    row.call_id      = format::ApiCallId::ApiCall_vkCmdDraw;
+    row.thread_id    = 1 + (i % 2);
+    row.frame_number = 1 + (i / 4);
+    row.handle_id    = 0x100 + i;
+    row.payload_size = 24 + i;
+    return row;
+}
+
+} // namespace
+
+TEST_CASE("ColumnarCallWriter writes rows in chunks of columns", "[columnar][pre_submit]")
+{
+    const uint32_t kChunkRows = 4;
+    const uint32_t kRowCount  = 10;
+
+    VectorOutputStream         stream;
+    decode::ColumnarCallWriter writer(&stream, format::CompressionType::kNone, kChunkRows);
+
+    REQUIRE(writer.WriteHeader());
+
+    for (uint32_t i = 0; i < kRowCount; ++i)
+    {
+        writer.AddRow(MakeRow(i));
+    }
+
+    REQUIRE(writer.Flush());
+    REQUIRE(writer.GetRowCount() == kRowCount);
+
+    size_t offset      = 0;
+    auto   file_header = Read<decode::ColumnarFileHeader>(stream.output, offset);
+    REQUIRE(file_header.fourcc == GFXRECON_COLUMNAR_FOURCC);
+    REQUIRE(file_header.version == decode::kColumnarVersion);
+    REQUIRE(file_header.column_count == decode::kColumnCount);
+
+    std::vector<uint32_t> value_sizes;
+    for (uint32_t i = 0; i < file_header.column_count; ++i)
+    {
+        auto column_info = Read<decode::ColumnarColumnInfo>(stream.output, offset);
+        REQUIRE(column_info.column == i);
+        value_sizes.push_back(column_info.value_size);
+    }
+
+    uint32_t row = 0;
+    while (offset < stream.output.size())
+    {
+        auto chunk_header = Read<decode::ColumnarChunkHeader>(stream.output, offset);
+        REQUIRE(chunk_header.column_count == decode::kColumnCount);
+        REQUIRE(chunk_header.row_count == std::min(kChunkRows, kRowCount - row));
+
+        std::vector<decode::ColumnarColumnChunkHeader> column_headers;
+        for (uint32_t i = 0; i < chunk_header.column_count; ++i)
+        {
+            column_headers.push_back(Read<decode::ColumnarColumnChunkHeader>(stream.output, offset));
+            REQUIRE(column_headers.back().column == i);
+            REQUIRE(column_headers.back().compression_type == format::CompressionType::kNone);
+            REQUIRE(column_headers.back().data_size == value_sizes[i] * chunk_header.row_count);
+        }
+
+        std::vector<size_t> column_offsets;
+        for (const auto& column_header : column_headers)
+        {
+            // Column data starts on an aligned offset, so that it can be read in place.
+            REQUIRE((offset % decode::kColumnarAlignment) == 0);
+            column_offsets.push_back(offset);
+            offset += (column_header.data_size + decode::kColumnarAlignment - 1) & ~(decode::kColumnarAlignment - 1);
+        }
+
+        for (uint32_t i = 0; i < chunk_header.row_count; ++i, ++row)
+        {
+            const auto expected = MakeRow(row);
+
+            size_t block_index_offset  = column_offsets[decode::kColumnBlockIndex] + i * sizeof(uint64_t);
+            size_t call_id_offset      = column_offsets[decode::kColumnApiCallId] + i * sizeof(format::ApiCallId);
+            size_t thread_id_offset    = column_offsets[decode::kColumnThreadId] + i * sizeof(format::ThreadId);
+            size_t frame_offset        = column_offsets[decode::kColumnFrameNumber] + i * sizeof(uint32_t);
+            size_t handle_id_offset    = column_offsets[decode::kColumnHandleId] + i * sizeof(format::HandleId);
+            size_t payload_size_offset = column_offsets[decode::kColumnPayloadSize] + i * sizeof(uint64_t);
+
+            REQUIRE(Read<uint64_t>(stream.output, block_index_offset) == expected.block_index);
+            REQUIRE(Read<format::ApiCallId>(stream.output, call_id_offset) == expected.call_id);
+            REQUIRE(Read<format::ThreadId>(stream.output, thread_id_offset) == expected.thread_id);
+            REQUIRE(Read<uint32_t>(stream.output, frame_offset) == expected.frame_number);
+            REQUIRE(Read<format::HandleId>(stream.output, handle_id_offset) == expected.handle_id);
+            REQUIRE(Read<uint64_t>(stream.output, payload_size_offset) == expected.payload_size);
+        }
+    }
+
+    REQUIRE(row == kRowCount);
+    REQUIRE(offset == stream.output.size());
+}
@@ -0,0 +1,75 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/decode_allocator.h"
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <thread>
+
+using gfxrecon::decode::DecodeAllocator;
+
+TEST_CASE("DecodeAllocator keeps an instance and statistics for each thread", "[decode_allocator][pre_submit]")
+{
+    const size_t kAllocationCount = 16;
+
+    DecodeAllocator::DestroyInstance();
+
+    DecodeAllocator::Begin();
+    uint32_t* values = DecodeAllocator::Allocate<uint32_t>(kAllocationCount);
+    REQUIRE(values != nullptr);
+
+    // Another thread decodes with its own instance while this thread's allocations are in use.
+    DecodeAllocator::Statistics other_statistics;
+    std::thread                 other_thread([&other_statistics]() {
+        for (size_t i = 1; i <= kAllocationCount; ++i)
+        {
+            DecodeAllocator::Begin();
+            uint64_t* other_values = DecodeAllocator::Allocate<uint64_t>(i);
+            other_values[i - 1]    = i;
+            DecodeAllocator::End();
+        }
+
+        other_statistics = DecodeAllocator::GetStatistics();
+    });
+    other_thread.join();
+
+    for (size_t i = 0; i < kAllocationCount; ++i)
+    {
+        values[i] = static_cast<uint32_t>(i);
+    }
+
+    DecodeAllocator::End();
+
+    REQUIRE(other_statistics.scope_count == kAllocationCount);
+    REQUIRE(other_statistics.peak_size == kAllocationCount * sizeof(uint64_t));
+    REQUIRE(other_statistics.GetAverageSize() == ((kAllocationCount + 1) * sizeof(uint64_t)) / 2);
+
+    DecodeAllocator::Statistics statistics = DecodeAllocator::GetStatistics();
+    REQUIRE(statistics.scope_count == 1);
+    REQUIRE(statistics.peak_size == kAllocationCount * sizeof(uint32_t));
+    REQUIRE(statistics.GetAverageSize() == kAllocationCount * sizeof(uint32_t));
+
+    DecodeAllocator::DestroyInstance();
+    REQUIRE(DecodeAllocator::GetStatistics().scope_count == 0);
+}
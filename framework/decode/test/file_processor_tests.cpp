@@ -0,0 +1,710 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/api_decoder.h"
+#include "decode/file_processor.h"
+#include "format/format.h"
+#include "format/format_util.h"
+#include "util/compressor.h"
+#include "util/platform.h"
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace gfxrecon;
+
+namespace
+{
+
+const char kCaptureFilename[] = "gfxrecon_file_processor_test.gfxr";
+
+struct FillMemory
+{
+    uint64_t             memory_id;
+    std::vector<uint8_t> data;
+};
+
+struct InitBuffer
+{
+    uint64_t             buffer_id;
+    std::vector<uint8_t> data;
+};
+
+// Records the fill memory and buffer initialization commands dispatched by the file processor.
+class FillMemoryDecoder : public decode::ApiDecoder
+{
+  public:
+    virtual bool IsComplete(uint64_t block_index) override { return false; }
+
+    virtual void WaitIdle() override {}
+
+    virtual void DispatchDriverInfo(format::ThreadId thread_id, format::DriverInfoBlock& info) override {}
+
+    virtual void DispatchExeFileInfo(format::ThreadId thread_id, format::ExeFileInfoBlock& info) override {}
+
+    virtual bool SupportsApiCall(format::ApiCallId id) override { return true; }
+
+    virtual bool SupportsMetaDataId(format::MetaDataId meta_data_id) override { return true; }
+
+    virtual void DecodeFunctionCall(format::ApiCallId          id,
+                                    const decode::ApiCallInfo& call_info,
+                                    const uint8_t*             buffer,
+                                    size_t                     buffer_size) override
+    {}
+
+    virtual void DecodeMethodCall(format::ApiCallId          call_id,
+                                  format::HandleId           object_id,
+                                  const decode::ApiCallInfo& call_options,
+                                  const uint8_t*             parameter_buffer,
+                                  size_t                     buffer_size) override
+    {}
+
+    virtual void
+    DispatchFillMemoryResourceValueCommand(const format::FillMemoryResourceValueCommandHeader& command_header,
+                                           const uint8_t*                                      data) override
+    {}
+
+    virtual void DispatchStateBeginMarker(uint64_t frame_number) override {}
+
+    virtual void DispatchStateEndMarker(uint64_t frame_number) override {}
+
+    virtual void DispatchFrameEndMarker(uint64_t frame_number) override {}
+
+    virtual void DispatchDisplayMessageCommand(format::ThreadId thread_id, const std::string& message) override {}
+
+    virtual void DispatchFillMemoryCommand(
+        format::ThreadId thread_id, uint64_t memory_id, uint64_t offset, uint64_t size, const uint8_t* data) override
+    {
+        fill_memory_.push_back({ memory_id, std::vector<uint8_t>(data, data + size) });
+    }
+
+    virtual void DispatchResizeWindowCommand(format::ThreadId thread_id,
+                                             format::HandleId surface_id,
+                                             uint32_t         width,
+                                             uint32_t         height) override
+    {}
+
+    virtual void DispatchResizeWindowCommand2(format::ThreadId thread_id,
+                                              format::HandleId surface_id,
+                                              uint32_t         width,
+                                              uint32_t         height,
+                                              uint32_t         pre_transform) override
+    {}
+
+    virtual void
+    DispatchCreateHardwareBufferCommand(format::ThreadId                                    thread_id,
+                                        format::HandleId                                    memory_id,
+                                        uint64_t                                            buffer_id,
+                                        uint32_t                                            format,
+                                        uint32_t                                            width,
+                                        uint32_t                                            height,
+                                        uint32_t                                            stride,
+                                        uint64_t                                            usage,
+                                        uint32_t                                            layers,
+                                        const std::vector<format::HardwareBufferPlaneInfo>& plane_info) override
+    {}
+
+    virtual void DispatchDestroyHardwareBufferCommand(format::ThreadId thread_id, uint64_t buffer_id) override {}
+
+    virtual void DispatchCreateHeapAllocationCommand(format::ThreadId thread_id,
+                                                     uint64_t         allocation_id,
+                                                     uint64_t         allocation_size) override
+    {}
+
+    virtual void DispatchSetDevicePropertiesCommand(format::ThreadId   thread_id,
+                                                    format::HandleId   physical_device_id,
+                                                    uint32_t           api_version,
+                                                    uint32_t           driver_version,
+                                                    uint32_t           vendor_id,
+                                                    uint32_t           device_id,
+                                                    uint32_t           device_type,
+                                                    const uint8_t      pipeline_cache_uuid[format::kUuidSize],
+                                                    const std::string& device_name) override
+    {}
+
+    virtual void
+    DispatchSetDeviceMemoryPropertiesCommand(format::ThreadId                             thread_id,
+                                             format::HandleId                             physical_device_id,
+                                             const std::vector<format::DeviceMemoryType>& memory_types,
+                                             const std::vector<format::DeviceMemoryHeap>& memory_heaps) override
+    {}
+
+    virtual void DispatchSetOpaqueAddressCommand(format::ThreadId thread_id,
+                                                 format::HandleId device_id,
+                                                 format::HandleId object_id,
+                                                 uint64_t         address) override
+    {}
+
+    virtual void DispatchSetRayTracingShaderGroupHandlesCommand(format::ThreadId thread_id,
+                                                                format::HandleId device_id,
+                                                                format::HandleId buffer_id,
+                                                                size_t           data_size,
+                                                                const uint8_t*   data) override
+    {}
+
+    virtual void
+    DispatchSetSwapchainImageStateCommand(format::ThreadId                                    thread_id,
+                                          format::HandleId                                    device_id,
+                                          format::HandleId                                    swapchain_id,
+                                          uint32_t                                            last_presented_image,
+                                          const std::vector<format::SwapchainImageStateInfo>& image_state) override
+    {}
+
+    virtual void DispatchBeginResourceInitCommand(format::ThreadId thread_id,
+                                                  format::HandleId device_id,
+                                                  uint64_t         max_resource_size,
+                                                  uint64_t         max_copy_size) override
+    {}
+
+    virtual void DispatchEndResourceInitCommand(format::ThreadId thread_id, format::HandleId device_id) override {}
+
+    virtual void DispatchInitBufferCommand(format::ThreadId thread_id,
+                                           format::HandleId device_id,
+                                           format::HandleId buffer_id,
+                                           uint64_t         data_size,
+                                           const uint8_t*   data) override
+    {
+        init_buffers_.push_back({ buffer_id, std::vector<uint8_t>(data, data + data_size) });
+    }
+
+    virtual void DispatchInitImageCommand(format::ThreadId             thread_id,
+                                          format::HandleId             device_id,
+                                          format::HandleId             image_id,
+                                          uint64_t                     data_size,
+                                          uint32_t                     aspect,
+                                          uint32_t                     layout,
+                                          const std::vector<uint64_t>& level_sizes,
+                                          const uint8_t*               data) override
+    {}
+
+    virtual void DispatchInitSubresourceCommand(const format::InitSubresourceCommandHeader& command_header,
+                                                const uint8_t*                              data) override
+    {}
+
+    virtual void DispatchInitDx12AccelerationStructureCommand(
+        const format::InitDx12AccelerationStructureCommandHeader&       command_header,
+        std::vector<format::InitDx12AccelerationStructureGeometryDesc>& geometry_descs,
+        const uint8_t*                                                  build_inputs_data) override
+    {}
+
+    const std::vector<FillMemory>& GetFillMemory() const { return fill_memory_; }
+
+    const std::vector<InitBuffer>& GetInitBuffers() const { return init_buffers_; }
+
+  private:
+    std::vector<FillMemory> fill_memory_;
+    std::vector<InitBuffer> init_buffers_;
+};
+
+// Writes a capture file with fill memory data that is deduplicated with content data blocks.
+class CaptureWriter
+{
+  public:
+    CaptureWriter(const std::string&      filename,
+                  uint32_t                content_deduplication_limit = 1,
+                  format::CompressionType compression_type            = format::CompressionType::kNone) :
+        file_(nullptr)
+    {
+        util::platform::FileOpen(&file_, filename.c_str(), "wb");
+        REQUIRE(file_ != nullptr);
+
+        format::FileHeader     header    = { GFXRECON_FOURCC, 0, 0, 2 };
+        format::FileOptionPair options[] = { { format::FileOption::kContentDeduplication, content_deduplication_limit },
+                                             { format::FileOption::kCompressionType, compression_type } };
+        Write(&header, sizeof(header));
+        Write(options, sizeof(options));
+    }
+
+    ~CaptureWriter() { util::platform::FileClose(file_); }
+
+    void WriteContentData(uint64_t content_id, const std::vector<uint8_t>& data)
+    {
+        format::ContentDataCommandHeader header;
+        header.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+        header.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(header) + data.size();
+        header.meta_header.meta_data_id =
+            format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan, format::MetaDataType::kContentDataCommand);
+        header.thread_id  = 1;
+        header.content_id = content_id;
+        header.data_size  = data.size();
+
+        Write(&header, sizeof(header));
+        Write(data.data(), data.size());
+    }
+
+    void WriteFillMemoryContent(uint64_t memory_id, uint64_t content_id, uint64_t size)
+    {
+        format::FillMemoryContentCommandHeader header;
+        header.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+        header.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(header);
+        header.meta_header.meta_data_id      = format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan,
+                                                                 format::MetaDataType::kFillMemoryContentCommand);
+        header.thread_id                     = 1;
+        header.memory_id                     = memory_id;
+        header.memory_offset                 = 0;
+        header.memory_size                   = size;
+        header.content_id                    = content_id;
+
+        Write(&header, sizeof(header));
+    }
+
+    void WriteBeginResourceInit()
+    {
+        format::BeginResourceInitCommand command;
+        command.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+        command.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(command);
+        command.meta_header.meta_data_id      = format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan,
+                                                                  format::MetaDataType::kBeginResourceInitCommand);
+        command.thread_id                     = 1;
+        command.device_id                     = 1;
+        command.max_resource_size             = 0;
+        command.max_copy_size                 = 0;
+
+        Write(&command, sizeof(command));
+    }
+
+    void WriteEndResourceInit()
+    {
+        format::EndResourceInitCommand command;
+        command.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+        command.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(command);
+        command.meta_header.meta_data_id      = format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan,
+                                                                  format::MetaDataType::kEndResourceInitCommand);
+        command.thread_id                     = 1;
+        command.device_id                     = 1;
+
+        Write(&command, sizeof(command));
+    }
+
+    // Writes a compressed block when compressor is not null.
+    void WriteInitBuffer(uint64_t buffer_id, const std::vector<uint8_t>& data, util::Compressor* compressor)
+    {
+        std::vector<uint8_t> compressed_data;
+        const uint8_t*       block_data = data.data();
+        size_t               block_size = data.size();
+
+        format::InitBufferCommandHeader header;
+        header.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+
+        if (compressor != nullptr)
+        {
+            size_t compressed_size = compressor->Compress(data.size(), data.data(), &compressed_data, 0);
+
+            if ((compressed_size > 0) && (compressed_size < data.size()))
+            {
+                header.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+                block_data                           = compressed_data.data();
+                block_size                           = compressed_size;
+            }
+        }
+
+        header.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(header) + block_size;
+        header.meta_header.meta_data_id =
+            format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan, format::MetaDataType::kInitBufferCommand);
+        header.thread_id = 1;
+        header.device_id = 1;
+        header.buffer_id = buffer_id;
+        header.data_size = data.size();
+
+        Write(&header, sizeof(header));
+        Write(block_data, block_size);
+    }
+
+    void WriteFrameEndMarker(uint64_t frame_number)
+    {
+        format::Marker marker;
+        marker.header.type  = format::BlockType::kFrameMarkerBlock;
+        marker.header.size  = sizeof(marker) - sizeof(marker.header);
+        marker.marker_type  = format::MarkerType::kEndMarker;
+        marker.frame_number = frame_number;
+
+        Write(&marker, sizeof(marker));
+    }
+
+  private:
+    void Write(const void* data, size_t size) { REQUIRE(util::platform::FileWrite(data, size, file_)); }
+
+  private:
+    FILE* file_;
+};
+
+enum class ReadMode
+{
+    kFile,
+    kMemoryMapped,
+    kReadAhead
+};
+
+void ConfigureReadMode(decode::FileProcessor* file_processor, ReadMode read_mode)
+{
+    if (read_mode == ReadMode::kMemoryMapped)
+    {
+        file_processor->SetUseMemoryMappedFile(true);
+    }
+    else if (read_mode == ReadMode::kReadAhead)
+    {
+        file_processor->SetBlockReadAhead(4, 1);
+    }
+}
+
+} // namespace
+
+TEST_CASE("FileProcessor reads the content data blocks preceding a seek", "[file_processor][pre_submit]")
+{
+    const std::vector<uint8_t> content_1(300, 0x11);
+    const std::vector<uint8_t> content_2(400, 0x22);
+
+    {
+        // Blocks 0 to 2 are frame 0, blocks 3 to 5 are frame 1, and blocks 6 to 8 are frame 2.
+        CaptureWriter writer(kCaptureFilename);
+        writer.WriteContentData(1, content_1);
+        writer.WriteFillMemoryContent(1, 1, content_1.size());
+        writer.WriteFrameEndMarker(1);
+        writer.WriteContentData(2, content_2);
+        writer.WriteFillMemoryContent(2, 2, content_2.size());
+        writer.WriteFrameEndMarker(2);
+        writer.WriteFillMemoryContent(3, 1, content_1.size());
+        writer.WriteFillMemoryContent(4, 2, content_2.size());
+        writer.WriteFrameEndMarker(3);
+    }
+
+    const ReadMode read_mode = GENERATE(ReadMode::kFile, ReadMode::kMemoryMapped, ReadMode::kReadAhead);
+
+    {
+        decode::FileProcessor file_processor;
+        FillMemoryDecoder     decoder;
+
+        ConfigureReadMode(&file_processor, read_mode);
+        file_processor.AddDecoder(&decoder);
+        REQUIRE(file_processor.Initialize(kCaptureFilename));
+
+        SECTION("Seek to a frame")
+        {
+            REQUIRE(file_processor.SeekToFrame(2));
+            REQUIRE(file_processor.GetCurrentFrameNumber() == 2);
+            REQUIRE(file_processor.ProcessNextFrame());
+
+            const auto& fill_memory = decoder.GetFillMemory();
+            REQUIRE(fill_memory.size() == 2);
+            CHECK(fill_memory[0].memory_id == 3);
+            CHECK(fill_memory[0].data == content_1);
+            CHECK(fill_memory[1].memory_id == 4);
+            CHECK(fill_memory[1].data == content_2);
+        }
+
+        SECTION("Seek to a block after an unindexed content data block")
+        {
+            // The content data block for the fill memory block is between the start of the frame and the seek target.
+            REQUIRE(file_processor.SeekToBlock(4));
+            REQUIRE(file_processor.ProcessNextFrame());
+
+            const auto& fill_memory = decoder.GetFillMemory();
+            REQUIRE(fill_memory.size() == 1);
+            CHECK(fill_memory[0].memory_id == 2);
+            CHECK(fill_memory[0].data == content_2);
+        }
+
+        SECTION("Seek back to a frame after processing content data blocks")
+        {
+            REQUIRE(file_processor.ProcessNextFrame());
+            REQUIRE(file_processor.ProcessNextFrame());
+            REQUIRE(file_processor.SeekToFrame(1));
+            REQUIRE(file_processor.ProcessNextFrame());
+            REQUIRE(file_processor.ProcessNextFrame());
+
+            const auto& fill_memory = decoder.GetFillMemory();
+            REQUIRE(fill_memory.size() == 5);
+            CHECK(fill_memory[2].memory_id == 2);
+            CHECK(fill_memory[2].data == content_2);
+            CHECK(fill_memory[3].data == content_1);
+            CHECK(fill_memory[4].data == content_2);
+        }
+
+        CHECK(file_processor.GetErrorState() == decode::FileProcessor::kErrorNone);
+    }
+
+    std::remove(kCaptureFilename);
+}
+
+TEST_CASE("FileProcessor reads content data for frames converted on several threads", "[file_processor][pre_submit]")
+{
+    const size_t kFrameCount  = 8;
+    const size_t kThreadCount = 4;
+
+    auto make_content = [](size_t frame) { return std::vector<uint8_t>(256 + frame, static_cast<uint8_t>(frame + 1)); };
+
+    {
+        // Each frame fills memory from its own content data block, and every frame after the first also fills memory
+        // from the content data block of the first frame.
+        CaptureWriter writer(kCaptureFilename);
+        for (size_t frame = 0; frame < kFrameCount; ++frame)
+        {
+            const std::vector<uint8_t> content = make_content(frame);
+            writer.WriteContentData(frame + 1, content);
+            writer.WriteFillMemoryContent(frame + 1, frame + 1, content.size());
+
+            if (frame > 0)
+            {
+                writer.WriteFillMemoryContent(kFrameCount + frame, 1, make_content(0).size());
+            }
+
+            writer.WriteFrameEndMarker(frame + 1);
+        }
+    }
+
+    const ReadMode read_mode = GENERATE(ReadMode::kFile, ReadMode::kMemoryMapped, ReadMode::kReadAhead);
+
+    {
+        // As with gfxrecon-convert, the index is built once and shared by processors that each convert some of the
+        // frames.  Frames are assigned from last to first, so processors seek backward over content they have read.
+        decode::FileProcessor index_processor;
+        REQUIRE(index_processor.Initialize(kCaptureFilename));
+
+        const format::FileIndex* file_index = index_processor.GetFileIndex();
+        REQUIRE(file_index != nullptr);
+
+        // The index also has an entry for the end of the file, after the last frame end marker.
+        const size_t index_frame_count = file_index->GetFrames().size();
+        REQUIRE(index_frame_count == (kFrameCount + 1));
+
+        std::vector<std::vector<FillMemory>>      frame_fill_memory(index_frame_count);
+        std::vector<decode::FileProcessor::Error> frame_errors(index_frame_count, decode::FileProcessor::kErrorNone);
+        std::atomic<size_t>                       next_frame{ 0 };
+
+        auto convert_frames = [&]() {
+            decode::FileProcessor file_processor;
+            FillMemoryDecoder     decoder;
+
+            ConfigureReadMode(&file_processor, read_mode);
+            file_processor.AddDecoder(&decoder);
+
+            if (!file_processor.Initialize(kCaptureFilename))
+            {
+                return;
+            }
+
+            file_processor.SetFileIndex(*file_index);
+
+            for (size_t i = next_frame++; i < index_frame_count; i = next_frame++)
+            {
+                const size_t frame      = index_frame_count - 1 - i;
+                const size_t fill_start = decoder.GetFillMemory().size();
+
+                if (file_processor.SeekToFrame(frame))
+                {
+                    file_processor.ProcessNextFrame();
+                }
+
+                const auto& fill_memory = decoder.GetFillMemory();
+                frame_fill_memory[frame].assign(fill_memory.begin() + fill_start, fill_memory.end());
+                frame_errors[frame] = file_processor.GetErrorState();
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < kThreadCount; ++i)
+        {
+            threads.emplace_back(convert_frames);
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        CHECK(frame_errors[kFrameCount] == decode::FileProcessor::kErrorNone);
+        CHECK(frame_fill_memory[kFrameCount].empty());
+
+        for (size_t frame = 0; frame < kFrameCount; ++frame)
+        {
+            INFO("Frame " << frame);
+            CHECK(frame_errors[frame] == decode::FileProcessor::kErrorNone);
+
+            const auto& fill_memory = frame_fill_memory[frame];
+            REQUIRE(fill_memory.size() == ((frame > 0) ? 2 : 1));
+            CHECK(fill_memory[0].memory_id == frame + 1);
+            CHECK(fill_memory[0].data == make_content(frame));
+
+            if (frame > 0)
+            {
+                CHECK(fill_memory[1].memory_id == kFrameCount + frame);
+                CHECK(fill_memory[1].data == make_content(0));
+            }
+        }
+    }
+
+    std::remove(kCaptureFilename);
+}
+
+TEST_CASE("FileProcessor limits the size of the content data that it copies", "[file_processor][pre_submit]")
+{
+    const std::vector<uint8_t> content_1(512 * 1024, 0x11);
+    const std::vector<uint8_t> content_2(512 * 1024, 0x22);
+    const std::vector<uint8_t> content_3(1024, 0x33);
+
+    {
+        // The first two content data blocks fill the 1 MiB limit, and the third exceeds it.
+        CaptureWriter writer(kCaptureFilename, 1);
+        writer.WriteContentData(1, content_1);
+        writer.WriteFillMemoryContent(1, 1, content_1.size());
+        writer.WriteFrameEndMarker(1);
+        writer.WriteContentData(2, content_2);
+        writer.WriteFillMemoryContent(2, 2, content_2.size());
+        writer.WriteFrameEndMarker(2);
+        writer.WriteContentData(3, content_3);
+        writer.WriteFillMemoryContent(3, 3, content_3.size());
+        writer.WriteFrameEndMarker(3);
+    }
+
+    const ReadMode read_mode = GENERATE(ReadMode::kFile, ReadMode::kMemoryMapped, ReadMode::kReadAhead);
+
+    {
+        decode::FileProcessor file_processor;
+        FillMemoryDecoder     decoder;
+
+        ConfigureReadMode(&file_processor, read_mode);
+        file_processor.AddDecoder(&decoder);
+        REQUIRE(file_processor.Initialize(kCaptureFilename));
+
+        REQUIRE(file_processor.ProcessNextFrame());
+        REQUIRE(file_processor.ProcessNextFrame());
+
+        SECTION("Content data that is read again is not counted twice")
+        {
+            REQUIRE(file_processor.SeekToFrame(0));
+            REQUIRE(file_processor.ProcessNextFrame());
+            REQUIRE(file_processor.ProcessNextFrame());
+
+            const auto& fill_memory = decoder.GetFillMemory();
+            REQUIRE(fill_memory.size() == 4);
+            CHECK(fill_memory[2].data == content_1);
+            CHECK(fill_memory[3].data == content_2);
+            CHECK(file_processor.GetErrorState() == decode::FileProcessor::kErrorNone);
+        }
+
+        SECTION("Content data that exceeds the limit is rejected unless it is referenced in place")
+        {
+            file_processor.ProcessNextFrame();
+
+            const auto& fill_memory = decoder.GetFillMemory();
+
+            if (read_mode == ReadMode::kMemoryMapped)
+            {
+                REQUIRE(fill_memory.size() == 3);
+                CHECK(fill_memory[2].data == content_3);
+                CHECK(file_processor.GetErrorState() == decode::FileProcessor::kErrorNone);
+            }
+            else
+            {
+                CHECK(fill_memory.size() == 2);
+                CHECK(file_processor.GetErrorState() == decode::FileProcessor::kErrorReadingBlockData);
+            }
+        }
+    }
+
+    std::remove(kCaptureFilename);
+}
+
+TEST_CASE("FileProcessor state snapshot read-ahead processes the same blocks as a plain read",
+          "[file_processor][pre_submit]")
+{
+    const size_t kBufferCount = 64;
+
+    std::vector<format::CompressionType> compression_types = { format::CompressionType::kNone };
+#if defined(GFXRECON_ENABLE_ZLIB_COMPRESSION)
+    compression_types.push_back(format::CompressionType::kZlib);
+#endif
+
+    std::vector<std::vector<uint8_t>> buffers(kBufferCount);
+    for (size_t i = 0; i < kBufferCount; ++i)
+    {
+        // Sizes vary so that blocks are decompressed at different rates, and the data compresses well.
+        buffers[i].resize(256 + ((i * 997) % 4096));
+        for (size_t j = 0; j < buffers[i].size(); ++j)
+        {
+            buffers[i][j] = static_cast<uint8_t>(i + (j / 64));
+        }
+    }
+
+    const std::vector<uint8_t> content(300, 0x11);
+
+    for (auto compression_type : compression_types)
+    {
+        {
+            std::unique_ptr<util::Compressor> compressor(format::CreateCompressor(compression_type));
+
+            CaptureWriter writer(kCaptureFilename, 1, compression_type);
+            writer.WriteBeginResourceInit();
+            for (size_t i = 0; i < kBufferCount; ++i)
+            {
+                writer.WriteInitBuffer(i + 1, buffers[i], compressor.get());
+            }
+            writer.WriteEndResourceInit();
+
+            // The blocks that follow the snapshot are processed after the read-ahead queue has been stopped.
+            writer.WriteContentData(1, content);
+            writer.WriteFillMemoryContent(1, 1, content.size());
+            writer.WriteFrameEndMarker(1);
+        }
+
+        std::vector<InitBuffer> init_buffers[2];
+
+        for (size_t read_ahead = 0; read_ahead < 2; ++read_ahead)
+        {
+            decode::FileProcessor file_processor;
+            FillMemoryDecoder     decoder;
+
+            file_processor.SetBlockReadAhead(0, 2);
+            file_processor.SetStateSnapshotReadAhead(read_ahead != 0);
+            file_processor.AddDecoder(&decoder);
+            REQUIRE(file_processor.Initialize(kCaptureFilename));
+            REQUIRE(file_processor.ProcessAllFrames());
+            CHECK(file_processor.GetErrorState() == decode::FileProcessor::kErrorNone);
+
+            const auto& fill_memory = decoder.GetFillMemory();
+            REQUIRE(fill_memory.size() == 1);
+            CHECK(fill_memory[0].data == content);
+
+            init_buffers[read_ahead] = decoder.GetInitBuffers();
+        }
+
+        REQUIRE(init_buffers[0].size() == kBufferCount);
+        REQUIRE(init_buffers[1].size() == kBufferCount);
+
+        for (size_t i = 0; i < kBufferCount; ++i)
+        {
+            CHECK(init_buffers[0][i].buffer_id == (i + 1));
+            CHECK(init_buffers[0][i].data == buffers[i]);
+            CHECK(init_buffers[1][i].buffer_id == init_buffers[0][i].buffer_id);
+            CHECK(init_buffers[1][i].data == init_buffers[0][i].data);
+        }
+    }
+
+    std::remove(kCaptureFilename);
+}
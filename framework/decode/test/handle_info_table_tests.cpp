@@ -0,0 +1,315 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/handle_info_table.h"
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+using gfxrecon::decode::HandleInfoTable;
+using gfxrecon::decode::HandleTableType;
+using gfxrecon::format::HandleId;
+
+namespace
+{
+
+struct TestInfo
+{
+    HandleId    capture_id{ 0 };
+    std::string name;
+};
+
+typedef HandleInfoTable<TestInfo> TestTable;
+
+// Sets the type of the tables created in a test and restores the previous type on exit.
+class ScopedHandleTableType
+{
+  public:
+    ScopedHandleTableType(HandleTableType type) : previous_type_(gfxrecon::decode::GetHandleTableType())
+    {
+        gfxrecon::decode::SetHandleTableType(type);
+    }
+
+    ~ScopedHandleTableType() { gfxrecon::decode::SetHandleTableType(previous_type_); }
+
+  private:
+    HandleTableType previous_type_;
+};
+
+TestInfo MakeInfo(HandleId id)
+{
+    TestInfo info;
+    info.capture_id = id;
+    info.name       = "object " + std::to_string(id);
+    return info;
+}
+
+std::map<HandleId, std::string> Collect(const TestTable& table)
+{
+    std::map<HandleId, std::string> entries;
+    for (const auto& entry : table)
+    {
+        REQUIRE(entry.first == entry.second.capture_id);
+        REQUIRE(entries.emplace(entry.first, entry.second.name).second);
+    }
+    return entries;
+}
+
+} // namespace
+
+TEST_CASE("HandleInfoTable adds, finds, and erases entries", "[handle_info_table][pre_submit]")
+{
+    const HandleId kMaxDenseId = TestTable::kMaxDenseId;
+
+    const HandleTableType type = GENERATE(HandleTableType::kDense, HandleTableType::kSparse);
+    ScopedHandleTableType scoped_type(type);
+
+    TestTable table;
+    REQUIRE(table.empty());
+    REQUIRE(table.size() == 0);
+    REQUIRE(table.Find(1) == nullptr);
+    REQUIRE(table.Find(kMaxDenseId) == nullptr);
+
+    // IDs on both sides of the dense limit, including the first and last IDs of a page.
+    const std::vector<HandleId> ids = { 1, 2, 1023, 1024, 5000, kMaxDenseId - 1, kMaxDenseId, kMaxDenseId + 1,
+                                        UINT64_MAX };
+
+    std::vector<TestTable::value_type*> entries;
+    for (HandleId id : ids)
+    {
+        auto result = table.Emplace(id, MakeInfo(id));
+        REQUIRE(result.second);
+        REQUIRE(result.first != nullptr);
+        REQUIRE(result.first->first == id);
+        REQUIRE(result.first->second.capture_id == id);
+        entries.push_back(result.first);
+    }
+
+    REQUIRE(!table.empty());
+    REQUIRE(table.size() == ids.size());
+
+    for (size_t i = 0; i < ids.size(); ++i)
+    {
+        TestInfo* info = table.Find(ids[i]);
+        REQUIRE(info == &entries[i]->second);
+        REQUIRE(info->name == MakeInfo(ids[i]).name);
+
+        const TestTable& const_table = table;
+        REQUIRE(const_table.Find(ids[i]) == info);
+    }
+
+    // IDs that were not added, in pages that do and do not exist.
+    REQUIRE(table.Find(0) == nullptr);
+    REQUIRE(table.Find(3) == nullptr);
+    REQUIRE(table.Find(kMaxDenseId - 2) == nullptr);
+    REQUIRE(table.Find(kMaxDenseId + 2) == nullptr);
+
+    // Adding an existing ID returns the existing entry without replacing it.
+    for (size_t i = 0; i < ids.size(); ++i)
+    {
+        TestInfo replacement = MakeInfo(ids[i]);
+        replacement.name     = "replacement";
+
+        auto result = table.Emplace(ids[i], std::move(replacement));
+        REQUIRE(!result.second);
+        REQUIRE(result.first == entries[i]);
+        REQUIRE(result.first->second.name == MakeInfo(ids[i]).name);
+    }
+
+    REQUIRE(table.size() == ids.size());
+
+    // Erase on both sides of the dense limit.  Erasing an ID that is not in the table does nothing.
+    table.erase(1024);
+    table.erase(kMaxDenseId);
+    table.erase(3);
+    table.erase(kMaxDenseId + 2);
+
+    REQUIRE(table.size() == ids.size() - 2);
+    REQUIRE(table.Find(1024) == nullptr);
+    REQUIRE(table.Find(kMaxDenseId) == nullptr);
+
+    // Entries that were not erased keep their addresses.
+    for (size_t i = 0; i < ids.size(); ++i)
+    {
+        if ((ids[i] != 1024) && (ids[i] != kMaxDenseId))
+        {
+            REQUIRE(table.Find(ids[i]) == &entries[i]->second);
+        }
+    }
+
+    // Erased IDs can be added again.
+    REQUIRE(table.Emplace(1024, MakeInfo(1024)).second);
+    REQUIRE(table.Emplace(kMaxDenseId, MakeInfo(kMaxDenseId)).second);
+    REQUIRE(table.size() == ids.size());
+    REQUIRE(table.Find(1024)->capture_id == 1024);
+    REQUIRE(table.Find(kMaxDenseId)->capture_id == kMaxDenseId);
+
+    for (HandleId id : ids)
+    {
+        table.erase(id);
+    }
+
+    REQUIRE(table.empty());
+    REQUIRE(table.begin() == table.end());
+}
+
+TEST_CASE("HandleInfoTable iterates over every entry", "[handle_info_table][pre_submit]")
+{
+    const HandleId kMaxDenseId = TestTable::kMaxDenseId;
+
+    const HandleTableType type = GENERATE(HandleTableType::kDense, HandleTableType::kSparse);
+    ScopedHandleTableType scoped_type(type);
+
+    TestTable table;
+    REQUIRE(table.begin() == table.end());
+    REQUIRE(Collect(table).empty());
+
+    // Entries that leave empty slots in a page, pages that are never created between used pages, and IDs stored in
+    // the hash table by dense tables.
+    const std::vector<HandleId> ids = { 7, 9, 1023, 3000, 3001, 20000, kMaxDenseId, kMaxDenseId * 2, UINT64_MAX - 1 };
+
+    std::map<HandleId, std::string> expected;
+    for (HandleId id : ids)
+    {
+        REQUIRE(table.Emplace(id, MakeInfo(id)).second);
+        expected[id] = MakeInfo(id).name;
+    }
+
+    SECTION("All entries")
+    {
+        REQUIRE(Collect(table) == expected);
+    }
+
+    SECTION("Entries erased from the start, middle, and end of pages")
+    {
+        for (HandleId id : { HandleId{ 7 }, HandleId{ 1023 }, HandleId{ 3001 }, kMaxDenseId })
+        {
+            table.erase(id);
+            expected.erase(id);
+        }
+
+        REQUIRE(Collect(table) == expected);
+    }
+
+    SECTION("Pages left empty by erased entries")
+    {
+        for (HandleId id : { HandleId{ 7 }, HandleId{ 9 }, HandleId{ 1023 }, HandleId{ 3000 }, HandleId{ 3001 } })
+        {
+            table.erase(id);
+            expected.erase(id);
+        }
+
+        REQUIRE(Collect(table) == expected);
+    }
+
+    SECTION("Only hash table entries")
+    {
+        for (HandleId id : ids)
+        {
+            if (id < kMaxDenseId)
+            {
+                table.erase(id);
+                expected.erase(id);
+            }
+        }
+
+        REQUIRE(table.size() == 3);
+        REQUIRE(Collect(table) == expected);
+    }
+
+    SECTION("Only paged entries")
+    {
+        for (HandleId id : ids)
+        {
+            if (id >= kMaxDenseId)
+            {
+                table.erase(id);
+                expected.erase(id);
+            }
+        }
+
+        REQUIRE(table.size() == 6);
+        REQUIRE(Collect(table) == expected);
+    }
+
+    SECTION("Modifying entries through iterators")
+    {
+        for (auto& entry : table)
+        {
+            entry.second.name += " updated";
+        }
+
+        for (HandleId id : ids)
+        {
+            REQUIRE(table.Find(id)->name == MakeInfo(id).name + " updated");
+        }
+    }
+
+    SECTION("All entries erased")
+    {
+        for (HandleId id : ids)
+        {
+            table.erase(id);
+        }
+
+        REQUIRE(table.begin() == table.end());
+        REQUIRE(Collect(table).empty());
+    }
+}
+
+TEST_CASE("HandleInfoTable keeps the type it was created with", "[handle_info_table][pre_submit]")
+{
+    const HandleId kMaxDenseId = TestTable::kMaxDenseId;
+
+    ScopedHandleTableType scoped_type(HandleTableType::kDense);
+
+    TestTable dense_table;
+    gfxrecon::decode::SetHandleTableType(HandleTableType::kSparse);
+    TestTable sparse_table;
+    gfxrecon::decode::SetHandleTableType(HandleTableType::kDense);
+
+    for (HandleId id = 1; id <= 2048; ++id)
+    {
+        REQUIRE(dense_table.Emplace(id, MakeInfo(id)).second);
+        REQUIRE(sparse_table.Emplace(id, MakeInfo(id)).second);
+    }
+
+    REQUIRE(dense_table.Emplace(kMaxDenseId + 5, MakeInfo(kMaxDenseId + 5)).second);
+    REQUIRE(sparse_table.Emplace(kMaxDenseId + 5, MakeInfo(kMaxDenseId + 5)).second);
+
+    REQUIRE(Collect(dense_table) == Collect(sparse_table));
+
+    // Paged entries are visited in ID order, followed by the hash table entries.
+    HandleId previous_id = 0;
+    for (const auto& entry : dense_table)
+    {
+        REQUIRE(entry.first > previous_id);
+        previous_id = entry.first;
+    }
+
+    REQUIRE(previous_id == kMaxDenseId + 5);
+}
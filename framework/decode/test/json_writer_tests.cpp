@@ -0,0 +1,145 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "decode/api_decoder.h"
+#include "decode/json_writer.h"
+#include "format/format_json.h"
+#include "util/json_util.h"
+#include "util/memory_output_stream.h"
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+using gfxrecon::decode::JsonWriter;
+
+// Output of the fixture in JSONL format, as written by JsonWriter when it built a tree for each block and serialized
+// it with nlohmann::ordered_json::dump().  Long lines are split into adjacent raw string literals.
+static const char kExpectedJsonl[] =
+    R"({"header":{"source-path":"captures/capture.gfxr","gfxrecon-version":"1.0.0"}}
+{"state":{"marker_type":"BeginMarker","frame_number":0}}
+{"state":{"marker_type":"EndMarker","frame_number":0}}
+{"index":5,"function":{"name":"vkCmdSetBlendConstants","thread":1,"args":{"commandBuffer":18,)"
+    R"("blendConstants":[0.10000000149011612,0.5,-219.60000610351563,1.0000000200408773e+20],"pNext":null,)"
+    R"("pDynamicStates":[],"extra":{"minDepth":0.0,"maxDepth":1.0,"depthBias":-1e-07,)"
+    R"("description":"quote \" backslash \\ tab \t control \u0001"}}}}
+{"index":6,"method":{"name":"CreateFence","thread":1,"object":{"type":"ID3D12Device","handle":52},"return":"S_OK",)"
+    R"("args":{"InitialValue":-1,"Flags":"D3D12_FENCE_FLAG_NONE","riid":{"Data1":175455695,"Data4":[128,51,69,114]}}}}
+{"index":7,"meta":{"name":"FillMemoryCommand","args":{"memory_id":86,"offset":256,"size":1024,)"
+    R"("data":"1_fill_memory.bin"}}}
+{"index":8,"annotation":{"type":"kText","label":"label","data":"line one\nline two"}}
+{"frame":{"marker_type":"EndMarker","frame_number":1}}
+)";
+
+// Writes a small stream with each kind of block that JsonWriter writes.
+static std::string WriteFixture(gfxrecon::util::JsonFormat format)
+{
+    gfxrecon::util::JsonOptions options;
+    options.format = format;
+
+    gfxrecon::util::MemoryOutputStream output;
+
+    {
+        JsonWriter writer(options, "1.0.0", "captures/capture.gfxr");
+        writer.StartStream(&output);
+
+        writer.WriteMarker(gfxrecon::format::kNameState, "BeginMarker", 0);
+        writer.WriteMarker(gfxrecon::format::kNameState, "EndMarker", 0);
+
+        gfxrecon::decode::ApiCallInfo call_info;
+        call_info.index     = 5;
+        call_info.thread_id = 1;
+
+        auto& function      = writer.WriteApiCallStart(call_info, "vkCmdSetBlendConstants");
+        auto& function_args = function[gfxrecon::format::kNameArgs];
+        function_args["commandBuffer"]        = uint64_t{ 0x12 };
+        function_args["blendConstants"]       = { 0.1f, 0.5f, -219.6f, 1e20f };
+        function_args["pNext"]                = nullptr;
+        function_args["pDynamicStates"]       = nlohmann::ordered_json::array();
+        function_args["extra"]["minDepth"]    = 0.0;
+        function_args["extra"]["maxDepth"]    = 1.0;
+        function_args["extra"]["depthBias"]   = -1.0e-7;
+        function_args["extra"]["description"] = "quote \" backslash \\ tab \t control \x01";
+        writer.WriteBlockEnd();
+
+        call_info.index = 6;
+
+        auto& method = writer.WriteApiCallStart(call_info, "ID3D12Device", 0x34, "CreateFence");
+
+        method[gfxrecon::format::kNameReturn] = "S_OK";
+
+        auto& method_args            = method[gfxrecon::format::kNameArgs];
+        method_args["InitialValue"]  = int64_t{ -1 };
+        method_args["Flags"]         = "D3D12_FENCE_FLAG_NONE";
+        method_args["riid"]["Data1"] = uint64_t{ 0x0a753dcf };
+        method_args["riid"]["Data4"] = { 0x80, 0x33, 0x45, 0x72 };
+        writer.WriteBlockEnd();
+
+        writer.SetCurrentBlockIndex(7);
+
+        auto& meta_args        = writer.WriteMetaCommandStart("FillMemoryCommand");
+        meta_args["memory_id"] = uint64_t{ 0x56 };
+        meta_args["offset"]    = uint64_t{ 256 };
+        meta_args["size"]      = uint64_t{ 1024 };
+        meta_args["data"]      = "1_fill_memory.bin";
+        writer.WriteBlockEnd();
+
+        writer.ProcessAnnotation(8, gfxrecon::format::AnnotationType::kText, "label", "line one\nline two");
+
+        writer.WriteMarker(gfxrecon::format::kNameFrame, "EndMarker", 1);
+        writer.EndStream();
+    }
+
+    return std::string(reinterpret_cast<const char*>(output.GetData()), output.GetDataSize());
+}
+
+TEST_CASE("JsonWriter output matches tree serialization in JSONL format", "[json][pre_submit]")
+{
+    REQUIRE(WriteFixture(gfxrecon::util::JsonFormat::JSONL) == kExpectedJsonl);
+}
+
+TEST_CASE("JsonWriter output matches tree serialization in JSON format", "[json][pre_submit]")
+{
+    // In JSON format, the blocks were serialized with indentation as elements of an array.
+    std::istringstream lines(kExpectedJsonl);
+    std::string        line;
+    std::string        expected = "[\n";
+    bool               first    = true;
+
+    while (std::getline(lines, line))
+    {
+        if (!first)
+        {
+            expected += ",\n";
+        }
+
+        expected += nlohmann::ordered_json::parse(line).dump(gfxrecon::util::kJsonIndentWidth);
+        first = false;
+    }
+
+    expected += "\n]\n";
+
+    REQUIRE(WriteFixture(gfxrecon::util::JsonFormat::JSON) == expected);
+}
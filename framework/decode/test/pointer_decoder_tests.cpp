@@ -0,0 +1,228 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/decode_allocator.h"
+#include "decode/pointer_decoder.h"
+#include "format/format.h"
+#include "util/varint.h"
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using gfxrecon::decode::DecodeAllocator;
+using gfxrecon::decode::PointerDecoder;
+
+namespace
+{
+
+const uint32_t kValues[] = { 1, 2, 3, 4, 5, 6, 7 };
+const size_t   kLength   = sizeof(kValues) / sizeof(kValues[0]);
+
+// Encodes kValues as an array parameter at the given offset from an 8 byte aligned address, returning the offset of
+// the array elements.
+size_t EncodeValues(std::vector<uint64_t>* storage, size_t offset)
+{
+    const uint32_t attributes = gfxrecon::format::PointerAttributes::kIsArray |
+                                gfxrecon::format::PointerAttributes::kHasAddress |
+                                gfxrecon::format::PointerAttributes::kHasData;
+    const uint64_t address    = 0x1000;
+    const uint64_t length     = kLength;
+
+    storage->assign(16, 0);
+
+    auto bytes = reinterpret_cast<uint8_t*>(storage->data()) + offset;
+    std::memcpy(bytes, &attributes, sizeof(attributes));
+    std::memcpy(bytes + sizeof(attributes), &address, sizeof(address));
+    std::memcpy(bytes + sizeof(attributes) + sizeof(address), &length, sizeof(length));
+    std::memcpy(bytes + sizeof(attributes) + sizeof(address) + sizeof(length), kValues, sizeof(kValues));
+
+    return offset + sizeof(attributes) + sizeof(address) + sizeof(length);
+}
+
+void AppendVarint(std::vector<uint8_t>* buffer, uint64_t value)
+{
+    uint8_t bytes[gfxrecon::util::varint::kMaxVarintSize];
+    size_t  size = gfxrecon::util::varint::Encode(value, bytes);
+    buffer->insert(buffer->end(), bytes, bytes + size);
+}
+
+void AppendAddress(std::vector<uint8_t>* buffer, gfxrecon::format::AddressEncodeType address)
+{
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&address);
+    buffer->insert(buffer->end(), bytes, bytes + sizeof(address));
+}
+
+const uint8_t* GetBytes(const std::vector<uint64_t>& storage)
+{
+    return reinterpret_cast<const uint8_t*>(storage.data());
+}
+
+} // namespace
+
+TEST_CASE("PointerDecoder references aligned arrays in the parameter buffer", "[pointer_decoder][pre_submit]")
+{
+    std::vector<uint64_t> storage;
+    const size_t          buffer_size = 16 * sizeof(uint64_t);
+
+    SECTION("Aligned array elements are not copied for read-only access")
+    {
+        size_t values_offset = EncodeValues(&storage, 0);
+        REQUIRE((values_offset % alignof(uint32_t)) == 0);
+
+        DecodeAllocator::Begin();
+        PointerDecoder<uint32_t>        decoder;
+        const PointerDecoder<uint32_t>& const_decoder = decoder;
+        size_t                          bytes_read    = decoder.DecodeUInt32(GetBytes(storage), buffer_size, false);
+
+        REQUIRE(bytes_read == values_offset + sizeof(kValues));
+        REQUIRE(const_decoder.GetLength() == kLength);
+        REQUIRE(reinterpret_cast<const uint8_t*>(const_decoder.GetPointer()) == GetBytes(storage) + values_offset);
+        REQUIRE(std::memcmp(const_decoder.GetPointer(), kValues, sizeof(kValues)) == 0);
+        DecodeAllocator::End();
+    }
+
+    SECTION("Aligned array elements are copied before they can be modified")
+    {
+        size_t values_offset = EncodeValues(&storage, 0);
+
+        DecodeAllocator::Begin();
+        PointerDecoder<uint32_t>        decoder;
+        const PointerDecoder<uint32_t>& const_decoder = decoder;
+        decoder.DecodeUInt32(GetBytes(storage), buffer_size, false);
+
+        uint32_t* values = decoder.GetPointer();
+        REQUIRE(reinterpret_cast<const uint8_t*>(values) != GetBytes(storage) + values_offset);
+        REQUIRE(std::memcmp(values, kValues, sizeof(kValues)) == 0);
+
+        // Later accesses return the copy, and modifying it leaves the parameter buffer unchanged.
+        values[0] = 0;
+        REQUIRE(decoder.GetPointer() == values);
+        REQUIRE(const_decoder.GetPointer() == values);
+        REQUIRE(std::memcmp(GetBytes(storage) + values_offset, kValues, sizeof(kValues)) == 0);
+        DecodeAllocator::End();
+    }
+
+    SECTION("Misaligned array elements are copied")
+    {
+        size_t values_offset = EncodeValues(&storage, 1);
+        REQUIRE((values_offset % alignof(uint32_t)) != 0);
+
+        DecodeAllocator::Begin();
+        PointerDecoder<uint32_t> decoder;
+        size_t                   bytes_read = decoder.DecodeUInt32(GetBytes(storage) + 1, buffer_size - 1, false);
+
+        REQUIRE(bytes_read == (values_offset - 1) + sizeof(kValues));
+        REQUIRE(reinterpret_cast<const uint8_t*>(decoder.GetPointer()) != GetBytes(storage) + values_offset);
+        REQUIRE(std::memcmp(decoder.GetPointer(), kValues, sizeof(kValues)) == 0);
+        DecodeAllocator::End();
+    }
+
+    SECTION("Array elements are copied when allocations outlive the call")
+    {
+        size_t values_offset = EncodeValues(&storage, 0);
+
+        DecodeAllocator::Begin();
+        DecodeAllocator::TurnOffEndCanClear();
+        PointerDecoder<uint32_t> decoder;
+        decoder.DecodeUInt32(GetBytes(storage), buffer_size, false);
+
+        REQUIRE(reinterpret_cast<const uint8_t*>(decoder.GetPointer()) != GetBytes(storage) + values_offset);
+        REQUIRE(std::memcmp(decoder.GetPointer(), kValues, sizeof(kValues)) == 0);
+        DecodeAllocator::End();
+        DecodeAllocator::TurnOnEndCanClear();
+    }
+
+    SECTION("Array elements of a different size are converted")
+    {
+        EncodeValues(&storage, 0);
+
+        DecodeAllocator::Begin();
+        PointerDecoder<uint64_t> decoder;
+        decoder.DecodeUInt32(GetBytes(storage), buffer_size, false);
+
+        REQUIRE(decoder.GetLength() == kLength);
+        for (size_t i = 0; i < kLength; ++i)
+        {
+            REQUIRE(decoder.GetPointer()[i] == kValues[i]);
+        }
+        DecodeAllocator::End();
+    }
+
+    DecodeAllocator::DestroyInstance();
+}
+
+TEST_CASE("PointerDecoder decodes compact handle ID arrays", "[pointer_decoder][pre_submit]")
+{
+    const gfxrecon::format::HandleId kHandleIds[] = { 100, 101, 103, 90, 0, 5000 };
+    const size_t                     kHandleCount = sizeof(kHandleIds) / sizeof(kHandleIds[0]);
+
+    // Attributes and length are varints, with a fixed size address between them, followed by the differences between
+    // consecutive handle IDs.
+    std::vector<uint8_t> buffer;
+    AppendVarint(&buffer,
+                 gfxrecon::format::PointerAttributes::kIsArray | gfxrecon::format::PointerAttributes::kHasAddress |
+                     gfxrecon::format::PointerAttributes::kHasData);
+    AppendAddress(&buffer, 0x1000);
+    AppendVarint(&buffer, kHandleCount);
+
+    gfxrecon::format::HandleId previous_id = gfxrecon::format::kNullHandleId;
+    for (auto handle_id : kHandleIds)
+    {
+        AppendVarint(&buffer, gfxrecon::util::varint::ZigZagEncode(static_cast<int64_t>(handle_id - previous_id)));
+        previous_id = handle_id;
+    }
+
+    // A fixed size encoding would use 4 + 8 + 8 + 6 * 8 bytes.
+    REQUIRE(buffer.size() < 24);
+
+    DecodeAllocator::Begin();
+
+    SECTION("Handle IDs are decoded to allocated memory")
+    {
+        PointerDecoder<gfxrecon::format::HandleId> decoder;
+        REQUIRE(decoder.DecodeHandleId(buffer.data(), buffer.size(), true) == buffer.size());
+        REQUIRE(decoder.GetAddress() == 0x1000);
+        REQUIRE(decoder.GetLength() == kHandleCount);
+        REQUIRE(std::memcmp(decoder.GetPointer(), kHandleIds, sizeof(kHandleIds)) == 0);
+    }
+
+    SECTION("Handle IDs are truncated to the capacity of external memory")
+    {
+        gfxrecon::format::HandleId                 handle_ids[kHandleCount - 2] = {};
+        PointerDecoder<gfxrecon::format::HandleId> decoder;
+        decoder.SetExternalMemory(handle_ids, kHandleCount - 2);
+        REQUIRE(decoder.DecodeHandleId(buffer.data(), buffer.size(), true) == buffer.size());
+        REQUIRE(std::memcmp(handle_ids, kHandleIds, sizeof(handle_ids)) == 0);
+    }
+
+    SECTION("Truncated data is not decoded")
+    {
+        PointerDecoder<gfxrecon::format::HandleId> decoder;
+        REQUIRE(decoder.DecodeHandleId(buffer.data(), buffer.size() - 1, true) < buffer.size());
+    }
+
+    DecodeAllocator::End();
+    DecodeAllocator::DestroyInstance();
+}
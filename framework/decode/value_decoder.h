@@ -27,6 +27,7 @@
 
 #include "format/format.h"
 #include "util/defines.h"
+#include "util/varint.h"
 
 #include "vulkan/vulkan.h"
 
@@ -40,74 +41,78 @@ GFXRECON_BEGIN_NAMESPACE(decode)
 class ValueDecoder
 {
   public:
+    // Values are decoded as varints when compact_encoding is true, which is set from the
+    // format::FileOption::kCompactEncoding option of the capture file that the values are read from.  Addresses and
+    // arrays, except for arrays of handle IDs, are always encoded with fixed size values.
+
     // clang-format off
 
     // Values
-    static size_t DecodeInt8Value(const uint8_t* buffer, size_t buffer_size, int8_t* value)                         { return DecodeValue(buffer, buffer_size, value); }
-    static size_t DecodeUInt8Value(const uint8_t* buffer, size_t buffer_size, uint8_t* value)                       { return DecodeValue(buffer, buffer_size, value); }
-    static size_t DecodeInt16Value(const uint8_t* buffer, size_t buffer_size, int16_t* value)                       { return DecodeValue(buffer, buffer_size, value); }
-    static size_t DecodeUInt16Value(const uint8_t* buffer, size_t buffer_size, uint16_t* value)                     { return DecodeValue(buffer, buffer_size, value); }
-    static size_t DecodeInt32Value(const uint8_t* buffer, size_t buffer_size, int32_t* value)                       { return DecodeValue(buffer, buffer_size, value); }
-    static size_t DecodeUInt32Value(const uint8_t* buffer, size_t buffer_size, uint32_t* value)                     { return DecodeValue(buffer, buffer_size, value); }
-    static size_t DecodeUInt32BitFieldValue(const uint8_t* buffer, size_t buffer_size, const uint32_t& value)       { return 0; }
+    static size_t DecodeInt8Value(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, int8_t* value)                         { return DecodeValue(buffer, buffer_size, compact_encoding, value); }
+    static size_t DecodeUInt8Value(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, uint8_t* value)                       { return DecodeValue(buffer, buffer_size, compact_encoding, value); }
+    static size_t DecodeInt16Value(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, int16_t* value)                       { return DecodeValue(buffer, buffer_size, compact_encoding, value); }
+    static size_t DecodeUInt16Value(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, uint16_t* value)                     { return DecodeValue(buffer, buffer_size, compact_encoding, value); }
+    static size_t DecodeInt32Value(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, int32_t* value)                       { return DecodeValue(buffer, buffer_size, compact_encoding, value); }
+    static size_t DecodeUInt32Value(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, uint32_t* value)                     { return DecodeValue(buffer, buffer_size, compact_encoding, value); }
+    static size_t DecodeUInt32BitFieldValue(const uint8_t* buffer, size_t buffer_size, const uint32_t& value)                              { return 0; }
 
 #if defined(WIN32)
     // Oveload for WIN32 LONG type.  Pointers from the LONG typedef of unsigned long are not compatible with int32_t pointers.
-    static size_t DecodeInt32Value(const uint8_t* buffer, size_t buffer_size, long* value)                          { return DecodeValue(buffer, buffer_size, value); }
+    static size_t DecodeInt32Value(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, long* value)                          { return DecodeValue(buffer, buffer_size, compact_encoding, value); }
     // Oveload for WIN32 DWORD type.  Pointers from the DWORD typedef of unsigned long are not compatible with uint32_t pointers.
-    static size_t DecodeUInt32Value(const uint8_t* buffer, size_t buffer_size, unsigned long* value)                { return DecodeValue(buffer, buffer_size, value); }
+    static size_t DecodeUInt32Value(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, unsigned long* value)                { return DecodeValue(buffer, buffer_size, compact_encoding, value); }
 #endif
 
-    static size_t DecodeInt64Value(const uint8_t* buffer, size_t buffer_size, int64_t* value)                       { return DecodeValue(buffer, buffer_size, value); }
-    static size_t DecodeUInt64Value(const uint8_t* buffer, size_t buffer_size, uint64_t* value)                     { return DecodeValue(buffer, buffer_size, value); }
-    static size_t DecodeFloatValue(const uint8_t* buffer, size_t buffer_size, float* value)                         { return DecodeValue(buffer, buffer_size, value); }
-    static size_t DecodeDoubleValue(const uint8_t* buffer, size_t buffer_size, double* value)                       { return DecodeValue(buffer, buffer_size, value); }
+    static size_t DecodeInt64Value(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, int64_t* value)                       { return DecodeValue(buffer, buffer_size, compact_encoding, value); }
+    static size_t DecodeUInt64Value(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, uint64_t* value)                     { return DecodeValue(buffer, buffer_size, compact_encoding, value); }
+    static size_t DecodeFloatValue(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, float* value)                         { return DecodeValue(buffer, buffer_size, compact_encoding, value); }
+    static size_t DecodeDoubleValue(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, double* value)                       { return DecodeValue(buffer, buffer_size, compact_encoding, value); }
 
-    static size_t DecodeSizeTValue(const uint8_t* buffer, size_t buffer_size, size_t* value)                        { return DecodeValueFrom<format::SizeTEncodeType>(buffer, buffer_size, value); }
+    static size_t DecodeSizeTValue(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, size_t* value)                        { return DecodeValueFrom<format::SizeTEncodeType>(buffer, buffer_size, compact_encoding, value); }
 #if (defined(VK_USE_PLATFORM_XLIB_KHR) || defined(VK_USE_PLATFORM_XLIB_XRANDR_EXT)) && !defined(GFXRECON_ARCH64)
     // Oveload for the 32-bit XID type.  Pointers from the 32-bit XID typedef of unsigned long are not compatible with size_t pointers.
-    static size_t DecodeSizeTValue(const uint8_t* buffer, size_t buffer_size, unsigned long* value)                 { return DecodeValueFrom<format::SizeTEncodeType>(buffer, buffer_size, value); }
+    static size_t DecodeSizeTValue(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, unsigned long* value)                 { return DecodeValueFrom<format::SizeTEncodeType>(buffer, buffer_size, compact_encoding, value); }
 #elif defined(WIN32)
 #if !defined(GFXRECON_ARCH64)
     // Oveload for 32-bit WIN32 SIZE_T type.  Pointers from the unsigned long typedef of are not compatible with size_t pointers.
-    static size_t DecodeSizeTValue(const uint8_t* buffer, size_t buffer_size, SIZE_T* value)                        { return DecodeValueFrom<format::SizeTEncodeType>(buffer, buffer_size, value); }
+    static size_t DecodeSizeTValue(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, SIZE_T* value)                        { return DecodeValueFrom<format::SizeTEncodeType>(buffer, buffer_size, compact_encoding, value); }
 #endif
     // Oveload for WIN32 LONG_PTR type.  Pointers from the LONG_PTR typedef of __int64 / long are not compatible with size_t pointers.
-    static size_t DecodeSizeTValue(const uint8_t* buffer, size_t buffer_size, LONG_PTR* value)                      { return DecodeValueFrom<format::SizeTEncodeType>(buffer, buffer_size, value); }
+    static size_t DecodeSizeTValue(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, LONG_PTR* value)                      { return DecodeValueFrom<format::SizeTEncodeType>(buffer, buffer_size, compact_encoding, value); }
 #endif
 
-    // Treat pointers to non-Vulkan objects as 64-bit object IDs.
-    static size_t DecodeAddress(const uint8_t* buffer, size_t buffer_size, uint64_t* value)                         { return DecodeValueFrom<format::AddressEncodeType>(buffer, buffer_size, value); }
-    static size_t DecodeVoidPtr(const uint8_t* buffer, size_t buffer_size, uint64_t* value)                         { return DecodeAddress(buffer, buffer_size, value); }
-    static size_t DecodeFunctionPtr(const uint8_t* buffer, size_t buffer_size, uint64_t* value)                     { return DecodeAddress(buffer, buffer_size, value); }
+    // Treat pointers to non-Vulkan objects as 64-bit object IDs, which are encoded with fixed size values.
+    static size_t DecodeAddress(const uint8_t* buffer, size_t buffer_size, uint64_t* value)                                                { return DecodeValueFrom<format::AddressEncodeType>(buffer, buffer_size, false, value); }
+    static size_t DecodeVoidPtr(const uint8_t* buffer, size_t buffer_size, uint64_t* value)                                                { return DecodeAddress(buffer, buffer_size, value); }
+    static size_t DecodeFunctionPtr(const uint8_t* buffer, size_t buffer_size, uint64_t* value)                                            { return DecodeAddress(buffer, buffer_size, value); }
 
-    static size_t DecodeHandleIdValue(const uint8_t* buffer, size_t buffer_size, format::HandleId* value)           { return DecodeValueFrom<format::HandleEncodeType>(buffer, buffer_size, value); }
+    static size_t DecodeHandleIdValue(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, format::HandleId* value)           { return DecodeValueFrom<format::HandleEncodeType>(buffer, buffer_size, compact_encoding, value); }
     template<typename T>
-    static size_t DecodeEnumValue(const uint8_t* buffer, size_t buffer_size, T* value)                              { return DecodeValueFrom<format::EnumEncodeType>(buffer, buffer_size, value); }
+    static size_t DecodeEnumValue(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, T* value)                              { return DecodeValueFrom<format::EnumEncodeType>(buffer, buffer_size, compact_encoding, value); }
     template<typename T>
-    static size_t DecodeFlagsValue(const uint8_t* buffer, size_t buffer_size, T* value)                             { return DecodeValueFrom<format::FlagsEncodeType>(buffer, buffer_size, value); }
+    static size_t DecodeFlagsValue(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, T* value)                             { return DecodeValueFrom<format::FlagsEncodeType>(buffer, buffer_size, compact_encoding, value); }
     template<typename T>
-    static size_t DecodeFlags64Value(const uint8_t* buffer, size_t buffer_size, T* value)                           { return DecodeValueFrom<format::Flags64EncodeType>(buffer, buffer_size, value); }
+    static size_t DecodeFlags64Value(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, T* value)                           { return DecodeValueFrom<format::Flags64EncodeType>(buffer, buffer_size, compact_encoding, value); }
 
     // Arrays
-    static size_t DecodeCharArray(const uint8_t* buffer, size_t buffer_size, char* arr, size_t len)                 { return DecodeArray(buffer, buffer_size, arr, len); }
-    static size_t DecodeInt32Array(const uint8_t* buffer, size_t buffer_size, int32_t* arr, size_t len)             { return DecodeArray(buffer, buffer_size, arr, len); }
-    static size_t DecodeUInt32Array(const uint8_t* buffer, size_t buffer_size, uint32_t* arr, size_t len)           { return DecodeArray(buffer, buffer_size, arr, len); }
-    static size_t DecodeInt64Array(const uint8_t* buffer, size_t buffer_size, int64_t* arr, size_t len)             { return DecodeArray(buffer, buffer_size, arr, len); }
-    static size_t DecodeUInt64Array(const uint8_t* buffer, size_t buffer_size, uint64_t* arr, size_t len)           { return DecodeArray(buffer, buffer_size, arr, len); }
-    static size_t DecodeFloatArray(const uint8_t* buffer, size_t buffer_size, float* arr, size_t len)               { return DecodeArray(buffer, buffer_size, arr, len); }
-    static size_t DecodeSizeTArray(const uint8_t* buffer, size_t buffer_size, size_t* arr, size_t len)              { return DecodeArrayFrom<format::SizeTEncodeType>(buffer, buffer_size, arr, len); }
-
-    static size_t DecodeUInt8Array(const uint8_t* buffer, size_t buffer_size, void* arr, size_t len)                { return DecodeArray(buffer, buffer_size, reinterpret_cast<uint8_t*>(arr), len); }
-    static size_t DecodeVoidArray(const uint8_t* buffer, size_t buffer_size, void* arr, size_t len)                 { return DecodeArray(buffer, buffer_size, reinterpret_cast<uint8_t*>(arr), len); }
-
-    static size_t DecodeHandleIdArray(const uint8_t* buffer, size_t buffer_size, format::HandleId* arr, size_t len) { return DecodeArrayFrom<format::HandleEncodeType>(buffer, buffer_size, arr, len); }
+    static size_t DecodeCharArray(const uint8_t* buffer, size_t buffer_size, char* arr, size_t len)                                        { return DecodeArray(buffer, buffer_size, arr, len); }
+    static size_t DecodeInt32Array(const uint8_t* buffer, size_t buffer_size, int32_t* arr, size_t len)                                    { return DecodeArray(buffer, buffer_size, arr, len); }
+    static size_t DecodeUInt32Array(const uint8_t* buffer, size_t buffer_size, uint32_t* arr, size_t len)                                  { return DecodeArray(buffer, buffer_size, arr, len); }
+    static size_t DecodeInt64Array(const uint8_t* buffer, size_t buffer_size, int64_t* arr, size_t len)                                    { return DecodeArray(buffer, buffer_size, arr, len); }
+    static size_t DecodeUInt64Array(const uint8_t* buffer, size_t buffer_size, uint64_t* arr, size_t len)                                  { return DecodeArray(buffer, buffer_size, arr, len); }
+    static size_t DecodeFloatArray(const uint8_t* buffer, size_t buffer_size, float* arr, size_t len)                                      { return DecodeArray(buffer, buffer_size, arr, len); }
+    static size_t DecodeSizeTArray(const uint8_t* buffer, size_t buffer_size, size_t* arr, size_t len)                                     { return DecodeArrayFrom<format::SizeTEncodeType>(buffer, buffer_size, arr, len); }
+
+    static size_t DecodeUInt8Array(const uint8_t* buffer, size_t buffer_size, void* arr, size_t len)                                       { return DecodeArray(buffer, buffer_size, reinterpret_cast<uint8_t*>(arr), len); }
+    static size_t DecodeVoidArray(const uint8_t* buffer, size_t buffer_size, void* arr, size_t len)                                        { return DecodeArray(buffer, buffer_size, reinterpret_cast<uint8_t*>(arr), len); }
+
+    static size_t DecodeHandleIdArray(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, format::HandleId* arr, size_t len) { return DecodeHandleIds(buffer, buffer_size, compact_encoding, arr, len); }
     template<typename T>
-    static size_t DecodeEnumArray(const uint8_t* buffer, size_t buffer_size, T* arr, size_t len)                    { return DecodeArrayFrom<format::EnumEncodeType>(buffer, buffer_size, arr, len); }
+    static size_t DecodeEnumArray(const uint8_t* buffer, size_t buffer_size, T* arr, size_t len)                                           { return DecodeArrayFrom<format::EnumEncodeType>(buffer, buffer_size, arr, len); }
     template<typename T>
-    static size_t DecodeFlagsArray(const uint8_t* buffer, size_t buffer_size, T* arr, size_t len)                   { return DecodeArrayFrom<format::FlagsEncodeType>(buffer, buffer_size, arr, len); }
+    static size_t DecodeFlagsArray(const uint8_t* buffer, size_t buffer_size, T* arr, size_t len)                                          { return DecodeArrayFrom<format::FlagsEncodeType>(buffer, buffer_size, arr, len); }
     template<typename T>
-    static size_t DecodeFlags64Array(const uint8_t* buffer, size_t buffer_size, T* arr, size_t len)                 { return DecodeArrayFrom<format::Flags64EncodeType>(buffer, buffer_size, arr, len); }
+    static size_t DecodeFlags64Array(const uint8_t* buffer, size_t buffer_size, T* arr, size_t len)                                        { return DecodeArrayFrom<format::Flags64EncodeType>(buffer, buffer_size, arr, len); }
 
     // clang-format on
 
@@ -127,7 +132,7 @@ class ValueDecoder
             for (size_t i = 0; i < len; ++i)
             {
                 SrcT from_value = 0;
-                bytes_read += DecodeValue((buffer + bytes_read), (buffer_size - bytes_read), &from_value);
+                bytes_read += DecodeFixedValue((buffer + bytes_read), (buffer_size - bytes_read), &from_value);
                 arr[i] = TypeCast<DstT>(from_value);
             }
         }
@@ -160,7 +165,24 @@ class ValueDecoder
     }
 
     template <typename T>
-    static size_t DecodeValue(const uint8_t* buffer, size_t buffer_size, T* value)
+    static size_t DecodeValue(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, T* value)
+    {
+        assert(value != nullptr);
+
+        if constexpr (std::is_integral<T>::value && (sizeof(T) > 1))
+        {
+            if (compact_encoding)
+            {
+                return DecodeCompactValue(buffer, buffer_size, value);
+            }
+        }
+
+        return DecodeFixedValue(buffer, buffer_size, value);
+    }
+
+    // Array elements are encoded with fixed size values, even with compact encoding.
+    template <typename T>
+    static size_t DecodeFixedValue(const uint8_t* buffer, size_t buffer_size, T* value)
     {
         assert(value != nullptr);
 
@@ -177,24 +199,81 @@ class ValueDecoder
     }
 
     template <typename SrcT, typename DstT>
-    static size_t DecodeValueFrom(const uint8_t* buffer, size_t buffer_size, DstT* value)
+    static size_t DecodeValueFrom(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, DstT* value)
     {
         assert(value != nullptr);
 
         size_t bytes_read = 0;
         size_t data_size  = sizeof(SrcT);
+        SrcT   from_type  = 0;
 
-        if (buffer_size >= data_size)
+        if (compact_encoding)
+        {
+            bytes_read = DecodeCompactValue(buffer, buffer_size, &from_type);
+        }
+        else if (buffer_size >= data_size)
         {
-            SrcT from_type = 0;
-            bytes_read     = data_size;
+            bytes_read = data_size;
             memcpy(&from_type, buffer, data_size);
+        }
+
+        if (bytes_read > 0)
+        {
             (*value) = TypeCast<DstT>(from_type);
         }
 
         return bytes_read;
     }
 
+    // Values are truncated to the size of T, which restores signed values that were encoded as their unsigned
+    // representation.
+    template <typename T>
+    static size_t DecodeCompactValue(const uint8_t* buffer, size_t buffer_size, T* value)
+    {
+        uint64_t encoded    = 0;
+        size_t   bytes_read = util::varint::Decode(buffer, buffer_size, &encoded);
+
+        if (bytes_read > 0)
+        {
+            (*value) = static_cast<T>(encoded);
+        }
+
+        return bytes_read;
+    }
+
+    // With compact encoding, each handle ID referenced by a pointer is encoded as the zigzag coded difference from the
+    // previous ID, starting from 0.
+    static size_t
+    DecodeHandleIds(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, format::HandleId* arr, size_t len)
+    {
+        if (!compact_encoding)
+        {
+            return DecodeArrayFrom<format::HandleEncodeType>(buffer, buffer_size, arr, len);
+        }
+
+        assert(arr != nullptr);
+
+        size_t           bytes_read  = 0;
+        format::HandleId previous_id = format::kNullHandleId;
+
+        for (size_t i = 0; i < len; ++i)
+        {
+            uint64_t delta = 0;
+            size_t   size  = util::varint::Decode((buffer + bytes_read), (buffer_size - bytes_read), &delta);
+
+            if (size == 0)
+            {
+                return 0;
+            }
+
+            previous_id += static_cast<format::HandleId>(util::varint::ZigZagDecode(delta));
+            arr[i] = previous_id;
+            bytes_read += size;
+        }
+
+        return bytes_read;
+    }
+
     template <typename T>
     static size_t DecodeArray(const uint8_t* buffer, size_t buffer_size, T* arr, size_t len)
     {
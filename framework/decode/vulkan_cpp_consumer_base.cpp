@@ -3697,7 +3697,7 @@ void VulkanCppConsumerBase::Process_vkCmdPushDescriptorSetWithTemplate2KHR(
 
     DescriptorUpdateTemplateDecoder pData;
     const uint8_t*                  ptr = static_cast<const uint8_t*>(decoded_info->pNext->GetPointer());
-    pData.Decode(ptr, pData.GetLength());
+    pData.Decode(ptr, pData.GetLength(), call_info.compact_encoding);
     GenerateDescriptorUpdateTemplateData(&pData, decoded_info->descriptorUpdateTemplate, file, var_name);
 
     fprintf(file,
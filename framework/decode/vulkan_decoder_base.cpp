@@ -325,13 +325,15 @@ size_t VulkanDecoderBase::Decode_vkUpdateDescriptorSetWithTemplate(const ApiCall
     format::HandleId                descriptorUpdateTemplate;
     DescriptorUpdateTemplateDecoder pData;
 
-    bytes_read +=
-        ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &device);
-    bytes_read +=
-        ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &descriptorSet);
     bytes_read += ValueDecoder::DecodeHandleIdValue(
-        (parameter_buffer + bytes_read), (buffer_size - bytes_read), &descriptorUpdateTemplate);
-    bytes_read += pData.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &device);
+    bytes_read += ValueDecoder::DecodeHandleIdValue(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &descriptorSet);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read),
+                                                    (buffer_size - bytes_read),
+                                                    call_info.compact_encoding,
+                                                    &descriptorUpdateTemplate);
+    bytes_read += pData.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : consumers_)
     {
@@ -354,14 +356,17 @@ size_t VulkanDecoderBase::Decode_vkCmdPushDescriptorSetWithTemplateKHR(const Api
     uint32_t                        set;
     DescriptorUpdateTemplateDecoder pData;
 
-    bytes_read +=
-        ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
     bytes_read += ValueDecoder::DecodeHandleIdValue(
-        (parameter_buffer + bytes_read), (buffer_size - bytes_read), &descriptorUpdateTemplate);
-    bytes_read +=
-        ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &layout);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &set);
-    bytes_read += pData.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &commandBuffer);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read),
+                                                    (buffer_size - bytes_read),
+                                                    call_info.compact_encoding,
+                                                    &descriptorUpdateTemplate);
+    bytes_read += ValueDecoder::DecodeHandleIdValue(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &layout);
+    bytes_read += ValueDecoder::DecodeUInt32Value(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &set);
+    bytes_read += pData.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : consumers_)
     {
@@ -381,12 +386,12 @@ size_t VulkanDecoderBase::Decode_vkCmdPushDescriptorSetWithTemplate2KHR(const Ap
     format::HandleId                                                     commandBuffer;
     StructPointerDecoder<Decoded_VkPushDescriptorSetWithTemplateInfoKHR> pPushDescriptorSetWithTemplateInfo;
 
-    bytes_read +=
-        ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &commandBuffer);
-    bytes_read +=
-        pPushDescriptorSetWithTemplateInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += ValueDecoder::DecodeHandleIdValue(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &commandBuffer);
+    bytes_read += pPushDescriptorSetWithTemplateInfo.Decode(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
     bytes_read += pPushDescriptorSetWithTemplateInfo.GetMetaStructPointer()->pData.Decode(
-        (parameter_buffer + bytes_read), (buffer_size - bytes_read));
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : consumers_)
     {
@@ -408,13 +413,15 @@ size_t VulkanDecoderBase::Decode_vkUpdateDescriptorSetWithTemplateKHR(const ApiC
     format::HandleId                descriptorUpdateTemplate;
     DescriptorUpdateTemplateDecoder pData;
 
-    bytes_read +=
-        ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &device);
-    bytes_read +=
-        ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &descriptorSet);
     bytes_read += ValueDecoder::DecodeHandleIdValue(
-        (parameter_buffer + bytes_read), (buffer_size - bytes_read), &descriptorUpdateTemplate);
-    bytes_read += pData.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &device);
+    bytes_read += ValueDecoder::DecodeHandleIdValue(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &descriptorSet);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read),
+                                                    (buffer_size - bytes_read),
+                                                    call_info.compact_encoding,
+                                                    &descriptorUpdateTemplate);
+    bytes_read += pData.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : consumers_)
     {
@@ -440,19 +447,30 @@ size_t VulkanDecoderBase::Decode_vkCreateRayTracingPipelinesKHR(const ApiCallInf
     HandlePointerDecoder<VkPipeline>                                pPipelines;
     VkResult                                                        return_value;
 
-    bytes_read +=
-        ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &device);
     bytes_read += ValueDecoder::DecodeHandleIdValue(
-        (parameter_buffer + bytes_read), (buffer_size - bytes_read), &deferredOperation);
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &device);
+    bytes_read += ValueDecoder::DecodeHandleIdValue(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &deferredOperation);
+
+    if (deferredOperation)
+    {
+        // The decoded create infos are kept until the deferred operation is joined, so they must not reference the
+        // parameter buffer.
+        DecodeAllocator::TurnOffEndCanClear();
+    }
+
+    bytes_read += ValueDecoder::DecodeHandleIdValue(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pipelineCache);
+    bytes_read += ValueDecoder::DecodeUInt32Value(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &createInfoCount);
     bytes_read +=
-        ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pipelineCache);
+        pCreateInfos.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
     bytes_read +=
-        ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &createInfoCount);
-    bytes_read += pCreateInfos.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pPipelines.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+        pAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
     bytes_read +=
-        ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+        pPipelines.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -469,7 +487,6 @@ size_t VulkanDecoderBase::Decode_vkCreateRayTracingPipelinesKHR(const ApiCallInf
 
     if (deferredOperation)
     {
-        DecodeAllocator::TurnOffEndCanClear();
         DeferredOperationFunctionCallData record;
         record.pCreateInfos                                        = std::move(pCreateInfos);
         record.pAllocator                                          = std::move(pAllocator);
@@ -489,12 +506,12 @@ size_t VulkanDecoderBase::Decode_vkDeferredOperationJoinKHR(const ApiCallInfo& c
     format::HandleId operation;
     VkResult         return_value;
 
-    bytes_read +=
-        ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &device);
-    bytes_read +=
-        ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &operation);
-    bytes_read +=
-        ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeHandleIdValue(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &device);
+    bytes_read += ValueDecoder::DecodeHandleIdValue(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &operation);
+    bytes_read += ValueDecoder::DecodeEnumValue(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -25,6 +25,7 @@
 #include "decode/custom_vulkan_struct_decoders.h"
 #include "decode/vulkan_object_info.h"
 #include "generated/generated_vulkan_struct_decoders.h"
+#include "util/memory_copy.h"
 #include "util/platform.h"
 
 #include <cassert>
@@ -505,7 +506,7 @@ VkResult VulkanDefaultAllocator::WriteMappedMemoryRange(MemoryData     allocator
 
             size_t copy_size = static_cast<size_t>(size);
 
-            util::platform::MemoryCopy(memory_alloc_info->mapped_pointer + offset, copy_size, data, copy_size);
+            util::StreamingMemoryCopy(memory_alloc_info->mapped_pointer + offset, data, copy_size);
 
             result = VK_SUCCESS;
         }
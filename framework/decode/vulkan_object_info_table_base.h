@@ -24,6 +24,7 @@
 #ifndef GFXRECON_DECODE_VULKAN_OBJECT_MAPPER_BASE_H
 #define GFXRECON_DECODE_VULKAN_OBJECT_MAPPER_BASE_H
 
+#include "decode/handle_info_table.h"
 #include "decode/vulkan_object_info.h"
 #include "format/format.h"
 #include "util/defines.h"
@@ -32,7 +33,6 @@
 
 #include <cassert>
 #include <functional>
-#include <unordered_map>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
@@ -53,7 +53,7 @@ class VulkanObjectInfoTableBase
 {
   protected:
     template <typename T>
-    void AddObjectInfo(T&& info, std::unordered_map<format::HandleId, T>* map)
+    void AddObjectInfo(T&& info, HandleInfoTable<T>* map)
     {
         assert(map != nullptr);
 
@@ -66,7 +66,7 @@ class VulkanObjectInfoTableBase
 
         if ((info.capture_id != 0) && valid_handle)
         {
-            auto result = map->emplace(info.capture_id, std::forward<T>(info));
+            auto result = map->Emplace(info.capture_id, std::forward<T>(info));
 
             if (!result.second)
             {
@@ -102,13 +102,13 @@ class VulkanObjectInfoTableBase
     // Note: the "dummy" template parameter is here for the sole purpose of working around a gcc issue which does
     // not allow full specialization in non-namespace scope (https://gcc.gnu.org/bugzilla/show_bug.cgi?id=85282)
     template <typename dummy>
-    void AddObjectInfo(SurfaceKHRInfo&& info, std::unordered_map<format::HandleId, SurfaceKHRInfo>* map)
+    void AddObjectInfo(SurfaceKHRInfo&& info, HandleInfoTable<SurfaceKHRInfo>* map)
     {
         assert(map != nullptr);
 
         if (info.capture_id != 0)
         {
-            auto result = map->emplace(info.capture_id, std::forward<SurfaceKHRInfo>(info));
+            auto result = map->Emplace(info.capture_id, std::forward<SurfaceKHRInfo>(info));
 
             if (!result.second)
             {
@@ -130,7 +130,7 @@ class VulkanObjectInfoTableBase
     }
 
     template <typename T>
-    const T* GetObjectInfo(format::HandleId id, const std::unordered_map<format::HandleId, T>* map) const
+    const T* GetObjectInfo(format::HandleId id, const HandleInfoTable<T>* map) const
     {
         assert(map != nullptr);
 
@@ -138,19 +138,14 @@ class VulkanObjectInfoTableBase
 
         if (id != 0)
         {
-            const auto entry = map->find(id);
-
-            if (entry != map->end())
-            {
-                object_info = &entry->second;
-            }
+            object_info = map->Find(id);
         }
 
         return object_info;
     }
 
     template <typename T>
-    T* GetObjectInfo(format::HandleId id, std::unordered_map<format::HandleId, T>* map)
+    T* GetObjectInfo(format::HandleId id, HandleInfoTable<T>* map)
     {
         assert(map != nullptr);
 
@@ -158,12 +153,7 @@ class VulkanObjectInfoTableBase
 
         if (id != 0)
         {
-            auto entry = map->find(id);
-
-            if (entry != map->end())
-            {
-                object_info = &entry->second;
-            }
+            object_info = map->Find(id);
         }
 
         return object_info;
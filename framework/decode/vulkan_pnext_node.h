@@ -52,7 +52,7 @@ class PNextNode
 
     virtual const void* GetMetaStructPointer() const = 0;
 
-    virtual size_t Decode(const uint8_t* buffer, size_t buffer_size) = 0;
+    virtual size_t Decode(const uint8_t* buffer, size_t buffer_size, bool compact_encoding) = 0;
 };
 
 template <typename T>
@@ -54,9 +54,9 @@ class PNextTypedNode : public PNextNode
 
     virtual const void* GetMetaStructPointer() const override { return struct_pointer_.GetMetaStructPointer(); }
 
-    virtual size_t Decode(const uint8_t* buffer, size_t buffer_size) override
+    virtual size_t Decode(const uint8_t* buffer, size_t buffer_size, bool compact_encoding) override
     {
-        return struct_pointer_.Decode(buffer, buffer_size);
+        return struct_pointer_.Decode(buffer, buffer_size, compact_encoding);
     }
 
   private:
@@ -57,6 +57,7 @@
 #include "format/format.h"
 #include "format/format_util.h"
 #include "util/logging.h"
+#include "util/memory_copy.h"
 #include "util/platform.h"
 
 #include "generated/generated_vulkan_enum_to_string.h"
@@ -1203,10 +1204,8 @@ void VulkanRebindAllocator::WriteBoundResourceDirect(
 {
     if (resource_alloc_info->object_type == ObjectType::buffer)
     {
-        util::platform::MemoryCopy(static_cast<uint8_t*>(resource_alloc_info->mapped_pointer) + dst_offset,
-                                   data_size,
-                                   data + src_offset,
-                                   data_size);
+        util::StreamingMemoryCopy(
+            static_cast<uint8_t*>(resource_alloc_info->mapped_pointer) + dst_offset, data + src_offset, data_size);
     }
     else if (resource_alloc_info->object_type == ObjectType::image)
     {
@@ -1242,10 +1241,8 @@ void VulkanRebindAllocator::WriteBoundResourceDirect(
             GFXRECON_LOG_WARNING("Image subresource layout info is not available for mapped memory write; "
                                  "capture/replay memory alignment differences will not be handled properly");
 
-            util::platform::MemoryCopy(static_cast<uint8_t*>(resource_alloc_info->mapped_pointer) + dst_offset,
-                                       data_size,
-                                       data + src_offset,
-                                       data_size);
+            util::StreamingMemoryCopy(
+                static_cast<uint8_t*>(resource_alloc_info->mapped_pointer) + dst_offset, data + src_offset, data_size);
         }
     }
     else if (resource_alloc_info->object_type == ObjectType::video_session)
@@ -173,7 +173,8 @@ VulkanReplayConsumerBase::VulkanReplayConsumerBase(std::shared_ptr<application::
     resource_dumper(options, object_info_table_),
     loader_handle_(nullptr), get_instance_proc_addr_(nullptr), create_instance_proc_(nullptr),
     application_(application), options_(options), loading_trim_state_(false), replaying_trimmed_capture_(false),
-    have_imported_semaphores_(false), fps_info_(nullptr), omitted_pipeline_cache_data_(false)
+    have_imported_semaphores_(false), fps_info_(nullptr), replay_profiler_(nullptr),
+    omitted_pipeline_cache_data_(false)
 {
     assert(application_ != nullptr);
     assert(options.create_resource_allocator != nullptr);
@@ -794,8 +795,14 @@ void VulkanReplayConsumerBase::ProcessBeginResourceInitCommand(format::HandleId
             have_shader_stencil_write = true;
         }
 
-        device_info->resource_initializer = std::make_unique<VulkanResourceInitializer>(
-            device_info, max_copy_size, properties, have_shader_stencil_write, allocator, table);
+        device_info->resource_initializer =
+            std::make_unique<VulkanResourceInitializer>(device_info,
+                                                        max_copy_size,
+                                                        options_.resource_init_staging_size,
+                                                        properties,
+                                                        have_shader_stencil_write,
+                                                        allocator,
+                                                        table);
     }
 }
 
@@ -805,6 +812,16 @@ void VulkanReplayConsumerBase::ProcessEndResourceInitCommand(format::HandleId de
 
     if ((device_info != nullptr) && (device_info->resource_initializer != nullptr))
     {
+        VkResult result = device_info->resource_initializer->Flush();
+
+        if (result != VK_SUCCESS)
+        {
+            GFXRECON_LOG_WARNING("State snapshot batched resource upload failed for VkDevice object (ID = %" PRIu64
+                                 ") with error %s",
+                                 device_id,
+                                 util::ToString<VkResult>(result).c_str());
+        }
+
         device_info->resource_initializer.reset();
     }
 }
@@ -3143,6 +3160,8 @@ VkResult VulkanReplayConsumerBase::OverrideWaitForFences(PFN_vkWaitForFences
 {
     assert((device_info != nullptr) && (pFences != nullptr));
 
+    ReplayProfiler::ScopedDriverTimer driver_timer(replay_profiler_);
+
     VkResult             result               = VK_SUCCESS;
     VkDevice             device               = device_info->handle;
     uint32_t             modified_fence_count = fenceCount;
@@ -3333,6 +3352,8 @@ VkResult VulkanReplayConsumerBase::OverrideQueueSubmit(PFN_vkQueueSubmit func,
 {
     assert((queue_info != nullptr) && (pSubmits != nullptr));
 
+    ReplayProfiler::ScopedDriverTimer driver_timer(replay_profiler_);
+
     VkResult            result       = VK_SUCCESS;
     const VkSubmitInfo* submit_infos = pSubmits->GetPointer();
     assert(submitCount == 0 || submit_infos != nullptr);
@@ -3508,6 +3529,8 @@ VkResult VulkanReplayConsumerBase::OverrideQueueSubmit2(PFN_vkQueueSubmit2 func,
 {
     assert((queue_info != nullptr) && (pSubmits != nullptr));
 
+    ReplayProfiler::ScopedDriverTimer driver_timer(replay_profiler_);
+
     VkResult             result       = VK_SUCCESS;
     const VkSubmitInfo2* submit_infos = pSubmits->GetPointer();
     assert(submitCount == 0 || submit_infos != nullptr);
@@ -6632,6 +6655,8 @@ VulkanReplayConsumerBase::OverrideQueuePresentKHR(PFN_vkQueuePresentKHR
 {
     assert((queue_info != nullptr) && (pPresentInfo != nullptr) && !pPresentInfo->IsNull());
 
+    ReplayProfiler::ScopedDriverTimer driver_timer(replay_profiler_);
+
     VkResult   result             = VK_SUCCESS;
     const auto present_info       = pPresentInfo->GetPointer();
     auto       present_info_data  = pPresentInfo->GetMetaStructPointer();
@@ -37,6 +37,7 @@
 #include "decode/vulkan_resource_allocator.h"
 #include "decode/vulkan_resource_tracking_consumer.h"
 #include "decode/vulkan_resource_initializer.h"
+#include "decode/replay_profiler.h"
 #include "decode/vulkan_swapchain.h"
 #include "format/api_call_id.h"
 #include "format/platform_types.h"
@@ -87,6 +88,10 @@ class VulkanReplayConsumerBase : public VulkanConsumer
 
     void SetFpsInfo(graphics::FpsInfo* fps_info) { fps_info_ = fps_info; }
 
+    // When profiler is not null, the time spent in queue submission, presentation, and fence waits is recorded as
+    // driver time by the profiler.
+    void SetReplayProfiler(ReplayProfiler* profiler) { replay_profiler_ = profiler; }
+
     virtual void WaitDevicesIdle() override;
 
     virtual void ProcessStateBeginMarker(uint64_t frame_number) override;
@@ -1487,6 +1492,7 @@ class VulkanReplayConsumerBase : public VulkanConsumer
     std::unique_ptr<VulkanSwapchain>                                           swapchain_;
     std::string                                                                screenshot_file_prefix_;
     graphics::FpsInfo*                                                         fps_info_;
+    ReplayProfiler*                                                            replay_profiler_;
 
     std::unordered_map<VkDevice, decode::VulkanDeviceAddressTracker> _device_address_trackers;
 
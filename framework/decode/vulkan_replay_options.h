@@ -54,6 +54,9 @@ enum class SkipGetFenceStatus
 // This default value essentially defines to dump all attachments.
 static constexpr int kUnspecifiedColorAttachment = -1;
 
+// Default size of the staging buffer used to batch the resource uploads from a state snapshot.
+static constexpr uint64_t kDefaultResourceInitStagingSize = 64 * 1024 * 1024;
+
 struct VulkanReplayOptions : public ReplayOptions
 {
     bool                         enable_vulkan{ true };
@@ -77,6 +80,7 @@ struct VulkanReplayOptions : public ReplayOptions
     SkipGetFenceStatus           skip_get_fence_status{ SkipGetFenceStatus::NoSkip };
     std::vector<util::UintRange> skip_get_fence_ranges;
     bool                         wait_before_present{ false };
+    uint64_t                     resource_init_staging_size{ kDefaultResourceInitStagingSize };
 
     // Dumping resources related configurable replay options
     std::vector<uint64_t>                           BeginCommandBuffer_Indices;
@@ -25,24 +25,45 @@
 
 #include "decode/copy_shaders.h"
 #include "decode/decoder_util.h"
+#include "util/logging.h"
 #include "util/platform.h"
 
 #include <algorithm>
 #include <cassert>
+#include <cinttypes>
 #include <limits>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+// Number of sections that the staging ring is divided into.  Uploads are recorded to one section while the previously
+// submitted sections are processed by the device.
+const size_t kStagingBatchCount = 4;
+
+// Alignment of the staging ring offsets used for copies.  Buffer to image copy offsets must be a multiple of 4 and of
+// the texel block size of the image format, which is a factor of 384 for all formats, including 3, 6, 12, and 24 byte
+// formats.
+const VkDeviceSize kStagingCopyAlignment = 384;
+
+static VkDeviceSize AlignStagingOffset(VkDeviceSize offset)
+{
+    return ((offset + kStagingCopyAlignment - 1) / kStagingCopyAlignment) * kStagingCopyAlignment;
+}
+
 VulkanResourceInitializer::VulkanResourceInitializer(const DeviceInfo*                       device_info,
                                                      VkDeviceSize                            max_copy_size,
+                                                     VkDeviceSize                            staging_ring_size,
                                                      const VkPhysicalDeviceMemoryProperties& memory_properties,
                                                      bool                                    have_shader_stencil_write,
                                                      VulkanResourceAllocator*                resource_allocator,
                                                      const encode::VulkanDeviceTable*        device_table) :
     device_(device_info->handle),
     staging_memory_(VK_NULL_HANDLE), staging_memory_data_(0), staging_buffer_(VK_NULL_HANDLE), staging_buffer_data_(0),
-    draw_sampler_(VK_NULL_HANDLE), draw_pool_(VK_NULL_HANDLE), draw_set_layout_(VK_NULL_HANDLE),
+    staging_ring_memory_(VK_NULL_HANDLE), staging_ring_memory_data_(0), staging_ring_buffer_(VK_NULL_HANDLE),
+    staging_ring_buffer_data_(0), staging_ring_data_(nullptr), staging_ring_coherent_(false),
+    staging_ring_size_((staging_ring_size / (kStagingBatchCount * kStagingCopyAlignment)) *
+                       (kStagingBatchCount * kStagingCopyAlignment)),
+    current_batch_(0), draw_sampler_(VK_NULL_HANDLE), draw_pool_(VK_NULL_HANDLE), draw_set_layout_(VK_NULL_HANDLE),
     draw_set_(VK_NULL_HANDLE), max_copy_size_(max_copy_size), have_shader_stencil_write_(have_shader_stencil_write),
     resource_allocator_(resource_allocator), device_table_(device_table), device_info_(device_info)
 {
@@ -62,6 +83,17 @@ VulkanResourceInitializer::VulkanResourceInitializer(const DeviceInfo*
 
 VulkanResourceInitializer::~VulkanResourceInitializer()
 {
+    // Command buffers and staging memory cannot be destroyed while batched uploads are pending.
+    Flush();
+
+    for (const auto& batch : staging_batches_)
+    {
+        for (const auto& entry : batch.command_buffers)
+        {
+            device_table_->DestroyFence(device_, entry.second.fence, nullptr);
+        }
+    }
+
     for (const auto& entry : command_exec_objects_)
     {
         device_table_->DestroyCommandPool(device_, entry.second.command_pool, nullptr);
@@ -77,6 +109,13 @@ VulkanResourceInitializer::~VulkanResourceInitializer()
         resource_allocator_->FreeMemoryDirect(staging_memory_, nullptr, staging_memory_data_);
     }
 
+    if (staging_ring_buffer_ != VK_NULL_HANDLE)
+    {
+        resource_allocator_->UnmapResourceMemoryDirect(staging_ring_buffer_data_);
+        resource_allocator_->DestroyBufferDirect(staging_ring_buffer_, nullptr, staging_ring_buffer_data_);
+        resource_allocator_->FreeMemoryDirect(staging_ring_memory_, nullptr, staging_ring_memory_data_);
+    }
+
     device_table_->DestroySampler(device_, draw_sampler_, nullptr);
     device_table_->DestroyDescriptorPool(device_, draw_pool_, nullptr);
     device_table_->DestroyDescriptorSetLayout(device_, draw_set_layout_, nullptr);
@@ -111,33 +150,67 @@ VkResult VulkanResourceInitializer::InitializeBuffer(VkDeviceSize        data_si
     // TODO: handle usage cases without TRANSFER_DST.
     GFXRECON_UNREFERENCED_PARAMETER(usage);
 
-    VkQueue                               queue               = VK_NULL_HANDLE;
-    VkCommandBuffer                       command_buffer      = VK_NULL_HANDLE;
-    VkDeviceMemory                        staging_memory      = VK_NULL_HANDLE;
-    VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
-    VulkanResourceAllocator::MemoryData   staging_memory_data = 0;
-    VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
+    VkQueue         queue          = VK_NULL_HANDLE;
+    VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+    VkResult        result         = VK_SUCCESS;
+
+    if (CanBatchUpload(data_size) && (CreateStagingRing() == VK_SUCCESS))
+    {
+        VkDeviceSize staging_offset = 0;
 
-    VkResult result = GetCommandExecObjects(queue_family_index, &queue, &command_buffer);
+        result = LoadBatchStagingData(data_size, data, &staging_offset);
 
-    if (result == VK_SUCCESS)
+        if (result == VK_SUCCESS)
+        {
+            result = GetBatchCommandBuffer(queue_family_index, &command_buffer);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            std::vector<VkBufferCopy> staging_regions(regions, regions + region_count);
+
+            for (auto& region : staging_regions)
+            {
+                region.srcOffset += staging_offset;
+            }
+
+            device_table_->CmdCopyBuffer(
+                command_buffer, staging_ring_buffer_, buffer, region_count, staging_regions.data());
+        }
+    }
+    else
     {
-        result = AcquireInitializedStagingBuffer(
-            data_size, data, &staging_memory, &staging_buffer, &staging_memory_data, &staging_buffer_data);
+        VkDeviceMemory                        staging_memory      = VK_NULL_HANDLE;
+        VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
+        VulkanResourceAllocator::MemoryData   staging_memory_data = 0;
+        VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
+
+        result = SubmitPendingBatch();
 
         if (result == VK_SUCCESS)
         {
-            result = BeginCommandBuffer(command_buffer);
+            result = GetCommandExecObjects(queue_family_index, &queue, &command_buffer);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            result = AcquireInitializedStagingBuffer(
+                data_size, data, &staging_memory, &staging_buffer, &staging_memory_data, &staging_buffer_data);
 
             if (result == VK_SUCCESS)
             {
-                device_table_->CmdCopyBuffer(command_buffer, staging_buffer, buffer, region_count, regions);
-                device_table_->EndCommandBuffer(command_buffer);
+                result = BeginCommandBuffer(command_buffer);
 
-                result = ExecuteCommandBuffer(queue, command_buffer);
-            }
+                if (result == VK_SUCCESS)
+                {
+                    device_table_->CmdCopyBuffer(command_buffer, staging_buffer, buffer, region_count, regions);
+                    device_table_->EndCommandBuffer(command_buffer);
 
-            ReleaseStagingBuffer(staging_memory, staging_buffer, staging_memory_data, staging_buffer_data);
+                    result = ExecuteCommandBuffer(queue, command_buffer);
+                }
+
+                ReleaseStagingBuffer(staging_memory, staging_buffer, staging_memory_data, staging_buffer_data);
+            }
         }
     }
 
@@ -160,65 +233,104 @@ VkResult VulkanResourceInitializer::InitializeImage(VkDeviceSize             dat
                                                     uint32_t                 level_count,
                                                     const VkBufferImageCopy* level_copies)
 {
-    VkDeviceMemory                        staging_memory      = VK_NULL_HANDLE;
-    VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
-    VulkanResourceAllocator::MemoryData   staging_memory_data = 0;
-    VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
+    bool use_transfer = ((usage & VK_IMAGE_USAGE_TRANSFER_DST_BIT) == VK_IMAGE_USAGE_TRANSFER_DST_BIT) &&
+                        (sample_count == VK_SAMPLE_COUNT_1_BIT);
+    bool use_color_write = ((usage & VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) == VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) &&
+                           (aspect == VK_IMAGE_ASPECT_COLOR_BIT);
+    bool use_depth_write =
+        ((usage & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) == VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) &&
+        (aspect == VK_IMAGE_ASPECT_DEPTH_BIT);
+    bool use_stencil_write =
+        ((usage & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) == VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) &&
+        (aspect == VK_IMAGE_ASPECT_STENCIL_BIT) && have_shader_stencil_write_;
+    bool use_pixel_shader =
+        !use_transfer && (use_color_write || use_depth_write || use_stencil_write) && (type == VK_IMAGE_TYPE_2D);
 
-    VkResult result = AcquireInitializedStagingBuffer(
-        data_size, data, &staging_memory, &staging_buffer, &staging_memory_data, &staging_buffer_data);
+    VkResult result = VK_SUCCESS;
 
-    if (result == VK_SUCCESS)
+    // The pixel shader copy creates temporary objects for each image, and is always executed immediately.
+    if (!use_pixel_shader && CanBatchUpload(data_size) && (CreateStagingRing() == VK_SUCCESS))
     {
-        result = LoadData(data_size, data, staging_buffer_data);
+        VkDeviceSize    staging_offset = 0;
+        VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+
+        result = LoadBatchStagingData(data_size, data, &staging_offset);
+
+        if (result == VK_SUCCESS)
+        {
+            result = GetBatchCommandBuffer(queue_family_index, &command_buffer);
+        }
 
         if (result == VK_SUCCESS)
         {
-            bool use_transfer = ((usage & VK_IMAGE_USAGE_TRANSFER_DST_BIT) == VK_IMAGE_USAGE_TRANSFER_DST_BIT) &&
-                                (sample_count == VK_SAMPLE_COUNT_1_BIT);
-            bool use_color_write =
-                ((usage & VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) == VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) &&
-                (aspect == VK_IMAGE_ASPECT_COLOR_BIT);
-            bool use_depth_write = ((usage & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) ==
-                                    VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) &&
-                                   (aspect == VK_IMAGE_ASPECT_DEPTH_BIT);
-            bool use_stencil_write = ((usage & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) ==
-                                      VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) &&
-                                     (aspect == VK_IMAGE_ASPECT_STENCIL_BIT) && have_shader_stencil_write_;
-
-            if (!use_transfer && (use_color_write || use_depth_write || use_stencil_write) &&
-                (type == VK_IMAGE_TYPE_2D))
+            std::vector<VkBufferImageCopy> staging_copies(level_copies, level_copies + level_count);
+
+            for (auto& level_copy : staging_copies)
             {
-                result = PixelShaderImageCopy(queue_family_index,
-                                              staging_buffer,
-                                              image,
-                                              type,
-                                              format,
-                                              extent,
-                                              aspect,
-                                              sample_count,
-                                              initial_layout,
-                                              final_layout,
-                                              layer_count,
-                                              level_count,
-                                              level_copies);
+                level_copy.bufferOffset += staging_offset;
             }
-            else
+
+            RecordBufferToImageCopy(command_buffer,
+                                    staging_ring_buffer_,
+                                    image,
+                                    format,
+                                    aspect,
+                                    initial_layout,
+                                    final_layout,
+                                    layer_count,
+                                    level_count,
+                                    staging_copies.data());
+        }
+    }
+    else
+    {
+        VkDeviceMemory                        staging_memory      = VK_NULL_HANDLE;
+        VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
+        VulkanResourceAllocator::MemoryData   staging_memory_data = 0;
+        VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
+
+        result = SubmitPendingBatch();
+
+        if (result == VK_SUCCESS)
+        {
+            result = AcquireInitializedStagingBuffer(
+                data_size, data, &staging_memory, &staging_buffer, &staging_memory_data, &staging_buffer_data);
+
+            if (result == VK_SUCCESS)
             {
-                result = BufferToImageCopy(queue_family_index,
-                                           staging_buffer,
-                                           image,
-                                           format,
-                                           aspect,
-                                           initial_layout,
-                                           final_layout,
-                                           layer_count,
-                                           level_count,
-                                           level_copies);
+                if (use_pixel_shader)
+                {
+                    result = PixelShaderImageCopy(queue_family_index,
+                                                  staging_buffer,
+                                                  image,
+                                                  type,
+                                                  format,
+                                                  extent,
+                                                  aspect,
+                                                  sample_count,
+                                                  initial_layout,
+                                                  final_layout,
+                                                  layer_count,
+                                                  level_count,
+                                                  level_copies);
+                }
+                else
+                {
+                    result = BufferToImageCopy(queue_family_index,
+                                               staging_buffer,
+                                               image,
+                                               format,
+                                               aspect,
+                                               initial_layout,
+                                               final_layout,
+                                               layer_count,
+                                               level_count,
+                                               level_copies);
+                }
+
+                ReleaseStagingBuffer(staging_memory, staging_buffer, staging_memory_data, staging_buffer_data);
             }
         }
-
-        ReleaseStagingBuffer(staging_memory, staging_buffer, staging_memory_data, staging_buffer_data);
     }
 
     return result;
@@ -235,47 +347,57 @@ VkResult VulkanResourceInitializer::TransitionImage(uint32_t              queue_
 {
     VkQueue         queue          = VK_NULL_HANDLE;
     VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+    VkResult        result         = VK_SUCCESS;
 
-    VkResult result = GetCommandExecObjects(queue_family_index, &queue, &command_buffer);
+    if (CanBatchUpload(0) && (CreateStagingRing() == VK_SUCCESS))
+    {
+        result = GetBatchCommandBuffer(queue_family_index, &command_buffer);
 
-    if (result == VK_SUCCESS)
+        if (result == VK_SUCCESS)
+        {
+            RecordImageTransition(
+                command_buffer, image, format, aspect, initial_layout, final_layout, layer_count, level_count);
+        }
+    }
+    else
     {
-        result = BeginCommandBuffer(command_buffer);
+        result = GetCommandExecObjects(queue_family_index, &queue, &command_buffer);
 
         if (result == VK_SUCCESS)
         {
-            VkImageLayout      old_layout        = initial_layout;
-            VkImageAspectFlags transition_aspect = GetImageTransitionAspect(format, aspect, &old_layout);
-
-            VkImageMemoryBarrier memory_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
-            memory_barrier.pNext                           = nullptr;
-            memory_barrier.srcAccessMask                   = 0;
-            memory_barrier.dstAccessMask                   = 0;
-            memory_barrier.oldLayout                       = old_layout;
-            memory_barrier.newLayout                       = final_layout;
-            memory_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-            memory_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-            memory_barrier.image                           = image;
-            memory_barrier.subresourceRange.aspectMask     = transition_aspect;
-            memory_barrier.subresourceRange.baseMipLevel   = 0;
-            memory_barrier.subresourceRange.levelCount     = level_count;
-            memory_barrier.subresourceRange.baseArrayLayer = 0;
-            memory_barrier.subresourceRange.layerCount     = layer_count;
-
-            device_table_->CmdPipelineBarrier(command_buffer,
-                                              VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-                                              VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
-                                              0,
-                                              0,
-                                              nullptr,
-                                              0,
-                                              nullptr,
-                                              1,
-                                              &memory_barrier);
+            result = BeginCommandBuffer(command_buffer);
 
-            device_table_->EndCommandBuffer(command_buffer);
+            if (result == VK_SUCCESS)
+            {
+                RecordImageTransition(
+                    command_buffer, image, format, aspect, initial_layout, final_layout, layer_count, level_count);
 
-            result = ExecuteCommandBuffer(queue, command_buffer);
+                device_table_->EndCommandBuffer(command_buffer);
+
+                result = ExecuteCommandBuffer(queue, command_buffer);
+            }
+        }
+    }
+
+    return result;
+}
+
+VkResult VulkanResourceInitializer::Flush()
+{
+    VkResult result = VK_SUCCESS;
+
+    if (!staging_batches_.empty())
+    {
+        result = SubmitBatch(current_batch_);
+
+        for (size_t i = 0; i < staging_batches_.size(); ++i)
+        {
+            VkResult wait_result = WaitForBatch(i);
+
+            if (result == VK_SUCCESS)
+            {
+                result = wait_result;
+            }
         }
     }
 
@@ -1107,6 +1229,323 @@ VkResult VulkanResourceInitializer::ExecuteCommandBuffer(VkQueue queue, VkComman
     return result;
 }
 
+bool VulkanResourceInitializer::CanBatchUpload(VkDeviceSize data_size) const
+{
+    return (staging_ring_size_ > 0) && (AlignStagingOffset(data_size) <= (staging_ring_size_ / kStagingBatchCount));
+}
+
+VkResult VulkanResourceInitializer::CreateStagingRing()
+{
+    if (staging_ring_buffer_ != VK_NULL_HANDLE)
+    {
+        return VK_SUCCESS;
+    }
+
+    VkBufferCreateInfo create_info    = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
+    create_info.pNext                 = nullptr;
+    create_info.flags                 = 0;
+    create_info.size                  = staging_ring_size_;
+    create_info.usage                 = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    create_info.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
+    create_info.queueFamilyIndexCount = 0;
+    create_info.pQueueFamilyIndices   = nullptr;
+
+    VkResult result = resource_allocator_->CreateBufferDirect(
+        &create_info, nullptr, &staging_ring_buffer_, &staging_ring_buffer_data_);
+
+    if (result == VK_SUCCESS)
+    {
+        VkMemoryRequirements memory_requirements;
+        device_table_->GetBufferMemoryRequirements(device_, staging_ring_buffer_, &memory_requirements);
+
+        // Prefer coherent memory, which does not need to be flushed before each batch is submitted.
+        uint32_t memory_type_index =
+            GetMemoryTypeIndex(memory_requirements.memoryTypeBits,
+                               VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+        if (memory_type_index == std::numeric_limits<uint32_t>::max())
+        {
+            memory_type_index =
+                GetMemoryTypeIndex(memory_requirements.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+        }
+
+        assert(memory_type_index != std::numeric_limits<uint32_t>::max());
+
+        VkMemoryAllocateInfo alloc_info = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
+        alloc_info.pNext                = nullptr;
+        alloc_info.allocationSize       = memory_requirements.size;
+        alloc_info.memoryTypeIndex      = memory_type_index;
+
+        result = resource_allocator_->AllocateMemoryDirect(
+            &alloc_info, nullptr, &staging_ring_memory_, &staging_ring_memory_data_);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        VkMemoryPropertyFlags flags = 0;
+
+        result = resource_allocator_->BindBufferMemoryDirect(staging_ring_buffer_,
+                                                             staging_ring_memory_,
+                                                             0,
+                                                             staging_ring_buffer_data_,
+                                                             staging_ring_memory_data_,
+                                                             &flags);
+
+        staging_ring_coherent_ = (flags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) == VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        void* mapped_memory = nullptr;
+
+        result = resource_allocator_->MapResourceMemoryDirect(
+            staging_ring_size_, 0, &mapped_memory, staging_ring_buffer_data_);
+
+        staging_ring_data_ = reinterpret_cast<uint8_t*>(mapped_memory);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        VkDeviceSize batch_size = staging_ring_size_ / kStagingBatchCount;
+
+        staging_batches_.resize(kStagingBatchCount);
+
+        for (size_t i = 0; i < kStagingBatchCount; ++i)
+        {
+            staging_batches_[i].begin  = i * batch_size;
+            staging_batches_[i].end    = staging_batches_[i].begin + batch_size;
+            staging_batches_[i].offset = staging_batches_[i].begin;
+        }
+    }
+    else
+    {
+        GFXRECON_LOG_WARNING("Failed to create a %" PRIu64
+                             " byte staging buffer for batched state snapshot uploads; resources will be uploaded "
+                             "individually",
+                             staging_ring_size_);
+
+        if (staging_ring_buffer_ != VK_NULL_HANDLE)
+        {
+            resource_allocator_->DestroyBufferDirect(staging_ring_buffer_, nullptr, staging_ring_buffer_data_);
+            staging_ring_buffer_ = VK_NULL_HANDLE;
+        }
+
+        if (staging_ring_memory_ != VK_NULL_HANDLE)
+        {
+            resource_allocator_->FreeMemoryDirect(staging_ring_memory_, nullptr, staging_ring_memory_data_);
+            staging_ring_memory_ = VK_NULL_HANDLE;
+        }
+
+        // Disable batching.
+        staging_ring_size_ = 0;
+    }
+
+    return result;
+}
+
+VkResult VulkanResourceInitializer::LoadBatchStagingData(VkDeviceSize   data_size,
+                                                         const uint8_t* data,
+                                                         VkDeviceSize*  staging_offset)
+{
+    assert((staging_ring_data_ != nullptr) && (staging_offset != nullptr));
+
+    VkResult     result = VK_SUCCESS;
+    VkDeviceSize offset = AlignStagingOffset(staging_batches_[current_batch_].offset);
+
+    if ((offset + data_size) > staging_batches_[current_batch_].end)
+    {
+        result = AdvanceBatch();
+        offset = staging_batches_[current_batch_].offset;
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, data_size);
+        size_t copy_size = static_cast<size_t>(data_size);
+        util::platform::MemoryCopy(staging_ring_data_ + offset, copy_size, data, copy_size);
+
+        staging_batches_[current_batch_].offset = offset + data_size;
+        (*staging_offset)                       = offset;
+    }
+
+    return result;
+}
+
+VkResult VulkanResourceInitializer::GetBatchCommandBuffer(uint32_t queue_family_index, VkCommandBuffer* command_buffer)
+{
+    assert(command_buffer != nullptr);
+
+    VkResult      result = VK_SUCCESS;
+    StagingBatch& batch  = staging_batches_[current_batch_];
+    auto          entry  = batch.command_buffers.find(queue_family_index);
+
+    if (entry == batch.command_buffers.end())
+    {
+        VkQueue         queue               = VK_NULL_HANDLE;
+        VkCommandBuffer exec_command_buffer = VK_NULL_HANDLE;
+
+        result = GetCommandExecObjects(queue_family_index, &queue, &exec_command_buffer);
+
+        if (result == VK_SUCCESS)
+        {
+            BatchCommandBuffer batch_command_buffer = { queue, VK_NULL_HANDLE, VK_NULL_HANDLE, false, false };
+
+            VkCommandBufferAllocateInfo alloc_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+            alloc_info.pNext                       = nullptr;
+            alloc_info.commandPool                 = command_exec_objects_[queue_family_index].command_pool;
+            alloc_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            alloc_info.commandBufferCount          = 1;
+
+            result = device_table_->AllocateCommandBuffers(device_, &alloc_info, &batch_command_buffer.command_buffer);
+
+            if (result == VK_SUCCESS)
+            {
+                VkFenceCreateInfo fence_info = { VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+                fence_info.pNext             = nullptr;
+                fence_info.flags             = 0;
+
+                result = device_table_->CreateFence(device_, &fence_info, nullptr, &batch_command_buffer.fence);
+
+                if (result == VK_SUCCESS)
+                {
+                    entry = batch.command_buffers.emplace(queue_family_index, batch_command_buffer).first;
+                }
+                else
+                {
+                    device_table_->FreeCommandBuffers(
+                        device_, alloc_info.commandPool, 1, &batch_command_buffer.command_buffer);
+                }
+            }
+        }
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        BatchCommandBuffer& batch_command_buffer = entry->second;
+
+        if (!batch_command_buffer.recording)
+        {
+            result = BeginCommandBuffer(batch_command_buffer.command_buffer);
+
+            batch_command_buffer.recording = (result == VK_SUCCESS);
+        }
+
+        (*command_buffer) = batch_command_buffer.command_buffer;
+    }
+
+    return result;
+}
+
+VkResult VulkanResourceInitializer::SubmitBatch(size_t batch_index)
+{
+    VkResult      result = VK_SUCCESS;
+    StagingBatch& batch  = staging_batches_[batch_index];
+
+    if (!staging_ring_coherent_ && (batch.offset > batch.begin))
+    {
+        VkMappedMemoryRange memory_range = { VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE };
+        memory_range.pNext               = nullptr;
+        memory_range.memory              = staging_ring_memory_;
+        memory_range.offset              = 0;
+        memory_range.size                = VK_WHOLE_SIZE;
+
+        result = resource_allocator_->FlushMappedMemoryRangesDirect(1, &memory_range, &staging_ring_memory_data_);
+    }
+
+    for (auto& entry : batch.command_buffers)
+    {
+        BatchCommandBuffer& batch_command_buffer = entry.second;
+
+        if ((result == VK_SUCCESS) && batch_command_buffer.recording)
+        {
+            device_table_->EndCommandBuffer(batch_command_buffer.command_buffer);
+            batch_command_buffer.recording = false;
+
+            VkSubmitInfo submit_info         = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+            submit_info.pNext                = nullptr;
+            submit_info.waitSemaphoreCount   = 0;
+            submit_info.pWaitSemaphores      = nullptr;
+            submit_info.pWaitDstStageMask    = nullptr;
+            submit_info.commandBufferCount   = 1;
+            submit_info.pCommandBuffers      = &batch_command_buffer.command_buffer;
+            submit_info.signalSemaphoreCount = 0;
+            submit_info.pSignalSemaphores    = nullptr;
+
+            result =
+                device_table_->QueueSubmit(batch_command_buffer.queue, 1, &submit_info, batch_command_buffer.fence);
+
+            batch_command_buffer.submitted = (result == VK_SUCCESS);
+        }
+    }
+
+    return result;
+}
+
+VkResult VulkanResourceInitializer::WaitForBatch(size_t batch_index)
+{
+    VkResult      result = VK_SUCCESS;
+    StagingBatch& batch  = staging_batches_[batch_index];
+
+    for (auto& entry : batch.command_buffers)
+    {
+        BatchCommandBuffer& batch_command_buffer = entry.second;
+
+        if (batch_command_buffer.submitted)
+        {
+            VkResult wait_result = device_table_->WaitForFences(
+                device_, 1, &batch_command_buffer.fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+
+            if (wait_result == VK_SUCCESS)
+            {
+                wait_result = device_table_->ResetFences(device_, 1, &batch_command_buffer.fence);
+            }
+
+            if (result == VK_SUCCESS)
+            {
+                result = wait_result;
+            }
+
+            batch_command_buffer.submitted = false;
+        }
+    }
+
+    batch.offset = batch.begin;
+
+    return result;
+}
+
+VkResult VulkanResourceInitializer::AdvanceBatch()
+{
+    VkResult result = SubmitBatch(current_batch_);
+
+    current_batch_ = (current_batch_ + 1) % staging_batches_.size();
+
+    VkResult wait_result = WaitForBatch(current_batch_);
+
+    return (result == VK_SUCCESS) ? wait_result : result;
+}
+
+VkResult VulkanResourceInitializer::SubmitPendingBatch()
+{
+    VkResult result = VK_SUCCESS;
+
+    if (!staging_batches_.empty())
+    {
+        for (const auto& entry : staging_batches_[current_batch_].command_buffers)
+        {
+            if (entry.second.recording)
+            {
+                // Submit the batch before the upload is submitted to preserve the order of uploads to the same queue.
+                // The batch cannot be recorded to while it is pending, so the next batch becomes current.
+                result = AdvanceBatch();
+                break;
+            }
+        }
+    }
+
+    return result;
+}
+
 VkImageAspectFlags VulkanResourceInitializer::GetImageTransitionAspect(VkFormat              format,
                                                                        VkImageAspectFlagBits aspect,
                                                                        VkImageLayout*        old_layout)
@@ -1151,6 +1590,132 @@ uint32_t VulkanResourceInitializer::GetMemoryTypeIndex(uint32_t type_bits, VkMem
     return memory_type_index;
 }
 
+void VulkanResourceInitializer::RecordImageTransition(VkCommandBuffer       command_buffer,
+                                                      VkImage               image,
+                                                      VkFormat              format,
+                                                      VkImageAspectFlagBits aspect,
+                                                      VkImageLayout         initial_layout,
+                                                      VkImageLayout         final_layout,
+                                                      uint32_t              layer_count,
+                                                      uint32_t              level_count)
+{
+    VkImageLayout      old_layout        = initial_layout;
+    VkImageAspectFlags transition_aspect = GetImageTransitionAspect(format, aspect, &old_layout);
+
+    // The aspects of a combined depth/stencil image are initialized separately.  When both are recorded to the same
+    // command buffer, the transition for the second aspect must wait for the copy to the first aspect.
+    VkPipelineStageFlags src_stage  = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+    VkAccessFlags        src_access = 0;
+
+    if (transition_aspect != static_cast<VkImageAspectFlags>(aspect))
+    {
+        src_stage  = VK_PIPELINE_STAGE_TRANSFER_BIT;
+        src_access = VK_ACCESS_TRANSFER_WRITE_BIT;
+    }
+
+    VkImageMemoryBarrier memory_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+    memory_barrier.pNext                           = nullptr;
+    memory_barrier.srcAccessMask                   = src_access;
+    memory_barrier.dstAccessMask                   = 0;
+    memory_barrier.oldLayout                       = old_layout;
+    memory_barrier.newLayout                       = final_layout;
+    memory_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+    memory_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+    memory_barrier.image                           = image;
+    memory_barrier.subresourceRange.aspectMask     = transition_aspect;
+    memory_barrier.subresourceRange.baseMipLevel   = 0;
+    memory_barrier.subresourceRange.levelCount     = level_count;
+    memory_barrier.subresourceRange.baseArrayLayer = 0;
+    memory_barrier.subresourceRange.layerCount     = layer_count;
+
+    device_table_->CmdPipelineBarrier(command_buffer,
+                                      src_stage,
+                                      VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                                      0,
+                                      0,
+                                      nullptr,
+                                      0,
+                                      nullptr,
+                                      1,
+                                      &memory_barrier);
+}
+
+void VulkanResourceInitializer::RecordBufferToImageCopy(VkCommandBuffer          command_buffer,
+                                                        VkBuffer                 source,
+                                                        VkImage                  destination,
+                                                        VkFormat                 format,
+                                                        VkImageAspectFlagBits    aspect,
+                                                        VkImageLayout            initial_layout,
+                                                        VkImageLayout            final_layout,
+                                                        uint32_t                 layer_count,
+                                                        uint32_t                 level_count,
+                                                        const VkBufferImageCopy* level_copies)
+{
+    VkImageLayout      old_layout        = initial_layout;
+    VkImageAspectFlags transition_aspect = GetImageTransitionAspect(format, aspect, &old_layout);
+
+    // The aspects of a combined depth/stencil image are initialized separately.  When both are recorded to the same
+    // command buffer, the transition for the second aspect must wait for the copy to the first aspect.
+    VkPipelineStageFlags src_stage  = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+    VkAccessFlags        src_access = 0;
+
+    if (transition_aspect != static_cast<VkImageAspectFlags>(aspect))
+    {
+        src_stage  = VK_PIPELINE_STAGE_TRANSFER_BIT;
+        src_access = VK_ACCESS_TRANSFER_WRITE_BIT;
+    }
+
+    VkImageMemoryBarrier memory_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+    memory_barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    memory_barrier.pNext                           = nullptr;
+    memory_barrier.srcAccessMask                   = src_access;
+    memory_barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
+    memory_barrier.oldLayout                       = old_layout;
+    memory_barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    memory_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+    memory_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+    memory_barrier.image                           = destination;
+    memory_barrier.subresourceRange.aspectMask     = transition_aspect;
+    memory_barrier.subresourceRange.baseMipLevel   = 0;
+    memory_barrier.subresourceRange.levelCount     = level_count;
+    memory_barrier.subresourceRange.baseArrayLayer = 0;
+    memory_barrier.subresourceRange.layerCount     = layer_count;
+
+    device_table_->CmdPipelineBarrier(command_buffer,
+                                      src_stage,
+                                      VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                      0,
+                                      0,
+                                      nullptr,
+                                      0,
+                                      nullptr,
+                                      1,
+                                      &memory_barrier);
+
+    device_table_->CmdCopyBufferToImage(
+        command_buffer, source, destination, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, level_count, level_copies);
+
+    if ((final_layout != VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) && (final_layout != VK_IMAGE_LAYOUT_UNDEFINED) &&
+        (final_layout != VK_IMAGE_LAYOUT_PREINITIALIZED))
+    {
+        memory_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        memory_barrier.dstAccessMask = 0;
+        memory_barrier.oldLayout     = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        memory_barrier.newLayout     = final_layout;
+
+        device_table_->CmdPipelineBarrier(command_buffer,
+                                          VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                          VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                                          0,
+                                          0,
+                                          nullptr,
+                                          0,
+                                          nullptr,
+                                          1,
+                                          &memory_barrier);
+    }
+}
+
 VkResult VulkanResourceInitializer::BufferToImageCopy(uint32_t                 queue_family_index,
                                                       VkBuffer                 source,
                                                       VkImage                  destination,
@@ -1169,62 +1734,20 @@ VkResult VulkanResourceInitializer::BufferToImageCopy(uint32_t                 q
 
     if (result == VK_SUCCESS)
     {
-        VkImageLayout      old_layout        = initial_layout;
-        VkImageAspectFlags transition_aspect = GetImageTransitionAspect(format, aspect, &old_layout);
-
         result = BeginCommandBuffer(command_buffer);
 
         if (result == VK_SUCCESS)
         {
-            VkImageMemoryBarrier memory_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
-            memory_barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-            memory_barrier.pNext                           = nullptr;
-            memory_barrier.srcAccessMask                   = 0;
-            memory_barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
-            memory_barrier.oldLayout                       = old_layout;
-            memory_barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-            memory_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-            memory_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-            memory_barrier.image                           = destination;
-            memory_barrier.subresourceRange.aspectMask     = transition_aspect;
-            memory_barrier.subresourceRange.baseMipLevel   = 0;
-            memory_barrier.subresourceRange.levelCount     = level_count;
-            memory_barrier.subresourceRange.baseArrayLayer = 0;
-            memory_barrier.subresourceRange.layerCount     = layer_count;
-
-            device_table_->CmdPipelineBarrier(command_buffer,
-                                              VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-                                              VK_PIPELINE_STAGE_TRANSFER_BIT,
-                                              0,
-                                              0,
-                                              nullptr,
-                                              0,
-                                              nullptr,
-                                              1,
-                                              &memory_barrier);
-
-            device_table_->CmdCopyBufferToImage(
-                command_buffer, source, destination, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, level_count, level_copies);
-
-            if ((final_layout != VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) && (final_layout != VK_IMAGE_LAYOUT_UNDEFINED) &&
-                (final_layout != VK_IMAGE_LAYOUT_PREINITIALIZED))
-            {
-                memory_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-                memory_barrier.dstAccessMask = 0;
-                memory_barrier.oldLayout     = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-                memory_barrier.newLayout     = final_layout;
-
-                device_table_->CmdPipelineBarrier(command_buffer,
-                                                  VK_PIPELINE_STAGE_TRANSFER_BIT,
-                                                  VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
-                                                  0,
-                                                  0,
-                                                  nullptr,
-                                                  0,
-                                                  nullptr,
-                                                  1,
-                                                  &memory_barrier);
-            }
+            RecordBufferToImageCopy(command_buffer,
+                                    source,
+                                    destination,
+                                    format,
+                                    aspect,
+                                    initial_layout,
+                                    final_layout,
+                                    layer_count,
+                                    level_count,
+                                    level_copies);
 
             device_table_->EndCommandBuffer(command_buffer);
 
@@ -37,11 +37,16 @@ GFXRECON_BEGIN_NAMESPACE(decode)
 
 struct DeviceInfo;
 
+// Uploads the resource data from a state snapshot to device resources.  When a staging ring size is specified, the
+// copies and layout transitions for many resources are recorded to one command buffer per queue family, and are only
+// submitted when a section of the staging ring is full or Flush() is called.  Otherwise, each resource is uploaded with
+// a separate queue submission that is waited on before returning.
 class VulkanResourceInitializer
 {
   public:
     VulkanResourceInitializer(const DeviceInfo*                       device_info,
                               VkDeviceSize                            max_copy_size,
+                              VkDeviceSize                            staging_ring_size,
                               const VkPhysicalDeviceMemoryProperties& memory_properties,
                               bool                                    have_shader_stencil_write,
                               VulkanResourceAllocator*                resource_allocator,
@@ -146,11 +151,53 @@ class VulkanResourceInitializer
 
     VkResult ExecuteCommandBuffer(VkQueue queue, VkCommandBuffer command_buffer);
 
+    bool CanBatchUpload(VkDeviceSize data_size) const;
+
+    VkResult CreateStagingRing();
+
+    // Copies data to the staging ring, submitting the current batch and advancing to the next batch when the current
+    // batch does not have enough space for the data.
+    VkResult LoadBatchStagingData(VkDeviceSize data_size, const uint8_t* data, VkDeviceSize* staging_offset);
+
+    // Returns the command buffer that records the current batch of uploads for the queue family, beginning the command
+    // buffer if it is not already recording.
+    VkResult GetBatchCommandBuffer(uint32_t queue_family_index, VkCommandBuffer* command_buffer);
+
+    VkResult SubmitBatch(size_t batch_index);
+
+    VkResult WaitForBatch(size_t batch_index);
+
+    // Submits the current batch and makes the next batch current, waiting for its previous submissions to complete.
+    VkResult AdvanceBatch();
+
+    // Ensures that previously batched uploads are submitted before an upload that uses a separate submission.
+    VkResult SubmitPendingBatch();
+
     VkImageAspectFlags
     GetImageTransitionAspect(VkFormat format, VkImageAspectFlagBits aspect, VkImageLayout* old_layout);
 
     uint32_t GetMemoryTypeIndex(uint32_t type_bits, VkMemoryPropertyFlags property_flags);
 
+    void RecordBufferToImageCopy(VkCommandBuffer          command_buffer,
+                                 VkBuffer                 source,
+                                 VkImage                  destination,
+                                 VkFormat                 format,
+                                 VkImageAspectFlagBits    aspect,
+                                 VkImageLayout            initial_layout,
+                                 VkImageLayout            final_layout,
+                                 uint32_t                 layer_count,
+                                 uint32_t                 level_count,
+                                 const VkBufferImageCopy* level_copies);
+
+    void RecordImageTransition(VkCommandBuffer       command_buffer,
+                               VkImage               image,
+                               VkFormat              format,
+                               VkImageAspectFlagBits aspect,
+                               VkImageLayout         initial_layout,
+                               VkImageLayout         final_layout,
+                               uint32_t              layer_count,
+                               uint32_t              level_count);
+
     VkResult BufferToImageCopy(uint32_t                 queue_family_index,
                                VkBuffer                 source,
                                VkImage                  destination,
@@ -187,6 +234,25 @@ class VulkanResourceInitializer
     // Map queue family index to command pool, command buffer, and queue objects for command processing.
     typedef std::unordered_map<uint32_t, CommandExecObjects> CommandExecObjectMap;
 
+    struct BatchCommandBuffer
+    {
+        VkQueue         queue;
+        VkCommandBuffer command_buffer;
+        VkFence         fence;
+        bool            recording;
+        bool            submitted;
+    };
+
+    // A section of the staging ring, with the command buffers that copy from it.  The section is reused after the
+    // fences for its command buffers have been signaled.
+    struct StagingBatch
+    {
+        VkDeviceSize                                     begin;
+        VkDeviceSize                                     end;
+        VkDeviceSize                                     offset;
+        std::unordered_map<uint32_t, BatchCommandBuffer> command_buffers;
+    };
+
   private:
     VkDevice                              device_;
     CommandExecObjectMap                  command_exec_objects_;
@@ -194,6 +260,15 @@ class VulkanResourceInitializer
     VulkanResourceAllocator::MemoryData   staging_memory_data_;
     VkBuffer                              staging_buffer_;
     VulkanResourceAllocator::ResourceData staging_buffer_data_;
+    VkDeviceMemory                        staging_ring_memory_;
+    VulkanResourceAllocator::MemoryData   staging_ring_memory_data_;
+    VkBuffer                              staging_ring_buffer_;
+    VulkanResourceAllocator::ResourceData staging_ring_buffer_data_;
+    uint8_t*                              staging_ring_data_;
+    bool                                  staging_ring_coherent_;
+    VkDeviceSize                          staging_ring_size_;
+    std::vector<StagingBatch>             staging_batches_;
+    size_t                                current_batch_;
     VkSampler                             draw_sampler_;
     VkDescriptorPool                      draw_pool_;
     VkDescriptorSetLayout                 draw_set_layout_;
@@ -164,6 +164,8 @@ class ApiCaptureManager
     uint16_t GetDescriptorMask() const { return common_manager_->GetDescriptorMask(); }
     uint64_t GetShaderIDMask() const { return common_manager_->GetShaderIDMask(); }
     uint64_t GetBlockIndex() const { return common_manager_->GetBlockIndex(); }
+    uint32_t GetCompressionThreadCount() const { return common_manager_->GetCompressionThreadCount(); }
+    bool     GetCompactEncoding() const { return common_manager_->GetCompactEncoding(); }
 
     bool                                GetForceFileFlush() const { return common_manager_->GetForceFileFlush(); }
     CaptureSettings::MemoryTrackingMode GetMemoryTrackingMode() const
@@ -172,6 +174,7 @@ class ApiCaptureManager
     }
     bool GetPageGuardAlignBufferSizes() const { return common_manager_->GetPageGuardAlignBufferSizes(); }
     bool GetPageGuardTrackAhbMemory() const { return common_manager_->GetPageGuardTrackAhbMemory(); }
+    bool UsesPageGuardManager() const { return common_manager_->UsesPageGuardManager(); }
     CommonCaptureManager::PageGuardMemoryMode GetPageGuardMemoryMode() const
     {
         return common_manager_->GetPageGuardMemoryMode();
@@ -0,0 +1,230 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "encode/block_compression_queue.h"
+
+#include "format/format.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Block buffers larger than this are released after use instead of being recycled.
+const size_t kMaxRecycledBlockSize = 4 * 1024 * 1024;
+
+BlockCompressionQueue::BlockCompressionQueue(util::OutputStream* stream, size_t thread_count, size_t max_queued_bytes) :
+    stream_(stream), max_queued_bytes_(max_queued_bytes), compression_pool_(thread_count), queued_bytes_(0),
+    writing_(false)
+{
+    assert((stream != nullptr) && (thread_count > 0));
+}
+
+BlockCompressionQueue::~BlockCompressionQueue()
+{
+    Flush();
+    compression_pool_.join_all();
+}
+
+void BlockCompressionQueue::Write(const void* data, size_t size)
+{
+    auto block = AcquireBlock(size);
+
+    util::platform::MemoryCopy(block->data.data(), size, data, size);
+
+    block->write_data = block->data.data();
+    block->write_size = size;
+    block->ready      = true;
+
+    QueueBlock(std::move(block));
+}
+
+void BlockCompressionQueue::WriteCompressible(util::Compressor* compressor,
+                                              const void*       uncompressed_header,
+                                              size_t            uncompressed_header_size,
+                                              const void*       compressed_header,
+                                              size_t            compressed_header_size,
+                                              const void*       data,
+                                              size_t            data_size)
+{
+    assert((compressor != nullptr) && (compressed_header_size >= sizeof(format::BlockHeader)));
+
+    auto block = AcquireBlock(uncompressed_header_size + data_size);
+
+    util::platform::MemoryCopy(
+        block->data.data(), uncompressed_header_size, uncompressed_header, uncompressed_header_size);
+    util::platform::MemoryCopy(block->data.data() + uncompressed_header_size, data_size, data, data_size);
+
+    // The compressor writes the compressed data after the header, preserving the header.
+    if (block->compressed_data.size() < compressed_header_size)
+    {
+        block->compressed_data.resize(compressed_header_size);
+    }
+
+    util::platform::MemoryCopy(
+        block->compressed_data.data(), compressed_header_size, compressed_header, compressed_header_size);
+
+    block->header_size            = uncompressed_header_size;
+    block->compressed_header_size = compressed_header_size;
+
+    // The block remains in the queue until it has been compressed, so the pointer remains valid for the task.
+    Block* queued_block = block.get();
+    QueueBlock(std::move(block));
+
+    compression_pool_.post([this, compressor, queued_block]() { CompressBlock(compressor, queued_block); });
+}
+
+void BlockCompressionQueue::Flush()
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        block_written_.wait(lock, [this]() { return queued_blocks_.empty() && !writing_; });
+    }
+
+    stream_->Flush();
+}
+
+std::unique_ptr<BlockCompressionQueue::Block> BlockCompressionQueue::AcquireBlock(size_t data_size)
+{
+    std::unique_ptr<Block> block;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!free_blocks_.empty())
+        {
+            block = std::move(free_blocks_.back());
+            free_blocks_.pop_back();
+        }
+    }
+
+    if (block == nullptr)
+    {
+        block = std::make_unique<Block>();
+    }
+
+    block->data.resize(data_size);
+    block->header_size            = 0;
+    block->compressed_header_size = 0;
+    block->write_data             = nullptr;
+    block->write_size             = 0;
+    block->ready                  = false;
+
+    return block;
+}
+
+void BlockCompressionQueue::ReleaseBlock(std::unique_ptr<Block> block)
+{
+    // Called with the lock held.
+    if ((block->data.capacity() <= kMaxRecycledBlockSize) &&
+        (block->compressed_data.capacity() <= kMaxRecycledBlockSize))
+    {
+        free_blocks_.emplace_back(std::move(block));
+    }
+}
+
+void BlockCompressionQueue::QueueBlock(std::unique_ptr<Block> block)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    // Apply back pressure to the threads producing blocks when the worker threads fall behind.
+    block_written_.wait(lock, [this]() { return (queued_bytes_ < max_queued_bytes_) || queued_blocks_.empty(); });
+
+    bool write_ready = block->ready && queued_blocks_.empty();
+
+    queued_bytes_ += block->data.size();
+    queued_blocks_.emplace_back(std::move(block));
+
+    // Blocks that are queued after a block that is being compressed are written by the thread that compresses it.
+    if (write_ready && !writing_)
+    {
+        writing_ = true;
+        compression_pool_.post([this]() {
+            std::unique_lock<std::mutex> write_lock(mutex_);
+            WriteReadyBlocks(write_lock);
+        });
+    }
+}
+
+void BlockCompressionQueue::CompressBlock(util::Compressor* compressor, Block* block)
+{
+    const size_t   data_size = block->data.size() - block->header_size;
+    const uint8_t* data      = block->data.data() + block->header_size;
+    size_t         compressed_size =
+        compressor->Compress(data_size, data, &block->compressed_data, block->compressed_header_size);
+
+    if ((compressed_size > 0) && (compressed_size < data_size))
+    {
+        auto block_header  = reinterpret_cast<format::BlockHeader*>(block->compressed_data.data());
+        block_header->size = (block->compressed_header_size - sizeof(format::BlockHeader)) + compressed_size;
+
+        block->write_data = block->compressed_data.data();
+        block->write_size = block->compressed_header_size + compressed_size;
+    }
+    else
+    {
+        block->write_data = block->data.data();
+        block->write_size = block->data.size();
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    block->ready = true;
+
+    if (!writing_)
+    {
+        writing_ = true;
+        WriteReadyBlocks(lock);
+    }
+}
+
+void BlockCompressionQueue::WriteReadyBlocks(std::unique_lock<std::mutex>& lock)
+{
+    assert(writing_ && lock.owns_lock());
+
+    while (!queued_blocks_.empty() && queued_blocks_.front()->ready)
+    {
+        auto block = std::move(queued_blocks_.front());
+        queued_blocks_.pop_front();
+
+        // Other threads may queue and compress blocks while the stream is written.
+        lock.unlock();
+
+        if (!stream_->Write(block->write_data, block->write_size))
+        {
+            GFXRECON_LOG_ERROR("Failed to write %" PRIuPTR " bytes to the capture file", block->write_size);
+        }
+
+        lock.lock();
+
+        queued_bytes_ -= block->data.size();
+        ReleaseBlock(std::move(block));
+        block_written_.notify_all();
+    }
+
+    writing_ = false;
+    block_written_.notify_all();
+}
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,111 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_ENCODE_BLOCK_COMPRESSION_QUEUE_H
+#define GFXRECON_ENCODE_BLOCK_COMPRESSION_QUEUE_H
+
+#include "util/compressor.h"
+#include "util/defines.h"
+#include "util/output_stream.h"
+#include "util/threadpool.h"
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Compresses capture file blocks on a pool of worker threads and writes them to an output stream in the order that
+// they were queued.  The thread queuing a block only copies the block data to a buffer owned by the queue, leaving
+// compression and the write to the output stream to the worker threads.
+class BlockCompressionQueue
+{
+  public:
+    // max_queued_bytes limits the amount of block data that may be waiting to be written to the stream.  Threads
+    // queuing blocks wait for the queued data to be written when the limit is exceeded.
+    BlockCompressionQueue(util::OutputStream* stream, size_t thread_count, size_t max_queued_bytes);
+
+    ~BlockCompressionQueue();
+
+    // Queues data to be written to the stream without compression.
+    void Write(const void* data, size_t size);
+
+    // Queues a block to be compressed.  The compressed block is written as compressed_header followed by the
+    // compressed data, with the size of the block header at the start of compressed_header updated to match the
+    // compressed data size.  When compression does not reduce the size of the data, the block is written as
+    // uncompressed_header followed by the uncompressed data.
+    void WriteCompressible(util::Compressor* compressor,
+                           const void*       uncompressed_header,
+                           size_t            uncompressed_header_size,
+                           const void*       compressed_header,
+                           size_t            compressed_header_size,
+                           const void*       data,
+                           size_t            data_size);
+
+    // Waits for all queued blocks to be written, then flushes the stream.
+    void Flush();
+
+  private:
+    struct Block
+    {
+        std::vector<uint8_t> data;            // Uncompressed header and data, as queued.
+        std::vector<uint8_t> compressed_data; // Compressed header and data.
+        size_t               header_size{ 0 };
+        size_t               compressed_header_size{ 0 };
+        const uint8_t*       write_data{ nullptr }; // Data to write to the stream when the block is ready.
+        size_t               write_size{ 0 };
+        bool                 ready{ false };
+    };
+
+  private:
+    std::unique_ptr<Block> AcquireBlock(size_t data_size);
+
+    void ReleaseBlock(std::unique_ptr<Block> block);
+
+    // Adds the block to the queue, waiting for space to become available when the queue is full.
+    void QueueBlock(std::unique_ptr<Block> block);
+
+    void CompressBlock(util::Compressor* compressor, Block* block);
+
+    // Writes the completed blocks at the front of the queue to the stream.  Called with the lock held and writing_
+    // set, which ensures that only one thread writes to the stream at a time.
+    void WriteReadyBlocks(std::unique_lock<std::mutex>& lock);
+
+  private:
+    util::OutputStream*                 stream_;
+    const size_t                        max_queued_bytes_;
+    util::ThreadPool                    compression_pool_;
+    std::mutex                          mutex_;
+    std::condition_variable             block_written_;
+    std::deque<std::unique_ptr<Block>>  queued_blocks_;
+    std::vector<std::unique_ptr<Block>> free_blocks_;
+    size_t                              queued_bytes_;
+    bool                                writing_;
+};
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_ENCODE_BLOCK_COMPRESSION_QUEUE_H
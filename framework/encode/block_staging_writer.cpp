@@ -0,0 +1,400 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "encode/block_staging_writer.h"
+
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+const size_t kRecordAlignment      = 8;
+const size_t kMinStagingBufferSize = 64 * 1024;
+
+static size_t AlignRecordSize(size_t size)
+{
+    return (size + (kRecordAlignment - 1)) & ~(kRecordAlignment - 1);
+}
+
+std::atomic<uint64_t> BlockStagingWriter::next_id_{ 0 };
+
+BlockStagingBuffer::BlockStagingBuffer(uint64_t writer_id, size_t size) :
+    writer_id_(writer_id), storage_(std::max(AlignRecordSize(size), kMinStagingBufferSize)), write_position_(0),
+    read_position_(0)
+{}
+
+BlockStagingWriter::BlockStagingWriter(size_t buffer_size, bool allocate_when_full) :
+    id_(++next_id_), buffer_size_(buffer_size), allocate_when_full_(allocate_when_full), stream_(nullptr),
+    compression_queue_(nullptr), next_sequence_(0), written_sequence_(0), staged_count_(0), buffers_version_(0),
+    writer_idle_(false), space_waiters_(0), stop_(false)
+{
+    writer_thread_ = std::thread([this]() { WriteBlocks(); });
+}
+
+BlockStagingWriter::~BlockStagingWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+
+    blocks_staged_.notify_one();
+    writer_thread_.join();
+}
+
+std::shared_ptr<BlockStagingBuffer> BlockStagingWriter::CreateBuffer()
+{
+    auto buffer = std::make_shared<BlockStagingBuffer>(id_, buffer_size_);
+
+    {
+        std::lock_guard<std::mutex> lock(buffers_mutex_);
+        buffers_.push_back(buffer);
+        ++buffers_version_;
+    }
+
+    return buffer;
+}
+
+void BlockStagingWriter::SetOutput(util::OutputStream* stream, BlockCompressionQueue* compression_queue)
+{
+    assert(written_sequence_ == next_sequence_);
+
+    stream_            = stream;
+    compression_queue_ = compression_queue;
+}
+
+void BlockStagingWriter::Write(BlockStagingBuffer* buffer, const void* data, size_t size)
+{
+    DataRange range = { data, size };
+    StageRecord(buffer, nullptr, &range, 1, 0, 0);
+}
+
+void BlockStagingWriter::WriteCompressible(BlockStagingBuffer* buffer,
+                                           util::Compressor*   compressor,
+                                           const void*         uncompressed_header,
+                                           size_t              uncompressed_header_size,
+                                           const void*         compressed_header,
+                                           size_t              compressed_header_size,
+                                           const void*         data,
+                                           size_t              data_size)
+{
+    assert(compressor != nullptr);
+
+    DataRange ranges[] = { { uncompressed_header, uncompressed_header_size },
+                           { compressed_header, compressed_header_size },
+                           { data, data_size } };
+
+    StageRecord(buffer,
+                compressor,
+                ranges,
+                3,
+                static_cast<uint32_t>(uncompressed_header_size),
+                static_cast<uint32_t>(compressed_header_size));
+}
+
+void BlockStagingWriter::Flush()
+{
+    const uint64_t sequence = next_sequence_.load();
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        blocks_staged_.notify_one();
+        blocks_written_.wait(lock, [this, sequence]() { return written_sequence_.load() >= sequence; });
+    }
+
+    BlockCompressionQueue* compression_queue = compression_queue_.load();
+    util::OutputStream*    stream            = stream_.load();
+
+    if (compression_queue != nullptr)
+    {
+        compression_queue->Flush();
+    }
+    else if (stream != nullptr)
+    {
+        stream->Flush();
+    }
+}
+
+void BlockStagingWriter::StageRecord(BlockStagingBuffer* buffer,
+                                     util::Compressor*   compressor,
+                                     const DataRange*    ranges,
+                                     size_t              range_count,
+                                     uint32_t            uncompressed_header_size,
+                                     uint32_t            compressed_header_size)
+{
+    assert(buffer != nullptr);
+
+    const size_t capacity  = buffer->storage_.size();
+    size_t       data_size = 0;
+
+    for (size_t i = 0; i < range_count; ++i)
+    {
+        data_size += ranges[i].size;
+    }
+
+    // Blocks that would occupy a large portion of the staging buffer are always stored in a separate allocation.
+    bool   allocate    = (AlignRecordSize(sizeof(RecordHeader) + data_size) > (capacity / 4));
+    size_t record_size = AlignRecordSize(sizeof(RecordHeader) + (allocate ? 0 : data_size));
+
+    // Only the producing thread modifies the write position.
+    const size_t write_position = buffer->write_position_.load(std::memory_order_relaxed);
+    size_t       offset         = write_position % capacity;
+    size_t       padding_size   = ((capacity - offset) < record_size) ? (capacity - offset) : 0;
+
+    if (!allocate && allocate_when_full_ &&
+        ((write_position + padding_size + record_size - buffer->read_position_.load(std::memory_order_acquire)) >
+         capacity))
+    {
+        allocate     = true;
+        record_size  = AlignRecordSize(sizeof(RecordHeader));
+        padding_size = ((capacity - offset) < record_size) ? (capacity - offset) : 0;
+    }
+
+    // Wait for the writer thread to consume enough data to make space for the record.
+    const size_t required_size = padding_size + record_size;
+    if ((write_position + required_size - buffer->read_position_.load(std::memory_order_acquire)) > capacity)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        ++space_waiters_;
+        space_available_.wait(lock, [buffer, write_position, required_size, capacity]() {
+            return (write_position + required_size - buffer->read_position_.load()) <= capacity;
+        });
+        --space_waiters_;
+    }
+
+    if (padding_size > 0)
+    {
+        // The record would extend past the end of the buffer, so the remaining space is skipped.  Space that is too
+        // small for a record header is skipped without a padding record.
+        if (padding_size >= sizeof(RecordHeader))
+        {
+            auto padding_header         = reinterpret_cast<RecordHeader*>(buffer->storage_.data() + offset);
+            padding_header->type        = kPadding;
+            padding_header->record_size = static_cast<uint32_t>(padding_size);
+        }
+
+        offset = 0;
+    }
+
+    auto     header      = reinterpret_cast<RecordHeader*>(buffer->storage_.data() + offset);
+    uint8_t* destination = nullptr;
+
+    if (allocate)
+    {
+        header->allocated_data = new uint8_t[data_size];
+        destination            = header->allocated_data;
+    }
+    else
+    {
+        header->allocated_data = nullptr;
+        destination            = buffer->storage_.data() + offset + sizeof(RecordHeader);
+    }
+
+    for (size_t i = 0; i < range_count; ++i)
+    {
+        util::platform::MemoryCopy(destination, ranges[i].size, ranges[i].data, ranges[i].size);
+        destination += ranges[i].size;
+    }
+
+    header->data_size                = data_size;
+    header->compressor               = compressor;
+    header->uncompressed_header_size = uncompressed_header_size;
+    header->compressed_header_size   = compressed_header_size;
+    header->type                     = kBlock;
+    header->record_size              = static_cast<uint32_t>(record_size);
+
+    // The sequence number is assigned after the data has been copied, so that the writer thread does not wait for
+    // the copy when it reaches this block.
+    header->sequence = next_sequence_.fetch_add(1);
+    buffer->write_position_.store(write_position + required_size, std::memory_order_release);
+    ++staged_count_;
+
+    if (writer_idle_.load())
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        blocks_staged_.notify_one();
+    }
+}
+
+void BlockStagingWriter::WriteBlocks()
+{
+    std::vector<BlockStagingBuffer*> buffers;
+    uint64_t                         buffers_version = 0;
+
+    for (;;)
+    {
+        // Blocks staged after this point wake the writer thread if it does not find them in the scan below.
+        const uint64_t staged_count = staged_count_.load();
+
+        if (buffers_version != buffers_version_.load())
+        {
+            buffers_version = buffers_version_.load();
+            UpdateBuffers(&buffers);
+        }
+
+        bool wrote_block = false;
+        for (auto buffer : buffers)
+        {
+            // A buffer usually holds several consecutive blocks.
+            while (WriteNextBlock(buffer))
+            {
+                wrote_block = true;
+            }
+        }
+
+        if (!wrote_block)
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            blocks_written_.notify_all();
+
+            if (stop_ && (written_sequence_.load() == next_sequence_.load()))
+            {
+                break;
+            }
+
+            // When blocks are pending, a thread has taken the next sequence number and is about to store its block,
+            // which wakes the writer thread in the same way as a newly staged block.
+            writer_idle_ = true;
+            blocks_staged_.wait(lock, [this, staged_count]() {
+                return (staged_count_.load() != staged_count) ||
+                       (stop_ && (written_sequence_.load() == next_sequence_.load()));
+            });
+            writer_idle_ = false;
+
+            // Release the buffers of threads that have exited.
+            UpdateBuffers(&buffers);
+        }
+    }
+}
+
+bool BlockStagingWriter::WriteNextBlock(BlockStagingBuffer* buffer)
+{
+    const size_t capacity       = buffer->storage_.size();
+    const size_t write_position = buffer->write_position_.load(std::memory_order_acquire);
+    size_t       read_position  = buffer->read_position_.load(std::memory_order_relaxed);
+
+    if (read_position == write_position)
+    {
+        return false;
+    }
+
+    const size_t offset = read_position % capacity;
+    auto         header = reinterpret_cast<const RecordHeader*>(buffer->storage_.data() + offset);
+
+    if (((capacity - offset) < sizeof(RecordHeader)) || (header->type == kPadding))
+    {
+        read_position += capacity - offset;
+        header = reinterpret_cast<const RecordHeader*>(buffer->storage_.data());
+    }
+
+    if (header->sequence != written_sequence_.load())
+    {
+        return false;
+    }
+
+    const uint8_t* data =
+        (header->allocated_data != nullptr) ? header->allocated_data : reinterpret_cast<const uint8_t*>(header + 1);
+
+    WriteRecord(header, data);
+
+    delete[] header->allocated_data;
+
+    buffer->read_position_.store(read_position + header->record_size);
+    ++written_sequence_;
+
+    if (space_waiters_.load() > 0)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        space_available_.notify_all();
+    }
+
+    return true;
+}
+
+void BlockStagingWriter::WriteRecord(const RecordHeader* header, const uint8_t* data)
+{
+    BlockCompressionQueue* compression_queue = compression_queue_.load();
+
+    if (header->compressor != nullptr)
+    {
+        assert(compression_queue != nullptr);
+
+        const size_t   headers_size = header->uncompressed_header_size + header->compressed_header_size;
+        const uint8_t* block_data   = data + headers_size;
+
+        compression_queue->WriteCompressible(header->compressor,
+                                             data,
+                                             header->uncompressed_header_size,
+                                             data + header->uncompressed_header_size,
+                                             header->compressed_header_size,
+                                             block_data,
+                                             header->data_size - headers_size);
+    }
+    else if (compression_queue != nullptr)
+    {
+        compression_queue->Write(data, header->data_size);
+    }
+    else
+    {
+        util::OutputStream* stream = stream_.load();
+        assert(stream != nullptr);
+
+        if (!stream->Write(data, header->data_size))
+        {
+            GFXRECON_LOG_ERROR("Failed to write %" PRIu64 " bytes to the capture file", header->data_size);
+        }
+    }
+}
+
+void BlockStagingWriter::UpdateBuffers(std::vector<BlockStagingBuffer*>* buffers)
+{
+    std::lock_guard<std::mutex> lock(buffers_mutex_);
+
+    // A buffer is only referenced by the list once the thread that created it has exited.
+    for (auto iter = buffers_.begin(); iter != buffers_.end();)
+    {
+        BlockStagingBuffer* buffer = iter->get();
+        if ((iter->use_count() == 1) && (buffer->read_position_.load() == buffer->write_position_.load()))
+        {
+            iter = buffers_.erase(iter);
+        }
+        else
+        {
+            ++iter;
+        }
+    }
+
+    buffers->clear();
+    for (const auto& buffer : buffers_)
+    {
+        buffers->push_back(buffer.get());
+    }
+}
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,163 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_ENCODE_BLOCK_STAGING_WRITER_H
+#define GFXRECON_ENCODE_BLOCK_STAGING_WRITER_H
+
+#include "encode/block_compression_queue.h"
+#include "util/compressor.h"
+#include "util/defines.h"
+#include "util/output_stream.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Ring buffer of capture file blocks written by a single application thread and read by the writer thread.
+class BlockStagingBuffer
+{
+  public:
+    BlockStagingBuffer(uint64_t writer_id, size_t size);
+
+  private:
+    friend class BlockStagingWriter;
+
+    const uint64_t       writer_id_;
+    std::vector<uint8_t> storage_;
+    std::atomic<size_t>  write_position_; // Total bytes written by the producing thread.
+    std::atomic<size_t>  read_position_;  // Total bytes consumed by the writer thread.
+};
+
+// Writes capture file blocks from a background thread.  Application threads copy blocks to their own staging
+// buffers without locking, and the writer thread writes the blocks from all staging buffers to the output in the
+// order that they were staged.
+class BlockStagingWriter
+{
+  public:
+    // When allocate_when_full is true, blocks that do not fit in a full staging buffer are copied to a separate
+    // allocation instead of waiting for the writer thread to make space in the staging buffer.
+    BlockStagingWriter(size_t buffer_size, bool allocate_when_full);
+
+    ~BlockStagingWriter();
+
+    // Creates a staging buffer for the calling thread.  The buffer must only be written by one thread at a time.
+    std::shared_ptr<BlockStagingBuffer> CreateBuffer();
+
+    // Determines if the buffer was created by this writer, as opposed to a writer that has been destroyed.
+    bool IsBufferOwner(const BlockStagingBuffer* buffer) const { return buffer->writer_id_ == id_; }
+
+    // Sets the destination for staged blocks.  When compression_queue is not null, blocks are written to the
+    // compression queue instead of the stream.  Must only be called when no blocks are staged.
+    void SetOutput(util::OutputStream* stream, BlockCompressionQueue* compression_queue);
+
+    void Write(BlockStagingBuffer* buffer, const void* data, size_t size);
+
+    // Stages a block for BlockCompressionQueue::WriteCompressible().  Requires a compression queue output.
+    void WriteCompressible(BlockStagingBuffer* buffer,
+                           util::Compressor*   compressor,
+                           const void*         uncompressed_header,
+                           size_t              uncompressed_header_size,
+                           const void*         compressed_header,
+                           size_t              compressed_header_size,
+                           const void*         data,
+                           size_t              data_size);
+
+    // Waits for the blocks staged before the call to be written to the output, then flushes the output.
+    void Flush();
+
+  private:
+    enum RecordType : uint32_t
+    {
+        kPadding = 0, // Unused space at the end of the staging buffer.
+        kBlock   = 1
+    };
+
+    struct RecordHeader
+    {
+        uint64_t          sequence;
+        uint64_t          data_size;
+        uint8_t*          allocated_data; // Block data stored outside of the staging buffer.
+        util::Compressor* compressor;     // Not null for blocks to be written with WriteCompressible().
+        uint32_t          uncompressed_header_size;
+        uint32_t          compressed_header_size;
+        RecordType        type;
+        uint32_t          record_size;
+    };
+
+    struct DataRange
+    {
+        const void* data;
+        size_t      size;
+    };
+
+  private:
+    void StageRecord(BlockStagingBuffer* buffer,
+                     util::Compressor*   compressor,
+                     const DataRange*    ranges,
+                     size_t              range_count,
+                     uint32_t            uncompressed_header_size,
+                     uint32_t            compressed_header_size);
+
+    void WriteBlocks();
+
+    // Writes the block at the read position of the buffer when it is the next block in sequence.
+    bool WriteNextBlock(BlockStagingBuffer* buffer);
+
+    void WriteRecord(const RecordHeader* header, const uint8_t* data);
+
+    void UpdateBuffers(std::vector<BlockStagingBuffer*>* buffers);
+
+  private:
+    static std::atomic<uint64_t> next_id_;
+
+  private:
+    const uint64_t                                   id_;
+    const size_t                                     buffer_size_;
+    const bool                                       allocate_when_full_;
+    std::atomic<util::OutputStream*>                 stream_;
+    std::atomic<BlockCompressionQueue*>              compression_queue_;
+    std::atomic<uint64_t>                            next_sequence_;    // Sequence number of the next staged block.
+    std::atomic<uint64_t>                            written_sequence_; // Sequence number of the next block to write.
+    std::atomic<uint64_t>                            staged_count_;     // Blocks stored in their staging buffers.
+    std::mutex                                       buffers_mutex_;
+    std::vector<std::shared_ptr<BlockStagingBuffer>> buffers_;
+    std::atomic<uint64_t>                            buffers_version_;
+    std::mutex                                       mutex_;
+    std::condition_variable                          blocks_staged_;
+    std::condition_variable                          blocks_written_;
+    std::condition_variable                          space_available_;
+    std::atomic<bool>                                writer_idle_;
+    std::atomic<uint32_t>                            space_waiters_; // Threads waiting for staging buffer space.
+    bool                                             stop_;
+    std::thread                                      writer_thread_;
+};
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_ENCODE_BLOCK_STAGING_WRITER_H
@@ -29,6 +29,7 @@
 
 #include "encode/parameter_buffer.h"
 #include "encode/parameter_encoder.h"
+#include "format/file_index.h"
 #include "format/format_util.h"
 #include "util/compressor.h"
 #include "util/file_path.h"
@@ -52,6 +53,7 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 // One based frame count.
 const uint32_t kFirstFrame           = 1;
 const size_t   kFileStreamBufferSize = 256 * 1024;
+const size_t   kCompressionQueueSize = 64 * 1024 * 1024;
 
 std::mutex                                     CommonCaptureManager::ThreadData::count_lock_;
 format::ThreadId                               CommonCaptureManager::ThreadData::thread_count_ = 0;
@@ -94,22 +96,23 @@ format::ThreadId CommonCaptureManager::ThreadData::GetThreadId()
 }
 
 CommonCaptureManager::CommonCaptureManager() :
-    force_file_flush_(false), timestamp_filename_(true),
+    timestamp_filename_(true), force_file_flush_(false), write_file_index_(false), compression_thread_count_(0),
     memory_tracking_mode_(CaptureSettings::MemoryTrackingMode::kPageGuard), page_guard_align_buffer_sizes_(false),
     page_guard_track_ahb_memory_(false), page_guard_unblock_sigsegv_(false), page_guard_signal_handler_watcher_(false),
-    page_guard_memory_mode_(kMemoryModeShadowInternal), page_guard_external_memory_(false), trim_enabled_(false),
-    trim_boundary_(CaptureSettings::TrimBoundary::kUnknown), trim_current_range_(0), current_frame_(kFirstFrame),
-    queue_submit_count_(0), capture_mode_(kModeWrite), previous_hotkey_state_(false),
-    previous_runtime_trigger_state_(CaptureSettings::RuntimeTriggerState::kNotUsed), debug_layer_(false),
-    debug_device_lost_(false), screenshot_prefix_(""), screenshots_enabled_(false), disable_dxr_(false),
-    accel_struct_padding_(0), iunknown_wrapping_(false), force_command_serialization_(false), queue_zero_only_(false),
-    allow_pipeline_compile_required_(false), quit_after_frame_ranges_(false), block_index_(0)
+    page_guard_memory_mode_(kMemoryModeShadowInternal), page_guard_external_memory_(false),
+    page_guard_hash_pages_(false), trim_enabled_(false), trim_boundary_(CaptureSettings::TrimBoundary::kUnknown),
+    trim_current_range_(0), current_frame_(kFirstFrame), queue_submit_count_(0), capture_mode_(kModeWrite),
+    previous_hotkey_state_(false), previous_runtime_trigger_state_(CaptureSettings::RuntimeTriggerState::kNotUsed),
+    debug_layer_(false), debug_device_lost_(false), screenshot_prefix_(""), screenshots_enabled_(false),
+    disable_dxr_(false), accel_struct_padding_(0), iunknown_wrapping_(false), force_command_serialization_(false),
+    queue_zero_only_(false), allow_pipeline_compile_required_(false), quit_after_frame_ranges_(false), block_index_(0)
 {}
 
 CommonCaptureManager::~CommonCaptureManager()
 {
-    if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard ||
-        memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kUserfaultfd)
+    CloseCaptureFile();
+
+    if (UsesPageGuardManager())
     {
         util::PageGuardManager::Destroy();
     }
@@ -296,6 +299,8 @@ bool CommonCaptureManager::Initialize(format::ApiFamilyId                   api_
     timestamp_filename_              = trace_settings.time_stamp_file;
     memory_tracking_mode_            = trace_settings.memory_tracking_mode;
     force_file_flush_                = trace_settings.force_flush;
+    write_file_index_                = trace_settings.write_file_index;
+    compression_thread_count_        = trace_settings.compression_thread_count;
     debug_layer_                     = trace_settings.debug_layer;
     debug_device_lost_               = trace_settings.debug_device_lost;
     screenshots_enabled_             = !trace_settings.screenshot_ranges.empty();
@@ -310,6 +315,19 @@ bool CommonCaptureManager::Initialize(format::ApiFamilyId                   api_
     allow_pipeline_compile_required_ = trace_settings.allow_pipeline_compile_required;
     force_fifo_present_mode_         = trace_settings.force_fifo_present_mode;
 
+    if (file_options_.content_deduplication_limit > 0)
+    {
+        content_deduplicator_ = std::make_unique<util::ContentDeduplicator>(
+            static_cast<uint64_t>(file_options_.content_deduplication_limit) << 20);
+    }
+
+    if (trace_settings.write_thread)
+    {
+        staging_writer_ = std::make_unique<BlockStagingWriter>(
+            static_cast<size_t>(trace_settings.write_buffer_size) * 1024,
+            trace_settings.write_buffer_full_policy == CaptureSettings::WriteBufferFullPolicy::kAllocate);
+    }
+
     rv_annotation_info_.gpuva_mask      = trace_settings.rv_anotation_info.gpuva_mask;
     rv_annotation_info_.descriptor_mask = trace_settings.rv_anotation_info.descriptor_mask;
 
@@ -329,7 +347,7 @@ bool CommonCaptureManager::Initialize(format::ApiFamilyId                   api_
             rv_annotation_info_.descriptor_mask);
     }
 
-    if (memory_tracking_mode_ == CaptureSettings::kPageGuard || memory_tracking_mode_ == CaptureSettings::kUserfaultfd)
+    if (UsesPageGuardManager())
     {
         page_guard_align_buffer_sizes_                  = trace_settings.page_guard_align_buffer_sizes;
         page_guard_track_ahb_memory_                    = trace_settings.page_guard_track_ahb_memory;
@@ -339,15 +357,17 @@ bool CommonCaptureManager::Initialize(format::ApiFamilyId                   api_
         page_guard_external_memory_                     = trace_settings.page_guard_external_memory;
         page_guard_signal_handler_watcher_max_restores_ = trace_settings.page_guard_signal_handler_watcher_max_restores;
         page_guard_separate_read_                       = trace_settings.page_guard_separate_read;
+        page_guard_hash_pages_                          = trace_settings.page_guard_hash_pages;
 
         bool use_external_memory = trace_settings.page_guard_external_memory;
 
 #if !defined(WIN32)
-        if (use_external_memory)
+        // Imported host memory can be tracked directly with soft-dirty page bits.
+        if (use_external_memory && (memory_tracking_mode_ != CaptureSettings::kSoftDirty))
         {
             use_external_memory = false;
-            GFXRECON_LOG_WARNING("Ignoring page guard external memory option on unsupported platform (Only Windows is "
-                                 "currently supported)")
+            GFXRECON_LOG_WARNING("Ignoring page guard external memory option on unsupported platform (Only Windows and "
+                                 "the soft_dirty memory tracking mode are currently supported)")
         }
 #endif
 
@@ -455,17 +475,28 @@ bool CommonCaptureManager::Initialize(format::ApiFamilyId                   api_
         {
             success = false;
         }
+        else
+        {
+            // The compressor is created after the initial capture file.
+            CreateFileWriters();
+        }
     }
 
     if (success)
     {
-        if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard ||
-            memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kUserfaultfd)
+        if (UsesPageGuardManager())
         {
-            const util::PageGuardManager::MemoryProtectionMode mem_prot_mode =
-                memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard
-                    ? util::PageGuardManager::MemoryProtectionMode::kMProtectMode
-                    : util::PageGuardManager::MemoryProtectionMode::kUserFaultFdMode;
+            util::PageGuardManager::MemoryProtectionMode mem_prot_mode =
+                util::PageGuardManager::MemoryProtectionMode::kMProtectMode;
+
+            if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kUserfaultfd)
+            {
+                mem_prot_mode = util::PageGuardManager::MemoryProtectionMode::kUserFaultFdMode;
+            }
+            else if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kSoftDirty)
+            {
+                mem_prot_mode = util::PageGuardManager::MemoryProtectionMode::kSoftDirtyMode;
+            }
 
             util::PageGuardManager::Create(trace_settings.page_guard_copy_on_map,
                                            trace_settings.page_guard_separate_read,
@@ -473,7 +504,8 @@ bool CommonCaptureManager::Initialize(format::ApiFamilyId                   api_
                                            trace_settings.page_guard_unblock_sigsegv,
                                            trace_settings.page_guard_signal_handler_watcher,
                                            trace_settings.page_guard_signal_handler_watcher_max_restores,
-                                           mem_prot_mode);
+                                           mem_prot_mode,
+                                           trace_settings.page_guard_hash_pages);
         }
     }
     else
@@ -493,6 +525,13 @@ CommonCaptureManager::ThreadData* CommonCaptureManager::GetThreadData()
     return thread_data_.get();
 }
 
+bool CommonCaptureManager::UsesPageGuardManager() const
+{
+    return (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard) ||
+           (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kUserfaultfd) ||
+           (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kSoftDirty);
+}
+
 bool CommonCaptureManager::IsCaptureModeTrack() const
 {
     return (GetCaptureMode() & kModeTrack) == kModeTrack;
@@ -509,6 +548,7 @@ ParameterEncoder* CommonCaptureManager::InitApiCallCapture(format::ApiCallId cal
 
     // Reset the parameter buffer and reserve space for an uncompressed FunctionCallHeader.
     thread_data->parameter_buffer_->ClearWithHeader(sizeof(format::FunctionCallHeader));
+    thread_data->parameter_encoder_->SetCompactEncoding(file_options_.compact_encoding);
 
     return thread_data->parameter_encoder_.get();
 }
@@ -521,6 +561,7 @@ ParameterEncoder* CommonCaptureManager::InitMethodCallCapture(format::ApiCallId
 
     // Reset the parameter buffer and reserve space for an uncompressed MethodCallHeader.
     thread_data->parameter_buffer_->ClearWithHeader(sizeof(format::MethodCallHeader));
+    thread_data->parameter_encoder_->SetCompactEncoding(file_options_.compact_encoding);
 
     return thread_data->parameter_encoder_.get();
 }
@@ -538,7 +579,7 @@ void CommonCaptureManager::EndApiCallCapture()
         bool   not_compressed    = true;
         size_t uncompressed_size = parameter_buffer->GetDataSize();
 
-        if (compressor_ != nullptr)
+        if ((compressor_ != nullptr) && (compression_queue_ == nullptr))
         {
             size_t header_size     = sizeof(format::CompressedFunctionCallHeader);
             size_t compressed_size = compressor_->Compress(
@@ -575,8 +616,27 @@ void CommonCaptureManager::EndApiCallCapture()
             uncompressed_header->block_header.size =
                 sizeof(uncompressed_header->api_call_id) + sizeof(uncompressed_header->thread_id) + uncompressed_size;
 
-            WriteToFile(parameter_buffer->GetHeaderData(),
-                        parameter_buffer->GetHeaderDataSize() + parameter_buffer->GetDataSize());
+            if (compression_queue_ != nullptr)
+            {
+                format::CompressedFunctionCallHeader compressed_header;
+                compressed_header.block_header.type = format::BlockType::kCompressedFunctionCallBlock;
+                compressed_header.block_header.size = 0; // Set by the compression queue.
+                compressed_header.api_call_id       = thread_data->call_id_;
+                compressed_header.thread_id         = thread_data->thread_id_;
+                compressed_header.uncompressed_size = uncompressed_size;
+
+                WriteCompressibleToFile(header_data,
+                                        parameter_buffer->GetHeaderDataSize(),
+                                        &compressed_header,
+                                        sizeof(compressed_header),
+                                        parameter_buffer->GetData(),
+                                        uncompressed_size);
+            }
+            else
+            {
+                WriteToFile(parameter_buffer->GetHeaderData(),
+                            parameter_buffer->GetHeaderDataSize() + parameter_buffer->GetDataSize());
+            }
         }
     }
 }
@@ -594,7 +654,7 @@ void CommonCaptureManager::EndMethodCallCapture()
         bool   not_compressed    = true;
         size_t uncompressed_size = parameter_buffer->GetDataSize();
 
-        if (compressor_ != nullptr)
+        if ((compressor_ != nullptr) && (compression_queue_ == nullptr))
         {
             size_t header_size     = sizeof(format::CompressedMethodCallHeader);
             size_t compressed_size = compressor_->Compress(
@@ -635,8 +695,28 @@ void CommonCaptureManager::EndMethodCallCapture()
                                                      sizeof(uncompressed_header->object_id) +
                                                      sizeof(uncompressed_header->thread_id) + uncompressed_size;
 
-            WriteToFile(parameter_buffer->GetHeaderData(),
-                        parameter_buffer->GetHeaderDataSize() + parameter_buffer->GetDataSize());
+            if (compression_queue_ != nullptr)
+            {
+                format::CompressedMethodCallHeader compressed_header;
+                compressed_header.block_header.type = format::BlockType::kCompressedMethodCallBlock;
+                compressed_header.block_header.size = 0; // Set by the compression queue.
+                compressed_header.api_call_id       = thread_data->call_id_;
+                compressed_header.object_id         = thread_data->object_id_;
+                compressed_header.thread_id         = thread_data->thread_id_;
+                compressed_header.uncompressed_size = uncompressed_size;
+
+                WriteCompressibleToFile(header_data,
+                                        parameter_buffer->GetHeaderDataSize(),
+                                        &compressed_header,
+                                        sizeof(compressed_header),
+                                        parameter_buffer->GetData(),
+                                        uncompressed_size);
+            }
+            else
+            {
+                WriteToFile(parameter_buffer->GetHeaderData(),
+                            parameter_buffer->GetHeaderDataSize() + parameter_buffer->GetDataSize());
+            }
         }
     }
 }
@@ -932,11 +1012,22 @@ bool CommonCaptureManager::CreateCaptureFile(format::ApiFamilyId api_family, con
         capture_filename = util::filepath::GenerateTimestampedFilename(capture_filename);
     }
 
-    file_stream_ = std::make_unique<util::FileOutputStream>(capture_filename, kFileStreamBufferSize);
+    CloseCaptureFile();
+
+    file_stream_      = std::make_unique<util::FileOutputStream>(capture_filename, kFileStreamBufferSize);
+    capture_filename_ = capture_filename;
 
     if (file_stream_->IsValid())
     {
         GFXRECON_LOG_INFO("Recording graphics API capture to %s", capture_filename.c_str());
+        CreateFileWriters();
+
+        // Content data blocks written to a previous file cannot be referenced by the new file.
+        if (content_deduplicator_ != nullptr)
+        {
+            content_deduplicator_->Reset();
+        }
+
         WriteFileHeader();
 
         gfxrecon::util::filepath::FileInfo info{};
@@ -1056,6 +1147,74 @@ bool CommonCaptureManager::CreateCaptureFile(format::ApiFamilyId api_family, con
     return success;
 }
 
+void CommonCaptureManager::CreateFileWriters()
+{
+    if ((compression_thread_count_ > 0) && (compressor_ != nullptr) && (file_stream_ != nullptr) &&
+        (compression_queue_ == nullptr))
+    {
+        // Blocks staged for the current output are written before the write thread switches to the queue.
+        if (staging_writer_ != nullptr)
+        {
+            staging_writer_->Flush();
+        }
+
+        compression_queue_ = std::make_unique<BlockCompressionQueue>(
+            file_stream_.get(), compression_thread_count_, kCompressionQueueSize);
+    }
+
+    if (staging_writer_ != nullptr)
+    {
+        staging_writer_->SetOutput(file_stream_.get(), compression_queue_.get());
+    }
+}
+
+void CommonCaptureManager::FlushFileWriters()
+{
+    if (staging_writer_ != nullptr)
+    {
+        staging_writer_->Flush();
+    }
+    else if (compression_queue_ != nullptr)
+    {
+        compression_queue_->Flush();
+    }
+    else if (file_stream_ != nullptr)
+    {
+        file_stream_->Flush();
+    }
+}
+
+void CommonCaptureManager::CloseCaptureFile()
+{
+    // Staged blocks are written to the compression queue before it is destroyed.
+    if (staging_writer_ != nullptr)
+    {
+        staging_writer_->Flush();
+        staging_writer_->SetOutput(nullptr, nullptr);
+    }
+
+    // Destroying the compression queue writes any blocks that are still queued.
+    compression_queue_ = nullptr;
+
+    if (file_stream_ != nullptr)
+    {
+        file_stream_->Flush();
+        file_stream_ = nullptr;
+
+        if (write_file_index_)
+        {
+            // The index is built from the closed file, so that it reflects the final size and contents of the file.
+            format::FileIndex file_index;
+            std::string       index_filename = format::FileIndex::GetIndexFilename(capture_filename_);
+
+            if (!file_index.Build(capture_filename_) || !file_index.Save(index_filename))
+            {
+                GFXRECON_LOG_WARNING("Failed to write capture file index %s", index_filename.c_str());
+            }
+        }
+    }
+}
+
 void CommonCaptureManager::ActivateTrimming(std::shared_lock<ApiCallMutexT>& current_lock)
 {
     auto has_shared_lock = current_lock.owns_lock();
@@ -1077,6 +1236,9 @@ void CommonCaptureManager::ActivateTrimming(std::shared_lock<ApiCallMutexT>& cur
         auto thread_data = GetThreadData();
         assert(thread_data != nullptr);
 
+        // The state writer writes directly to the file stream, after the blocks that have already been queued.
+        FlushFileWriters();
+
         for (auto& manager : api_capture_managers_)
         {
             manager.first->WriteTrackedState(file_stream_.get(), thread_data->thread_id_);
@@ -1108,8 +1270,7 @@ void CommonCaptureManager::DeactivateTrimming(std::shared_lock<ApiCallMutexT>& c
         capture_mode_ &= ~kModeWrite;
 
         assert(file_stream_);
-        file_stream_->Flush();
-        file_stream_ = nullptr;
+        CloseCaptureFile();
     }
 
     if (has_shared_lock)
@@ -1147,6 +1308,17 @@ void CommonCaptureManager::BuildOptionList(const format::EnabledOptions&
     assert(option_list != nullptr);
 
     option_list->push_back({ format::FileOption::kCompressionType, enabled_options.compression_type });
+
+    if (enabled_options.content_deduplication_limit > 0)
+    {
+        option_list->push_back(
+            { format::FileOption::kContentDeduplication, enabled_options.content_deduplication_limit });
+    }
+
+    if (enabled_options.compact_encoding)
+    {
+        option_list->push_back({ format::FileOption::kCompactEncoding, 1 });
+    }
 }
 
 void CommonCaptureManager::WriteDisplayMessageCmd(format::ApiFamilyId api_family, const char* message)
@@ -1235,6 +1407,58 @@ void CommonCaptureManager::WriteResizeWindowCmd(format::ApiFamilyId api_family,
     }
 }
 
+template <typename T>
+void CommonCaptureManager::WriteMetaDataCmdWithData(T* header, const uint8_t* data, size_t data_size)
+{
+    auto thread_data = GetThreadData();
+    assert(thread_data != nullptr);
+
+    size_t header_size    = sizeof(T);
+    bool   not_compressed = true;
+
+    header->meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+
+    if ((compressor_ != nullptr) && (compression_queue_ == nullptr))
+    {
+        size_t compressed_size = compressor_->Compress(data_size, data, &thread_data->compressed_buffer_, header_size);
+
+        if ((compressed_size > 0) && (compressed_size < data_size))
+        {
+            not_compressed = false;
+
+            // We don't have special headers for compressed meta data commands because the headers always include the
+            // uncompressed size, so we just change the type to indicate the data is compressed.
+            header->meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+
+            // Calculate size of packet with compressed data size.
+            header->meta_header.block_header.size = format::GetMetaDataBlockBaseSize(*header) + compressed_size;
+
+            // Copy header to beginning of compressed_buffer_
+            util::platform::MemoryCopy(thread_data->compressed_buffer_.data(), header_size, header, header_size);
+
+            WriteToFile(thread_data->compressed_buffer_.data(), header_size + compressed_size);
+        }
+    }
+
+    if (not_compressed)
+    {
+        // Calculate size of packet with uncompressed data size.
+        header->meta_header.block_header.size = format::GetMetaDataBlockBaseSize(*header) + data_size;
+
+        if (compression_queue_ != nullptr)
+        {
+            T compressed_header                             = *header;
+            compressed_header.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+
+            WriteCompressibleToFile(header, header_size, &compressed_header, header_size, data, data_size);
+        }
+        else
+        {
+            CombineAndWriteToFile({ { header, header_size }, { data, data_size } });
+        }
+    }
+}
+
 void CommonCaptureManager::WriteFillMemoryCmd(
     format::ApiFamilyId api_family, format::HandleId memory_id, uint64_t offset, uint64_t size, const void* data)
 {
@@ -1242,55 +1466,84 @@ void CommonCaptureManager::WriteFillMemoryCmd(
     {
         GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, size);
 
-        format::FillMemoryCommandHeader fill_cmd;
-        size_t                          header_size       = sizeof(format::FillMemoryCommandHeader);
-        const uint8_t*                  uncompressed_data = (static_cast<const uint8_t*>(data) + offset);
-        size_t                          uncompressed_size = static_cast<size_t>(size);
-
-        auto thread_data = GetThreadData();
-        assert(thread_data != nullptr);
-
-        fill_cmd.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
-        fill_cmd.meta_header.meta_data_id =
-            format::MakeMetaDataId(api_family, format::MetaDataType::kFillMemoryCommand);
-        fill_cmd.thread_id     = thread_data->thread_id_;
-        fill_cmd.memory_id     = memory_id;
-        fill_cmd.memory_offset = offset;
-        fill_cmd.memory_size   = size;
+        const uint8_t* uncompressed_data = (static_cast<const uint8_t*>(data) + offset);
+        size_t         uncompressed_size = static_cast<size_t>(size);
 
-        bool not_compressed = true;
-
-        if (compressor_ != nullptr)
+        if ((content_deduplicator_ == nullptr) ||
+            !WriteFillMemoryContentCmd(api_family, memory_id, offset, uncompressed_data, uncompressed_size))
         {
-            size_t compressed_size = compressor_->Compress(
-                uncompressed_size, uncompressed_data, &thread_data->compressed_buffer_, header_size);
+            auto thread_data = GetThreadData();
+            assert(thread_data != nullptr);
+
+            format::FillMemoryCommandHeader fill_cmd;
+            fill_cmd.meta_header.meta_data_id =
+                format::MakeMetaDataId(api_family, format::MetaDataType::kFillMemoryCommand);
+            fill_cmd.thread_id     = thread_data->thread_id_;
+            fill_cmd.memory_id     = memory_id;
+            fill_cmd.memory_offset = offset;
+            fill_cmd.memory_size   = size;
+
+            WriteMetaDataCmdWithData(&fill_cmd, uncompressed_data, uncompressed_size);
+        }
+    }
+}
 
-            if ((compressed_size > 0) && (compressed_size < uncompressed_size))
-            {
-                not_compressed = false;
+bool CommonCaptureManager::WriteFillMemoryContentCmd(format::ApiFamilyId api_family,
+                                                     format::HandleId    memory_id,
+                                                     uint64_t            offset,
+                                                     const uint8_t*      data,
+                                                     size_t              size)
+{
+    assert(content_deduplicator_ != nullptr);
 
-                // We don't have a special header for compressed fill commands because the header always includes
-                // the uncompressed size, so we just change the type to indicate the data is compressed.
-                fill_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+    bool written = false;
 
-                // Calculate size of packet with uncompressed data size.
-                fill_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(fill_cmd) + compressed_size;
+    if (content_deduplicator_->IsCandidate(size))
+    {
+        auto thread_data = GetThreadData();
+        assert(thread_data != nullptr);
 
-                // Copy header to beginning of compressed_buffer_
-                util::platform::MemoryCopy(thread_data->compressed_buffer_.data(), header_size, &fill_cmd, header_size);
+        util::ContentDeduplicator::ContentKey key        = util::ContentDeduplicator::ComputeKey(data, size);
+        uint64_t                              content_id = 0;
+        bool                                  found      = content_deduplicator_->Find(key, &content_id);
 
-                WriteToFile(thread_data->compressed_buffer_.data(), header_size + compressed_size);
-            }
+        if (!found && content_deduplicator_->Reserve(size, &content_id))
+        {
+            format::ContentDataCommandHeader content_cmd;
+            content_cmd.meta_header.meta_data_id =
+                format::MakeMetaDataId(api_family, format::MetaDataType::kContentDataCommand);
+            content_cmd.thread_id  = thread_data->thread_id_;
+            content_cmd.content_id = content_id;
+            content_cmd.data_size  = size;
+
+            WriteMetaDataCmdWithData(&content_cmd, data, size);
+
+            // Blocks are written in the order that they are submitted for writing, so the blocks that reference the
+            // content after it is added will follow the content data block, including blocks from other threads.
+            content_deduplicator_->Add(key, content_id);
+            found = true;
         }
 
-        if (not_compressed)
+        if (found)
         {
-            // Calculate size of packet with compressed data size.
-            fill_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(fill_cmd) + uncompressed_size;
-
-            CombineAndWriteToFile({ { &fill_cmd, header_size }, { uncompressed_data, uncompressed_size } });
+            format::FillMemoryContentCommandHeader fill_cmd;
+            fill_cmd.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+            fill_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(fill_cmd);
+            fill_cmd.meta_header.meta_data_id =
+                format::MakeMetaDataId(api_family, format::MetaDataType::kFillMemoryContentCommand);
+            fill_cmd.thread_id     = thread_data->thread_id_;
+            fill_cmd.memory_id     = memory_id;
+            fill_cmd.memory_offset = offset;
+            fill_cmd.memory_size   = size;
+            fill_cmd.content_id    = content_id;
+
+            WriteToFile(&fill_cmd, sizeof(fill_cmd));
+
+            written = true;
         }
     }
+
+    return written;
 }
 
 void CommonCaptureManager::WriteCreateHeapAllocationCmd(format::ApiFamilyId api_family,
@@ -1316,7 +1569,96 @@ void CommonCaptureManager::WriteCreateHeapAllocationCmd(format::ApiFamilyId api_
     }
 }
 
+BlockStagingBuffer* CommonCaptureManager::GetStagingBuffer()
+{
+    assert(staging_writer_ != nullptr);
+
+    auto thread_data = GetThreadData();
+
+    // Thread data may outlive the capture manager that created its staging buffer.
+    if ((thread_data->staging_buffer_ == nullptr) ||
+        !staging_writer_->IsBufferOwner(thread_data->staging_buffer_.get()))
+    {
+        thread_data->staging_buffer_ = staging_writer_->CreateBuffer();
+    }
+
+    return thread_data->staging_buffer_.get();
+}
+
 void CommonCaptureManager::WriteToFile(const void* data, size_t size)
+{
+    BeginFileWrite();
+
+    if (staging_writer_ != nullptr)
+    {
+        staging_writer_->Write(GetStagingBuffer(), data, size);
+        if (force_file_flush_)
+        {
+            staging_writer_->Flush();
+        }
+    }
+    else if (compression_queue_ != nullptr)
+    {
+        compression_queue_->Write(data, size);
+        if (force_file_flush_)
+        {
+            compression_queue_->Flush();
+        }
+    }
+    else
+    {
+        file_stream_->Write(data, size);
+        if (force_file_flush_)
+        {
+            file_stream_->Flush();
+        }
+    }
+
+    EndFileWrite();
+}
+
+void CommonCaptureManager::WriteCompressibleToFile(const void* uncompressed_header,
+                                                   size_t      uncompressed_header_size,
+                                                   const void* compressed_header,
+                                                   size_t      compressed_header_size,
+                                                   const void* data,
+                                                   size_t      data_size)
+{
+    assert(compression_queue_ != nullptr);
+
+    BeginFileWrite();
+
+    if (staging_writer_ != nullptr)
+    {
+        staging_writer_->WriteCompressible(GetStagingBuffer(),
+                                           compressor_.get(),
+                                           uncompressed_header,
+                                           uncompressed_header_size,
+                                           compressed_header,
+                                           compressed_header_size,
+                                           data,
+                                           data_size);
+    }
+    else
+    {
+        compression_queue_->WriteCompressible(compressor_.get(),
+                                              uncompressed_header,
+                                              uncompressed_header_size,
+                                              compressed_header,
+                                              compressed_header_size,
+                                              data,
+                                              data_size);
+    }
+
+    if (force_file_flush_)
+    {
+        FlushFileWriters();
+    }
+
+    EndFileWrite();
+}
+
+void CommonCaptureManager::BeginFileWrite()
 {
     if (GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kUserfaultfd)
     {
@@ -1327,17 +1669,15 @@ void CommonCaptureManager::WriteToFile(const void* data, size_t size)
             // of a write to the capture file and the uffd mechanism interupts it, it will cause
             // a deadlock as uffd will also try to write to the capture file as well. For this
             // reason RT signal needs to be disabled while writing.
-            // This can be removed once writing to the capture file(s) is delegated to a separate thread.
+            // This is also required with the write thread, as the uffd mechanism would stage its blocks in the
+            // staging buffer of the interrupted thread.
             manager->UffdBlockRtSignal();
         }
     }
+}
 
-    file_stream_->Write(data, size);
-    if (force_file_flush_)
-    {
-        file_stream_->Flush();
-    }
-
+void CommonCaptureManager::EndFileWrite()
+{
     if (GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kUserfaultfd)
     {
         util::PageGuardManager* manager = util::PageGuardManager::Get();
@@ -1380,6 +1720,12 @@ void CommonCaptureManager::WriteCaptureOptions(std::string& operation_annotation
         buffer += force_file_flush_ ? "true," : "false,";
     }
 
+    if (write_file_index_ != default_settings.write_file_index)
+    {
+        buffer += "\n    \"file-index\": ";
+        buffer += write_file_index_ ? "true," : "false,";
+    }
+
     if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kUnassisted)
     {
         buffer += "\n    \"memory-tracking-mode\": \"unassisted\",";
@@ -1433,8 +1779,18 @@ void CommonCaptureManager::WriteCaptureOptions(std::string& operation_annotation
             page_guard_options_buffer += "\n    \"page-guard-signal-handler-watcher-max-restores\": " +
                                          std::to_string(page_guard_signal_handler_watcher_max_restores_) + ',';
         }
+        if (page_guard_hash_pages_ != default_settings.page_guard_hash_pages)
+        {
+            page_guard_options_buffer += "\n    \"page-guard-hash-pages\": ";
+            page_guard_options_buffer += page_guard_hash_pages_ ? "true," : "false,";
+        }
 
-        if (!page_guard_options_buffer.empty())
+        if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kSoftDirty)
+        {
+            buffer += "\n    \"memory-tracking-mode\": \"soft_dirty\",";
+            buffer += page_guard_options_buffer;
+        }
+        else if (!page_guard_options_buffer.empty())
         {
             buffer += "\n    \"memory-tracking-mode\": \"page_guard\",";
             buffer += page_guard_options_buffer;
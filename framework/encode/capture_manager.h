@@ -25,6 +25,8 @@
 #ifndef GFXRECON_ENCODE_CAPTURE_MANAGER_H
 #define GFXRECON_ENCODE_CAPTURE_MANAGER_H
 
+#include "encode/block_compression_queue.h"
+#include "encode/block_staging_writer.h"
 #include "encode/capture_settings.h"
 #include "encode/handle_unwrap_memory.h"
 #include "encode/parameter_buffer.h"
@@ -33,6 +35,7 @@
 #include "format/format.h"
 #include "format/platform_types.h"
 #include "util/compressor.h"
+#include "util/content_deduplicator.h"
 #include "util/defines.h"
 #include "util/file_output_stream.h"
 #include "util/keyboard.h"
@@ -217,6 +220,7 @@ class CommonCaptureManager
         std::vector<uint8_t>                     compressed_buffer_;
         HandleUnwrapMemory                       handle_unwrap_memory_;
         uint64_t                                 block_index_;
+        std::shared_ptr<BlockStagingBuffer>      staging_buffer_;
 
       private:
         static format::ThreadId GetThreadId();
@@ -262,7 +266,13 @@ class CommonCaptureManager
     auto                                GetAccelStructPaddingSetting() const { return accel_struct_padding_; }
     bool                                GetForceFifoPresentModeSetting() const { return force_fifo_present_mode_; }
 
+    // Returns true for the page guard, userfaultfd, and soft-dirty memory tracking modes, which track mapped memory
+    // with the PageGuardManager.
+    bool UsesPageGuardManager() const;
+
     util::Compressor*      GetCompressor() { return compressor_.get(); }
+    uint32_t               GetCompressionThreadCount() const { return compression_thread_count_; }
+    bool                   GetCompactEncoding() const { return file_options_.compact_encoding; }
     std::mutex&            GetMappedMemoryLock() { return mapped_memory_lock_; }
     util::Keyboard&        GetKeyboard() { return keyboard_; }
     const std::string&     GetScreenshotPrefix() const { return screenshot_prefix_; }
@@ -270,11 +280,16 @@ class CommonCaptureManager
 
     std::string CreateTrimFilename(const std::string& base_filename, const util::UintRange& trim_range);
     bool        CreateCaptureFile(format::ApiFamilyId api_family, const std::string& base_filename);
+    void        CloseCaptureFile();
+    void        CreateFileWriters();
+    void        FlushFileWriters();
     void        WriteCaptureOptions(std::string& operation_annotation);
     void        ActivateTrimming(std::shared_lock<ApiCallMutexT>& current_lock);
     void        DeactivateTrimming(std::shared_lock<ApiCallMutexT>& current_lock);
 
     void WriteFileHeader();
+    void BeginFileWrite();
+    void EndFileWrite();
     void BuildOptionList(const format::EnabledOptions&        enabled_options,
                          std::vector<format::FileOptionPair>* option_list);
 
@@ -288,10 +303,37 @@ class CommonCaptureManager
     void WriteFillMemoryCmd(
         format::ApiFamilyId api_family, format::HandleId memory_id, uint64_t offset, uint64_t size, const void* data);
 
+    // Writes the data with a fill memory content command when content deduplication is enabled, writing the data to a
+    // content data block first if it has not already been written.  Returns false when the data must be written with a
+    // fill memory command.
+    bool WriteFillMemoryContentCmd(format::ApiFamilyId api_family,
+                                   format::HandleId    memory_id,
+                                   uint64_t            offset,
+                                   const uint8_t*      data,
+                                   size_t              size);
+
+    // Writes a meta data command with a header that is followed by data, compressing the data when compression is
+    // enabled.  The header must specify the uncompressed size of the data.
+    template <typename T>
+    void WriteMetaDataCmdWithData(T* header, const uint8_t* data, size_t data_size);
+
     void WriteCreateHeapAllocationCmd(format::ApiFamilyId api_family, uint64_t allocation_id, uint64_t allocation_size);
 
+    // Returns the calling thread's staging buffer for the write thread.
+    BlockStagingBuffer* GetStagingBuffer();
+
     void WriteToFile(const void* data, size_t size);
 
+    // Writes a block that is compressed by the compression queue's worker threads when the compression queue is
+    // enabled.  The block is written with compressed_header when compression reduces the size of the data and with
+    // uncompressed_header otherwise.
+    void WriteCompressibleToFile(const void* uncompressed_header,
+                                 size_t      uncompressed_header_size,
+                                 const void* compressed_header,
+                                 size_t      compressed_header_size,
+                                 const void* data,
+                                 size_t      data_size);
+
     template <size_t N>
     void CombineAndWriteToFile(const std::pair<const void*, size_t> (&buffers)[N])
     {
@@ -348,10 +390,15 @@ class CommonCaptureManager
         capture_settings_; // Settings from the settings file and environment at capture manager creation time.
 
     std::unique_ptr<util::FileOutputStream> file_stream_;
+    std::unique_ptr<BlockCompressionQueue>  compression_queue_;
+    std::unique_ptr<BlockStagingWriter>     staging_writer_;
     format::EnabledOptions                  file_options_;
     std::string                             base_filename_;
+    std::string                             capture_filename_;
     bool                                    timestamp_filename_;
     bool                                    force_file_flush_;
+    bool                                    write_file_index_;
+    uint32_t                                compression_thread_count_;
     CaptureSettings::MemoryTrackingMode     memory_tracking_mode_;
     bool                                    page_guard_align_buffer_sizes_;
     bool                                    page_guard_track_ahb_memory_;
@@ -362,6 +409,7 @@ class CommonCaptureManager
     bool                                    page_guard_separate_read_;
     bool                                    page_guard_copy_on_map_;
     bool                                    page_guard_external_memory_;
+    bool                                    page_guard_hash_pages_;
     bool                                    trim_enabled_;
     CaptureSettings::TrimBoundary           trim_boundary_;
     std::vector<util::UintRange>            trim_ranges_;
@@ -387,6 +435,9 @@ class CommonCaptureManager
     bool                                    quit_after_frame_ranges_;
     bool                                    force_fifo_present_mode_;
 
+    // Not null when fill memory data is deduplicated with content data blocks.
+    std::unique_ptr<util::ContentDeduplicator> content_deduplicator_;
+
     struct
     {
         bool     rv_annotation{ false };
@@ -44,12 +44,26 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 // clang-format off
 #define CAPTURE_COMPRESSION_TYPE_LOWER                       "capture_compression_type"
 #define CAPTURE_COMPRESSION_TYPE_UPPER                       "CAPTURE_COMPRESSION_TYPE"
+#define CAPTURE_COMPRESSION_THREADS_LOWER                    "capture_compression_threads"
+#define CAPTURE_COMPRESSION_THREADS_UPPER                    "CAPTURE_COMPRESSION_THREADS"
+#define CAPTURE_CONTENT_DEDUP_LIMIT_LOWER                    "capture_content_dedup_limit"
+#define CAPTURE_CONTENT_DEDUP_LIMIT_UPPER                    "CAPTURE_CONTENT_DEDUP_LIMIT"
+#define CAPTURE_COMPACT_ENCODING_LOWER                       "capture_compact_encoding"
+#define CAPTURE_COMPACT_ENCODING_UPPER                       "CAPTURE_COMPACT_ENCODING"
 #define CAPTURE_FILE_NAME_LOWER                              "capture_file"
 #define CAPTURE_FILE_NAME_UPPER                              "CAPTURE_FILE"
 #define CAPTURE_FILE_USE_TIMESTAMP_LOWER                     "capture_file_timestamp"
 #define CAPTURE_FILE_USE_TIMESTAMP_UPPER                     "CAPTURE_FILE_TIMESTAMP"
 #define CAPTURE_FILE_FLUSH_LOWER                             "capture_file_flush"
 #define CAPTURE_FILE_FLUSH_UPPER                             "CAPTURE_FILE_FLUSH"
+#define CAPTURE_FILE_INDEX_LOWER                             "capture_file_index"
+#define CAPTURE_FILE_INDEX_UPPER                             "CAPTURE_FILE_INDEX"
+#define CAPTURE_WRITE_THREAD_LOWER                           "capture_write_thread"
+#define CAPTURE_WRITE_THREAD_UPPER                           "CAPTURE_WRITE_THREAD"
+#define CAPTURE_WRITE_BUFFER_SIZE_LOWER                      "capture_write_buffer_size"
+#define CAPTURE_WRITE_BUFFER_SIZE_UPPER                      "CAPTURE_WRITE_BUFFER_SIZE"
+#define CAPTURE_WRITE_BUFFER_FULL_LOWER                      "capture_write_buffer_full"
+#define CAPTURE_WRITE_BUFFER_FULL_UPPER                      "CAPTURE_WRITE_BUFFER_FULL"
 #define LOG_ALLOW_INDENTS_LOWER                              "log_allow_indents"
 #define LOG_ALLOW_INDENTS_UPPER                              "LOG_ALLOW_INDENTS"
 #define LOG_BREAK_ON_ERROR_LOWER                             "log_break_on_error"
@@ -112,6 +126,8 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 #define PAGE_GUARD_SIGNAL_HANDLER_WATCHER_UPPER              "PAGE_GUARD_SIGNAL_HANDLER_WATCHER"
 #define PAGE_GUARD_SIGNAL_HANDLER_WATCHER_MAX_RESTORES_LOWER "page_guard_signal_handler_watcher_max_restores"
 #define PAGE_GUARD_SIGNAL_HANDLER_WATCHER_MAX_RESTORES_UPPER "PAGE_GUARD_SIGNAL_HANDLER_WATCHER_MAX_RESTORES"
+#define PAGE_GUARD_HASH_PAGES_LOWER                          "page_guard_hash_pages"
+#define PAGE_GUARD_HASH_PAGES_UPPER                          "PAGE_GUARD_HASH_PAGES"
 #define DEBUG_LAYER_LOWER                                    "debug_layer"
 #define DEBUG_LAYER_UPPER                                    "DEBUG_LAYER"
 #define DEBUG_DEVICE_LOST_LOWER                              "debug_device_lost"
@@ -144,7 +160,14 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 const char CaptureSettings::kDefaultCaptureFileName[] = "/sdcard/gfxrecon_capture" GFXRECON_FILE_EXTENSION;
 
 const char kCaptureCompressionTypeEnvVar[]                   = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_TYPE_LOWER;
+const char kCaptureCompressionThreadsEnvVar[]                = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_THREADS_LOWER;
+const char kCaptureContentDedupLimitEnvVar[]                 = GFXRECON_ENV_VAR_PREFIX CAPTURE_CONTENT_DEDUP_LIMIT_LOWER;
+const char kCaptureCompactEncodingEnvVar[]                   = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPACT_ENCODING_LOWER;
 const char kCaptureFileFlushEnvVar[]                         = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_FLUSH_LOWER;
+const char kCaptureFileIndexEnvVar[]                         = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_INDEX_LOWER;
+const char kCaptureWriteThreadEnvVar[]                       = GFXRECON_ENV_VAR_PREFIX CAPTURE_WRITE_THREAD_LOWER;
+const char kCaptureWriteBufferSizeEnvVar[]                   = GFXRECON_ENV_VAR_PREFIX CAPTURE_WRITE_BUFFER_SIZE_LOWER;
+const char kCaptureWriteBufferFullEnvVar[]                   = GFXRECON_ENV_VAR_PREFIX CAPTURE_WRITE_BUFFER_FULL_LOWER;
 const char kCaptureFileNameEnvVar[]                          = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_NAME_LOWER;
 const char kCaptureFileUseTimestampEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_USE_TIMESTAMP_LOWER;
 const char kLogAllowIndentsEnvVar[]                          = GFXRECON_ENV_VAR_PREFIX LOG_ALLOW_INDENTS_LOWER;
@@ -177,6 +200,7 @@ const char kPageGuardExternalMemoryEnvVar[]                  = GFXRECON_ENV_VAR_
 const char kPageGuardUnblockSIGSEGVEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_UNBLOCK_SIGSEGV_LOWER;
 const char kPageGuardSignalHandlerWatcherEnvVar[]            = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_SIGNAL_HANDLER_WATCHER_LOWER;
 const char kPageGuardSignalHandlerWatcherMaxRestoresEnvVar[] = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_SIGNAL_HANDLER_WATCHER_MAX_RESTORES_LOWER;
+const char kPageGuardHashPagesEnvVar[]                       = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_HASH_PAGES_LOWER;
 const char kDebugLayerEnvVar[]                               = GFXRECON_ENV_VAR_PREFIX DEBUG_LAYER_LOWER;
 const char kDebugDeviceLostEnvVar[]                          = GFXRECON_ENV_VAR_PREFIX DEBUG_DEVICE_LOST_LOWER;
 const char kCaptureAndroidTriggerEnvVar[]                    = GFXRECON_ENV_VAR_PREFIX CAPTURE_ANDROID_TRIGGER_LOWER;
@@ -198,7 +222,14 @@ const char kForceFifoPresentModeEnvVar[]                     = GFXRECON_ENV_VAR_
 const char CaptureSettings::kDefaultCaptureFileName[] = "gfxrecon_capture" GFXRECON_FILE_EXTENSION;
 
 const char kCaptureCompressionTypeEnvVar[]                   = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_TYPE_UPPER;
+const char kCaptureCompressionThreadsEnvVar[]                = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_THREADS_UPPER;
+const char kCaptureContentDedupLimitEnvVar[]                 = GFXRECON_ENV_VAR_PREFIX CAPTURE_CONTENT_DEDUP_LIMIT_UPPER;
+const char kCaptureCompactEncodingEnvVar[]                   = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPACT_ENCODING_UPPER;
 const char kCaptureFileFlushEnvVar[]                         = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_FLUSH_UPPER;
+const char kCaptureFileIndexEnvVar[]                         = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_INDEX_UPPER;
+const char kCaptureWriteThreadEnvVar[]                       = GFXRECON_ENV_VAR_PREFIX CAPTURE_WRITE_THREAD_UPPER;
+const char kCaptureWriteBufferSizeEnvVar[]                   = GFXRECON_ENV_VAR_PREFIX CAPTURE_WRITE_BUFFER_SIZE_UPPER;
+const char kCaptureWriteBufferFullEnvVar[]                   = GFXRECON_ENV_VAR_PREFIX CAPTURE_WRITE_BUFFER_FULL_UPPER;
 const char kCaptureFileNameEnvVar[]                          = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_NAME_UPPER;
 const char kCaptureFileUseTimestampEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_USE_TIMESTAMP_UPPER;
 const char kLogAllowIndentsEnvVar[]                          = GFXRECON_ENV_VAR_PREFIX LOG_ALLOW_INDENTS_UPPER;
@@ -227,6 +258,7 @@ const char kPageGuardExternalMemoryEnvVar[]                  = GFXRECON_ENV_VAR_
 const char kPageGuardUnblockSIGSEGVEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_UNBLOCK_SIGSEGV_UPPER;
 const char kPageGuardSignalHandlerWatcherEnvVar[]            = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_SIGNAL_HANDLER_WATCHER_UPPER;
 const char kPageGuardSignalHandlerWatcherMaxRestoresEnvVar[] = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_SIGNAL_HANDLER_WATCHER_MAX_RESTORES_UPPER;
+const char kPageGuardHashPagesEnvVar[]                       = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_HASH_PAGES_UPPER;
 const char kCaptureTriggerEnvVar[]                           = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIGGER_UPPER;
 const char kCaptureTriggerFramesEnvVar[]                     = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIGGER_FRAMES_UPPER;
 const char kCaptureIUnknownWrappingEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX CAPTURE_IUNKNOWN_WRAPPING_UPPER;
@@ -250,8 +282,15 @@ const char kForceFifoPresentModeEnvVar[]                     = GFXRECON_ENV_VAR_
 const char kSettingsFilter[] = "lunarg_gfxreconstruct.";
 
 const std::string kOptionKeyCaptureCompressionType                   = std::string(kSettingsFilter) + std::string(CAPTURE_COMPRESSION_TYPE_LOWER);
+const std::string kOptionKeyCaptureCompressionThreads                = std::string(kSettingsFilter) + std::string(CAPTURE_COMPRESSION_THREADS_LOWER);
+const std::string kOptionKeyCaptureContentDedupLimit                 = std::string(kSettingsFilter) + std::string(CAPTURE_CONTENT_DEDUP_LIMIT_LOWER);
+const std::string kOptionKeyCaptureCompactEncoding                   = std::string(kSettingsFilter) + std::string(CAPTURE_COMPACT_ENCODING_LOWER);
 const std::string kOptionKeyCaptureFile                              = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_NAME_LOWER);
 const std::string kOptionKeyCaptureFileForceFlush                    = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_FLUSH_LOWER);
+const std::string kOptionKeyCaptureFileIndex                         = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_INDEX_LOWER);
+const std::string kOptionKeyCaptureWriteThread                       = std::string(kSettingsFilter) + std::string(CAPTURE_WRITE_THREAD_LOWER);
+const std::string kOptionKeyCaptureWriteBufferSize                   = std::string(kSettingsFilter) + std::string(CAPTURE_WRITE_BUFFER_SIZE_LOWER);
+const std::string kOptionKeyCaptureWriteBufferFull                   = std::string(kSettingsFilter) + std::string(CAPTURE_WRITE_BUFFER_FULL_LOWER);
 const std::string kOptionKeyCaptureFileUseTimestamp                  = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_USE_TIMESTAMP_LOWER);
 const std::string kOptionKeyLogAllowIndents                          = std::string(kSettingsFilter) + std::string(LOG_ALLOW_INDENTS_LOWER);
 const std::string kOptionKeyLogBreakOnError                          = std::string(kSettingsFilter) + std::string(LOG_BREAK_ON_ERROR_LOWER);
@@ -283,6 +322,7 @@ const std::string kOptionKeyPageGuardExternalMemory                  = std::stri
 const std::string kOptionKeyPageGuardUnblockSigSegV                  = std::string(kSettingsFilter) + std::string(PAGE_GUARD_UNBLOCK_SIGSEGV_LOWER);
 const std::string kOptionKeyPageGuardSignalHandlerWatcher            = std::string(kSettingsFilter) + std::string(PAGE_GUARD_SIGNAL_HANDLER_WATCHER_LOWER);
 const std::string kOptionKeyPageGuardSignalHandlerWatcherMaxRestores = std::string(kSettingsFilter) + std::string(PAGE_GUARD_SIGNAL_HANDLER_WATCHER_MAX_RESTORES_LOWER);
+const std::string kOptionKeyPageGuardHashPages                       = std::string(kSettingsFilter) + std::string(PAGE_GUARD_HASH_PAGES_LOWER);
 const std::string kDebugLayer                                        = std::string(kSettingsFilter) + std::string(DEBUG_LAYER_LOWER);
 const std::string kDebugDeviceLost                                   = std::string(kSettingsFilter) + std::string(DEBUG_DEVICE_LOST_LOWER);
 const std::string kOptionDisableDxr                                  = std::string(kSettingsFilter) + std::string(DISABLE_DXR_LOWER);
@@ -388,7 +428,14 @@ void CaptureSettings::LoadOptionsEnvVar(OptionsMap* options)
     LoadSingleOptionEnvVar(options, kCaptureFileNameEnvVar, kOptionKeyCaptureFile);
     LoadSingleOptionEnvVar(options, kCaptureFileUseTimestampEnvVar, kOptionKeyCaptureFileUseTimestamp);
     LoadSingleOptionEnvVar(options, kCaptureCompressionTypeEnvVar, kOptionKeyCaptureCompressionType);
+    LoadSingleOptionEnvVar(options, kCaptureCompressionThreadsEnvVar, kOptionKeyCaptureCompressionThreads);
+    LoadSingleOptionEnvVar(options, kCaptureContentDedupLimitEnvVar, kOptionKeyCaptureContentDedupLimit);
+    LoadSingleOptionEnvVar(options, kCaptureCompactEncodingEnvVar, kOptionKeyCaptureCompactEncoding);
     LoadSingleOptionEnvVar(options, kCaptureFileFlushEnvVar, kOptionKeyCaptureFileForceFlush);
+    LoadSingleOptionEnvVar(options, kCaptureFileIndexEnvVar, kOptionKeyCaptureFileIndex);
+    LoadSingleOptionEnvVar(options, kCaptureWriteThreadEnvVar, kOptionKeyCaptureWriteThread);
+    LoadSingleOptionEnvVar(options, kCaptureWriteBufferSizeEnvVar, kOptionKeyCaptureWriteBufferSize);
+    LoadSingleOptionEnvVar(options, kCaptureWriteBufferFullEnvVar, kOptionKeyCaptureWriteBufferFull);
 
     // Logging environment variables
     LoadSingleOptionEnvVar(options, kLogAllowIndentsEnvVar, kOptionKeyLogAllowIndents);
@@ -424,6 +471,7 @@ void CaptureSettings::LoadOptionsEnvVar(OptionsMap* options)
     LoadSingleOptionEnvVar(options, kPageGuardSignalHandlerWatcherEnvVar, kOptionKeyPageGuardSignalHandlerWatcher);
     LoadSingleOptionEnvVar(
         options, kPageGuardSignalHandlerWatcherMaxRestoresEnvVar, kOptionKeyPageGuardSignalHandlerWatcherMaxRestores);
+    LoadSingleOptionEnvVar(options, kPageGuardHashPagesEnvVar, kOptionKeyPageGuardHashPages);
 
     // Debug environment variables
     LoadSingleOptionEnvVar(options, kDebugLayerEnvVar, kDebugLayer);
@@ -483,12 +531,30 @@ void CaptureSettings::ProcessOptions(OptionsMap* options, CaptureSettings* setti
     // Capture file options
     settings->trace_settings_.capture_file_options.compression_type =
         ParseCompressionTypeString(FindOption(options, kOptionKeyCaptureCompressionType), kDefaultCompressionType);
+    settings->trace_settings_.compression_thread_count =
+        gfxrecon::util::ParseUintString(FindOption(options, kOptionKeyCaptureCompressionThreads),
+                                        settings->trace_settings_.compression_thread_count);
+    settings->trace_settings_.capture_file_options.content_deduplication_limit =
+        gfxrecon::util::ParseUintString(FindOption(options, kOptionKeyCaptureContentDedupLimit),
+                                        settings->trace_settings_.capture_file_options.content_deduplication_limit);
+    settings->trace_settings_.capture_file_options.compact_encoding =
+        ParseBoolString(FindOption(options, kOptionKeyCaptureCompactEncoding),
+                        settings->trace_settings_.capture_file_options.compact_encoding);
     settings->trace_settings_.capture_file =
         FindOption(options, kOptionKeyCaptureFile, settings->trace_settings_.capture_file);
     settings->trace_settings_.time_stamp_file = ParseBoolString(FindOption(options, kOptionKeyCaptureFileUseTimestamp),
                                                                 settings->trace_settings_.time_stamp_file);
     settings->trace_settings_.force_flush =
         ParseBoolString(FindOption(options, kOptionKeyCaptureFileForceFlush), settings->trace_settings_.force_flush);
+    settings->trace_settings_.write_file_index =
+        ParseBoolString(FindOption(options, kOptionKeyCaptureFileIndex), settings->trace_settings_.write_file_index);
+    settings->trace_settings_.write_thread =
+        ParseBoolString(FindOption(options, kOptionKeyCaptureWriteThread), settings->trace_settings_.write_thread);
+    settings->trace_settings_.write_buffer_size =
+        gfxrecon::util::ParseUintString(FindOption(options, kOptionKeyCaptureWriteBufferSize),
+                                        settings->trace_settings_.write_buffer_size);
+    settings->trace_settings_.write_buffer_full_policy = ParseWriteBufferFullPolicyString(
+        FindOption(options, kOptionKeyCaptureWriteBufferFull), settings->trace_settings_.write_buffer_full_policy);
 
     // Memory tracking options
     settings->trace_settings_.memory_tracking_mode = ParseMemoryTrackingModeString(
@@ -573,6 +639,8 @@ void CaptureSettings::ProcessOptions(OptionsMap* options, CaptureSettings* setti
     settings->trace_settings_.page_guard_signal_handler_watcher_max_restores =
         ParseIntegerString(FindOption(options, kOptionKeyPageGuardSignalHandlerWatcherMaxRestores),
                            settings->trace_settings_.page_guard_signal_handler_watcher_max_restores);
+    settings->trace_settings_.page_guard_hash_pages = ParseBoolString(
+        FindOption(options, kOptionKeyPageGuardHashPages), settings->trace_settings_.page_guard_hash_pages);
 
     // Debug options
     settings->trace_settings_.debug_layer =
@@ -739,6 +807,10 @@ CaptureSettings::ParseMemoryTrackingModeString(const std::string&
     {
         result = MemoryTrackingMode::kUserfaultfd;
     }
+    else if (util::platform::StringCompareNoCase("soft_dirty", value_string.c_str()) == 0)
+    {
+        result = MemoryTrackingMode::kSoftDirty;
+    }
     else if (util::platform::StringCompareNoCase("assisted", value_string.c_str()) == 0)
     {
         result = MemoryTrackingMode::kAssisted;
@@ -759,6 +831,32 @@ CaptureSettings::ParseMemoryTrackingModeString(const std::string&
     return result;
 }
 
+CaptureSettings::WriteBufferFullPolicy
+CaptureSettings::ParseWriteBufferFullPolicyString(const std::string&                     value_string,
+                                                  CaptureSettings::WriteBufferFullPolicy default_value)
+{
+    CaptureSettings::WriteBufferFullPolicy result = default_value;
+
+    if (util::platform::StringCompareNoCase("wait", value_string.c_str()) == 0)
+    {
+        result = WriteBufferFullPolicy::kWait;
+    }
+    else if (util::platform::StringCompareNoCase("allocate", value_string.c_str()) == 0)
+    {
+        result = WriteBufferFullPolicy::kAllocate;
+    }
+    else
+    {
+        if (!value_string.empty())
+        {
+            GFXRECON_LOG_WARNING("Settings Loader: Ignoring unrecognized write buffer full option value \"%s\"",
+                                 value_string.c_str());
+        }
+    }
+
+    return result;
+}
+
 #if defined(__ANDROID__)
 CaptureSettings::RuntimeTriggerState
 CaptureSettings::ParseAndroidRunTimeTrimState(const std::string&                   value_string,
@@ -56,7 +56,11 @@ class CaptureSettings
         // Similar mechanism as page guard. The mapper memory returned by the driver is replaced by a shadow
         // allocation but in this case the memory is monitored using the userfaultfd mechanism provided by the linux
         // kernel.
-        kUserfaultfd = 3
+        kUserfaultfd = 3,
+        // Linux only. Modified pages are found by clearing the kernel's soft-dirty page table bits through
+        // /proc/self/clear_refs and reading them back from /proc/self/pagemap.  Memory is only write protected, with
+        // the page guard SIGSEGV handler, while the bits are being reset.
+        kSoftDirty = 4
     };
 
     enum RuntimeTriggerState
@@ -76,6 +80,14 @@ class CaptureSettings
         kQueueSubmits,
     };
 
+    enum class WriteBufferFullPolicy
+    {
+        // Wait for the write thread to write staged blocks to the capture file.
+        kWait,
+        // Stage blocks in separate memory allocations until space is available.
+        kAllocate
+    };
+
     const static char kDefaultCaptureFileName[];
 
     struct ResourveValueAnnotationInfo
@@ -91,8 +103,13 @@ class CaptureSettings
     {
         std::string                  capture_file{ kDefaultCaptureFileName };
         format::EnabledOptions       capture_file_options;
+        uint32_t                     compression_thread_count{ 0 };
         bool                         time_stamp_file{ true };
         bool                         force_flush{ false };
+        bool                         write_file_index{ false };
+        bool                         write_thread{ false };
+        uint32_t                     write_buffer_size{ 4096 }; // Size of each thread's staging buffer in KiB.
+        WriteBufferFullPolicy        write_buffer_full_policy{ WriteBufferFullPolicy::kWait };
         MemoryTrackingMode           memory_tracking_mode{ kPageGuard };
         std::string                  screenshot_dir;
         std::vector<util::UintRange> screenshot_ranges;
@@ -110,6 +127,7 @@ class CaptureSettings
         bool                         page_guard_track_ahb_memory{ false };
         bool                         page_guard_unblock_sigsegv{ false };
         bool                         page_guard_signal_handler_watcher{ false };
+        bool                         page_guard_hash_pages{ util::PageGuardManager::kDefaultEnablePageHashing };
         bool                         debug_layer{ false };
         bool                         debug_device_lost{ false };
         bool                         disable_dxr{ false };
@@ -175,6 +193,9 @@ class CaptureSettings
     static MemoryTrackingMode ParseMemoryTrackingModeString(const std::string& value_string,
                                                             MemoryTrackingMode default_value);
 
+    static WriteBufferFullPolicy ParseWriteBufferFullPolicyString(const std::string&    value_string,
+                                                                  WriteBufferFullPolicy default_value);
+
 #if defined(__ANDROID__)
     static RuntimeTriggerState ParseAndroidRunTimeTrimState(const std::string&  value_string,
                                                             RuntimeTriggerState default_value);
@@ -128,15 +128,19 @@ static void EncodeDescriptorUpdateTemplateInfo(VulkanCaptureManager*     manager
         // Write pointer attributes as if we were processing a struct pointer.
         encoder->EncodeStructPtrPreamble(data);
 
+        // The decoder finds the optional entries from the encoded sizes of the required entries, so the template data
+        // is written with fixed size values, by an encoder without compact encoding for the same output stream.
+        ParameterEncoder template_encoder(encoder->GetOutputStream());
+
         // The update template data will be written as tightly packed arrays of VkDescriptorImageInfo,
         // VkDescriptorBufferInfo, VkBufferView, and VkAccelerationStructureKHR types.  There will be one array per
         // descriptor update entry.  For the required entries, we will write the total number of entries of each type
         // before we write the entries, so that the decoder will know up front how much memory it needs to allocate for
         // decoding. Optional entries must be encoded after the required entries, and must encode the number of elements
         // in the array as well as VkDescriptorType.
-        encoder->EncodeSizeTValue(info->image_info_count);
-        encoder->EncodeSizeTValue(info->buffer_info_count);
-        encoder->EncodeSizeTValue(info->texel_buffer_view_count);
+        template_encoder.EncodeSizeTValue(info->image_info_count);
+        template_encoder.EncodeSizeTValue(info->buffer_info_count);
+        template_encoder.EncodeSizeTValue(info->texel_buffer_view_count);
 
         // Write the individual template update entries, sorted by type, as tightly packed arrays.
         const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
@@ -147,7 +151,7 @@ static void EncodeDescriptorUpdateTemplateInfo(VulkanCaptureManager*     manager
             {
                 size_t                       offset = entry_info.offset + (entry_info.stride * i);
                 const VkDescriptorImageInfo* entry  = reinterpret_cast<const VkDescriptorImageInfo*>(bytes + offset);
-                EncodeStruct(encoder, entry_info.type, (*entry));
+                EncodeStruct(&template_encoder, entry_info.type, (*entry));
             }
         }
 
@@ -158,7 +162,7 @@ static void EncodeDescriptorUpdateTemplateInfo(VulkanCaptureManager*     manager
             {
                 size_t                        offset = entry_info.offset + (entry_info.stride * i);
                 const VkDescriptorBufferInfo* entry  = reinterpret_cast<const VkDescriptorBufferInfo*>(bytes + offset);
-                EncodeStruct(encoder, (*entry));
+                EncodeStruct(&template_encoder, (*entry));
             }
         }
 
@@ -169,7 +173,7 @@ static void EncodeDescriptorUpdateTemplateInfo(VulkanCaptureManager*     manager
             {
                 size_t              offset = entry_info.offset + (entry_info.stride * i);
                 const VkBufferView* entry  = reinterpret_cast<const VkBufferView*>(bytes + offset);
-                encoder->EncodeVulkanHandleValue<vulkan_wrappers::BufferViewWrapper>(*entry);
+                template_encoder.EncodeVulkanHandleValue<vulkan_wrappers::BufferViewWrapper>(*entry);
             }
         }
 
@@ -177,8 +181,8 @@ static void EncodeDescriptorUpdateTemplateInfo(VulkanCaptureManager*     manager
         // required entries. Data is only written to the capture file if info->acceleration_structure_khr_count > 0.
         if (info->acceleration_structure_khr_count > 0)
         {
-            encoder->EncodeSizeTValue(info->acceleration_structure_khr_count);
-            encoder->EncodeEnumValue(VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR);
+            template_encoder.EncodeSizeTValue(info->acceleration_structure_khr_count);
+            template_encoder.EncodeEnumValue(VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR);
             for (const auto& entry_info : info->acceleration_structure_khr)
             {
                 for (size_t i = 0; i < entry_info.count; ++i)
@@ -186,7 +190,7 @@ static void EncodeDescriptorUpdateTemplateInfo(VulkanCaptureManager*     manager
                     size_t                            offset = entry_info.offset + (entry_info.stride * i);
                     const VkAccelerationStructureKHR* entry =
                         reinterpret_cast<const VkAccelerationStructureKHR*>(bytes + offset);
-                    encoder->EncodeVulkanHandleValue<vulkan_wrappers::AccelerationStructureKHRWrapper>(*entry);
+                    template_encoder.EncodeVulkanHandleValue<vulkan_wrappers::AccelerationStructureKHRWrapper>(*entry);
                 }
             }
         }
@@ -194,12 +198,12 @@ static void EncodeDescriptorUpdateTemplateInfo(VulkanCaptureManager*     manager
         // Process raw byte-arrays for VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK
         if (info->inline_uniform_block_count > 0)
         {
-            encoder->EncodeSizeTValue(info->inline_uniform_block_count);
-            encoder->EncodeEnumValue(VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK);
+            template_encoder.EncodeSizeTValue(info->inline_uniform_block_count);
+            template_encoder.EncodeEnumValue(VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK);
 
             for (const auto& entry_info : info->inline_uniform_block)
             {
-                encoder->EncodeRawBytes(bytes + entry_info.offset, entry_info.count);
+                template_encoder.EncodeRawBytes(bytes + entry_info.offset, entry_info.count);
             }
         }
     }
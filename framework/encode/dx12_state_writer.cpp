@@ -36,9 +36,10 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 
 Dx12StateWriter::Dx12StateWriter(util::FileOutputStream* output_stream,
                                  util::Compressor*       compressor,
-                                 format::ThreadId        thread_id) :
+                                 format::ThreadId        thread_id,
+                                 bool                    compact_encoding) :
     output_stream_(output_stream),
-    compressor_(compressor), thread_id_(thread_id), encoder_(&parameter_stream_)
+    compressor_(compressor), thread_id_(thread_id), encoder_(&parameter_stream_, compact_encoding)
 {
     assert(output_stream != nullptr);
 }
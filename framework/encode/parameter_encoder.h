@@ -34,6 +34,7 @@
 #include "util/defines.h"
 #include "util/output_stream.h"
 #include "util/platform.h"
+#include "util/varint.h"
 
 #include "vulkan/vulkan.h"
 
@@ -48,10 +49,18 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 class ParameterEncoder
 {
   public:
-    ParameterEncoder(util::OutputStream* stream) : output_stream_(stream) {}
+    ParameterEncoder(util::OutputStream* stream, bool compact_encoding = false) :
+        output_stream_(stream), compact_encoding_(compact_encoding)
+    {}
 
     ~ParameterEncoder() {}
 
+    util::OutputStream* GetOutputStream() const { return output_stream_; }
+
+    // Compact encoding writes integer values, pointer attribute masks, and array lengths as varints, which must match
+    // the format::FileOption::kCompactEncoding option of the capture file.
+    void SetCompactEncoding(bool compact_encoding) { compact_encoding_ = compact_encoding; }
+
     // clang-format off
 
     // Values
@@ -69,11 +78,12 @@ class ParameterEncoder
     void EncodeHandleIdValue(format::HandleId value)                                                                  { EncodeValue(static_cast<format::HandleEncodeType>(value)); }
     void EncodeVkDeviceAddressValue(VkDeviceAddress value)                                                            { EncodeValue(static_cast<format::DeviceSizeEncodeType>(value)); }
 
-    // Encode the address values for pointers to non-Vulkan objects to be used as object IDs.
-    void EncodeAddress(const void* value)                                                                             { EncodeValue(reinterpret_cast<format::AddressEncodeType>(value)); }
+    // Encode the address values for pointers to non-Vulkan objects to be used as object IDs.  Addresses are written
+    // with fixed size values, even with compact encoding.
+    void EncodeAddress(const void* value)                                                                             { EncodeFixedValue(reinterpret_cast<format::AddressEncodeType>(value)); }
     void EncodeVoidPtr(const void* value)                                                                             { EncodeAddress(value); }
     template<typename T>
-    void EncodeFunctionPtr(T value)                                                                                   { EncodeValue(reinterpret_cast<format::AddressEncodeType>(value)); }
+    void EncodeFunctionPtr(T value)                                                                                   { EncodeFixedValue(reinterpret_cast<format::AddressEncodeType>(value)); }
 
     template<typename Wrapper>
     void EncodeVulkanHandleValue(typename Wrapper::HandleType value)                                                  { EncodeHandleIdValue(vulkan_wrappers::GetWrappedId<Wrapper>(value)); }
@@ -101,7 +111,7 @@ class ParameterEncoder
     void EncodeUInt64Ptr(const uint64_t* ptr, bool omit_data = false, bool omit_addr = false)                         { EncodePointer(ptr, omit_data, omit_addr); }
     void EncodeFloatPtr(const float* ptr, bool omit_data = false, bool omit_addr = false)                             { EncodePointer(ptr, omit_data, omit_addr); }
     void EncodeSizeTPtr(const size_t* ptr, bool omit_data = false, bool omit_addr = false)                            { EncodePointerConverted<format::SizeTEncodeType>(ptr, omit_data, omit_addr); }
-    void EncodeHandleIdPtr(const format::HandleId* ptr, bool omit_data = false, bool omit_addr = false)               { EncodePointerConverted<format::HandleEncodeType>(ptr, omit_data, omit_addr); }
+    void EncodeHandleIdPtr(const format::HandleId* ptr, bool omit_data = false, bool omit_addr = false)               { EncodeHandleIdPointer(ptr, omit_data, omit_addr); }
 
     // Treat pointers to non-Vulkan objects as 64-bit object IDs.
     template<typename T>
@@ -126,7 +136,7 @@ class ParameterEncoder
     void EncodeUInt64Array(const uint64_t* arr, size_t len, bool omit_data = false, bool omit_addr = false)           { EncodeArray(arr, len, omit_data, omit_addr); }
     void EncodeFloatArray(const float* arr, size_t len, bool omit_data = false, bool omit_addr = false)               { EncodeArray(arr, len, omit_data, omit_addr); }
     void EncodeSizeTArray(const size_t* arr, size_t len, bool omit_data = false, bool omit_addr = false)              { EncodeArrayConverted<format::SizeTEncodeType>(arr, len, omit_data, omit_addr); }
-    void EncodeHandleIdArray(const format::HandleId* arr, size_t len, bool omit_data = false, bool omit_addr = false) { EncodeArrayConverted<format::HandleEncodeType>(arr, len, omit_data, omit_addr); }
+    void EncodeHandleIdArray(const format::HandleId* arr, size_t len, bool omit_data = false, bool omit_addr = false) { EncodeHandleIdArrayValues(arr, len, omit_data, omit_addr); }
 
     // Array of bytes.
     void EncodeUInt8Array(const void* arr, size_t len, bool omit_data = false, bool omit_addr = false)                { EncodeArray(reinterpret_cast<const uint8_t*>(arr), len, omit_data, omit_addr); }
@@ -172,7 +182,7 @@ class ParameterEncoder
         uint32_t pointer_attrib = format::PointerAttributes::kIsStruct | format::PointerAttributes::kIsSingle |
                                   GetPointerAttributeMask(ptr, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        EncodeValue(pointer_attrib);
 
         if ((pointer_attrib & format::PointerAttributes::kHasAddress) == format::PointerAttributes::kHasAddress)
         {
@@ -185,7 +195,7 @@ class ParameterEncoder
         uint32_t pointer_attrib = format::PointerAttributes::kIsStruct | format::PointerAttributes::kIsArray |
                                   GetPointerAttributeMask(arr, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        EncodeValue(pointer_attrib);
 
         if (arr != nullptr)
         {
@@ -204,7 +214,7 @@ class ParameterEncoder
         uint32_t pointer_attrib = format::PointerAttributes::kIsStruct | format::PointerAttributes::kIsArray2D |
                                   GetPointerAttributeMask(arr, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        EncodeValue(pointer_attrib);
 
         if (arr != nullptr)
         {
@@ -242,7 +252,7 @@ class ParameterEncoder
         uint32_t pointer_attrib =
             format::PointerAttributes::kIsSingle | GetPointerAttributeMask(ptr, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        EncodeValue(pointer_attrib);
 
         if (ptr != nullptr)
         {
@@ -253,7 +263,8 @@ class ParameterEncoder
 
             if ((pointer_attrib & format::PointerAttributes::kHasData) == format::PointerAttributes::kHasData)
             {
-                EncodeObjectValue<T>(*ptr);
+                format::HandleId previous_id = format::kNullHandleId;
+                EncodeHandleIdElement(GetDx12WrappedId<T>(*ptr), &previous_id);
             }
         }
     }
@@ -270,7 +281,7 @@ class ParameterEncoder
         uint32_t pointer_attrib =
             format::PointerAttributes::kIsArray | GetPointerAttributeMask(arr, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        EncodeValue(pointer_attrib);
 
         if (arr != nullptr)
         {
@@ -284,9 +295,10 @@ class ParameterEncoder
 
             if ((pointer_attrib & format::PointerAttributes::kHasData) == format::PointerAttributes::kHasData)
             {
+                format::HandleId previous_id = format::kNullHandleId;
                 for (size_t i = 0; i < len; ++i)
                 {
-                    EncodeObjectValue<T>(arr[i]);
+                    EncodeHandleIdElement(GetDx12WrappedId<T>(arr[i]), &previous_id);
                 }
             }
         }
@@ -339,17 +351,106 @@ class ParameterEncoder
 
     template <typename T>
     void EncodeValue(T value)
+    {
+        if constexpr (std::is_integral<T>::value && (sizeof(T) > 1))
+        {
+            if (compact_encoding_)
+            {
+                // Signed values are written as their unsigned representation, which decodes to the same value when
+                // it is truncated to a type of the same size with either signedness.
+                EncodeVarint(static_cast<typename std::make_unsigned<T>::type>(value));
+                return;
+            }
+        }
+
+        EncodeFixedValue(value);
+    }
+
+    template <typename T>
+    void EncodeFixedValue(T value)
     {
         output_stream_->Write(&value, sizeof(T));
     }
 
+    void EncodeVarint(uint64_t value)
+    {
+        uint8_t bytes[util::varint::kMaxVarintSize];
+        size_t  size = util::varint::Encode(value, bytes);
+        output_stream_->Write(bytes, size);
+    }
+
+    // With compact encoding, the handle IDs referenced by a pointer are written as the difference from the previous
+    // ID, starting from 0.  Objects used together are often created together, so the differences are small.
+    void EncodeHandleIdElement(format::HandleId value, format::HandleId* previous)
+    {
+        if (compact_encoding_)
+        {
+            EncodeVarint(util::varint::ZigZagEncode(static_cast<int64_t>(value - (*previous))));
+            (*previous) = value;
+        }
+        else
+        {
+            EncodeHandleIdValue(value);
+        }
+    }
+
+    void EncodeHandleIdPointer(const format::HandleId* ptr, bool omit_data, bool omit_addr)
+    {
+        uint32_t pointer_attrib =
+            format::PointerAttributes::kIsSingle | GetPointerAttributeMask(ptr, omit_data, omit_addr);
+
+        EncodeValue(pointer_attrib);
+
+        if (ptr != nullptr)
+        {
+            if ((pointer_attrib & format::PointerAttributes::kHasAddress) == format::PointerAttributes::kHasAddress)
+            {
+                EncodeAddress(ptr);
+            }
+
+            if ((pointer_attrib & format::PointerAttributes::kHasData) == format::PointerAttributes::kHasData)
+            {
+                format::HandleId previous_id = format::kNullHandleId;
+                EncodeHandleIdElement(*ptr, &previous_id);
+            }
+        }
+    }
+
+    void EncodeHandleIdArrayValues(const format::HandleId* arr, size_t len, bool omit_data, bool omit_addr)
+    {
+        uint32_t pointer_attrib =
+            format::PointerAttributes::kIsArray | GetPointerAttributeMask(arr, omit_data, omit_addr);
+
+        EncodeValue(pointer_attrib);
+
+        if (arr != nullptr)
+        {
+            if ((pointer_attrib & format::PointerAttributes::kHasAddress) == format::PointerAttributes::kHasAddress)
+            {
+                EncodeAddress(arr);
+            }
+
+            // Always write the array size when the pointer is not null.
+            EncodeSizeTValue(len);
+
+            if ((pointer_attrib & format::PointerAttributes::kHasData) == format::PointerAttributes::kHasData)
+            {
+                format::HandleId previous_id = format::kNullHandleId;
+                for (size_t i = 0; i < len; ++i)
+                {
+                    EncodeHandleIdElement(arr[i], &previous_id);
+                }
+            }
+        }
+    }
+
     template <typename T>
     void EncodePointer(const T* ptr, bool omit_data = false, bool omit_addr = false)
     {
         uint32_t pointer_attrib =
             format::PointerAttributes::kIsSingle | GetPointerAttributeMask(ptr, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        EncodeValue(pointer_attrib);
 
         if (ptr != nullptr)
         {
@@ -371,7 +472,7 @@ class ParameterEncoder
         uint32_t pointer_attrib =
             format::PointerAttributes::kIsSingle | GetPointerAttributeMask(ptr, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        EncodeValue(pointer_attrib);
 
         if (ptr != nullptr)
         {
@@ -396,7 +497,7 @@ class ParameterEncoder
         uint32_t pointer_attrib =
             format::PointerAttributes::kIsSingle | GetPointerAttributeMask(ptr, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        EncodeValue(pointer_attrib);
 
         if (ptr != nullptr)
         {
@@ -407,7 +508,8 @@ class ParameterEncoder
 
             if ((pointer_attrib & format::PointerAttributes::kHasData) == format::PointerAttributes::kHasData)
             {
-                EncodeVulkanHandleValue<Wrapper>(*ptr);
+                format::HandleId previous_id = format::kNullHandleId;
+                EncodeHandleIdElement(vulkan_wrappers::GetWrappedId<Wrapper>(*ptr), &previous_id);
             }
         }
     }
@@ -418,7 +520,7 @@ class ParameterEncoder
         uint32_t pointer_attrib =
             format::PointerAttributes::kIsArray | GetPointerAttributeMask(arr, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        EncodeValue(pointer_attrib);
 
         if (arr != nullptr)
         {
@@ -446,7 +548,7 @@ class ParameterEncoder
         uint32_t pointer_attrib =
             format::PointerAttributes::kIsArray | GetPointerAttributeMask(arr, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        EncodeValue(pointer_attrib);
 
         if (arr != nullptr)
         {
@@ -487,7 +589,7 @@ class ParameterEncoder
         uint32_t pointer_attrib =
             format::PointerAttributes::kIsArray | GetPointerAttributeMask(arr, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        EncodeValue(pointer_attrib);
 
         if (arr != nullptr)
         {
@@ -501,9 +603,10 @@ class ParameterEncoder
 
             if ((pointer_attrib & format::PointerAttributes::kHasData) == format::PointerAttributes::kHasData)
             {
+                format::HandleId previous_id = format::kNullHandleId;
                 for (size_t i = 0; i < len; ++i)
                 {
-                    EncodeVulkanHandleValue<Wrapper>(arr[i]);
+                    EncodeHandleIdElement(vulkan_wrappers::GetWrappedId<Wrapper>(arr[i]), &previous_id);
                 }
             }
         }
@@ -516,7 +619,7 @@ class ParameterEncoder
         // Outer pointer attributes
         uint32_t pointer_attrib =
             format::PointerAttributes::kIsArray2D | GetPointerAttributeMask(arr, omit_data, omit_addr);
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        EncodeValue(pointer_attrib);
 
         if (arr != nullptr)
         {
@@ -537,7 +640,7 @@ class ParameterEncoder
                     // Inner pointer attributes
                     uint32_t inner_pointer_attrib =
                         format::PointerAttributes::kIsArray | GetPointerAttributeMask(arr[i], omit_data, omit_addr);
-                    output_stream_->Write(&inner_pointer_attrib, sizeof(inner_pointer_attrib));
+                    EncodeValue(inner_pointer_attrib);
 
                     // Inner array address
                     if ((inner_pointer_attrib & format::PointerAttributes::kHasAddress) ==
@@ -601,7 +704,7 @@ class ParameterEncoder
         uint32_t pointer_attrib =
             EncodeAttrib | format::PointerAttributes::kIsSingle | GetPointerAttributeMask(str, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        EncodeValue(pointer_attrib);
 
         if (str != nullptr)
         {
@@ -628,7 +731,7 @@ class ParameterEncoder
         uint32_t pointer_attrib =
             EncodeAttrib | format::PointerAttributes::kIsArray | GetPointerAttributeMask(str, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        EncodeValue(pointer_attrib);
 
         if (str != nullptr)
         {
@@ -652,6 +755,7 @@ class ParameterEncoder
 
   private:
     util::OutputStream* output_stream_;
+    bool                compact_encoding_;
 };
 
 GFXRECON_END_NAMESPACE(encode)
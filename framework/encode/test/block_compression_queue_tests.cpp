@@ -0,0 +1,399 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "encode/block_compression_queue.h"
+#include "format/format.h"
+#include "format/format_util.h"
+#include "util/compressor.h"
+#include "util/output_stream.h"
+#include "util/platform.h"
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace gfxrecon;
+
+namespace
+{
+
+const uint8_t  kFillValue       = 0xcd;
+const uint64_t kDirectWriteMark = 0xffffffffffffffffull;
+
+// Time that a thread is given to return when it is expected to be waiting.
+const std::chrono::milliseconds kWaitCheckTime(50);
+
+class MemoryOutputStream : public util::OutputStream
+{
+  public:
+    virtual bool IsValid() override { return true; }
+
+    virtual bool Write(const void* data, size_t len) override
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto                        bytes = reinterpret_cast<const uint8_t*>(data);
+        data_.insert(data_.end(), bytes, bytes + len);
+        return true;
+    }
+
+    virtual void Flush() override { ++flush_count_; }
+
+    std::vector<uint8_t> GetData()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return data_;
+    }
+
+    uint32_t GetFlushCount() const { return flush_count_; }
+
+  private:
+    std::mutex            mutex_;
+    std::vector<uint8_t>  data_;
+    std::atomic<uint32_t> flush_count_{ 0 };
+};
+
+// Blocks the threads that call Wait() until Open() is called.
+class Gate
+{
+  public:
+    void Wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        opened_.wait(lock, [this]() { return open_; });
+    }
+
+    void Open()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            open_ = true;
+        }
+        opened_.notify_all();
+    }
+
+  private:
+    std::mutex              mutex_;
+    std::condition_variable opened_;
+    bool                    open_{ false };
+};
+
+// Compresses block payloads that are a sequence number followed by fill bytes to the sequence number and the payload
+// size.  Compression takes longer for some blocks, so that blocks complete compression out of order.
+class TestCompressor : public util::Compressor
+{
+  public:
+    TestCompressor(Gate* gate = nullptr) : gate_(gate) {}
+
+    virtual size_t Compress(const size_t          uncompressed_size,
+                            const uint8_t*        uncompressed_data,
+                            std::vector<uint8_t>* compressed_data,
+                            size_t                compressed_data_offset) override
+    {
+        uint64_t sequence = 0;
+        uint64_t size     = uncompressed_size;
+        util::platform::MemoryCopy(&sequence, sizeof(sequence), uncompressed_data, sizeof(sequence));
+
+        if (gate_ != nullptr)
+        {
+            gate_->Wait();
+        }
+        else if ((sequence % 7) == 0)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+
+        compressed_data->resize(compressed_data_offset + sizeof(sequence) + sizeof(size));
+        util::platform::MemoryCopy(
+            compressed_data->data() + compressed_data_offset, sizeof(sequence), &sequence, sizeof(sequence));
+        util::platform::MemoryCopy(compressed_data->data() + compressed_data_offset + sizeof(sequence),
+                                   sizeof(size),
+                                   &size,
+                                   sizeof(size));
+
+        return sizeof(sequence) + sizeof(size);
+    }
+
+    virtual size_t Decompress(const size_t   compressed_size,
+                              const uint8_t* compressed_data,
+                              const size_t   expected_uncompressed_size,
+                              uint8_t*       uncompressed_data) override
+    {
+        return 0;
+    }
+
+  private:
+    Gate* gate_;
+};
+
+std::vector<uint8_t> MakePayload(uint64_t sequence, size_t size)
+{
+    std::vector<uint8_t> payload(size, kFillValue);
+    util::platform::MemoryCopy(payload.data(), size, &sequence, sizeof(sequence));
+    return payload;
+}
+
+void WriteBlock(encode::BlockCompressionQueue* queue, uint64_t sequence, size_t payload_size)
+{
+    std::vector<uint8_t> block(sizeof(format::BlockHeader));
+    std::vector<uint8_t> payload = MakePayload(sequence, payload_size);
+    format::BlockHeader  header  = { payload_size, format::BlockType::kFunctionCallBlock };
+
+    util::platform::MemoryCopy(block.data(), block.size(), &header, sizeof(header));
+    block.insert(block.end(), payload.begin(), payload.end());
+
+    queue->Write(block.data(), block.size());
+}
+
+void WriteCompressibleBlock(encode::BlockCompressionQueue* queue,
+                            util::Compressor*              compressor,
+                            uint64_t                       sequence,
+                            size_t                         payload_size)
+{
+    std::vector<uint8_t> payload           = MakePayload(sequence, payload_size);
+    format::BlockHeader  header            = { payload_size, format::BlockType::kFunctionCallBlock };
+    format::BlockHeader  compressed_header = { 0, format::BlockType::kCompressedFunctionCallBlock };
+
+    queue->WriteCompressible(compressor,
+                             &header,
+                             sizeof(header),
+                             &compressed_header,
+                             sizeof(compressed_header),
+                             payload.data(),
+                             payload.size());
+}
+
+// Returns the sequence numbers of the blocks in the stream, checking that the block data is intact.
+std::vector<uint64_t> ParseBlocks(const std::vector<uint8_t>& data, size_t* compressed_count)
+{
+    std::vector<uint64_t> sequences;
+    size_t                offset = 0;
+
+    *compressed_count = 0;
+
+    while (offset < data.size())
+    {
+        format::BlockHeader header;
+        REQUIRE((data.size() - offset) >= sizeof(header));
+        util::platform::MemoryCopy(&header, sizeof(header), data.data() + offset, sizeof(header));
+        offset += sizeof(header);
+
+        REQUIRE((data.size() - offset) >= header.size);
+        REQUIRE(header.size >= sizeof(uint64_t));
+
+        uint64_t sequence = 0;
+        util::platform::MemoryCopy(&sequence, sizeof(sequence), data.data() + offset, sizeof(sequence));
+        sequences.push_back(sequence);
+
+        if (format::IsBlockCompressed(header.type))
+        {
+            REQUIRE(header.size == (2 * sizeof(uint64_t)));
+            ++(*compressed_count);
+        }
+        else
+        {
+            for (uint64_t i = sizeof(sequence); i < header.size; ++i)
+            {
+                REQUIRE(data[offset + i] == kFillValue);
+            }
+        }
+
+        offset += header.size;
+    }
+
+    return sequences;
+}
+
+} // namespace
+
+TEST_CASE("BlockCompressionQueue writes blocks from several threads in queue order",
+          "[block_compression_queue][pre_submit]")
+{
+    const uint32_t kThreadCount     = 4;
+    const uint32_t kBlocksPerThread = 200;
+
+    MemoryOutputStream stream;
+    TestCompressor     compressor;
+    std::mutex         sequence_mutex;
+    uint64_t           next_sequence = 0;
+
+    {
+        encode::BlockCompressionQueue queue(&stream, 3, 16 * 1024);
+        std::vector<std::thread>      threads;
+
+        for (uint32_t i = 0; i < kThreadCount; ++i)
+        {
+            threads.emplace_back([&, i]() {
+                for (uint32_t j = 0; j < kBlocksPerThread; ++j)
+                {
+                    // Blocks are queued in sequence order, while compression completes out of order.
+                    std::lock_guard<std::mutex> lock(sequence_mutex);
+                    size_t                      payload_size = 64 + ((i * 97 + j * 31) % 1024);
+
+                    if (((i + j) % 3) == 0)
+                    {
+                        WriteBlock(&queue, next_sequence++, payload_size);
+                    }
+                    else
+                    {
+                        WriteCompressibleBlock(&queue, &compressor, next_sequence++, payload_size);
+                    }
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        queue.Flush();
+        CHECK(stream.GetFlushCount() == 1);
+    }
+
+    size_t                compressed_count = 0;
+    std::vector<uint64_t> sequences        = ParseBlocks(stream.GetData(), &compressed_count);
+
+    REQUIRE(sequences.size() == (kThreadCount * kBlocksPerThread));
+    for (uint64_t i = 0; i < sequences.size(); ++i)
+    {
+        REQUIRE(sequences[i] == i);
+    }
+
+    CHECK(compressed_count > 0);
+    CHECK(compressed_count < sequences.size());
+}
+
+TEST_CASE("BlockCompressionQueue writes uncompressed data when compression does not reduce the size",
+          "[block_compression_queue][pre_submit]")
+{
+    MemoryOutputStream stream;
+    TestCompressor     compressor;
+
+    {
+        encode::BlockCompressionQueue queue(&stream, 1, 16 * 1024);
+
+        // The compressed representation is 16 bytes, which is not smaller than these payloads.
+        WriteCompressibleBlock(&queue, &compressor, 0, 8);
+        WriteCompressibleBlock(&queue, &compressor, 1, 16);
+        WriteCompressibleBlock(&queue, &compressor, 2, 17);
+        queue.Flush();
+    }
+
+    size_t                compressed_count = 0;
+    std::vector<uint64_t> sequences        = ParseBlocks(stream.GetData(), &compressed_count);
+
+    CHECK(sequences == std::vector<uint64_t>{ 0, 1, 2 });
+    CHECK(compressed_count == 1);
+}
+
+TEST_CASE("BlockCompressionQueue waits for space when the queue is full", "[block_compression_queue][pre_submit]")
+{
+    MemoryOutputStream stream;
+    Gate               gate;
+    TestCompressor     compressor(&gate);
+    std::atomic<bool>  queued{ false };
+
+    {
+        encode::BlockCompressionQueue queue(&stream, 1, 1024);
+
+        // The block exceeds the queue size limit and cannot be written until its compression completes.
+        WriteCompressibleBlock(&queue, &compressor, 0, 2048);
+
+        std::thread writer([&]() {
+            WriteBlock(&queue, 1, 64);
+            queued = true;
+        });
+
+        std::this_thread::sleep_for(kWaitCheckTime);
+        CHECK_FALSE(queued);
+        CHECK(stream.GetData().empty());
+
+        gate.Open();
+        writer.join();
+
+        CHECK(queued);
+        queue.Flush();
+    }
+
+    size_t                compressed_count = 0;
+    std::vector<uint64_t> sequences        = ParseBlocks(stream.GetData(), &compressed_count);
+
+    CHECK(sequences == std::vector<uint64_t>{ 0, 1 });
+    CHECK(compressed_count == 1);
+}
+
+TEST_CASE("BlockCompressionQueue Flush writes queued blocks before direct stream writes",
+          "[block_compression_queue][pre_submit]")
+{
+    const uint64_t kBlockCount = 16;
+
+    MemoryOutputStream stream;
+    Gate               gate;
+    TestCompressor     compressor(&gate);
+    std::atomic<bool>  flushed{ false };
+
+    {
+        encode::BlockCompressionQueue queue(&stream, 2, 1024 * 1024);
+
+        for (uint64_t i = 0; i < kBlockCount; ++i)
+        {
+            WriteCompressibleBlock(&queue, &compressor, i, 256);
+        }
+
+        // The state writer flushes the queue, then writes to the stream directly.
+        std::thread state_writer([&]() {
+            queue.Flush();
+            flushed = true;
+
+            format::BlockHeader header  = { sizeof(kDirectWriteMark), format::BlockType::kFunctionCallBlock };
+            uint64_t            payload = kDirectWriteMark;
+            stream.Write(&header, sizeof(header));
+            stream.Write(&payload, sizeof(payload));
+        });
+
+        std::this_thread::sleep_for(kWaitCheckTime);
+        CHECK_FALSE(flushed);
+
+        gate.Open();
+        state_writer.join();
+
+        CHECK(stream.GetFlushCount() == 1);
+    }
+
+    size_t                compressed_count = 0;
+    std::vector<uint64_t> sequences        = ParseBlocks(stream.GetData(), &compressed_count);
+
+    REQUIRE(sequences.size() == (kBlockCount + 1));
+    for (uint64_t i = 0; i < kBlockCount; ++i)
+    {
+        CHECK(sequences[i] == i);
+    }
+
+    CHECK(sequences.back() == kDirectWriteMark);
+    CHECK(compressed_count == kBlockCount);
+}
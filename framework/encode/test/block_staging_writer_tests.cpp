@@ -0,0 +1,504 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "encode/block_compression_queue.h"
+#include "encode/block_staging_writer.h"
+#include "format/format.h"
+#include "format/format_util.h"
+#include "util/compressor.h"
+#include "util/output_stream.h"
+#include "util/platform.h"
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace gfxrecon;
+
+namespace
+{
+
+const uint8_t  kFillValue       = 0xcd;
+const uint64_t kDirectWriteMark = 0xffffffffffffffffull;
+
+// Time that a thread is given to return when it is expected to be waiting.
+const std::chrono::milliseconds kWaitCheckTime(50);
+
+// Blocks the threads that call Wait() until Open() is called.
+class Gate
+{
+  public:
+    void Wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        opened_.wait(lock, [this]() { return open_; });
+    }
+
+    void Open()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            open_ = true;
+        }
+        opened_.notify_all();
+    }
+
+  private:
+    std::mutex              mutex_;
+    std::condition_variable opened_;
+    bool                    open_{ false };
+};
+
+// Stream that stores the written data.  When a gate is specified, writes wait for the gate to open.
+class MemoryOutputStream : public util::OutputStream
+{
+  public:
+    MemoryOutputStream(Gate* gate = nullptr) : gate_(gate) {}
+
+    virtual bool IsValid() override { return true; }
+
+    virtual bool Write(const void* data, size_t len) override
+    {
+        if (gate_ != nullptr)
+        {
+            gate_->Wait();
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto                        bytes = reinterpret_cast<const uint8_t*>(data);
+        data_.insert(data_.end(), bytes, bytes + len);
+        return true;
+    }
+
+    virtual void Flush() override { ++flush_count_; }
+
+    std::vector<uint8_t> GetData()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return data_;
+    }
+
+    uint32_t GetFlushCount() const { return flush_count_; }
+
+  private:
+    Gate*                 gate_;
+    std::mutex            mutex_;
+    std::vector<uint8_t>  data_;
+    std::atomic<uint32_t> flush_count_{ 0 };
+};
+
+// Compresses block payloads that are a sequence number followed by fill bytes to the sequence number and the payload
+// size.  Compression takes longer for some blocks, so that blocks complete compression out of order.
+class TestCompressor : public util::Compressor
+{
+  public:
+    TestCompressor(Gate* gate = nullptr) : gate_(gate) {}
+
+    virtual size_t Compress(const size_t          uncompressed_size,
+                            const uint8_t*        uncompressed_data,
+                            std::vector<uint8_t>* compressed_data,
+                            size_t                compressed_data_offset) override
+    {
+        uint64_t sequence = 0;
+        uint64_t size     = uncompressed_size;
+        util::platform::MemoryCopy(&sequence, sizeof(sequence), uncompressed_data, sizeof(sequence));
+
+        if (gate_ != nullptr)
+        {
+            gate_->Wait();
+        }
+        else if ((sequence % 7) == 0)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+
+        compressed_data->resize(compressed_data_offset + sizeof(sequence) + sizeof(size));
+        util::platform::MemoryCopy(
+            compressed_data->data() + compressed_data_offset, sizeof(sequence), &sequence, sizeof(sequence));
+        util::platform::MemoryCopy(compressed_data->data() + compressed_data_offset + sizeof(sequence),
+                                   sizeof(size),
+                                   &size,
+                                   sizeof(size));
+
+        return sizeof(sequence) + sizeof(size);
+    }
+
+    virtual size_t Decompress(const size_t   compressed_size,
+                              const uint8_t* compressed_data,
+                              const size_t   expected_uncompressed_size,
+                              uint8_t*       uncompressed_data) override
+    {
+        return 0;
+    }
+
+  private:
+    Gate* gate_;
+};
+
+std::vector<uint8_t> MakePayload(uint64_t sequence, size_t size)
+{
+    std::vector<uint8_t> payload(size, kFillValue);
+    util::platform::MemoryCopy(payload.data(), size, &sequence, sizeof(sequence));
+    return payload;
+}
+
+void WriteBlock(encode::BlockStagingWriter* writer,
+                encode::BlockStagingBuffer* buffer,
+                uint64_t                    sequence,
+                size_t                      payload_size)
+{
+    std::vector<uint8_t> block(sizeof(format::BlockHeader));
+    std::vector<uint8_t> payload = MakePayload(sequence, payload_size);
+    format::BlockHeader  header  = { payload_size, format::BlockType::kFunctionCallBlock };
+
+    util::platform::MemoryCopy(block.data(), block.size(), &header, sizeof(header));
+    block.insert(block.end(), payload.begin(), payload.end());
+
+    writer->Write(buffer, block.data(), block.size());
+}
+
+void WriteCompressibleBlock(encode::BlockStagingWriter* writer,
+                            encode::BlockStagingBuffer* buffer,
+                            util::Compressor*           compressor,
+                            uint64_t                    sequence,
+                            size_t                      payload_size)
+{
+    std::vector<uint8_t> payload           = MakePayload(sequence, payload_size);
+    format::BlockHeader  header            = { payload_size, format::BlockType::kFunctionCallBlock };
+    format::BlockHeader  compressed_header = { 0, format::BlockType::kCompressedFunctionCallBlock };
+
+    writer->WriteCompressible(buffer,
+                              compressor,
+                              &header,
+                              sizeof(header),
+                              &compressed_header,
+                              sizeof(compressed_header),
+                              payload.data(),
+                              payload.size());
+}
+
+// Returns the sequence numbers of the blocks in the stream, checking that the block data is intact.
+std::vector<uint64_t> ParseBlocks(const std::vector<uint8_t>& data, size_t* compressed_count)
+{
+    std::vector<uint64_t> sequences;
+    size_t                offset = 0;
+
+    *compressed_count = 0;
+
+    while (offset < data.size())
+    {
+        format::BlockHeader header;
+        REQUIRE((data.size() - offset) >= sizeof(header));
+        util::platform::MemoryCopy(&header, sizeof(header), data.data() + offset, sizeof(header));
+        offset += sizeof(header);
+
+        REQUIRE((data.size() - offset) >= header.size);
+        REQUIRE(header.size >= sizeof(uint64_t));
+
+        uint64_t sequence = 0;
+        util::platform::MemoryCopy(&sequence, sizeof(sequence), data.data() + offset, sizeof(sequence));
+        sequences.push_back(sequence);
+
+        if (format::IsBlockCompressed(header.type))
+        {
+            REQUIRE(header.size == (2 * sizeof(uint64_t)));
+            ++(*compressed_count);
+        }
+        else
+        {
+            for (uint64_t i = sizeof(sequence); i < header.size; ++i)
+            {
+                REQUIRE(data[offset + i] == kFillValue);
+            }
+        }
+
+        offset += header.size;
+    }
+
+    return sequences;
+}
+
+} // namespace
+
+TEST_CASE("BlockStagingWriter writes blocks from several threads in staging order",
+          "[block_staging_writer][pre_submit]")
+{
+    const uint32_t kThreadCount     = 4;
+    const uint32_t kBlocksPerThread = 500;
+
+    // Blocks larger than a quarter of the staging buffer are stored in separate allocations.
+    const size_t kBufferSize     = 64 * 1024;
+    const size_t kLargeBlockSize = kBufferSize / 2;
+
+    const bool allocate_when_full = GENERATE(false, true);
+
+    MemoryOutputStream stream;
+    std::mutex         sequence_mutex;
+    uint64_t           next_sequence = 0;
+
+    {
+        encode::BlockStagingWriter writer(kBufferSize, allocate_when_full);
+        std::vector<std::thread>   threads;
+
+        writer.SetOutput(&stream, nullptr);
+
+        for (uint32_t i = 0; i < kThreadCount; ++i)
+        {
+            threads.emplace_back([&, i]() {
+                std::shared_ptr<encode::BlockStagingBuffer> buffer = writer.CreateBuffer();
+
+                for (uint32_t j = 0; j < kBlocksPerThread; ++j)
+                {
+                    // Each block is staged while holding the lock, so that the staging order is the sequence order.
+                    // The blocks wrap around the end of each staging buffer several times.
+                    std::lock_guard<std::mutex> lock(sequence_mutex);
+                    size_t payload_size = ((j % 100) == 0) ? kLargeBlockSize : (8 + ((i * 97 + j * 31) % 2048));
+
+                    WriteBlock(&writer, buffer.get(), next_sequence++, payload_size);
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        writer.Flush();
+        CHECK(stream.GetFlushCount() == 1);
+    }
+
+    size_t                compressed_count = 0;
+    std::vector<uint64_t> sequences        = ParseBlocks(stream.GetData(), &compressed_count);
+
+    REQUIRE(sequences.size() == (kThreadCount * kBlocksPerThread));
+    for (uint64_t i = 0; i < sequences.size(); ++i)
+    {
+        REQUIRE(sequences[i] == i);
+    }
+}
+
+TEST_CASE("BlockStagingWriter writes staged blocks to a compression queue", "[block_staging_writer][pre_submit]")
+{
+    const uint32_t kThreadCount     = 3;
+    const uint32_t kBlocksPerThread = 200;
+
+    MemoryOutputStream stream;
+    TestCompressor     compressor;
+    std::mutex         sequence_mutex;
+    uint64_t           next_sequence = 0;
+
+    {
+        encode::BlockCompressionQueue queue(&stream, 2, 64 * 1024);
+        encode::BlockStagingWriter    writer(64 * 1024, false);
+        std::vector<std::thread>      threads;
+
+        writer.SetOutput(&stream, &queue);
+
+        for (uint32_t i = 0; i < kThreadCount; ++i)
+        {
+            threads.emplace_back([&, i]() {
+                std::shared_ptr<encode::BlockStagingBuffer> buffer = writer.CreateBuffer();
+
+                for (uint32_t j = 0; j < kBlocksPerThread; ++j)
+                {
+                    std::lock_guard<std::mutex> lock(sequence_mutex);
+                    size_t                      payload_size = 64 + ((i * 97 + j * 31) % 1024);
+
+                    if ((j % 2) == 0)
+                    {
+                        WriteBlock(&writer, buffer.get(), next_sequence++, payload_size);
+                    }
+                    else
+                    {
+                        WriteCompressibleBlock(&writer, buffer.get(), &compressor, next_sequence++, payload_size);
+                    }
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        // Flushing the writer also flushes the compression queue.
+        writer.Flush();
+        CHECK(stream.GetFlushCount() == 1);
+    }
+
+    size_t                compressed_count = 0;
+    std::vector<uint64_t> sequences        = ParseBlocks(stream.GetData(), &compressed_count);
+
+    REQUIRE(sequences.size() == (kThreadCount * kBlocksPerThread));
+    for (uint64_t i = 0; i < sequences.size(); ++i)
+    {
+        REQUIRE(sequences[i] == i);
+    }
+
+    CHECK(compressed_count == (sequences.size() / 2));
+}
+
+TEST_CASE("BlockStagingWriter waits or allocates when a staging buffer is full", "[block_staging_writer][pre_submit]")
+{
+    // The staged blocks are several times the size of the staging buffer.  When blocks are allocated, only their record
+    // headers are stored in the staging buffer, and the headers of all of the blocks fit in the space that remains.
+    const size_t   kBufferSize  = 64 * 1024;
+    const uint64_t kBlockCount  = 64;
+    const size_t   kPayloadSize = 8 * 1024;
+
+    const bool allocate_when_full = GENERATE(false, true);
+
+    Gate                  gate;
+    MemoryOutputStream    stream(&gate);
+    std::atomic<uint64_t> staged_count{ 0 };
+
+    {
+        encode::BlockStagingWriter writer(kBufferSize, allocate_when_full);
+        writer.SetOutput(&stream, nullptr);
+
+        // The writer thread is blocked by the stream, so the producer fills its staging buffer.
+        std::thread producer([&]() {
+            std::shared_ptr<encode::BlockStagingBuffer> buffer = writer.CreateBuffer();
+
+            for (uint64_t i = 0; i < kBlockCount; ++i)
+            {
+                WriteBlock(&writer, buffer.get(), i, kPayloadSize);
+                ++staged_count;
+            }
+        });
+
+        std::this_thread::sleep_for(kWaitCheckTime);
+
+        if (allocate_when_full)
+        {
+            // Blocks that do not fit in the staging buffer were copied to separate allocations.
+            producer.join();
+            CHECK(staged_count == kBlockCount);
+        }
+        else
+        {
+            // The producer waits for the writer thread to make space in the staging buffer.
+            CHECK(staged_count < kBlockCount);
+            CHECK(staged_count <= (kBufferSize / kPayloadSize));
+        }
+
+        CHECK(stream.GetData().empty());
+
+        gate.Open();
+
+        if (producer.joinable())
+        {
+            producer.join();
+        }
+
+        CHECK(staged_count == kBlockCount);
+        writer.Flush();
+    }
+
+    size_t                compressed_count = 0;
+    std::vector<uint64_t> sequences        = ParseBlocks(stream.GetData(), &compressed_count);
+
+    REQUIRE(sequences.size() == kBlockCount);
+    for (uint64_t i = 0; i < sequences.size(); ++i)
+    {
+        REQUIRE(sequences[i] == i);
+    }
+}
+
+TEST_CASE("BlockStagingWriter Flush writes staged blocks before direct stream writes",
+          "[block_staging_writer][pre_submit]")
+{
+    const uint64_t kBlockCount = 64;
+
+    const bool use_compression_queue = GENERATE(false, true);
+
+    Gate               gate;
+    MemoryOutputStream stream(&gate);
+    TestCompressor     compressor;
+    std::atomic<bool>  flushed{ false };
+
+    {
+        std::unique_ptr<encode::BlockCompressionQueue> queue;
+        encode::BlockStagingWriter                     writer(64 * 1024, false);
+
+        if (use_compression_queue)
+        {
+            queue = std::make_unique<encode::BlockCompressionQueue>(&stream, 2, 1024 * 1024);
+        }
+
+        writer.SetOutput(&stream, queue.get());
+
+        std::shared_ptr<encode::BlockStagingBuffer> buffer = writer.CreateBuffer();
+        for (uint64_t i = 0; i < kBlockCount; ++i)
+        {
+            if (use_compression_queue)
+            {
+                WriteCompressibleBlock(&writer, buffer.get(), &compressor, i, 256);
+            }
+            else
+            {
+                WriteBlock(&writer, buffer.get(), i, 256);
+            }
+        }
+
+        // The state writer flushes the staging writer, then writes to the stream directly.
+        std::thread state_writer([&]() {
+            writer.Flush();
+            flushed = true;
+
+            format::BlockHeader header  = { sizeof(kDirectWriteMark), format::BlockType::kFunctionCallBlock };
+            uint64_t            payload = kDirectWriteMark;
+            stream.Write(&header, sizeof(header));
+            stream.Write(&payload, sizeof(payload));
+        });
+
+        std::this_thread::sleep_for(kWaitCheckTime);
+        CHECK_FALSE(flushed);
+
+        gate.Open();
+        state_writer.join();
+
+        CHECK(stream.GetFlushCount() == 1);
+
+        writer.SetOutput(nullptr, nullptr);
+    }
+
+    size_t                compressed_count = 0;
+    std::vector<uint64_t> sequences        = ParseBlocks(stream.GetData(), &compressed_count);
+
+    REQUIRE(sequences.size() == (kBlockCount + 1));
+    for (uint64_t i = 0; i < kBlockCount; ++i)
+    {
+        CHECK(sequences[i] == i);
+    }
+
+    CHECK(sequences.back() == kDirectWriteMark);
+    CHECK(compressed_count == (use_compression_queue ? kBlockCount : 0));
+}
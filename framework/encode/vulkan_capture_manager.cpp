@@ -100,7 +100,8 @@ void VulkanCaptureManager::DestroyInstance()
 
 void VulkanCaptureManager::WriteTrackedState(util::FileOutputStream* file_stream, format::ThreadId thread_id)
 {
-    VulkanStateWriter state_writer(file_stream, GetCompressor(), thread_id);
+    VulkanStateWriter state_writer(
+        file_stream, GetCompressor(), GetCompressionThreadCount(), thread_id, GetCompactEncoding());
     uint64_t          n_blocks = state_tracker_->WriteState(&state_writer, GetCurrentFrame());
     common_manager_->IncrementBlockIndex(n_blocks);
 }
@@ -1781,9 +1782,7 @@ void VulkanCaptureManager::ProcessReferenceToAndroidHardwareBuffer(VkDevice devi
                     WriteFillMemoryCmd(memory_id, 0, ahb_size, data);
 
                     // Track the memory with the PageGuardManager
-                    if ((GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kPageGuard ||
-                         GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kUserfaultfd) &&
-                        GetPageGuardTrackAhbMemory())
+                    if (UsesPageGuardManager() && GetPageGuardTrackAhbMemory())
                     {
                         GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, ahb_size);
 
@@ -1886,8 +1885,7 @@ void VulkanCaptureManager::ReleaseAndroidHardwareBuffer(AHardwareBuffer* hardwar
     auto entry = hardware_buffers_.find(hardware_buffer);
     if ((entry != hardware_buffers_.end()) && (--entry->second.reference_count == 0))
     {
-        if (GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kPageGuard ||
-            GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kUserfaultfd)
+        if (UsesPageGuardManager())
         {
             util::PageGuardManager* manager = util::PageGuardManager::Get();
             assert(manager != nullptr);
@@ -2059,8 +2057,7 @@ void VulkanCaptureManager::PostProcess_vkMapMemory(VkResult         result,
                 wrapper->mapped_size   = size;
             }
 
-            if (GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kPageGuard ||
-                GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kUserfaultfd
+            if (UsesPageGuardManager()
 #if defined(VK_USE_PLATFORM_ANDROID_KHR)
                     // Hardware buffer memory is tracked separately, so VkDeviceMemory mappings should be ignored to
                     // avoid duplicate memory tracking entries.
@@ -2122,8 +2119,7 @@ void VulkanCaptureManager::PostProcess_vkMapMemory(VkResult         result,
             GFXRECON_LOG_WARNING("VkDeviceMemory object with handle = %" PRIx64 " has been mapped more than once",
                                  memory);
 
-            if (GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kPageGuard ||
-                GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kUserfaultfd)
+            if (UsesPageGuardManager())
             {
                 assert((wrapper->mapped_offset == offset) && (wrapper->mapped_size == size));
 
@@ -2149,8 +2145,7 @@ void VulkanCaptureManager::PreProcess_vkFlushMappedMemoryRanges(VkDevice
 
     if (pMemoryRanges != nullptr)
     {
-        if (GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kPageGuard ||
-            GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kUserfaultfd)
+        if (UsesPageGuardManager())
         {
             const vulkan_wrappers::DeviceMemoryWrapper* current_memory_wrapper = nullptr;
             util::PageGuardManager*                     manager                = util::PageGuardManager::Get();
@@ -2221,8 +2216,7 @@ void VulkanCaptureManager::PreProcess_vkUnmapMemory(VkDevice device, VkDeviceMem
 
     if (wrapper->mapped_data != nullptr)
     {
-        if (GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kPageGuard ||
-            GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kUserfaultfd)
+        if (UsesPageGuardManager())
         {
             util::PageGuardManager* manager = util::PageGuardManager::Get();
             assert(manager != nullptr);
@@ -2287,8 +2281,7 @@ void VulkanCaptureManager::PreProcess_vkFreeMemory(VkDevice
 
         if (wrapper->mapped_data != nullptr)
         {
-            if (GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kPageGuard ||
-                GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kUserfaultfd)
+            if (UsesPageGuardManager())
             {
                 util::PageGuardManager* manager = util::PageGuardManager::Get();
                 assert(manager != nullptr);
@@ -2317,8 +2310,7 @@ void VulkanCaptureManager::PostProcess_vkFreeMemory(VkDevice
         // Destroy external resources.
         auto wrapper = vulkan_wrappers::GetWrapper<vulkan_wrappers::DeviceMemoryWrapper>(memory);
 
-        if (GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kPageGuard ||
-            GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kUserfaultfd)
+        if (UsesPageGuardManager())
         {
             util::PageGuardManager* manager = util::PageGuardManager::Get();
             assert(manager != nullptr);
@@ -2497,8 +2489,7 @@ void VulkanCaptureManager::PreProcess_vkQueueSubmit2(
 
 void VulkanCaptureManager::QueueSubmitWriteFillMemoryCmd()
 {
-    if (GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kPageGuard ||
-        GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kUserfaultfd)
+    if (UsesPageGuardManager())
     {
         util::PageGuardManager* manager = util::PageGuardManager::Get();
         assert(manager != nullptr);
@@ -2738,9 +2729,7 @@ void VulkanCaptureManager::OverrideGetPhysicalDeviceSurfacePresentModesKHR(uint3
 
 bool VulkanCaptureManager::CheckBindAlignment(VkDeviceSize memoryOffset)
 {
-    if ((GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kPageGuard ||
-         GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kUserfaultfd) &&
-        !GetPageGuardAlignBufferSizes())
+    if (UsesPageGuardManager() && !GetPageGuardAlignBufferSizes())
     {
         return (memoryOffset % util::platform::GetSystemPageSize()) == 0;
     }
@@ -31,8 +31,10 @@
 #include "generated/generated_vulkan_dispatch_table.h"
 #include "graphics/vulkan_device_util.h"
 #include "util/defines.h"
+#include "util/chunked_buffer.h"
 #include "util/memory_output_stream.h"
 #include "util/page_guard_manager.h"
+#include "util/sorted_vector.h"
 
 #include "vulkan/vulkan.h"
 
@@ -304,14 +306,16 @@ struct CommandBufferWrapper : public HandleWrapper<VkCommandBuffer>
     CommandPoolWrapper* parent_pool{ nullptr };
 
     // Members for trimming state tracking.
-    VkCommandBufferLevel       level{ VK_COMMAND_BUFFER_LEVEL_PRIMARY };
-    util::MemoryOutputStream   command_data;
-    std::set<format::HandleId> command_handles[vulkan_state_info::CommandHandleType::NumHandleTypes];
+    // Command data is stored in chunks from the parent pool's command_data_pool, which are returned to the pool when
+    // the command buffer is reset, so that re-recording the command buffer reuses them.
+    VkCommandBufferLevel                    level{ VK_COMMAND_BUFFER_LEVEL_PRIMARY };
+    util::ChunkedBuffer                     command_data;
+    util::SortedVectorSet<format::HandleId> command_handles[vulkan_state_info::CommandHandleType::NumHandleTypes];
 
     // Image layout info tracked for image barriers recorded to the command buffer. To be updated on calls to
     // vkCmdPipelineBarrier and vkCmdEndRenderPass and applied to the image wrapper on calls to vkQueueSubmit. To be
     // transferred from secondary command buffers to primary command buffers on calls to vkCmdExecuteCommands.
-    std::unordered_map<ImageWrapper*, VkImageLayout> pending_layouts;
+    util::SortedVectorMap<ImageWrapper*, VkImageLayout> pending_layouts;
 
     // Active query info for queries that have been recorded to this command buffer, which will be transfered to the
     // QueryPoolWrapper as pending queries when the command buffer is submitted to a queue.
@@ -426,6 +430,9 @@ struct CommandPoolWrapper : public HandleWrapper<VkCommandPool>
     // Members for trimming state tracking.
     uint32_t queue_family_index{ 0 };
 
+    // Memory for the command data of the pool's command buffers, which is recycled when command buffers are reset.
+    std::shared_ptr<util::ChunkedBufferPool> command_data_pool;
+
     DeviceWrapper* device{ nullptr };
     bool           trim_command_pool{ false };
 };
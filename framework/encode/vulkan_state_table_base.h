@@ -25,18 +25,23 @@
 
 #include "encode/vulkan_handle_wrappers.h"
 #include "format/format.h"
+#include "format/format_util.h"
+#include "util/concurrent_handle_map.h"
 #include "util/defines.h"
 
 #include "vulkan/vulkan.h"
 
+#include <algorithm>
 #include <cassert>
 #include <functional>
-#include <map>
-#include <shared_mutex>
+#include <utility>
+#include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(encode)
 
+// Wrappers are stored in a util::ConcurrentHandleMap for each handle type, which is sharded by hashed handle ID or
+// handle value. Inserts and removals for different handles rarely contend for the same lock, and lookups do not lock.
 class VulkanStateTableBase
 {
   public:
@@ -46,71 +51,66 @@ class VulkanStateTableBase
 
   protected:
     template <typename T>
-    bool InsertEntry(format::HandleId id, T* wrapper, std::map<format::HandleId, T*>& map)
+    bool InsertEntry(format::HandleId id, T* wrapper, util::ConcurrentHandleMap<T>& map)
     {
-        const auto& inserted = map.insert(std::make_pair(id, wrapper));
-        return inserted.second;
+        return map.Insert(id, wrapper);
     }
 
     template <typename Wrapper>
-    bool RemoveEntry(const Wrapper* wrapper, std::map<format::HandleId, Wrapper*>& map)
+    bool RemoveEntry(const Wrapper* wrapper, util::ConcurrentHandleMap<Wrapper>& map)
     {
         assert(wrapper != nullptr);
-        return (map.erase(wrapper->handle_id) != 0);
+        return map.Remove(wrapper->handle_id);
     }
 
     template <typename T>
-    T* GetWrapper(format::HandleId id, std::map<format::HandleId, T*>& map)
+    T* GetWrapper(format::HandleId id, util::ConcurrentHandleMap<T>& map)
     {
-        auto entry = map.find(id);
-        return (entry != map.end()) ? entry->second : nullptr;
+        return map.Find(id);
     }
 
     template <typename T>
-    const T* GetWrapper(format::HandleId id, const std::map<format::HandleId, T*>& map) const
+    const T* GetWrapper(format::HandleId id, const util::ConcurrentHandleMap<T>& map) const
     {
-        auto entry = map.find(id);
-        return (entry != map.end()) ? entry->second : nullptr;
+        return map.Find(id);
     }
 
-    template <typename Wrapper>
-    bool InsertEntry(typename Wrapper::HandleType                                handle,
-                     Wrapper*                                                    wrapper,
-                     std::unordered_map<typename Wrapper::HandleType, Wrapper*>& map)
+    // Visits wrappers in handle ID order, which is the order in which the handles were created.
+    template <typename T>
+    void VisitEntries(const util::ConcurrentHandleMap<T>& map, const std::function<void(T*)>& visitor) const
     {
-        const std::unique_lock<std::shared_mutex> lock(mutex_);
-        const auto&                               inserted = map.insert(std::make_pair(handle, wrapper));
-        return inserted.second;
+        std::vector<std::pair<format::HandleId, T*>> entries;
+        map.Visit([&entries](uint64_t id, T* wrapper) { entries.emplace_back(id, wrapper); });
+
+        std::sort(entries.begin(), entries.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.first < rhs.first;
+        });
+
+        for (const auto& entry : entries)
+        {
+            visitor(entry.second);
+        }
     }
 
     template <typename Wrapper>
-    bool RemoveEntry(const typename Wrapper::HandleType                          handle,
-                     std::unordered_map<typename Wrapper::HandleType, Wrapper*>& map)
+    bool InsertHandleEntry(typename Wrapper::HandleType        handle,
+                           Wrapper*                            wrapper,
+                           util::ConcurrentHandleMap<Wrapper>& map)
     {
-        const std::unique_lock<std::shared_mutex> lock(mutex_);
-        return (map.erase(handle) != 0);
+        return map.Insert(format::ToHandleId(handle), wrapper);
     }
 
     template <typename Wrapper>
-    Wrapper* GetWrapper(typename Wrapper::HandleType                                      handle,
-                        const std::unordered_map<typename Wrapper::HandleType, Wrapper*>& map)
+    bool RemoveHandleEntry(const typename Wrapper::HandleType handle, util::ConcurrentHandleMap<Wrapper>& map)
     {
-        const std::shared_lock<std::shared_mutex> lock(mutex_);
-        auto                                      entry = map.find(handle);
-        return (entry != map.end()) ? entry->second : nullptr;
+        return map.Remove(format::ToHandleId(handle));
     }
 
     template <typename Wrapper>
-    const Wrapper* GetWrapper(typename Wrapper::HandleType                                      handle,
-                              const std::unordered_map<typename Wrapper::HandleType, Wrapper*>& map) const
+    Wrapper* GetHandleEntry(typename Wrapper::HandleType handle, const util::ConcurrentHandleMap<Wrapper>& map) const
     {
-        const std::shared_lock<std::shared_mutex> lock(mutex_);
-        auto                                      entry = map.find(handle);
-        return (entry != map.end()) ? entry->second : nullptr;
+        return map.Find(format::ToHandleId(handle));
     }
-
-  private:
-    mutable std::shared_mutex mutex_;
 };
 
 GFXRECON_END_NAMESPACE(encode)
@@ -59,11 +59,12 @@ void VulkanStateTracker::TrackCommandExecution(vulkan_wrappers::CommandBufferWra
 
     if (call_id != format::ApiCallId::ApiCall_vkResetCommandBuffer)
     {
-        // Append the command data.
-        size_t size = parameter_buffer->GetDataSize();
-        wrapper->command_data.Write(&size, sizeof(size));
-        wrapper->command_data.Write(&call_id, sizeof(call_id));
-        wrapper->command_data.Write(parameter_buffer->GetData(), size);
+        // Append the command data as a single record, which the state writer reads in place.
+        size_t   size   = parameter_buffer->GetDataSize();
+        uint8_t* record = wrapper->command_data.Reserve(sizeof(size) + sizeof(call_id) + size);
+        util::platform::MemoryCopy(record, sizeof(size), &size, sizeof(size));
+        util::platform::MemoryCopy(record + sizeof(size), sizeof(call_id), &call_id, sizeof(call_id));
+        util::platform::MemoryCopy(record + sizeof(size) + sizeof(call_id), size, parameter_buffer->GetData(), size);
     }
 }
 
@@ -74,6 +75,12 @@ void VulkanStateTracker::TrackTrimCommandPool(VkDevice device, VkCommandPool com
     auto wrapper               = vulkan_wrappers::GetWrapper<vulkan_wrappers::CommandPoolWrapper>(command_pool);
     wrapper->trim_command_pool = true;
 
+    // Trimming the pool returns unused memory to the system, which includes the recycled command data chunks.
+    if (wrapper->command_data_pool != nullptr)
+    {
+        wrapper->command_data_pool->Trim();
+    }
+
     auto device_wrapper = vulkan_wrappers::GetWrapper<vulkan_wrappers::DeviceWrapper>(device);
     wrapper->device     = device_wrapper;
 }
@@ -1195,7 +1202,6 @@ void VulkanStateTracker::TrackResetDescriptorPool(VkDescriptorPool descriptor_po
     auto wrapper = vulkan_wrappers::GetWrapper<vulkan_wrappers::DescriptorPoolWrapper>(descriptor_pool);
 
     // Pool reset implicitly frees descriptor sets, so remove all wrappers from the state tracker.
-    std::unique_lock<std::mutex> lock(state_table_mutex_);
     for (const auto& set_entry : wrapper->child_sets)
     {
         state_table_.RemoveWrapper(set_entry.second);
@@ -1454,7 +1460,6 @@ void VulkanStateTracker::DestroyState(vulkan_wrappers::InstanceWrapper* wrapper)
 
     // Physical devices are not explicitly destroyed, so need to be removed from the state tracker when their parent
     // instance is destroyed.
-    std::unique_lock<std::mutex> lock(state_table_mutex_);
     for (const auto physical_device_entry : wrapper->child_physical_devices)
     {
         for (const auto display_entry : physical_device_entry->child_displays)
@@ -1478,7 +1483,6 @@ void VulkanStateTracker::DestroyState(vulkan_wrappers::DeviceWrapper* wrapper)
 
     // Queues are not explicitly destroyed, so need to be removed from the state tracker when their parent device is
     // destroyed.
-    std::unique_lock<std::mutex> lock(state_table_mutex_);
     for (const auto& entry : wrapper->child_queues)
     {
         state_table_.RemoveWrapper(entry);
@@ -1492,7 +1496,6 @@ void VulkanStateTracker::DestroyState(vulkan_wrappers::CommandPoolWrapper* wrapp
 
     // Destroying the pool implicitly destroys objects allocated from the pool, which need to be removed from state
     // tracking.
-    std::unique_lock<std::mutex> lock(state_table_mutex_);
     for (const auto& entry : wrapper->child_buffers)
     {
         state_table_.RemoveWrapper(entry.second);
@@ -1506,7 +1509,6 @@ void VulkanStateTracker::DestroyState(vulkan_wrappers::DescriptorPoolWrapper* wr
 
     // Destroying the pool implicitly destroys objects allocated from the pool, which need to be removed from state
     // tracking.
-    std::unique_lock<std::mutex> lock(state_table_mutex_);
     for (const auto& entry : wrapper->child_sets)
     {
         state_table_.RemoveWrapper(entry.second);
@@ -1520,7 +1522,6 @@ void VulkanStateTracker::DestroyState(vulkan_wrappers::SwapchainKHRWrapper* wrap
 
     // Swapchain images are not explicitly destroyed, so need to be removed from state tracking when the parent
     // swapchain is destroyed.
-    std::unique_lock<std::mutex> lock(state_table_mutex_);
     for (auto entry : wrapper->child_images)
     {
         state_table_.RemoveWrapper(entry);
@@ -40,7 +40,6 @@
 
 #include <cassert>
 #include <functional>
-#include <mutex>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(encode)
@@ -56,7 +55,8 @@ class VulkanStateTracker
     {
         if (writer != nullptr)
         {
-            std::unique_lock<std::mutex> lock(state_table_mutex_);
+            // The state table is not locked here because state is written while the exclusive API call lock is held, so
+            // no other thread can create or destroy handles until writing is complete.
             return writer->WriteState(state_table_, frame_number);
         }
 
@@ -78,7 +78,6 @@ class VulkanStateTracker
             auto wrapper = vulkan_wrappers::GetWrapper<Wrapper>(*new_handle);
 
             // Adds the handle wrapper to the object state table, filtering for duplicate handle retrieval.
-            std::unique_lock<std::mutex> lock(state_table_mutex_);
             if (state_table_.InsertWrapper(wrapper->handle_id, wrapper))
             {
                 vulkan_state_tracker::InitializeState<ParentHandle, Wrapper, CreateInfo>(
@@ -106,7 +105,6 @@ class VulkanStateTracker
         vulkan_state_info::CreateParameters create_parameters = std::make_shared<util::MemoryOutputStream>(
             create_parameter_buffer->GetData(), create_parameter_buffer->GetDataSize());
 
-        std::unique_lock<std::mutex> lock(state_table_mutex_);
         for (uint32_t i = 0; i < count; ++i)
         {
             if (new_handles[i] != VK_NULL_HANDLE)
@@ -158,7 +156,6 @@ class VulkanStateTracker
         vulkan_state_info::CreateParameters create_parameters = std::make_shared<util::MemoryOutputStream>(
             create_parameter_buffer->GetData(), create_parameter_buffer->GetDataSize());
 
-        std::unique_lock<std::mutex> lock(state_table_mutex_);
         for (uint32_t i = 0; i < count; ++i)
         {
             auto wrapper = unwrap_struct_handle(&handle_structs[i]);
@@ -208,15 +205,10 @@ class VulkanStateTracker
         {
             auto wrapper = vulkan_wrappers::GetWrapper<Wrapper>(handle);
 
-            // Scope the state table mutex lock because DestroyState also modifies the state table and will attempt to
-            // lock the mutex.
+            if (!state_table_.RemoveWrapper(wrapper))
             {
-                std::unique_lock<std::mutex> lock(state_table_mutex_);
-                if (!state_table_.RemoveWrapper(wrapper))
-                {
-                    GFXRECON_LOG_WARNING(
-                        "Attempting to remove entry from state tracker for object that is not being tracked");
-                }
+                GFXRECON_LOG_WARNING(
+                    "Attempting to remove entry from state tracker for object that is not being tracked");
             }
 
             DestroyState(wrapper);
@@ -429,7 +421,6 @@ class VulkanStateTracker
         assert(new_handles != nullptr);
         assert(create_parameters != nullptr);
 
-        std::unique_lock<std::mutex> lock(state_table_mutex_);
         for (uint32_t i = 0; i < count; ++i)
         {
             if (new_handles[i] != VK_NULL_HANDLE)
@@ -483,7 +474,6 @@ class VulkanStateTracker
 
     void TrackQuerySubmissions(vulkan_wrappers::CommandBufferWrapper* command_wrapper);
 
-    std::mutex       state_table_mutex_;
     VulkanStateTable state_table_;
 
     // Keeps track of device memories' device addresses
@@ -170,6 +170,7 @@ inline void InitializeState<VkDevice, vulkan_wrappers::CommandPoolWrapper, VkCom
     wrapper->create_parameters = std::move(create_parameters);
 
     wrapper->queue_family_index = create_info->queueFamilyIndex;
+    wrapper->command_data_pool  = std::make_shared<util::ChunkedBufferPool>();
 }
 
 template <>
@@ -807,6 +808,11 @@ inline void InitializePoolObjectState(VkDevice                               par
     wrapper->create_parameters = std::move(create_parameters);
 
     wrapper->level = alloc_info->level;
+
+    if (wrapper->parent_pool != nullptr)
+    {
+        wrapper->command_data.SetPool(wrapper->parent_pool->command_data_pool);
+    }
 }
 
 inline void InitializePoolObjectState(VkDevice                               parent_handle,
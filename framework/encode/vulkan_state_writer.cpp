@@ -43,6 +43,12 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 
 const uint32_t kDefaultQueueFamilyIndex = 0;
 
+// Maximum combined size of the buffers copied to the staging buffer by a single queue submission.
+const uint64_t kMaxStagingBatchSize = 64 * 1024 * 1024;
+
+// Maximum combined size of the resource memory content held for compression by the compression pool.
+const size_t kMaxPendingInitSize = 256 * 1024 * 1024;
+
 static bool IsMemoryCoherent(VkMemoryPropertyFlags property_flags)
 {
     return ((property_flags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) == VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
@@ -80,9 +86,12 @@ static bool IsImageReadable(VkMemoryPropertyFlags                       property
 
 VulkanStateWriter::VulkanStateWriter(util::FileOutputStream* output_stream,
                                      util::Compressor*       compressor,
-                                     format::ThreadId        thread_id) :
+                                     uint32_t                compression_thread_count,
+                                     format::ThreadId        thread_id,
+                                     bool                    compact_encoding) :
     output_stream_(output_stream),
-    compressor_(compressor), thread_id_(thread_id), encoder_(&parameter_stream_)
+    compressor_(compressor), compression_thread_count_(compression_thread_count), thread_id_(thread_id),
+    encoder_(&parameter_stream_, compact_encoding)
 {
     assert(output_stream != nullptr);
 }
@@ -1351,94 +1360,78 @@ void VulkanStateWriter::ProcessBufferMemory(const vulkan_wrappers::DeviceWrapper
 
     const VulkanDeviceTable* device_table = &device_wrapper->layer_table;
 
+    // Buffers that require a staging copy are copied to the staging buffer in batches, with one queue submission
+    // per batch.
+    std::vector<const BufferSnapshotInfo*> staging_entries;
+    BufferReadRegions                      staging_regions;
+    uint64_t                               staging_size = 0;
+
     for (const auto& snapshot_entry : buffer_snapshot_info)
     {
         const vulkan_wrappers::BufferWrapper*       buffer_wrapper = snapshot_entry.buffer_wrapper;
         const vulkan_wrappers::DeviceMemoryWrapper* memory_wrapper = snapshot_entry.memory_wrapper;
         const uint8_t*                              bytes          = nullptr;
-        std::vector<uint8_t>                        data;
 
         assert((buffer_wrapper != nullptr) && (memory_wrapper != nullptr));
 
         if (snapshot_entry.need_staging_copy)
         {
-            VkResult result = resource_util.ReadFromBufferResource(
-                buffer_wrapper->handle, buffer_wrapper->created_size, 0, buffer_wrapper->queue_family_index, data);
-
-            if (result == VK_SUCCESS)
-            {
-                bytes = data.data();
-            }
-        }
-        else
-        {
-            assert((memory_wrapper->mapped_data == nullptr) || (memory_wrapper->mapped_offset == 0));
-
-            VkResult result = VK_SUCCESS;
+            const uint64_t alignment    = graphics::VulkanResourcesUtil::kBufferReadAlignment;
+            const uint64_t aligned_size = (buffer_wrapper->created_size + alignment - 1) & ~(alignment - 1);
 
-            if (memory_wrapper->mapped_data == nullptr)
+            if (!staging_entries.empty() && ((staging_size + aligned_size) > kMaxStagingBatchSize))
             {
-                void* map_ptr = nullptr;
-                result        = device_table->MapMemory(device_wrapper->handle,
-                                                 memory_wrapper->handle,
-                                                 buffer_wrapper->bind_offset,
-                                                 buffer_wrapper->created_size,
-                                                 0,
-                                                 &map_ptr);
+                ProcessBufferStagingBatch(device_wrapper, staging_entries, staging_regions, resource_util);
 
-                if (result == VK_SUCCESS)
-                {
-                    bytes = reinterpret_cast<const uint8_t*>(map_ptr);
-                }
-            }
-            else
-            {
-                bytes = reinterpret_cast<const uint8_t*>(memory_wrapper->mapped_data) + buffer_wrapper->bind_offset;
+                staging_entries.clear();
+                staging_regions.clear();
+                staging_size = 0;
             }
 
-            if ((result == VK_SUCCESS) && !IsMemoryCoherent(snapshot_entry.memory_properties))
-            {
-                InvalidateMappedMemoryRange(
-                    device_wrapper, memory_wrapper->handle, buffer_wrapper->bind_offset, buffer_wrapper->created_size);
-            }
+            staging_entries.push_back(&snapshot_entry);
+            staging_regions.push_back({ buffer_wrapper->handle, buffer_wrapper->created_size, 0 });
+            staging_size += aligned_size;
+
+            continue;
         }
 
-        if (bytes != nullptr)
-        {
-            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, buffer_wrapper->created_size);
+        assert((memory_wrapper->mapped_data == nullptr) || (memory_wrapper->mapped_offset == 0));
 
-            size_t                          data_size = static_cast<size_t>(buffer_wrapper->created_size);
-            format::InitBufferCommandHeader upload_cmd;
+        VkResult result = VK_SUCCESS;
 
-            upload_cmd.meta_header.block_header.type = format::kMetaDataBlock;
-            upload_cmd.meta_header.meta_data_id =
-                format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan, format::MetaDataType::kInitBufferCommand);
-            upload_cmd.thread_id = thread_id_;
-            upload_cmd.device_id = device_wrapper->handle_id;
-            upload_cmd.buffer_id = buffer_wrapper->handle_id;
-            upload_cmd.data_size = data_size;
+        if (memory_wrapper->mapped_data == nullptr)
+        {
+            void* map_ptr = nullptr;
+            result        = device_table->MapMemory(device_wrapper->handle,
+                                             memory_wrapper->handle,
+                                             buffer_wrapper->bind_offset,
+                                             buffer_wrapper->created_size,
+                                             0,
+                                             &map_ptr);
 
-            if (compressor_ != nullptr)
+            if (result == VK_SUCCESS)
             {
-                size_t compressed_size = compressor_->Compress(data_size, bytes, &compressed_parameter_buffer_, 0);
-
-                if ((compressed_size > 0) && (compressed_size < data_size))
-                {
-                    upload_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
-
-                    bytes     = compressed_parameter_buffer_.data();
-                    data_size = compressed_size;
-                }
+                bytes = reinterpret_cast<const uint8_t*>(map_ptr);
             }
+        }
+        else
+        {
+            bytes = reinterpret_cast<const uint8_t*>(memory_wrapper->mapped_data) + buffer_wrapper->bind_offset;
+        }
 
-            // Calculate size of packet with compressed or uncompressed data size.
-            upload_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(upload_cmd) + data_size;
+        if ((result == VK_SUCCESS) && !IsMemoryCoherent(snapshot_entry.memory_properties))
+        {
+            InvalidateMappedMemoryRange(
+                device_wrapper, memory_wrapper->handle, buffer_wrapper->bind_offset, buffer_wrapper->created_size);
+        }
 
-            output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
-            output_stream_->Write(bytes, data_size);
-            ++blocks_written_;
+        if (bytes != nullptr)
+        {
+            // The memory content is copied by CreateBufferInitWrite(), so the memory can be unmapped before the
+            // command is written.
+            QueueResourceInitWrite(CreateBufferInitWrite(device_wrapper, buffer_wrapper, bytes));
 
-            if (!snapshot_entry.need_staging_copy && memory_wrapper->mapped_data == nullptr)
+            if (memory_wrapper->mapped_data == nullptr)
             {
                 device_table->UnmapMemory(device_wrapper->handle, memory_wrapper->handle);
             }
@@ -1449,6 +1442,148 @@ void VulkanStateWriter::ProcessBufferMemory(const vulkan_wrappers::DeviceWrapper
                                buffer_wrapper->handle_id);
         }
     }
+
+    if (!staging_entries.empty())
+    {
+        ProcessBufferStagingBatch(device_wrapper, staging_entries, staging_regions, resource_util);
+    }
+}
+
+void VulkanStateWriter::ProcessBufferStagingBatch(const vulkan_wrappers::DeviceWrapper*         device_wrapper,
+                                                  const std::vector<const BufferSnapshotInfo*>& snapshot_entries,
+                                                  const BufferReadRegions&                      regions,
+                                                  graphics::VulkanResourcesUtil&                resource_util)
+{
+    assert(!snapshot_entries.empty() && (snapshot_entries.size() == regions.size()));
+
+    // All buffers in the batch belong to the same queue family.
+    uint32_t queue_family_index = snapshot_entries[0]->buffer_wrapper->queue_family_index;
+
+    VkResult result = resource_util.ReadFromBufferResources(
+        regions, queue_family_index, [&](size_t region_index, const uint8_t* data, uint64_t size) {
+            GFXRECON_UNREFERENCED_PARAMETER(size);
+            QueueResourceInitWrite(
+                CreateBufferInitWrite(device_wrapper, snapshot_entries[region_index]->buffer_wrapper, data));
+        });
+
+    if (result != VK_SUCCESS)
+    {
+        for (const auto snapshot_entry : snapshot_entries)
+        {
+            GFXRECON_LOG_ERROR("Trimming state snapshot failed to retrieve memory content for buffer %" PRIu64,
+                               snapshot_entry->buffer_wrapper->handle_id);
+        }
+    }
+}
+
+std::unique_ptr<VulkanStateWriter::ResourceInitWrite>
+VulkanStateWriter::CreateBufferInitWrite(const vulkan_wrappers::DeviceWrapper* device_wrapper,
+                                         const vulkan_wrappers::BufferWrapper* buffer_wrapper,
+                                         const uint8_t*                        data)
+{
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, buffer_wrapper->created_size);
+
+    size_t                          data_size = static_cast<size_t>(buffer_wrapper->created_size);
+    format::InitBufferCommandHeader upload_cmd;
+
+    // The block type and size are set when the command is written.
+    upload_cmd.meta_header.block_header.type = format::kMetaDataBlock;
+    upload_cmd.meta_header.block_header.size = 0;
+    upload_cmd.meta_header.meta_data_id =
+        format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan, format::MetaDataType::kInitBufferCommand);
+    upload_cmd.thread_id = thread_id_;
+    upload_cmd.device_id = device_wrapper->handle_id;
+    upload_cmd.buffer_id = buffer_wrapper->handle_id;
+    upload_cmd.data_size = data_size;
+
+    auto init_write = std::make_unique<ResourceInitWrite>();
+    auto cmd_bytes  = reinterpret_cast<const uint8_t*>(&upload_cmd);
+
+    init_write->command.assign(cmd_bytes, cmd_bytes + sizeof(upload_cmd));
+    init_write->data.assign(data, data + data_size);
+
+    return init_write;
+}
+
+void VulkanStateWriter::QueueResourceInitWrite(std::unique_ptr<ResourceInitWrite> init_write)
+{
+    assert(init_write != nullptr);
+
+    if ((compression_pool_ != nullptr) && !init_write->data.empty())
+    {
+        ResourceInitWrite* pending_write = init_write.get();
+
+        pending_write->compressed_size = compression_pool_->post([this, pending_write]() {
+            return compressor_->Compress(
+                pending_write->data.size(), pending_write->data.data(), &pending_write->compressed_data, 0);
+        });
+    }
+
+    pending_init_size_ += init_write->data.size();
+    pending_init_writes_.push_back(std::move(init_write));
+
+    // Limit the amount of memory content that is held for compression.  Without a compression pool, the command is
+    // written immediately.
+    while (!pending_init_writes_.empty() &&
+           ((compression_pool_ == nullptr) || (pending_init_size_ > kMaxPendingInitSize)))
+    {
+        WriteNextResourceInit();
+    }
+}
+
+void VulkanStateWriter::WriteNextResourceInit()
+{
+    assert(!pending_init_writes_.empty());
+
+    std::unique_ptr<ResourceInitWrite> init_write = std::move(pending_init_writes_.front());
+    pending_init_writes_.pop_front();
+    pending_init_size_ -= init_write->data.size();
+
+    size_t compressed_size = 0;
+
+    if (init_write->compressed_size.valid())
+    {
+        compressed_size = init_write->compressed_size.get();
+    }
+    else if ((compressor_ != nullptr) && !init_write->data.empty())
+    {
+        compressed_size =
+            compressor_->Compress(init_write->data.size(), init_write->data.data(), &init_write->compressed_data, 0);
+    }
+
+    const uint8_t* bytes     = init_write->data.data();
+    size_t         data_size = init_write->data.size();
+
+    assert(init_write->command.size() >= sizeof(format::BlockHeader));
+    format::BlockHeader* block_header = reinterpret_cast<format::BlockHeader*>(init_write->command.data());
+
+    if ((compressed_size > 0) && (compressed_size < data_size))
+    {
+        block_header->type = format::BlockType::kCompressedMetaDataBlock;
+
+        bytes     = init_write->compressed_data.data();
+        data_size = compressed_size;
+    }
+
+    // Calculate size of packet with compressed or uncompressed data size.
+    block_header->size = (init_write->command.size() - sizeof(format::BlockHeader)) + data_size;
+
+    output_stream_->Write(init_write->command.data(), init_write->command.size());
+
+    if (data_size > 0)
+    {
+        output_stream_->Write(bytes, data_size);
+    }
+
+    ++blocks_written_;
+}
+
+void VulkanStateWriter::FlushResourceInitWrites()
+{
+    while (!pending_init_writes_.empty())
+    {
+        WriteNextResourceInit();
+    }
 }
 
 void VulkanStateWriter::ProcessImageMemory(const vulkan_wrappers::DeviceWrapper* device_wrapper,
@@ -1535,8 +1670,8 @@ void VulkanStateWriter::ProcessImageMemory(const vulkan_wrappers::DeviceWrapper*
         {
             format::InitImageCommandHeader upload_cmd;
 
-            // Packet size without the resource data.
-            upload_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(upload_cmd);
+            // The block type and size are set when the command is written.
+            upload_cmd.meta_header.block_header.size = 0;
             upload_cmd.meta_header.block_header.type = format::kMetaDataBlock;
             upload_cmd.meta_header.meta_data_id =
                 format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan, format::MetaDataType::kInitImageCommand);
@@ -1546,6 +1681,8 @@ void VulkanStateWriter::ProcessImageMemory(const vulkan_wrappers::DeviceWrapper*
             upload_cmd.aspect    = snapshot_entry.aspect;
             upload_cmd.layout    = image_wrapper->current_layout;
 
+            auto init_write = std::make_unique<ResourceInitWrite>();
+
             if (bytes != nullptr)
             {
                 GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, snapshot_entry.resource_size);
@@ -1556,29 +1693,27 @@ void VulkanStateWriter::ProcessImageMemory(const vulkan_wrappers::DeviceWrapper*
                 upload_cmd.data_size   = data_size;
                 upload_cmd.level_count = image_wrapper->mip_levels;
 
-                if (compressor_ != nullptr)
-                {
-                    size_t compressed_size = compressor_->Compress(data_size, bytes, &compressed_parameter_buffer_, 0);
-
-                    if ((compressed_size > 0) && (compressed_size < data_size))
-                    {
-                        upload_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
-
-                        bytes     = compressed_parameter_buffer_.data();
-                        data_size = compressed_size;
-                    }
-                }
-
-                // Calculate size of packet with compressed or uncompressed data size.
                 assert(!snapshot_entry.level_sizes.empty() &&
                        (snapshot_entry.level_sizes.size() == upload_cmd.level_count));
                 size_t levels_size = snapshot_entry.level_sizes.size() * sizeof(snapshot_entry.level_sizes[0]);
 
-                upload_cmd.meta_header.block_header.size += levels_size + data_size;
+                auto cmd_bytes    = reinterpret_cast<const uint8_t*>(&upload_cmd);
+                auto levels_bytes = reinterpret_cast<const uint8_t*>(snapshot_entry.level_sizes.data());
 
-                output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
-                output_stream_->Write(snapshot_entry.level_sizes.data(), levels_size);
-                output_stream_->Write(bytes, data_size);
+                init_write->command.reserve(sizeof(upload_cmd) + levels_size);
+                init_write->command.assign(cmd_bytes, cmd_bytes + sizeof(upload_cmd));
+                init_write->command.insert(init_write->command.end(), levels_bytes, levels_bytes + levels_size);
+
+                if (bytes == data.data())
+                {
+                    // Staging copy data is already owned by the vector.
+                    data.resize(data_size);
+                    init_write->data = std::move(data);
+                }
+                else
+                {
+                    init_write->data.assign(bytes, bytes + data_size);
+                }
 
                 if (!snapshot_entry.need_staging_copy && memory_wrapper->mapped_data == nullptr)
                 {
@@ -1592,10 +1727,11 @@ void VulkanStateWriter::ProcessImageMemory(const vulkan_wrappers::DeviceWrapper*
                 upload_cmd.data_size   = 0;
                 upload_cmd.level_count = 0;
 
-                output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
+                auto cmd_bytes = reinterpret_cast<const uint8_t*>(&upload_cmd);
+                init_write->command.assign(cmd_bytes, cmd_bytes + sizeof(upload_cmd));
             }
 
-            ++blocks_written_;
+            QueueResourceInitWrite(std::move(init_write));
         }
     }
 }
@@ -1885,6 +2021,11 @@ void VulkanStateWriter::WriteResourceMemoryState(const VulkanStateTable& state_t
     WriteBufferMemoryState(state_table, &resources, &max_resource_size, &max_staging_copy_size);
     WriteImageMemoryState(state_table, &resources, &max_resource_size, &max_staging_copy_size);
 
+    if ((compressor_ != nullptr) && (compression_thread_count_ > 0) && !resources.empty())
+    {
+        compression_pool_ = std::make_unique<util::ThreadPool>(compression_thread_count_);
+    }
+
     // Write resource memory content.
     for (const auto& resource_entry : resources)
     {
@@ -1925,6 +2066,8 @@ void VulkanStateWriter::WriteResourceMemoryState(const VulkanStateTable& state_t
                 ProcessImageMemory(device_wrapper, queue_family_entry.second.images, resource_util);
             }
 
+            FlushResourceInitWrites();
+
             format::EndResourceInitCommand end_cmd;
             end_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(end_cmd);
             end_cmd.meta_header.block_header.type = format::kMetaDataBlock;
@@ -1941,6 +2084,8 @@ void VulkanStateWriter::WriteResourceMemoryState(const VulkanStateTable& state_t
             GFXRECON_LOG_ERROR("Failed to create a staging buffer to process trim state");
         }
     }
+
+    compression_pool_.reset();
 }
 
 void VulkanStateWriter::WriteMappedMemoryState(const VulkanStateTable& state_table)
@@ -2388,26 +2533,30 @@ void VulkanStateWriter::WriteCommandBufferCommands(const vulkan_wrappers::Comman
 
     if (CheckCommandHandles(wrapper, state_table))
     {
-        // Replay each of the commands that was recorded for the command buffer.
-        size_t         offset    = 0;
-        size_t         data_size = wrapper->command_data.GetDataSize();
-        const uint8_t* data      = wrapper->command_data.GetData();
-
-        while (offset < data_size)
+        // Replay each of the commands that was recorded for the command buffer. Each command is stored as a single
+        // record, which does not cross the end of a chunk.
+        for (const auto& chunk : wrapper->command_data.GetChunks())
         {
-            const size_t*            parameter_size = reinterpret_cast<const size_t*>(&data[offset]);
-            const format::ApiCallId* call_id =
-                reinterpret_cast<const format::ApiCallId*>(&data[offset] + sizeof(size_t));
-            const uint8_t* parameter_data = &data[offset] + (sizeof(size_t) + sizeof(format::ApiCallId));
+            size_t         offset    = 0;
+            size_t         data_size = chunk.size;
+            const uint8_t* data      = chunk.data.get();
 
-            parameter_stream_.Write(parameter_data, (*parameter_size));
-            WriteFunctionCall((*call_id), &parameter_stream_);
-            parameter_stream_.Clear();
+            while (offset < data_size)
+            {
+                const size_t*            parameter_size = reinterpret_cast<const size_t*>(&data[offset]);
+                const format::ApiCallId* call_id =
+                    reinterpret_cast<const format::ApiCallId*>(&data[offset] + sizeof(size_t));
+                const uint8_t* parameter_data = &data[offset] + (sizeof(size_t) + sizeof(format::ApiCallId));
 
-            offset += sizeof(size_t) + sizeof(format::ApiCallId) + (*parameter_size);
-        }
+                parameter_stream_.Write(parameter_data, (*parameter_size));
+                WriteFunctionCall((*call_id), &parameter_stream_);
+                parameter_stream_.Clear();
+
+                offset += sizeof(size_t) + sizeof(format::ApiCallId) + (*parameter_size);
+            }
 
-        assert(offset == data_size);
+            assert(offset == data_size);
+        }
     }
 }
 
@@ -35,9 +35,13 @@
 #include "util/defines.h"
 #include "util/file_output_stream.h"
 #include "util/memory_output_stream.h"
+#include "util/threadpool.h"
 
 #include "vulkan/vulkan.h"
 
+#include <deque>
+#include <future>
+#include <memory>
 #include <set>
 #include <vector>
 
@@ -47,7 +51,14 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 class VulkanStateWriter
 {
   public:
-    VulkanStateWriter(util::FileOutputStream* output_stream, util::Compressor* compressor, format::ThreadId thread_id);
+    // When compression_thread_count is greater than 0, resource memory content is compressed by a pool of worker
+    // threads while the content of the next resources is retrieved.  When compact_encoding is true, API call
+    // parameters are encoded for a capture file with the format::FileOption::kCompactEncoding option.
+    VulkanStateWriter(util::FileOutputStream* output_stream,
+                      util::Compressor*       compressor,
+                      uint32_t                compression_thread_count,
+                      format::ThreadId        thread_id,
+                      bool                    compact_encoding);
 
     // Returns number of blocks written to the output_stream.
     uint64_t WriteState(const VulkanStateTable& state_table, uint64_t frame_number);
@@ -79,6 +90,18 @@ class VulkanStateWriter
         std::vector<ImageSnapshotInfo>  images;
     };
 
+    // Resource initialization command with a copy of the resource memory content, which is written after the
+    // content has been compressed.
+    struct ResourceInitWrite
+    {
+        std::vector<uint8_t> command;         // Init command header, followed by any image level sizes.
+        std::vector<uint8_t> data;            // Uncompressed resource memory content.
+        std::vector<uint8_t> compressed_data; // Valid when compressed_size is not 0.
+        std::future<size_t>  compressed_size; // Only valid when compressed by the compression pool.
+    };
+
+    typedef std::vector<graphics::VulkanResourcesUtil::BufferReadRegion> BufferReadRegions;
+
     typedef std::unordered_map<uint32_t, ResourceSnapshotInfo> ResourceSnapshotQueueFamilyTable;
     typedef std::unordered_map<const vulkan_wrappers::DeviceWrapper*, ResourceSnapshotQueueFamilyTable>
         DeviceResourceTables;
@@ -155,6 +178,24 @@ class VulkanStateWriter
                             const std::vector<ImageSnapshotInfo>& image_snapshot_info,
                             graphics::VulkanResourcesUtil&        resource_util);
 
+    // Retrieves the content of a batch of buffers with a single staging copy.
+    void ProcessBufferStagingBatch(const vulkan_wrappers::DeviceWrapper*         device_wrapper,
+                                   const std::vector<const BufferSnapshotInfo*>& snapshot_entries,
+                                   const BufferReadRegions&                      regions,
+                                   graphics::VulkanResourcesUtil&                resource_util);
+
+    std::unique_ptr<ResourceInitWrite> CreateBufferInitWrite(const vulkan_wrappers::DeviceWrapper* device_wrapper,
+                                                             const vulkan_wrappers::BufferWrapper* buffer_wrapper,
+                                                             const uint8_t*                        data);
+
+    // Queues the command to be written once its data has been compressed.  Commands are written in the order that
+    // they are queued.
+    void QueueResourceInitWrite(std::unique_ptr<ResourceInitWrite> init_write);
+
+    void WriteNextResourceInit();
+
+    void FlushResourceInitWrites();
+
     void WriteBufferMemoryState(const VulkanStateTable& state_table,
                                 DeviceResourceTables*   resources,
                                 VkDeviceSize*           max_resource_size,
@@ -352,10 +393,15 @@ class VulkanStateWriter
     util::FileOutputStream*  output_stream_;
     util::Compressor*        compressor_;
     std::vector<uint8_t>     compressed_parameter_buffer_;
+    uint32_t                 compression_thread_count_;
     format::ThreadId         thread_id_;
     util::MemoryOutputStream parameter_stream_;
     ParameterEncoder         encoder_;
     uint64_t                 blocks_written_{ 0 };
+
+    std::unique_ptr<util::ThreadPool>              compression_pool_;
+    std::deque<std::unique_ptr<ResourceInitWrite>> pending_init_writes_;
+    size_t                                         pending_init_size_{ 0 }; // Uncompressed size of pending writes.
 };
 
 GFXRECON_END_NAMESPACE(encode)
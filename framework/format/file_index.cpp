@@ -0,0 +1,450 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "format/file_index.h"
+
+#include "format/format_util.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(format)
+
+struct FileIndexHeader
+{
+    uint32_t fourcc;
+    uint32_t version;
+    uint64_t capture_file_size;
+    uint64_t block_count;
+    uint32_t uses_frame_markers;
+    uint32_t reserved;
+    uint64_t first_frame_marker_block;
+    uint64_t frame_count;
+    uint64_t checkpoint_count;
+    uint64_t state_marker_count;
+    uint64_t content_block_count;
+};
+
+static bool WriteEntry(const FileIndexEntry& entry, FILE* file)
+{
+    return util::platform::FileWrite(&entry.frame_number, sizeof(entry.frame_number), file) &&
+           util::platform::FileWrite(&entry.block_index, sizeof(entry.block_index), file) &&
+           util::platform::FileWrite(&entry.offset, sizeof(entry.offset), file);
+}
+
+static bool ReadEntry(FileIndexEntry* entry, FILE* file)
+{
+    return util::platform::FileRead(&entry->frame_number, sizeof(entry->frame_number), file) &&
+           util::platform::FileRead(&entry->block_index, sizeof(entry->block_index), file) &&
+           util::platform::FileRead(&entry->offset, sizeof(entry->offset), file);
+}
+
+static bool WriteEntries(const std::vector<FileIndexEntry>& entries, FILE* file)
+{
+    for (const auto& entry : entries)
+    {
+        if (!WriteEntry(entry, file))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool ReadEntries(uint64_t count, std::vector<FileIndexEntry>* entries, FILE* file)
+{
+    FileIndexEntry entry;
+
+    for (uint64_t i = 0; i < count; ++i)
+    {
+        if (!ReadEntry(&entry, file))
+        {
+            return false;
+        }
+
+        entries->push_back(entry);
+    }
+
+    return true;
+}
+
+static bool GetFileSize(FILE* file, uint64_t* file_size)
+{
+    int64_t position = util::platform::FileTell(file);
+
+    if ((position >= 0) && util::platform::FileSeek(file, 0, util::platform::FileSeekEnd))
+    {
+        int64_t size = util::platform::FileTell(file);
+
+        if ((size >= 0) && util::platform::FileSeek(file, position, util::platform::FileSeekSet))
+        {
+            *file_size = static_cast<uint64_t>(size);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool FileIndex::IsFrameDelimiterApiCall(ApiCallId call_id)
+{
+    // This list is deprecated and no new API calls should be added. Instead, end of frame markers are used to track
+    // frames.
+    return ((call_id == ApiCallId::ApiCall_vkQueuePresentKHR) ||
+            (call_id == ApiCallId::ApiCall_vkFrameBoundaryANDROID) ||
+            (call_id == ApiCallId::ApiCall_IDXGISwapChain_Present) ||
+            (call_id == ApiCallId::ApiCall_IDXGISwapChain1_Present1));
+}
+
+void FileIndex::Clear()
+{
+    uses_frame_markers_       = false;
+    first_frame_marker_block_ = 0;
+    capture_file_size_        = 0;
+    block_count_              = 0;
+    frames_.clear();
+    checkpoints_.clear();
+    state_markers_.clear();
+    content_blocks_.clear();
+}
+
+bool FileIndex::Build(const std::string& capture_filename)
+{
+    FILE*   file   = nullptr;
+    int32_t result = util::platform::FileOpen(&file, capture_filename.c_str(), "rb");
+
+    Clear();
+
+    if ((result != 0) || (file == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open capture file %s to build file index", capture_filename.c_str());
+        return false;
+    }
+
+    FileHeader file_header = {};
+    bool       success     = GetFileSize(file, &capture_file_size_);
+
+    success = success && util::platform::FileRead(&file_header, sizeof(file_header), file) &&
+              (file_header.fourcc == GFXRECON_FOURCC);
+
+    if (success)
+    {
+        uint64_t offset = sizeof(file_header) + (file_header.num_options * sizeof(FileOptionPair));
+        uint64_t frame  = 0;
+
+        success = util::platform::FileSeek(file, static_cast<int64_t>(offset), util::platform::FileSeekSet);
+
+        frames_.push_back({ frame, 0, offset });
+
+        BlockHeader block_header;
+
+        // Stop at the end of the file, or at an incomplete block at the end of the file.
+        while (success && ((capture_file_size_ - offset) >= sizeof(block_header)) &&
+               util::platform::FileRead(&block_header, sizeof(block_header), file) &&
+               ((capture_file_size_ - offset - sizeof(block_header)) >= block_header.size))
+        {
+            const uint64_t block_data_offset = offset + sizeof(block_header);
+            const uint64_t next_offset       = block_data_offset + block_header.size;
+            const uint64_t block_index       = block_count_;
+            bool           is_delimiter      = false;
+
+            if ((block_index % kFileIndexCheckpointInterval) == 0)
+            {
+                checkpoints_.push_back({ frame, block_index, offset });
+            }
+
+            BlockType base_type = RemoveCompressedBlockBit(block_header.type);
+
+            if (((base_type == BlockType::kFunctionCallBlock) || (base_type == BlockType::kMethodCallBlock)) &&
+                (block_header.size >= sizeof(ApiCallId)))
+            {
+                ApiCallId call_id = ApiCallId::ApiCall_Unknown;
+                success           = util::platform::FileRead(&call_id, sizeof(call_id), file);
+                is_delimiter      = success && !uses_frame_markers_ && IsFrameDelimiterApiCall(call_id);
+            }
+            else if ((block_header.type == BlockType::kFrameMarkerBlock) &&
+                     (block_header.size >= sizeof(MarkerType)))
+            {
+                MarkerType marker_type = MarkerType::kUnknownMarker;
+                success                = util::platform::FileRead(&marker_type, sizeof(marker_type), file);
+
+                if (success && (marker_type == MarkerType::kEndMarker))
+                {
+                    // Match FileProcessor, which stops counting frame ending API calls and restarts the frame count
+                    // when it encounters the first frame marker.
+                    if (!uses_frame_markers_)
+                    {
+                        uses_frame_markers_       = true;
+                        first_frame_marker_block_ = block_index;
+                        frame                     = 0;
+                        frames_.resize(1);
+                    }
+
+                    is_delimiter = true;
+                }
+            }
+            else if ((base_type == BlockType::kMetaDataBlock) &&
+                     (block_header.size >= (sizeof(MetaDataId) + sizeof(ThreadId) + sizeof(uint64_t))))
+            {
+                MetaDataId meta_data_id = 0;
+                success                 = util::platform::FileRead(&meta_data_id, sizeof(meta_data_id), file);
+
+                if (success && (GetMetaDataType(meta_data_id) == MetaDataType::kContentDataCommand))
+                {
+                    // The content data block header is not compressed, so the content ID can be read from compressed
+                    // blocks.
+                    FileIndexContentBlock content_block;
+                    ThreadId              thread_id = 0;
+                    content_block.location          = { frame, block_index, offset };
+
+                    success =
+                        util::platform::FileRead(&thread_id, sizeof(thread_id), file) &&
+                        util::platform::FileRead(&content_block.content_id, sizeof(content_block.content_id), file);
+
+                    if (success)
+                    {
+                        content_blocks_.push_back(content_block);
+                    }
+                }
+            }
+            else if ((block_header.type == BlockType::kStateMarkerBlock) &&
+                     (block_header.size >= (sizeof(MarkerType) + sizeof(uint64_t))))
+            {
+                FileIndexStateMarker state_marker;
+                state_marker.location = { frame, block_index, offset };
+
+                success =
+                    util::platform::FileRead(&state_marker.marker_type, sizeof(state_marker.marker_type), file) &&
+                    util::platform::FileRead(
+                        &state_marker.captured_frame_number, sizeof(state_marker.captured_frame_number), file);
+
+                if (success)
+                {
+                    state_markers_.push_back(state_marker);
+                }
+            }
+
+            success = success &&
+                      util::platform::FileSeek(file, static_cast<int64_t>(next_offset), util::platform::FileSeekSet);
+
+            offset = next_offset;
+            ++block_count_;
+
+            if (is_delimiter)
+            {
+                ++frame;
+                frames_.push_back({ frame, block_count_, offset });
+            }
+        }
+    }
+
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Failed to read capture file %s to build file index", capture_filename.c_str());
+        Clear();
+    }
+
+    util::platform::FileClose(file);
+
+    return success;
+}
+
+bool FileIndex::Load(const std::string& index_filename, const std::string& capture_filename)
+{
+    FILE*    file              = nullptr;
+    uint64_t capture_file_size = 0;
+    int32_t  result            = util::platform::FileOpen(&file, capture_filename.c_str(), "rb");
+
+    Clear();
+
+    if ((result != 0) || (file == nullptr))
+    {
+        return false;
+    }
+
+    bool have_size = GetFileSize(file, &capture_file_size);
+    util::platform::FileClose(file);
+
+    result = util::platform::FileOpen(&file, index_filename.c_str(), "rb");
+
+    if (!have_size || (result != 0) || (file == nullptr))
+    {
+        return false;
+    }
+
+    FileIndexHeader header  = {};
+    bool            success = util::platform::FileRead(&header, sizeof(header), file);
+
+    if (success && (header.fourcc == GFXRECON_FILE_INDEX_FOURCC) && (header.version == kFileIndexVersion) &&
+        (header.capture_file_size == capture_file_size))
+    {
+        uses_frame_markers_       = (header.uses_frame_markers != 0);
+        first_frame_marker_block_ = header.first_frame_marker_block;
+        capture_file_size_        = header.capture_file_size;
+        block_count_              = header.block_count;
+
+        success = ReadEntries(header.frame_count, &frames_, file) &&
+                  ReadEntries(header.checkpoint_count, &checkpoints_, file);
+
+        for (uint64_t i = 0; success && (i < header.state_marker_count); ++i)
+        {
+            FileIndexStateMarker state_marker;
+
+            success = util::platform::FileRead(&state_marker.marker_type, sizeof(state_marker.marker_type), file) &&
+                      util::platform::FileRead(
+                          &state_marker.captured_frame_number, sizeof(state_marker.captured_frame_number), file) &&
+                      ReadEntry(&state_marker.location, file);
+
+            if (success)
+            {
+                state_markers_.push_back(state_marker);
+            }
+        }
+
+        for (uint64_t i = 0; success && (i < header.content_block_count); ++i)
+        {
+            FileIndexContentBlock content_block;
+
+            success =
+                util::platform::FileRead(&content_block.content_id, sizeof(content_block.content_id), file) &&
+                ReadEntry(&content_block.location, file);
+
+            if (success)
+            {
+                content_blocks_.push_back(content_block);
+            }
+        }
+    }
+    else
+    {
+        GFXRECON_LOG_WARNING("Ignoring file index %s, which does not match the capture file", index_filename.c_str());
+        success = false;
+    }
+
+    if (!success || frames_.empty())
+    {
+        Clear();
+        success = false;
+    }
+
+    util::platform::FileClose(file);
+
+    return success;
+}
+
+bool FileIndex::Save(const std::string& index_filename) const
+{
+    FILE*   file   = nullptr;
+    int32_t result = util::platform::FileOpen(&file, index_filename.c_str(), "wb");
+
+    if ((result != 0) || (file == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open file index %s for writing", index_filename.c_str());
+        return false;
+    }
+
+    FileIndexHeader header          = {};
+    header.fourcc                   = GFXRECON_FILE_INDEX_FOURCC;
+    header.version                  = kFileIndexVersion;
+    header.capture_file_size        = capture_file_size_;
+    header.block_count              = block_count_;
+    header.uses_frame_markers       = uses_frame_markers_ ? 1 : 0;
+    header.first_frame_marker_block = first_frame_marker_block_;
+    header.frame_count              = frames_.size();
+    header.checkpoint_count         = checkpoints_.size();
+    header.state_marker_count       = state_markers_.size();
+    header.content_block_count      = content_blocks_.size();
+
+    bool success = util::platform::FileWrite(&header, sizeof(header), file) && WriteEntries(frames_, file) &&
+                   WriteEntries(checkpoints_, file);
+
+    for (auto iter = state_markers_.begin(); success && (iter != state_markers_.end()); ++iter)
+    {
+        success = util::platform::FileWrite(&iter->marker_type, sizeof(iter->marker_type), file) &&
+                  util::platform::FileWrite(&iter->captured_frame_number, sizeof(iter->captured_frame_number), file) &&
+                  WriteEntry(iter->location, file);
+    }
+
+    for (auto iter = content_blocks_.begin(); success && (iter != content_blocks_.end()); ++iter)
+    {
+        success = util::platform::FileWrite(&iter->content_id, sizeof(iter->content_id), file) &&
+                  WriteEntry(iter->location, file);
+    }
+
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Failed to write file index %s", index_filename.c_str());
+    }
+
+    util::platform::FileClose(file);
+
+    return success;
+}
+
+bool FileIndex::FindFrame(uint64_t frame_number, FileIndexEntry* entry) const
+{
+    assert(entry != nullptr);
+
+    if (frame_number < frames_.size())
+    {
+        *entry = frames_[static_cast<size_t>(frame_number)];
+        return true;
+    }
+
+    return false;
+}
+
+bool FileIndex::FindBlock(uint64_t block_index, FileIndexEntry* entry) const
+{
+    assert(entry != nullptr);
+
+    if (frames_.empty() || (block_index > block_count_))
+    {
+        return false;
+    }
+
+    auto compare = [](uint64_t value, const FileIndexEntry& element) { return value < element.block_index; };
+
+    // Frame and checkpoint entries are both sorted by block index. Take the closest preceding entry from either list.
+    auto frame = std::upper_bound(frames_.begin(), frames_.end(), block_index, compare);
+    assert(frame != frames_.begin());
+    *entry = *(--frame);
+
+    auto checkpoint = std::upper_bound(checkpoints_.begin(), checkpoints_.end(), block_index, compare);
+    if (checkpoint != checkpoints_.begin())
+    {
+        --checkpoint;
+        if (checkpoint->block_index > entry->block_index)
+        {
+            *entry = *checkpoint;
+        }
+    }
+
+    return true;
+}
+
+GFXRECON_END_NAMESPACE(format)
+GFXRECON_END_NAMESPACE(gfxrecon)
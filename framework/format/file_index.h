@@ -0,0 +1,133 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+/// @file Index of frame and block locations within a capture file, stored in a sidecar file next to the capture file.
+#ifndef GFXRECON_FORMAT_FILE_INDEX_H
+#define GFXRECON_FORMAT_FILE_INDEX_H
+
+#include "format/api_call_id.h"
+#include "format/format.h"
+#include "util/defines.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(format)
+
+#define GFXRECON_FILE_INDEX_FOURCC GFXRECON_MAKE_FOURCC('G', 'F', 'X', 'I')
+
+const uint32_t kFileIndexVersion            = 2;
+const char     kFileIndexExtension[]        = ".idx";
+const uint64_t kFileIndexCheckpointInterval = 4096; // Number of blocks between block checkpoint entries.
+
+// Location of a block in the capture file, with the frame number that a FileProcessor reports when it is about to
+// process the block.
+struct FileIndexEntry
+{
+    uint64_t frame_number{ 0 };
+    uint64_t block_index{ 0 };
+    uint64_t offset{ 0 };
+};
+
+struct FileIndexStateMarker
+{
+    MarkerType     marker_type{ MarkerType::kUnknownMarker };
+    uint64_t       captured_frame_number{ 0 }; // Frame number stored in the state marker block.
+    FileIndexEntry location;
+};
+
+// Location of a content data block, which the fill memory content blocks that follow it may reference.
+struct FileIndexContentBlock
+{
+    uint64_t       content_id{ 0 };
+    FileIndexEntry location;
+};
+
+class FileIndex
+{
+  public:
+    static std::string GetIndexFilename(const std::string& capture_filename)
+    {
+        return capture_filename + kFileIndexExtension;
+    }
+
+    // Frame ending API calls, used to count frames for capture files without frame markers.
+    static bool IsFrameDelimiterApiCall(ApiCallId call_id);
+
+    // Builds the index by reading the block headers of a capture file.  Block data is skipped, so the cost is
+    // proportional to the number of blocks rather than the size of the file.
+    bool Build(const std::string& capture_filename);
+
+    // Loads an index file.  Fails if the index was not built from the current contents of the capture file, as
+    // determined by the size of the file.
+    bool Load(const std::string& index_filename, const std::string& capture_filename);
+
+    bool Save(const std::string& index_filename) const;
+
+    void Clear();
+
+    bool IsEmpty() const { return frames_.empty(); }
+
+    bool UsesFrameMarkers() const { return uses_frame_markers_; }
+
+    // Returns true if a FileProcessor resuming at the entry will count frames with frame markers instead of frame
+    // ending API calls, because the first end of frame marker precedes the entry.
+    bool UsesFrameMarkersAt(const FileIndexEntry& entry) const
+    {
+        return uses_frame_markers_ && (entry.block_index > first_frame_marker_block_);
+    }
+
+    uint64_t GetCaptureFileSize() const { return capture_file_size_; }
+
+    uint64_t GetBlockCount() const { return block_count_; }
+
+    // Entry i is the first block of frame i.  The last entry may reference the end of the file.
+    const std::vector<FileIndexEntry>& GetFrames() const { return frames_; }
+
+    const std::vector<FileIndexStateMarker>& GetStateMarkers() const { return state_markers_; }
+
+    // Content data blocks, sorted by block index.  A FileProcessor that seeks past content data blocks reads them from
+    // these locations.
+    const std::vector<FileIndexContentBlock>& GetContentBlocks() const { return content_blocks_; }
+
+    bool FindFrame(uint64_t frame_number, FileIndexEntry* entry) const;
+
+    // Finds the indexed location closest to, but not after, the specified block.
+    bool FindBlock(uint64_t block_index, FileIndexEntry* entry) const;
+
+  private:
+    bool                               uses_frame_markers_{ false };
+    uint64_t                           first_frame_marker_block_{ 0 };
+    uint64_t                           capture_file_size_{ 0 };
+    uint64_t                           block_count_{ 0 };
+    std::vector<FileIndexEntry>        frames_;
+    std::vector<FileIndexEntry>        checkpoints_;
+    std::vector<FileIndexStateMarker>  state_markers_;
+    std::vector<FileIndexContentBlock> content_blocks_;
+};
+
+GFXRECON_END_NAMESPACE(format)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_FORMAT_FILE_INDEX_H
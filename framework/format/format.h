@@ -156,6 +156,8 @@ enum class MetaDataType : uint16_t
     kReserved31                             = 31,
     kSetEnvironmentVariablesCommand         = 32,
     kViewRelativeLocation                   = 33,
+    kContentDataCommand                     = 34,
+    kFillMemoryContentCommand               = 35,
 };
 
 // MetaDataId is stored in the capture file and its type must be uint32_t to avoid breaking capture file compatibility.
@@ -187,9 +189,15 @@ enum CompressionType : uint32_t
 
 enum FileOption : uint32_t
 {
-    kUnknownFileOption = 0,
-    kCompressionType   = 1, // One of the CompressionType values defining the compression algorithm used with parameter
-                            // encoding. Default = CompressionType::kNone.
+    kUnknownFileOption    = 0,
+    kCompressionType      = 1, // One of the CompressionType values defining the compression algorithm used with
+                               // parameter encoding. Default = CompressionType::kNone.
+    kContentDeduplication = 2, // Maximum total size, in MiB, of the data stored by content data blocks, which is the
+                               // memory that a file reader needs to keep the data that fill memory content blocks
+                               // reference.  Default = 0, which indicates that content deduplication is disabled.
+    kCompactEncoding      = 3, // Non-zero when integer parameter values, pointer attribute masks, and array lengths are
+                               // encoded as LEB128 varints, and the elements of handle ID arrays as varints of the
+                               // zigzag coded difference from the previous element.  Default = 0.
 };
 
 enum PointerAttributes : uint32_t
@@ -223,6 +231,8 @@ enum ResizeWindowPreTransform : uint32_t
 struct EnabledOptions
 {
     CompressionType compression_type{ CompressionType::kNone };
+    uint32_t        content_deduplication_limit{ 0 }; // Size limit in MiB for stored content.  0 disables deduplication.
+    bool            compact_encoding{ false };        // Parameters are encoded with varints.
 };
 
 // Resource values are values contained in resource data that may require special handling (e.g., mapping for replay).
@@ -329,6 +339,27 @@ struct FillMemoryCommandHeader
     uint64_t memory_size;   // Uncompressed size of the data encoded after the header.
 };
 
+// Stores data that is referenced by one or more FillMemoryContentCommandHeader blocks.  Content data blocks are not
+// processed by API decoders; the file processor keeps the data until the end of the file.
+struct ContentDataCommandHeader
+{
+    MetaDataHeader   meta_header;
+    format::ThreadId thread_id;
+    uint64_t         content_id; // Unique ID for the content within the capture file.
+    uint64_t         data_size;  // Uncompressed size of the data encoded after the header.
+};
+
+// Fill memory command with data from a content data block that was written earlier in the capture file.
+struct FillMemoryContentCommandHeader
+{
+    MetaDataHeader   meta_header;
+    format::ThreadId thread_id;
+    HandleId         memory_id;
+    uint64_t         memory_offset; // Offset from the start of the mapped pointer, not the start of the memory object.
+    uint64_t         memory_size;   // Size of the content referenced by content_id.
+    uint64_t         content_id;
+};
+
 struct FillMemoryResourceValueCommandHeader
 {
     MetaDataHeader   meta_header;
@@ -46,7 +46,7 @@ bool ValidateFileHeader(const FileHeader& header)
     return valid;
 }
 
-util::Compressor* CreateCompressor(CompressionType type)
+util::Compressor* CreateCompressor(CompressionType type, int32_t compression_level)
 {
     util::Compressor* compressor = nullptr;
 
@@ -54,7 +54,7 @@ util::Compressor* CreateCompressor(CompressionType type)
     {
         case kLz4:
 #if defined(GFXRECON_ENABLE_LZ4_COMPRESSION)
-            compressor = new util::Lz4Compressor();
+            compressor = new util::Lz4Compressor(compression_level);
 #else
             GFXRECON_LOG_ERROR(
                 "Failed to initialize compression module: Application was built with LZ4 compression disabled.");
@@ -62,7 +62,7 @@ util::Compressor* CreateCompressor(CompressionType type)
             break;
         case kZlib:
 #if defined(GFXRECON_ENABLE_ZLIB_COMPRESSION)
-            compressor = new util::ZlibCompressor();
+            compressor = new util::ZlibCompressor(compression_level);
 #else
             GFXRECON_LOG_ERROR(
                 "Failed to initialize compression module: Application was built with zlib compression disabled.");
@@ -70,7 +70,7 @@ util::Compressor* CreateCompressor(CompressionType type)
             break;
         case kZstd:
 #if defined(GFXRECON_ENABLE_ZSTD_COMPRESSION)
-            compressor = new util::ZstdCompressor();
+            compressor = new util::ZstdCompressor(compression_level);
 #else
             GFXRECON_LOG_ERROR(
                 "Failed to initialize compression module: Application was built with Zstandard compression disabled.");
@@ -91,7 +91,8 @@ constexpr size_t GetAnnotationBlockBaseSize()
 bool ValidateFileHeader(const FileHeader& header);
 
 // Utilities for object creation.
-util::Compressor* CreateCompressor(CompressionType type);
+util::Compressor* CreateCompressor(CompressionType type,
+                                   int32_t         compression_level = util::kDefaultCompressionLevel);
 
 std::string GetCompressionTypeName(CompressionType type);
 
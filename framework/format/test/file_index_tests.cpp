@@ -0,0 +1,347 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "format/file_index.h"
+#include "format/format.h"
+#include "format/format_util.h"
+#include "util/platform.h"
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace gfxrecon;
+
+namespace
+{
+
+const char kCaptureFilename[] = "gfxrecon_file_index_test.gfxr";
+
+// Writes a capture file with the block types that the index records.
+class CaptureWriter
+{
+  public:
+    CaptureWriter(const std::string& filename) : file_(nullptr), block_count_(0)
+    {
+        util::platform::FileOpen(&file_, filename.c_str(), "wb");
+        REQUIRE(file_ != nullptr);
+
+        format::FileHeader header = { GFXRECON_FOURCC, 0, 0, 0 };
+        Write(&header, sizeof(header));
+    }
+
+    ~CaptureWriter() { Close(); }
+
+    void Close()
+    {
+        if (file_ != nullptr)
+        {
+            util::platform::FileClose(file_);
+            file_ = nullptr;
+        }
+    }
+
+    uint64_t GetOffset() const { return static_cast<uint64_t>(util::platform::FileTell(file_)); }
+
+    uint64_t GetBlockCount() const { return block_count_; }
+
+    void WriteFunctionCall(format::ApiCallId call_id)
+    {
+        const uint64_t parameters = 0;
+
+        format::FunctionCallHeader header;
+        header.block_header.type = format::BlockType::kFunctionCallBlock;
+        header.block_header.size = sizeof(header) - sizeof(header.block_header) + sizeof(parameters);
+        header.api_call_id       = call_id;
+        header.thread_id         = 1;
+
+        Write(&header, sizeof(header));
+        Write(&parameters, sizeof(parameters));
+        ++block_count_;
+    }
+
+    void WriteMarker(format::BlockType type, format::MarkerType marker_type, uint64_t frame_number)
+    {
+        format::Marker marker;
+        marker.header.type  = type;
+        marker.header.size  = sizeof(marker) - sizeof(marker.header);
+        marker.marker_type  = marker_type;
+        marker.frame_number = frame_number;
+
+        Write(&marker, sizeof(marker));
+        ++block_count_;
+    }
+
+    void WriteContentData(uint64_t content_id, const std::vector<uint8_t>& data)
+    {
+        format::ContentDataCommandHeader header;
+        header.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+        header.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(header) + data.size();
+        header.meta_header.meta_data_id =
+            format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan, format::MetaDataType::kContentDataCommand);
+        header.thread_id  = 1;
+        header.content_id = content_id;
+        header.data_size  = data.size();
+
+        Write(&header, sizeof(header));
+        Write(data.data(), data.size());
+        ++block_count_;
+    }
+
+  private:
+    void Write(const void* data, size_t size) { REQUIRE(util::platform::FileWrite(data, size, file_)); }
+
+  private:
+    FILE*    file_;
+    uint64_t block_count_;
+};
+
+void CheckEntry(const format::FileIndexEntry& entry, const format::FileIndexEntry& expected)
+{
+    CHECK(entry.frame_number == expected.frame_number);
+    CHECK(entry.block_index == expected.block_index);
+    CHECK(entry.offset == expected.offset);
+}
+
+} // namespace
+
+TEST_CASE("FileIndex records frames and content data blocks", "[file_index][pre_submit]")
+{
+    std::vector<format::FileIndexEntry> expected_frames;
+    std::vector<uint64_t>               content_offsets;
+
+    {
+        CaptureWriter writer(kCaptureFilename);
+
+        // Three frames delimited by present calls, each with a content data block after its first call.
+        for (uint64_t frame = 0; frame < 3; ++frame)
+        {
+            expected_frames.push_back({ frame, writer.GetBlockCount(), writer.GetOffset() });
+
+            writer.WriteFunctionCall(format::ApiCallId::ApiCall_vkQueueSubmit);
+            content_offsets.push_back(writer.GetOffset());
+            writer.WriteContentData(frame + 10, std::vector<uint8_t>(300, static_cast<uint8_t>(frame)));
+            writer.WriteFunctionCall(format::ApiCallId::ApiCall_vkQueuePresentKHR);
+        }
+
+        // The index ends with an entry for the end of the file.
+        expected_frames.push_back({ 3, writer.GetBlockCount(), writer.GetOffset() });
+    }
+
+    format::FileIndex file_index;
+    REQUIRE(file_index.Build(kCaptureFilename));
+
+    CHECK_FALSE(file_index.UsesFrameMarkers());
+    CHECK(file_index.GetBlockCount() == 9);
+
+    const auto& frames = file_index.GetFrames();
+    REQUIRE(frames.size() == expected_frames.size());
+    for (size_t i = 0; i < frames.size(); ++i)
+    {
+        CheckEntry(frames[i], expected_frames[i]);
+    }
+
+    const auto& content_blocks = file_index.GetContentBlocks();
+    REQUIRE(content_blocks.size() == 3);
+    for (uint64_t i = 0; i < content_blocks.size(); ++i)
+    {
+        CHECK(content_blocks[i].content_id == i + 10);
+        CheckEntry(content_blocks[i].location, { i, (i * 3) + 1, content_offsets[i] });
+    }
+
+    std::remove(kCaptureFilename);
+}
+
+TEST_CASE("FileIndex counts frames from the first frame marker", "[file_index][pre_submit]")
+{
+    uint64_t state_marker_offset = 0;
+    uint64_t frame_1_offset      = 0;
+
+    {
+        CaptureWriter writer(kCaptureFilename);
+
+        // Frame ending API calls before the first frame marker are not counted once the marker is found.
+        writer.WriteFunctionCall(format::ApiCallId::ApiCall_vkQueuePresentKHR);
+        state_marker_offset = writer.GetOffset();
+        writer.WriteMarker(format::BlockType::kStateMarkerBlock, format::MarkerType::kEndMarker, 100);
+        writer.WriteFunctionCall(format::ApiCallId::ApiCall_vkQueuePresentKHR);
+        writer.WriteMarker(format::BlockType::kFrameMarkerBlock, format::MarkerType::kEndMarker, 101);
+        frame_1_offset = writer.GetOffset();
+        writer.WriteFunctionCall(format::ApiCallId::ApiCall_vkQueuePresentKHR);
+        writer.WriteMarker(format::BlockType::kFrameMarkerBlock, format::MarkerType::kEndMarker, 102);
+    }
+
+    format::FileIndex file_index;
+    REQUIRE(file_index.Build(kCaptureFilename));
+
+    CHECK(file_index.UsesFrameMarkers());
+
+    const auto& frames = file_index.GetFrames();
+    REQUIRE(frames.size() == 3);
+    CheckEntry(frames[1], { 1, 4, frame_1_offset });
+
+    const auto& state_markers = file_index.GetStateMarkers();
+    REQUIRE(state_markers.size() == 1);
+    CHECK(state_markers[0].marker_type == format::MarkerType::kEndMarker);
+    CHECK(state_markers[0].captured_frame_number == 100);
+    CHECK(state_markers[0].location.offset == state_marker_offset);
+
+    // Blocks before the first frame marker were counted with frame ending API calls.
+    CHECK_FALSE(file_index.UsesFrameMarkersAt(frames[0]));
+    CHECK(file_index.UsesFrameMarkersAt(frames[1]));
+
+    std::remove(kCaptureFilename);
+}
+
+TEST_CASE("FileIndex finds the closest indexed location for frames and blocks", "[file_index][pre_submit]")
+{
+    // Enough blocks for several checkpoint entries, with long frames between the checkpoints.
+    const uint64_t kBlockCount     = (format::kFileIndexCheckpointInterval * 3) + 10;
+    const uint64_t kFrameBlockSize = format::kFileIndexCheckpointInterval + 1000;
+
+    std::vector<uint64_t> block_offsets;
+
+    {
+        CaptureWriter writer(kCaptureFilename);
+
+        for (uint64_t i = 0; i < kBlockCount; ++i)
+        {
+            block_offsets.push_back(writer.GetOffset());
+
+            if (((i + 1) % kFrameBlockSize) == 0)
+            {
+                writer.WriteFunctionCall(format::ApiCallId::ApiCall_vkQueuePresentKHR);
+            }
+            else
+            {
+                writer.WriteFunctionCall(format::ApiCallId::ApiCall_vkCmdDraw);
+            }
+        }
+    }
+
+    format::FileIndex file_index;
+    REQUIRE(file_index.Build(kCaptureFilename));
+    REQUIRE(file_index.GetBlockCount() == kBlockCount);
+
+    format::FileIndexEntry entry;
+
+    SECTION("Frames")
+    {
+        REQUIRE(file_index.FindFrame(1, &entry));
+        CheckEntry(entry, { 1, kFrameBlockSize, block_offsets[kFrameBlockSize] });
+
+        REQUIRE(file_index.FindFrame(2, &entry));
+        CheckEntry(entry, { 2, kFrameBlockSize * 2, block_offsets[kFrameBlockSize * 2] });
+
+        CHECK_FALSE(file_index.FindFrame(file_index.GetFrames().size(), &entry));
+    }
+
+    SECTION("Blocks")
+    {
+        // A checkpoint is closer than the start of the frame.
+        const uint64_t checkpoint = format::kFileIndexCheckpointInterval * 2;
+        REQUIRE(file_index.FindBlock(checkpoint + 5, &entry));
+        CheckEntry(entry, { checkpoint / kFrameBlockSize, checkpoint, block_offsets[checkpoint] });
+
+        // The start of the frame is closer than the checkpoint.
+        REQUIRE(file_index.FindBlock(kFrameBlockSize + 5, &entry));
+        CheckEntry(entry, { 1, kFrameBlockSize, block_offsets[kFrameBlockSize] });
+
+        REQUIRE(file_index.FindBlock(0, &entry));
+        CheckEntry(entry, { 0, 0, block_offsets[0] });
+
+        CHECK_FALSE(file_index.FindBlock(kBlockCount + 1, &entry));
+    }
+
+    std::remove(kCaptureFilename);
+}
+
+TEST_CASE("FileIndex saves and loads index files that match the capture file", "[file_index][pre_submit]")
+{
+    const std::string index_filename = format::FileIndex::GetIndexFilename(kCaptureFilename);
+
+    {
+        CaptureWriter writer(kCaptureFilename);
+        writer.WriteMarker(format::BlockType::kStateMarkerBlock, format::MarkerType::kBeginMarker, 5);
+        writer.WriteContentData(1, std::vector<uint8_t>(256, 1));
+        writer.WriteMarker(format::BlockType::kStateMarkerBlock, format::MarkerType::kEndMarker, 5);
+        writer.WriteFunctionCall(format::ApiCallId::ApiCall_vkQueuePresentKHR);
+        writer.WriteContentData(2, std::vector<uint8_t>(512, 2));
+        writer.WriteFunctionCall(format::ApiCallId::ApiCall_vkQueuePresentKHR);
+    }
+
+    format::FileIndex built_index;
+    REQUIRE(built_index.Build(kCaptureFilename));
+    REQUIRE(built_index.Save(index_filename));
+
+    format::FileIndex loaded_index;
+    REQUIRE(loaded_index.Load(index_filename, kCaptureFilename));
+
+    CHECK(loaded_index.GetCaptureFileSize() == built_index.GetCaptureFileSize());
+    CHECK(loaded_index.GetBlockCount() == built_index.GetBlockCount());
+    CHECK(loaded_index.UsesFrameMarkers() == built_index.UsesFrameMarkers());
+
+    REQUIRE(loaded_index.GetFrames().size() == built_index.GetFrames().size());
+    for (size_t i = 0; i < built_index.GetFrames().size(); ++i)
+    {
+        CheckEntry(loaded_index.GetFrames()[i], built_index.GetFrames()[i]);
+    }
+
+    REQUIRE(loaded_index.GetStateMarkers().size() == 2);
+    for (size_t i = 0; i < 2; ++i)
+    {
+        const auto& expected = built_index.GetStateMarkers()[i];
+        const auto& loaded   = loaded_index.GetStateMarkers()[i];
+        CHECK(loaded.marker_type == expected.marker_type);
+        CHECK(loaded.captured_frame_number == expected.captured_frame_number);
+        CheckEntry(loaded.location, expected.location);
+    }
+
+    REQUIRE(loaded_index.GetContentBlocks().size() == 2);
+    for (size_t i = 0; i < 2; ++i)
+    {
+        const auto& expected = built_index.GetContentBlocks()[i];
+        const auto& loaded   = loaded_index.GetContentBlocks()[i];
+        CHECK(loaded.content_id == expected.content_id);
+        CheckEntry(loaded.location, expected.location);
+    }
+
+    // An index built before the capture file was modified is rejected.
+    {
+        FILE* file = nullptr;
+        util::platform::FileOpen(&file, kCaptureFilename, "ab");
+        REQUIRE(file != nullptr);
+
+        const uint8_t data = 0;
+        REQUIRE(util::platform::FileWrite(&data, sizeof(data), file));
+        util::platform::FileClose(file);
+    }
+
+    CHECK_FALSE(loaded_index.Load(index_filename, kCaptureFilename));
+    CHECK(loaded_index.IsEmpty());
+
+    std::remove(index_filename.c_str());
+    std::remove(kCaptureFilename);
+}
@@ -146,7 +146,8 @@ class BaseDecoderBodyGenerator():
 
     def make_decode_invocation(self, value):
         """Generate parameter decode function/method invocation."""
-        buffer_args = '(parameter_buffer + bytes_read), (buffer_size - bytes_read)'
+        address_args = '(parameter_buffer + bytes_read), (buffer_size - bytes_read)'
+        buffer_args = address_args + ', call_info.compact_encoding'
         body = ''
 
         is_struct = False
@@ -179,7 +180,7 @@ class BaseDecoderBodyGenerator():
                 else:
                     # Pointer to an unknown object type, encoded as a 64-bit integer ID.
                     body += '    bytes_read += ValueDecoder::DecodeAddress({}, &{});\n'.format(
-                        buffer_args, value.name
+                        address_args, value.name
                     )
             else:
                 if is_struct or is_string or is_handle or (
@@ -208,7 +209,7 @@ class BaseDecoderBodyGenerator():
                 )
             elif is_funcp:
                 body += '    bytes_read += ValueDecoder::DecodeAddress({}, &{});\n'.format(
-                    buffer_args, value.name
+                    address_args, value.name
                 )
             elif is_handle:
                 body += '    bytes_read += ValueDecoder::DecodeHandleIdValue({}, &{});\n'.format(
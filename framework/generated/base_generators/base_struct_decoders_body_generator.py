@@ -32,7 +32,7 @@ class BaseStructDecodersBodyGenerator():
         first = True
         for struct in self.get_filtered_struct_names():
             body = '' if first else '\n'
-            body += 'size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_{}* wrapper)\n'.format(
+            body += 'size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_{}* wrapper)\n'.format(
                 struct
             )
             body += '{\n'
@@ -58,7 +58,7 @@ class BaseStructDecodersBodyGenerator():
         for value in values:
             # pNext fields require special treatment and are not processed by type name
             if 'pNext' in value.name and value.base_type == 'void':
-                body += '    bytes_read += DecodePNextStruct((buffer + bytes_read), (buffer_size - bytes_read), &(wrapper->{}));\n'.format(
+                body += '    bytes_read += DecodePNextStruct((buffer + bytes_read), (buffer_size - bytes_read), compact_encoding, &(wrapper->{}));\n'.format(
                     value.name
                 )
                 body += '    value->pNext = wrapper->pNext ? wrapper->pNext->GetPointer() : nullptr;\n'
@@ -71,7 +71,8 @@ class BaseStructDecodersBodyGenerator():
 
     def make_decode_invocation(self, name, value):
         """Generate the struct member decoder function call invocation."""
-        buffer_args = '(buffer + bytes_read), (buffer_size - bytes_read)'
+        address_args = '(buffer + bytes_read), (buffer_size - bytes_read)'
+        buffer_args = address_args + ', compact_encoding'
 
         body = ''
 
@@ -102,7 +103,7 @@ class BaseStructDecodersBodyGenerator():
             if type_name in self.EXTERNAL_OBJECT_TYPES and not value.is_array:
                 # Pointer to an unknown object type, encoded as a 64-bit integer ID.
                 body += '    bytes_read += ValueDecoder::DecodeAddress({}, &(wrapper->{}));\n'.format(
-                    buffer_args, value.name
+                    address_args, value.name
                 )
                 body += '    value->{} = nullptr;\n'.format(value.name)
             else:
@@ -187,7 +188,7 @@ class BaseStructDecodersBodyGenerator():
                 )
             elif is_funcp:
                 body += '    bytes_read += ValueDecoder::DecodeAddress({}, &(wrapper->{}));\n'.format(
-                    buffer_args, value.name
+                    address_args, value.name
                 )
                 body += '    value->{} = nullptr;\n'.format(value.name)
             elif is_handle:
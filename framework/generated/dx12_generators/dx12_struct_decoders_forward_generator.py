@@ -78,7 +78,7 @@ class Dx12StructDecodersForwardGenerator(
 
     def get_struct_function(self, name, properties):
         code = (
-            'size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, Decoded_{}* wrapper)'
+            'size_t DecodeStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, Decoded_{}* wrapper)'
             .format(name)
         )
         code += self.get_struct_function_body(properties)
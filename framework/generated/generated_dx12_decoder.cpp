@@ -1524,9 +1524,9 @@ size_t Dx12Decoder::Decode_CreateDXGIFactory(const ApiCallInfo& call_info, const
     HandlePointerDecoder<void*> ppFactory;
     HRESULT return_value;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppFactory.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppFactory.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -1546,9 +1546,9 @@ size_t Dx12Decoder::Decode_CreateDXGIFactory1(const ApiCallInfo& call_info, cons
     HandlePointerDecoder<void*> ppFactory;
     HRESULT return_value;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppFactory.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppFactory.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -1569,10 +1569,10 @@ size_t Dx12Decoder::Decode_CreateDXGIFactory2(const ApiCallInfo& call_info, cons
     HandlePointerDecoder<void*> ppFactory;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Flags);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppFactory.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Flags);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppFactory.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -1593,10 +1593,10 @@ size_t Dx12Decoder::Decode_DXGIGetDebugInterface1(const ApiCallInfo& call_info,
     HandlePointerDecoder<void*> pDebug;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Flags);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += pDebug.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Flags);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += pDebug.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -1612,7 +1612,7 @@ size_t Dx12Decoder::Decode_DXGIDeclareAdapterRemovalSupport(const ApiCallInfo& c
 
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -1632,11 +1632,11 @@ size_t Dx12Decoder::Decode_D3D12SerializeRootSignature(const ApiCallInfo& call_i
     HandlePointerDecoder<ID3D10Blob*> ppErrorBlob;
     HRESULT return_value;
 
-    bytes_read += pRootSignature.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Version);
-    bytes_read += ppBlob.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ppErrorBlob.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pRootSignature.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Version);
+    bytes_read += ppBlob.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ppErrorBlob.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -1658,11 +1658,11 @@ size_t Dx12Decoder::Decode_D3D12CreateRootSignatureDeserializer(const ApiCallInf
     HandlePointerDecoder<void*> ppRootSignatureDeserializer;
     HRESULT return_value;
 
-    bytes_read += pSrcData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeSizeTValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &SrcDataSizeInBytes);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pRootSignatureDeserializerInterface);
-    bytes_read += ppRootSignatureDeserializer.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pSrcData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeSizeTValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &SrcDataSizeInBytes);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pRootSignatureDeserializerInterface);
+    bytes_read += ppRootSignatureDeserializer.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -1681,10 +1681,10 @@ size_t Dx12Decoder::Decode_D3D12SerializeVersionedRootSignature(const ApiCallInf
     HandlePointerDecoder<ID3D10Blob*> ppErrorBlob;
     HRESULT return_value;
 
-    bytes_read += pRootSignature.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ppBlob.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ppErrorBlob.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pRootSignature.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ppBlob.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ppErrorBlob.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -1706,11 +1706,11 @@ size_t Dx12Decoder::Decode_D3D12CreateVersionedRootSignatureDeserializer(const A
     HandlePointerDecoder<void*> ppRootSignatureDeserializer;
     HRESULT return_value;
 
-    bytes_read += pSrcData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeSizeTValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &SrcDataSizeInBytes);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pRootSignatureDeserializerInterface);
-    bytes_read += ppRootSignatureDeserializer.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pSrcData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeSizeTValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &SrcDataSizeInBytes);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pRootSignatureDeserializerInterface);
+    bytes_read += ppRootSignatureDeserializer.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -1732,11 +1732,11 @@ size_t Dx12Decoder::Decode_D3D12CreateDevice(const ApiCallInfo& call_info, const
     HandlePointerDecoder<void*> ppDevice;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pAdapter);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &MinimumFeatureLevel);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppDevice.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pAdapter);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &MinimumFeatureLevel);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppDevice.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -1756,9 +1756,9 @@ size_t Dx12Decoder::Decode_D3D12GetDebugInterface(const ApiCallInfo& call_info,
     HandlePointerDecoder<void*> ppvDebug;
     HRESULT return_value;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppvDebug.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppvDebug.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -1778,11 +1778,11 @@ size_t Dx12Decoder::Decode_D3D12EnableExperimentalFeatures(const ApiCallInfo& ca
     PointerDecoder<UINT> pConfigurationStructSizes;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumFeatures);
-    bytes_read += pIIDs.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pConfigurationStructs.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pConfigurationStructSizes.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumFeatures);
+    bytes_read += pIIDs.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pConfigurationStructs.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pConfigurationStructSizes.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -1805,10 +1805,10 @@ size_t Dx12Decoder::Decode_D3D12GetInterface(const ApiCallInfo& call_info, const
     HandlePointerDecoder<void*> ppvDebug;
     HRESULT return_value;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &rclsid);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppvDebug.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &rclsid);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppvDebug.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -1829,10 +1829,10 @@ size_t Dx12Decoder::Decode_IDXGIObject_SetPrivateData(format::HandleId object_id
     PointerDecoder<uint8_t> pData;
     HRESULT return_value;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Name);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DataSize);
-    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Name);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DataSize);
+    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -1852,9 +1852,9 @@ size_t Dx12Decoder::Decode_IDXGIObject_SetPrivateDataInterface(format::HandleId
     format::HandleId pUnknown;
     HRESULT return_value;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Name);
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pUnknown);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Name);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pUnknown);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -1875,10 +1875,10 @@ size_t Dx12Decoder::Decode_IDXGIObject_GetPrivateData(format::HandleId object_id
     PointerDecoder<uint8_t> pData;
     HRESULT return_value;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Name);
-    bytes_read += pDataSize.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Name);
+    bytes_read += pDataSize.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -1898,9 +1898,9 @@ size_t Dx12Decoder::Decode_IDXGIObject_GetParent(format::HandleId object_id, con
     HandlePointerDecoder<void*> ppParent;
     HRESULT return_value;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppParent.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppParent.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -1920,9 +1920,9 @@ size_t Dx12Decoder::Decode_IDXGIDeviceSubObject_GetDevice(format::HandleId objec
     HandlePointerDecoder<void*> ppDevice;
     HRESULT return_value;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppDevice.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppDevice.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -1939,8 +1939,8 @@ size_t Dx12Decoder::Decode_IDXGIResource_GetSharedHandle(format::HandleId object
     PointerDecoder<uint64_t, void*> pSharedHandle;
     HRESULT return_value;
 
-    bytes_read += pSharedHandle.DecodeVoidPtr((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pSharedHandle.DecodeVoidPtr((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -1957,8 +1957,8 @@ size_t Dx12Decoder::Decode_IDXGIResource_GetUsage(format::HandleId object_id, co
     PointerDecoder<DXGI_USAGE> pUsage;
     HRESULT return_value;
 
-    bytes_read += pUsage.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pUsage.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -1975,8 +1975,8 @@ size_t Dx12Decoder::Decode_IDXGIResource_SetEvictionPriority(format::HandleId ob
     UINT EvictionPriority;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &EvictionPriority);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &EvictionPriority);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -1993,8 +1993,8 @@ size_t Dx12Decoder::Decode_IDXGIResource_GetEvictionPriority(format::HandleId ob
     PointerDecoder<UINT> pEvictionPriority;
     HRESULT return_value;
 
-    bytes_read += pEvictionPriority.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pEvictionPriority.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2012,9 +2012,9 @@ size_t Dx12Decoder::Decode_IDXGIKeyedMutex_AcquireSync(format::HandleId object_i
     DWORD dwMilliseconds;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Key);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &dwMilliseconds);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Key);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &dwMilliseconds);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2031,8 +2031,8 @@ size_t Dx12Decoder::Decode_IDXGIKeyedMutex_ReleaseSync(format::HandleId object_i
     UINT64 Key;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Key);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Key);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2049,8 +2049,8 @@ size_t Dx12Decoder::Decode_IDXGISurface_GetDesc(format::HandleId object_id, cons
     StructPointerDecoder<Decoded_DXGI_SURFACE_DESC> pDesc;
     HRESULT return_value;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2068,9 +2068,9 @@ size_t Dx12Decoder::Decode_IDXGISurface_Map(format::HandleId object_id, const Ap
     UINT MapFlags;
     HRESULT return_value;
 
-    bytes_read += pLockedRect.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &MapFlags);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pLockedRect.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &MapFlags);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2086,7 +2086,7 @@ size_t Dx12Decoder::Decode_IDXGISurface_Unmap(format::HandleId object_id, const
 
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2104,9 +2104,9 @@ size_t Dx12Decoder::Decode_IDXGISurface1_GetDC(format::HandleId object_id, const
     PointerDecoder<uint64_t, void*> phdc;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Discard);
-    bytes_read += phdc.DecodeVoidPtr((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Discard);
+    bytes_read += phdc.DecodeVoidPtr((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2123,8 +2123,8 @@ size_t Dx12Decoder::Decode_IDXGISurface1_ReleaseDC(format::HandleId object_id, c
     StructPointerDecoder<Decoded_tagRECT> pDirtyRect;
     HRESULT return_value;
 
-    bytes_read += pDirtyRect.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDirtyRect.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2142,9 +2142,9 @@ size_t Dx12Decoder::Decode_IDXGIAdapter_EnumOutputs(format::HandleId object_id,
     HandlePointerDecoder<IDXGIOutput*> ppOutput;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Output);
-    bytes_read += ppOutput.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Output);
+    bytes_read += ppOutput.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2161,8 +2161,8 @@ size_t Dx12Decoder::Decode_IDXGIAdapter_GetDesc(format::HandleId object_id, cons
     StructPointerDecoder<Decoded_DXGI_ADAPTER_DESC> pDesc;
     HRESULT return_value;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2182,9 +2182,9 @@ size_t Dx12Decoder::Decode_IDXGIAdapter_CheckInterfaceSupport(format::HandleId o
     StructPointerDecoder<Decoded_LARGE_INTEGER> pUMDVersion;
     HRESULT return_value;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &InterfaceName);
-    bytes_read += pUMDVersion.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &InterfaceName);
+    bytes_read += pUMDVersion.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2201,8 +2201,8 @@ size_t Dx12Decoder::Decode_IDXGIOutput_GetDesc(format::HandleId object_id, const
     StructPointerDecoder<Decoded_DXGI_OUTPUT_DESC> pDesc;
     HRESULT return_value;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2222,11 +2222,11 @@ size_t Dx12Decoder::Decode_IDXGIOutput_GetDisplayModeList(format::HandleId objec
     StructPointerDecoder<Decoded_DXGI_MODE_DESC> pDesc;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &EnumFormat);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Flags);
-    bytes_read += pNumModes.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &EnumFormat);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Flags);
+    bytes_read += pNumModes.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2245,10 +2245,10 @@ size_t Dx12Decoder::Decode_IDXGIOutput_FindClosestMatchingMode(format::HandleId
     format::HandleId pConcernedDevice;
     HRESULT return_value;
 
-    bytes_read += pModeToMatch.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pClosestMatch.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pConcernedDevice);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pModeToMatch.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pClosestMatch.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pConcernedDevice);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2264,7 +2264,7 @@ size_t Dx12Decoder::Decode_IDXGIOutput_WaitForVBlank(format::HandleId object_id,
 
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2282,9 +2282,9 @@ size_t Dx12Decoder::Decode_IDXGIOutput_TakeOwnership(format::HandleId object_id,
     BOOL Exclusive;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pDevice);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Exclusive);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pDevice);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Exclusive);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2315,8 +2315,8 @@ size_t Dx12Decoder::Decode_IDXGIOutput_GetGammaControlCapabilities(format::Handl
     StructPointerDecoder<Decoded_DXGI_GAMMA_CONTROL_CAPABILITIES> pGammaCaps;
     HRESULT return_value;
 
-    bytes_read += pGammaCaps.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pGammaCaps.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2333,8 +2333,8 @@ size_t Dx12Decoder::Decode_IDXGIOutput_SetGammaControl(format::HandleId object_i
     StructPointerDecoder<Decoded_DXGI_GAMMA_CONTROL> pArray;
     HRESULT return_value;
 
-    bytes_read += pArray.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pArray.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2351,8 +2351,8 @@ size_t Dx12Decoder::Decode_IDXGIOutput_GetGammaControl(format::HandleId object_i
     StructPointerDecoder<Decoded_DXGI_GAMMA_CONTROL> pArray;
     HRESULT return_value;
 
-    bytes_read += pArray.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pArray.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2369,8 +2369,8 @@ size_t Dx12Decoder::Decode_IDXGIOutput_SetDisplaySurface(format::HandleId object
     format::HandleId pScanoutSurface;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pScanoutSurface);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pScanoutSurface);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2387,8 +2387,8 @@ size_t Dx12Decoder::Decode_IDXGIOutput_GetDisplaySurfaceData(format::HandleId ob
     format::HandleId pDestination;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pDestination);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pDestination);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2405,8 +2405,8 @@ size_t Dx12Decoder::Decode_IDXGIOutput_GetFrameStatistics(format::HandleId objec
     StructPointerDecoder<Decoded_DXGI_FRAME_STATISTICS> pStats;
     HRESULT return_value;
 
-    bytes_read += pStats.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pStats.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2424,9 +2424,9 @@ size_t Dx12Decoder::Decode_IDXGISwapChain_Present(format::HandleId object_id, co
     UINT Flags;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &SyncInterval);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Flags);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &SyncInterval);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Flags);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2447,10 +2447,10 @@ size_t Dx12Decoder::Decode_IDXGISwapChain_GetBuffer(format::HandleId object_id,
     HandlePointerDecoder<void*> ppSurface;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Buffer);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Buffer);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2468,9 +2468,9 @@ size_t Dx12Decoder::Decode_IDXGISwapChain_SetFullscreenState(format::HandleId ob
     format::HandleId pTarget;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Fullscreen);
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pTarget);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Fullscreen);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pTarget);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2488,9 +2488,9 @@ size_t Dx12Decoder::Decode_IDXGISwapChain_GetFullscreenState(format::HandleId ob
     HandlePointerDecoder<IDXGIOutput*> ppTarget;
     HRESULT return_value;
 
-    bytes_read += pFullscreen.DecodeInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ppTarget.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pFullscreen.DecodeInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ppTarget.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2507,8 +2507,8 @@ size_t Dx12Decoder::Decode_IDXGISwapChain_GetDesc(format::HandleId object_id, co
     StructPointerDecoder<Decoded_DXGI_SWAP_CHAIN_DESC> pDesc;
     HRESULT return_value;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2529,12 +2529,12 @@ size_t Dx12Decoder::Decode_IDXGISwapChain_ResizeBuffers(format::HandleId object_
     UINT SwapChainFlags;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &BufferCount);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Width);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Height);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NewFormat);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &SwapChainFlags);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &BufferCount);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Width);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Height);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NewFormat);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &SwapChainFlags);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2551,8 +2551,8 @@ size_t Dx12Decoder::Decode_IDXGISwapChain_ResizeTarget(format::HandleId object_i
     StructPointerDecoder<Decoded_DXGI_MODE_DESC> pNewTargetParameters;
     HRESULT return_value;
 
-    bytes_read += pNewTargetParameters.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pNewTargetParameters.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2569,8 +2569,8 @@ size_t Dx12Decoder::Decode_IDXGISwapChain_GetContainingOutput(format::HandleId o
     HandlePointerDecoder<IDXGIOutput*> ppOutput;
     HRESULT return_value;
 
-    bytes_read += ppOutput.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ppOutput.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2587,8 +2587,8 @@ size_t Dx12Decoder::Decode_IDXGISwapChain_GetFrameStatistics(format::HandleId ob
     StructPointerDecoder<Decoded_DXGI_FRAME_STATISTICS> pStats;
     HRESULT return_value;
 
-    bytes_read += pStats.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pStats.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2605,8 +2605,8 @@ size_t Dx12Decoder::Decode_IDXGISwapChain_GetLastPresentCount(format::HandleId o
     PointerDecoder<UINT> pLastPresentCount;
     HRESULT return_value;
 
-    bytes_read += pLastPresentCount.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pLastPresentCount.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2624,9 +2624,9 @@ size_t Dx12Decoder::Decode_IDXGIFactory_EnumAdapters(format::HandleId object_id,
     HandlePointerDecoder<IDXGIAdapter*> ppAdapter;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Adapter);
-    bytes_read += ppAdapter.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Adapter);
+    bytes_read += ppAdapter.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2645,8 +2645,8 @@ size_t Dx12Decoder::Decode_IDXGIFactory_MakeWindowAssociation(format::HandleId o
     HRESULT return_value;
 
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &WindowHandle);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Flags);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Flags);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2663,8 +2663,8 @@ size_t Dx12Decoder::Decode_IDXGIFactory_GetWindowAssociation(format::HandleId ob
     PointerDecoder<uint64_t, void*> pWindowHandle;
     HRESULT return_value;
 
-    bytes_read += pWindowHandle.DecodeVoidPtr((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pWindowHandle.DecodeVoidPtr((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2683,10 +2683,10 @@ size_t Dx12Decoder::Decode_IDXGIFactory_CreateSwapChain(format::HandleId object_
     HandlePointerDecoder<IDXGISwapChain*> ppSwapChain;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pDevice);
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ppSwapChain.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pDevice);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ppSwapChain.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2705,8 +2705,8 @@ size_t Dx12Decoder::Decode_IDXGIFactory_CreateSoftwareAdapter(format::HandleId o
     HRESULT return_value;
 
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Module);
-    bytes_read += ppAdapter.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ppAdapter.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2723,8 +2723,8 @@ size_t Dx12Decoder::Decode_IDXGIDevice_GetAdapter(format::HandleId object_id, co
     HandlePointerDecoder<IDXGIAdapter*> pAdapter;
     HRESULT return_value;
 
-    bytes_read += pAdapter.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pAdapter.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2745,12 +2745,12 @@ size_t Dx12Decoder::Decode_IDXGIDevice_CreateSurface(format::HandleId object_id,
     HandlePointerDecoder<IDXGISurface*> ppSurface;
     HRESULT return_value;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumSurfaces);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Usage);
-    bytes_read += pSharedResource.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ppSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumSurfaces);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Usage);
+    bytes_read += pSharedResource.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ppSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2769,10 +2769,10 @@ size_t Dx12Decoder::Decode_IDXGIDevice_QueryResourceResidency(format::HandleId o
     UINT NumResources;
     HRESULT return_value;
 
-    bytes_read += ppResources.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pResidencyStatus.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumResources);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ppResources.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pResidencyStatus.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumResources);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2789,8 +2789,8 @@ size_t Dx12Decoder::Decode_IDXGIDevice_SetGPUThreadPriority(format::HandleId obj
     INT Priority;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Priority);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Priority);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2807,8 +2807,8 @@ size_t Dx12Decoder::Decode_IDXGIDevice_GetGPUThreadPriority(format::HandleId obj
     PointerDecoder<INT> pPriority;
     HRESULT return_value;
 
-    bytes_read += pPriority.DecodeInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pPriority.DecodeInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2826,9 +2826,9 @@ size_t Dx12Decoder::Decode_IDXGIFactory1_EnumAdapters1(format::HandleId object_i
     HandlePointerDecoder<IDXGIAdapter1*> ppAdapter;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Adapter);
-    bytes_read += ppAdapter.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Adapter);
+    bytes_read += ppAdapter.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2844,7 +2844,7 @@ size_t Dx12Decoder::Decode_IDXGIFactory1_IsCurrent(format::HandleId object_id, c
 
     BOOL return_value;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2861,8 +2861,8 @@ size_t Dx12Decoder::Decode_IDXGIAdapter1_GetDesc1(format::HandleId object_id, co
     StructPointerDecoder<Decoded_DXGI_ADAPTER_DESC1> pDesc;
     HRESULT return_value;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2879,8 +2879,8 @@ size_t Dx12Decoder::Decode_IDXGIDevice1_SetMaximumFrameLatency(format::HandleId
     UINT MaxLatency;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &MaxLatency);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &MaxLatency);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2897,8 +2897,8 @@ size_t Dx12Decoder::Decode_IDXGIDevice1_GetMaximumFrameLatency(format::HandleId
     PointerDecoder<UINT> pMaxLatency;
     HRESULT return_value;
 
-    bytes_read += pMaxLatency.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pMaxLatency.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2914,7 +2914,7 @@ size_t Dx12Decoder::Decode_IDXGIDisplayControl_IsStereoEnabled(format::HandleId
 
     BOOL return_value;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2930,7 +2930,7 @@ size_t Dx12Decoder::Decode_IDXGIDisplayControl_SetStereoEnabled(format::HandleId
 
     BOOL enabled;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &enabled);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &enabled);
 
     for (auto consumer : GetConsumers())
     {
@@ -2946,7 +2946,7 @@ size_t Dx12Decoder::Decode_IDXGIOutputDuplication_GetDesc(format::HandleId objec
 
     StructPointerDecoder<Decoded_DXGI_OUTDUPL_DESC> pDesc;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -2965,10 +2965,10 @@ size_t Dx12Decoder::Decode_IDXGIOutputDuplication_AcquireNextFrame(format::Handl
     HandlePointerDecoder<IDXGIResource*> ppDesktopResource;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &TimeoutInMilliseconds);
-    bytes_read += pFrameInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ppDesktopResource.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &TimeoutInMilliseconds);
+    bytes_read += pFrameInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ppDesktopResource.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -2987,10 +2987,10 @@ size_t Dx12Decoder::Decode_IDXGIOutputDuplication_GetFrameDirtyRects(format::Han
     PointerDecoder<UINT> pDirtyRectsBufferSizeRequired;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DirtyRectsBufferSize);
-    bytes_read += pDirtyRectsBuffer.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pDirtyRectsBufferSizeRequired.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DirtyRectsBufferSize);
+    bytes_read += pDirtyRectsBuffer.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pDirtyRectsBufferSizeRequired.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3009,10 +3009,10 @@ size_t Dx12Decoder::Decode_IDXGIOutputDuplication_GetFrameMoveRects(format::Hand
     PointerDecoder<UINT> pMoveRectsBufferSizeRequired;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &MoveRectsBufferSize);
-    bytes_read += pMoveRectBuffer.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pMoveRectsBufferSizeRequired.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &MoveRectsBufferSize);
+    bytes_read += pMoveRectBuffer.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pMoveRectsBufferSizeRequired.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3032,11 +3032,11 @@ size_t Dx12Decoder::Decode_IDXGIOutputDuplication_GetFramePointerShape(format::H
     StructPointerDecoder<Decoded_DXGI_OUTDUPL_POINTER_SHAPE_INFO> pPointerShapeInfo;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &PointerShapeBufferSize);
-    bytes_read += pPointerShapeBuffer.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pPointerShapeBufferSizeRequired.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pPointerShapeInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &PointerShapeBufferSize);
+    bytes_read += pPointerShapeBuffer.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pPointerShapeBufferSizeRequired.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pPointerShapeInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3053,8 +3053,8 @@ size_t Dx12Decoder::Decode_IDXGIOutputDuplication_MapDesktopSurface(format::Hand
     StructPointerDecoder<Decoded_DXGI_MAPPED_RECT> pLockedRect;
     HRESULT return_value;
 
-    bytes_read += pLockedRect.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pLockedRect.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3070,7 +3070,7 @@ size_t Dx12Decoder::Decode_IDXGIOutputDuplication_UnMapDesktopSurface(format::Ha
 
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3086,7 +3086,7 @@ size_t Dx12Decoder::Decode_IDXGIOutputDuplication_ReleaseFrame(format::HandleId
 
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3107,10 +3107,10 @@ size_t Dx12Decoder::Decode_IDXGISurface2_GetResource(format::HandleId object_id,
     PointerDecoder<UINT> pSubresourceIndex;
     HRESULT return_value;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppParentResource.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pSubresourceIndex.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppParentResource.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pSubresourceIndex.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3128,9 +3128,9 @@ size_t Dx12Decoder::Decode_IDXGIResource1_CreateSubresourceSurface(format::Handl
     HandlePointerDecoder<IDXGISurface2*> ppSurface;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &index);
-    bytes_read += ppSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &index);
+    bytes_read += ppSurface.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3150,11 +3150,11 @@ size_t Dx12Decoder::Decode_IDXGIResource1_CreateSharedHandle(format::HandleId ob
     PointerDecoder<uint64_t, void*> pHandle;
     HRESULT return_value;
 
-    bytes_read += pAttributes.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &dwAccess);
-    bytes_read += lpName.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pHandle.DecodeVoidPtr((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pAttributes.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &dwAccess);
+    bytes_read += lpName.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pHandle.DecodeVoidPtr((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3173,10 +3173,10 @@ size_t Dx12Decoder::Decode_IDXGIDevice2_OfferResources(format::HandleId object_i
     DXGI_OFFER_RESOURCE_PRIORITY Priority;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumResources);
-    bytes_read += ppResources.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Priority);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumResources);
+    bytes_read += ppResources.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Priority);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3195,10 +3195,10 @@ size_t Dx12Decoder::Decode_IDXGIDevice2_ReclaimResources(format::HandleId object
     PointerDecoder<BOOL> pDiscarded;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumResources);
-    bytes_read += ppResources.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pDiscarded.DecodeInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumResources);
+    bytes_read += ppResources.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pDiscarded.DecodeInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3216,7 +3216,7 @@ size_t Dx12Decoder::Decode_IDXGIDevice2_EnqueueSetEvent(format::HandleId object_
     HRESULT return_value;
 
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &hEvent);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3233,8 +3233,8 @@ size_t Dx12Decoder::Decode_IDXGISwapChain1_GetDesc1(format::HandleId object_id,
     StructPointerDecoder<Decoded_DXGI_SWAP_CHAIN_DESC1> pDesc;
     HRESULT return_value;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3251,8 +3251,8 @@ size_t Dx12Decoder::Decode_IDXGISwapChain1_GetFullscreenDesc(format::HandleId ob
     StructPointerDecoder<Decoded_DXGI_SWAP_CHAIN_FULLSCREEN_DESC> pDesc;
     HRESULT return_value;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3269,8 +3269,8 @@ size_t Dx12Decoder::Decode_IDXGISwapChain1_GetHwnd(format::HandleId object_id, c
     PointerDecoder<uint64_t, void*> pHwnd;
     HRESULT return_value;
 
-    bytes_read += pHwnd.DecodeVoidPtr((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pHwnd.DecodeVoidPtr((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3290,9 +3290,9 @@ size_t Dx12Decoder::Decode_IDXGISwapChain1_GetCoreWindow(format::HandleId object
     HandlePointerDecoder<void*> ppUnk;
     HRESULT return_value;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &refiid);
-    bytes_read += ppUnk.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &refiid);
+    bytes_read += ppUnk.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3311,10 +3311,10 @@ size_t Dx12Decoder::Decode_IDXGISwapChain1_Present1(format::HandleId object_id,
     StructPointerDecoder<Decoded_DXGI_PRESENT_PARAMETERS> pPresentParameters;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &SyncInterval);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &PresentFlags);
-    bytes_read += pPresentParameters.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &SyncInterval);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &PresentFlags);
+    bytes_read += pPresentParameters.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3330,7 +3330,7 @@ size_t Dx12Decoder::Decode_IDXGISwapChain1_IsTemporaryMonoSupported(format::Hand
 
     BOOL return_value;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3347,8 +3347,8 @@ size_t Dx12Decoder::Decode_IDXGISwapChain1_GetRestrictToOutput(format::HandleId
     HandlePointerDecoder<IDXGIOutput*> ppRestrictToOutput;
     HRESULT return_value;
 
-    bytes_read += ppRestrictToOutput.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ppRestrictToOutput.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3365,8 +3365,8 @@ size_t Dx12Decoder::Decode_IDXGISwapChain1_SetBackgroundColor(format::HandleId o
     StructPointerDecoder<Decoded_D3DCOLORVALUE> pColor;
     HRESULT return_value;
 
-    bytes_read += pColor.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pColor.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3383,8 +3383,8 @@ size_t Dx12Decoder::Decode_IDXGISwapChain1_GetBackgroundColor(format::HandleId o
     StructPointerDecoder<Decoded_D3DCOLORVALUE> pColor;
     HRESULT return_value;
 
-    bytes_read += pColor.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pColor.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3401,8 +3401,8 @@ size_t Dx12Decoder::Decode_IDXGISwapChain1_SetRotation(format::HandleId object_i
     DXGI_MODE_ROTATION Rotation;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Rotation);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Rotation);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3419,8 +3419,8 @@ size_t Dx12Decoder::Decode_IDXGISwapChain1_GetRotation(format::HandleId object_i
     PointerDecoder<DXGI_MODE_ROTATION> pRotation;
     HRESULT return_value;
 
-    bytes_read += pRotation.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pRotation.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3436,7 +3436,7 @@ size_t Dx12Decoder::Decode_IDXGIFactory2_IsWindowedStereoEnabled(format::HandleI
 
     BOOL return_value;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3458,13 +3458,13 @@ size_t Dx12Decoder::Decode_IDXGIFactory2_CreateSwapChainForHwnd(format::HandleId
     HandlePointerDecoder<IDXGISwapChain1*> ppSwapChain;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pDevice);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pDevice);
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &hWnd);
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pFullscreenDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pRestrictToOutput);
-    bytes_read += ppSwapChain.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pFullscreenDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pRestrictToOutput);
+    bytes_read += ppSwapChain.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3485,12 +3485,12 @@ size_t Dx12Decoder::Decode_IDXGIFactory2_CreateSwapChainForCoreWindow(format::Ha
     HandlePointerDecoder<IDXGISwapChain1*> ppSwapChain;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pDevice);
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pWindow);
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pRestrictToOutput);
-    bytes_read += ppSwapChain.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pDevice);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pWindow);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pRestrictToOutput);
+    bytes_read += ppSwapChain.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3509,8 +3509,8 @@ size_t Dx12Decoder::Decode_IDXGIFactory2_GetSharedResourceAdapterLuid(format::Ha
     HRESULT return_value;
 
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &hResource);
-    bytes_read += pLuid.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pLuid.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3530,9 +3530,9 @@ size_t Dx12Decoder::Decode_IDXGIFactory2_RegisterStereoStatusWindow(format::Hand
     HRESULT return_value;
 
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &WindowHandle);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &wMsg);
-    bytes_read += pdwCookie.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &wMsg);
+    bytes_read += pdwCookie.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3551,8 +3551,8 @@ size_t Dx12Decoder::Decode_IDXGIFactory2_RegisterStereoStatusEvent(format::Handl
     HRESULT return_value;
 
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &hEvent);
-    bytes_read += pdwCookie.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pdwCookie.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3568,7 +3568,7 @@ size_t Dx12Decoder::Decode_IDXGIFactory2_UnregisterStereoStatus(format::HandleId
 
     DWORD dwCookie;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &dwCookie);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &dwCookie);
 
     for (auto consumer : GetConsumers())
     {
@@ -3588,9 +3588,9 @@ size_t Dx12Decoder::Decode_IDXGIFactory2_RegisterOcclusionStatusWindow(format::H
     HRESULT return_value;
 
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &WindowHandle);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &wMsg);
-    bytes_read += pdwCookie.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &wMsg);
+    bytes_read += pdwCookie.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3609,8 +3609,8 @@ size_t Dx12Decoder::Decode_IDXGIFactory2_RegisterOcclusionStatusEvent(format::Ha
     HRESULT return_value;
 
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &hEvent);
-    bytes_read += pdwCookie.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pdwCookie.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3626,7 +3626,7 @@ size_t Dx12Decoder::Decode_IDXGIFactory2_UnregisterOcclusionStatus(format::Handl
 
     DWORD dwCookie;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &dwCookie);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &dwCookie);
 
     for (auto consumer : GetConsumers())
     {
@@ -3646,11 +3646,11 @@ size_t Dx12Decoder::Decode_IDXGIFactory2_CreateSwapChainForComposition(format::H
     HandlePointerDecoder<IDXGISwapChain1*> ppSwapChain;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pDevice);
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pRestrictToOutput);
-    bytes_read += ppSwapChain.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pDevice);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pRestrictToOutput);
+    bytes_read += ppSwapChain.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3667,8 +3667,8 @@ size_t Dx12Decoder::Decode_IDXGIAdapter2_GetDesc2(format::HandleId object_id, co
     StructPointerDecoder<Decoded_DXGI_ADAPTER_DESC2> pDesc;
     HRESULT return_value;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3688,11 +3688,11 @@ size_t Dx12Decoder::Decode_IDXGIOutput1_GetDisplayModeList1(format::HandleId obj
     StructPointerDecoder<Decoded_DXGI_MODE_DESC1> pDesc;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &EnumFormat);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Flags);
-    bytes_read += pNumModes.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &EnumFormat);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Flags);
+    bytes_read += pNumModes.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3711,10 +3711,10 @@ size_t Dx12Decoder::Decode_IDXGIOutput1_FindClosestMatchingMode1(format::HandleI
     format::HandleId pConcernedDevice;
     HRESULT return_value;
 
-    bytes_read += pModeToMatch.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pClosestMatch.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pConcernedDevice);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pModeToMatch.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pClosestMatch.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pConcernedDevice);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3731,8 +3731,8 @@ size_t Dx12Decoder::Decode_IDXGIOutput1_GetDisplaySurfaceData1(format::HandleId
     format::HandleId pDestination;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pDestination);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pDestination);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3750,9 +3750,9 @@ size_t Dx12Decoder::Decode_IDXGIOutput1_DuplicateOutput(format::HandleId object_
     HandlePointerDecoder<IDXGIOutputDuplication*> ppOutputDuplication;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pDevice);
-    bytes_read += ppOutputDuplication.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pDevice);
+    bytes_read += ppOutputDuplication.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3784,9 +3784,9 @@ size_t Dx12Decoder::Decode_IDXGISwapChain2_SetSourceSize(format::HandleId object
     UINT Height;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Width);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Height);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Width);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Height);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3804,9 +3804,9 @@ size_t Dx12Decoder::Decode_IDXGISwapChain2_GetSourceSize(format::HandleId object
     PointerDecoder<UINT> pHeight;
     HRESULT return_value;
 
-    bytes_read += pWidth.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pHeight.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pWidth.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pHeight.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3823,8 +3823,8 @@ size_t Dx12Decoder::Decode_IDXGISwapChain2_SetMaximumFrameLatency(format::Handle
     UINT MaxLatency;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &MaxLatency);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &MaxLatency);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3841,8 +3841,8 @@ size_t Dx12Decoder::Decode_IDXGISwapChain2_GetMaximumFrameLatency(format::Handle
     PointerDecoder<UINT> pMaxLatency;
     HRESULT return_value;
 
-    bytes_read += pMaxLatency.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pMaxLatency.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3875,8 +3875,8 @@ size_t Dx12Decoder::Decode_IDXGISwapChain2_SetMatrixTransform(format::HandleId o
     StructPointerDecoder<Decoded_DXGI_MATRIX_3X2_F> pMatrix;
     HRESULT return_value;
 
-    bytes_read += pMatrix.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pMatrix.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3893,8 +3893,8 @@ size_t Dx12Decoder::Decode_IDXGISwapChain2_GetMatrixTransform(format::HandleId o
     StructPointerDecoder<Decoded_DXGI_MATRIX_3X2_F> pMatrix;
     HRESULT return_value;
 
-    bytes_read += pMatrix.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pMatrix.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3910,7 +3910,7 @@ size_t Dx12Decoder::Decode_IDXGIOutput2_SupportsOverlays(format::HandleId object
 
     BOOL return_value;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3926,7 +3926,7 @@ size_t Dx12Decoder::Decode_IDXGIFactory3_GetCreationFlags(format::HandleId objec
 
     UINT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3945,10 +3945,10 @@ size_t Dx12Decoder::Decode_IDXGIDecodeSwapChain_PresentBuffer(format::HandleId o
     UINT Flags;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &BufferToPresent);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &SyncInterval);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Flags);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &BufferToPresent);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &SyncInterval);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Flags);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3965,8 +3965,8 @@ size_t Dx12Decoder::Decode_IDXGIDecodeSwapChain_SetSourceRect(format::HandleId o
     StructPointerDecoder<Decoded_tagRECT> pRect;
     HRESULT return_value;
 
-    bytes_read += pRect.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pRect.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -3983,8 +3983,8 @@ size_t Dx12Decoder::Decode_IDXGIDecodeSwapChain_SetTargetRect(format::HandleId o
     StructPointerDecoder<Decoded_tagRECT> pRect;
     HRESULT return_value;
 
-    bytes_read += pRect.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pRect.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4002,9 +4002,9 @@ size_t Dx12Decoder::Decode_IDXGIDecodeSwapChain_SetDestSize(format::HandleId obj
     UINT Height;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Width);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Height);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Width);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Height);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4021,8 +4021,8 @@ size_t Dx12Decoder::Decode_IDXGIDecodeSwapChain_GetSourceRect(format::HandleId o
     StructPointerDecoder<Decoded_tagRECT> pRect;
     HRESULT return_value;
 
-    bytes_read += pRect.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pRect.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4039,8 +4039,8 @@ size_t Dx12Decoder::Decode_IDXGIDecodeSwapChain_GetTargetRect(format::HandleId o
     StructPointerDecoder<Decoded_tagRECT> pRect;
     HRESULT return_value;
 
-    bytes_read += pRect.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pRect.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4058,9 +4058,9 @@ size_t Dx12Decoder::Decode_IDXGIDecodeSwapChain_GetDestSize(format::HandleId obj
     PointerDecoder<UINT> pHeight;
     HRESULT return_value;
 
-    bytes_read += pWidth.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pHeight.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pWidth.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pHeight.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4077,8 +4077,8 @@ size_t Dx12Decoder::Decode_IDXGIDecodeSwapChain_SetColorSpace(format::HandleId o
     DXGI_MULTIPLANE_OVERLAY_YCbCr_FLAGS ColorSpace;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &ColorSpace);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &ColorSpace);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4094,7 +4094,7 @@ size_t Dx12Decoder::Decode_IDXGIDecodeSwapChain_GetColorSpace(format::HandleId o
 
     DXGI_MULTIPLANE_OVERLAY_YCbCr_FLAGS return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4115,12 +4115,12 @@ size_t Dx12Decoder::Decode_IDXGIFactoryMedia_CreateSwapChainForCompositionSurfac
     HandlePointerDecoder<IDXGISwapChain1*> ppSwapChain;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pDevice);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pDevice);
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &hSurface);
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pRestrictToOutput);
-    bytes_read += ppSwapChain.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pRestrictToOutput);
+    bytes_read += ppSwapChain.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4142,13 +4142,13 @@ size_t Dx12Decoder::Decode_IDXGIFactoryMedia_CreateDecodeSwapChainForComposition
     HandlePointerDecoder<IDXGIDecodeSwapChain*> ppSwapChain;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pDevice);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pDevice);
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &hSurface);
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pYuvDecodeBuffers);
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pRestrictToOutput);
-    bytes_read += ppSwapChain.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pYuvDecodeBuffers);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pRestrictToOutput);
+    bytes_read += ppSwapChain.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4165,8 +4165,8 @@ size_t Dx12Decoder::Decode_IDXGISwapChainMedia_GetFrameStatisticsMedia(format::H
     StructPointerDecoder<Decoded_DXGI_FRAME_STATISTICS_MEDIA> pStats;
     HRESULT return_value;
 
-    bytes_read += pStats.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pStats.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4183,8 +4183,8 @@ size_t Dx12Decoder::Decode_IDXGISwapChainMedia_SetPresentDuration(format::Handle
     UINT Duration;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Duration);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Duration);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4203,10 +4203,10 @@ size_t Dx12Decoder::Decode_IDXGISwapChainMedia_CheckPresentDurationSupport(forma
     PointerDecoder<UINT> pClosestLargerPresentDuration;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DesiredPresentDuration);
-    bytes_read += pClosestSmallerPresentDuration.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pClosestLargerPresentDuration.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DesiredPresentDuration);
+    bytes_read += pClosestSmallerPresentDuration.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pClosestLargerPresentDuration.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4225,10 +4225,10 @@ size_t Dx12Decoder::Decode_IDXGIOutput3_CheckOverlaySupport(format::HandleId obj
     PointerDecoder<UINT> pFlags;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &EnumFormat);
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pConcernedDevice);
-    bytes_read += pFlags.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &EnumFormat);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pConcernedDevice);
+    bytes_read += pFlags.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4244,7 +4244,7 @@ size_t Dx12Decoder::Decode_IDXGISwapChain3_GetCurrentBackBufferIndex(format::Han
 
     UINT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4262,9 +4262,9 @@ size_t Dx12Decoder::Decode_IDXGISwapChain3_CheckColorSpaceSupport(format::Handle
     PointerDecoder<UINT> pColorSpaceSupport;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &ColorSpace);
-    bytes_read += pColorSpaceSupport.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &ColorSpace);
+    bytes_read += pColorSpaceSupport.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4281,8 +4281,8 @@ size_t Dx12Decoder::Decode_IDXGISwapChain3_SetColorSpace1(format::HandleId objec
     DXGI_COLOR_SPACE_TYPE ColorSpace;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &ColorSpace);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &ColorSpace);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4305,14 +4305,14 @@ size_t Dx12Decoder::Decode_IDXGISwapChain3_ResizeBuffers1(format::HandleId objec
     HandlePointerDecoder<IUnknown*> ppPresentQueue;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &BufferCount);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Width);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Height);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Format);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &SwapChainFlags);
-    bytes_read += pCreationNodeMask.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ppPresentQueue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &BufferCount);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Width);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Height);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Format);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &SwapChainFlags);
+    bytes_read += pCreationNodeMask.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ppPresentQueue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4332,11 +4332,11 @@ size_t Dx12Decoder::Decode_IDXGIOutput4_CheckOverlayColorSpaceSupport(format::Ha
     PointerDecoder<UINT> pFlags;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Format);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &ColorSpace);
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pConcernedDevice);
-    bytes_read += pFlags.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Format);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &ColorSpace);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pConcernedDevice);
+    bytes_read += pFlags.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4359,10 +4359,10 @@ size_t Dx12Decoder::Decode_IDXGIFactory4_EnumAdapterByLuid(format::HandleId obje
     HandlePointerDecoder<void*> ppvAdapter;
     HRESULT return_value;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &AdapterLuid);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppvAdapter.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &AdapterLuid);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppvAdapter.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4382,9 +4382,9 @@ size_t Dx12Decoder::Decode_IDXGIFactory4_EnumWarpAdapter(format::HandleId object
     HandlePointerDecoder<void*> ppvAdapter;
     HRESULT return_value;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppvAdapter.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppvAdapter.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4403,8 +4403,8 @@ size_t Dx12Decoder::Decode_IDXGIAdapter3_RegisterHardwareContentProtectionTeardo
     HRESULT return_value;
 
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &hEvent);
-    bytes_read += pdwCookie.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pdwCookie.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4420,7 +4420,7 @@ size_t Dx12Decoder::Decode_IDXGIAdapter3_UnregisterHardwareContentProtectionTear
 
     DWORD dwCookie;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &dwCookie);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &dwCookie);
 
     for (auto consumer : GetConsumers())
     {
@@ -4439,10 +4439,10 @@ size_t Dx12Decoder::Decode_IDXGIAdapter3_QueryVideoMemoryInfo(format::HandleId o
     StructPointerDecoder<Decoded_DXGI_QUERY_VIDEO_MEMORY_INFO> pVideoMemoryInfo;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NodeIndex);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &MemorySegmentGroup);
-    bytes_read += pVideoMemoryInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NodeIndex);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &MemorySegmentGroup);
+    bytes_read += pVideoMemoryInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4461,10 +4461,10 @@ size_t Dx12Decoder::Decode_IDXGIAdapter3_SetVideoMemoryReservation(format::Handl
     UINT64 Reservation;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NodeIndex);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &MemorySegmentGroup);
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Reservation);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NodeIndex);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &MemorySegmentGroup);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Reservation);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4483,8 +4483,8 @@ size_t Dx12Decoder::Decode_IDXGIAdapter3_RegisterVideoMemoryBudgetChangeNotifica
     HRESULT return_value;
 
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &hEvent);
-    bytes_read += pdwCookie.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pdwCookie.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4500,7 +4500,7 @@ size_t Dx12Decoder::Decode_IDXGIAdapter3_UnregisterVideoMemoryBudgetChangeNotifi
 
     DWORD dwCookie;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &dwCookie);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &dwCookie);
 
     for (auto consumer : GetConsumers())
     {
@@ -4521,12 +4521,12 @@ size_t Dx12Decoder::Decode_IDXGIOutput5_DuplicateOutput1(format::HandleId object
     HandlePointerDecoder<IDXGIOutputDuplication*> ppOutputDuplication;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pDevice);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Flags);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &SupportedFormatsCount);
-    bytes_read += pSupportedFormats.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ppOutputDuplication.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pDevice);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Flags);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &SupportedFormatsCount);
+    bytes_read += pSupportedFormats.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ppOutputDuplication.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4545,10 +4545,10 @@ size_t Dx12Decoder::Decode_IDXGISwapChain4_SetHDRMetaData(format::HandleId objec
     PointerDecoder<uint8_t> pMetaData;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Type);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Size);
-    bytes_read += pMetaData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Type);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Size);
+    bytes_read += pMetaData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4568,11 +4568,11 @@ size_t Dx12Decoder::Decode_IDXGIDevice4_OfferResources1(format::HandleId object_
     UINT Flags;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumResources);
-    bytes_read += ppResources.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Priority);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Flags);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumResources);
+    bytes_read += ppResources.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Priority);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Flags);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4591,10 +4591,10 @@ size_t Dx12Decoder::Decode_IDXGIDevice4_ReclaimResources1(format::HandleId objec
     PointerDecoder<DXGI_RECLAIM_RESOURCE_RESULTS> pResults;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumResources);
-    bytes_read += ppResources.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pResults.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumResources);
+    bytes_read += ppResources.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pResults.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4611,8 +4611,8 @@ size_t Dx12Decoder::Decode_IDXGIAdapter4_GetDesc3(format::HandleId object_id, co
     StructPointerDecoder<Decoded_DXGI_ADAPTER_DESC3> pDesc;
     HRESULT return_value;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4629,8 +4629,8 @@ size_t Dx12Decoder::Decode_IDXGIOutput6_GetDesc1(format::HandleId object_id, con
     StructPointerDecoder<Decoded_DXGI_OUTPUT_DESC1> pDesc;
     HRESULT return_value;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4647,8 +4647,8 @@ size_t Dx12Decoder::Decode_IDXGIOutput6_CheckHardwareCompositionSupport(format::
     PointerDecoder<UINT> pFlags;
     HRESULT return_value;
 
-    bytes_read += pFlags.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pFlags.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4670,11 +4670,11 @@ size_t Dx12Decoder::Decode_IDXGIFactory6_EnumAdapterByGpuPreference(format::Hand
     HandlePointerDecoder<void*> ppvAdapter;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Adapter);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &GpuPreference);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppvAdapter.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Adapter);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &GpuPreference);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppvAdapter.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4693,8 +4693,8 @@ size_t Dx12Decoder::Decode_IDXGIFactory7_RegisterAdaptersChangedEvent(format::Ha
     HRESULT return_value;
 
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &hEvent);
-    bytes_read += pdwCookie.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pdwCookie.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4711,8 +4711,8 @@ size_t Dx12Decoder::Decode_IDXGIFactory7_UnregisterAdaptersChangedEvent(format::
     DWORD dwCookie;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &dwCookie);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &dwCookie);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4733,10 +4733,10 @@ size_t Dx12Decoder::Decode_ID3D12Object_GetPrivateData(format::HandleId object_i
     PointerDecoder<uint8_t> pData;
     HRESULT return_value;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &guid);
-    bytes_read += pDataSize.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &guid);
+    bytes_read += pDataSize.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4757,10 +4757,10 @@ size_t Dx12Decoder::Decode_ID3D12Object_SetPrivateData(format::HandleId object_i
     PointerDecoder<uint8_t> pData;
     HRESULT return_value;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &guid);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DataSize);
-    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &guid);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DataSize);
+    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4780,9 +4780,9 @@ size_t Dx12Decoder::Decode_ID3D12Object_SetPrivateDataInterface(format::HandleId
     format::HandleId pData;
     HRESULT return_value;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &guid);
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pData);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &guid);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pData);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4799,8 +4799,8 @@ size_t Dx12Decoder::Decode_ID3D12Object_SetName(format::HandleId object_id, cons
     WStringDecoder Name;
     HRESULT return_value;
 
-    bytes_read += Name.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += Name.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4820,9 +4820,9 @@ size_t Dx12Decoder::Decode_ID3D12DeviceChild_GetDevice(format::HandleId object_i
     HandlePointerDecoder<void*> ppvDevice;
     HRESULT return_value;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppvDevice.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppvDevice.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4838,7 +4838,7 @@ size_t Dx12Decoder::Decode_ID3D12RootSignatureDeserializer_GetRootSignatureDesc(
 
     StructPointerDecoder<Decoded_D3D12_ROOT_SIGNATURE_DESC> return_value;
 
-    bytes_read += return_value.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += return_value.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -4856,9 +4856,9 @@ size_t Dx12Decoder::Decode_ID3D12VersionedRootSignatureDeserializer_GetRootSigna
     StructPointerDecoder<Decoded_D3D12_VERSIONED_ROOT_SIGNATURE_DESC> ppDesc;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &convertToVersion);
-    bytes_read += ppDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &convertToVersion);
+    bytes_read += ppDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4874,7 +4874,7 @@ size_t Dx12Decoder::Decode_ID3D12VersionedRootSignatureDeserializer_GetUnconvert
 
     StructPointerDecoder<Decoded_D3D12_VERSIONED_ROOT_SIGNATURE_DESC> return_value;
 
-    bytes_read += return_value.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += return_value.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -4892,7 +4892,7 @@ size_t Dx12Decoder::Decode_ID3D12Heap_GetDesc(format::HandleId object_id, const
     D3D12_HEAP_DESC value_returned;
     return_value.decoded_value = &value_returned;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4911,10 +4911,10 @@ size_t Dx12Decoder::Decode_ID3D12Resource_Map(format::HandleId object_id, const
     PointerDecoder<uint64_t, void*> ppData;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Subresource);
-    bytes_read += pReadRange.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ppData.DecodeVoidPtr((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Subresource);
+    bytes_read += pReadRange.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ppData.DecodeVoidPtr((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4931,8 +4931,8 @@ size_t Dx12Decoder::Decode_ID3D12Resource_Unmap(format::HandleId object_id, cons
     UINT Subresource;
     StructPointerDecoder<Decoded_D3D12_RANGE> pWrittenRange;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Subresource);
-    bytes_read += pWrittenRange.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Subresource);
+    bytes_read += pWrittenRange.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -4950,7 +4950,7 @@ size_t Dx12Decoder::Decode_ID3D12Resource_GetDesc(format::HandleId object_id, co
     D3D12_RESOURCE_DESC value_returned;
     return_value.decoded_value = &value_returned;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4966,7 +4966,7 @@ size_t Dx12Decoder::Decode_ID3D12Resource_GetGPUVirtualAddress(format::HandleId
 
     D3D12_GPU_VIRTUAL_ADDRESS return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -4988,11 +4988,11 @@ size_t Dx12Decoder::Decode_ID3D12Resource_ReadFromSubresource(format::HandleId o
     HRESULT return_value;
 
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pDstData);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DstRowPitch);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DstDepthPitch);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &SrcSubresource);
-    bytes_read += pSrcBox.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DstRowPitch);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DstDepthPitch);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &SrcSubresource);
+    bytes_read += pSrcBox.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -5010,9 +5010,9 @@ size_t Dx12Decoder::Decode_ID3D12Resource_GetHeapProperties(format::HandleId obj
     PointerDecoder<D3D12_HEAP_FLAGS> pHeapFlags;
     HRESULT return_value;
 
-    bytes_read += pHeapProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pHeapFlags.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pHeapProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pHeapFlags.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -5028,7 +5028,7 @@ size_t Dx12Decoder::Decode_ID3D12CommandAllocator_Reset(format::HandleId object_
 
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -5044,7 +5044,7 @@ size_t Dx12Decoder::Decode_ID3D12Fence_GetCompletedValue(format::HandleId object
 
     UINT64 return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -5062,9 +5062,9 @@ size_t Dx12Decoder::Decode_ID3D12Fence_SetEventOnCompletion(format::HandleId obj
     uint64_t hEvent;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Value);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Value);
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &hEvent);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -5081,8 +5081,8 @@ size_t Dx12Decoder::Decode_ID3D12Fence_Signal(format::HandleId object_id, const
     UINT64 Value;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Value);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Value);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -5098,7 +5098,7 @@ size_t Dx12Decoder::Decode_ID3D12Fence1_GetCreationFlags(format::HandleId object
 
     D3D12_FENCE_FLAGS return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -5115,8 +5115,8 @@ size_t Dx12Decoder::Decode_ID3D12PipelineState_GetCachedBlob(format::HandleId ob
     HandlePointerDecoder<ID3D10Blob*> ppBlob;
     HRESULT return_value;
 
-    bytes_read += ppBlob.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ppBlob.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -5134,7 +5134,7 @@ size_t Dx12Decoder::Decode_ID3D12DescriptorHeap_GetDesc(format::HandleId object_
     D3D12_DESCRIPTOR_HEAP_DESC value_returned;
     return_value.decoded_value = &value_returned;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -5152,7 +5152,7 @@ size_t Dx12Decoder::Decode_ID3D12DescriptorHeap_GetCPUDescriptorHandleForHeapSta
     D3D12_CPU_DESCRIPTOR_HANDLE value_returned;
     return_value.decoded_value = &value_returned;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -5170,7 +5170,7 @@ size_t Dx12Decoder::Decode_ID3D12DescriptorHeap_GetGPUDescriptorHandleForHeapSta
     D3D12_GPU_DESCRIPTOR_HANDLE value_returned;
     return_value.decoded_value = &value_returned;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -5186,7 +5186,7 @@ size_t Dx12Decoder::Decode_ID3D12CommandList_GetType(format::HandleId object_id,
 
     D3D12_COMMAND_LIST_TYPE return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -5202,7 +5202,7 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_Close(format::HandleId obje
 
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -5220,9 +5220,9 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_Reset(format::HandleId obje
     format::HandleId pInitialState;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pAllocator);
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pInitialState);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pAllocator);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pInitialState);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -5238,7 +5238,7 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_ClearState(format::HandleId
 
     format::HandleId pPipelineState;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pPipelineState);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pPipelineState);
 
     for (auto consumer : GetConsumers())
     {
@@ -5257,10 +5257,10 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_DrawInstanced(format::Handl
     UINT StartVertexLocation;
     UINT StartInstanceLocation;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &VertexCountPerInstance);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &InstanceCount);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &StartVertexLocation);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &StartInstanceLocation);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &VertexCountPerInstance);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &InstanceCount);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &StartVertexLocation);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &StartInstanceLocation);
 
     for (auto consumer : GetConsumers())
     {
@@ -5280,11 +5280,11 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_DrawIndexedInstanced(format
     INT BaseVertexLocation;
     UINT StartInstanceLocation;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &IndexCountPerInstance);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &InstanceCount);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &StartIndexLocation);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &BaseVertexLocation);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &StartInstanceLocation);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &IndexCountPerInstance);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &InstanceCount);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &StartIndexLocation);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &BaseVertexLocation);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &StartInstanceLocation);
 
     for (auto consumer : GetConsumers())
     {
@@ -5302,9 +5302,9 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_Dispatch(format::HandleId o
     UINT ThreadGroupCountY;
     UINT ThreadGroupCountZ;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &ThreadGroupCountX);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &ThreadGroupCountY);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &ThreadGroupCountZ);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &ThreadGroupCountX);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &ThreadGroupCountY);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &ThreadGroupCountZ);
 
     for (auto consumer : GetConsumers())
     {
@@ -5324,11 +5324,11 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_CopyBufferRegion(format::Ha
     UINT64 SrcOffset;
     UINT64 NumBytes;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pDstBuffer);
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DstOffset);
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pSrcBuffer);
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &SrcOffset);
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumBytes);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pDstBuffer);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DstOffset);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pSrcBuffer);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &SrcOffset);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumBytes);
 
     for (auto consumer : GetConsumers())
     {
@@ -5349,12 +5349,12 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_CopyTextureRegion(format::H
     StructPointerDecoder<Decoded_D3D12_TEXTURE_COPY_LOCATION> pSrc;
     StructPointerDecoder<Decoded_D3D12_BOX> pSrcBox;
 
-    bytes_read += pDst.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DstX);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DstY);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DstZ);
-    bytes_read += pSrc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pSrcBox.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += pDst.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DstX);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DstY);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DstZ);
+    bytes_read += pSrc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pSrcBox.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -5371,8 +5371,8 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_CopyResource(format::Handle
     format::HandleId pDstResource;
     format::HandleId pSrcResource;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pDstResource);
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pSrcResource);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pDstResource);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pSrcResource);
 
     for (auto consumer : GetConsumers())
     {
@@ -5393,12 +5393,12 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_CopyTiles(format::HandleId
     UINT64 BufferStartOffsetInBytes;
     D3D12_TILE_COPY_FLAGS Flags;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pTiledResource);
-    bytes_read += pTileRegionStartCoordinate.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pTileRegionSize.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pBuffer);
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &BufferStartOffsetInBytes);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Flags);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pTiledResource);
+    bytes_read += pTileRegionStartCoordinate.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pTileRegionSize.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pBuffer);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &BufferStartOffsetInBytes);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Flags);
 
     for (auto consumer : GetConsumers())
     {
@@ -5418,11 +5418,11 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_ResolveSubresource(format::
     UINT SrcSubresource;
     DXGI_FORMAT Format;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pDstResource);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DstSubresource);
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pSrcResource);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &SrcSubresource);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Format);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pDstResource);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DstSubresource);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pSrcResource);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &SrcSubresource);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Format);
 
     for (auto consumer : GetConsumers())
     {
@@ -5438,7 +5438,7 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_IASetPrimitiveTopology(form
 
     D3D_PRIMITIVE_TOPOLOGY PrimitiveTopology;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &PrimitiveTopology);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &PrimitiveTopology);
 
     for (auto consumer : GetConsumers())
     {
@@ -5455,8 +5455,8 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_RSSetViewports(format::Hand
     UINT NumViewports;
     StructPointerDecoder<Decoded_D3D12_VIEWPORT> pViewports;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumViewports);
-    bytes_read += pViewports.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumViewports);
+    bytes_read += pViewports.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -5473,8 +5473,8 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_RSSetScissorRects(format::H
     UINT NumRects;
     StructPointerDecoder<Decoded_tagRECT> pRects;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumRects);
-    bytes_read += pRects.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumRects);
+    bytes_read += pRects.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -5490,7 +5490,7 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_OMSetBlendFactor(format::Ha
 
     PointerDecoder<FLOAT> BlendFactor;
 
-    bytes_read += BlendFactor.DecodeFloat((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += BlendFactor.DecodeFloat((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -5506,7 +5506,7 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_OMSetStencilRef(format::Han
 
     UINT StencilRef;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &StencilRef);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &StencilRef);
 
     for (auto consumer : GetConsumers())
     {
@@ -5522,7 +5522,7 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_SetPipelineState(format::Ha
 
     format::HandleId pPipelineState;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pPipelineState);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pPipelineState);
 
     for (auto consumer : GetConsumers())
     {
@@ -5539,8 +5539,8 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_ResourceBarrier(format::Han
     UINT NumBarriers;
     StructPointerDecoder<Decoded_D3D12_RESOURCE_BARRIER> pBarriers;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumBarriers);
-    bytes_read += pBarriers.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumBarriers);
+    bytes_read += pBarriers.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -5556,7 +5556,7 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_ExecuteBundle(format::Handl
 
     format::HandleId pCommandList;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pCommandList);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pCommandList);
 
     for (auto consumer : GetConsumers())
     {
@@ -5573,8 +5573,8 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_SetDescriptorHeaps(format::
     UINT NumDescriptorHeaps;
     HandlePointerDecoder<ID3D12DescriptorHeap*> ppDescriptorHeaps;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumDescriptorHeaps);
-    bytes_read += ppDescriptorHeaps.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumDescriptorHeaps);
+    bytes_read += ppDescriptorHeaps.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -5590,7 +5590,7 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_SetComputeRootSignature(for
 
     format::HandleId pRootSignature;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pRootSignature);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pRootSignature);
 
     for (auto consumer : GetConsumers())
     {
@@ -5606,7 +5606,7 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_SetGraphicsRootSignature(fo
 
     format::HandleId pRootSignature;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pRootSignature);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pRootSignature);
 
     for (auto consumer : GetConsumers())
     {
@@ -5625,8 +5625,8 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_SetComputeRootDescriptorTab
     D3D12_GPU_DESCRIPTOR_HANDLE value_BaseDescriptor;
     BaseDescriptor.decoded_value = &value_BaseDescriptor;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &RootParameterIndex);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &BaseDescriptor);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &RootParameterIndex);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &BaseDescriptor);
 
     for (auto consumer : GetConsumers())
     {
@@ -5645,8 +5645,8 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_SetGraphicsRootDescriptorTa
     D3D12_GPU_DESCRIPTOR_HANDLE value_BaseDescriptor;
     BaseDescriptor.decoded_value = &value_BaseDescriptor;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &RootParameterIndex);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &BaseDescriptor);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &RootParameterIndex);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &BaseDescriptor);
 
     for (auto consumer : GetConsumers())
     {
@@ -5664,9 +5664,9 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_SetComputeRoot32BitConstant
     UINT SrcData;
     UINT DestOffsetIn32BitValues;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &RootParameterIndex);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &SrcData);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DestOffsetIn32BitValues);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &RootParameterIndex);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &SrcData);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DestOffsetIn32BitValues);
 
     for (auto consumer : GetConsumers())
     {
@@ -5684,9 +5684,9 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_SetGraphicsRoot32BitConstan
     UINT SrcData;
     UINT DestOffsetIn32BitValues;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &RootParameterIndex);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &SrcData);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DestOffsetIn32BitValues);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &RootParameterIndex);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &SrcData);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DestOffsetIn32BitValues);
 
     for (auto consumer : GetConsumers())
     {
@@ -5705,10 +5705,10 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_SetComputeRoot32BitConstant
     PointerDecoder<uint8_t> pSrcData;
     UINT DestOffsetIn32BitValues;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &RootParameterIndex);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Num32BitValuesToSet);
-    bytes_read += pSrcData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DestOffsetIn32BitValues);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &RootParameterIndex);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Num32BitValuesToSet);
+    bytes_read += pSrcData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DestOffsetIn32BitValues);
 
     for (auto consumer : GetConsumers())
     {
@@ -5727,10 +5727,10 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_SetGraphicsRoot32BitConstan
     PointerDecoder<uint8_t> pSrcData;
     UINT DestOffsetIn32BitValues;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &RootParameterIndex);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Num32BitValuesToSet);
-    bytes_read += pSrcData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DestOffsetIn32BitValues);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &RootParameterIndex);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Num32BitValuesToSet);
+    bytes_read += pSrcData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DestOffsetIn32BitValues);
 
     for (auto consumer : GetConsumers())
     {
@@ -5747,8 +5747,8 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_SetComputeRootConstantBuffe
     UINT RootParameterIndex;
     D3D12_GPU_VIRTUAL_ADDRESS BufferLocation;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &RootParameterIndex);
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &BufferLocation);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &RootParameterIndex);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &BufferLocation);
 
     for (auto consumer : GetConsumers())
     {
@@ -5765,8 +5765,8 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_SetGraphicsRootConstantBuff
     UINT RootParameterIndex;
     D3D12_GPU_VIRTUAL_ADDRESS BufferLocation;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &RootParameterIndex);
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &BufferLocation);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &RootParameterIndex);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &BufferLocation);
 
     for (auto consumer : GetConsumers())
     {
@@ -5783,8 +5783,8 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_SetComputeRootShaderResourc
     UINT RootParameterIndex;
     D3D12_GPU_VIRTUAL_ADDRESS BufferLocation;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &RootParameterIndex);
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &BufferLocation);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &RootParameterIndex);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &BufferLocation);
 
     for (auto consumer : GetConsumers())
     {
@@ -5801,8 +5801,8 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_SetGraphicsRootShaderResour
     UINT RootParameterIndex;
     D3D12_GPU_VIRTUAL_ADDRESS BufferLocation;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &RootParameterIndex);
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &BufferLocation);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &RootParameterIndex);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &BufferLocation);
 
     for (auto consumer : GetConsumers())
     {
@@ -5819,8 +5819,8 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_SetComputeRootUnorderedAcce
     UINT RootParameterIndex;
     D3D12_GPU_VIRTUAL_ADDRESS BufferLocation;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &RootParameterIndex);
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &BufferLocation);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &RootParameterIndex);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &BufferLocation);
 
     for (auto consumer : GetConsumers())
     {
@@ -5837,8 +5837,8 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_SetGraphicsRootUnorderedAcc
     UINT RootParameterIndex;
     D3D12_GPU_VIRTUAL_ADDRESS BufferLocation;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &RootParameterIndex);
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &BufferLocation);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &RootParameterIndex);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &BufferLocation);
 
     for (auto consumer : GetConsumers())
     {
@@ -5854,7 +5854,7 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_IASetIndexBuffer(format::Ha
 
     StructPointerDecoder<Decoded_D3D12_INDEX_BUFFER_VIEW> pView;
 
-    bytes_read += pView.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += pView.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -5872,9 +5872,9 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_IASetVertexBuffers(format::
     UINT NumViews;
     StructPointerDecoder<Decoded_D3D12_VERTEX_BUFFER_VIEW> pViews;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &StartSlot);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumViews);
-    bytes_read += pViews.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &StartSlot);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumViews);
+    bytes_read += pViews.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -5892,9 +5892,9 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_SOSetTargets(format::Handle
     UINT NumViews;
     StructPointerDecoder<Decoded_D3D12_STREAM_OUTPUT_BUFFER_VIEW> pViews;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &StartSlot);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumViews);
-    bytes_read += pViews.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &StartSlot);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumViews);
+    bytes_read += pViews.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -5913,10 +5913,10 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_OMSetRenderTargets(format::
     BOOL RTsSingleHandleToDescriptorRange;
     StructPointerDecoder<Decoded_D3D12_CPU_DESCRIPTOR_HANDLE> pDepthStencilDescriptor;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumRenderTargetDescriptors);
-    bytes_read += pRenderTargetDescriptors.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &RTsSingleHandleToDescriptorRange);
-    bytes_read += pDepthStencilDescriptor.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumRenderTargetDescriptors);
+    bytes_read += pRenderTargetDescriptors.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &RTsSingleHandleToDescriptorRange);
+    bytes_read += pDepthStencilDescriptor.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -5939,12 +5939,12 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_ClearDepthStencilView(forma
     UINT NumRects;
     StructPointerDecoder<Decoded_tagRECT> pRects;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DepthStencilView);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &ClearFlags);
-    bytes_read += ValueDecoder::DecodeFloatValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Depth);
-    bytes_read += ValueDecoder::DecodeUInt8Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Stencil);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumRects);
-    bytes_read += pRects.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DepthStencilView);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &ClearFlags);
+    bytes_read += ValueDecoder::DecodeFloatValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Depth);
+    bytes_read += ValueDecoder::DecodeUInt8Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Stencil);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumRects);
+    bytes_read += pRects.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -5965,10 +5965,10 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_ClearRenderTargetView(forma
     UINT NumRects;
     StructPointerDecoder<Decoded_tagRECT> pRects;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &RenderTargetView);
-    bytes_read += ColorRGBA.DecodeFloat((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumRects);
-    bytes_read += pRects.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &RenderTargetView);
+    bytes_read += ColorRGBA.DecodeFloat((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumRects);
+    bytes_read += pRects.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -5993,12 +5993,12 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_ClearUnorderedAccessViewUin
     UINT NumRects;
     StructPointerDecoder<Decoded_tagRECT> pRects;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &ViewGPUHandleInCurrentHeap);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &ViewCPUHandle);
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pResource);
-    bytes_read += Values.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumRects);
-    bytes_read += pRects.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &ViewGPUHandleInCurrentHeap);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &ViewCPUHandle);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pResource);
+    bytes_read += Values.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumRects);
+    bytes_read += pRects.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -6023,12 +6023,12 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_ClearUnorderedAccessViewFlo
     UINT NumRects;
     StructPointerDecoder<Decoded_tagRECT> pRects;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &ViewGPUHandleInCurrentHeap);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &ViewCPUHandle);
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pResource);
-    bytes_read += Values.DecodeFloat((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumRects);
-    bytes_read += pRects.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &ViewGPUHandleInCurrentHeap);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &ViewCPUHandle);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pResource);
+    bytes_read += Values.DecodeFloat((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumRects);
+    bytes_read += pRects.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -6045,8 +6045,8 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_DiscardResource(format::Han
     format::HandleId pResource;
     StructPointerDecoder<Decoded_D3D12_DISCARD_REGION> pRegion;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pResource);
-    bytes_read += pRegion.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pResource);
+    bytes_read += pRegion.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -6064,9 +6064,9 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_BeginQuery(format::HandleId
     D3D12_QUERY_TYPE Type;
     UINT Index;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pQueryHeap);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Type);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Index);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pQueryHeap);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Type);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Index);
 
     for (auto consumer : GetConsumers())
     {
@@ -6084,9 +6084,9 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_EndQuery(format::HandleId o
     D3D12_QUERY_TYPE Type;
     UINT Index;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pQueryHeap);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Type);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Index);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pQueryHeap);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Type);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Index);
 
     for (auto consumer : GetConsumers())
     {
@@ -6107,12 +6107,12 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_ResolveQueryData(format::Ha
     format::HandleId pDestinationBuffer;
     UINT64 AlignedDestinationBufferOffset;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pQueryHeap);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Type);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &StartIndex);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumQueries);
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pDestinationBuffer);
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &AlignedDestinationBufferOffset);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pQueryHeap);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Type);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &StartIndex);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumQueries);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pDestinationBuffer);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &AlignedDestinationBufferOffset);
 
     for (auto consumer : GetConsumers())
     {
@@ -6130,9 +6130,9 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_SetPredication(format::Hand
     UINT64 AlignedBufferOffset;
     D3D12_PREDICATION_OP Operation;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pBuffer);
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &AlignedBufferOffset);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Operation);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pBuffer);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &AlignedBufferOffset);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Operation);
 
     for (auto consumer : GetConsumers())
     {
@@ -6150,9 +6150,9 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_SetMarker(format::HandleId
     PointerDecoder<uint8_t> pData;
     UINT Size;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Metadata);
-    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Size);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Metadata);
+    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Size);
 
     for (auto consumer : GetConsumers())
     {
@@ -6170,9 +6170,9 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_BeginEvent(format::HandleId
     PointerDecoder<uint8_t> pData;
     UINT Size;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Metadata);
-    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Size);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Metadata);
+    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Size);
 
     for (auto consumer : GetConsumers())
     {
@@ -6207,12 +6207,12 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList_ExecuteIndirect(format::Han
     format::HandleId pCountBuffer;
     UINT64 CountBufferOffset;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pCommandSignature);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &MaxCommandCount);
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pArgumentBuffer);
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &ArgumentBufferOffset);
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pCountBuffer);
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &CountBufferOffset);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pCommandSignature);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &MaxCommandCount);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pArgumentBuffer);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &ArgumentBufferOffset);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pCountBuffer);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &CountBufferOffset);
 
     for (auto consumer : GetConsumers())
     {
@@ -6234,13 +6234,13 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList1_AtomicCopyBufferUINT(forma
     HandlePointerDecoder<ID3D12Resource*> ppDependentResources;
     StructPointerDecoder<Decoded_D3D12_SUBRESOURCE_RANGE_UINT64> pDependentSubresourceRanges;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pDstBuffer);
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DstOffset);
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pSrcBuffer);
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &SrcOffset);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Dependencies);
-    bytes_read += ppDependentResources.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pDependentSubresourceRanges.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pDstBuffer);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DstOffset);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pSrcBuffer);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &SrcOffset);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Dependencies);
+    bytes_read += ppDependentResources.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pDependentSubresourceRanges.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -6262,13 +6262,13 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList1_AtomicCopyBufferUINT64(for
     HandlePointerDecoder<ID3D12Resource*> ppDependentResources;
     StructPointerDecoder<Decoded_D3D12_SUBRESOURCE_RANGE_UINT64> pDependentSubresourceRanges;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pDstBuffer);
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DstOffset);
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pSrcBuffer);
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &SrcOffset);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Dependencies);
-    bytes_read += ppDependentResources.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pDependentSubresourceRanges.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pDstBuffer);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DstOffset);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pSrcBuffer);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &SrcOffset);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Dependencies);
+    bytes_read += ppDependentResources.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pDependentSubresourceRanges.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -6285,8 +6285,8 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList1_OMSetDepthBounds(format::H
     FLOAT Min;
     FLOAT Max;
 
-    bytes_read += ValueDecoder::DecodeFloatValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Min);
-    bytes_read += ValueDecoder::DecodeFloatValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Max);
+    bytes_read += ValueDecoder::DecodeFloatValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Min);
+    bytes_read += ValueDecoder::DecodeFloatValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Max);
 
     for (auto consumer : GetConsumers())
     {
@@ -6304,9 +6304,9 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList1_SetSamplePositions(format:
     UINT NumPixels;
     StructPointerDecoder<Decoded_D3D12_SAMPLE_POSITION> pSamplePositions;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumSamplesPerPixel);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumPixels);
-    bytes_read += pSamplePositions.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumSamplesPerPixel);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumPixels);
+    bytes_read += pSamplePositions.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -6330,15 +6330,15 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList1_ResolveSubresourceRegion(f
     DXGI_FORMAT Format;
     D3D12_RESOLVE_MODE ResolveMode;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pDstResource);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DstSubresource);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DstX);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DstY);
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pSrcResource);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &SrcSubresource);
-    bytes_read += pSrcRect.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Format);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &ResolveMode);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pDstResource);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DstSubresource);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DstX);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DstY);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pSrcResource);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &SrcSubresource);
+    bytes_read += pSrcRect.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Format);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &ResolveMode);
 
     for (auto consumer : GetConsumers())
     {
@@ -6354,7 +6354,7 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList1_SetViewInstanceMask(format
 
     UINT Mask;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Mask);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Mask);
 
     for (auto consumer : GetConsumers())
     {
@@ -6372,9 +6372,9 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList2_WriteBufferImmediate(forma
     StructPointerDecoder<Decoded_D3D12_WRITEBUFFERIMMEDIATE_PARAMETER> pParams;
     PointerDecoder<D3D12_WRITEBUFFERIMMEDIATE_MODE> pModes;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Count);
-    bytes_read += pParams.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pModes.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Count);
+    bytes_read += pParams.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pModes.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -6399,16 +6399,16 @@ size_t Dx12Decoder::Decode_ID3D12CommandQueue_UpdateTileMappings(format::HandleI
     PointerDecoder<UINT> pRangeTileCounts;
     D3D12_TILE_MAPPING_FLAGS Flags;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pResource);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumResourceRegions);
-    bytes_read += pResourceRegionStartCoordinates.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pResourceRegionSizes.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pHeap);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumRanges);
-    bytes_read += pRangeFlags.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pHeapRangeStartOffsets.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pRangeTileCounts.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Flags);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pResource);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumResourceRegions);
+    bytes_read += pResourceRegionStartCoordinates.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pResourceRegionSizes.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pHeap);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumRanges);
+    bytes_read += pRangeFlags.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pHeapRangeStartOffsets.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pRangeTileCounts.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Flags);
 
     for (auto consumer : GetConsumers())
     {
@@ -6429,12 +6429,12 @@ size_t Dx12Decoder::Decode_ID3D12CommandQueue_CopyTileMappings(format::HandleId
     StructPointerDecoder<Decoded_D3D12_TILE_REGION_SIZE> pRegionSize;
     D3D12_TILE_MAPPING_FLAGS Flags;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pDstResource);
-    bytes_read += pDstRegionStartCoordinate.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pSrcResource);
-    bytes_read += pSrcRegionStartCoordinate.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pRegionSize.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Flags);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pDstResource);
+    bytes_read += pDstRegionStartCoordinate.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pSrcResource);
+    bytes_read += pSrcRegionStartCoordinate.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pRegionSize.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Flags);
 
     for (auto consumer : GetConsumers())
     {
@@ -6451,8 +6451,8 @@ size_t Dx12Decoder::Decode_ID3D12CommandQueue_ExecuteCommandLists(format::Handle
     UINT NumCommandLists;
     HandlePointerDecoder<ID3D12CommandList*> ppCommandLists;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumCommandLists);
-    bytes_read += ppCommandLists.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumCommandLists);
+    bytes_read += ppCommandLists.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -6470,9 +6470,9 @@ size_t Dx12Decoder::Decode_ID3D12CommandQueue_SetMarker(format::HandleId object_
     PointerDecoder<uint8_t> pData;
     UINT Size;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Metadata);
-    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Size);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Metadata);
+    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Size);
 
     for (auto consumer : GetConsumers())
     {
@@ -6490,9 +6490,9 @@ size_t Dx12Decoder::Decode_ID3D12CommandQueue_BeginEvent(format::HandleId object
     PointerDecoder<uint8_t> pData;
     UINT Size;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Metadata);
-    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Size);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Metadata);
+    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Size);
 
     for (auto consumer : GetConsumers())
     {
@@ -6524,9 +6524,9 @@ size_t Dx12Decoder::Decode_ID3D12CommandQueue_Signal(format::HandleId object_id,
     UINT64 Value;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pFence);
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Value);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pFence);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Value);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -6544,9 +6544,9 @@ size_t Dx12Decoder::Decode_ID3D12CommandQueue_Wait(format::HandleId object_id, c
     UINT64 Value;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pFence);
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Value);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pFence);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Value);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -6563,8 +6563,8 @@ size_t Dx12Decoder::Decode_ID3D12CommandQueue_GetTimestampFrequency(format::Hand
     PointerDecoder<UINT64> pFrequency;
     HRESULT return_value;
 
-    bytes_read += pFrequency.DecodeUInt64((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pFrequency.DecodeUInt64((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -6582,9 +6582,9 @@ size_t Dx12Decoder::Decode_ID3D12CommandQueue_GetClockCalibration(format::Handle
     PointerDecoder<UINT64> pCpuTimestamp;
     HRESULT return_value;
 
-    bytes_read += pGpuTimestamp.DecodeUInt64((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pCpuTimestamp.DecodeUInt64((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pGpuTimestamp.DecodeUInt64((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pCpuTimestamp.DecodeUInt64((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -6602,7 +6602,7 @@ size_t Dx12Decoder::Decode_ID3D12CommandQueue_GetDesc(format::HandleId object_id
     D3D12_COMMAND_QUEUE_DESC value_returned;
     return_value.decoded_value = &value_returned;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -6618,7 +6618,7 @@ size_t Dx12Decoder::Decode_ID3D12Device_GetNodeCount(format::HandleId object_id,
 
     UINT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -6639,10 +6639,10 @@ size_t Dx12Decoder::Decode_ID3D12Device_CreateCommandQueue(format::HandleId obje
     HandlePointerDecoder<void*> ppCommandQueue;
     HRESULT return_value;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppCommandQueue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppCommandQueue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -6663,10 +6663,10 @@ size_t Dx12Decoder::Decode_ID3D12Device_CreateCommandAllocator(format::HandleId
     HandlePointerDecoder<void*> ppCommandAllocator;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &type);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppCommandAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &type);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppCommandAllocator.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -6687,10 +6687,10 @@ size_t Dx12Decoder::Decode_ID3D12Device_CreateGraphicsPipelineState(format::Hand
     HandlePointerDecoder<void*> ppPipelineState;
     HRESULT return_value;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppPipelineState.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppPipelineState.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -6711,10 +6711,10 @@ size_t Dx12Decoder::Decode_ID3D12Device_CreateComputePipelineState(format::Handl
     HandlePointerDecoder<void*> ppPipelineState;
     HRESULT return_value;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppPipelineState.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppPipelineState.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -6738,13 +6738,13 @@ size_t Dx12Decoder::Decode_ID3D12Device_CreateCommandList(format::HandleId objec
     HandlePointerDecoder<void*> ppCommandList;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &nodeMask);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &type);
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pCommandAllocator);
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pInitialState);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppCommandList.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &nodeMask);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &type);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pCommandAllocator);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pInitialState);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppCommandList.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -6765,10 +6765,10 @@ size_t Dx12Decoder::Decode_ID3D12Device_CreateDescriptorHeap(format::HandleId ob
     HandlePointerDecoder<void*> ppvHeap;
     HRESULT return_value;
 
-    bytes_read += pDescriptorHeapDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppvHeap.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDescriptorHeapDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppvHeap.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -6785,8 +6785,8 @@ size_t Dx12Decoder::Decode_ID3D12Device_GetDescriptorHandleIncrementSize(format:
     D3D12_DESCRIPTOR_HEAP_TYPE DescriptorHeapType;
     UINT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DescriptorHeapType);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DescriptorHeapType);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -6809,12 +6809,12 @@ size_t Dx12Decoder::Decode_ID3D12Device_CreateRootSignature(format::HandleId obj
     HandlePointerDecoder<void*> ppvRootSignature;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &nodeMask);
-    bytes_read += pBlobWithRootSignature.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeSizeTValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &blobLengthInBytes);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppvRootSignature.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &nodeMask);
+    bytes_read += pBlobWithRootSignature.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeSizeTValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &blobLengthInBytes);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppvRootSignature.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -6833,8 +6833,8 @@ size_t Dx12Decoder::Decode_ID3D12Device_CreateConstantBufferView(format::HandleI
     D3D12_CPU_DESCRIPTOR_HANDLE value_DestDescriptor;
     DestDescriptor.decoded_value = &value_DestDescriptor;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DestDescriptor);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DestDescriptor);
 
     for (auto consumer : GetConsumers())
     {
@@ -6854,9 +6854,9 @@ size_t Dx12Decoder::Decode_ID3D12Device_CreateShaderResourceView(format::HandleI
     D3D12_CPU_DESCRIPTOR_HANDLE value_DestDescriptor;
     DestDescriptor.decoded_value = &value_DestDescriptor;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pResource);
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DestDescriptor);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pResource);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DestDescriptor);
 
     for (auto consumer : GetConsumers())
     {
@@ -6877,10 +6877,10 @@ size_t Dx12Decoder::Decode_ID3D12Device_CreateUnorderedAccessView(format::Handle
     D3D12_CPU_DESCRIPTOR_HANDLE value_DestDescriptor;
     DestDescriptor.decoded_value = &value_DestDescriptor;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pResource);
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pCounterResource);
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DestDescriptor);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pResource);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pCounterResource);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DestDescriptor);
 
     for (auto consumer : GetConsumers())
     {
@@ -6900,9 +6900,9 @@ size_t Dx12Decoder::Decode_ID3D12Device_CreateRenderTargetView(format::HandleId
     D3D12_CPU_DESCRIPTOR_HANDLE value_DestDescriptor;
     DestDescriptor.decoded_value = &value_DestDescriptor;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pResource);
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DestDescriptor);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pResource);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DestDescriptor);
 
     for (auto consumer : GetConsumers())
     {
@@ -6922,9 +6922,9 @@ size_t Dx12Decoder::Decode_ID3D12Device_CreateDepthStencilView(format::HandleId
     D3D12_CPU_DESCRIPTOR_HANDLE value_DestDescriptor;
     DestDescriptor.decoded_value = &value_DestDescriptor;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pResource);
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DestDescriptor);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pResource);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DestDescriptor);
 
     for (auto consumer : GetConsumers())
     {
@@ -6943,8 +6943,8 @@ size_t Dx12Decoder::Decode_ID3D12Device_CreateSampler(format::HandleId object_id
     D3D12_CPU_DESCRIPTOR_HANDLE value_DestDescriptor;
     DestDescriptor.decoded_value = &value_DestDescriptor;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DestDescriptor);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DestDescriptor);
 
     for (auto consumer : GetConsumers())
     {
@@ -6966,13 +6966,13 @@ size_t Dx12Decoder::Decode_ID3D12Device_CopyDescriptors(format::HandleId object_
     PointerDecoder<UINT> pSrcDescriptorRangeSizes;
     D3D12_DESCRIPTOR_HEAP_TYPE DescriptorHeapsType;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumDestDescriptorRanges);
-    bytes_read += pDestDescriptorRangeStarts.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pDestDescriptorRangeSizes.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumSrcDescriptorRanges);
-    bytes_read += pSrcDescriptorRangeStarts.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pSrcDescriptorRangeSizes.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DescriptorHeapsType);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumDestDescriptorRanges);
+    bytes_read += pDestDescriptorRangeStarts.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pDestDescriptorRangeSizes.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumSrcDescriptorRanges);
+    bytes_read += pSrcDescriptorRangeStarts.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pSrcDescriptorRangeSizes.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DescriptorHeapsType);
 
     for (auto consumer : GetConsumers())
     {
@@ -6995,10 +6995,10 @@ size_t Dx12Decoder::Decode_ID3D12Device_CopyDescriptorsSimple(format::HandleId o
     SrcDescriptorRangeStart.decoded_value = &value_SrcDescriptorRangeStart;
     D3D12_DESCRIPTOR_HEAP_TYPE DescriptorHeapsType;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumDescriptors);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DestDescriptorRangeStart);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &SrcDescriptorRangeStart);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DescriptorHeapsType);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumDescriptors);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DestDescriptorRangeStart);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &SrcDescriptorRangeStart);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DescriptorHeapsType);
 
     for (auto consumer : GetConsumers())
     {
@@ -7019,10 +7019,10 @@ size_t Dx12Decoder::Decode_ID3D12Device_GetResourceAllocationInfo(format::Handle
     D3D12_RESOURCE_ALLOCATION_INFO value_returned;
     return_value.decoded_value = &value_returned;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &visibleMask);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &numResourceDescs);
-    bytes_read += pResourceDescs.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &visibleMask);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &numResourceDescs);
+    bytes_read += pResourceDescs.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7042,9 +7042,9 @@ size_t Dx12Decoder::Decode_ID3D12Device_GetCustomHeapProperties(format::HandleId
     D3D12_HEAP_PROPERTIES value_returned;
     return_value.decoded_value = &value_returned;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &nodeMask);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &heapType);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &nodeMask);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &heapType);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7069,14 +7069,14 @@ size_t Dx12Decoder::Decode_ID3D12Device_CreateCommittedResource(format::HandleId
     HandlePointerDecoder<void*> ppvResource;
     HRESULT return_value;
 
-    bytes_read += pHeapProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &HeapFlags);
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &InitialResourceState);
-    bytes_read += pOptimizedClearValue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riidResource);
-    bytes_read += ppvResource.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pHeapProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &HeapFlags);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &InitialResourceState);
+    bytes_read += pOptimizedClearValue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riidResource);
+    bytes_read += ppvResource.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7097,10 +7097,10 @@ size_t Dx12Decoder::Decode_ID3D12Device_CreateHeap(format::HandleId object_id, c
     HandlePointerDecoder<void*> ppvHeap;
     HRESULT return_value;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppvHeap.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppvHeap.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7125,14 +7125,14 @@ size_t Dx12Decoder::Decode_ID3D12Device_CreatePlacedResource(format::HandleId ob
     HandlePointerDecoder<void*> ppvResource;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pHeap);
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &HeapOffset);
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &InitialState);
-    bytes_read += pOptimizedClearValue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppvResource.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pHeap);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &HeapOffset);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &InitialState);
+    bytes_read += pOptimizedClearValue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppvResource.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7155,12 +7155,12 @@ size_t Dx12Decoder::Decode_ID3D12Device_CreateReservedResource(format::HandleId
     HandlePointerDecoder<void*> ppvResource;
     HRESULT return_value;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &InitialState);
-    bytes_read += pOptimizedClearValue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppvResource.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &InitialState);
+    bytes_read += pOptimizedClearValue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppvResource.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7181,12 +7181,12 @@ size_t Dx12Decoder::Decode_ID3D12Device_CreateSharedHandle(format::HandleId obje
     PointerDecoder<uint64_t, void*> pHandle;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pObject);
-    bytes_read += pAttributes.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Access);
-    bytes_read += Name.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pHandle.DecodeVoidPtr((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pObject);
+    bytes_read += pAttributes.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Access);
+    bytes_read += Name.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pHandle.DecodeVoidPtr((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7208,9 +7208,9 @@ size_t Dx12Decoder::Decode_ID3D12Device_OpenSharedHandle(format::HandleId object
     HRESULT return_value;
 
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NTHandle);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppvObj.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppvObj.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7229,10 +7229,10 @@ size_t Dx12Decoder::Decode_ID3D12Device_OpenSharedHandleByName(format::HandleId
     PointerDecoder<uint64_t, void*> pNTHandle;
     HRESULT return_value;
 
-    bytes_read += Name.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Access);
-    bytes_read += pNTHandle.DecodeVoidPtr((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += Name.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Access);
+    bytes_read += pNTHandle.DecodeVoidPtr((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7250,9 +7250,9 @@ size_t Dx12Decoder::Decode_ID3D12Device_MakeResident(format::HandleId object_id,
     HandlePointerDecoder<ID3D12Pageable*> ppObjects;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumObjects);
-    bytes_read += ppObjects.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumObjects);
+    bytes_read += ppObjects.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7270,9 +7270,9 @@ size_t Dx12Decoder::Decode_ID3D12Device_Evict(format::HandleId object_id, const
     HandlePointerDecoder<ID3D12Pageable*> ppObjects;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumObjects);
-    bytes_read += ppObjects.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumObjects);
+    bytes_read += ppObjects.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7294,11 +7294,11 @@ size_t Dx12Decoder::Decode_ID3D12Device_CreateFence(format::HandleId object_id,
     HandlePointerDecoder<void*> ppFence;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &InitialValue);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Flags);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppFence.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &InitialValue);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Flags);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppFence.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7314,7 +7314,7 @@ size_t Dx12Decoder::Decode_ID3D12Device_GetDeviceRemovedReason(format::HandleId
 
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7337,14 +7337,14 @@ size_t Dx12Decoder::Decode_ID3D12Device_GetCopyableFootprints(format::HandleId o
     PointerDecoder<UINT64> pRowSizeInBytes;
     PointerDecoder<UINT64> pTotalBytes;
 
-    bytes_read += pResourceDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &FirstSubresource);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumSubresources);
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &BaseOffset);
-    bytes_read += pLayouts.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pNumRows.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pRowSizeInBytes.DecodeUInt64((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pTotalBytes.DecodeUInt64((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += pResourceDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &FirstSubresource);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumSubresources);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &BaseOffset);
+    bytes_read += pLayouts.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pNumRows.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pRowSizeInBytes.DecodeUInt64((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pTotalBytes.DecodeUInt64((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -7365,10 +7365,10 @@ size_t Dx12Decoder::Decode_ID3D12Device_CreateQueryHeap(format::HandleId object_
     HandlePointerDecoder<void*> ppvHeap;
     HRESULT return_value;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppvHeap.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppvHeap.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7385,8 +7385,8 @@ size_t Dx12Decoder::Decode_ID3D12Device_SetStablePowerState(format::HandleId obj
     BOOL Enable;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Enable);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Enable);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7408,11 +7408,11 @@ size_t Dx12Decoder::Decode_ID3D12Device_CreateCommandSignature(format::HandleId
     HandlePointerDecoder<void*> ppvCommandSignature;
     HRESULT return_value;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pRootSignature);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppvCommandSignature.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pRootSignature);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppvCommandSignature.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7434,13 +7434,13 @@ size_t Dx12Decoder::Decode_ID3D12Device_GetResourceTiling(format::HandleId objec
     UINT FirstSubresourceTilingToGet;
     StructPointerDecoder<Decoded_D3D12_SUBRESOURCE_TILING> pSubresourceTilingsForNonPackedMips;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pTiledResource);
-    bytes_read += pNumTilesForEntireResource.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pPackedMipDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pStandardTileShapeForNonPackedMips.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pNumSubresourceTilings.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &FirstSubresourceTilingToGet);
-    bytes_read += pSubresourceTilingsForNonPackedMips.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pTiledResource);
+    bytes_read += pNumTilesForEntireResource.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pPackedMipDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pStandardTileShapeForNonPackedMips.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pNumSubresourceTilings.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &FirstSubresourceTilingToGet);
+    bytes_read += pSubresourceTilingsForNonPackedMips.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -7458,7 +7458,7 @@ size_t Dx12Decoder::Decode_ID3D12Device_GetAdapterLuid(format::HandleId object_i
     LUID value_returned;
     return_value.decoded_value = &value_returned;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7476,9 +7476,9 @@ size_t Dx12Decoder::Decode_ID3D12PipelineLibrary_StorePipeline(format::HandleId
     format::HandleId pPipeline;
     HRESULT return_value;
 
-    bytes_read += pName.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pPipeline);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pName.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pPipeline);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7500,11 +7500,11 @@ size_t Dx12Decoder::Decode_ID3D12PipelineLibrary_LoadGraphicsPipeline(format::Ha
     HandlePointerDecoder<void*> ppPipelineState;
     HRESULT return_value;
 
-    bytes_read += pName.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppPipelineState.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pName.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppPipelineState.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7526,11 +7526,11 @@ size_t Dx12Decoder::Decode_ID3D12PipelineLibrary_LoadComputePipeline(format::Han
     HandlePointerDecoder<void*> ppPipelineState;
     HRESULT return_value;
 
-    bytes_read += pName.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppPipelineState.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pName.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppPipelineState.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7546,7 +7546,7 @@ size_t Dx12Decoder::Decode_ID3D12PipelineLibrary_GetSerializedSize(format::Handl
 
     SIZE_T return_value;
 
-    bytes_read += ValueDecoder::DecodeSizeTValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeSizeTValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7564,9 +7564,9 @@ size_t Dx12Decoder::Decode_ID3D12PipelineLibrary_Serialize(format::HandleId obje
     SIZE_T DataSizeInBytes;
     HRESULT return_value;
 
-    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeSizeTValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DataSizeInBytes);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeSizeTValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DataSizeInBytes);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7588,11 +7588,11 @@ size_t Dx12Decoder::Decode_ID3D12PipelineLibrary1_LoadPipeline(format::HandleId
     HandlePointerDecoder<void*> ppPipelineState;
     HRESULT return_value;
 
-    bytes_read += pName.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppPipelineState.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pName.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppPipelineState.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7614,11 +7614,11 @@ size_t Dx12Decoder::Decode_ID3D12Device1_CreatePipelineLibrary(format::HandleId
     HandlePointerDecoder<void*> ppPipelineLibrary;
     HRESULT return_value;
 
-    bytes_read += pLibraryBlob.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeSizeTValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &BlobLength);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppPipelineLibrary.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pLibraryBlob.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeSizeTValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &BlobLength);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppPipelineLibrary.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7639,12 +7639,12 @@ size_t Dx12Decoder::Decode_ID3D12Device1_SetEventOnMultipleFenceCompletion(forma
     uint64_t hEvent;
     HRESULT return_value;
 
-    bytes_read += ppFences.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pFenceValues.DecodeUInt64((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumFences);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Flags);
+    bytes_read += ppFences.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pFenceValues.DecodeUInt64((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumFences);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Flags);
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &hEvent);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7663,10 +7663,10 @@ size_t Dx12Decoder::Decode_ID3D12Device1_SetResidencyPriority(format::HandleId o
     PointerDecoder<D3D12_RESIDENCY_PRIORITY> pPriorities;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumObjects);
-    bytes_read += ppObjects.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pPriorities.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumObjects);
+    bytes_read += ppObjects.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pPriorities.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7687,10 +7687,10 @@ size_t Dx12Decoder::Decode_ID3D12Device2_CreatePipelineState(format::HandleId ob
     HandlePointerDecoder<void*> ppPipelineState;
     HRESULT return_value;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppPipelineState.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppPipelineState.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7712,9 +7712,9 @@ size_t Dx12Decoder::Decode_ID3D12Device3_OpenExistingHeapFromAddress(format::Han
     HRESULT return_value;
 
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pAddress);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppvHeap.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppvHeap.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7736,9 +7736,9 @@ size_t Dx12Decoder::Decode_ID3D12Device3_OpenExistingHeapFromFileMapping(format:
     HRESULT return_value;
 
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &hFileMapping);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppvHeap.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppvHeap.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7759,12 +7759,12 @@ size_t Dx12Decoder::Decode_ID3D12Device3_EnqueueMakeResident(format::HandleId ob
     UINT64 FenceValueToSignal;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Flags);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumObjects);
-    bytes_read += ppObjects.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pFenceToSignal);
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &FenceValueToSignal);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Flags);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumObjects);
+    bytes_read += ppObjects.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pFenceToSignal);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &FenceValueToSignal);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7784,9 +7784,9 @@ size_t Dx12Decoder::Decode_ID3D12ProtectedSession_GetStatusFence(format::HandleI
     HandlePointerDecoder<void*> ppFence;
     HRESULT return_value;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppFence.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppFence.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7802,7 +7802,7 @@ size_t Dx12Decoder::Decode_ID3D12ProtectedSession_GetSessionStatus(format::Handl
 
     D3D12_PROTECTED_SESSION_STATUS return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7820,7 +7820,7 @@ size_t Dx12Decoder::Decode_ID3D12ProtectedResourceSession_GetDesc(format::Handle
     D3D12_PROTECTED_RESOURCE_SESSION_DESC value_returned;
     return_value.decoded_value = &value_returned;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7843,12 +7843,12 @@ size_t Dx12Decoder::Decode_ID3D12Device4_CreateCommandList1(format::HandleId obj
     HandlePointerDecoder<void*> ppCommandList;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &nodeMask);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &type);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &flags);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppCommandList.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &nodeMask);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &type);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &flags);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppCommandList.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7869,10 +7869,10 @@ size_t Dx12Decoder::Decode_ID3D12Device4_CreateProtectedResourceSession(format::
     HandlePointerDecoder<void*> ppSession;
     HRESULT return_value;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppSession.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppSession.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7898,15 +7898,15 @@ size_t Dx12Decoder::Decode_ID3D12Device4_CreateCommittedResource1(format::Handle
     HandlePointerDecoder<void*> ppvResource;
     HRESULT return_value;
 
-    bytes_read += pHeapProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &HeapFlags);
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &InitialResourceState);
-    bytes_read += pOptimizedClearValue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pProtectedSession);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riidResource);
-    bytes_read += ppvResource.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pHeapProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &HeapFlags);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &InitialResourceState);
+    bytes_read += pOptimizedClearValue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pProtectedSession);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riidResource);
+    bytes_read += ppvResource.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7928,11 +7928,11 @@ size_t Dx12Decoder::Decode_ID3D12Device4_CreateHeap1(format::HandleId object_id,
     HandlePointerDecoder<void*> ppvHeap;
     HRESULT return_value;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pProtectedSession);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppvHeap.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pProtectedSession);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppvHeap.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7956,13 +7956,13 @@ size_t Dx12Decoder::Decode_ID3D12Device4_CreateReservedResource1(format::HandleI
     HandlePointerDecoder<void*> ppvResource;
     HRESULT return_value;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &InitialState);
-    bytes_read += pOptimizedClearValue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pProtectedSession);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppvResource.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &InitialState);
+    bytes_read += pOptimizedClearValue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pProtectedSession);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppvResource.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -7984,11 +7984,11 @@ size_t Dx12Decoder::Decode_ID3D12Device4_GetResourceAllocationInfo1(format::Hand
     D3D12_RESOURCE_ALLOCATION_INFO value_returned;
     return_value.decoded_value = &value_returned;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &visibleMask);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &numResourceDescs);
-    bytes_read += pResourceDescs.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pResourceAllocationInfo1.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &visibleMask);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &numResourceDescs);
+    bytes_read += pResourceDescs.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pResourceAllocationInfo1.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -8004,7 +8004,7 @@ size_t Dx12Decoder::Decode_ID3D12LifetimeOwner_LifetimeStateUpdated(format::Hand
 
     D3D12_LIFETIME_STATE NewState;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NewState);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NewState);
 
     for (auto consumer : GetConsumers())
     {
@@ -8022,7 +8022,7 @@ size_t Dx12Decoder::Decode_ID3D12SwapChainAssistant_GetLUID(format::HandleId obj
     LUID value_returned;
     return_value.decoded_value = &value_returned;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -8042,9 +8042,9 @@ size_t Dx12Decoder::Decode_ID3D12SwapChainAssistant_GetSwapChainObject(format::H
     HandlePointerDecoder<void*> ppv;
     HRESULT return_value;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppv.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppv.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -8068,11 +8068,11 @@ size_t Dx12Decoder::Decode_ID3D12SwapChainAssistant_GetCurrentResourceAndCommand
     HandlePointerDecoder<void*> ppvQueue;
     HRESULT return_value;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riidResource);
-    bytes_read += ppvResource.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riidQueue);
-    bytes_read += ppvQueue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riidResource);
+    bytes_read += ppvResource.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riidQueue);
+    bytes_read += ppvQueue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -8088,7 +8088,7 @@ size_t Dx12Decoder::Decode_ID3D12SwapChainAssistant_InsertImplicitSync(format::H
 
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -8105,8 +8105,8 @@ size_t Dx12Decoder::Decode_ID3D12LifetimeTracker_DestroyOwnedObject(format::Hand
     format::HandleId pObject;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pObject);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pObject);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -8123,8 +8123,8 @@ size_t Dx12Decoder::Decode_ID3D12StateObjectProperties_GetShaderIdentifier(forma
     WStringDecoder pExportName;
     PointerDecoder<uint8_t> return_value;
 
-    bytes_read += pExportName.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += return_value.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += pExportName.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += return_value.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -8141,8 +8141,8 @@ size_t Dx12Decoder::Decode_ID3D12StateObjectProperties_GetShaderStackSize(format
     WStringDecoder pExportName;
     UINT64 return_value;
 
-    bytes_read += pExportName.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pExportName.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -8158,7 +8158,7 @@ size_t Dx12Decoder::Decode_ID3D12StateObjectProperties_GetPipelineStackSize(form
 
     UINT64 return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -8174,7 +8174,7 @@ size_t Dx12Decoder::Decode_ID3D12StateObjectProperties_SetPipelineStackSize(form
 
     UINT64 PipelineStackSizeInBytes;
 
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &PipelineStackSizeInBytes);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &PipelineStackSizeInBytes);
 
     for (auto consumer : GetConsumers())
     {
@@ -8195,10 +8195,10 @@ size_t Dx12Decoder::Decode_ID3D12Device5_CreateLifetimeTracker(format::HandleId
     HandlePointerDecoder<void*> ppvTracker;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pOwner);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppvTracker.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pOwner);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppvTracker.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -8230,9 +8230,9 @@ size_t Dx12Decoder::Decode_ID3D12Device5_EnumerateMetaCommands(format::HandleId
     StructPointerDecoder<Decoded_D3D12_META_COMMAND_DESC> pDescs;
     HRESULT return_value;
 
-    bytes_read += pNumMetaCommands.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pDescs.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pNumMetaCommands.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pDescs.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -8255,12 +8255,12 @@ size_t Dx12Decoder::Decode_ID3D12Device5_EnumerateMetaCommandParameters(format::
     StructPointerDecoder<Decoded_D3D12_META_COMMAND_PARAMETER_DESC> pParameterDescs;
     HRESULT return_value;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &CommandId);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Stage);
-    bytes_read += pTotalStructureSizeInBytes.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pParameterCount.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pParameterDescs.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &CommandId);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Stage);
+    bytes_read += pTotalStructureSizeInBytes.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pParameterCount.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pParameterDescs.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -8286,13 +8286,13 @@ size_t Dx12Decoder::Decode_ID3D12Device5_CreateMetaCommand(format::HandleId obje
     HandlePointerDecoder<void*> ppMetaCommand;
     HRESULT return_value;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &CommandId);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NodeMask);
-    bytes_read += pCreationParametersData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeSizeTValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &CreationParametersDataSizeInBytes);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppMetaCommand.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &CommandId);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NodeMask);
+    bytes_read += pCreationParametersData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeSizeTValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &CreationParametersDataSizeInBytes);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppMetaCommand.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -8313,10 +8313,10 @@ size_t Dx12Decoder::Decode_ID3D12Device5_CreateStateObject(format::HandleId obje
     HandlePointerDecoder<void*> ppStateObject;
     HRESULT return_value;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppStateObject.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppStateObject.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -8333,8 +8333,8 @@ size_t Dx12Decoder::Decode_ID3D12Device5_GetRaytracingAccelerationStructurePrebu
     StructPointerDecoder<Decoded_D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS> pDesc;
     StructPointerDecoder<Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_PREBUILD_INFO> pInfo;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pInfo.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -8352,9 +8352,9 @@ size_t Dx12Decoder::Decode_ID3D12Device5_CheckDriverMatchingIdentifier(format::H
     StructPointerDecoder<Decoded_D3D12_SERIALIZED_DATA_DRIVER_MATCHING_IDENTIFIER> pIdentifierToCheck;
     D3D12_DRIVER_MATCHING_IDENTIFIER_STATUS return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &SerializedDataType);
-    bytes_read += pIdentifierToCheck.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &SerializedDataType);
+    bytes_read += pIdentifierToCheck.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -8370,7 +8370,7 @@ size_t Dx12Decoder::Decode_ID3D12DeviceRemovedExtendedDataSettings_SetAutoBreadc
 
     D3D12_DRED_ENABLEMENT Enablement;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Enablement);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Enablement);
 
     for (auto consumer : GetConsumers())
     {
@@ -8386,7 +8386,7 @@ size_t Dx12Decoder::Decode_ID3D12DeviceRemovedExtendedDataSettings_SetPageFaultE
 
     D3D12_DRED_ENABLEMENT Enablement;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Enablement);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Enablement);
 
     for (auto consumer : GetConsumers())
     {
@@ -8402,7 +8402,7 @@ size_t Dx12Decoder::Decode_ID3D12DeviceRemovedExtendedDataSettings_SetWatsonDump
 
     D3D12_DRED_ENABLEMENT Enablement;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Enablement);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Enablement);
 
     for (auto consumer : GetConsumers())
     {
@@ -8418,7 +8418,7 @@ size_t Dx12Decoder::Decode_ID3D12DeviceRemovedExtendedDataSettings1_SetBreadcrum
 
     D3D12_DRED_ENABLEMENT Enablement;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Enablement);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Enablement);
 
     for (auto consumer : GetConsumers())
     {
@@ -8434,7 +8434,7 @@ size_t Dx12Decoder::Decode_ID3D12DeviceRemovedExtendedDataSettings2_UseMarkersOn
 
     BOOL MarkersOnly;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &MarkersOnly);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &MarkersOnly);
 
     for (auto consumer : GetConsumers())
     {
@@ -8451,8 +8451,8 @@ size_t Dx12Decoder::Decode_ID3D12DeviceRemovedExtendedData_GetAutoBreadcrumbsOut
     StructPointerDecoder<Decoded_D3D12_DRED_AUTO_BREADCRUMBS_OUTPUT> pOutput;
     HRESULT return_value;
 
-    bytes_read += pOutput.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pOutput.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -8469,8 +8469,8 @@ size_t Dx12Decoder::Decode_ID3D12DeviceRemovedExtendedData_GetPageFaultAllocatio
     StructPointerDecoder<Decoded_D3D12_DRED_PAGE_FAULT_OUTPUT> pOutput;
     HRESULT return_value;
 
-    bytes_read += pOutput.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pOutput.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -8487,8 +8487,8 @@ size_t Dx12Decoder::Decode_ID3D12DeviceRemovedExtendedData1_GetAutoBreadcrumbsOu
     StructPointerDecoder<Decoded_D3D12_DRED_AUTO_BREADCRUMBS_OUTPUT1> pOutput;
     HRESULT return_value;
 
-    bytes_read += pOutput.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pOutput.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -8505,8 +8505,8 @@ size_t Dx12Decoder::Decode_ID3D12DeviceRemovedExtendedData1_GetPageFaultAllocati
     StructPointerDecoder<Decoded_D3D12_DRED_PAGE_FAULT_OUTPUT1> pOutput;
     HRESULT return_value;
 
-    bytes_read += pOutput.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pOutput.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -8523,8 +8523,8 @@ size_t Dx12Decoder::Decode_ID3D12DeviceRemovedExtendedData2_GetPageFaultAllocati
     StructPointerDecoder<Decoded_D3D12_DRED_PAGE_FAULT_OUTPUT2> pOutput;
     HRESULT return_value;
 
-    bytes_read += pOutput.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pOutput.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -8540,7 +8540,7 @@ size_t Dx12Decoder::Decode_ID3D12DeviceRemovedExtendedData2_GetDeviceState(forma
 
     D3D12_DRED_DEVICE_STATE return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -8560,11 +8560,11 @@ size_t Dx12Decoder::Decode_ID3D12Device6_SetBackgroundProcessingMode(format::Han
     PointerDecoder<BOOL> pbFurtherMeasurementsDesired;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Mode);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &MeasurementsAction);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Mode);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &MeasurementsAction);
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &hEventToSignalUponCompletion);
-    bytes_read += pbFurtherMeasurementsDesired.DecodeInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pbFurtherMeasurementsDesired.DecodeInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -8582,7 +8582,7 @@ size_t Dx12Decoder::Decode_ID3D12ProtectedResourceSession1_GetDesc1(format::Hand
     D3D12_PROTECTED_RESOURCE_SESSION_DESC1 value_returned;
     return_value.decoded_value = &value_returned;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -8604,11 +8604,11 @@ size_t Dx12Decoder::Decode_ID3D12Device7_AddToStateObject(format::HandleId objec
     HandlePointerDecoder<void*> ppNewStateObject;
     HRESULT return_value;
 
-    bytes_read += pAddition.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pStateObjectToGrowFrom);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppNewStateObject.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pAddition.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pStateObjectToGrowFrom);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppNewStateObject.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -8629,10 +8629,10 @@ size_t Dx12Decoder::Decode_ID3D12Device7_CreateProtectedResourceSession1(format:
     HandlePointerDecoder<void*> ppSession;
     HRESULT return_value;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppSession.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppSession.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -8654,11 +8654,11 @@ size_t Dx12Decoder::Decode_ID3D12Device8_GetResourceAllocationInfo2(format::Hand
     D3D12_RESOURCE_ALLOCATION_INFO value_returned;
     return_value.decoded_value = &value_returned;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &visibleMask);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &numResourceDescs);
-    bytes_read += pResourceDescs.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pResourceAllocationInfo1.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &visibleMask);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &numResourceDescs);
+    bytes_read += pResourceDescs.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pResourceAllocationInfo1.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -8684,15 +8684,15 @@ size_t Dx12Decoder::Decode_ID3D12Device8_CreateCommittedResource2(format::Handle
     HandlePointerDecoder<void*> ppvResource;
     HRESULT return_value;
 
-    bytes_read += pHeapProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &HeapFlags);
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &InitialResourceState);
-    bytes_read += pOptimizedClearValue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pProtectedSession);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riidResource);
-    bytes_read += ppvResource.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pHeapProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &HeapFlags);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &InitialResourceState);
+    bytes_read += pOptimizedClearValue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pProtectedSession);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riidResource);
+    bytes_read += ppvResource.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -8717,14 +8717,14 @@ size_t Dx12Decoder::Decode_ID3D12Device8_CreatePlacedResource1(format::HandleId
     HandlePointerDecoder<void*> ppvResource;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pHeap);
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &HeapOffset);
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &InitialState);
-    bytes_read += pOptimizedClearValue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppvResource.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pHeap);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &HeapOffset);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &InitialState);
+    bytes_read += pOptimizedClearValue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppvResource.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -8744,9 +8744,9 @@ size_t Dx12Decoder::Decode_ID3D12Device8_CreateSamplerFeedbackUnorderedAccessVie
     D3D12_CPU_DESCRIPTOR_HANDLE value_DestDescriptor;
     DestDescriptor.decoded_value = &value_DestDescriptor;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pTargetedResource);
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pFeedbackResource);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DestDescriptor);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pTargetedResource);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pFeedbackResource);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DestDescriptor);
 
     for (auto consumer : GetConsumers())
     {
@@ -8769,14 +8769,14 @@ size_t Dx12Decoder::Decode_ID3D12Device8_GetCopyableFootprints1(format::HandleId
     PointerDecoder<UINT64> pRowSizeInBytes;
     PointerDecoder<UINT64> pTotalBytes;
 
-    bytes_read += pResourceDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &FirstSubresource);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumSubresources);
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &BaseOffset);
-    bytes_read += pLayouts.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pNumRows.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pRowSizeInBytes.DecodeUInt64((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pTotalBytes.DecodeUInt64((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += pResourceDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &FirstSubresource);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumSubresources);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &BaseOffset);
+    bytes_read += pLayouts.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pNumRows.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pRowSizeInBytes.DecodeUInt64((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pTotalBytes.DecodeUInt64((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -8796,9 +8796,9 @@ size_t Dx12Decoder::Decode_ID3D12Resource1_GetProtectedResourceSession(format::H
     HandlePointerDecoder<void*> ppProtectedSession;
     HRESULT return_value;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppProtectedSession.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppProtectedSession.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -8816,7 +8816,7 @@ size_t Dx12Decoder::Decode_ID3D12Resource2_GetDesc1(format::HandleId object_id,
     D3D12_RESOURCE_DESC1 value_returned;
     return_value.decoded_value = &value_returned;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -8836,9 +8836,9 @@ size_t Dx12Decoder::Decode_ID3D12Heap1_GetProtectedResourceSession(format::Handl
     HandlePointerDecoder<void*> ppProtectedSession;
     HRESULT return_value;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppProtectedSession.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppProtectedSession.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -8854,7 +8854,7 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList3_SetProtectedResourceSessio
 
     format::HandleId pProtectedResourceSession;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pProtectedResourceSession);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pProtectedResourceSession);
 
     for (auto consumer : GetConsumers())
     {
@@ -8872,9 +8872,9 @@ size_t Dx12Decoder::Decode_ID3D12MetaCommand_GetRequiredParameterResourceSize(fo
     UINT ParameterIndex;
     UINT64 return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Stage);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &ParameterIndex);
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Stage);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &ParameterIndex);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -8893,10 +8893,10 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList4_BeginRenderPass(format::Ha
     StructPointerDecoder<Decoded_D3D12_RENDER_PASS_DEPTH_STENCIL_DESC> pDepthStencil;
     D3D12_RENDER_PASS_FLAGS Flags;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumRenderTargets);
-    bytes_read += pRenderTargets.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pDepthStencil.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Flags);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumRenderTargets);
+    bytes_read += pRenderTargets.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pDepthStencil.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Flags);
 
     for (auto consumer : GetConsumers())
     {
@@ -8928,9 +8928,9 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList4_InitializeMetaCommand(form
     PointerDecoder<uint8_t> pInitializationParametersData;
     SIZE_T InitializationParametersDataSizeInBytes;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pMetaCommand);
-    bytes_read += pInitializationParametersData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeSizeTValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &InitializationParametersDataSizeInBytes);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pMetaCommand);
+    bytes_read += pInitializationParametersData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeSizeTValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &InitializationParametersDataSizeInBytes);
 
     for (auto consumer : GetConsumers())
     {
@@ -8948,9 +8948,9 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList4_ExecuteMetaCommand(format:
     PointerDecoder<uint8_t> pExecutionParametersData;
     SIZE_T ExecutionParametersDataSizeInBytes;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pMetaCommand);
-    bytes_read += pExecutionParametersData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeSizeTValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &ExecutionParametersDataSizeInBytes);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pMetaCommand);
+    bytes_read += pExecutionParametersData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeSizeTValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &ExecutionParametersDataSizeInBytes);
 
     for (auto consumer : GetConsumers())
     {
@@ -8968,9 +8968,9 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList4_BuildRaytracingAcceleratio
     UINT NumPostbuildInfoDescs;
     StructPointerDecoder<Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_DESC> pPostbuildInfoDescs;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumPostbuildInfoDescs);
-    bytes_read += pPostbuildInfoDescs.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumPostbuildInfoDescs);
+    bytes_read += pPostbuildInfoDescs.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -8988,9 +8988,9 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList4_EmitRaytracingAcceleration
     UINT NumSourceAccelerationStructures;
     PointerDecoder<D3D12_GPU_VIRTUAL_ADDRESS> pSourceAccelerationStructureData;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumSourceAccelerationStructures);
-    bytes_read += pSourceAccelerationStructureData.DecodeUInt64((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumSourceAccelerationStructures);
+    bytes_read += pSourceAccelerationStructureData.DecodeUInt64((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -9008,9 +9008,9 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList4_CopyRaytracingAcceleration
     D3D12_GPU_VIRTUAL_ADDRESS SourceAccelerationStructureData;
     D3D12_RAYTRACING_ACCELERATION_STRUCTURE_COPY_MODE Mode;
 
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DestAccelerationStructureData);
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &SourceAccelerationStructureData);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Mode);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DestAccelerationStructureData);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &SourceAccelerationStructureData);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Mode);
 
     for (auto consumer : GetConsumers())
     {
@@ -9026,7 +9026,7 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList4_SetPipelineState1(format::
 
     format::HandleId pStateObject;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pStateObject);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pStateObject);
 
     for (auto consumer : GetConsumers())
     {
@@ -9042,7 +9042,7 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList4_DispatchRays(format::Handl
 
     StructPointerDecoder<Decoded_D3D12_DISPATCH_RAYS_DESC> pDesc;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -9062,11 +9062,11 @@ size_t Dx12Decoder::Decode_ID3D12ShaderCacheSession_FindValue(format::HandleId o
     PointerDecoder<UINT> pValueSize;
     HRESULT return_value;
 
-    bytes_read += pKey.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &KeySize);
-    bytes_read += pValue.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pValueSize.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pKey.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &KeySize);
+    bytes_read += pValue.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pValueSize.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -9086,11 +9086,11 @@ size_t Dx12Decoder::Decode_ID3D12ShaderCacheSession_StoreValue(format::HandleId
     UINT ValueSize;
     HRESULT return_value;
 
-    bytes_read += pKey.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &KeySize);
-    bytes_read += pValue.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &ValueSize);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pKey.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &KeySize);
+    bytes_read += pValue.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &ValueSize);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -9122,7 +9122,7 @@ size_t Dx12Decoder::Decode_ID3D12ShaderCacheSession_GetDesc(format::HandleId obj
     D3D12_SHADER_CACHE_SESSION_DESC value_returned;
     return_value.decoded_value = &value_returned;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -9143,10 +9143,10 @@ size_t Dx12Decoder::Decode_ID3D12Device9_CreateShaderCacheSession(format::Handle
     HandlePointerDecoder<void*> ppvSession;
     HRESULT return_value;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppvSession.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppvSession.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -9164,9 +9164,9 @@ size_t Dx12Decoder::Decode_ID3D12Device9_ShaderCacheControl(format::HandleId obj
     D3D12_SHADER_CACHE_CONTROL_FLAGS Control;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Kinds);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Control);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Kinds);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Control);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -9190,11 +9190,11 @@ size_t Dx12Decoder::Decode_ID3D12Device9_CreateCommandQueue1(format::HandleId ob
     HandlePointerDecoder<void*> ppCommandQueue;
     HRESULT return_value;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &CreatorID);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppCommandQueue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &CreatorID);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppCommandQueue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -9222,17 +9222,17 @@ size_t Dx12Decoder::Decode_ID3D12Device10_CreateCommittedResource3(format::Handl
     HandlePointerDecoder<void*> ppvResource;
     HRESULT return_value;
 
-    bytes_read += pHeapProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &HeapFlags);
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &InitialLayout);
-    bytes_read += pOptimizedClearValue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pProtectedSession);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumCastableFormats);
-    bytes_read += pCastableFormats.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riidResource);
-    bytes_read += ppvResource.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pHeapProperties.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &HeapFlags);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &InitialLayout);
+    bytes_read += pOptimizedClearValue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pProtectedSession);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumCastableFormats);
+    bytes_read += pCastableFormats.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riidResource);
+    bytes_read += ppvResource.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -9259,16 +9259,16 @@ size_t Dx12Decoder::Decode_ID3D12Device10_CreatePlacedResource2(format::HandleId
     HandlePointerDecoder<void*> ppvResource;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pHeap);
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &HeapOffset);
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &InitialLayout);
-    bytes_read += pOptimizedClearValue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumCastableFormats);
-    bytes_read += pCastableFormats.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppvResource.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pHeap);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &HeapOffset);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &InitialLayout);
+    bytes_read += pOptimizedClearValue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumCastableFormats);
+    bytes_read += pCastableFormats.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppvResource.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -9294,15 +9294,15 @@ size_t Dx12Decoder::Decode_ID3D12Device10_CreateReservedResource2(format::Handle
     HandlePointerDecoder<void*> ppvResource;
     HRESULT return_value;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &InitialLayout);
-    bytes_read += pOptimizedClearValue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pProtectedSession);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumCastableFormats);
-    bytes_read += pCastableFormats.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppvResource.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &InitialLayout);
+    bytes_read += pOptimizedClearValue.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pProtectedSession);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumCastableFormats);
+    bytes_read += pCastableFormats.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppvResource.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -9321,8 +9321,8 @@ size_t Dx12Decoder::Decode_ID3D12Device11_CreateSampler2(format::HandleId object
     D3D12_CPU_DESCRIPTOR_HANDLE value_DestDescriptor;
     DestDescriptor.decoded_value = &value_DestDescriptor;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DestDescriptor);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DestDescriptor);
 
     for (auto consumer : GetConsumers())
     {
@@ -9346,13 +9346,13 @@ size_t Dx12Decoder::Decode_ID3D12Device12_GetResourceAllocationInfo3(format::Han
     D3D12_RESOURCE_ALLOCATION_INFO value_returned;
     return_value.decoded_value = &value_returned;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &visibleMask);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &numResourceDescs);
-    bytes_read += pResourceDescs.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pNumCastableFormats.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ppCastableFormats.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pResourceAllocationInfo1.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &visibleMask);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &numResourceDescs);
+    bytes_read += pResourceDescs.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pNumCastableFormats.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ppCastableFormats.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pResourceAllocationInfo1.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -9370,9 +9370,9 @@ size_t Dx12Decoder::Decode_ID3D12VirtualizationGuestDevice_ShareWithHost(format:
     PointerDecoder<uint64_t, void*> pHandle;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pObject);
-    bytes_read += pHandle.DecodeVoidPtr((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pObject);
+    bytes_read += pHandle.DecodeVoidPtr((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -9391,10 +9391,10 @@ size_t Dx12Decoder::Decode_ID3D12VirtualizationGuestDevice_CreateFenceFd(format:
     PointerDecoder<int> pFenceFd;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pFence);
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &FenceValue);
-    bytes_read += pFenceFd.DecodeInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pFence);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &FenceValue);
+    bytes_read += pFenceFd.DecodeInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -9410,7 +9410,7 @@ size_t Dx12Decoder::Decode_ID3D12Tools_EnableShaderInstrumentation(format::Handl
 
     BOOL bEnable;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &bEnable);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &bEnable);
 
     for (auto consumer : GetConsumers())
     {
@@ -9426,7 +9426,7 @@ size_t Dx12Decoder::Decode_ID3D12Tools_ShaderInstrumentationEnabled(format::Hand
 
     BOOL return_value;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -9444,9 +9444,9 @@ size_t Dx12Decoder::Decode_ID3D12SDKConfiguration_SetSDKVersion(format::HandleId
     StringDecoder SDKPath;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &SDKVersion);
-    bytes_read += SDKPath.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &SDKVersion);
+    bytes_read += SDKPath.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -9468,11 +9468,11 @@ size_t Dx12Decoder::Decode_ID3D12SDKConfiguration1_CreateDeviceFactory(format::H
     HandlePointerDecoder<void*> ppvFactory;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &SDKVersion);
-    bytes_read += SDKPath.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppvFactory.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &SDKVersion);
+    bytes_read += SDKPath.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppvFactory.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -9502,7 +9502,7 @@ size_t Dx12Decoder::Decode_ID3D12DeviceFactory_InitializeFromGlobalState(format:
 
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -9518,7 +9518,7 @@ size_t Dx12Decoder::Decode_ID3D12DeviceFactory_ApplyToGlobalState(format::Handle
 
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -9535,8 +9535,8 @@ size_t Dx12Decoder::Decode_ID3D12DeviceFactory_SetFlags(format::HandleId object_
     D3D12_DEVICE_FACTORY_FLAGS flags;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &flags);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &flags);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -9552,7 +9552,7 @@ size_t Dx12Decoder::Decode_ID3D12DeviceFactory_GetFlags(format::HandleId object_
 
     D3D12_DEVICE_FACTORY_FLAGS return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -9575,10 +9575,10 @@ size_t Dx12Decoder::Decode_ID3D12DeviceFactory_GetConfigurationInterface(format:
     HandlePointerDecoder<void*> ppv;
     HRESULT return_value;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &clsid);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &iid);
-    bytes_read += ppv.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &clsid);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &iid);
+    bytes_read += ppv.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -9598,11 +9598,11 @@ size_t Dx12Decoder::Decode_ID3D12DeviceFactory_EnableExperimentalFeatures(format
     PointerDecoder<UINT> pConfigurationStructSizes;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumFeatures);
-    bytes_read += pIIDs.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pConfigurationStructs.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pConfigurationStructSizes.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumFeatures);
+    bytes_read += pIIDs.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pConfigurationStructs.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pConfigurationStructSizes.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -9624,11 +9624,11 @@ size_t Dx12Decoder::Decode_ID3D12DeviceFactory_CreateDevice(format::HandleId obj
     HandlePointerDecoder<void*> ppvDevice;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &adapter);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &FeatureLevel);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppvDevice.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &adapter);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &FeatureLevel);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppvDevice.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -9646,7 +9646,7 @@ size_t Dx12Decoder::Decode_ID3D12DeviceConfiguration_GetDesc(format::HandleId ob
     D3D12_DEVICE_CONFIGURATION_DESC value_returned;
     return_value.decoded_value = &value_returned;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -9664,9 +9664,9 @@ size_t Dx12Decoder::Decode_ID3D12DeviceConfiguration_GetEnabledExperimentalFeatu
     UINT NumGuids;
     HRESULT return_value;
 
-    bytes_read += pGuids.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumGuids);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pGuids.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumGuids);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -9685,10 +9685,10 @@ size_t Dx12Decoder::Decode_ID3D12DeviceConfiguration_SerializeVersionedRootSigna
     HandlePointerDecoder<ID3D10Blob*> ppError;
     HRESULT return_value;
 
-    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ppResult.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ppError.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pDesc.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ppResult.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ppError.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -9710,11 +9710,11 @@ size_t Dx12Decoder::Decode_ID3D12DeviceConfiguration_CreateVersionedRootSignatur
     HandlePointerDecoder<void*> ppvDeserializer;
     HRESULT return_value;
 
-    bytes_read += pBlob.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeSizeTValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Size);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppvDeserializer.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pBlob.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeSizeTValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Size);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppvDeserializer.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -9731,8 +9731,8 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList5_RSSetShadingRate(format::H
     D3D12_SHADING_RATE baseShadingRate;
     PointerDecoder<D3D12_SHADING_RATE_COMBINER> combiners;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &baseShadingRate);
-    bytes_read += combiners.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &baseShadingRate);
+    bytes_read += combiners.DecodeEnum((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -9748,7 +9748,7 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList5_RSSetShadingRateImage(form
 
     format::HandleId shadingRateImage;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &shadingRateImage);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &shadingRateImage);
 
     for (auto consumer : GetConsumers())
     {
@@ -9766,9 +9766,9 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList6_DispatchMesh(format::Handl
     UINT ThreadGroupCountY;
     UINT ThreadGroupCountZ;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &ThreadGroupCountX);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &ThreadGroupCountY);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &ThreadGroupCountZ);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &ThreadGroupCountX);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &ThreadGroupCountY);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &ThreadGroupCountZ);
 
     for (auto consumer : GetConsumers())
     {
@@ -9785,8 +9785,8 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList7_Barrier(format::HandleId o
     UINT32 NumBarrierGroups;
     StructPointerDecoder<Decoded_D3D12_BARRIER_GROUP> pBarrierGroups;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NumBarrierGroups);
-    bytes_read += pBarrierGroups.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NumBarrierGroups);
+    bytes_read += pBarrierGroups.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -9803,8 +9803,8 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList8_OMSetFrontAndBackStencilRe
     UINT FrontStencilRef;
     UINT BackStencilRef;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &FrontStencilRef);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &BackStencilRef);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &FrontStencilRef);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &BackStencilRef);
 
     for (auto consumer : GetConsumers())
     {
@@ -9822,9 +9822,9 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList9_RSSetDepthBias(format::Han
     FLOAT DepthBiasClamp;
     FLOAT SlopeScaledDepthBias;
 
-    bytes_read += ValueDecoder::DecodeFloatValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DepthBias);
-    bytes_read += ValueDecoder::DecodeFloatValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DepthBiasClamp);
-    bytes_read += ValueDecoder::DecodeFloatValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &SlopeScaledDepthBias);
+    bytes_read += ValueDecoder::DecodeFloatValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DepthBias);
+    bytes_read += ValueDecoder::DecodeFloatValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DepthBiasClamp);
+    bytes_read += ValueDecoder::DecodeFloatValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &SlopeScaledDepthBias);
 
     for (auto consumer : GetConsumers())
     {
@@ -9840,7 +9840,7 @@ size_t Dx12Decoder::Decode_ID3D12GraphicsCommandList9_IASetIndexBufferStripCutVa
 
     D3D12_INDEX_BUFFER_STRIP_CUT_VALUE IBStripCutValue;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &IBStripCutValue);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &IBStripCutValue);
 
     for (auto consumer : GetConsumers())
     {
@@ -9862,11 +9862,11 @@ size_t Dx12Decoder::Decode_ID3D12DSRDeviceFactory_CreateDSRDevice(format::Handle
     HandlePointerDecoder<void*> ppvDSRDevice;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pD3D12Device);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &NodeMask);
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppvDSRDevice.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pD3D12Device);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &NodeMask);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppvDSRDevice.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -9898,7 +9898,7 @@ size_t Dx12Decoder::Decode_ID3D10Blob_GetBufferSize(format::HandleId object_id,
 
     SIZE_T return_value;
 
-    bytes_read += ValueDecoder::DecodeSizeTValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeSizeTValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -9919,8 +9919,8 @@ size_t Dx12Decoder::Decode_ID3DDestructionNotifier_RegisterDestructionCallback(f
 
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &callbackFn);
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pData);
-    bytes_read += pCallbackID.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pCallbackID.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -9937,8 +9937,8 @@ size_t Dx12Decoder::Decode_ID3DDestructionNotifier_UnregisterDestructionCallback
     UINT callbackID;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &callbackID);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &callbackID);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -9982,7 +9982,7 @@ size_t Dx12Decoder::Decode_ID3D12Debug1_SetEnableGPUBasedValidation(format::Hand
 
     BOOL Enable;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Enable);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Enable);
 
     for (auto consumer : GetConsumers())
     {
@@ -9998,7 +9998,7 @@ size_t Dx12Decoder::Decode_ID3D12Debug1_SetEnableSynchronizedCommandQueueValidat
 
     BOOL Enable;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Enable);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Enable);
 
     for (auto consumer : GetConsumers())
     {
@@ -10014,7 +10014,7 @@ size_t Dx12Decoder::Decode_ID3D12Debug2_SetGPUBasedValidationFlags(format::Handl
 
     D3D12_GPU_BASED_VALIDATION_FLAGS Flags;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Flags);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Flags);
 
     for (auto consumer : GetConsumers())
     {
@@ -10030,7 +10030,7 @@ size_t Dx12Decoder::Decode_ID3D12Debug3_SetEnableGPUBasedValidation(format::Hand
 
     BOOL Enable;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Enable);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Enable);
 
     for (auto consumer : GetConsumers())
     {
@@ -10046,7 +10046,7 @@ size_t Dx12Decoder::Decode_ID3D12Debug3_SetEnableSynchronizedCommandQueueValidat
 
     BOOL Enable;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Enable);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Enable);
 
     for (auto consumer : GetConsumers())
     {
@@ -10062,7 +10062,7 @@ size_t Dx12Decoder::Decode_ID3D12Debug3_SetGPUBasedValidationFlags(format::Handl
 
     D3D12_GPU_BASED_VALIDATION_FLAGS Flags;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Flags);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Flags);
 
     for (auto consumer : GetConsumers())
     {
@@ -10092,7 +10092,7 @@ size_t Dx12Decoder::Decode_ID3D12Debug5_SetEnableAutoName(format::HandleId objec
 
     BOOL Enable;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Enable);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Enable);
 
     for (auto consumer : GetConsumers())
     {
@@ -10108,7 +10108,7 @@ size_t Dx12Decoder::Decode_ID3D12Debug6_SetForceLegacyBarrierValidation(format::
 
     BOOL Enable;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Enable);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Enable);
 
     for (auto consumer : GetConsumers())
     {
@@ -10127,10 +10127,10 @@ size_t Dx12Decoder::Decode_ID3D12DebugDevice1_SetDebugParameter(format::HandleId
     UINT DataSize;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Type);
-    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DataSize);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Type);
+    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DataSize);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10149,10 +10149,10 @@ size_t Dx12Decoder::Decode_ID3D12DebugDevice1_GetDebugParameter(format::HandleId
     UINT DataSize;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Type);
-    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DataSize);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Type);
+    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DataSize);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10169,8 +10169,8 @@ size_t Dx12Decoder::Decode_ID3D12DebugDevice1_ReportLiveDeviceObjects(format::Ha
     D3D12_RLDO_FLAGS Flags;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Flags);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Flags);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10187,8 +10187,8 @@ size_t Dx12Decoder::Decode_ID3D12DebugDevice_SetFeatureMask(format::HandleId obj
     D3D12_DEBUG_FEATURE Mask;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Mask);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Mask);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10204,7 +10204,7 @@ size_t Dx12Decoder::Decode_ID3D12DebugDevice_GetFeatureMask(format::HandleId obj
 
     D3D12_DEBUG_FEATURE return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10221,8 +10221,8 @@ size_t Dx12Decoder::Decode_ID3D12DebugDevice_ReportLiveDeviceObjects(format::Han
     D3D12_RLDO_FLAGS Flags;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Flags);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Flags);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10241,10 +10241,10 @@ size_t Dx12Decoder::Decode_ID3D12DebugDevice2_SetDebugParameter(format::HandleId
     UINT DataSize;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Type);
-    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DataSize);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Type);
+    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DataSize);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10263,10 +10263,10 @@ size_t Dx12Decoder::Decode_ID3D12DebugDevice2_GetDebugParameter(format::HandleId
     UINT DataSize;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Type);
-    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DataSize);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Type);
+    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DataSize);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10285,10 +10285,10 @@ size_t Dx12Decoder::Decode_ID3D12DebugCommandQueue_AssertResourceState(format::H
     UINT State;
     BOOL return_value;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pResource);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Subresource);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &State);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pResource);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Subresource);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &State);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10306,9 +10306,9 @@ size_t Dx12Decoder::Decode_ID3D12DebugCommandQueue1_AssertResourceAccess(format:
     UINT Subresource;
     D3D12_BARRIER_ACCESS Access;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pResource);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Subresource);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Access);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pResource);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Subresource);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Access);
 
     for (auto consumer : GetConsumers())
     {
@@ -10326,9 +10326,9 @@ size_t Dx12Decoder::Decode_ID3D12DebugCommandQueue1_AssertTextureLayout(format::
     UINT Subresource;
     D3D12_BARRIER_LAYOUT Layout;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pResource);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Subresource);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Layout);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pResource);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Subresource);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Layout);
 
     for (auto consumer : GetConsumers())
     {
@@ -10347,10 +10347,10 @@ size_t Dx12Decoder::Decode_ID3D12DebugCommandList1_AssertResourceState(format::H
     UINT State;
     BOOL return_value;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pResource);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Subresource);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &State);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pResource);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Subresource);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &State);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10369,10 +10369,10 @@ size_t Dx12Decoder::Decode_ID3D12DebugCommandList1_SetDebugParameter(format::Han
     UINT DataSize;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Type);
-    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DataSize);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Type);
+    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DataSize);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10391,10 +10391,10 @@ size_t Dx12Decoder::Decode_ID3D12DebugCommandList1_GetDebugParameter(format::Han
     UINT DataSize;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Type);
-    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DataSize);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Type);
+    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DataSize);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10413,10 +10413,10 @@ size_t Dx12Decoder::Decode_ID3D12DebugCommandList_AssertResourceState(format::Ha
     UINT State;
     BOOL return_value;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pResource);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Subresource);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &State);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pResource);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Subresource);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &State);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10433,8 +10433,8 @@ size_t Dx12Decoder::Decode_ID3D12DebugCommandList_SetFeatureMask(format::HandleI
     D3D12_DEBUG_FEATURE Mask;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Mask);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Mask);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10450,7 +10450,7 @@ size_t Dx12Decoder::Decode_ID3D12DebugCommandList_GetFeatureMask(format::HandleI
 
     D3D12_DEBUG_FEATURE return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10469,10 +10469,10 @@ size_t Dx12Decoder::Decode_ID3D12DebugCommandList2_SetDebugParameter(format::Han
     UINT DataSize;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Type);
-    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DataSize);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Type);
+    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DataSize);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10491,10 +10491,10 @@ size_t Dx12Decoder::Decode_ID3D12DebugCommandList2_GetDebugParameter(format::Han
     UINT DataSize;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Type);
-    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &DataSize);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Type);
+    bytes_read += pData.DecodeVoid((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &DataSize);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10512,9 +10512,9 @@ size_t Dx12Decoder::Decode_ID3D12DebugCommandList3_AssertResourceAccess(format::
     UINT Subresource;
     D3D12_BARRIER_ACCESS Access;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pResource);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Subresource);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Access);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pResource);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Subresource);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Access);
 
     for (auto consumer : GetConsumers())
     {
@@ -10532,9 +10532,9 @@ size_t Dx12Decoder::Decode_ID3D12DebugCommandList3_AssertTextureLayout(format::H
     UINT Subresource;
     D3D12_BARRIER_LAYOUT Layout;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pResource);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Subresource);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Layout);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pResource);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Subresource);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Layout);
 
     for (auto consumer : GetConsumers())
     {
@@ -10552,8 +10552,8 @@ size_t Dx12Decoder::Decode_ID3D12SharingContract_Present(format::HandleId object
     UINT Subresource;
     uint64_t window;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pResource);
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Subresource);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pResource);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Subresource);
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &window);
 
     for (auto consumer : GetConsumers())
@@ -10571,8 +10571,8 @@ size_t Dx12Decoder::Decode_ID3D12SharingContract_SharedFenceSignal(format::Handl
     format::HandleId pFence;
     UINT64 FenceValue;
 
-    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pFence);
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &FenceValue);
+    bytes_read += ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &pFence);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &FenceValue);
 
     for (auto consumer : GetConsumers())
     {
@@ -10590,7 +10590,7 @@ size_t Dx12Decoder::Decode_ID3D12SharingContract_BeginCapturableWork(format::Han
     GUID value_guid;
     guid.decoded_value = &value_guid;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &guid);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &guid);
 
     for (auto consumer : GetConsumers())
     {
@@ -10608,7 +10608,7 @@ size_t Dx12Decoder::Decode_ID3D12SharingContract_EndCapturableWork(format::Handl
     GUID value_guid;
     guid.decoded_value = &value_guid;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &guid);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &guid);
 
     for (auto consumer : GetConsumers())
     {
@@ -10625,8 +10625,8 @@ size_t Dx12Decoder::Decode_ID3D12ManualWriteTrackingResource_TrackWrite(format::
     UINT Subresource;
     StructPointerDecoder<Decoded_D3D12_RANGE> pWrittenRange;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Subresource);
-    bytes_read += pWrittenRange.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Subresource);
+    bytes_read += pWrittenRange.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
 
     for (auto consumer : GetConsumers())
     {
@@ -10643,8 +10643,8 @@ size_t Dx12Decoder::Decode_ID3D12InfoQueue_SetMessageCountLimit(format::HandleId
     UINT64 MessageCountLimit;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &MessageCountLimit);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &MessageCountLimit);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10677,10 +10677,10 @@ size_t Dx12Decoder::Decode_ID3D12InfoQueue_GetMessage(format::HandleId object_id
     PointerDecoder<SIZE_T> pMessageByteLength;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &MessageIndex);
-    bytes_read += pMessage.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pMessageByteLength.DecodeSizeT((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &MessageIndex);
+    bytes_read += pMessage.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pMessageByteLength.DecodeSizeT((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10696,7 +10696,7 @@ size_t Dx12Decoder::Decode_ID3D12InfoQueue_GetNumMessagesAllowedByStorageFilter(
 
     UINT64 return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10712,7 +10712,7 @@ size_t Dx12Decoder::Decode_ID3D12InfoQueue_GetNumMessagesDeniedByStorageFilter(f
 
     UINT64 return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10728,7 +10728,7 @@ size_t Dx12Decoder::Decode_ID3D12InfoQueue_GetNumStoredMessages(format::HandleId
 
     UINT64 return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10744,7 +10744,7 @@ size_t Dx12Decoder::Decode_ID3D12InfoQueue_GetNumStoredMessagesAllowedByRetrieva
 
     UINT64 return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10760,7 +10760,7 @@ size_t Dx12Decoder::Decode_ID3D12InfoQueue_GetNumMessagesDiscardedByMessageCount
 
     UINT64 return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10776,7 +10776,7 @@ size_t Dx12Decoder::Decode_ID3D12InfoQueue_GetMessageCountLimit(format::HandleId
 
     UINT64 return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt64Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10793,8 +10793,8 @@ size_t Dx12Decoder::Decode_ID3D12InfoQueue_AddStorageFilterEntries(format::Handl
     StructPointerDecoder<Decoded_D3D12_INFO_QUEUE_FILTER> pFilter;
     HRESULT return_value;
 
-    bytes_read += pFilter.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pFilter.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10812,9 +10812,9 @@ size_t Dx12Decoder::Decode_ID3D12InfoQueue_GetStorageFilter(format::HandleId obj
     PointerDecoder<SIZE_T> pFilterByteLength;
     HRESULT return_value;
 
-    bytes_read += pFilter.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pFilterByteLength.DecodeSizeT((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pFilter.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pFilterByteLength.DecodeSizeT((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10844,7 +10844,7 @@ size_t Dx12Decoder::Decode_ID3D12InfoQueue_PushEmptyStorageFilter(format::Handle
 
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10860,7 +10860,7 @@ size_t Dx12Decoder::Decode_ID3D12InfoQueue_PushCopyOfStorageFilter(format::Handl
 
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10877,8 +10877,8 @@ size_t Dx12Decoder::Decode_ID3D12InfoQueue_PushStorageFilter(format::HandleId ob
     StructPointerDecoder<Decoded_D3D12_INFO_QUEUE_FILTER> pFilter;
     HRESULT return_value;
 
-    bytes_read += pFilter.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pFilter.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10908,7 +10908,7 @@ size_t Dx12Decoder::Decode_ID3D12InfoQueue_GetStorageFilterStackSize(format::Han
 
     UINT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10925,8 +10925,8 @@ size_t Dx12Decoder::Decode_ID3D12InfoQueue_AddRetrievalFilterEntries(format::Han
     StructPointerDecoder<Decoded_D3D12_INFO_QUEUE_FILTER> pFilter;
     HRESULT return_value;
 
-    bytes_read += pFilter.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pFilter.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10944,9 +10944,9 @@ size_t Dx12Decoder::Decode_ID3D12InfoQueue_GetRetrievalFilter(format::HandleId o
     PointerDecoder<SIZE_T> pFilterByteLength;
     HRESULT return_value;
 
-    bytes_read += pFilter.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += pFilterByteLength.DecodeSizeT((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pFilter.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += pFilterByteLength.DecodeSizeT((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10976,7 +10976,7 @@ size_t Dx12Decoder::Decode_ID3D12InfoQueue_PushEmptyRetrievalFilter(format::Hand
 
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -10992,7 +10992,7 @@ size_t Dx12Decoder::Decode_ID3D12InfoQueue_PushCopyOfRetrievalFilter(format::Han
 
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -11009,8 +11009,8 @@ size_t Dx12Decoder::Decode_ID3D12InfoQueue_PushRetrievalFilter(format::HandleId
     StructPointerDecoder<Decoded_D3D12_INFO_QUEUE_FILTER> pFilter;
     HRESULT return_value;
 
-    bytes_read += pFilter.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pFilter.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -11040,7 +11040,7 @@ size_t Dx12Decoder::Decode_ID3D12InfoQueue_GetRetrievalFilterStackSize(format::H
 
     UINT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -11060,11 +11060,11 @@ size_t Dx12Decoder::Decode_ID3D12InfoQueue_AddMessage(format::HandleId object_id
     StringDecoder pDescription;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Category);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Severity);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &ID);
-    bytes_read += pDescription.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Category);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Severity);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &ID);
+    bytes_read += pDescription.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -11082,9 +11082,9 @@ size_t Dx12Decoder::Decode_ID3D12InfoQueue_AddApplicationMessage(format::HandleI
     StringDecoder pDescription;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Severity);
-    bytes_read += pDescription.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Severity);
+    bytes_read += pDescription.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -11102,9 +11102,9 @@ size_t Dx12Decoder::Decode_ID3D12InfoQueue_SetBreakOnCategory(format::HandleId o
     BOOL bEnable;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Category);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &bEnable);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Category);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &bEnable);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -11122,9 +11122,9 @@ size_t Dx12Decoder::Decode_ID3D12InfoQueue_SetBreakOnSeverity(format::HandleId o
     BOOL bEnable;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Severity);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &bEnable);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Severity);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &bEnable);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -11142,9 +11142,9 @@ size_t Dx12Decoder::Decode_ID3D12InfoQueue_SetBreakOnID(format::HandleId object_
     BOOL bEnable;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &ID);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &bEnable);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &ID);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &bEnable);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -11161,8 +11161,8 @@ size_t Dx12Decoder::Decode_ID3D12InfoQueue_GetBreakOnCategory(format::HandleId o
     D3D12_MESSAGE_CATEGORY Category;
     BOOL return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Category);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Category);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -11179,8 +11179,8 @@ size_t Dx12Decoder::Decode_ID3D12InfoQueue_GetBreakOnSeverity(format::HandleId o
     D3D12_MESSAGE_SEVERITY Severity;
     BOOL return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &Severity);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &Severity);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -11197,8 +11197,8 @@ size_t Dx12Decoder::Decode_ID3D12InfoQueue_GetBreakOnID(format::HandleId object_
     D3D12_MESSAGE_ID ID;
     BOOL return_value;
 
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &ID);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &ID);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -11214,7 +11214,7 @@ size_t Dx12Decoder::Decode_ID3D12InfoQueue_SetMuteDebugOutput(format::HandleId o
 
     BOOL bMute;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &bMute);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &bMute);
 
     for (auto consumer : GetConsumers())
     {
@@ -11230,7 +11230,7 @@ size_t Dx12Decoder::Decode_ID3D12InfoQueue_GetMuteDebugOutput(format::HandleId o
 
     BOOL return_value;
 
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -11251,10 +11251,10 @@ size_t Dx12Decoder::Decode_ID3D12InfoQueue1_RegisterMessageCallback(format::Hand
     HRESULT return_value;
 
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &CallbackFunc);
-    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &CallbackFilterFlags);
+    bytes_read += ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &CallbackFilterFlags);
     bytes_read += ValueDecoder::DecodeAddress((parameter_buffer + bytes_read), (buffer_size - bytes_read), &pContext);
-    bytes_read += pCallbackCookie.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += pCallbackCookie.DecodeUInt32((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -11271,8 +11271,8 @@ size_t Dx12Decoder::Decode_ID3D12InfoQueue1_UnregisterMessageCallback(format::Ha
     DWORD CallbackCookie;
     HRESULT return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &CallbackCookie);
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &CallbackCookie);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -11292,9 +11292,9 @@ size_t Dx12Decoder::Decode_IUnknown_QueryInterface(format::HandleId object_id, c
     HandlePointerDecoder<void*> ppvObject;
     HRESULT return_value;
 
-    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), &riid);
-    bytes_read += ppvObject.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
-    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += DecodeStruct((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &riid);
+    bytes_read += ppvObject.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding);
+    bytes_read += ValueDecoder::DecodeInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -11310,7 +11310,7 @@ size_t Dx12Decoder::Decode_IUnknown_AddRef(format::HandleId object_id, const Api
 
     ULONG return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
@@ -11326,7 +11326,7 @@ size_t Dx12Decoder::Decode_IUnknown_Release(format::HandleId object_id, const Ap
 
     ULONG return_value;
 
-    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &return_value);
+    bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), call_info.compact_encoding, &return_value);
 
     for (auto consumer : GetConsumers())
     {
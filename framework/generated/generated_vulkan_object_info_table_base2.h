@@ -288,54 +288,54 @@ class VulkanObjectInfoTableBase2 : VulkanObjectInfoTableBase
     void VisitVideoSessionParametersKHRInfo(std::function<void(const VideoSessionParametersKHRInfo*)> visitor) const {  for (const auto& entry : videoSessionParametersKHR_map_) { visitor(&entry.second); }  }
 
   protected:
-     std::unordered_map<format::HandleId, AccelerationStructureKHRInfo> accelerationStructureKHR_map_;
-     std::unordered_map<format::HandleId, AccelerationStructureNVInfo> accelerationStructureNV_map_;
-     std::unordered_map<format::HandleId, BufferInfo> buffer_map_;
-     std::unordered_map<format::HandleId, BufferViewInfo> bufferView_map_;
-     std::unordered_map<format::HandleId, CommandBufferInfo> commandBuffer_map_;
-     std::unordered_map<format::HandleId, CommandPoolInfo> commandPool_map_;
-     std::unordered_map<format::HandleId, DebugReportCallbackEXTInfo> debugReportCallbackEXT_map_;
-     std::unordered_map<format::HandleId, DebugUtilsMessengerEXTInfo> debugUtilsMessengerEXT_map_;
-     std::unordered_map<format::HandleId, DeferredOperationKHRInfo> deferredOperationKHR_map_;
-     std::unordered_map<format::HandleId, DescriptorPoolInfo> descriptorPool_map_;
-     std::unordered_map<format::HandleId, DescriptorSetInfo> descriptorSet_map_;
-     std::unordered_map<format::HandleId, DescriptorSetLayoutInfo> descriptorSetLayout_map_;
-     std::unordered_map<format::HandleId, DescriptorUpdateTemplateInfo> descriptorUpdateTemplate_map_;
-     std::unordered_map<format::HandleId, DeviceInfo> device_map_;
-     std::unordered_map<format::HandleId, DeviceMemoryInfo> deviceMemory_map_;
-     std::unordered_map<format::HandleId, DisplayKHRInfo> displayKHR_map_;
-     std::unordered_map<format::HandleId, DisplayModeKHRInfo> displayModeKHR_map_;
-     std::unordered_map<format::HandleId, EventInfo> event_map_;
-     std::unordered_map<format::HandleId, FenceInfo> fence_map_;
-     std::unordered_map<format::HandleId, FramebufferInfo> framebuffer_map_;
-     std::unordered_map<format::HandleId, ImageInfo> image_map_;
-     std::unordered_map<format::HandleId, ImageViewInfo> imageView_map_;
-     std::unordered_map<format::HandleId, IndirectCommandsLayoutEXTInfo> indirectCommandsLayoutEXT_map_;
-     std::unordered_map<format::HandleId, IndirectCommandsLayoutNVInfo> indirectCommandsLayoutNV_map_;
-     std::unordered_map<format::HandleId, IndirectExecutionSetEXTInfo> indirectExecutionSetEXT_map_;
-     std::unordered_map<format::HandleId, InstanceInfo> instance_map_;
-     std::unordered_map<format::HandleId, MicromapEXTInfo> micromapEXT_map_;
-     std::unordered_map<format::HandleId, OpticalFlowSessionNVInfo> opticalFlowSessionNV_map_;
-     std::unordered_map<format::HandleId, PerformanceConfigurationINTELInfo> performanceConfigurationINTEL_map_;
-     std::unordered_map<format::HandleId, PhysicalDeviceInfo> physicalDevice_map_;
-     std::unordered_map<format::HandleId, PipelineInfo> pipeline_map_;
-     std::unordered_map<format::HandleId, PipelineBinaryKHRInfo> pipelineBinaryKHR_map_;
-     std::unordered_map<format::HandleId, PipelineCacheInfo> pipelineCache_map_;
-     std::unordered_map<format::HandleId, PipelineLayoutInfo> pipelineLayout_map_;
-     std::unordered_map<format::HandleId, PrivateDataSlotInfo> privateDataSlot_map_;
-     std::unordered_map<format::HandleId, QueryPoolInfo> queryPool_map_;
-     std::unordered_map<format::HandleId, QueueInfo> queue_map_;
-     std::unordered_map<format::HandleId, RenderPassInfo> renderPass_map_;
-     std::unordered_map<format::HandleId, SamplerInfo> sampler_map_;
-     std::unordered_map<format::HandleId, SamplerYcbcrConversionInfo> samplerYcbcrConversion_map_;
-     std::unordered_map<format::HandleId, SemaphoreInfo> semaphore_map_;
-     std::unordered_map<format::HandleId, ShaderEXTInfo> shaderEXT_map_;
-     std::unordered_map<format::HandleId, ShaderModuleInfo> shaderModule_map_;
-     std::unordered_map<format::HandleId, SurfaceKHRInfo> surfaceKHR_map_;
-     std::unordered_map<format::HandleId, SwapchainKHRInfo> swapchainKHR_map_;
-     std::unordered_map<format::HandleId, ValidationCacheEXTInfo> validationCacheEXT_map_;
-     std::unordered_map<format::HandleId, VideoSessionKHRInfo> videoSessionKHR_map_;
-     std::unordered_map<format::HandleId, VideoSessionParametersKHRInfo> videoSessionParametersKHR_map_;
+     HandleInfoTable<AccelerationStructureKHRInfo> accelerationStructureKHR_map_;
+     HandleInfoTable<AccelerationStructureNVInfo> accelerationStructureNV_map_;
+     HandleInfoTable<BufferInfo> buffer_map_;
+     HandleInfoTable<BufferViewInfo> bufferView_map_;
+     HandleInfoTable<CommandBufferInfo> commandBuffer_map_;
+     HandleInfoTable<CommandPoolInfo> commandPool_map_;
+     HandleInfoTable<DebugReportCallbackEXTInfo> debugReportCallbackEXT_map_;
+     HandleInfoTable<DebugUtilsMessengerEXTInfo> debugUtilsMessengerEXT_map_;
+     HandleInfoTable<DeferredOperationKHRInfo> deferredOperationKHR_map_;
+     HandleInfoTable<DescriptorPoolInfo> descriptorPool_map_;
+     HandleInfoTable<DescriptorSetInfo> descriptorSet_map_;
+     HandleInfoTable<DescriptorSetLayoutInfo> descriptorSetLayout_map_;
+     HandleInfoTable<DescriptorUpdateTemplateInfo> descriptorUpdateTemplate_map_;
+     HandleInfoTable<DeviceInfo> device_map_;
+     HandleInfoTable<DeviceMemoryInfo> deviceMemory_map_;
+     HandleInfoTable<DisplayKHRInfo> displayKHR_map_;
+     HandleInfoTable<DisplayModeKHRInfo> displayModeKHR_map_;
+     HandleInfoTable<EventInfo> event_map_;
+     HandleInfoTable<FenceInfo> fence_map_;
+     HandleInfoTable<FramebufferInfo> framebuffer_map_;
+     HandleInfoTable<ImageInfo> image_map_;
+     HandleInfoTable<ImageViewInfo> imageView_map_;
+     HandleInfoTable<IndirectCommandsLayoutEXTInfo> indirectCommandsLayoutEXT_map_;
+     HandleInfoTable<IndirectCommandsLayoutNVInfo> indirectCommandsLayoutNV_map_;
+     HandleInfoTable<IndirectExecutionSetEXTInfo> indirectExecutionSetEXT_map_;
+     HandleInfoTable<InstanceInfo> instance_map_;
+     HandleInfoTable<MicromapEXTInfo> micromapEXT_map_;
+     HandleInfoTable<OpticalFlowSessionNVInfo> opticalFlowSessionNV_map_;
+     HandleInfoTable<PerformanceConfigurationINTELInfo> performanceConfigurationINTEL_map_;
+     HandleInfoTable<PhysicalDeviceInfo> physicalDevice_map_;
+     HandleInfoTable<PipelineInfo> pipeline_map_;
+     HandleInfoTable<PipelineBinaryKHRInfo> pipelineBinaryKHR_map_;
+     HandleInfoTable<PipelineCacheInfo> pipelineCache_map_;
+     HandleInfoTable<PipelineLayoutInfo> pipelineLayout_map_;
+     HandleInfoTable<PrivateDataSlotInfo> privateDataSlot_map_;
+     HandleInfoTable<QueryPoolInfo> queryPool_map_;
+     HandleInfoTable<QueueInfo> queue_map_;
+     HandleInfoTable<RenderPassInfo> renderPass_map_;
+     HandleInfoTable<SamplerInfo> sampler_map_;
+     HandleInfoTable<SamplerYcbcrConversionInfo> samplerYcbcrConversion_map_;
+     HandleInfoTable<SemaphoreInfo> semaphore_map_;
+     HandleInfoTable<ShaderEXTInfo> shaderEXT_map_;
+     HandleInfoTable<ShaderModuleInfo> shaderModule_map_;
+     HandleInfoTable<SurfaceKHRInfo> surfaceKHR_map_;
+     HandleInfoTable<SwapchainKHRInfo> swapchainKHR_map_;
+     HandleInfoTable<ValidationCacheEXTInfo> validationCacheEXT_map_;
+     HandleInfoTable<VideoSessionKHRInfo> videoSessionKHR_map_;
+     HandleInfoTable<VideoSessionParametersKHRInfo> videoSessionParametersKHR_map_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -238,104 +238,104 @@ class VulkanStateTable : VulkanStateTableBase
     vulkan_wrappers::VideoSessionKHRWrapper* GetVideoSessionKHRWrapper(format::HandleId id) { return GetWrapper<vulkan_wrappers::VideoSessionKHRWrapper>(id, videoSessionKHR_map_); }
     vulkan_wrappers::VideoSessionParametersKHRWrapper* GetVideoSessionParametersKHRWrapper(format::HandleId id) { return GetWrapper<vulkan_wrappers::VideoSessionParametersKHRWrapper>(id, videoSessionParametersKHR_map_); }
 
-    void VisitWrappers(std::function<void(vulkan_wrappers::AccelerationStructureKHRWrapper*)> visitor) const { for (auto entry : accelerationStructureKHR_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::AccelerationStructureNVWrapper*)> visitor) const { for (auto entry : accelerationStructureNV_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::BufferWrapper*)> visitor) const { for (auto entry : buffer_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::BufferViewWrapper*)> visitor) const { for (auto entry : bufferView_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::CommandBufferWrapper*)> visitor) const { for (auto entry : commandBuffer_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::CommandPoolWrapper*)> visitor) const { for (auto entry : commandPool_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::DebugReportCallbackEXTWrapper*)> visitor) const { for (auto entry : debugReportCallbackEXT_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::DebugUtilsMessengerEXTWrapper*)> visitor) const { for (auto entry : debugUtilsMessengerEXT_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::DeferredOperationKHRWrapper*)> visitor) const { for (auto entry : deferredOperationKHR_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::DescriptorPoolWrapper*)> visitor) const { for (auto entry : descriptorPool_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::DescriptorSetWrapper*)> visitor) const { for (auto entry : descriptorSet_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::DescriptorSetLayoutWrapper*)> visitor) const { for (auto entry : descriptorSetLayout_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::DescriptorUpdateTemplateWrapper*)> visitor) const { for (auto entry : descriptorUpdateTemplate_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::DeviceWrapper*)> visitor) const { for (auto entry : device_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::DeviceMemoryWrapper*)> visitor) const { for (auto entry : deviceMemory_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::DisplayKHRWrapper*)> visitor) const { for (auto entry : displayKHR_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::DisplayModeKHRWrapper*)> visitor) const { for (auto entry : displayModeKHR_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::EventWrapper*)> visitor) const { for (auto entry : event_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::FenceWrapper*)> visitor) const { for (auto entry : fence_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::FramebufferWrapper*)> visitor) const { for (auto entry : framebuffer_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::ImageWrapper*)> visitor) const { for (auto entry : image_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::ImageViewWrapper*)> visitor) const { for (auto entry : imageView_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::IndirectCommandsLayoutEXTWrapper*)> visitor) const { for (auto entry : indirectCommandsLayoutEXT_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::IndirectCommandsLayoutNVWrapper*)> visitor) const { for (auto entry : indirectCommandsLayoutNV_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::IndirectExecutionSetEXTWrapper*)> visitor) const { for (auto entry : indirectExecutionSetEXT_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::InstanceWrapper*)> visitor) const { for (auto entry : instance_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::MicromapEXTWrapper*)> visitor) const { for (auto entry : micromapEXT_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::OpticalFlowSessionNVWrapper*)> visitor) const { for (auto entry : opticalFlowSessionNV_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::PerformanceConfigurationINTELWrapper*)> visitor) const { for (auto entry : performanceConfigurationINTEL_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::PhysicalDeviceWrapper*)> visitor) const { for (auto entry : physicalDevice_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::PipelineWrapper*)> visitor) const { for (auto entry : pipeline_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::PipelineBinaryKHRWrapper*)> visitor) const { for (auto entry : pipelineBinaryKHR_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::PipelineCacheWrapper*)> visitor) const { for (auto entry : pipelineCache_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::PipelineLayoutWrapper*)> visitor) const { for (auto entry : pipelineLayout_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::PrivateDataSlotWrapper*)> visitor) const { for (auto entry : privateDataSlot_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::QueryPoolWrapper*)> visitor) const { for (auto entry : queryPool_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::QueueWrapper*)> visitor) const { for (auto entry : queue_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::RenderPassWrapper*)> visitor) const { for (auto entry : renderPass_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::SamplerWrapper*)> visitor) const { for (auto entry : sampler_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::SamplerYcbcrConversionWrapper*)> visitor) const { for (auto entry : samplerYcbcrConversion_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::SemaphoreWrapper*)> visitor) const { for (auto entry : semaphore_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::ShaderEXTWrapper*)> visitor) const { for (auto entry : shaderEXT_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::ShaderModuleWrapper*)> visitor) const { for (auto entry : shaderModule_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::SurfaceKHRWrapper*)> visitor) const { for (auto entry : surfaceKHR_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::SwapchainKHRWrapper*)> visitor) const { for (auto entry : swapchainKHR_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::ValidationCacheEXTWrapper*)> visitor) const { for (auto entry : validationCacheEXT_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::VideoSessionKHRWrapper*)> visitor) const { for (auto entry : videoSessionKHR_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::VideoSessionParametersKHRWrapper*)> visitor) const { for (auto entry : videoSessionParametersKHR_map_) { visitor(entry.second); } }
+    void VisitWrappers(std::function<void(vulkan_wrappers::AccelerationStructureKHRWrapper*)> visitor) const { VisitEntries(accelerationStructureKHR_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::AccelerationStructureNVWrapper*)> visitor) const { VisitEntries(accelerationStructureNV_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::BufferWrapper*)> visitor) const { VisitEntries(buffer_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::BufferViewWrapper*)> visitor) const { VisitEntries(bufferView_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::CommandBufferWrapper*)> visitor) const { VisitEntries(commandBuffer_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::CommandPoolWrapper*)> visitor) const { VisitEntries(commandPool_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::DebugReportCallbackEXTWrapper*)> visitor) const { VisitEntries(debugReportCallbackEXT_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::DebugUtilsMessengerEXTWrapper*)> visitor) const { VisitEntries(debugUtilsMessengerEXT_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::DeferredOperationKHRWrapper*)> visitor) const { VisitEntries(deferredOperationKHR_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::DescriptorPoolWrapper*)> visitor) const { VisitEntries(descriptorPool_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::DescriptorSetWrapper*)> visitor) const { VisitEntries(descriptorSet_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::DescriptorSetLayoutWrapper*)> visitor) const { VisitEntries(descriptorSetLayout_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::DescriptorUpdateTemplateWrapper*)> visitor) const { VisitEntries(descriptorUpdateTemplate_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::DeviceWrapper*)> visitor) const { VisitEntries(device_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::DeviceMemoryWrapper*)> visitor) const { VisitEntries(deviceMemory_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::DisplayKHRWrapper*)> visitor) const { VisitEntries(displayKHR_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::DisplayModeKHRWrapper*)> visitor) const { VisitEntries(displayModeKHR_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::EventWrapper*)> visitor) const { VisitEntries(event_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::FenceWrapper*)> visitor) const { VisitEntries(fence_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::FramebufferWrapper*)> visitor) const { VisitEntries(framebuffer_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::ImageWrapper*)> visitor) const { VisitEntries(image_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::ImageViewWrapper*)> visitor) const { VisitEntries(imageView_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::IndirectCommandsLayoutEXTWrapper*)> visitor) const { VisitEntries(indirectCommandsLayoutEXT_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::IndirectCommandsLayoutNVWrapper*)> visitor) const { VisitEntries(indirectCommandsLayoutNV_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::IndirectExecutionSetEXTWrapper*)> visitor) const { VisitEntries(indirectExecutionSetEXT_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::InstanceWrapper*)> visitor) const { VisitEntries(instance_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::MicromapEXTWrapper*)> visitor) const { VisitEntries(micromapEXT_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::OpticalFlowSessionNVWrapper*)> visitor) const { VisitEntries(opticalFlowSessionNV_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::PerformanceConfigurationINTELWrapper*)> visitor) const { VisitEntries(performanceConfigurationINTEL_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::PhysicalDeviceWrapper*)> visitor) const { VisitEntries(physicalDevice_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::PipelineWrapper*)> visitor) const { VisitEntries(pipeline_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::PipelineBinaryKHRWrapper*)> visitor) const { VisitEntries(pipelineBinaryKHR_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::PipelineCacheWrapper*)> visitor) const { VisitEntries(pipelineCache_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::PipelineLayoutWrapper*)> visitor) const { VisitEntries(pipelineLayout_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::PrivateDataSlotWrapper*)> visitor) const { VisitEntries(privateDataSlot_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::QueryPoolWrapper*)> visitor) const { VisitEntries(queryPool_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::QueueWrapper*)> visitor) const { VisitEntries(queue_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::RenderPassWrapper*)> visitor) const { VisitEntries(renderPass_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::SamplerWrapper*)> visitor) const { VisitEntries(sampler_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::SamplerYcbcrConversionWrapper*)> visitor) const { VisitEntries(samplerYcbcrConversion_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::SemaphoreWrapper*)> visitor) const { VisitEntries(semaphore_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::ShaderEXTWrapper*)> visitor) const { VisitEntries(shaderEXT_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::ShaderModuleWrapper*)> visitor) const { VisitEntries(shaderModule_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::SurfaceKHRWrapper*)> visitor) const { VisitEntries(surfaceKHR_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::SwapchainKHRWrapper*)> visitor) const { VisitEntries(swapchainKHR_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::ValidationCacheEXTWrapper*)> visitor) const { VisitEntries(validationCacheEXT_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::VideoSessionKHRWrapper*)> visitor) const { VisitEntries(videoSessionKHR_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::VideoSessionParametersKHRWrapper*)> visitor) const { VisitEntries(videoSessionParametersKHR_map_, visitor); }
 
   private:
-    std::map<format::HandleId, vulkan_wrappers::AccelerationStructureKHRWrapper*> accelerationStructureKHR_map_;
-    std::map<format::HandleId, vulkan_wrappers::AccelerationStructureNVWrapper*> accelerationStructureNV_map_;
-    std::map<format::HandleId, vulkan_wrappers::BufferWrapper*> buffer_map_;
-    std::map<format::HandleId, vulkan_wrappers::BufferViewWrapper*> bufferView_map_;
-    std::map<format::HandleId, vulkan_wrappers::CommandBufferWrapper*> commandBuffer_map_;
-    std::map<format::HandleId, vulkan_wrappers::CommandPoolWrapper*> commandPool_map_;
-    std::map<format::HandleId, vulkan_wrappers::DebugReportCallbackEXTWrapper*> debugReportCallbackEXT_map_;
-    std::map<format::HandleId, vulkan_wrappers::DebugUtilsMessengerEXTWrapper*> debugUtilsMessengerEXT_map_;
-    std::map<format::HandleId, vulkan_wrappers::DeferredOperationKHRWrapper*> deferredOperationKHR_map_;
-    std::map<format::HandleId, vulkan_wrappers::DescriptorPoolWrapper*> descriptorPool_map_;
-    std::map<format::HandleId, vulkan_wrappers::DescriptorSetWrapper*> descriptorSet_map_;
-    std::map<format::HandleId, vulkan_wrappers::DescriptorSetLayoutWrapper*> descriptorSetLayout_map_;
-    std::map<format::HandleId, vulkan_wrappers::DescriptorUpdateTemplateWrapper*> descriptorUpdateTemplate_map_;
-    std::map<format::HandleId, vulkan_wrappers::DeviceWrapper*> device_map_;
-    std::map<format::HandleId, vulkan_wrappers::DeviceMemoryWrapper*> deviceMemory_map_;
-    std::map<format::HandleId, vulkan_wrappers::DisplayKHRWrapper*> displayKHR_map_;
-    std::map<format::HandleId, vulkan_wrappers::DisplayModeKHRWrapper*> displayModeKHR_map_;
-    std::map<format::HandleId, vulkan_wrappers::EventWrapper*> event_map_;
-    std::map<format::HandleId, vulkan_wrappers::FenceWrapper*> fence_map_;
-    std::map<format::HandleId, vulkan_wrappers::FramebufferWrapper*> framebuffer_map_;
-    std::map<format::HandleId, vulkan_wrappers::ImageWrapper*> image_map_;
-    std::map<format::HandleId, vulkan_wrappers::ImageViewWrapper*> imageView_map_;
-    std::map<format::HandleId, vulkan_wrappers::IndirectCommandsLayoutEXTWrapper*> indirectCommandsLayoutEXT_map_;
-    std::map<format::HandleId, vulkan_wrappers::IndirectCommandsLayoutNVWrapper*> indirectCommandsLayoutNV_map_;
-    std::map<format::HandleId, vulkan_wrappers::IndirectExecutionSetEXTWrapper*> indirectExecutionSetEXT_map_;
-    std::map<format::HandleId, vulkan_wrappers::InstanceWrapper*> instance_map_;
-    std::map<format::HandleId, vulkan_wrappers::MicromapEXTWrapper*> micromapEXT_map_;
-    std::map<format::HandleId, vulkan_wrappers::OpticalFlowSessionNVWrapper*> opticalFlowSessionNV_map_;
-    std::map<format::HandleId, vulkan_wrappers::PerformanceConfigurationINTELWrapper*> performanceConfigurationINTEL_map_;
-    std::map<format::HandleId, vulkan_wrappers::PhysicalDeviceWrapper*> physicalDevice_map_;
-    std::map<format::HandleId, vulkan_wrappers::PipelineWrapper*> pipeline_map_;
-    std::map<format::HandleId, vulkan_wrappers::PipelineBinaryKHRWrapper*> pipelineBinaryKHR_map_;
-    std::map<format::HandleId, vulkan_wrappers::PipelineCacheWrapper*> pipelineCache_map_;
-    std::map<format::HandleId, vulkan_wrappers::PipelineLayoutWrapper*> pipelineLayout_map_;
-    std::map<format::HandleId, vulkan_wrappers::PrivateDataSlotWrapper*> privateDataSlot_map_;
-    std::map<format::HandleId, vulkan_wrappers::QueryPoolWrapper*> queryPool_map_;
-    std::map<format::HandleId, vulkan_wrappers::QueueWrapper*> queue_map_;
-    std::map<format::HandleId, vulkan_wrappers::RenderPassWrapper*> renderPass_map_;
-    std::map<format::HandleId, vulkan_wrappers::SamplerWrapper*> sampler_map_;
-    std::map<format::HandleId, vulkan_wrappers::SamplerYcbcrConversionWrapper*> samplerYcbcrConversion_map_;
-    std::map<format::HandleId, vulkan_wrappers::SemaphoreWrapper*> semaphore_map_;
-    std::map<format::HandleId, vulkan_wrappers::ShaderEXTWrapper*> shaderEXT_map_;
-    std::map<format::HandleId, vulkan_wrappers::ShaderModuleWrapper*> shaderModule_map_;
-    std::map<format::HandleId, vulkan_wrappers::SurfaceKHRWrapper*> surfaceKHR_map_;
-    std::map<format::HandleId, vulkan_wrappers::SwapchainKHRWrapper*> swapchainKHR_map_;
-    std::map<format::HandleId, vulkan_wrappers::ValidationCacheEXTWrapper*> validationCacheEXT_map_;
-    std::map<format::HandleId, vulkan_wrappers::VideoSessionKHRWrapper*> videoSessionKHR_map_;
-    std::map<format::HandleId, vulkan_wrappers::VideoSessionParametersKHRWrapper*> videoSessionParametersKHR_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::AccelerationStructureKHRWrapper> accelerationStructureKHR_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::AccelerationStructureNVWrapper> accelerationStructureNV_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::BufferWrapper> buffer_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::BufferViewWrapper> bufferView_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::CommandBufferWrapper> commandBuffer_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::CommandPoolWrapper> commandPool_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::DebugReportCallbackEXTWrapper> debugReportCallbackEXT_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::DebugUtilsMessengerEXTWrapper> debugUtilsMessengerEXT_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::DeferredOperationKHRWrapper> deferredOperationKHR_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::DescriptorPoolWrapper> descriptorPool_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::DescriptorSetWrapper> descriptorSet_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::DescriptorSetLayoutWrapper> descriptorSetLayout_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::DescriptorUpdateTemplateWrapper> descriptorUpdateTemplate_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::DeviceWrapper> device_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::DeviceMemoryWrapper> deviceMemory_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::DisplayKHRWrapper> displayKHR_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::DisplayModeKHRWrapper> displayModeKHR_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::EventWrapper> event_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::FenceWrapper> fence_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::FramebufferWrapper> framebuffer_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::ImageWrapper> image_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::ImageViewWrapper> imageView_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::IndirectCommandsLayoutEXTWrapper> indirectCommandsLayoutEXT_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::IndirectCommandsLayoutNVWrapper> indirectCommandsLayoutNV_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::IndirectExecutionSetEXTWrapper> indirectExecutionSetEXT_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::InstanceWrapper> instance_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::MicromapEXTWrapper> micromapEXT_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::OpticalFlowSessionNVWrapper> opticalFlowSessionNV_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::PerformanceConfigurationINTELWrapper> performanceConfigurationINTEL_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::PhysicalDeviceWrapper> physicalDevice_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::PipelineWrapper> pipeline_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::PipelineBinaryKHRWrapper> pipelineBinaryKHR_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::PipelineCacheWrapper> pipelineCache_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::PipelineLayoutWrapper> pipelineLayout_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::PrivateDataSlotWrapper> privateDataSlot_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::QueryPoolWrapper> queryPool_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::QueueWrapper> queue_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::RenderPassWrapper> renderPass_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::SamplerWrapper> sampler_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::SamplerYcbcrConversionWrapper> samplerYcbcrConversion_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::SemaphoreWrapper> semaphore_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::ShaderEXTWrapper> shaderEXT_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::ShaderModuleWrapper> shaderModule_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::SurfaceKHRWrapper> surfaceKHR_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::SwapchainKHRWrapper> swapchainKHR_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::ValidationCacheEXTWrapper> validationCacheEXT_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::VideoSessionKHRWrapper> videoSessionKHR_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::VideoSessionParametersKHRWrapper> videoSessionParametersKHR_map_;
 };
 
 class VulkanStateHandleTable : VulkanStateTableBase
@@ -344,246 +344,246 @@ class VulkanStateHandleTable : VulkanStateTableBase
     VulkanStateHandleTable() {}
     ~VulkanStateHandleTable() {}
 
-    bool InsertWrapper(vulkan_wrappers::AccelerationStructureKHRWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, accelerationStructureKHR_map_); }
-    bool InsertWrapper(vulkan_wrappers::AccelerationStructureNVWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, accelerationStructureNV_map_); }
-    bool InsertWrapper(vulkan_wrappers::BufferWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, buffer_map_); }
-    bool InsertWrapper(vulkan_wrappers::BufferViewWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, bufferView_map_); }
-    bool InsertWrapper(vulkan_wrappers::CommandBufferWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, commandBuffer_map_); }
-    bool InsertWrapper(vulkan_wrappers::CommandPoolWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, commandPool_map_); }
-    bool InsertWrapper(vulkan_wrappers::DebugReportCallbackEXTWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, debugReportCallbackEXT_map_); }
-    bool InsertWrapper(vulkan_wrappers::DebugUtilsMessengerEXTWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, debugUtilsMessengerEXT_map_); }
-    bool InsertWrapper(vulkan_wrappers::DeferredOperationKHRWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, deferredOperationKHR_map_); }
-    bool InsertWrapper(vulkan_wrappers::DescriptorPoolWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, descriptorPool_map_); }
-    bool InsertWrapper(vulkan_wrappers::DescriptorSetWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, descriptorSet_map_); }
-    bool InsertWrapper(vulkan_wrappers::DescriptorSetLayoutWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, descriptorSetLayout_map_); }
-    bool InsertWrapper(vulkan_wrappers::DescriptorUpdateTemplateWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, descriptorUpdateTemplate_map_); }
-    bool InsertWrapper(vulkan_wrappers::DeviceWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, device_map_); }
-    bool InsertWrapper(vulkan_wrappers::DeviceMemoryWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, deviceMemory_map_); }
-    bool InsertWrapper(vulkan_wrappers::DisplayKHRWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, displayKHR_map_); }
-    bool InsertWrapper(vulkan_wrappers::DisplayModeKHRWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, displayModeKHR_map_); }
-    bool InsertWrapper(vulkan_wrappers::EventWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, event_map_); }
-    bool InsertWrapper(vulkan_wrappers::FenceWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, fence_map_); }
-    bool InsertWrapper(vulkan_wrappers::FramebufferWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, framebuffer_map_); }
-    bool InsertWrapper(vulkan_wrappers::ImageWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, image_map_); }
-    bool InsertWrapper(vulkan_wrappers::ImageViewWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, imageView_map_); }
-    bool InsertWrapper(vulkan_wrappers::IndirectCommandsLayoutEXTWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, indirectCommandsLayoutEXT_map_); }
-    bool InsertWrapper(vulkan_wrappers::IndirectCommandsLayoutNVWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, indirectCommandsLayoutNV_map_); }
-    bool InsertWrapper(vulkan_wrappers::IndirectExecutionSetEXTWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, indirectExecutionSetEXT_map_); }
-    bool InsertWrapper(vulkan_wrappers::InstanceWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, instance_map_); }
-    bool InsertWrapper(vulkan_wrappers::MicromapEXTWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, micromapEXT_map_); }
-    bool InsertWrapper(vulkan_wrappers::OpticalFlowSessionNVWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, opticalFlowSessionNV_map_); }
-    bool InsertWrapper(vulkan_wrappers::PerformanceConfigurationINTELWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, performanceConfigurationINTEL_map_); }
-    bool InsertWrapper(vulkan_wrappers::PhysicalDeviceWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, physicalDevice_map_); }
-    bool InsertWrapper(vulkan_wrappers::PipelineWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, pipeline_map_); }
-    bool InsertWrapper(vulkan_wrappers::PipelineBinaryKHRWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, pipelineBinaryKHR_map_); }
-    bool InsertWrapper(vulkan_wrappers::PipelineCacheWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, pipelineCache_map_); }
-    bool InsertWrapper(vulkan_wrappers::PipelineLayoutWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, pipelineLayout_map_); }
-    bool InsertWrapper(vulkan_wrappers::PrivateDataSlotWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, privateDataSlot_map_); }
-    bool InsertWrapper(vulkan_wrappers::QueryPoolWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, queryPool_map_); }
-    bool InsertWrapper(vulkan_wrappers::QueueWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, queue_map_); }
-    bool InsertWrapper(vulkan_wrappers::RenderPassWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, renderPass_map_); }
-    bool InsertWrapper(vulkan_wrappers::SamplerWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, sampler_map_); }
-    bool InsertWrapper(vulkan_wrappers::SamplerYcbcrConversionWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, samplerYcbcrConversion_map_); }
-    bool InsertWrapper(vulkan_wrappers::SemaphoreWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, semaphore_map_); }
-    bool InsertWrapper(vulkan_wrappers::ShaderEXTWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, shaderEXT_map_); }
-    bool InsertWrapper(vulkan_wrappers::ShaderModuleWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, shaderModule_map_); }
-    bool InsertWrapper(vulkan_wrappers::SurfaceKHRWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, surfaceKHR_map_); }
-    bool InsertWrapper(vulkan_wrappers::SwapchainKHRWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, swapchainKHR_map_); }
-    bool InsertWrapper(vulkan_wrappers::ValidationCacheEXTWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, validationCacheEXT_map_); }
-    bool InsertWrapper(vulkan_wrappers::VideoSessionKHRWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, videoSessionKHR_map_); }
-    bool InsertWrapper(vulkan_wrappers::VideoSessionParametersKHRWrapper* wrapper) { return InsertEntry(wrapper->handle, wrapper, videoSessionParametersKHR_map_); }
+    bool InsertWrapper(vulkan_wrappers::AccelerationStructureKHRWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, accelerationStructureKHR_map_); }
+    bool InsertWrapper(vulkan_wrappers::AccelerationStructureNVWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, accelerationStructureNV_map_); }
+    bool InsertWrapper(vulkan_wrappers::BufferWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, buffer_map_); }
+    bool InsertWrapper(vulkan_wrappers::BufferViewWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, bufferView_map_); }
+    bool InsertWrapper(vulkan_wrappers::CommandBufferWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, commandBuffer_map_); }
+    bool InsertWrapper(vulkan_wrappers::CommandPoolWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, commandPool_map_); }
+    bool InsertWrapper(vulkan_wrappers::DebugReportCallbackEXTWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, debugReportCallbackEXT_map_); }
+    bool InsertWrapper(vulkan_wrappers::DebugUtilsMessengerEXTWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, debugUtilsMessengerEXT_map_); }
+    bool InsertWrapper(vulkan_wrappers::DeferredOperationKHRWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, deferredOperationKHR_map_); }
+    bool InsertWrapper(vulkan_wrappers::DescriptorPoolWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, descriptorPool_map_); }
+    bool InsertWrapper(vulkan_wrappers::DescriptorSetWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, descriptorSet_map_); }
+    bool InsertWrapper(vulkan_wrappers::DescriptorSetLayoutWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, descriptorSetLayout_map_); }
+    bool InsertWrapper(vulkan_wrappers::DescriptorUpdateTemplateWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, descriptorUpdateTemplate_map_); }
+    bool InsertWrapper(vulkan_wrappers::DeviceWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, device_map_); }
+    bool InsertWrapper(vulkan_wrappers::DeviceMemoryWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, deviceMemory_map_); }
+    bool InsertWrapper(vulkan_wrappers::DisplayKHRWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, displayKHR_map_); }
+    bool InsertWrapper(vulkan_wrappers::DisplayModeKHRWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, displayModeKHR_map_); }
+    bool InsertWrapper(vulkan_wrappers::EventWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, event_map_); }
+    bool InsertWrapper(vulkan_wrappers::FenceWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, fence_map_); }
+    bool InsertWrapper(vulkan_wrappers::FramebufferWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, framebuffer_map_); }
+    bool InsertWrapper(vulkan_wrappers::ImageWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, image_map_); }
+    bool InsertWrapper(vulkan_wrappers::ImageViewWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, imageView_map_); }
+    bool InsertWrapper(vulkan_wrappers::IndirectCommandsLayoutEXTWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, indirectCommandsLayoutEXT_map_); }
+    bool InsertWrapper(vulkan_wrappers::IndirectCommandsLayoutNVWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, indirectCommandsLayoutNV_map_); }
+    bool InsertWrapper(vulkan_wrappers::IndirectExecutionSetEXTWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, indirectExecutionSetEXT_map_); }
+    bool InsertWrapper(vulkan_wrappers::InstanceWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, instance_map_); }
+    bool InsertWrapper(vulkan_wrappers::MicromapEXTWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, micromapEXT_map_); }
+    bool InsertWrapper(vulkan_wrappers::OpticalFlowSessionNVWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, opticalFlowSessionNV_map_); }
+    bool InsertWrapper(vulkan_wrappers::PerformanceConfigurationINTELWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, performanceConfigurationINTEL_map_); }
+    bool InsertWrapper(vulkan_wrappers::PhysicalDeviceWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, physicalDevice_map_); }
+    bool InsertWrapper(vulkan_wrappers::PipelineWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, pipeline_map_); }
+    bool InsertWrapper(vulkan_wrappers::PipelineBinaryKHRWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, pipelineBinaryKHR_map_); }
+    bool InsertWrapper(vulkan_wrappers::PipelineCacheWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, pipelineCache_map_); }
+    bool InsertWrapper(vulkan_wrappers::PipelineLayoutWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, pipelineLayout_map_); }
+    bool InsertWrapper(vulkan_wrappers::PrivateDataSlotWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, privateDataSlot_map_); }
+    bool InsertWrapper(vulkan_wrappers::QueryPoolWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, queryPool_map_); }
+    bool InsertWrapper(vulkan_wrappers::QueueWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, queue_map_); }
+    bool InsertWrapper(vulkan_wrappers::RenderPassWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, renderPass_map_); }
+    bool InsertWrapper(vulkan_wrappers::SamplerWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, sampler_map_); }
+    bool InsertWrapper(vulkan_wrappers::SamplerYcbcrConversionWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, samplerYcbcrConversion_map_); }
+    bool InsertWrapper(vulkan_wrappers::SemaphoreWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, semaphore_map_); }
+    bool InsertWrapper(vulkan_wrappers::ShaderEXTWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, shaderEXT_map_); }
+    bool InsertWrapper(vulkan_wrappers::ShaderModuleWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, shaderModule_map_); }
+    bool InsertWrapper(vulkan_wrappers::SurfaceKHRWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, surfaceKHR_map_); }
+    bool InsertWrapper(vulkan_wrappers::SwapchainKHRWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, swapchainKHR_map_); }
+    bool InsertWrapper(vulkan_wrappers::ValidationCacheEXTWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, validationCacheEXT_map_); }
+    bool InsertWrapper(vulkan_wrappers::VideoSessionKHRWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, videoSessionKHR_map_); }
+    bool InsertWrapper(vulkan_wrappers::VideoSessionParametersKHRWrapper* wrapper) { return InsertHandleEntry(wrapper->handle, wrapper, videoSessionParametersKHR_map_); }
 
     bool RemoveWrapper(const vulkan_wrappers::AccelerationStructureKHRWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, accelerationStructureKHR_map_);
+         return RemoveHandleEntry(wrapper->handle, accelerationStructureKHR_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::AccelerationStructureNVWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, accelerationStructureNV_map_);
+         return RemoveHandleEntry(wrapper->handle, accelerationStructureNV_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::BufferWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, buffer_map_);
+         return RemoveHandleEntry(wrapper->handle, buffer_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::BufferViewWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, bufferView_map_);
+         return RemoveHandleEntry(wrapper->handle, bufferView_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::CommandBufferWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, commandBuffer_map_);
+         return RemoveHandleEntry(wrapper->handle, commandBuffer_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::CommandPoolWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, commandPool_map_);
+         return RemoveHandleEntry(wrapper->handle, commandPool_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::DebugReportCallbackEXTWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, debugReportCallbackEXT_map_);
+         return RemoveHandleEntry(wrapper->handle, debugReportCallbackEXT_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::DebugUtilsMessengerEXTWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, debugUtilsMessengerEXT_map_);
+         return RemoveHandleEntry(wrapper->handle, debugUtilsMessengerEXT_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::DeferredOperationKHRWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, deferredOperationKHR_map_);
+         return RemoveHandleEntry(wrapper->handle, deferredOperationKHR_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::DescriptorPoolWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, descriptorPool_map_);
+         return RemoveHandleEntry(wrapper->handle, descriptorPool_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::DescriptorSetWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, descriptorSet_map_);
+         return RemoveHandleEntry(wrapper->handle, descriptorSet_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::DescriptorSetLayoutWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, descriptorSetLayout_map_);
+         return RemoveHandleEntry(wrapper->handle, descriptorSetLayout_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::DescriptorUpdateTemplateWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, descriptorUpdateTemplate_map_);
+         return RemoveHandleEntry(wrapper->handle, descriptorUpdateTemplate_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::DeviceWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, device_map_);
+         return RemoveHandleEntry(wrapper->handle, device_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::DeviceMemoryWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, deviceMemory_map_);
+         return RemoveHandleEntry(wrapper->handle, deviceMemory_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::DisplayKHRWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, displayKHR_map_);
+         return RemoveHandleEntry(wrapper->handle, displayKHR_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::DisplayModeKHRWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, displayModeKHR_map_);
+         return RemoveHandleEntry(wrapper->handle, displayModeKHR_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::EventWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, event_map_);
+         return RemoveHandleEntry(wrapper->handle, event_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::FenceWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, fence_map_);
+         return RemoveHandleEntry(wrapper->handle, fence_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::FramebufferWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, framebuffer_map_);
+         return RemoveHandleEntry(wrapper->handle, framebuffer_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::ImageWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, image_map_);
+         return RemoveHandleEntry(wrapper->handle, image_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::ImageViewWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, imageView_map_);
+         return RemoveHandleEntry(wrapper->handle, imageView_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::IndirectCommandsLayoutEXTWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, indirectCommandsLayoutEXT_map_);
+         return RemoveHandleEntry(wrapper->handle, indirectCommandsLayoutEXT_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::IndirectCommandsLayoutNVWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, indirectCommandsLayoutNV_map_);
+         return RemoveHandleEntry(wrapper->handle, indirectCommandsLayoutNV_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::IndirectExecutionSetEXTWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, indirectExecutionSetEXT_map_);
+         return RemoveHandleEntry(wrapper->handle, indirectExecutionSetEXT_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::InstanceWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, instance_map_);
+         return RemoveHandleEntry(wrapper->handle, instance_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::MicromapEXTWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, micromapEXT_map_);
+         return RemoveHandleEntry(wrapper->handle, micromapEXT_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::OpticalFlowSessionNVWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, opticalFlowSessionNV_map_);
+         return RemoveHandleEntry(wrapper->handle, opticalFlowSessionNV_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::PerformanceConfigurationINTELWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, performanceConfigurationINTEL_map_);
+         return RemoveHandleEntry(wrapper->handle, performanceConfigurationINTEL_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::PhysicalDeviceWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, physicalDevice_map_);
+         return RemoveHandleEntry(wrapper->handle, physicalDevice_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::PipelineWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, pipeline_map_);
+         return RemoveHandleEntry(wrapper->handle, pipeline_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::PipelineBinaryKHRWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, pipelineBinaryKHR_map_);
+         return RemoveHandleEntry(wrapper->handle, pipelineBinaryKHR_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::PipelineCacheWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, pipelineCache_map_);
+         return RemoveHandleEntry(wrapper->handle, pipelineCache_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::PipelineLayoutWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, pipelineLayout_map_);
+         return RemoveHandleEntry(wrapper->handle, pipelineLayout_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::PrivateDataSlotWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, privateDataSlot_map_);
+         return RemoveHandleEntry(wrapper->handle, privateDataSlot_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::QueryPoolWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, queryPool_map_);
+         return RemoveHandleEntry(wrapper->handle, queryPool_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::QueueWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, queue_map_);
+         return RemoveHandleEntry(wrapper->handle, queue_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::RenderPassWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, renderPass_map_);
+         return RemoveHandleEntry(wrapper->handle, renderPass_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::SamplerWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, sampler_map_);
+         return RemoveHandleEntry(wrapper->handle, sampler_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::SamplerYcbcrConversionWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, samplerYcbcrConversion_map_);
+         return RemoveHandleEntry(wrapper->handle, samplerYcbcrConversion_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::SemaphoreWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, semaphore_map_);
+         return RemoveHandleEntry(wrapper->handle, semaphore_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::ShaderEXTWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, shaderEXT_map_);
+         return RemoveHandleEntry(wrapper->handle, shaderEXT_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::ShaderModuleWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, shaderModule_map_);
+         return RemoveHandleEntry(wrapper->handle, shaderModule_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::SurfaceKHRWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, surfaceKHR_map_);
+         return RemoveHandleEntry(wrapper->handle, surfaceKHR_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::SwapchainKHRWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, swapchainKHR_map_);
+         return RemoveHandleEntry(wrapper->handle, swapchainKHR_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::ValidationCacheEXTWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, validationCacheEXT_map_);
+         return RemoveHandleEntry(wrapper->handle, validationCacheEXT_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::VideoSessionKHRWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, videoSessionKHR_map_);
+         return RemoveHandleEntry(wrapper->handle, videoSessionKHR_map_);
     }
     bool RemoveWrapper(const vulkan_wrappers::VideoSessionParametersKHRWrapper* wrapper) {
          if (wrapper == nullptr) return false;
-         return RemoveEntry(wrapper->handle, videoSessionParametersKHR_map_);
+         return RemoveHandleEntry(wrapper->handle, videoSessionParametersKHR_map_);
     }
 
     template<typename Wrapper> const Wrapper* GetWrapper(typename Wrapper::HandleType handle) const { return nullptr; }
@@ -591,153 +591,153 @@ class VulkanStateHandleTable : VulkanStateTableBase
     template<typename Wrapper> Wrapper* GetWrapper(typename Wrapper::HandleType handle) { return nullptr; }
 
   private:
-    std::unordered_map<VkAccelerationStructureKHR, vulkan_wrappers::AccelerationStructureKHRWrapper*> accelerationStructureKHR_map_;
-    std::unordered_map<VkAccelerationStructureNV, vulkan_wrappers::AccelerationStructureNVWrapper*> accelerationStructureNV_map_;
-    std::unordered_map<VkBuffer, vulkan_wrappers::BufferWrapper*> buffer_map_;
-    std::unordered_map<VkBufferView, vulkan_wrappers::BufferViewWrapper*> bufferView_map_;
-    std::unordered_map<VkCommandBuffer, vulkan_wrappers::CommandBufferWrapper*> commandBuffer_map_;
-    std::unordered_map<VkCommandPool, vulkan_wrappers::CommandPoolWrapper*> commandPool_map_;
-    std::unordered_map<VkDebugReportCallbackEXT, vulkan_wrappers::DebugReportCallbackEXTWrapper*> debugReportCallbackEXT_map_;
-    std::unordered_map<VkDebugUtilsMessengerEXT, vulkan_wrappers::DebugUtilsMessengerEXTWrapper*> debugUtilsMessengerEXT_map_;
-    std::unordered_map<VkDeferredOperationKHR, vulkan_wrappers::DeferredOperationKHRWrapper*> deferredOperationKHR_map_;
-    std::unordered_map<VkDescriptorPool, vulkan_wrappers::DescriptorPoolWrapper*> descriptorPool_map_;
-    std::unordered_map<VkDescriptorSet, vulkan_wrappers::DescriptorSetWrapper*> descriptorSet_map_;
-    std::unordered_map<VkDescriptorSetLayout, vulkan_wrappers::DescriptorSetLayoutWrapper*> descriptorSetLayout_map_;
-    std::unordered_map<VkDescriptorUpdateTemplate, vulkan_wrappers::DescriptorUpdateTemplateWrapper*> descriptorUpdateTemplate_map_;
-    std::unordered_map<VkDevice, vulkan_wrappers::DeviceWrapper*> device_map_;
-    std::unordered_map<VkDeviceMemory, vulkan_wrappers::DeviceMemoryWrapper*> deviceMemory_map_;
-    std::unordered_map<VkDisplayKHR, vulkan_wrappers::DisplayKHRWrapper*> displayKHR_map_;
-    std::unordered_map<VkDisplayModeKHR, vulkan_wrappers::DisplayModeKHRWrapper*> displayModeKHR_map_;
-    std::unordered_map<VkEvent, vulkan_wrappers::EventWrapper*> event_map_;
-    std::unordered_map<VkFence, vulkan_wrappers::FenceWrapper*> fence_map_;
-    std::unordered_map<VkFramebuffer, vulkan_wrappers::FramebufferWrapper*> framebuffer_map_;
-    std::unordered_map<VkImage, vulkan_wrappers::ImageWrapper*> image_map_;
-    std::unordered_map<VkImageView, vulkan_wrappers::ImageViewWrapper*> imageView_map_;
-    std::unordered_map<VkIndirectCommandsLayoutEXT, vulkan_wrappers::IndirectCommandsLayoutEXTWrapper*> indirectCommandsLayoutEXT_map_;
-    std::unordered_map<VkIndirectCommandsLayoutNV, vulkan_wrappers::IndirectCommandsLayoutNVWrapper*> indirectCommandsLayoutNV_map_;
-    std::unordered_map<VkIndirectExecutionSetEXT, vulkan_wrappers::IndirectExecutionSetEXTWrapper*> indirectExecutionSetEXT_map_;
-    std::unordered_map<VkInstance, vulkan_wrappers::InstanceWrapper*> instance_map_;
-    std::unordered_map<VkMicromapEXT, vulkan_wrappers::MicromapEXTWrapper*> micromapEXT_map_;
-    std::unordered_map<VkOpticalFlowSessionNV, vulkan_wrappers::OpticalFlowSessionNVWrapper*> opticalFlowSessionNV_map_;
-    std::unordered_map<VkPerformanceConfigurationINTEL, vulkan_wrappers::PerformanceConfigurationINTELWrapper*> performanceConfigurationINTEL_map_;
-    std::unordered_map<VkPhysicalDevice, vulkan_wrappers::PhysicalDeviceWrapper*> physicalDevice_map_;
-    std::unordered_map<VkPipeline, vulkan_wrappers::PipelineWrapper*> pipeline_map_;
-    std::unordered_map<VkPipelineBinaryKHR, vulkan_wrappers::PipelineBinaryKHRWrapper*> pipelineBinaryKHR_map_;
-    std::unordered_map<VkPipelineCache, vulkan_wrappers::PipelineCacheWrapper*> pipelineCache_map_;
-    std::unordered_map<VkPipelineLayout, vulkan_wrappers::PipelineLayoutWrapper*> pipelineLayout_map_;
-    std::unordered_map<VkPrivateDataSlot, vulkan_wrappers::PrivateDataSlotWrapper*> privateDataSlot_map_;
-    std::unordered_map<VkQueryPool, vulkan_wrappers::QueryPoolWrapper*> queryPool_map_;
-    std::unordered_map<VkQueue, vulkan_wrappers::QueueWrapper*> queue_map_;
-    std::unordered_map<VkRenderPass, vulkan_wrappers::RenderPassWrapper*> renderPass_map_;
-    std::unordered_map<VkSampler, vulkan_wrappers::SamplerWrapper*> sampler_map_;
-    std::unordered_map<VkSamplerYcbcrConversion, vulkan_wrappers::SamplerYcbcrConversionWrapper*> samplerYcbcrConversion_map_;
-    std::unordered_map<VkSemaphore, vulkan_wrappers::SemaphoreWrapper*> semaphore_map_;
-    std::unordered_map<VkShaderEXT, vulkan_wrappers::ShaderEXTWrapper*> shaderEXT_map_;
-    std::unordered_map<VkShaderModule, vulkan_wrappers::ShaderModuleWrapper*> shaderModule_map_;
-    std::unordered_map<VkSurfaceKHR, vulkan_wrappers::SurfaceKHRWrapper*> surfaceKHR_map_;
-    std::unordered_map<VkSwapchainKHR, vulkan_wrappers::SwapchainKHRWrapper*> swapchainKHR_map_;
-    std::unordered_map<VkValidationCacheEXT, vulkan_wrappers::ValidationCacheEXTWrapper*> validationCacheEXT_map_;
-    std::unordered_map<VkVideoSessionKHR, vulkan_wrappers::VideoSessionKHRWrapper*> videoSessionKHR_map_;
-    std::unordered_map<VkVideoSessionParametersKHR, vulkan_wrappers::VideoSessionParametersKHRWrapper*> videoSessionParametersKHR_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::AccelerationStructureKHRWrapper> accelerationStructureKHR_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::AccelerationStructureNVWrapper> accelerationStructureNV_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::BufferWrapper> buffer_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::BufferViewWrapper> bufferView_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::CommandBufferWrapper> commandBuffer_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::CommandPoolWrapper> commandPool_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::DebugReportCallbackEXTWrapper> debugReportCallbackEXT_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::DebugUtilsMessengerEXTWrapper> debugUtilsMessengerEXT_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::DeferredOperationKHRWrapper> deferredOperationKHR_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::DescriptorPoolWrapper> descriptorPool_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::DescriptorSetWrapper> descriptorSet_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::DescriptorSetLayoutWrapper> descriptorSetLayout_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::DescriptorUpdateTemplateWrapper> descriptorUpdateTemplate_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::DeviceWrapper> device_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::DeviceMemoryWrapper> deviceMemory_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::DisplayKHRWrapper> displayKHR_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::DisplayModeKHRWrapper> displayModeKHR_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::EventWrapper> event_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::FenceWrapper> fence_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::FramebufferWrapper> framebuffer_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::ImageWrapper> image_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::ImageViewWrapper> imageView_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::IndirectCommandsLayoutEXTWrapper> indirectCommandsLayoutEXT_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::IndirectCommandsLayoutNVWrapper> indirectCommandsLayoutNV_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::IndirectExecutionSetEXTWrapper> indirectExecutionSetEXT_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::InstanceWrapper> instance_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::MicromapEXTWrapper> micromapEXT_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::OpticalFlowSessionNVWrapper> opticalFlowSessionNV_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::PerformanceConfigurationINTELWrapper> performanceConfigurationINTEL_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::PhysicalDeviceWrapper> physicalDevice_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::PipelineWrapper> pipeline_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::PipelineBinaryKHRWrapper> pipelineBinaryKHR_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::PipelineCacheWrapper> pipelineCache_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::PipelineLayoutWrapper> pipelineLayout_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::PrivateDataSlotWrapper> privateDataSlot_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::QueryPoolWrapper> queryPool_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::QueueWrapper> queue_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::RenderPassWrapper> renderPass_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::SamplerWrapper> sampler_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::SamplerYcbcrConversionWrapper> samplerYcbcrConversion_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::SemaphoreWrapper> semaphore_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::ShaderEXTWrapper> shaderEXT_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::ShaderModuleWrapper> shaderModule_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::SurfaceKHRWrapper> surfaceKHR_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::SwapchainKHRWrapper> swapchainKHR_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::ValidationCacheEXTWrapper> validationCacheEXT_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::VideoSessionKHRWrapper> videoSessionKHR_map_;
+    util::ConcurrentHandleMap<vulkan_wrappers::VideoSessionParametersKHRWrapper> videoSessionParametersKHR_map_;
 };
 
-template<> inline const vulkan_wrappers::AccelerationStructureKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::AccelerationStructureKHRWrapper>(VkAccelerationStructureKHR handle) const { return VulkanStateTableBase::GetWrapper(handle, accelerationStructureKHR_map_); }
-template<> inline const vulkan_wrappers::AccelerationStructureNVWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::AccelerationStructureNVWrapper>(VkAccelerationStructureNV handle) const { return VulkanStateTableBase::GetWrapper(handle, accelerationStructureNV_map_); }
-template<> inline const vulkan_wrappers::BufferWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::BufferWrapper>(VkBuffer handle) const { return VulkanStateTableBase::GetWrapper(handle, buffer_map_); }
-template<> inline const vulkan_wrappers::BufferViewWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::BufferViewWrapper>(VkBufferView handle) const { return VulkanStateTableBase::GetWrapper(handle, bufferView_map_); }
-template<> inline const vulkan_wrappers::CommandBufferWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::CommandBufferWrapper>(VkCommandBuffer handle) const { return VulkanStateTableBase::GetWrapper(handle, commandBuffer_map_); }
-template<> inline const vulkan_wrappers::CommandPoolWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::CommandPoolWrapper>(VkCommandPool handle) const { return VulkanStateTableBase::GetWrapper(handle, commandPool_map_); }
-template<> inline const vulkan_wrappers::DebugReportCallbackEXTWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DebugReportCallbackEXTWrapper>(VkDebugReportCallbackEXT handle) const { return VulkanStateTableBase::GetWrapper(handle, debugReportCallbackEXT_map_); }
-template<> inline const vulkan_wrappers::DebugUtilsMessengerEXTWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DebugUtilsMessengerEXTWrapper>(VkDebugUtilsMessengerEXT handle) const { return VulkanStateTableBase::GetWrapper(handle, debugUtilsMessengerEXT_map_); }
-template<> inline const vulkan_wrappers::DeferredOperationKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DeferredOperationKHRWrapper>(VkDeferredOperationKHR handle) const { return VulkanStateTableBase::GetWrapper(handle, deferredOperationKHR_map_); }
-template<> inline const vulkan_wrappers::DescriptorPoolWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DescriptorPoolWrapper>(VkDescriptorPool handle) const { return VulkanStateTableBase::GetWrapper(handle, descriptorPool_map_); }
-template<> inline const vulkan_wrappers::DescriptorSetWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DescriptorSetWrapper>(VkDescriptorSet handle) const { return VulkanStateTableBase::GetWrapper(handle, descriptorSet_map_); }
-template<> inline const vulkan_wrappers::DescriptorSetLayoutWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DescriptorSetLayoutWrapper>(VkDescriptorSetLayout handle) const { return VulkanStateTableBase::GetWrapper(handle, descriptorSetLayout_map_); }
-template<> inline const vulkan_wrappers::DescriptorUpdateTemplateWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DescriptorUpdateTemplateWrapper>(VkDescriptorUpdateTemplate handle) const { return VulkanStateTableBase::GetWrapper(handle, descriptorUpdateTemplate_map_); }
-template<> inline const vulkan_wrappers::DeviceWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DeviceWrapper>(VkDevice handle) const { return VulkanStateTableBase::GetWrapper(handle, device_map_); }
-template<> inline const vulkan_wrappers::DeviceMemoryWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DeviceMemoryWrapper>(VkDeviceMemory handle) const { return VulkanStateTableBase::GetWrapper(handle, deviceMemory_map_); }
-template<> inline const vulkan_wrappers::DisplayKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DisplayKHRWrapper>(VkDisplayKHR handle) const { return VulkanStateTableBase::GetWrapper(handle, displayKHR_map_); }
-template<> inline const vulkan_wrappers::DisplayModeKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DisplayModeKHRWrapper>(VkDisplayModeKHR handle) const { return VulkanStateTableBase::GetWrapper(handle, displayModeKHR_map_); }
-template<> inline const vulkan_wrappers::EventWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::EventWrapper>(VkEvent handle) const { return VulkanStateTableBase::GetWrapper(handle, event_map_); }
-template<> inline const vulkan_wrappers::FenceWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::FenceWrapper>(VkFence handle) const { return VulkanStateTableBase::GetWrapper(handle, fence_map_); }
-template<> inline const vulkan_wrappers::FramebufferWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::FramebufferWrapper>(VkFramebuffer handle) const { return VulkanStateTableBase::GetWrapper(handle, framebuffer_map_); }
-template<> inline const vulkan_wrappers::ImageWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::ImageWrapper>(VkImage handle) const { return VulkanStateTableBase::GetWrapper(handle, image_map_); }
-template<> inline const vulkan_wrappers::ImageViewWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::ImageViewWrapper>(VkImageView handle) const { return VulkanStateTableBase::GetWrapper(handle, imageView_map_); }
-template<> inline const vulkan_wrappers::IndirectCommandsLayoutEXTWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::IndirectCommandsLayoutEXTWrapper>(VkIndirectCommandsLayoutEXT handle) const { return VulkanStateTableBase::GetWrapper(handle, indirectCommandsLayoutEXT_map_); }
-template<> inline const vulkan_wrappers::IndirectCommandsLayoutNVWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::IndirectCommandsLayoutNVWrapper>(VkIndirectCommandsLayoutNV handle) const { return VulkanStateTableBase::GetWrapper(handle, indirectCommandsLayoutNV_map_); }
-template<> inline const vulkan_wrappers::IndirectExecutionSetEXTWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::IndirectExecutionSetEXTWrapper>(VkIndirectExecutionSetEXT handle) const { return VulkanStateTableBase::GetWrapper(handle, indirectExecutionSetEXT_map_); }
-template<> inline const vulkan_wrappers::InstanceWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::InstanceWrapper>(VkInstance handle) const { return VulkanStateTableBase::GetWrapper(handle, instance_map_); }
-template<> inline const vulkan_wrappers::MicromapEXTWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::MicromapEXTWrapper>(VkMicromapEXT handle) const { return VulkanStateTableBase::GetWrapper(handle, micromapEXT_map_); }
-template<> inline const vulkan_wrappers::OpticalFlowSessionNVWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::OpticalFlowSessionNVWrapper>(VkOpticalFlowSessionNV handle) const { return VulkanStateTableBase::GetWrapper(handle, opticalFlowSessionNV_map_); }
-template<> inline const vulkan_wrappers::PerformanceConfigurationINTELWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::PerformanceConfigurationINTELWrapper>(VkPerformanceConfigurationINTEL handle) const { return VulkanStateTableBase::GetWrapper(handle, performanceConfigurationINTEL_map_); }
-template<> inline const vulkan_wrappers::PhysicalDeviceWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::PhysicalDeviceWrapper>(VkPhysicalDevice handle) const { return VulkanStateTableBase::GetWrapper(handle, physicalDevice_map_); }
-template<> inline const vulkan_wrappers::PipelineWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::PipelineWrapper>(VkPipeline handle) const { return VulkanStateTableBase::GetWrapper(handle, pipeline_map_); }
-template<> inline const vulkan_wrappers::PipelineBinaryKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::PipelineBinaryKHRWrapper>(VkPipelineBinaryKHR handle) const { return VulkanStateTableBase::GetWrapper(handle, pipelineBinaryKHR_map_); }
-template<> inline const vulkan_wrappers::PipelineCacheWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::PipelineCacheWrapper>(VkPipelineCache handle) const { return VulkanStateTableBase::GetWrapper(handle, pipelineCache_map_); }
-template<> inline const vulkan_wrappers::PipelineLayoutWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::PipelineLayoutWrapper>(VkPipelineLayout handle) const { return VulkanStateTableBase::GetWrapper(handle, pipelineLayout_map_); }
-template<> inline const vulkan_wrappers::PrivateDataSlotWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::PrivateDataSlotWrapper>(VkPrivateDataSlot handle) const { return VulkanStateTableBase::GetWrapper(handle, privateDataSlot_map_); }
-template<> inline const vulkan_wrappers::QueryPoolWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::QueryPoolWrapper>(VkQueryPool handle) const { return VulkanStateTableBase::GetWrapper(handle, queryPool_map_); }
-template<> inline const vulkan_wrappers::QueueWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::QueueWrapper>(VkQueue handle) const { return VulkanStateTableBase::GetWrapper(handle, queue_map_); }
-template<> inline const vulkan_wrappers::RenderPassWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::RenderPassWrapper>(VkRenderPass handle) const { return VulkanStateTableBase::GetWrapper(handle, renderPass_map_); }
-template<> inline const vulkan_wrappers::SamplerWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::SamplerWrapper>(VkSampler handle) const { return VulkanStateTableBase::GetWrapper(handle, sampler_map_); }
-template<> inline const vulkan_wrappers::SamplerYcbcrConversionWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::SamplerYcbcrConversionWrapper>(VkSamplerYcbcrConversion handle) const { return VulkanStateTableBase::GetWrapper(handle, samplerYcbcrConversion_map_); }
-template<> inline const vulkan_wrappers::SemaphoreWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::SemaphoreWrapper>(VkSemaphore handle) const { return VulkanStateTableBase::GetWrapper(handle, semaphore_map_); }
-template<> inline const vulkan_wrappers::ShaderEXTWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::ShaderEXTWrapper>(VkShaderEXT handle) const { return VulkanStateTableBase::GetWrapper(handle, shaderEXT_map_); }
-template<> inline const vulkan_wrappers::ShaderModuleWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::ShaderModuleWrapper>(VkShaderModule handle) const { return VulkanStateTableBase::GetWrapper(handle, shaderModule_map_); }
-template<> inline const vulkan_wrappers::SurfaceKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::SurfaceKHRWrapper>(VkSurfaceKHR handle) const { return VulkanStateTableBase::GetWrapper(handle, surfaceKHR_map_); }
-template<> inline const vulkan_wrappers::SwapchainKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::SwapchainKHRWrapper>(VkSwapchainKHR handle) const { return VulkanStateTableBase::GetWrapper(handle, swapchainKHR_map_); }
-template<> inline const vulkan_wrappers::ValidationCacheEXTWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::ValidationCacheEXTWrapper>(VkValidationCacheEXT handle) const { return VulkanStateTableBase::GetWrapper(handle, validationCacheEXT_map_); }
-template<> inline const vulkan_wrappers::VideoSessionKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::VideoSessionKHRWrapper>(VkVideoSessionKHR handle) const { return VulkanStateTableBase::GetWrapper(handle, videoSessionKHR_map_); }
-template<> inline const vulkan_wrappers::VideoSessionParametersKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::VideoSessionParametersKHRWrapper>(VkVideoSessionParametersKHR handle) const { return VulkanStateTableBase::GetWrapper(handle, videoSessionParametersKHR_map_); }
+template<> inline const vulkan_wrappers::AccelerationStructureKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::AccelerationStructureKHRWrapper>(VkAccelerationStructureKHR handle) const { return GetHandleEntry(handle, accelerationStructureKHR_map_); }
+template<> inline const vulkan_wrappers::AccelerationStructureNVWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::AccelerationStructureNVWrapper>(VkAccelerationStructureNV handle) const { return GetHandleEntry(handle, accelerationStructureNV_map_); }
+template<> inline const vulkan_wrappers::BufferWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::BufferWrapper>(VkBuffer handle) const { return GetHandleEntry(handle, buffer_map_); }
+template<> inline const vulkan_wrappers::BufferViewWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::BufferViewWrapper>(VkBufferView handle) const { return GetHandleEntry(handle, bufferView_map_); }
+template<> inline const vulkan_wrappers::CommandBufferWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::CommandBufferWrapper>(VkCommandBuffer handle) const { return GetHandleEntry(handle, commandBuffer_map_); }
+template<> inline const vulkan_wrappers::CommandPoolWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::CommandPoolWrapper>(VkCommandPool handle) const { return GetHandleEntry(handle, commandPool_map_); }
+template<> inline const vulkan_wrappers::DebugReportCallbackEXTWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DebugReportCallbackEXTWrapper>(VkDebugReportCallbackEXT handle) const { return GetHandleEntry(handle, debugReportCallbackEXT_map_); }
+template<> inline const vulkan_wrappers::DebugUtilsMessengerEXTWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DebugUtilsMessengerEXTWrapper>(VkDebugUtilsMessengerEXT handle) const { return GetHandleEntry(handle, debugUtilsMessengerEXT_map_); }
+template<> inline const vulkan_wrappers::DeferredOperationKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DeferredOperationKHRWrapper>(VkDeferredOperationKHR handle) const { return GetHandleEntry(handle, deferredOperationKHR_map_); }
+template<> inline const vulkan_wrappers::DescriptorPoolWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DescriptorPoolWrapper>(VkDescriptorPool handle) const { return GetHandleEntry(handle, descriptorPool_map_); }
+template<> inline const vulkan_wrappers::DescriptorSetWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DescriptorSetWrapper>(VkDescriptorSet handle) const { return GetHandleEntry(handle, descriptorSet_map_); }
+template<> inline const vulkan_wrappers::DescriptorSetLayoutWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DescriptorSetLayoutWrapper>(VkDescriptorSetLayout handle) const { return GetHandleEntry(handle, descriptorSetLayout_map_); }
+template<> inline const vulkan_wrappers::DescriptorUpdateTemplateWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DescriptorUpdateTemplateWrapper>(VkDescriptorUpdateTemplate handle) const { return GetHandleEntry(handle, descriptorUpdateTemplate_map_); }
+template<> inline const vulkan_wrappers::DeviceWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DeviceWrapper>(VkDevice handle) const { return GetHandleEntry(handle, device_map_); }
+template<> inline const vulkan_wrappers::DeviceMemoryWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DeviceMemoryWrapper>(VkDeviceMemory handle) const { return GetHandleEntry(handle, deviceMemory_map_); }
+template<> inline const vulkan_wrappers::DisplayKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DisplayKHRWrapper>(VkDisplayKHR handle) const { return GetHandleEntry(handle, displayKHR_map_); }
+template<> inline const vulkan_wrappers::DisplayModeKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DisplayModeKHRWrapper>(VkDisplayModeKHR handle) const { return GetHandleEntry(handle, displayModeKHR_map_); }
+template<> inline const vulkan_wrappers::EventWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::EventWrapper>(VkEvent handle) const { return GetHandleEntry(handle, event_map_); }
+template<> inline const vulkan_wrappers::FenceWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::FenceWrapper>(VkFence handle) const { return GetHandleEntry(handle, fence_map_); }
+template<> inline const vulkan_wrappers::FramebufferWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::FramebufferWrapper>(VkFramebuffer handle) const { return GetHandleEntry(handle, framebuffer_map_); }
+template<> inline const vulkan_wrappers::ImageWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::ImageWrapper>(VkImage handle) const { return GetHandleEntry(handle, image_map_); }
+template<> inline const vulkan_wrappers::ImageViewWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::ImageViewWrapper>(VkImageView handle) const { return GetHandleEntry(handle, imageView_map_); }
+template<> inline const vulkan_wrappers::IndirectCommandsLayoutEXTWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::IndirectCommandsLayoutEXTWrapper>(VkIndirectCommandsLayoutEXT handle) const { return GetHandleEntry(handle, indirectCommandsLayoutEXT_map_); }
+template<> inline const vulkan_wrappers::IndirectCommandsLayoutNVWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::IndirectCommandsLayoutNVWrapper>(VkIndirectCommandsLayoutNV handle) const { return GetHandleEntry(handle, indirectCommandsLayoutNV_map_); }
+template<> inline const vulkan_wrappers::IndirectExecutionSetEXTWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::IndirectExecutionSetEXTWrapper>(VkIndirectExecutionSetEXT handle) const { return GetHandleEntry(handle, indirectExecutionSetEXT_map_); }
+template<> inline const vulkan_wrappers::InstanceWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::InstanceWrapper>(VkInstance handle) const { return GetHandleEntry(handle, instance_map_); }
+template<> inline const vulkan_wrappers::MicromapEXTWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::MicromapEXTWrapper>(VkMicromapEXT handle) const { return GetHandleEntry(handle, micromapEXT_map_); }
+template<> inline const vulkan_wrappers::OpticalFlowSessionNVWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::OpticalFlowSessionNVWrapper>(VkOpticalFlowSessionNV handle) const { return GetHandleEntry(handle, opticalFlowSessionNV_map_); }
+template<> inline const vulkan_wrappers::PerformanceConfigurationINTELWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::PerformanceConfigurationINTELWrapper>(VkPerformanceConfigurationINTEL handle) const { return GetHandleEntry(handle, performanceConfigurationINTEL_map_); }
+template<> inline const vulkan_wrappers::PhysicalDeviceWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::PhysicalDeviceWrapper>(VkPhysicalDevice handle) const { return GetHandleEntry(handle, physicalDevice_map_); }
+template<> inline const vulkan_wrappers::PipelineWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::PipelineWrapper>(VkPipeline handle) const { return GetHandleEntry(handle, pipeline_map_); }
+template<> inline const vulkan_wrappers::PipelineBinaryKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::PipelineBinaryKHRWrapper>(VkPipelineBinaryKHR handle) const { return GetHandleEntry(handle, pipelineBinaryKHR_map_); }
+template<> inline const vulkan_wrappers::PipelineCacheWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::PipelineCacheWrapper>(VkPipelineCache handle) const { return GetHandleEntry(handle, pipelineCache_map_); }
+template<> inline const vulkan_wrappers::PipelineLayoutWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::PipelineLayoutWrapper>(VkPipelineLayout handle) const { return GetHandleEntry(handle, pipelineLayout_map_); }
+template<> inline const vulkan_wrappers::PrivateDataSlotWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::PrivateDataSlotWrapper>(VkPrivateDataSlot handle) const { return GetHandleEntry(handle, privateDataSlot_map_); }
+template<> inline const vulkan_wrappers::QueryPoolWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::QueryPoolWrapper>(VkQueryPool handle) const { return GetHandleEntry(handle, queryPool_map_); }
+template<> inline const vulkan_wrappers::QueueWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::QueueWrapper>(VkQueue handle) const { return GetHandleEntry(handle, queue_map_); }
+template<> inline const vulkan_wrappers::RenderPassWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::RenderPassWrapper>(VkRenderPass handle) const { return GetHandleEntry(handle, renderPass_map_); }
+template<> inline const vulkan_wrappers::SamplerWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::SamplerWrapper>(VkSampler handle) const { return GetHandleEntry(handle, sampler_map_); }
+template<> inline const vulkan_wrappers::SamplerYcbcrConversionWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::SamplerYcbcrConversionWrapper>(VkSamplerYcbcrConversion handle) const { return GetHandleEntry(handle, samplerYcbcrConversion_map_); }
+template<> inline const vulkan_wrappers::SemaphoreWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::SemaphoreWrapper>(VkSemaphore handle) const { return GetHandleEntry(handle, semaphore_map_); }
+template<> inline const vulkan_wrappers::ShaderEXTWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::ShaderEXTWrapper>(VkShaderEXT handle) const { return GetHandleEntry(handle, shaderEXT_map_); }
+template<> inline const vulkan_wrappers::ShaderModuleWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::ShaderModuleWrapper>(VkShaderModule handle) const { return GetHandleEntry(handle, shaderModule_map_); }
+template<> inline const vulkan_wrappers::SurfaceKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::SurfaceKHRWrapper>(VkSurfaceKHR handle) const { return GetHandleEntry(handle, surfaceKHR_map_); }
+template<> inline const vulkan_wrappers::SwapchainKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::SwapchainKHRWrapper>(VkSwapchainKHR handle) const { return GetHandleEntry(handle, swapchainKHR_map_); }
+template<> inline const vulkan_wrappers::ValidationCacheEXTWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::ValidationCacheEXTWrapper>(VkValidationCacheEXT handle) const { return GetHandleEntry(handle, validationCacheEXT_map_); }
+template<> inline const vulkan_wrappers::VideoSessionKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::VideoSessionKHRWrapper>(VkVideoSessionKHR handle) const { return GetHandleEntry(handle, videoSessionKHR_map_); }
+template<> inline const vulkan_wrappers::VideoSessionParametersKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::VideoSessionParametersKHRWrapper>(VkVideoSessionParametersKHR handle) const { return GetHandleEntry(handle, videoSessionParametersKHR_map_); }
 
-template<> inline vulkan_wrappers::AccelerationStructureKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::AccelerationStructureKHRWrapper>(VkAccelerationStructureKHR handle) { return VulkanStateTableBase::GetWrapper(handle, accelerationStructureKHR_map_); }
-template<> inline vulkan_wrappers::AccelerationStructureNVWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::AccelerationStructureNVWrapper>(VkAccelerationStructureNV handle) { return VulkanStateTableBase::GetWrapper(handle, accelerationStructureNV_map_); }
-template<> inline vulkan_wrappers::BufferWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::BufferWrapper>(VkBuffer handle) { return VulkanStateTableBase::GetWrapper(handle, buffer_map_); }
-template<> inline vulkan_wrappers::BufferViewWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::BufferViewWrapper>(VkBufferView handle) { return VulkanStateTableBase::GetWrapper(handle, bufferView_map_); }
-template<> inline vulkan_wrappers::CommandBufferWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::CommandBufferWrapper>(VkCommandBuffer handle) { return VulkanStateTableBase::GetWrapper(handle, commandBuffer_map_); }
-template<> inline vulkan_wrappers::CommandPoolWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::CommandPoolWrapper>(VkCommandPool handle) { return VulkanStateTableBase::GetWrapper(handle, commandPool_map_); }
-template<> inline vulkan_wrappers::DebugReportCallbackEXTWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DebugReportCallbackEXTWrapper>(VkDebugReportCallbackEXT handle) { return VulkanStateTableBase::GetWrapper(handle, debugReportCallbackEXT_map_); }
-template<> inline vulkan_wrappers::DebugUtilsMessengerEXTWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DebugUtilsMessengerEXTWrapper>(VkDebugUtilsMessengerEXT handle) { return VulkanStateTableBase::GetWrapper(handle, debugUtilsMessengerEXT_map_); }
-template<> inline vulkan_wrappers::DeferredOperationKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DeferredOperationKHRWrapper>(VkDeferredOperationKHR handle) { return VulkanStateTableBase::GetWrapper(handle, deferredOperationKHR_map_); }
-template<> inline vulkan_wrappers::DescriptorPoolWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DescriptorPoolWrapper>(VkDescriptorPool handle) { return VulkanStateTableBase::GetWrapper(handle, descriptorPool_map_); }
-template<> inline vulkan_wrappers::DescriptorSetWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DescriptorSetWrapper>(VkDescriptorSet handle) { return VulkanStateTableBase::GetWrapper(handle, descriptorSet_map_); }
-template<> inline vulkan_wrappers::DescriptorSetLayoutWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DescriptorSetLayoutWrapper>(VkDescriptorSetLayout handle) { return VulkanStateTableBase::GetWrapper(handle, descriptorSetLayout_map_); }
-template<> inline vulkan_wrappers::DescriptorUpdateTemplateWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DescriptorUpdateTemplateWrapper>(VkDescriptorUpdateTemplate handle) { return VulkanStateTableBase::GetWrapper(handle, descriptorUpdateTemplate_map_); }
-template<> inline vulkan_wrappers::DeviceWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DeviceWrapper>(VkDevice handle) { return VulkanStateTableBase::GetWrapper(handle, device_map_); }
-template<> inline vulkan_wrappers::DeviceMemoryWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DeviceMemoryWrapper>(VkDeviceMemory handle) { return VulkanStateTableBase::GetWrapper(handle, deviceMemory_map_); }
-template<> inline vulkan_wrappers::DisplayKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DisplayKHRWrapper>(VkDisplayKHR handle) { return VulkanStateTableBase::GetWrapper(handle, displayKHR_map_); }
-template<> inline vulkan_wrappers::DisplayModeKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DisplayModeKHRWrapper>(VkDisplayModeKHR handle) { return VulkanStateTableBase::GetWrapper(handle, displayModeKHR_map_); }
-template<> inline vulkan_wrappers::EventWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::EventWrapper>(VkEvent handle) { return VulkanStateTableBase::GetWrapper(handle, event_map_); }
-template<> inline vulkan_wrappers::FenceWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::FenceWrapper>(VkFence handle) { return VulkanStateTableBase::GetWrapper(handle, fence_map_); }
-template<> inline vulkan_wrappers::FramebufferWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::FramebufferWrapper>(VkFramebuffer handle) { return VulkanStateTableBase::GetWrapper(handle, framebuffer_map_); }
-template<> inline vulkan_wrappers::ImageWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::ImageWrapper>(VkImage handle) { return VulkanStateTableBase::GetWrapper(handle, image_map_); }
-template<> inline vulkan_wrappers::ImageViewWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::ImageViewWrapper>(VkImageView handle) { return VulkanStateTableBase::GetWrapper(handle, imageView_map_); }
-template<> inline vulkan_wrappers::IndirectCommandsLayoutEXTWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::IndirectCommandsLayoutEXTWrapper>(VkIndirectCommandsLayoutEXT handle) { return VulkanStateTableBase::GetWrapper(handle, indirectCommandsLayoutEXT_map_); }
-template<> inline vulkan_wrappers::IndirectCommandsLayoutNVWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::IndirectCommandsLayoutNVWrapper>(VkIndirectCommandsLayoutNV handle) { return VulkanStateTableBase::GetWrapper(handle, indirectCommandsLayoutNV_map_); }
-template<> inline vulkan_wrappers::IndirectExecutionSetEXTWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::IndirectExecutionSetEXTWrapper>(VkIndirectExecutionSetEXT handle) { return VulkanStateTableBase::GetWrapper(handle, indirectExecutionSetEXT_map_); }
-template<> inline vulkan_wrappers::InstanceWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::InstanceWrapper>(VkInstance handle) { return VulkanStateTableBase::GetWrapper(handle, instance_map_); }
-template<> inline vulkan_wrappers::MicromapEXTWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::MicromapEXTWrapper>(VkMicromapEXT handle) { return VulkanStateTableBase::GetWrapper(handle, micromapEXT_map_); }
-template<> inline vulkan_wrappers::OpticalFlowSessionNVWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::OpticalFlowSessionNVWrapper>(VkOpticalFlowSessionNV handle) { return VulkanStateTableBase::GetWrapper(handle, opticalFlowSessionNV_map_); }
-template<> inline vulkan_wrappers::PerformanceConfigurationINTELWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::PerformanceConfigurationINTELWrapper>(VkPerformanceConfigurationINTEL handle) { return VulkanStateTableBase::GetWrapper(handle, performanceConfigurationINTEL_map_); }
-template<> inline vulkan_wrappers::PhysicalDeviceWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::PhysicalDeviceWrapper>(VkPhysicalDevice handle) { return VulkanStateTableBase::GetWrapper(handle, physicalDevice_map_); }
-template<> inline vulkan_wrappers::PipelineWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::PipelineWrapper>(VkPipeline handle) { return VulkanStateTableBase::GetWrapper(handle, pipeline_map_); }
-template<> inline vulkan_wrappers::PipelineBinaryKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::PipelineBinaryKHRWrapper>(VkPipelineBinaryKHR handle) { return VulkanStateTableBase::GetWrapper(handle, pipelineBinaryKHR_map_); }
-template<> inline vulkan_wrappers::PipelineCacheWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::PipelineCacheWrapper>(VkPipelineCache handle) { return VulkanStateTableBase::GetWrapper(handle, pipelineCache_map_); }
-template<> inline vulkan_wrappers::PipelineLayoutWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::PipelineLayoutWrapper>(VkPipelineLayout handle) { return VulkanStateTableBase::GetWrapper(handle, pipelineLayout_map_); }
-template<> inline vulkan_wrappers::PrivateDataSlotWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::PrivateDataSlotWrapper>(VkPrivateDataSlot handle) { return VulkanStateTableBase::GetWrapper(handle, privateDataSlot_map_); }
-template<> inline vulkan_wrappers::QueryPoolWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::QueryPoolWrapper>(VkQueryPool handle) { return VulkanStateTableBase::GetWrapper(handle, queryPool_map_); }
-template<> inline vulkan_wrappers::QueueWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::QueueWrapper>(VkQueue handle) { return VulkanStateTableBase::GetWrapper(handle, queue_map_); }
-template<> inline vulkan_wrappers::RenderPassWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::RenderPassWrapper>(VkRenderPass handle) { return VulkanStateTableBase::GetWrapper(handle, renderPass_map_); }
-template<> inline vulkan_wrappers::SamplerWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::SamplerWrapper>(VkSampler handle) { return VulkanStateTableBase::GetWrapper(handle, sampler_map_); }
-template<> inline vulkan_wrappers::SamplerYcbcrConversionWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::SamplerYcbcrConversionWrapper>(VkSamplerYcbcrConversion handle) { return VulkanStateTableBase::GetWrapper(handle, samplerYcbcrConversion_map_); }
-template<> inline vulkan_wrappers::SemaphoreWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::SemaphoreWrapper>(VkSemaphore handle) { return VulkanStateTableBase::GetWrapper(handle, semaphore_map_); }
-template<> inline vulkan_wrappers::ShaderEXTWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::ShaderEXTWrapper>(VkShaderEXT handle) { return VulkanStateTableBase::GetWrapper(handle, shaderEXT_map_); }
-template<> inline vulkan_wrappers::ShaderModuleWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::ShaderModuleWrapper>(VkShaderModule handle) { return VulkanStateTableBase::GetWrapper(handle, shaderModule_map_); }
-template<> inline vulkan_wrappers::SurfaceKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::SurfaceKHRWrapper>(VkSurfaceKHR handle) { return VulkanStateTableBase::GetWrapper(handle, surfaceKHR_map_); }
-template<> inline vulkan_wrappers::SwapchainKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::SwapchainKHRWrapper>(VkSwapchainKHR handle) { return VulkanStateTableBase::GetWrapper(handle, swapchainKHR_map_); }
-template<> inline vulkan_wrappers::ValidationCacheEXTWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::ValidationCacheEXTWrapper>(VkValidationCacheEXT handle) { return VulkanStateTableBase::GetWrapper(handle, validationCacheEXT_map_); }
-template<> inline vulkan_wrappers::VideoSessionKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::VideoSessionKHRWrapper>(VkVideoSessionKHR handle) { return VulkanStateTableBase::GetWrapper(handle, videoSessionKHR_map_); }
-template<> inline vulkan_wrappers::VideoSessionParametersKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::VideoSessionParametersKHRWrapper>(VkVideoSessionParametersKHR handle) { return VulkanStateTableBase::GetWrapper(handle, videoSessionParametersKHR_map_); }
+template<> inline vulkan_wrappers::AccelerationStructureKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::AccelerationStructureKHRWrapper>(VkAccelerationStructureKHR handle) { return GetHandleEntry(handle, accelerationStructureKHR_map_); }
+template<> inline vulkan_wrappers::AccelerationStructureNVWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::AccelerationStructureNVWrapper>(VkAccelerationStructureNV handle) { return GetHandleEntry(handle, accelerationStructureNV_map_); }
+template<> inline vulkan_wrappers::BufferWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::BufferWrapper>(VkBuffer handle) { return GetHandleEntry(handle, buffer_map_); }
+template<> inline vulkan_wrappers::BufferViewWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::BufferViewWrapper>(VkBufferView handle) { return GetHandleEntry(handle, bufferView_map_); }
+template<> inline vulkan_wrappers::CommandBufferWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::CommandBufferWrapper>(VkCommandBuffer handle) { return GetHandleEntry(handle, commandBuffer_map_); }
+template<> inline vulkan_wrappers::CommandPoolWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::CommandPoolWrapper>(VkCommandPool handle) { return GetHandleEntry(handle, commandPool_map_); }
+template<> inline vulkan_wrappers::DebugReportCallbackEXTWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DebugReportCallbackEXTWrapper>(VkDebugReportCallbackEXT handle) { return GetHandleEntry(handle, debugReportCallbackEXT_map_); }
+template<> inline vulkan_wrappers::DebugUtilsMessengerEXTWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DebugUtilsMessengerEXTWrapper>(VkDebugUtilsMessengerEXT handle) { return GetHandleEntry(handle, debugUtilsMessengerEXT_map_); }
+template<> inline vulkan_wrappers::DeferredOperationKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DeferredOperationKHRWrapper>(VkDeferredOperationKHR handle) { return GetHandleEntry(handle, deferredOperationKHR_map_); }
+template<> inline vulkan_wrappers::DescriptorPoolWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DescriptorPoolWrapper>(VkDescriptorPool handle) { return GetHandleEntry(handle, descriptorPool_map_); }
+template<> inline vulkan_wrappers::DescriptorSetWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DescriptorSetWrapper>(VkDescriptorSet handle) { return GetHandleEntry(handle, descriptorSet_map_); }
+template<> inline vulkan_wrappers::DescriptorSetLayoutWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DescriptorSetLayoutWrapper>(VkDescriptorSetLayout handle) { return GetHandleEntry(handle, descriptorSetLayout_map_); }
+template<> inline vulkan_wrappers::DescriptorUpdateTemplateWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DescriptorUpdateTemplateWrapper>(VkDescriptorUpdateTemplate handle) { return GetHandleEntry(handle, descriptorUpdateTemplate_map_); }
+template<> inline vulkan_wrappers::DeviceWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DeviceWrapper>(VkDevice handle) { return GetHandleEntry(handle, device_map_); }
+template<> inline vulkan_wrappers::DeviceMemoryWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DeviceMemoryWrapper>(VkDeviceMemory handle) { return GetHandleEntry(handle, deviceMemory_map_); }
+template<> inline vulkan_wrappers::DisplayKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DisplayKHRWrapper>(VkDisplayKHR handle) { return GetHandleEntry(handle, displayKHR_map_); }
+template<> inline vulkan_wrappers::DisplayModeKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::DisplayModeKHRWrapper>(VkDisplayModeKHR handle) { return GetHandleEntry(handle, displayModeKHR_map_); }
+template<> inline vulkan_wrappers::EventWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::EventWrapper>(VkEvent handle) { return GetHandleEntry(handle, event_map_); }
+template<> inline vulkan_wrappers::FenceWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::FenceWrapper>(VkFence handle) { return GetHandleEntry(handle, fence_map_); }
+template<> inline vulkan_wrappers::FramebufferWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::FramebufferWrapper>(VkFramebuffer handle) { return GetHandleEntry(handle, framebuffer_map_); }
+template<> inline vulkan_wrappers::ImageWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::ImageWrapper>(VkImage handle) { return GetHandleEntry(handle, image_map_); }
+template<> inline vulkan_wrappers::ImageViewWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::ImageViewWrapper>(VkImageView handle) { return GetHandleEntry(handle, imageView_map_); }
+template<> inline vulkan_wrappers::IndirectCommandsLayoutEXTWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::IndirectCommandsLayoutEXTWrapper>(VkIndirectCommandsLayoutEXT handle) { return GetHandleEntry(handle, indirectCommandsLayoutEXT_map_); }
+template<> inline vulkan_wrappers::IndirectCommandsLayoutNVWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::IndirectCommandsLayoutNVWrapper>(VkIndirectCommandsLayoutNV handle) { return GetHandleEntry(handle, indirectCommandsLayoutNV_map_); }
+template<> inline vulkan_wrappers::IndirectExecutionSetEXTWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::IndirectExecutionSetEXTWrapper>(VkIndirectExecutionSetEXT handle) { return GetHandleEntry(handle, indirectExecutionSetEXT_map_); }
+template<> inline vulkan_wrappers::InstanceWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::InstanceWrapper>(VkInstance handle) { return GetHandleEntry(handle, instance_map_); }
+template<> inline vulkan_wrappers::MicromapEXTWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::MicromapEXTWrapper>(VkMicromapEXT handle) { return GetHandleEntry(handle, micromapEXT_map_); }
+template<> inline vulkan_wrappers::OpticalFlowSessionNVWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::OpticalFlowSessionNVWrapper>(VkOpticalFlowSessionNV handle) { return GetHandleEntry(handle, opticalFlowSessionNV_map_); }
+template<> inline vulkan_wrappers::PerformanceConfigurationINTELWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::PerformanceConfigurationINTELWrapper>(VkPerformanceConfigurationINTEL handle) { return GetHandleEntry(handle, performanceConfigurationINTEL_map_); }
+template<> inline vulkan_wrappers::PhysicalDeviceWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::PhysicalDeviceWrapper>(VkPhysicalDevice handle) { return GetHandleEntry(handle, physicalDevice_map_); }
+template<> inline vulkan_wrappers::PipelineWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::PipelineWrapper>(VkPipeline handle) { return GetHandleEntry(handle, pipeline_map_); }
+template<> inline vulkan_wrappers::PipelineBinaryKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::PipelineBinaryKHRWrapper>(VkPipelineBinaryKHR handle) { return GetHandleEntry(handle, pipelineBinaryKHR_map_); }
+template<> inline vulkan_wrappers::PipelineCacheWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::PipelineCacheWrapper>(VkPipelineCache handle) { return GetHandleEntry(handle, pipelineCache_map_); }
+template<> inline vulkan_wrappers::PipelineLayoutWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::PipelineLayoutWrapper>(VkPipelineLayout handle) { return GetHandleEntry(handle, pipelineLayout_map_); }
+template<> inline vulkan_wrappers::PrivateDataSlotWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::PrivateDataSlotWrapper>(VkPrivateDataSlot handle) { return GetHandleEntry(handle, privateDataSlot_map_); }
+template<> inline vulkan_wrappers::QueryPoolWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::QueryPoolWrapper>(VkQueryPool handle) { return GetHandleEntry(handle, queryPool_map_); }
+template<> inline vulkan_wrappers::QueueWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::QueueWrapper>(VkQueue handle) { return GetHandleEntry(handle, queue_map_); }
+template<> inline vulkan_wrappers::RenderPassWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::RenderPassWrapper>(VkRenderPass handle) { return GetHandleEntry(handle, renderPass_map_); }
+template<> inline vulkan_wrappers::SamplerWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::SamplerWrapper>(VkSampler handle) { return GetHandleEntry(handle, sampler_map_); }
+template<> inline vulkan_wrappers::SamplerYcbcrConversionWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::SamplerYcbcrConversionWrapper>(VkSamplerYcbcrConversion handle) { return GetHandleEntry(handle, samplerYcbcrConversion_map_); }
+template<> inline vulkan_wrappers::SemaphoreWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::SemaphoreWrapper>(VkSemaphore handle) { return GetHandleEntry(handle, semaphore_map_); }
+template<> inline vulkan_wrappers::ShaderEXTWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::ShaderEXTWrapper>(VkShaderEXT handle) { return GetHandleEntry(handle, shaderEXT_map_); }
+template<> inline vulkan_wrappers::ShaderModuleWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::ShaderModuleWrapper>(VkShaderModule handle) { return GetHandleEntry(handle, shaderModule_map_); }
+template<> inline vulkan_wrappers::SurfaceKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::SurfaceKHRWrapper>(VkSurfaceKHR handle) { return GetHandleEntry(handle, surfaceKHR_map_); }
+template<> inline vulkan_wrappers::SwapchainKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::SwapchainKHRWrapper>(VkSwapchainKHR handle) { return GetHandleEntry(handle, swapchainKHR_map_); }
+template<> inline vulkan_wrappers::ValidationCacheEXTWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::ValidationCacheEXTWrapper>(VkValidationCacheEXT handle) { return GetHandleEntry(handle, validationCacheEXT_map_); }
+template<> inline vulkan_wrappers::VideoSessionKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::VideoSessionKHRWrapper>(VkVideoSessionKHR handle) { return GetHandleEntry(handle, videoSessionKHR_map_); }
+template<> inline vulkan_wrappers::VideoSessionParametersKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::VideoSessionParametersKHRWrapper>(VkVideoSessionParametersKHR handle) { return GetHandleEntry(handle, videoSessionParametersKHR_map_); }
 
 GFXRECON_END_NAMESPACE(encode)
 GFXRECON_END_NAMESPACE(gfxrecon)
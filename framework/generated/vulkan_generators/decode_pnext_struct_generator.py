@@ -84,6 +84,7 @@ class DecodePNextStructGenerator(BaseGenerator):
             file=self.outFile
         )
         write('#include "decode/decode_allocator.h"', file=self.outFile)
+        write('#include "decode/value_decoder.h"', file=self.outFile)
         write('#include "decode/vulkan_pnext_node.h"', file=self.outFile)
         write('#include "decode/vulkan_pnext_typed_node.h"', file=self.outFile)
         write(
@@ -102,7 +103,7 @@ class DecodePNextStructGenerator(BaseGenerator):
         write('GFXRECON_BEGIN_NAMESPACE(decode)', file=self.outFile)
         self.newline()
         write(
-            'size_t DecodePNextStruct(const uint8_t* parameter_buffer, size_t buffer_size,  PNextNode** pNext)',
+            'size_t DecodePNextStruct(const uint8_t* parameter_buffer, size_t buffer_size, bool compact_encoding,  PNextNode** pNext)',
             file=self.outFile
         )
         write('{', file=self.outFile)
@@ -123,7 +124,7 @@ class DecodePNextStructGenerator(BaseGenerator):
             file=self.outFile
         )
         write(
-            '        attrib = *(reinterpret_cast<const uint32_t*>(parameter_buffer));',
+            '        size_t attrib_size = ValueDecoder::DecodeUInt32Value(parameter_buffer, buffer_size, compact_encoding, &attrib);',
             file=self.outFile
         )
         self.newline()
@@ -136,31 +137,32 @@ class DecodePNextStructGenerator(BaseGenerator):
             '            // Offset to VkStructureType, after the pointer encoding preamble.',
             file=self.outFile
         )
-        write('            stype_offset = sizeof(attrib);', file=self.outFile)
+        write('            stype_offset = attrib_size;', file=self.outFile)
         self.newline()
         write(
             '            if ((attrib & format::PointerAttributes::kHasAddress) == format::PointerAttributes::kHasAddress)',
             file=self.outFile
         )
         write('            {', file=self.outFile)
+        write('                uint64_t address = 0;', file=self.outFile)
         write(
-            '                stype_offset += sizeof(format::AddressEncodeType);',
+            '                stype_offset += ValueDecoder::DecodeAddress((parameter_buffer + stype_offset), (buffer_size - stype_offset), &address);',
             file=self.outFile
         )
         write('            }', file=self.outFile)
         write('        }', file=self.outFile)
         self.newline()
         write(
-            '        if ((stype_offset != 0) && ((buffer_size - stype_offset) >= sizeof(VkStructureType)))',
+            '        VkStructureType sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;',
             file=self.outFile
         )
-        write('        {', file=self.outFile)
+        self.newline()
         write(
-            '            const VkStructureType* sType = reinterpret_cast<const VkStructureType*>(parameter_buffer + stype_offset);',
+            '        if ((stype_offset != 0) && (ValueDecoder::DecodeEnumValue((parameter_buffer + stype_offset), (buffer_size - stype_offset), compact_encoding, &sType) != 0))',
             file=self.outFile
         )
-        self.newline()
-        write('            switch (*sType)', file=self.outFile)
+        write('        {', file=self.outFile)
+        write('            switch (sType)', file=self.outFile)
         write('            {', file=self.outFile)
         write('            default:', file=self.outFile)
         write(
@@ -168,7 +170,7 @@ class DecodePNextStructGenerator(BaseGenerator):
             file=self.outFile
         )
         write(
-            '                GFXRECON_LOG_ERROR("Failed to decode pNext value with unrecognized VkStructureType = %s", (util::ToString(*sType).c_str()));',
+            '                GFXRECON_LOG_ERROR("Failed to decode pNext value with unrecognized VkStructureType = %s", (util::ToString(sType).c_str()));',
             file=self.outFile
         )
         write('                break;', file=self.outFile)
@@ -230,7 +232,7 @@ class DecodePNextStructGenerator(BaseGenerator):
                 file=self.outFile
             )
             write(
-                '                bytes_read = (*pNext)->Decode(parameter_buffer, buffer_size);',
+                '                bytes_read = (*pNext)->Decode(parameter_buffer, buffer_size, compact_encoding);',
                 file=self.outFile
             )
             write('                break;', file=self.outFile)
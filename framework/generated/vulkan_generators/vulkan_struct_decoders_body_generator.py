@@ -94,7 +94,7 @@ class VulkanStructDecodersBodyGenerator(
         write('GFXRECON_BEGIN_NAMESPACE(decode)', file=self.outFile)
         self.newline()
         write(
-            'size_t DecodePNextStruct(const uint8_t* buffer, size_t buffer_size, PNextNode** pNext);',
+            'size_t DecodePNextStruct(const uint8_t* buffer, size_t buffer_size, bool compact_encoding, PNextNode** pNext);',
             file=self.outFile
         )
 
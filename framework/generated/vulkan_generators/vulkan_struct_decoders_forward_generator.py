@@ -108,7 +108,7 @@ class VulkanStructDecodersForwardGenerator(BaseGenerator):
 
         for struct in self.get_filtered_struct_names():
             write(
-                'size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, Decoded_{}* wrapper);'
+                'size_t DecodeStruct(const uint8_t* parameter_buffer, size_t buffer_size, bool compact_encoding, Decoded_{}* wrapper);'
                 .format(struct),
                 file=self.outFile
             )
@@ -1954,6 +1954,88 @@ VkResult VulkanResourcesUtil::ReadFromBufferResource(
     return result;
 }
 
+VkResult VulkanResourcesUtil::ReadFromBufferResources(const std::vector<BufferReadRegion>& regions,
+                                                      uint32_t                             queue_family_index,
+                                                      const BufferReadCallback&            callback)
+{
+    if (regions.empty())
+    {
+        return VK_SUCCESS;
+    }
+
+    const VkQueue queue = GetQueue(queue_family_index, 0);
+    if (queue == VK_NULL_HANDLE)
+    {
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    // Each region is copied to an aligned offset within the staging buffer.
+    std::vector<VkDeviceSize> staging_offsets;
+    VkDeviceSize              staging_size = 0;
+
+    staging_offsets.reserve(regions.size());
+
+    for (const auto& region : regions)
+    {
+        assert(region.buffer != VK_NULL_HANDLE);
+        assert(region.size);
+
+        staging_offsets.push_back(staging_size);
+        staging_size = (staging_size + region.size + kBufferReadAlignment - 1) & ~(kBufferReadAlignment - 1);
+    }
+
+    VkResult result = CreateStagingBuffer(staging_size);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    result = CreateCommandPool(queue_family_index);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    result = CreateCommandBuffer(queue_family_index);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    for (size_t i = 0; i < regions.size(); ++i)
+    {
+        VkBufferCopy copy_region;
+        copy_region.srcOffset = regions[i].offset;
+        copy_region.dstOffset = staging_offsets[i];
+        copy_region.size      = regions[i].size;
+
+        device_table_.CmdCopyBuffer(command_buffer_, regions[i].buffer, staging_buffer_.buffer, 1, &copy_region);
+    }
+
+    result = SubmitCommandBuffer(queue);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    result = MapStagingBuffer();
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    InvalidateStagingBuffer();
+
+    const uint8_t* staging_data = reinterpret_cast<const uint8_t*>(staging_buffer_.mapped_ptr);
+
+    for (size_t i = 0; i < regions.size(); ++i)
+    {
+        callback(i, staging_data + staging_offsets[i], regions[i].size);
+    }
+
+    return result;
+}
+
 VkResult VulkanResourcesUtil::WriteToImageResourceStaging(VkImage                      image,
                                                           VkFormat                     format,
                                                           VkImageType                  type,
@@ -30,6 +30,7 @@
 #include "vulkan/vulkan.h"
 #include "vulkan/vulkan_core.h"
 
+#include <functional>
 #include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -43,6 +44,22 @@ class VulkanResourcesUtil
         kImageToBuffer
     };
 
+  public:
+    // Alignment of each region in the staging buffer used by ReadFromBufferResources().
+    static const uint64_t kBufferReadAlignment = 256;
+
+    // Buffer range read by ReadFromBufferResources().
+    struct BufferReadRegion
+    {
+        VkBuffer buffer;
+        uint64_t size;
+        uint64_t offset;
+    };
+
+    // Called by ReadFromBufferResources() with the content of each region, in region order.  The data is only valid
+    // for the duration of the call.
+    typedef std::function<void(size_t region_index, const uint8_t* data, uint64_t size)> BufferReadCallback;
+
   public:
     VulkanResourcesUtil() = delete;
 
@@ -152,6 +169,12 @@ class VulkanResourcesUtil
     VkResult ReadFromBufferResource(
         VkBuffer buffer, uint64_t size, uint64_t offset, uint32_t queue_family_index, std::vector<uint8_t>& data);
 
+    // Dumps the content of multiple buffer resources with a single queue submission, copying all regions to the
+    // staging buffer before passing the content of each region to the callback.
+    VkResult ReadFromBufferResources(const std::vector<BufferReadRegion>& regions,
+                                     uint32_t                             queue_family_index,
+                                     const BufferReadCallback&            callback);
+
     bool IsBlitSupported(VkFormat       src_format,
                          VkImageTiling  src_image_tiling,
                          VkFormat       dst_format,
@@ -0,0 +1,116 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/chunked_buffer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+std::unique_ptr<uint8_t[]> ChunkedBufferPool::Acquire(size_t size, size_t* capacity)
+{
+    assert(capacity != nullptr);
+
+    if (size > chunk_size_)
+    {
+        // Records that do not fit in a chunk get a chunk of their own, which is not reused.
+        (*capacity) = size;
+        return std::make_unique<uint8_t[]>(size);
+    }
+
+    (*capacity) = chunk_size_;
+
+    if (free_chunks_.empty())
+    {
+        return std::make_unique<uint8_t[]>(chunk_size_);
+    }
+
+    std::unique_ptr<uint8_t[]> chunk = std::move(free_chunks_.back());
+    free_chunks_.pop_back();
+
+    return chunk;
+}
+
+void ChunkedBufferPool::Release(std::unique_ptr<uint8_t[]> chunk, size_t capacity)
+{
+    if ((chunk != nullptr) && (capacity == chunk_size_))
+    {
+        free_chunks_.push_back(std::move(chunk));
+    }
+}
+
+uint8_t* ChunkedBuffer::Reserve(size_t size)
+{
+    if (chunks_.empty() || ((chunks_.back().capacity - chunks_.back().size) < size))
+    {
+        Chunk chunk;
+
+        if (pool_ != nullptr)
+        {
+            chunk.data = pool_->Acquire(size, &chunk.capacity);
+        }
+        else
+        {
+            chunk.capacity = std::max(size, ChunkedBufferPool::kDefaultChunkSize);
+            chunk.data     = std::make_unique<uint8_t[]>(chunk.capacity);
+        }
+
+        chunks_.emplace_back(std::move(chunk));
+    }
+
+    Chunk&   chunk  = chunks_.back();
+    uint8_t* result = chunk.data.get() + chunk.size;
+
+    chunk.size += size;
+    data_size_ += size;
+
+    return result;
+}
+
+void ChunkedBuffer::Write(const void* data, size_t size)
+{
+    if (size > 0)
+    {
+        std::memcpy(Reserve(size), data, size);
+    }
+}
+
+void ChunkedBuffer::Clear()
+{
+    if (pool_ != nullptr)
+    {
+        for (auto& chunk : chunks_)
+        {
+            pool_->Release(std::move(chunk.data), chunk.capacity);
+        }
+    }
+
+    // The chunk list keeps its capacity, so that the buffer can be refilled without allocating it again.
+    chunks_.clear();
+    data_size_ = 0;
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
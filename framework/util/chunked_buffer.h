@@ -0,0 +1,118 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_CHUNKED_BUFFER_H
+#define GFXRECON_UTIL_CHUNKED_BUFFER_H
+
+#include "util/defines.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Fixed size memory chunks that are shared by the ChunkedBuffers of one owner, such as the command buffers of a command
+// pool. Chunks that are released by a buffer are kept for reuse until Trim() is called or the pool is destroyed. The
+// pool is not thread safe, and must be externally synchronized with the buffers that use it.
+class ChunkedBufferPool
+{
+  public:
+    static constexpr size_t kDefaultChunkSize = 16 * 1024;
+
+  public:
+    ChunkedBufferPool(size_t chunk_size = kDefaultChunkSize) : chunk_size_(chunk_size) {}
+
+    size_t GetChunkSize() const { return chunk_size_; }
+
+    // Returns a chunk of at least size bytes, which is a reused chunk when size is not larger than the chunk size.
+    std::unique_ptr<uint8_t[]> Acquire(size_t size, size_t* capacity);
+
+    // Keeps chunks of the pool's chunk size for reuse, and frees larger chunks.
+    void Release(std::unique_ptr<uint8_t[]> chunk, size_t capacity);
+
+    // Frees the chunks that are not in use.
+    void Trim() { free_chunks_.clear(); }
+
+    size_t GetFreeChunkCount() const { return free_chunks_.size(); }
+
+  private:
+    const size_t                            chunk_size_;
+    std::vector<std::unique_ptr<uint8_t[]>> free_chunks_;
+};
+
+// Append-only storage for variable size records, in a list of chunks from a ChunkedBufferPool. Unlike a
+// MemoryOutputStream, appending never copies data that has already been written, and clearing the buffer returns its
+// memory to the pool instead of keeping it with the buffer. Each call to Reserve() or Write() uses contiguous memory,
+// so a record that is written with one call can be read in place from a single chunk.
+class ChunkedBuffer
+{
+  public:
+    struct Chunk
+    {
+        std::unique_ptr<uint8_t[]> data;
+        size_t                     capacity{ 0 };
+        size_t                     size{ 0 };
+    };
+
+  public:
+    // Buffers without a pool allocate chunks of ChunkedBufferPool::kDefaultChunkSize bytes, and free them when cleared.
+    ChunkedBuffer() {}
+
+    ~ChunkedBuffer() { Clear(); }
+
+    ChunkedBuffer(const ChunkedBuffer&) = delete;
+
+    ChunkedBuffer& operator=(const ChunkedBuffer&) = delete;
+
+    // Sets the pool that chunks are acquired from and released to. Must be called while the buffer is empty.
+    void SetPool(std::shared_ptr<ChunkedBufferPool> pool)
+    {
+        assert(chunks_.empty());
+        pool_ = std::move(pool);
+    }
+
+    // Returns size bytes of contiguous memory at the end of the buffer, for the caller to fill.
+    uint8_t* Reserve(size_t size);
+
+    void Write(const void* data, size_t size);
+
+    // Releases all chunks to the pool.
+    void Clear();
+
+    size_t GetDataSize() const { return data_size_; }
+
+    const std::vector<Chunk>& GetChunks() const { return chunks_; }
+
+  private:
+    std::shared_ptr<ChunkedBufferPool> pool_;
+    std::vector<Chunk>                 chunks_;
+    size_t                             data_size_{ 0 };
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_CHUNKED_BUFFER_H
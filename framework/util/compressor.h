@@ -33,6 +33,9 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
+// Compression level that selects the level each compressor uses by default.
+const int32_t kDefaultCompressionLevel = 0;
+
 class Compressor
 {
   public:
@@ -46,10 +49,26 @@ class Compressor
                             std::vector<uint8_t>* compressed_data,
                             size_t                compressed_data_offset) = 0;
 
-    virtual size_t Decompress(const size_t                compressed_size,
-                              const std::vector<uint8_t>& compressed_data,
-                              const size_t                expected_uncompressed_size,
-                              std::vector<uint8_t>*       uncompressed_data) = 0;
+    // uncompressed_data must be large enough to hold expected_uncompressed_size bytes.
+    virtual size_t Decompress(const size_t   compressed_size,
+                              const uint8_t* compressed_data,
+                              const size_t   expected_uncompressed_size,
+                              uint8_t*       uncompressed_data) = 0;
+
+    // uncompressed_data must already be sized to hold expected_uncompressed_size bytes.
+    size_t Decompress(const size_t                compressed_size,
+                      const std::vector<uint8_t>& compressed_data,
+                      const size_t                expected_uncompressed_size,
+                      std::vector<uint8_t>*       uncompressed_data)
+    {
+        if (nullptr == uncompressed_data)
+        {
+            return 0;
+        }
+
+        return Decompress(
+            compressed_size, compressed_data.data(), expected_uncompressed_size, uncompressed_data->data());
+    }
 };
 
 GFXRECON_END_NAMESPACE(util)
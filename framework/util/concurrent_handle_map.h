@@ -0,0 +1,355 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_CONCURRENT_HANDLE_MAP_H
+#define GFXRECON_UTIL_CONCURRENT_HANDLE_MAP_H
+
+#include "util/defines.h"
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Maps non-zero 64-bit handle values or handle IDs to pointers, for tables that are read from many threads.
+//
+// Keys are hashed to one of kShardCount shards, each of which is an open addressing table with its own mutex for
+// inserts and removals. Find() does not take a lock or write to shared memory: it probes the current table of the shard
+// and retries if an insert compacted that table in place while it was reading. A shard that grows replaces its table,
+// and replaced tables are kept until the map is destroyed so that a concurrent Find() never reads freed memory. Their
+// total size is less than the size of the current table.
+//
+// Removing a key leaves its slot in place with a null value, so that probes continue past it. The slot is reused when
+// the same key is inserted again, which is common for handle values, and removed slots are reclaimed when the shard
+// runs out of free slots.
+template <typename T>
+class ConcurrentHandleMap
+{
+  public:
+    ConcurrentHandleMap() {}
+
+    ConcurrentHandleMap(const ConcurrentHandleMap&) = delete;
+
+    ConcurrentHandleMap& operator=(const ConcurrentHandleMap&) = delete;
+
+    // Returns false, without replacing the existing value, when the key is already in the map.
+    bool Insert(uint64_t key, T* value)
+    {
+        assert((key != 0) && (value != nullptr));
+
+        const uint64_t              hash  = Hash(key);
+        Shard&                      shard = shards_[hash & (kShardCount - 1)];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        Table* table = shard.table.load(std::memory_order_relaxed);
+
+        if (table != nullptr)
+        {
+            Slot* slot = FindSlot(table, key, hash);
+
+            if (slot != nullptr)
+            {
+                if (slot->value.load(std::memory_order_relaxed) != nullptr)
+                {
+                    return false;
+                }
+
+                slot->value.store(value, std::memory_order_release);
+                ++shard.live;
+                return true;
+            }
+        }
+
+        if ((table == nullptr) || (((shard.used + 1) * 4) > (table->capacity * 3)))
+        {
+            table = Rebuild(&shard, table);
+        }
+
+        // The value is stored before the key, so that a lookup that finds the key also finds the value.
+        Slot* slot = FindFreeSlot(table, hash);
+        slot->value.store(value, std::memory_order_relaxed);
+        slot->key.store(key, std::memory_order_release);
+
+        ++shard.used;
+        ++shard.live;
+
+        return true;
+    }
+
+    // Returns false when the key is not in the map.
+    bool Remove(uint64_t key)
+    {
+        const uint64_t              hash  = Hash(key);
+        Shard&                      shard = shards_[hash & (kShardCount - 1)];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        Table* table = shard.table.load(std::memory_order_relaxed);
+        Slot*  slot  = (table != nullptr) ? FindSlot(table, key, hash) : nullptr;
+
+        if ((slot == nullptr) || (slot->value.load(std::memory_order_relaxed) == nullptr))
+        {
+            return false;
+        }
+
+        slot->value.store(nullptr, std::memory_order_release);
+        --shard.live;
+
+        return true;
+    }
+
+    T* Find(uint64_t key) const
+    {
+        const uint64_t hash  = Hash(key);
+        const Shard&   shard = shards_[hash & (kShardCount - 1)];
+
+        for (;;)
+        {
+            const uint32_t sequence = shard.sequence.load(std::memory_order_acquire);
+
+            if ((sequence & 1) == 0)
+            {
+                T* value = Probe(shard.table.load(std::memory_order_acquire), key, hash);
+
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (shard.sequence.load(std::memory_order_relaxed) == sequence)
+                {
+                    return value;
+                }
+            }
+
+            std::this_thread::yield();
+        }
+    }
+
+    // Calls visitor(key, value) for each entry, in no particular order. Each shard is locked while its entries are
+    // visited, so the visitor must not insert or remove entries.
+    template <typename Visitor>
+    void Visit(Visitor visitor) const
+    {
+        for (const Shard& shard : shards_)
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+
+            const Table* table = shard.table.load(std::memory_order_relaxed);
+
+            if (table != nullptr)
+            {
+                for (size_t i = 0; i < table->capacity; ++i)
+                {
+                    T* value = table->slots[i].value.load(std::memory_order_relaxed);
+
+                    if (value != nullptr)
+                    {
+                        visitor(table->slots[i].key.load(std::memory_order_relaxed), value);
+                    }
+                }
+            }
+        }
+    }
+
+  private:
+    static const size_t kShardBits       = 4;
+    static const size_t kShardCount      = size_t{ 1 } << kShardBits;
+    static const size_t kInitialCapacity = 16;
+
+    struct Slot
+    {
+        std::atomic<uint64_t> key{ 0 };
+        std::atomic<T*>       value{ nullptr };
+    };
+
+    struct Table
+    {
+        explicit Table(size_t slot_count) : capacity(slot_count), slots(new Slot[slot_count]) {}
+
+        const size_t            capacity;
+        std::unique_ptr<Slot[]> slots;
+    };
+
+    // Shards are kept on separate cache lines, so that inserts into one shard do not slow down lookups in another.
+    struct alignas(64) Shard
+    {
+        mutable std::mutex                  mutex;
+        std::atomic<uint32_t>               sequence{ 0 }; // Odd while entries are moved within the current table.
+        std::atomic<Table*>                 table{ nullptr };
+        size_t                              used{ 0 }; // Slots with a key, including removed entries.
+        size_t                              live{ 0 }; // Slots with a value.
+        std::vector<std::unique_ptr<Table>> tables;    // The current table and the tables that it replaced.
+    };
+
+  private:
+    static uint64_t Hash(uint64_t key)
+    {
+        // Mixes the low bits of handle values, which are often aligned addresses, and of sequential handle IDs.
+        key ^= key >> 33;
+        key *= 0xff51afd7ed558ccdull;
+        key ^= key >> 33;
+        return key;
+    }
+
+    static size_t GetStartIndex(const Table* table, uint64_t hash)
+    {
+        return static_cast<size_t>(hash >> kShardBits) & (table->capacity - 1);
+    }
+
+    static T* Probe(const Table* table, uint64_t key, uint64_t hash)
+    {
+        if (table != nullptr)
+        {
+            const size_t mask  = table->capacity - 1;
+            size_t       index = GetStartIndex(table, hash);
+
+            for (size_t i = 0; i < table->capacity; ++i, index = (index + 1) & mask)
+            {
+                const uint64_t slot_key = table->slots[index].key.load(std::memory_order_acquire);
+
+                if (slot_key == key)
+                {
+                    return table->slots[index].value.load(std::memory_order_acquire);
+                }
+                else if (slot_key == 0)
+                {
+                    break;
+                }
+            }
+        }
+
+        return nullptr;
+    }
+
+    // Returns the slot that holds the key, which may have been removed, or nullptr. Requires the shard mutex.
+    static Slot* FindSlot(Table* table, uint64_t key, uint64_t hash)
+    {
+        const size_t mask  = table->capacity - 1;
+        size_t       index = GetStartIndex(table, hash);
+
+        for (size_t i = 0; i < table->capacity; ++i, index = (index + 1) & mask)
+        {
+            const uint64_t slot_key = table->slots[index].key.load(std::memory_order_relaxed);
+
+            if (slot_key == key)
+            {
+                return &table->slots[index];
+            }
+            else if (slot_key == 0)
+            {
+                break;
+            }
+        }
+
+        return nullptr;
+    }
+
+    // Requires the shard mutex, and a table with at least one slot that has never held a key.
+    static Slot* FindFreeSlot(Table* table, uint64_t hash)
+    {
+        const size_t mask  = table->capacity - 1;
+        size_t       index = GetStartIndex(table, hash);
+
+        while (table->slots[index].key.load(std::memory_order_relaxed) != 0)
+        {
+            index = (index + 1) & mask;
+        }
+
+        return &table->slots[index];
+    }
+
+    // Makes room for an insert, by replacing the table with a larger one when at least half of the slots hold values,
+    // or by moving the values within the table to reclaim the slots of removed entries. Requires the shard mutex.
+    Table* Rebuild(Shard* shard, Table* table)
+    {
+        std::vector<std::pair<uint64_t, T*>> entries;
+        entries.reserve(shard->live);
+
+        if (table != nullptr)
+        {
+            for (size_t i = 0; i < table->capacity; ++i)
+            {
+                T* value = table->slots[i].value.load(std::memory_order_relaxed);
+
+                if (value != nullptr)
+                {
+                    entries.emplace_back(table->slots[i].key.load(std::memory_order_relaxed), value);
+                }
+            }
+        }
+
+        if ((table == nullptr) || (((shard->live + 1) * 2) > table->capacity))
+        {
+            auto new_table = std::make_unique<Table>((table == nullptr) ? kInitialCapacity : (table->capacity * 2));
+
+            for (const auto& entry : entries)
+            {
+                Slot* slot = FindFreeSlot(new_table.get(), Hash(entry.first));
+                slot->key.store(entry.first, std::memory_order_relaxed);
+                slot->value.store(entry.second, std::memory_order_relaxed);
+            }
+
+            table = new_table.get();
+            shard->tables.push_back(std::move(new_table));
+            shard->table.store(table, std::memory_order_release);
+        }
+        else
+        {
+            // Lookups that overlap with the move see an odd or changed sequence number, and retry.
+            const uint32_t sequence = shard->sequence.load(std::memory_order_relaxed);
+            shard->sequence.store(sequence + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+
+            for (size_t i = 0; i < table->capacity; ++i)
+            {
+                table->slots[i].key.store(0, std::memory_order_relaxed);
+                table->slots[i].value.store(nullptr, std::memory_order_relaxed);
+            }
+
+            for (const auto& entry : entries)
+            {
+                Slot* slot = FindFreeSlot(table, Hash(entry.first));
+                slot->key.store(entry.first, std::memory_order_relaxed);
+                slot->value.store(entry.second, std::memory_order_relaxed);
+            }
+
+            shard->sequence.store(sequence + 2, std::memory_order_release);
+        }
+
+        shard->used = shard->live;
+
+        return table;
+    }
+
+  private:
+    std::array<Shard, kShardCount> shards_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_CONCURRENT_HANDLE_MAP_H
@@ -0,0 +1,93 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/content_deduplicator.h"
+
+#include "util/hash.h"
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Seed for the second hash, which makes it unlikely for data with matching sizes and hashes to differ.
+const uint64_t kCheckHashSeed = 0x9e3779b97f4a7c15ull;
+
+ContentDeduplicator::ContentDeduplicator(uint64_t max_stored_size) :
+    max_stored_size_(max_stored_size), stored_size_(0), next_content_id_(1), first_content_id_(1)
+{}
+
+ContentDeduplicator::ContentKey ContentDeduplicator::ComputeKey(const void* data, size_t size)
+{
+    return { size, hash::XxHash64(data, size), hash::XxHash64(data, size, kCheckHashSeed) };
+}
+
+bool ContentDeduplicator::Find(const ContentKey& key, uint64_t* content_id) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto entry = content_ids_.find(key);
+    if (entry != content_ids_.end())
+    {
+        *content_id = entry->second;
+        return true;
+    }
+
+    return false;
+}
+
+bool ContentDeduplicator::Reserve(uint64_t size, uint64_t* content_id)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (size <= (max_stored_size_ - stored_size_))
+    {
+        stored_size_ += size;
+
+        *content_id = next_content_id_++;
+        return true;
+    }
+
+    return false;
+}
+
+void ContentDeduplicator::Add(const ContentKey& key, uint64_t content_id)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (content_id >= first_content_id_)
+    {
+        // When two threads store the same data, the first ID to be added is kept.
+        content_ids_.emplace(key, content_id);
+    }
+}
+
+void ContentDeduplicator::Reset()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    content_ids_.clear();
+    stored_size_      = 0;
+    first_content_id_ = next_content_id_;
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
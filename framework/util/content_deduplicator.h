@@ -0,0 +1,101 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef GFXRECON_UTIL_CONTENT_DEDUPLICATOR_H
+#define GFXRECON_UTIL_CONTENT_DEDUPLICATOR_H
+
+#include "util/defines.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Assigns IDs to the data written to a capture file, so that data that is written more than once can be stored in the
+// file once and referenced by ID.  Data is identified by its size and two 64-bit hashes computed with different seeds.
+// The total size of the stored data is limited, because a file reader keeps all stored data until the end of the file.
+// All methods are thread safe.
+class ContentDeduplicator
+{
+  public:
+    // Smaller data is not stored, because it is about the same size as the block header that references it.
+    static const size_t kMinContentSize = 256;
+
+    struct ContentKey
+    {
+        uint64_t size;
+        uint64_t hash;
+        uint64_t check_hash;
+    };
+
+  public:
+    ContentDeduplicator(uint64_t max_stored_size);
+
+    bool IsCandidate(size_t size) const { return (size >= kMinContentSize) && (size <= max_stored_size_); }
+
+    static ContentKey ComputeKey(const void* data, size_t size);
+
+    // Returns true and the ID of the stored data when data with a matching key has been added.
+    bool Find(const ContentKey& key, uint64_t* content_id) const;
+
+    // Reserves storage and an ID for new data.  Returns false when storing the data would exceed the size limit.  The
+    // data must be written to the file with the reserved ID before Add() is called.
+    bool Reserve(uint64_t size, uint64_t* content_id);
+
+    // Makes data that has been written to the file available to Find().  Data reserved before the last call to Reset()
+    // is ignored.
+    void Add(const ContentKey& key, uint64_t content_id);
+
+    // Removes all stored data, for the start of a new capture file.  IDs are not reused.
+    void Reset();
+
+  private:
+    struct ContentKeyHash
+    {
+        size_t operator()(const ContentKey& key) const { return static_cast<size_t>(key.hash); }
+    };
+
+    struct ContentKeyEqual
+    {
+        bool operator()(const ContentKey& lhs, const ContentKey& rhs) const
+        {
+            return (lhs.size == rhs.size) && (lhs.hash == rhs.hash) && (lhs.check_hash == rhs.check_hash);
+        }
+    };
+
+  private:
+    const uint64_t                                                            max_stored_size_;
+    mutable std::mutex                                                        mutex_;
+    std::unordered_map<ContentKey, uint64_t, ContentKeyHash, ContentKeyEqual> content_ids_;
+    uint64_t                                                                  stored_size_;
+    uint64_t                                                                  next_content_id_;
+    uint64_t                                                                  first_content_id_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_CONTENT_DEDUPLICATOR_H
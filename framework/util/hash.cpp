@@ -0,0 +1,140 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/hash.h"
+
+#include <cstring>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(hash)
+
+static const uint64_t kXxPrime1 = 0x9E3779B185EBCA87ULL;
+static const uint64_t kXxPrime2 = 0xC2B2AE3D27D4EB4FULL;
+static const uint64_t kXxPrime3 = 0x165667B19E3779F9ULL;
+static const uint64_t kXxPrime4 = 0x85EBCA77C2B2AE63ULL;
+static const uint64_t kXxPrime5 = 0x27D4EB2F165667C5ULL;
+
+static inline uint64_t RotateLeft(uint64_t value, uint32_t count)
+{
+    return (value << count) | (value >> (64 - count));
+}
+
+static inline uint64_t Read64(const uint8_t* data)
+{
+    // Unaligned little-endian read; memcpy compiles to a single load on supported platforms.
+    uint64_t value;
+    memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+static inline uint32_t Read32(const uint8_t* data)
+{
+    uint32_t value;
+    memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+static inline uint64_t XxRound(uint64_t accumulator, uint64_t input)
+{
+    accumulator += input * kXxPrime2;
+    accumulator = RotateLeft(accumulator, 31);
+    return accumulator * kXxPrime1;
+}
+
+static inline uint64_t XxMergeRound(uint64_t accumulator, uint64_t value)
+{
+    accumulator ^= XxRound(0, value);
+    return (accumulator * kXxPrime1) + kXxPrime4;
+}
+
+uint64_t XxHash64(const void* data, size_t size, uint64_t seed)
+{
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    const uint8_t* end   = bytes + size;
+    uint64_t       hash  = 0;
+
+    if (size >= 32)
+    {
+        const uint8_t* stripe_end = end - 32;
+
+        uint64_t v1 = seed + kXxPrime1 + kXxPrime2;
+        uint64_t v2 = seed + kXxPrime2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - kXxPrime1;
+
+        do
+        {
+            v1 = XxRound(v1, Read64(bytes));
+            v2 = XxRound(v2, Read64(bytes + 8));
+            v3 = XxRound(v3, Read64(bytes + 16));
+            v4 = XxRound(v4, Read64(bytes + 24));
+            bytes += 32;
+        } while (bytes <= stripe_end);
+
+        hash = RotateLeft(v1, 1) + RotateLeft(v2, 7) + RotateLeft(v3, 12) + RotateLeft(v4, 18);
+        hash = XxMergeRound(hash, v1);
+        hash = XxMergeRound(hash, v2);
+        hash = XxMergeRound(hash, v3);
+        hash = XxMergeRound(hash, v4);
+    }
+    else
+    {
+        hash = seed + kXxPrime5;
+    }
+
+    hash += static_cast<uint64_t>(size);
+
+    while ((bytes + 8) <= end)
+    {
+        hash ^= XxRound(0, Read64(bytes));
+        hash = (RotateLeft(hash, 27) * kXxPrime1) + kXxPrime4;
+        bytes += 8;
+    }
+
+    if ((bytes + 4) <= end)
+    {
+        hash ^= static_cast<uint64_t>(Read32(bytes)) * kXxPrime1;
+        hash = (RotateLeft(hash, 23) * kXxPrime2) + kXxPrime3;
+        bytes += 4;
+    }
+
+    while (bytes < end)
+    {
+        hash ^= static_cast<uint64_t>(*bytes) * kXxPrime5;
+        hash = RotateLeft(hash, 11) * kXxPrime1;
+        ++bytes;
+    }
+
+    // Final avalanche.
+    hash ^= hash >> 33;
+    hash *= kXxPrime2;
+    hash ^= hash >> 29;
+    hash *= kXxPrime3;
+    hash ^= hash >> 32;
+
+    return hash;
+}
+
+GFXRECON_END_NAMESPACE(hash)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
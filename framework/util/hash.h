@@ -26,6 +26,7 @@
 #include "util/defines.h"
 
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -98,6 +99,19 @@ std::size_t hash_range(It first, It last)
     return seed;
 }
 
+/**
+ * @brief       XxHash64 computes the 64-bit xxHash (XXH64) of a block of memory.
+ *
+ * Processes 32 bytes per iteration with four independent accumulators, making it suitable for hashing large memory
+ * ranges, such as the pages of mapped memory.
+ *
+ * @param   data    pointer to the data to hash
+ * @param   size    size of the data in bytes
+ * @param   seed    an optional seed
+ * @return  the 64-bit hash value
+ */
+uint64_t XxHash64(const void* data, size_t size, uint64_t seed = 0);
+
 GFXRECON_END_NAMESPACE(hash)
 GFXRECON_END_NAMESPACE(util)
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,624 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+/// @file Writing JSON text token by token, without building a tree in memory.
+
+#include "util/json_stream_writer.h"
+#include "util/logging.h"
+
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Decimal exponents outside of the range (kMinDecimalExponent, kMaxDecimalExponent] are written in exponent notation,
+// as nlohmann::json writes doubles.
+static constexpr int kMinDecimalExponent = -4;
+static constexpr int kMaxDecimalExponent = 15;
+
+// Doubles are converted to decimal digits with the Grisu2 algorithm from "Printing Floating-Point Numbers Quickly and
+// Accurately with Integers" by Florian Loitsch, which nlohmann::json also uses.  The digits always read back as the
+// same double and are usually, but not always, the fewest digits that do, so other shortest conversions such as
+// std::to_chars would not reproduce dump() output.
+
+// A floating point number f * 2^e with a 64-bit significand.
+struct DiyFp
+{
+    uint64_t f;
+    int      e;
+};
+
+// A normalized approximation f * 2^e of 10^k.
+struct CachedPower
+{
+    uint64_t f;
+    int      e;
+    int      k;
+};
+
+// The scaled value that digits are generated from has a binary exponent in the range [kAlpha, kGamma].
+static constexpr int kAlpha = -60;
+static constexpr int kGamma = -32;
+
+static constexpr int kCachedPowersMinDecimalExponent = -300;
+static constexpr int kCachedPowersDecimalStep        = 8;
+
+// Powers of ten from 10^-300 to 10^324 in steps of 8, rounded to 64 bits.
+static constexpr CachedPower kCachedPowers[] = {
+    { 0xAB70FE17C79AC6CA, -1060, -300 },
+    { 0xFF77B1FCBEBCDC4F, -1034, -292 },
+    { 0xBE5691EF416BD60C, -1007, -284 },
+    { 0x8DD01FAD907FFC3C, -980, -276 },
+    { 0xD3515C2831559A83, -954, -268 },
+    { 0x9D71AC8FADA6C9B5, -927, -260 },
+    { 0xEA9C227723EE8BCB, -901, -252 },
+    { 0xAECC49914078536D, -874, -244 },
+    { 0x823C12795DB6CE57, -847, -236 },
+    { 0xC21094364DFB5637, -821, -228 },
+    { 0x9096EA6F3848984F, -794, -220 },
+    { 0xD77485CB25823AC7, -768, -212 },
+    { 0xA086CFCD97BF97F4, -741, -204 },
+    { 0xEF340A98172AACE5, -715, -196 },
+    { 0xB23867FB2A35B28E, -688, -188 },
+    { 0x84C8D4DFD2C63F3B, -661, -180 },
+    { 0xC5DD44271AD3CDBA, -635, -172 },
+    { 0x936B9FCEBB25C996, -608, -164 },
+    { 0xDBAC6C247D62A584, -582, -156 },
+    { 0xA3AB66580D5FDAF6, -555, -148 },
+    { 0xF3E2F893DEC3F126, -529, -140 },
+    { 0xB5B5ADA8AAFF80B8, -502, -132 },
+    { 0x87625F056C7C4A8B, -475, -124 },
+    { 0xC9BCFF6034C13053, -449, -116 },
+    { 0x964E858C91BA2655, -422, -108 },
+    { 0xDFF9772470297EBD, -396, -100 },
+    { 0xA6DFBD9FB8E5B88F, -369, -92 },
+    { 0xF8A95FCF88747D94, -343, -84 },
+    { 0xB94470938FA89BCF, -316, -76 },
+    { 0x8A08F0F8BF0F156B, -289, -68 },
+    { 0xCDB02555653131B6, -263, -60 },
+    { 0x993FE2C6D07B7FAC, -236, -52 },
+    { 0xE45C10C42A2B3B06, -210, -44 },
+    { 0xAA242499697392D3, -183, -36 },
+    { 0xFD87B5F28300CA0E, -157, -28 },
+    { 0xBCE5086492111AEB, -130, -20 },
+    { 0x8CBCCC096F5088CC, -103, -12 },
+    { 0xD1B71758E219652C, -77, -4 },
+    { 0x9C40000000000000, -50, 4 },
+    { 0xE8D4A51000000000, -24, 12 },
+    { 0xAD78EBC5AC620000, 3, 20 },
+    { 0x813F3978F8940984, 30, 28 },
+    { 0xC097CE7BC90715B3, 56, 36 },
+    { 0x8F7E32CE7BEA5C70, 83, 44 },
+    { 0xD5D238A4ABE98068, 109, 52 },
+    { 0x9F4F2726179A2245, 136, 60 },
+    { 0xED63A231D4C4FB27, 162, 68 },
+    { 0xB0DE65388CC8ADA8, 189, 76 },
+    { 0x83C7088E1AAB65DB, 216, 84 },
+    { 0xC45D1DF942711D9A, 242, 92 },
+    { 0x924D692CA61BE758, 269, 100 },
+    { 0xDA01EE641A708DEA, 295, 108 },
+    { 0xA26DA3999AEF774A, 322, 116 },
+    { 0xF209787BB47D6B85, 348, 124 },
+    { 0xB454E4A179DD1877, 375, 132 },
+    { 0x865B86925B9BC5C2, 402, 140 },
+    { 0xC83553C5C8965D3D, 428, 148 },
+    { 0x952AB45CFA97A0B3, 455, 156 },
+    { 0xDE469FBD99A05FE3, 481, 164 },
+    { 0xA59BC234DB398C25, 508, 172 },
+    { 0xF6C69A72A3989F5C, 534, 180 },
+    { 0xB7DCBF5354E9BECE, 561, 188 },
+    { 0x88FCF317F22241E2, 588, 196 },
+    { 0xCC20CE9BD35C78A5, 614, 204 },
+    { 0x98165AF37B2153DF, 641, 212 },
+    { 0xE2A0B5DC971F303A, 667, 220 },
+    { 0xA8D9D1535CE3B396, 694, 228 },
+    { 0xFB9B7CD9A4A7443C, 720, 236 },
+    { 0xBB764C4CA7A44410, 747, 244 },
+    { 0x8BAB8EEFB6409C1A, 774, 252 },
+    { 0xD01FEF10A657842C, 800, 260 },
+    { 0x9B10A4E5E9913129, 827, 268 },
+    { 0xE7109BFBA19C0C9D, 853, 276 },
+    { 0xAC2820D9623BF429, 880, 284 },
+    { 0x80444B5E7AA7CF85, 907, 292 },
+    { 0xBF21E44003ACDD2D, 933, 300 },
+    { 0x8E679C2F5E44FF8F, 960, 308 },
+    { 0xD433179D9C8CB841, 986, 316 },
+    { 0x9E19DB92B4E31BA9, 1013, 324 },
+};
+
+static DiyFp Subtract(const DiyFp& x, const DiyFp& y)
+{
+    GFXRECON_ASSERT((x.e == y.e) && (x.f >= y.f));
+    return { x.f - y.f, x.e };
+}
+
+// Returns the upper 64 bits of the 128-bit product, rounded.
+static DiyFp Multiply(const DiyFp& x, const DiyFp& y)
+{
+    const uint64_t x_lo = x.f & 0xffffffffu;
+    const uint64_t x_hi = x.f >> 32;
+    const uint64_t y_lo = y.f & 0xffffffffu;
+    const uint64_t y_hi = y.f >> 32;
+
+    const uint64_t p0 = x_lo * y_lo;
+    const uint64_t p1 = x_lo * y_hi;
+    const uint64_t p2 = x_hi * y_lo;
+    const uint64_t p3 = x_hi * y_hi;
+
+    uint64_t middle = (p0 >> 32) + (p1 & 0xffffffffu) + (p2 & 0xffffffffu);
+
+    // Round the lower 64 bits, with ties rounded up.
+    middle += uint64_t{ 1 } << 31;
+
+    return { p3 + (p2 >> 32) + (p1 >> 32) + (middle >> 32), x.e + y.e + 64 };
+}
+
+static DiyFp Normalize(DiyFp x)
+{
+    GFXRECON_ASSERT(x.f != 0);
+
+    while ((x.f >> 63) == 0)
+    {
+        x.f <<= 1;
+        --x.e;
+    }
+
+    return x;
+}
+
+// Converts a positive, finite double to digits and a decimal exponent such that value is approximately
+// digits * 10^exponent.  Returns the number of digits.
+static size_t GetShortestDigits(double value, char (&digits)[32], int* exponent)
+{
+    GFXRECON_ASSERT(std::isfinite(value) && (value > 0));
+
+    constexpr int      kSignificandBits = 52;
+    constexpr int      kExponentBias    = 1023 + kSignificandBits;
+    constexpr uint64_t kHiddenBit       = uint64_t{ 1 } << kSignificandBits;
+
+    uint64_t bits = 0;
+    memcpy(&bits, &value, sizeof(bits));
+
+    const uint64_t significand     = bits & (kHiddenBit - 1);
+    const int      biased_exponent = static_cast<int>(bits >> kSignificandBits);
+
+    const DiyFp v = (biased_exponent == 0) ? DiyFp{ significand, 1 - kExponentBias }
+                                           : DiyFp{ significand + kHiddenBit, biased_exponent - kExponentBias };
+
+    // The boundaries are halfway between value and its neighbours, and the lower neighbour is closer when value is a
+    // power of two.
+    const bool  lower_is_closer = (significand == 0) && (biased_exponent > 1);
+    const DiyFp upper           = Normalize({ (v.f << 1) + 1, v.e - 1 });
+    DiyFp       lower = lower_is_closer ? DiyFp{ (v.f << 2) - 1, v.e - 2 } : DiyFp{ (v.f << 1) - 1, v.e - 1 };
+
+    lower.f <<= (lower.e - upper.e);
+    lower.e = upper.e;
+
+    // Scale by a cached power of ten so that the upper boundary has a binary exponent in [kAlpha, kGamma].
+    const int f     = kAlpha - upper.e - 1;
+    const int k     = ((f * 78913) / (1 << 18)) + static_cast<int>(f > 0);
+    const int index = (-kCachedPowersMinDecimalExponent + k + (kCachedPowersDecimalStep - 1)) /
+                      kCachedPowersDecimalStep;
+
+    const CachedPower& cached = kCachedPowers[index];
+    const DiyFp        scale  = { cached.f, cached.e };
+    const DiyFp        w      = Multiply(Normalize(v), scale);
+    DiyFp              minus  = Multiply(lower, scale);
+    DiyFp              plus   = Multiply(upper, scale);
+
+    GFXRECON_ASSERT((plus.e >= kAlpha) && (plus.e <= kGamma));
+
+    // Shrink the interval to account for the rounding of the products.
+    minus.f += 1;
+    plus.f -= 1;
+
+    *exponent = -cached.k;
+
+    // Generate digits from the upper boundary until the remainder is within the interval.
+    uint64_t       delta = Subtract(plus, minus).f;
+    uint64_t       dist  = Subtract(plus, w).f;
+    const int      shift = -plus.e;
+    const uint64_t one   = uint64_t{ 1 } << shift;
+
+    uint32_t integral   = static_cast<uint32_t>(plus.f >> shift);
+    uint64_t fractional = plus.f & (one - 1);
+
+    uint32_t power = 1;
+    int      count = 1;
+
+    while ((count < 10) && ((power * 10) <= integral))
+    {
+        power *= 10;
+        ++count;
+    }
+
+    size_t   length = 0;
+    uint64_t rest   = 0;
+    uint64_t unit   = 0;
+
+    for (int remaining = count; remaining > 0;)
+    {
+        digits[length++] = static_cast<char>('0' + (integral / power));
+        integral %= power;
+        --remaining;
+
+        rest = (static_cast<uint64_t>(integral) << shift) + fractional;
+
+        if (rest <= delta)
+        {
+            *exponent += remaining;
+            unit = static_cast<uint64_t>(power) << shift;
+            break;
+        }
+
+        power /= 10;
+    }
+
+    if (unit == 0)
+    {
+        for (;;)
+        {
+            fractional *= 10;
+            digits[length++] = static_cast<char>('0' + (fractional >> shift));
+            fractional &= (one - 1);
+            --*exponent;
+            delta *= 10;
+            dist *= 10;
+
+            if (fractional <= delta)
+            {
+                break;
+            }
+        }
+
+        rest = fractional;
+        unit = one;
+    }
+
+    // Move the last digit towards w while the result stays within the interval and gets closer to w.
+    while ((rest < dist) && ((delta - rest) >= unit) &&
+           (((rest + unit) < dist) || ((dist - rest) > (rest + unit - dist))))
+    {
+        --digits[length - 1];
+        rest += unit;
+    }
+
+    return length;
+}
+
+JsonStreamWriter::JsonStreamWriter(int indent_width) :
+    pretty_(indent_width >= 0), indent_width_(indent_width >= 0 ? static_cast<size_t>(indent_width) : 0)
+{}
+
+void JsonStreamWriter::BeginObject()
+{
+    BeginValue();
+    buffer_.push_back('{');
+    scopes_.push_back({ false, 0 });
+}
+
+void JsonStreamWriter::EndObject()
+{
+    GFXRECON_ASSERT(!scopes_.empty() && !scopes_.back().is_array);
+    EndScope('}');
+}
+
+void JsonStreamWriter::BeginArray()
+{
+    BeginValue();
+    buffer_.push_back('[');
+    scopes_.push_back({ true, 0 });
+}
+
+void JsonStreamWriter::EndArray()
+{
+    GFXRECON_ASSERT(!scopes_.empty() && scopes_.back().is_array);
+    EndScope(']');
+}
+
+void JsonStreamWriter::Key(std::string_view key)
+{
+    GFXRECON_ASSERT(!scopes_.empty() && !scopes_.back().is_array);
+    BeginEntry();
+    buffer_.push_back('"');
+    WriteEscaped(key);
+    buffer_.append(pretty_ ? "\": " : "\":");
+}
+
+void JsonStreamWriter::String(std::string_view value)
+{
+    BeginValue();
+    buffer_.push_back('"');
+    WriteEscaped(value);
+    buffer_.push_back('"');
+}
+
+void JsonStreamWriter::Int(int64_t value)
+{
+    char digits[24];
+    auto result = std::to_chars(digits, digits + sizeof(digits), value);
+
+    BeginValue();
+    buffer_.append(digits, result.ptr);
+}
+
+void JsonStreamWriter::UInt(uint64_t value)
+{
+    char digits[24];
+    auto result = std::to_chars(digits, digits + sizeof(digits), value);
+
+    BeginValue();
+    buffer_.append(digits, result.ptr);
+}
+
+void JsonStreamWriter::Bool(bool value)
+{
+    BeginValue();
+    buffer_.append(value ? "true" : "false");
+}
+
+void JsonStreamWriter::Null()
+{
+    BeginValue();
+    buffer_.append("null");
+}
+
+void JsonStreamWriter::Double(double value)
+{
+    BeginValue();
+
+    if (!std::isfinite(value))
+    {
+        buffer_.append("null");
+        return;
+    }
+
+    if (std::signbit(value))
+    {
+        buffer_.push_back('-');
+        value = -value;
+    }
+
+    if (value == 0)
+    {
+        buffer_.append("0.0");
+        return;
+    }
+
+    char   digits[32];
+    int    exponent = 0;
+    size_t count    = GetShortestDigits(value, digits, &exponent);
+
+    // Position of the decimal point relative to the first digit.
+    const int point = static_cast<int>(count) + exponent;
+
+    if ((exponent >= 0) && (point <= kMaxDecimalExponent))
+    {
+        // An integer, which is given a fraction to show that it is a floating point number.
+        buffer_.append(digits, count);
+        buffer_.append(static_cast<size_t>(exponent), '0');
+        buffer_.append(".0");
+    }
+    else if ((point > 0) && (point <= kMaxDecimalExponent))
+    {
+        buffer_.append(digits, static_cast<size_t>(point));
+        buffer_.push_back('.');
+        buffer_.append(digits + point, count - static_cast<size_t>(point));
+    }
+    else if ((point > kMinDecimalExponent) && (point <= 0))
+    {
+        buffer_.append("0.");
+        buffer_.append(static_cast<size_t>(-point), '0');
+        buffer_.append(digits, count);
+    }
+    else
+    {
+        buffer_.push_back(digits[0]);
+
+        if (count > 1)
+        {
+            buffer_.push_back('.');
+            buffer_.append(digits + 1, count - 1);
+        }
+
+        // The exponent has a sign and at least two digits, as printf writes it.
+        int decimal_exponent = point - 1;
+
+        buffer_.append(decimal_exponent < 0 ? "e-" : "e+");
+        decimal_exponent = std::abs(decimal_exponent);
+
+        if (decimal_exponent < 10)
+        {
+            buffer_.push_back('0');
+        }
+
+        char exponent_digits[8];
+        auto result = std::to_chars(exponent_digits, exponent_digits + sizeof(exponent_digits), decimal_exponent);
+        buffer_.append(exponent_digits, result.ptr);
+    }
+}
+
+void JsonStreamWriter::Value(const nlohmann::ordered_json& value)
+{
+    if (value.is_object())
+    {
+        BeginObject();
+        Members(value);
+        EndObject();
+    }
+    else if (value.is_array())
+    {
+        BeginArray();
+
+        for (const auto& element : value)
+        {
+            Value(element);
+        }
+
+        EndArray();
+    }
+    else if (value.is_string())
+    {
+        String(value.get_ref<const std::string&>());
+    }
+    else if (value.is_boolean())
+    {
+        Bool(value.get<bool>());
+    }
+    else if (value.is_number_unsigned())
+    {
+        UInt(value.get<uint64_t>());
+    }
+    else if (value.is_number_integer())
+    {
+        Int(value.get<int64_t>());
+    }
+    else if (value.is_number_float())
+    {
+        Double(value.get<double>());
+    }
+    else
+    {
+        // Binary values are not used for JSON output.
+        GFXRECON_ASSERT(value.is_null());
+        Null();
+    }
+}
+
+void JsonStreamWriter::Members(const nlohmann::ordered_json& object)
+{
+    if (object.is_object())
+    {
+        for (auto entry = object.cbegin(); entry != object.cend(); ++entry)
+        {
+            Key(entry.key());
+            Value(entry.value());
+        }
+    }
+}
+
+void JsonStreamWriter::BeginValue()
+{
+    // Object members have already been separated by Key().
+    if (!scopes_.empty() && scopes_.back().is_array)
+    {
+        BeginEntry();
+    }
+}
+
+void JsonStreamWriter::BeginEntry()
+{
+    Scope& scope = scopes_.back();
+
+    if (scope.count > 0)
+    {
+        buffer_.push_back(',');
+    }
+
+    if (pretty_)
+    {
+        buffer_.push_back('\n');
+        buffer_.append(CurrentIndent(), ' ');
+    }
+
+    ++scope.count;
+}
+
+void JsonStreamWriter::EndScope(char close)
+{
+    const size_t count = scopes_.back().count;
+    scopes_.pop_back();
+
+    // Empty containers are closed on the same line, as "{}" or "[]".
+    if (pretty_ && (count > 0))
+    {
+        buffer_.push_back('\n');
+        buffer_.append(CurrentIndent(), ' ');
+    }
+
+    buffer_.push_back(close);
+}
+
+void JsonStreamWriter::WriteEscaped(std::string_view text)
+{
+    size_t start = 0;
+
+    for (size_t i = 0; i < text.size(); ++i)
+    {
+        const auto  c      = static_cast<unsigned char>(text[i]);
+        const char* escape = nullptr;
+
+        switch (c)
+        {
+            case '"':
+                escape = "\\\"";
+                break;
+            case '\\':
+                escape = "\\\\";
+                break;
+            case '\b':
+                escape = "\\b";
+                break;
+            case '\f':
+                escape = "\\f";
+                break;
+            case '\n':
+                escape = "\\n";
+                break;
+            case '\r':
+                escape = "\\r";
+                break;
+            case '\t':
+                escape = "\\t";
+                break;
+            default:
+                break;
+        }
+
+        if ((escape != nullptr) || (c < 0x20))
+        {
+            buffer_.append(text.data() + start, i - start);
+            start = i + 1;
+
+            if (escape != nullptr)
+            {
+                buffer_.append(escape);
+            }
+            else
+            {
+                static const char kHexDigits[] = "0123456789abcdef";
+
+                buffer_.append("\\u00");
+                buffer_.push_back(kHexDigits[c >> 4]);
+                buffer_.push_back(kHexDigits[c & 0xf]);
+            }
+        }
+    }
+
+    buffer_.append(text.data() + start, text.size() - start);
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
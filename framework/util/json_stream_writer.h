@@ -0,0 +1,119 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+/// @file Writing JSON text token by token, without building a tree in memory.
+
+#ifndef GFXRECON_UTIL_JSON_STREAM_WRITER_H
+#define GFXRECON_UTIL_JSON_STREAM_WRITER_H
+
+#include "util/defines.h"
+
+#include "nlohmann/json.hpp"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+/// @brief Writes JSON tokens into a buffer that is reused after its contents
+/// have been handed to an OutputStream.
+///
+/// The text is formatted exactly as nlohmann::ordered_json::dump() formats the
+/// equivalent tree, so streamed values and values serialized from a tree can
+/// be mixed freely. Strings are copied as they are apart from escaping, and are
+/// not validated as UTF-8.
+class JsonStreamWriter
+{
+  public:
+    /// @param indent_width Number of spaces to indent each nesting level by, or
+    /// a negative value to write each top-level value on a single line.
+    explicit JsonStreamWriter(int indent_width);
+
+    void BeginObject();
+    void EndObject();
+    void BeginArray();
+    void EndArray();
+
+    /// Write the key of the next member of the current object.
+    void Key(std::string_view key);
+
+    void String(std::string_view value);
+    void Int(int64_t value);
+    void UInt(uint64_t value);
+    void Bool(bool value);
+    void Null();
+
+    /// Write a number, or null if it is infinite or NaN.
+    void Double(double value);
+
+    /// Serialize a tree as the next value.
+    void Value(const nlohmann::ordered_json& value);
+
+    /// Write the members of an object tree as members of the current object.
+    /// Values that are not objects are ignored.
+    void Members(const nlohmann::ordered_json& object);
+
+    /// Append text as it is, such as the separators between top-level values.
+    void WriteRaw(std::string_view text) { buffer_.append(text.data(), text.size()); }
+
+    /// Number of objects and arrays that have been started but not ended.
+    size_t GetDepth() const { return scopes_.size(); }
+
+    const std::string& GetBuffer() const { return buffer_; }
+
+    /// Empty the buffer once its contents have been written out, keeping its
+    /// storage for the text that follows.
+    void ClearBuffer() { buffer_.clear(); }
+
+  private:
+    struct Scope
+    {
+        bool   is_array;
+        size_t count;
+    };
+
+  private:
+    void BeginValue();
+
+    /// Write the separator and indentation that precede a member or element.
+    void BeginEntry();
+
+    void EndScope(char close);
+
+    size_t CurrentIndent() const { return scopes_.size() * indent_width_; }
+
+    void WriteEscaped(std::string_view text);
+
+  private:
+    std::string        buffer_;
+    std::vector<Scope> scopes_;
+    const bool         pretty_;
+    const size_t       indent_width_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_JSON_STREAM_WRITER_H
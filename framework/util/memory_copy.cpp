@@ -0,0 +1,245 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/memory_copy.h"
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define GFXRECON_MEMORY_COPY_X86
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define GFXRECON_TARGET_SSE2
+#define GFXRECON_TARGET_AVX2
+#else
+#define GFXRECON_TARGET_SSE2 __attribute__((target("sse2")))
+#define GFXRECON_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Copies smaller than this are written with memcpy, because aligning the destination and fencing the non-temporal
+// stores costs more than it saves for data that spans only a few cache lines.
+const size_t kStreamingCopyThreshold = 256;
+
+#if defined(GFXRECON_MEMORY_COPY_X86)
+
+static bool IsSse2Supported()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4] = {};
+    __cpuid(info, 1);
+    return (info[3] & (1 << 26)) != 0;
+#else
+    return __builtin_cpu_supports("sse2");
+#endif
+}
+
+static bool IsAvx2Supported()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4] = {};
+    __cpuid(info, 0);
+    if (info[0] < 7)
+    {
+        return false;
+    }
+
+    // Check for AVX support and for OS support of the YMM register state.
+    __cpuid(info, 1);
+    const int avx_bits = (1 << 27) | (1 << 28);
+    if (((info[2] & avx_bits) != avx_bits) || ((_xgetbv(0) & 0x6) != 0x6))
+    {
+        return false;
+    }
+
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+// Copies the unaligned start of the range with memcpy, returning the number of bytes copied.
+static size_t CopyUnalignedStart(uint8_t* destination, const uint8_t* source, size_t size, size_t alignment)
+{
+    size_t start_size = (alignment - (reinterpret_cast<uintptr_t>(destination) & (alignment - 1))) & (alignment - 1);
+    start_size        = (start_size < size) ? start_size : size;
+
+    std::memcpy(destination, source, start_size);
+
+    return start_size;
+}
+
+GFXRECON_TARGET_SSE2 static void CopySse2(uint8_t* destination, const uint8_t* source, size_t size)
+{
+    size_t start_size = CopyUnalignedStart(destination, source, size, 16);
+    destination += start_size;
+    source += start_size;
+    size -= start_size;
+
+    // Write a full cache line per iteration, so that each write-combining buffer is flushed completely.
+    for (; size >= 64; size -= 64, source += 64, destination += 64)
+    {
+        __m128i data0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+        __m128i data1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + 16));
+        __m128i data2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + 32));
+        __m128i data3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + 48));
+        _mm_stream_si128(reinterpret_cast<__m128i*>(destination), data0);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(destination + 16), data1);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(destination + 32), data2);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(destination + 48), data3);
+    }
+
+    for (; size >= 16; size -= 16, source += 16, destination += 16)
+    {
+        _mm_stream_si128(reinterpret_cast<__m128i*>(destination),
+                         _mm_loadu_si128(reinterpret_cast<const __m128i*>(source)));
+    }
+
+    // Non-temporal stores are weakly ordered, and must be fenced before the memory is flushed or submitted.
+    _mm_sfence();
+
+    std::memcpy(destination, source, size);
+}
+
+GFXRECON_TARGET_AVX2 static void CopyAvx2(uint8_t* destination, const uint8_t* source, size_t size)
+{
+    size_t start_size = CopyUnalignedStart(destination, source, size, 32);
+    destination += start_size;
+    source += start_size;
+    size -= start_size;
+
+    // Write two cache lines per iteration.
+    for (; size >= 128; size -= 128, source += 128, destination += 128)
+    {
+        __m256i data0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source));
+        __m256i data1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + 32));
+        __m256i data2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + 64));
+        __m256i data3 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + 96));
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(destination), data0);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(destination + 32), data1);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(destination + 64), data2);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(destination + 96), data3);
+    }
+
+    for (; size >= 32; size -= 32, source += 32, destination += 32)
+    {
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(destination),
+                            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source)));
+    }
+
+    // Non-temporal stores are weakly ordered, and must be fenced before the memory is flushed or submitted.
+    _mm_sfence();
+
+    // Avoid the AVX to SSE transition penalty in the memcpy call and in the caller.
+    _mm256_zeroupper();
+
+    std::memcpy(destination, source, size);
+}
+
+#endif // GFXRECON_MEMORY_COPY_X86
+
+static MemoryCopyKernel SelectStreamingMemoryCopyKernel()
+{
+    MemoryCopyKernel kernel = MemoryCopyKernel::kScalar;
+
+    if (IsMemoryCopyKernelSupported(MemoryCopyKernel::kAvx2))
+    {
+        kernel = MemoryCopyKernel::kAvx2;
+    }
+    else if (IsMemoryCopyKernelSupported(MemoryCopyKernel::kSse2))
+    {
+        kernel = MemoryCopyKernel::kSse2;
+    }
+
+    return kernel;
+}
+
+MemoryCopyKernel GetStreamingMemoryCopyKernel()
+{
+    static const MemoryCopyKernel kernel = SelectStreamingMemoryCopyKernel();
+    return kernel;
+}
+
+bool IsMemoryCopyKernelSupported(MemoryCopyKernel kernel)
+{
+    switch (kernel)
+    {
+#if defined(GFXRECON_MEMORY_COPY_X86)
+        case MemoryCopyKernel::kSse2:
+            return IsSse2Supported();
+        case MemoryCopyKernel::kAvx2:
+            return IsAvx2Supported();
+#endif
+        case MemoryCopyKernel::kScalar:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void StreamingMemoryCopy(void* destination, const void* source, size_t size)
+{
+    StreamingMemoryCopy(GetStreamingMemoryCopyKernel(), destination, source, size);
+}
+
+void StreamingMemoryCopy(MemoryCopyKernel kernel, void* destination, const void* source, size_t size)
+{
+    bool copied = false;
+
+#if defined(GFXRECON_MEMORY_COPY_X86)
+    if (size >= kStreamingCopyThreshold)
+    {
+        auto destination_bytes = static_cast<uint8_t*>(destination);
+        auto source_bytes      = static_cast<const uint8_t*>(source);
+
+        // The best supported kernel also determines which of the other kernels are supported.
+        MemoryCopyKernel supported_kernel = GetStreamingMemoryCopyKernel();
+
+        if ((kernel == MemoryCopyKernel::kAvx2) && (supported_kernel == MemoryCopyKernel::kAvx2))
+        {
+            CopyAvx2(destination_bytes, source_bytes, size);
+            copied = true;
+        }
+        else if ((kernel == MemoryCopyKernel::kSse2) && (supported_kernel != MemoryCopyKernel::kScalar))
+        {
+            CopySse2(destination_bytes, source_bytes, size);
+            copied = true;
+        }
+    }
+#else
+    GFXRECON_UNREFERENCED_PARAMETER(kernel);
+#endif
+
+    if (!copied)
+    {
+        std::memcpy(destination, source, size);
+    }
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
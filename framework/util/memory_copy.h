@@ -0,0 +1,59 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_MEMORY_COPY_H
+#define GFXRECON_UTIL_MEMORY_COPY_H
+
+#include "util/defines.h"
+
+#include <cstddef>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+enum class MemoryCopyKernel
+{
+    kScalar, // Plain memcpy.
+    kSse2,   // 16-byte non-temporal stores.
+    kAvx2    // 32-byte non-temporal stores.
+};
+
+// Returns the fastest kernel supported by the CPU, which is selected the first time it is requested.
+MemoryCopyKernel GetStreamingMemoryCopyKernel();
+
+// Returns false if the CPU does not support the kernel.
+bool IsMemoryCopyKernelSupported(MemoryCopyKernel kernel);
+
+// Copies data to mapped device memory, which is often write-combined or uncached and is not read back by the CPU.  Large
+// copies are written with non-temporal stores, which write full cache lines without reading the destination into the
+// cache.  Small copies and CPUs without SIMD support use memcpy.  The destination is visible to other agents when the
+// function returns.
+void StreamingMemoryCopy(void* destination, const void* source, size_t size);
+
+// Copies data with the specified kernel, falling back to memcpy when the CPU does not support it.  Used to compare
+// kernels.
+void StreamingMemoryCopy(MemoryCopyKernel kernel, void* destination, const void* source, size_t size);
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_MEMORY_COPY_H
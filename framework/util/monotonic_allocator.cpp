@@ -46,6 +46,7 @@ void MonotonicAllocator::Clear(bool free_system_memory)
 
     current_block_            = 0;
     current_block_free_bytes_ = block_size_;
+    allocated_size_           = 0;
 }
 
 void* MonotonicAllocator::Allocate(size_t object_bytes, size_t alignment_bytes)
@@ -59,6 +60,8 @@ void* MonotonicAllocator::Allocate(size_t object_bytes, size_t alignment_bytes)
         return nullptr;
     }
 
+    allocated_size_ += object_bytes;
+
     if (object_bytes <= block_size_)
     {
         // Try to allocate to an existing block
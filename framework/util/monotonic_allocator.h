@@ -40,7 +40,7 @@ class MonotonicAllocator
     // fit requested allocations, and blocks are freed using an appropriate call to Clear or upon destruction of this
     // MonotonicAllocator
     MonotonicAllocator(size_t block_size) :
-        block_size_(block_size), current_block_(0), current_block_free_bytes_(block_size)
+        block_size_(block_size), current_block_(0), current_block_free_bytes_(block_size), allocated_size_(0)
     {}
 
     ~MonotonicAllocator() { Clear(true); }
@@ -74,6 +74,9 @@ class MonotonicAllocator
     // memory
     void Clear(bool free_system_memory);
 
+    // Number of bytes requested from calls to Allocate since the last call to Clear
+    size_t GetAllocatedSize() const { return allocated_size_; }
+
   private:
     void* Allocate(size_t object_bytes, size_t alignment_bytes);
     void* AllocateToBlock(size_t object_bytes, size_t alignment_bytes);
@@ -92,6 +95,7 @@ class MonotonicAllocator
     const size_t                                  block_size_;
     size_t                                        current_block_;
     size_t                                        current_block_free_bytes_;
+    size_t                                        allocated_size_;
 };
 
 GFXRECON_END_NAMESPACE(util)
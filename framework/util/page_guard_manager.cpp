@@ -24,9 +24,11 @@
 
 #include "util/page_guard_manager.h"
 
+#include "util/hash.h"
 #include "util/logging.h"
 #include "util/platform.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cinttypes>
 
@@ -222,7 +224,8 @@ PageGuardManager::PageGuardManager() :
                      kDefaultEnableSignalHandlerWatcher,
                      kDefaultSignalHandlerWatcherMaxRestores,
                      kDefaultEnableReadWriteSamePage,
-                     kDefaultMemoryProtMode)
+                     kDefaultMemoryProtMode,
+                     kDefaultEnablePageHashing)
 {}
 
 PageGuardManager::PageGuardManager(bool                 enable_copy_on_map,
@@ -231,14 +234,17 @@ PageGuardManager::PageGuardManager(bool                 enable_copy_on_map,
                                    bool                 unblock_SIGSEGV,
                                    bool                 enable_signal_handler_watcher,
                                    int                  signal_handler_watcher_max_restores,
-                                   MemoryProtectionMode protection_mode) :
+                                   MemoryProtectionMode protection_mode,
+                                   bool                 enable_page_hashing) :
     exception_handler_(nullptr),
     exception_handler_count_(0), system_page_size_(util::platform::GetSystemPageSize()),
     system_page_pot_shift_(GetSystemPagePotShift()), enable_copy_on_map_(enable_copy_on_map),
     enable_separate_read_(enable_separate_read), unblock_sigsegv_(unblock_SIGSEGV),
     enable_signal_handler_watcher_(enable_signal_handler_watcher),
     signal_handler_watcher_max_restores_(signal_handler_watcher_max_restores),
-    enable_read_write_same_page_(expect_read_write_same_page), protection_mode_(protection_mode), uffd_is_init_(false)
+    enable_read_write_same_page_(expect_read_write_same_page), enable_page_hashing_(enable_page_hashing),
+    protection_mode_(protection_mode), uffd_is_init_(false), uffd_write_protect_(false), soft_dirty_pagemap_fd_(-1),
+    soft_dirty_clear_refs_fd_(-1)
 {
     if (kUserFaultFdMode == protection_mode_ && !USERFAULTFD_SUPPORTED)
     {
@@ -248,11 +254,19 @@ PageGuardManager::PageGuardManager(bool                 enable_copy_on_map,
         protection_mode_ = kMProtectMode;
     }
 
-    if (kMProtectMode == protection_mode_)
+    if (kSoftDirtyMode == protection_mode_ && !InitializeSoftDirty())
+    {
+        GFXRECON_LOG_WARNING(
+            "Kernel does not support soft-dirty page tracking. Falling back to mprotect memory tracking mode.");
+
+        protection_mode_ = kMProtectMode;
+    }
+
+    if ((kMProtectMode == protection_mode_) || (kSoftDirtyMode == protection_mode_))
     {
         InitializeSystemExceptionContext();
     }
-    else
+    else if (kUserFaultFdMode == protection_mode_)
     {
         if (!InitializeUserFaultFd())
         {
@@ -273,10 +287,19 @@ PageGuardManager::~PageGuardManager()
             ClearExceptionHandler(exception_handler_);
         }
     }
-    else
+    else if (kUserFaultFdMode == protection_mode_)
     {
         UffdTerminate();
     }
+    else if (kSoftDirtyMode == protection_mode_)
+    {
+        if (exception_handler_ != nullptr)
+        {
+            ClearExceptionHandler(exception_handler_);
+        }
+
+        SoftDirtyTerminate();
+    }
 }
 
 #if !defined(WIN32)
@@ -360,7 +383,8 @@ void PageGuardManager::Create(bool                 enable_copy_on_map,
                               bool                 unblock_SIGSEGV,
                               bool                 enable_signal_handler_watcher,
                               int                  signal_handler_watcher_max_restores,
-                              MemoryProtectionMode protection_mode)
+                              MemoryProtectionMode protection_mode,
+                              bool                 enable_page_hashing)
 {
     if (instance_ == nullptr)
     {
@@ -370,7 +394,8 @@ void PageGuardManager::Create(bool                 enable_copy_on_map,
                                          unblock_SIGSEGV,
                                          enable_signal_handler_watcher,
                                          signal_handler_watcher_max_restores,
-                                         protection_mode);
+                                         protection_mode,
+                                         enable_page_hashing);
 
 #if !defined(WIN32)
         if (enable_signal_handler_watcher &&
@@ -443,7 +468,7 @@ void* PageGuardManager::AllocateMemory(size_t aligned_size, bool use_write_watch
     if (aligned_size > 0)
     {
 #ifndef WIN32
-        if (use_write_watch)
+        if (use_write_watch && (kSoftDirtyMode != protection_mode_))
         {
             GFXRECON_LOG_ERROR("PageGuardManager::AllocateMemory() ignored use_write_watch=true due to lack of support "
                                "from the current platform.");
@@ -695,7 +720,14 @@ bool PageGuardManager::SetMemoryProtection(void* protect_address, size_t protect
 
 void PageGuardManager::LoadActiveWriteStates(MemoryInfo* memory_info)
 {
-    assert((memory_info != nullptr) && (memory_info->shadow_memory == nullptr));
+    assert((memory_info != nullptr) &&
+           ((memory_info->shadow_memory == nullptr) || (kSoftDirtyMode == protection_mode_)));
+
+    if (kSoftDirtyMode == protection_mode_)
+    {
+        SoftDirtyLoadActiveWriteStates(memory_info);
+        return;
+    }
 
 #if defined(WIN32)
     auto      modified_addresses = memory_info->modified_addresses.get();
@@ -743,61 +775,60 @@ void PageGuardManager::ProcessEntry(uint64_t                  memory_id,
     assert(memory_info != nullptr);
     assert(memory_info->is_modified);
 
-    bool   active_range = false;
-    size_t start_index  = 0;
+    PageStatusTracker& status_tracker = memory_info->status_tracker;
 
     memory_info->is_modified = false;
 
-    for (size_t i = 0; i < memory_info->total_pages; ++i)
+    // Scan for runs of written pages, which are handled as large a range as possible with a single modified memory
+    // handler invocation, and runs of pages that were only read.
+    size_t start_index = status_tracker.FindNextActiveBlock(0);
+    while (start_index < memory_info->total_pages)
     {
-        // Concatenate dirty pages to handle as large a range as possible with a single modified memory handler
-        // invocation.
-        if (memory_info->status_tracker.IsActiveWriteBlock(i))
+        size_t end_index = 0;
+
+        if (status_tracker.IsActiveWriteBlock(start_index))
         {
-            memory_info->status_tracker.SetActiveWriteBlock(i, false);
-            memory_info->status_tracker.SetActiveReadBlock(i, false);
+            end_index = status_tracker.FindNextInactiveWriteBlock(start_index);
+            status_tracker.ClearBlocks(start_index, end_index);
 
-            if (!active_range)
-            {
-                active_range = true;
-                start_index  = i;
-            }
+            ProcessActiveRange(memory_id, memory_info, start_index, end_index, handle_modified);
         }
         else
         {
-            // If there was no write operation on the current page, check to see if there was a read operation.
-            // If a read operation triggered the page guard handler, it needs to be reset.
-            // Note that it is only possible to reach this state when enable_shadow_memory_ is true and
-            // enable_read_write_same_page_ is false.
-            if (memory_info->status_tracker.IsActiveReadBlock(i))
-            {
-                memory_info->status_tracker.SetActiveReadBlock(i, false);
+            // If a read operation triggered the page guard handler, it needs to be reset.  Note that it is only
+            // possible to reach this state when enable_shadow_memory_ is true and enable_read_write_same_page_ is
+            // false, or when userfaultfd write protection is enabled.
+            end_index = status_tracker.FindNextInactiveReadOnlyBlock(start_index);
+            status_tracker.ClearBlocks(start_index, end_index);
 
-                if (protection_mode_ == kMProtectMode)
-                {
-                    assert(memory_info->shadow_memory != nullptr);
+            ResetReadRange(memory_info, start_index, end_index);
+        }
 
-                    void* page_address =
-                        static_cast<uint8_t*>(memory_info->aligned_address) + (i << system_page_pot_shift_);
-                    size_t segment_size = GetMemorySegmentSize(memory_info, i);
+        start_index = status_tracker.FindNextActiveBlock(end_index);
+    }
+}
 
-                    SetMemoryProtection(page_address, segment_size, kGuardReadWriteProtect);
-                }
-            }
+void PageGuardManager::ResetReadRange(MemoryInfo* memory_info, size_t start_index, size_t end_index)
+{
+    assert((memory_info != nullptr) && (memory_info->shadow_memory != nullptr));
+    assert(end_index > start_index);
 
-            // If the previous pages were modified by a write operation, process the modified range now.
-            if (active_range)
-            {
-                active_range = false;
+    size_t page_count    = end_index - start_index;
+    size_t range_offset  = start_index << system_page_pot_shift_;
+    void*  range_address = static_cast<uint8_t*>(memory_info->aligned_address) + range_offset;
 
-                ProcessActiveRange(memory_id, memory_info, start_index, i, handle_modified);
-            }
-        }
-    }
+    if (protection_mode_ == kMProtectMode)
+    {
+        // The last page may be a partial page.
+        size_t range_size =
+            ((page_count - 1) << system_page_pot_shift_) + GetMemorySegmentSize(memory_info, end_index - 1);
 
-    if (active_range)
+        SetMemoryProtection(range_address, range_size, kGuardReadWriteProtect);
+    }
+    else if ((protection_mode_ == kUserFaultFdMode) && uffd_write_protect_)
     {
-        ProcessActiveRange(memory_id, memory_info, start_index, memory_info->total_pages, handle_modified);
+        // Release the pages, so that the next access reloads them from the mapped memory.
+        UffdReleasePages(range_address, page_count << system_page_pot_shift_);
     }
 }
 
@@ -836,7 +867,15 @@ void PageGuardManager::ProcessActiveRange(uint64_t                  memory_id,
         {
             assert(memory_info->aligned_address == memory_info->shadow_memory);
             // uffd requires page aligned addresses and sizes.
-            UffdUnregisterMemory(guard_address, page_count << system_page_pot_shift_);
+            if (uffd_write_protect_)
+            {
+                // Writes to the range are blocked in the kernel until the range has been reset.
+                UffdWriteProtect(guard_address, page_count << system_page_pot_shift_, true, false);
+            }
+            else
+            {
+                UffdUnregisterMemory(guard_address, page_count << system_page_pot_shift_);
+            }
         }
 
         // Copy from shadow memory to the original mapped memory.
@@ -855,7 +894,8 @@ void PageGuardManager::ProcessActiveRange(uint64_t                  memory_id,
 
         // The shadow memory address, page offset, and range values to be provided to the callback, which will process
         // the memory range.
-        handle_modified(memory_id, memory_info->shadow_memory, page_offset, page_range);
+        ProcessModifiedRange(
+            memory_id, memory_info, memory_info->shadow_memory, page_offset, page_range, handle_modified);
 
         if (kMProtectMode == protection_mode_)
         {
@@ -864,7 +904,16 @@ void PageGuardManager::ProcessActiveRange(uint64_t                  memory_id,
         }
         else if (kUserFaultFdMode == protection_mode_)
         {
-            UffdResetRegion(guard_address, page_range);
+            if (uffd_write_protect_)
+            {
+                // Release the pages, so that the next access reloads them from the mapped memory.  The registration
+                // is not affected, so there is no window in which accesses are not trapped.
+                UffdReleasePages(guard_address, page_count << system_page_pot_shift_);
+            }
+            else
+            {
+                UffdResetRegion(guard_address, page_range);
+            }
         }
     }
     else
@@ -896,7 +945,70 @@ void PageGuardManager::ProcessActiveRange(uint64_t                  memory_id,
 
         // The mapped memory address, page offset, and range values to be provided to the callback, which will process
         // the memory range.
-        handle_modified(memory_id, memory_info->mapped_memory, page_offset, page_range);
+        ProcessModifiedRange(
+            memory_id, memory_info, memory_info->mapped_memory, page_offset, page_range, handle_modified);
+    }
+}
+
+void PageGuardManager::ProcessModifiedRange(uint64_t                  memory_id,
+                                            MemoryInfo*               memory_info,
+                                            void*                     memory,
+                                            size_t                    offset,
+                                            size_t                    size,
+                                            const ModifiedMemoryFunc& handle_modified)
+{
+    assert(memory_info != nullptr);
+
+    if (memory_info->block_hashes == nullptr)
+    {
+        handle_modified(memory_id, memory, offset, size);
+        return;
+    }
+
+    // Hash blocks are aligned to the start of the page containing the start of the mapped memory, so that modified
+    // ranges always contain complete blocks, except for the blocks that are clipped by the mapped memory bounds.  Each
+    // block is always hashed with the same bounds.
+    const uint8_t* data           = static_cast<const uint8_t*>(memory);
+    const size_t   aligned_offset = memory_info->aligned_offset;
+    const size_t   range_end      = offset + size;
+    const size_t   first_block    = (offset + aligned_offset) >> kHashBlockPotShift;
+    const size_t   end_block      = (range_end + aligned_offset + kHashBlockSize - 1) >> kHashBlockPotShift;
+    bool           active_run     = false;
+    size_t         run_start      = 0;
+
+    for (size_t i = first_block; i < end_block; ++i)
+    {
+        size_t block_start = std::max((i << kHashBlockPotShift), aligned_offset + offset) - aligned_offset;
+        size_t block_end   = std::min(((i + 1) << kHashBlockPotShift) - aligned_offset, range_end);
+
+        uint64_t hash = util::hash::XxHash64(data + block_start, block_end - block_start);
+        if (hash == 0)
+        {
+            // Reserve 0 for blocks that have not been reported.
+            hash = 1;
+        }
+
+        if (memory_info->block_hashes[i] != hash)
+        {
+            memory_info->block_hashes[i] = hash;
+
+            if (!active_run)
+            {
+                active_run = true;
+                run_start  = block_start;
+            }
+        }
+        else if (active_run)
+        {
+            // Coalesce consecutive modified blocks into a single range.
+            active_run = false;
+            handle_modified(memory_id, memory, run_start, block_start - run_start);
+        }
+    }
+
+    if (active_run)
+    {
+        handle_modified(memory_id, memory, run_start, range_end - run_start);
     }
 }
 
@@ -941,7 +1053,7 @@ void* PageGuardManager::AddTrackedMemory(uint64_t  memory_id,
 
     if (use_shadow_memory)
     {
-        if (use_write_watch)
+        if (use_write_watch && (kSoftDirtyMode != protection_mode_))
         {
             // Although it would be possible to track writes to shadow memory with write watch, it is not possible to
             // track reads, which can require a copy from driver memory to shadow memory.
@@ -960,7 +1072,10 @@ void* PageGuardManager::AddTrackedMemory(uint64_t  memory_id,
             {
                 aligned_address = shadow_memory;
 
-                if (enable_copy_on_map_ && kUserFaultFdMode != protection_mode_)
+                // Reads from shadow memory cannot be detected in soft-dirty mode, so the mapped memory content is
+                // always copied.
+                if ((enable_copy_on_map_ || (kSoftDirtyMode == protection_mode_)) &&
+                    (kUserFaultFdMode != protection_mode_))
                 {
                     MemoryCopy(shadow_memory, mapped_memory, mapped_range);
                 }
@@ -983,9 +1098,9 @@ void* PageGuardManager::AddTrackedMemory(uint64_t  memory_id,
     else
     {
 #if !defined(WIN32)
-        if (use_write_watch)
+        if (use_write_watch && (kSoftDirtyMode != protection_mode_))
         {
-            // Only supported on Windows.
+            // Only supported on Windows and in soft-dirty mode.
             use_write_watch = false;
             GFXRECON_LOG_WARNING("PageGuardManager::AddTrackedMemory() disabled write watch for mapped memory tracking "
                                  "due to lack of support from the current platform")
@@ -1076,6 +1191,14 @@ void* PageGuardManager::AddTrackedMemory(uint64_t  memory_id,
             start_address = shadow_memory;
         }
 
+        if (kSoftDirtyMode == protection_mode_)
+        {
+            // Modified pages are queried for both mapped and shadow memory.  The exception handler records writes
+            // made while the memory is write protected by SoftDirtyReset().
+            use_write_watch = true;
+            AddExceptionHandler();
+        }
+
         if (!use_write_watch)
         {
             if (kMProtectMode == protection_mode_)
@@ -1106,6 +1229,12 @@ void* PageGuardManager::AddTrackedMemory(uint64_t  memory_id,
         {
             assert(memory_info_.find(memory_id) == memory_info_.end());
 
+            if (kSoftDirtyMode == protection_mode_)
+            {
+                // Pages that were written before tracking started, including the shadow memory copy, are not reported.
+                SoftDirtyReset();
+            }
+
             auto entry =
                 memory_info_.emplace(std::piecewise_construct,
                                      std::forward_as_tuple(memory_id),
@@ -1136,6 +1265,10 @@ void* PageGuardManager::AddTrackedMemory(uint64_t  memory_id,
                         UffdUnregisterMemory(aligned_address, guard_range);
                     }
                 }
+                else if (kSoftDirtyMode == protection_mode_)
+                {
+                    RemoveExceptionHandler();
+                }
 
                 if (shadow_memory != nullptr)
                 {
@@ -1150,6 +1283,12 @@ void* PageGuardManager::AddTrackedMemory(uint64_t  memory_id,
                     shadow_memory = nullptr;
                 }
             }
+            else if (enable_page_hashing_)
+            {
+                // Hashes are zero initialized, indicating that no content has been reported.
+                entry.first->second.block_hashes =
+                    std::make_unique<uint64_t[]>(total_pages << (system_page_pot_shift_ - kHashBlockPotShift));
+            }
         }
     }
 
@@ -1171,6 +1310,11 @@ void PageGuardManager::ReleaseTrackedMemory(const MemoryInfo* memory_info)
             UffdUnregisterMemory(memory_info->shadow_memory, memory_info->shadow_range);
         }
     }
+    else if (kSoftDirtyMode == protection_mode_)
+    {
+        RemoveExceptionHandler();
+    }
+
     if ((memory_info->shadow_memory != nullptr) && memory_info->own_shadow_memory)
     {
         FreeMemory(memory_info->shadow_memory, memory_info->shadow_range);
@@ -1224,17 +1368,23 @@ void PageGuardManager::ProcessMemoryEntry(uint64_t memory_id, const ModifiedMemo
 
     auto entry = memory_info_.find(memory_id);
 
+    // Threads that access memory that is being reset need to be blocked, unless write protection blocks them.
     uint32_t n_threads_to_wait = 0;
-    if (protection_mode_ == kUserFaultFdMode)
+    if ((protection_mode_ == kUserFaultFdMode) && !uffd_write_protect_)
     {
         n_threads_to_wait = UffdBlockFaultingThreads();
     }
+    else if (kSoftDirtyMode == protection_mode_)
+    {
+        // Clearing the soft-dirty bits for this entry clears them for all entries, so all entries are loaded.
+        SoftDirtyReset();
+    }
 
     if (entry != memory_info_.end())
     {
         auto memory_info = &entry->second;
 
-        if (memory_info->use_write_watch)
+        if (memory_info->use_write_watch && (kSoftDirtyMode != protection_mode_))
         {
             // Active memory tracking with VirtualProtect()/mprotect() is only applied to shadow memory.
             // When not using shadow memory, we need to query for active write status.
@@ -1248,7 +1398,7 @@ void PageGuardManager::ProcessMemoryEntry(uint64_t memory_id, const ModifiedMemo
     }
 
     // Unblock threads
-    if (protection_mode_ == kUserFaultFdMode)
+    if ((protection_mode_ == kUserFaultFdMode) && !uffd_write_protect_)
     {
         UffdUnblockFaultingThreads(n_threads_to_wait);
     }
@@ -1258,17 +1408,24 @@ void PageGuardManager::ProcessMemoryEntries(const ModifiedMemoryFunc& handle_mod
 {
     std::lock_guard<std::mutex> lock(tracked_memory_lock_);
 
+    // Threads that access memory that is being reset need to be blocked, unless write protection blocks them.
     uint32_t n_threads_to_wait = 0;
-    if (protection_mode_ == kUserFaultFdMode)
+    if ((protection_mode_ == kUserFaultFdMode) && !uffd_write_protect_)
     {
         n_threads_to_wait = UffdBlockFaultingThreads();
     }
+    else if (kSoftDirtyMode == protection_mode_)
+    {
+        // Load all entries before processing any of them, to minimize the interval between loading and clearing the
+        // soft-dirty bits, in which writes from other threads fault.
+        SoftDirtyReset();
+    }
 
     for (auto entry = memory_info_.begin(); entry != memory_info_.end(); ++entry)
     {
         auto memory_info = &entry->second;
 
-        if (memory_info->use_write_watch)
+        if (memory_info->use_write_watch && (kSoftDirtyMode != protection_mode_))
         {
             // Active memory tracking with VirtualProtect()/mprotect() is only applied to shadow memory.
             // When not using shadow memory, we need to query for active write status.
@@ -1282,7 +1439,7 @@ void PageGuardManager::ProcessMemoryEntries(const ModifiedMemoryFunc& handle_mod
     }
 
     // Unblock threads
-    if (protection_mode_ == kUserFaultFdMode)
+    if ((protection_mode_ == kUserFaultFdMode) && !uffd_write_protect_)
     {
         UffdUnblockFaultingThreads(n_threads_to_wait);
     }
@@ -1290,7 +1447,7 @@ void PageGuardManager::ProcessMemoryEntries(const ModifiedMemoryFunc& handle_mod
 
 bool PageGuardManager::HandleGuardPageViolation(void* address, bool is_write, bool clear_guard)
 {
-    assert(protection_mode_ == kMProtectMode);
+    assert((protection_mode_ == kMProtectMode) || (protection_mode_ == kSoftDirtyMode));
 
     MemoryInfo* memory_info = nullptr;
 
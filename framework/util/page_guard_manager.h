@@ -55,6 +55,13 @@
 #endif
 #endif
 
+// Soft-dirty tracking reads page table state from the Linux procfs interface.
+#if defined(__linux__)
+#define SOFT_DIRTY_SUPPORTED 1
+#else
+#define SOFT_DIRTY_SUPPORTED 0
+#endif
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
@@ -64,7 +71,8 @@ class PageGuardManager
     enum MemoryProtectionMode
     {
         kMProtectMode,
-        kUserFaultFdMode
+        kUserFaultFdMode,
+        kSoftDirtyMode
     };
 
     static const bool                 kDefaultEnableCopyOnMap                 = true;
@@ -74,6 +82,7 @@ class PageGuardManager
     static const bool                 kDefaultEnableSignalHandlerWatcher      = false;
     static const int                  kDefaultSignalHandlerWatcherMaxRestores = 1;
     static const MemoryProtectionMode kDefaultMemoryProtMode                  = kMProtectMode;
+    static const bool                 kDefaultEnablePageHashing               = false;
 
     static const uintptr_t kNullShadowHandle = 0;
 
@@ -90,7 +99,8 @@ class PageGuardManager
                        bool                 unblock_SIGSEGV,
                        bool                 enable_signal_handler_watcher,
                        int                  signal_handler_watcher_max_restores,
-                       MemoryProtectionMode protection_mode);
+                       MemoryProtectionMode protection_mode,
+                       bool                 enable_page_hashing);
 
     static void Destroy();
 
@@ -98,10 +108,14 @@ class PageGuardManager
 
     bool UseSeparateRead() const { return enable_separate_read_; }
 
+    // Returns the mode that is in use, which differs from the requested mode when the requested mode is not supported.
+    MemoryProtectionMode GetMemoryProtectionMode() const { return protection_mode_; }
+
     bool GetTrackedMemory(uint64_t memory_id, void** memory);
 
     // The use_write_watch parameter is ignored on all platforms except Windows, and is ignored on Windows if
-    // shadow_memory is true.
+    // shadow_memory is true.  In soft-dirty mode, all memory is tracked by querying for modified pages, as if
+    // use_write_watch were true, and shadow memory is initialized from mapped memory when it is added for tracking.
     //
     // The shadow_memory_handle parameter is an option value that allows the lifetime of the shadow memory allocation to
     // be managed externally.  Unless opy-on-map is disabled, copies from the mapped_range portion of mapped_memory to
@@ -130,7 +144,7 @@ class PageGuardManager
 
     size_t GetAlignedSize(size_t size) const;
 
-    // The use_write_watch parameter is ignored on all platforms except Windows.
+    // The use_write_watch parameter is ignored on all platforms except Windows, and Linux in soft-dirty mode.
     void* AllocateMemory(size_t aligned_size, bool use_write_watch);
 
     void FreeMemory(void* pMemory, size_t aligned_size);
@@ -154,7 +168,8 @@ class PageGuardManager
                      bool                 unblock_SIGSEGV,
                      bool                 enable_signal_handler_watcher,
                      int                  signal_handler_watcher_max_restores,
-                     MemoryProtectionMode protection_mode);
+                     MemoryProtectionMode protection_mode,
+                     bool                 enable_page_hashing);
 
     ~PageGuardManager();
 
@@ -200,10 +215,14 @@ class PageGuardManager
         size_t      last_segment_size; // Size of the last segment of the mapped memory, which may not be a full page.
         const void* start_address;     // Start address for the protected memory region.
         const void* end_address;       // Address immediately after the end of the protected memory region.
-        bool        use_write_watch;
+        bool        use_write_watch;   // Modified pages are queried instead of being reported by access violations.
         bool        is_modified;
         bool        own_shadow_memory;
 
+        // Hashes of the content last reported for each hash block of the mapped memory, when page hashing is enabled.
+        // A value of 0 indicates that the block has not been reported.
+        std::unique_ptr<uint64_t[]> block_hashes;
+
 #if defined(WIN32)
         // Memory for retrieving modified pages with GetWriteWatch.
         std::unique_ptr<void*[]> modified_addresses;
@@ -240,11 +259,18 @@ class PageGuardManager
     bool   SetMemoryProtection(void* protect_address, size_t protect_size, uint32_t protect_mask);
     void   LoadActiveWriteStates(MemoryInfo* memory_info);
     void   ProcessEntry(uint64_t memory_id, MemoryInfo* memory_info, const ModifiedMemoryFunc& handle_modified);
+    void   ResetReadRange(MemoryInfo* memory_info, size_t start_index, size_t end_index);
     void   ProcessActiveRange(uint64_t                  memory_id,
                               MemoryInfo*               memory_info,
                               size_t                    start_index,
                               size_t                    end_index,
                               const ModifiedMemoryFunc& handle_modified);
+    void   ProcessModifiedRange(uint64_t                  memory_id,
+                                MemoryInfo*               memory_info,
+                                void*                     memory,
+                                size_t                    offset,
+                                size_t                    size,
+                                const ModifiedMemoryFunc& handle_modified);
 
     size_t GetOffsetFromPageStart(void* address) const
     {
@@ -257,6 +283,11 @@ class PageGuardManager
     }
 
   private:
+    // Page hashing compares memory content in blocks of this size, allowing modified ranges to be reported with
+    // sub-page granularity.
+    static const size_t kHashBlockPotShift = 8;
+    static const size_t kHashBlockSize     = size_t{ 1 } << kHashBlockPotShift;
+
     static PageGuardManager* instance_;
     MemoryInfoMap            memory_info_;
     std::mutex               tracked_memory_lock_;
@@ -274,6 +305,9 @@ class PageGuardManager
     // Only applies to WIN32 builds and Linux/Android builds with PAGE_GUARD_ENABLE_UCONTEXT_WRITE_DETECTION defined.
     const bool enable_read_write_same_page_;
 
+    // Skip reporting memory blocks with content that matches the previously reported content.
+    const bool enable_page_hashing_;
+
 #if !defined(WIN32)
     pthread_t       signal_handler_watcher_thread_;
     static uint32_t signal_handler_watcher_restores_;
@@ -286,6 +320,10 @@ class PageGuardManager
     MemoryProtectionMode protection_mode_;
     bool                 uffd_is_init_;
 
+    // Tracked memory is registered for userfaultfd write protection in addition to missing page faults, so pages that
+    // are only read are not reported as modified and regions can be reset without blocking other threads.
+    bool uffd_write_protect_;
+
 #if USERFAULTFD_SUPPORTED == 1
     int                          uffd_rt_signal_used_;
     sigset_t                     uffd_signal_set_;
@@ -304,6 +342,19 @@ class PageGuardManager
     bool     UffdRegisterMemory(const void* address, size_t length);
     void     UffdUnregisterMemory(const void* address, size_t length);
     bool     UffdResetRegion(void* guard_address, size_t guard_range);
+    bool     UffdWriteProtect(void* address, size_t length, bool protect, bool wake_threads);
+    void     UffdReleasePages(void* address, size_t length);
+
+    // Descriptors for /proc/self/pagemap and /proc/self/clear_refs, used to query and clear the soft-dirty page bits.
+    int soft_dirty_pagemap_fd_;
+    int soft_dirty_clear_refs_fd_;
+
+    bool InitializeSoftDirty();
+    void SoftDirtyTerminate();
+    bool SoftDirtyClear();
+    bool SoftDirtyIsPageModified(const void* address);
+    void SoftDirtyLoadActiveWriteStates(MemoryInfo* memory_info);
+    void SoftDirtyReset();
 
 #if USERFAULTFD_SUPPORTED == 1
     bool         UffdInit();
@@ -311,6 +362,7 @@ class PageGuardManager
     void         UffdRemoveSignalHandler();
     bool         UffdStartHandlerThread();
     bool         UffdHandleFault(MemoryInfo* memory_info, uint64_t address, uint64_t flags, bool wake_thread);
+    bool         UffdHandleWriteProtectFault(MemoryInfo* memory_info, uint64_t address, bool wake_thread);
     bool         UffdWakeFaultingThread(uint64_t address);
     void         UffdSignalHandler(int sig);
     void*        UffdHandlerThread(void* args);
@@ -0,0 +1,252 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/page_guard_manager.h"
+
+#if SOFT_DIRTY_SUPPORTED == 1
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <cinttypes>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Each /proc/self/pagemap entry is a 64-bit value, with bit 55 set when the page has been written since the
+// soft-dirty bits were last cleared.  See the kernel's Documentation/admin-guide/mm/soft-dirty.rst.
+static const uint64_t kPagemapSoftDirtyBit = uint64_t{ 1 } << 55;
+
+// Value written to /proc/self/clear_refs to clear the soft-dirty bits of all pages in the process.
+static const char kClearSoftDirtyCommand[] = "4";
+
+// Maximum number of pagemap entries read at once.
+static const size_t kPagemapBatchSize = 512;
+
+bool PageGuardManager::InitializeSoftDirty()
+{
+    assert((soft_dirty_pagemap_fd_ == -1) && (soft_dirty_clear_refs_fd_ == -1));
+
+    soft_dirty_pagemap_fd_ = open("/proc/self/pagemap", O_RDONLY | O_CLOEXEC);
+    if (soft_dirty_pagemap_fd_ == -1)
+    {
+        GFXRECON_LOG_ERROR("Failed to open /proc/self/pagemap: %s", strerror(errno));
+        return false;
+    }
+
+    soft_dirty_clear_refs_fd_ = open("/proc/self/clear_refs", O_WRONLY | O_CLOEXEC);
+    if (soft_dirty_clear_refs_fd_ == -1)
+    {
+        GFXRECON_LOG_ERROR("Failed to open /proc/self/clear_refs: %s", strerror(errno));
+        SoftDirtyTerminate();
+        return false;
+    }
+
+    // Kernels built without CONFIG_MEM_SOFT_DIRTY accept the clear command but never set the soft-dirty bit, so
+    // verify that a write to a test page is detected.
+    bool     supported = false;
+    uint8_t* page      = static_cast<uint8_t*>(util::platform::AllocateRawMemory(system_page_size_));
+
+    if (page != nullptr)
+    {
+        page[0] = 1;
+
+        if (SoftDirtyClear() && !SoftDirtyIsPageModified(page))
+        {
+            page[0]   = 2;
+            supported = SoftDirtyIsPageModified(page);
+        }
+
+        util::platform::FreeRawMemory(page, system_page_size_);
+    }
+
+    if (!supported)
+    {
+        SoftDirtyTerminate();
+    }
+
+    return supported;
+}
+
+void PageGuardManager::SoftDirtyTerminate()
+{
+    if (soft_dirty_pagemap_fd_ != -1)
+    {
+        close(soft_dirty_pagemap_fd_);
+        soft_dirty_pagemap_fd_ = -1;
+    }
+
+    if (soft_dirty_clear_refs_fd_ != -1)
+    {
+        close(soft_dirty_clear_refs_fd_);
+        soft_dirty_clear_refs_fd_ = -1;
+    }
+}
+
+bool PageGuardManager::SoftDirtyClear()
+{
+    assert(soft_dirty_clear_refs_fd_ != -1);
+
+    // The kernel walks the page tables of the whole process, so the cost grows with the process's resident memory
+    // rather than the size of the tracked memory.
+    if (write(soft_dirty_clear_refs_fd_, kClearSoftDirtyCommand, sizeof(kClearSoftDirtyCommand) - 1) == -1)
+    {
+        GFXRECON_LOG_ERROR("Failed to clear soft-dirty page bits: %s", strerror(errno));
+        return false;
+    }
+
+    return true;
+}
+
+bool PageGuardManager::SoftDirtyIsPageModified(const void* address)
+{
+    assert(soft_dirty_pagemap_fd_ != -1);
+
+    uint64_t entry  = 0;
+    off_t    offset = static_cast<off_t>((reinterpret_cast<uintptr_t>(address) >> system_page_pot_shift_) *
+                                      sizeof(entry));
+
+    if (pread(soft_dirty_pagemap_fd_, &entry, sizeof(entry), offset) != sizeof(entry))
+    {
+        return false;
+    }
+
+    return (entry & kPagemapSoftDirtyBit) != 0;
+}
+
+void PageGuardManager::SoftDirtyLoadActiveWriteStates(MemoryInfo* memory_info)
+{
+    assert((memory_info != nullptr) && (memory_info->aligned_address != nullptr));
+    assert(soft_dirty_pagemap_fd_ != -1);
+
+    uint64_t entries[kPagemapBatchSize];
+    size_t   first_page = reinterpret_cast<uintptr_t>(memory_info->aligned_address) >> system_page_pot_shift_;
+
+    for (size_t page_index = 0; page_index < memory_info->total_pages;)
+    {
+        size_t  batch_size = std::min(memory_info->total_pages - page_index, kPagemapBatchSize);
+        off_t   offset     = static_cast<off_t>((first_page + page_index) * sizeof(entries[0]));
+        ssize_t result     = pread(soft_dirty_pagemap_fd_, entries, batch_size * sizeof(entries[0]), offset);
+
+        if (result <= 0)
+        {
+            // The modified pages are unknown, so all remaining pages are processed.
+            GFXRECON_LOG_ERROR("PageGuardManager failed to retrieve soft-dirty pages for memory region [start address "
+                               "= %p, size = %" PRIuPTR "] (pread() produced error %s)",
+                               memory_info->mapped_memory,
+                               memory_info->mapped_range,
+                               (result == 0) ? "end of file" : strerror(errno));
+
+            for (; page_index < memory_info->total_pages; ++page_index)
+            {
+                memory_info->status_tracker.SetActiveWriteBlock(page_index, true);
+            }
+
+            memory_info->is_modified = true;
+            break;
+        }
+
+        size_t read_count = static_cast<size_t>(result) / sizeof(entries[0]);
+        for (size_t i = 0; i < read_count; ++i, ++page_index)
+        {
+            if ((entries[i] & kPagemapSoftDirtyBit) != 0)
+            {
+                memory_info->status_tracker.SetActiveWriteBlock(page_index, true);
+                memory_info->is_modified = true;
+            }
+        }
+    }
+}
+
+void PageGuardManager::SoftDirtyReset()
+{
+    // Soft-dirty bits can only be cleared for the entire process, so the modified pages of all tracked memory are
+    // loaded first.  A write made by another thread between loading the pages and clearing the bits would be lost, so
+    // the tracked memory is write protected until the bits are cleared.  Threads that write to the memory in that
+    // interval fault, and HandleGuardPageViolation() records the write once the caller releases the tracked memory
+    // lock.
+    for (auto& entry : memory_info_)
+    {
+        SetMemoryProtection(entry.second.aligned_address,
+                            entry.second.mapped_range + entry.second.aligned_offset,
+                            PROT_READ);
+    }
+
+    for (auto& entry : memory_info_)
+    {
+        LoadActiveWriteStates(&entry.second);
+    }
+
+    SoftDirtyClear();
+
+    for (auto& entry : memory_info_)
+    {
+        SetMemoryProtection(entry.second.aligned_address,
+                            entry.second.mapped_range + entry.second.aligned_offset,
+                            PROT_READ | PROT_WRITE);
+    }
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#else
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+bool PageGuardManager::InitializeSoftDirty()
+{
+    return false;
+}
+
+void PageGuardManager::SoftDirtyTerminate() {}
+
+bool PageGuardManager::SoftDirtyClear()
+{
+    return false;
+}
+
+bool PageGuardManager::SoftDirtyIsPageModified(const void* address)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(address);
+
+    return false;
+}
+
+void PageGuardManager::SoftDirtyLoadActiveWriteStates(MemoryInfo* memory_info)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(memory_info);
+}
+
+void PageGuardManager::SoftDirtyReset() {}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // SOFT_DIRTY_SUPPORTED == 1
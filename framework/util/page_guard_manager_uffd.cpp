@@ -48,6 +48,9 @@ static pthread_cond_t  wait_for_threads_cond  = PTHREAD_COND_INITIALIZER;
 static uint32_t        blocked_threads        = 0;
 static uint32_t        threads_to_block       = 0;
 
+// Maximum number of fault messages read from the userfaultfd object at once.
+static const size_t kUffdMessageBatchSize = 64;
+
 std::atomic<bool> PageGuardManager::is_uffd_handler_thread_running_ = { false };
 
 void PageGuardManager::UffdStaticSignalHandler(int sig)
@@ -188,8 +191,8 @@ void PageGuardManager::UffdSignalHandler(int sig)
 
 bool PageGuardManager::UffdSetSignalHandler()
 {
-    // Search for a free RT signal
-    for (int sig = SIGRTMIN; sig < SIGRTMAX + 1; ++sig)
+    // The RT signal is only used to block threads while memory is reset, which is not needed with write protection.
+    for (int sig = SIGRTMIN; (sig < SIGRTMAX + 1) && !uffd_write_protect_; ++sig)
     {
         struct sigaction current_handler = {};
         if (sigaction(sig, nullptr, &current_handler))
@@ -205,7 +208,7 @@ bool PageGuardManager::UffdSetSignalHandler()
         }
     }
 
-    if (uffd_rt_signal_used_ == -1)
+    if ((uffd_rt_signal_used_ == -1) && !uffd_write_protect_)
     {
         GFXRECON_LOG_ERROR(
             "Searched through all RT signals [%d,  %d] and no free signal was found", SIGRTMIN, SIGRTMAX);
@@ -213,6 +216,7 @@ bool PageGuardManager::UffdSetSignalHandler()
     }
 
     // Install signal handler for the RT signal
+    if (uffd_rt_signal_used_ != -1)
     {
         struct sigaction sa = {};
         // Minimize side effects of the RT signal handler by restarting interrupted system calls when possible
@@ -243,7 +247,10 @@ bool PageGuardManager::UffdSetSignalHandler()
 
     // Have uffd_signal_set_ prepared for when we need to block/unblock the signal
     sigemptyset(&uffd_signal_set_);
-    sigaddset(&uffd_signal_set_, uffd_rt_signal_used_);
+    if (uffd_rt_signal_used_ != -1)
+    {
+        sigaddset(&uffd_signal_set_, uffd_rt_signal_used_);
+    }
 
     return true;
 }
@@ -310,7 +317,7 @@ bool PageGuardManager::UffdHandleFault(MemoryInfo* memory_info, uint64_t address
 {
     assert(protection_mode_ == kUserFaultFdMode);
 
-    // Pages are not touched before they are registed so only missing page faults are expected to happen
+    // Write protect faults are handled by UffdHandleWriteProtectFault().
     assert((flags & UFFD_PAGEFAULT_FLAG_WP) != UFFD_PAGEFAULT_FLAG_WP);
 
     memory_info->is_modified = true;
@@ -339,7 +346,8 @@ bool PageGuardManager::UffdHandleFault(MemoryInfo* memory_info, uint64_t address
     {
         memory_info->status_tracker.SetActiveReadBlock(page_index, true);
 
-        if (enable_read_write_same_page_)
+        // With write protection, pages loaded by a read are write protected and a later write to the page is trapped.
+        if (enable_read_write_same_page_ && !uffd_write_protect_)
         {
             // The page guard has been removed from this page.  If we expect both reads and writes to the page,
             // it needs to be marked for active write.
@@ -376,6 +384,11 @@ bool PageGuardManager::UffdHandleFault(MemoryInfo* memory_info, uint64_t address
     copy.len  = system_page_size_;
     copy.mode = wake_thread ? 0 : UFFDIO_COPY_MODE_DONTWAKE;
 
+    if (uffd_write_protect_ && !is_write)
+    {
+        copy.mode |= UFFDIO_COPY_MODE_WP;
+    }
+
     if (ioctl(uffd_fd_, UFFDIO_COPY, &copy))
     {
         if (errno != EEXIST)
@@ -402,6 +415,58 @@ bool PageGuardManager::UffdHandleFault(MemoryInfo* memory_info, uint64_t address
     return true;
 }
 
+bool PageGuardManager::UffdHandleWriteProtectFault(MemoryInfo* memory_info, uint64_t address, bool wake_thread)
+{
+    assert(protection_mode_ == kUserFaultFdMode);
+    assert(uffd_write_protect_);
+    assert((memory_info != nullptr) && (memory_info->aligned_address != nullptr));
+    assert(static_cast<uintptr_t>(address) >= reinterpret_cast<uintptr_t>(memory_info->aligned_address));
+
+    const size_t start_offset =
+        reinterpret_cast<uint8_t*>(address) - static_cast<uint8_t*>(memory_info->aligned_address);
+    const size_t page_index = start_offset >> system_page_pot_shift_;
+
+    memory_info->is_modified = true;
+    memory_info->status_tracker.SetActiveWriteBlock(page_index, true);
+
+    // Remove the write protection from the page, which allows the faulting thread to complete the write.  The page is
+    // protected again when the modified memory is processed.
+    void* page_address = static_cast<uint8_t*>(memory_info->aligned_address) + (page_index << system_page_pot_shift_);
+
+    return UffdWriteProtect(page_address, system_page_size_, false, wake_thread);
+}
+
+bool PageGuardManager::UffdWriteProtect(void* address, size_t length, bool protect, bool wake_threads)
+{
+    assert(uffd_fd_ != -1);
+
+    // Threads are always woken when protection is added, and the kernel rejects the DONTWAKE flag in that case.
+    struct uffdio_writeprotect uffdio_writeprotect;
+    uffdio_writeprotect.range.start = GFXRECON_PTR_TO_UINT64(address);
+    uffdio_writeprotect.range.len   = static_cast<uint64_t>(length);
+    uffdio_writeprotect.mode        = protect ? UFFDIO_WRITEPROTECT_MODE_WP
+                                              : (wake_threads ? 0 : UFFDIO_WRITEPROTECT_MODE_DONTWAKE);
+
+    if (ioctl(uffd_fd_, UFFDIO_WRITEPROTECT, &uffdio_writeprotect) == -1)
+    {
+        GFXRECON_LOG_ERROR("ioctl/uffdio_writeprotect: %s", strerror(errno));
+        GFXRECON_LOG_ERROR("uffdio_writeprotect.range.start: 0x%" PRIx64, uffdio_writeprotect.range.start);
+        GFXRECON_LOG_ERROR("uffdio_writeprotect.range.len: %" PRIu64, uffdio_writeprotect.range.len);
+        return false;
+    }
+
+    return true;
+}
+
+void PageGuardManager::UffdReleasePages(void* address, size_t length)
+{
+    // Released pages of a registered region are reported as missing pages on their next access.
+    if (madvise(address, length, MADV_DONTNEED))
+    {
+        GFXRECON_LOG_ERROR("madvise/MADV_DONTNEED: %s", strerror(errno));
+    }
+}
+
 bool PageGuardManager::UffdWakeFaultingThread(uint64_t address)
 {
     struct uffdio_range uffdio_wake;
@@ -423,7 +488,8 @@ void* PageGuardManager::UffdHandlerThread(void* args)
 
     while (true)
     {
-        struct uffd_msg msg[16];
+        // Read faults in batches.  Faulting threads are woken after the whole batch has been handled.
+        struct uffd_msg msg[kUffdMessageBatchSize];
         const int64_t   readres = read(uffd_fd_, &msg, sizeof(msg));
 
         tracked_memory_lock_.lock();
@@ -443,11 +509,6 @@ void* PageGuardManager::UffdHandlerThread(void* args)
             }
         }
 
-        if (readres == sizeof(msg))
-        {
-            GFXRECON_LOG_ERROR("Messages might have been lost");
-        }
-
         const unsigned int n_messages = readres / sizeof(struct uffd_msg);
         for (unsigned int i = 0; i < n_messages; ++i)
         {
@@ -465,13 +526,21 @@ void* PageGuardManager::UffdHandlerThread(void* args)
             uffd_fault_causing_threads.insert(static_cast<uint64_t>(msg[i].arg.pagefault.feat.ptid));
 
             // Skip repeating faults on the same page
-            if (i && (msg[i].arg.pagefault.address % system_page_size_) ==
-                         (msg[i - 1].arg.pagefault.address % system_page_size_))
+            if (i && (msg[i].arg.pagefault.address >> system_page_pot_shift_) ==
+                         (msg[i - 1].arg.pagefault.address >> system_page_pot_shift_))
             {
                 continue;
             }
 
-            UffdHandleFault(memory_info, msg[i].arg.pagefault.address, msg[i].arg.pagefault.flags, n_messages == 1);
+            if ((msg[i].arg.pagefault.flags & UFFD_PAGEFAULT_FLAG_WP) == UFFD_PAGEFAULT_FLAG_WP)
+            {
+                UffdHandleWriteProtectFault(memory_info, msg[i].arg.pagefault.address, n_messages == 1);
+            }
+            else
+            {
+                UffdHandleFault(
+                    memory_info, msg[i].arg.pagefault.address, msg[i].arg.pagefault.flags, n_messages == 1);
+            }
         }
 
         // When there are multiple messages from multiple threads deferre waking
@@ -525,6 +594,31 @@ bool PageGuardManager::UffdInit()
 {
     assert(uffd_fd_ == -1);
 
+    // Features can only be enabled once for a userfaultfd object, so the supported features are queried with a
+    // temporary object.  Write protection for anonymous memory requires Linux 5.7.
+    uffd_write_protect_ = false;
+
+    int query_fd = syscall(SYS_userfaultfd, UFFD_USER_MODE_ONLY | O_CLOEXEC);
+    if (query_fd != -1)
+    {
+        struct uffdio_api query_api;
+        query_api.api      = UFFD_API;
+        query_api.features = 0;
+        if (ioctl(query_fd, UFFDIO_API, &query_api) != -1)
+        {
+            uffd_write_protect_ =
+                (query_api.features & UFFD_FEATURE_PAGEFAULT_FLAG_WP) == UFFD_FEATURE_PAGEFAULT_FLAG_WP;
+        }
+
+        close(query_fd);
+    }
+
+    if (!uffd_write_protect_)
+    {
+        GFXRECON_LOG_INFO("userfaultfd write protection is not supported; threads accessing tracked memory will be "
+                          "blocked with a signal while the memory is reset");
+    }
+
     // open the userfault fd
     uffd_fd_ = syscall(SYS_userfaultfd, UFFD_USER_MODE_ONLY | O_CLOEXEC);
     if (uffd_fd_ == -1)
@@ -536,7 +630,7 @@ bool PageGuardManager::UffdInit()
     // enable for api version and check features
     struct uffdio_api uffdio_api;
     uffdio_api.api      = UFFD_API;
-    uffdio_api.features = UFFD_FEATURE_THREAD_ID;
+    uffdio_api.features = UFFD_FEATURE_THREAD_ID | (uffd_write_protect_ ? UFFD_FEATURE_PAGEFAULT_FLAG_WP : 0);
     if (ioctl(uffd_fd_, UFFDIO_API, &uffdio_api) == -1)
     {
         GFXRECON_LOG_ERROR("ioctl/uffdio_api: %s", strerror(errno));
@@ -634,7 +728,7 @@ bool PageGuardManager::UffdRegisterMemory(const void* address, size_t length)
     struct uffdio_register uffdio_register;
     uffdio_register.range.start = GFXRECON_PTR_TO_UINT64(address);
     uffdio_register.range.len   = length;
-    uffdio_register.mode        = UFFDIO_REGISTER_MODE_MISSING;
+    uffdio_register.mode        = UFFDIO_REGISTER_MODE_MISSING | (uffd_write_protect_ ? UFFDIO_REGISTER_MODE_WP : 0);
     if (ioctl(uffd_fd_, UFFDIO_REGISTER, &uffdio_register) == -1)
     {
         GFXRECON_LOG_ERROR("ioctl/uffdio_register: %s", strerror(errno));
@@ -643,7 +737,8 @@ bool PageGuardManager::UffdRegisterMemory(const void* address, size_t length)
         return false;
     }
 
-    const uint64_t expected_ioctls = (uint64_t)0x1 << _UFFDIO_COPY;
+    const uint64_t expected_ioctls =
+        ((uint64_t)0x1 << _UFFDIO_COPY) | (uffd_write_protect_ ? ((uint64_t)0x1 << _UFFDIO_WRITEPROTECT) : 0);
     if ((uffdio_register.ioctls & expected_ioctls) != expected_ioctls)
     {
         GFXRECON_LOG_ERROR("Unexpected userfaultfd ioctl set (expected: 0x%llx got: 0x%llx)\n",
@@ -912,6 +1007,22 @@ bool PageGuardManager::UffdResetRegion(void* guard_address, size_t guard_range)
     return true;
 }
 
+bool PageGuardManager::UffdWriteProtect(void* address, size_t length, bool protect, bool wake_threads)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(address);
+    GFXRECON_UNREFERENCED_PARAMETER(length);
+    GFXRECON_UNREFERENCED_PARAMETER(protect);
+    GFXRECON_UNREFERENCED_PARAMETER(wake_threads);
+
+    return false;
+}
+
+void PageGuardManager::UffdReleasePages(void* address, size_t length)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(address);
+    GFXRECON_UNREFERENCED_PARAMETER(length);
+}
+
 void PageGuardManager::UffdBlockRtSignal() {}
 
 void PageGuardManager::UffdUnblockRtSignal() {}
@@ -32,28 +32,141 @@
 #include <cstdint>
 #include <vector>
 
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
+// Tracks the read and write status of memory pages with one bit per page.  Active pages are found by scanning the
+// status words, which skips 64 inactive pages per comparison.
 class PageStatusTracker
 {
   public:
-    PageStatusTracker(size_t page_count) : active_writes_(page_count, 0), active_reads_(page_count, 0) {}
+    PageStatusTracker(size_t page_count) :
+        page_count_(page_count), active_writes_(GetWordCount(page_count), 0), active_reads_(GetWordCount(page_count), 0)
+    {}
 
     ~PageStatusTracker() {}
 
-    bool IsActiveWriteBlock(size_t index) const { return (active_writes_[index] == 1); }
-    bool IsActiveReadBlock(size_t index) const { return (active_reads_[index] == 1); }
+    bool IsActiveWriteBlock(size_t index) const { return (active_writes_[GetWordIndex(index)] & GetBit(index)) != 0; }
+    bool IsActiveReadBlock(size_t index) const { return (active_reads_[GetWordIndex(index)] & GetBit(index)) != 0; }
+
+    void SetActiveWriteBlock(size_t index, bool value) { SetBit(&active_writes_, index, value); }
+    void SetActiveReadBlock(size_t index, bool value) { SetBit(&active_reads_, index, value); }
+
+    void SetAllBlocksActiveWrite()
+    {
+        std::fill(active_writes_.begin(), active_writes_.end(), ~Word{ 0 });
+
+        // Keep the bits past the last page clear, so that searches for active blocks do not find them.
+        if ((page_count_ & kWordMask) != 0)
+        {
+            active_writes_.back() = (Word{ 1 } << (page_count_ & kWordMask)) - 1;
+        }
+    }
 
-    void SetActiveWriteBlock(size_t index, bool value) { active_writes_[index] = value ? 1 : 0; }
-    void SetActiveReadBlock(size_t index, bool value) { active_reads_[index] = value ? 1 : 0; }
+    // Returns the index of the first block at or after start_index that was read or written, or the page count when
+    // there is no such block.
+    size_t FindNextActiveBlock(size_t start_index) const
+    {
+        return FindNext(start_index, [this](size_t i) { return active_writes_[i] | active_reads_[i]; });
+    }
 
-    void SetAllBlocksActiveWrite() { std::fill(active_writes_.begin(), active_writes_.end(), 1); }
+    // Returns the index of the first block at or after start_index that was not written, or the page count when there
+    // is no such block.
+    size_t FindNextInactiveWriteBlock(size_t start_index) const
+    {
+        return FindNext(start_index, [this](size_t i) { return ~active_writes_[i]; });
+    }
+
+    // Returns the index of the first block at or after start_index that was written or was not read, or the page count
+    // when there is no such block.
+    size_t FindNextInactiveReadOnlyBlock(size_t start_index) const
+    {
+        return FindNext(start_index, [this](size_t i) { return active_writes_[i] | ~active_reads_[i]; });
+    }
+
+    // Clears the read and write status of the blocks in the range [start_index, end_index).
+    void ClearBlocks(size_t start_index, size_t end_index)
+    {
+        for (size_t i = start_index; i < end_index; ++i)
+        {
+            SetBit(&active_writes_, i, false);
+            SetBit(&active_reads_, i, false);
+        }
+    }
 
   private:
-    typedef std::vector<uint8_t> PageStatus;
+    typedef uint64_t          Word;
+    typedef std::vector<Word> PageStatus;
+
+    static const size_t kWordShift = 6;
+    static const size_t kWordMask  = (size_t{ 1 } << kWordShift) - 1;
+
+    static size_t GetWordCount(size_t page_count) { return (page_count + kWordMask) >> kWordShift; }
+    static size_t GetWordIndex(size_t index) { return index >> kWordShift; }
+    static Word   GetBit(size_t index) { return Word{ 1 } << (index & kWordMask); }
+
+    static void SetBit(PageStatus* status, size_t index, bool value)
+    {
+        if (value)
+        {
+            (*status)[GetWordIndex(index)] |= GetBit(index);
+        }
+        else
+        {
+            (*status)[GetWordIndex(index)] &= ~GetBit(index);
+        }
+    }
+
+    static size_t CountTrailingZeros(Word word)
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index = 0;
+#if defined(_WIN64)
+        _BitScanForward64(&index, word);
+#else
+        if (!_BitScanForward(&index, static_cast<unsigned long>(word)))
+        {
+            _BitScanForward(&index, static_cast<unsigned long>(word >> 32));
+            index += 32;
+        }
+#endif
+        return static_cast<size_t>(index);
+#else
+        return static_cast<size_t>(__builtin_ctzll(word));
+#endif
+    }
+
+    // Searches for the first set bit at or after start_index in the words produced by get_word.
+    template <typename GetWord>
+    size_t FindNext(size_t start_index, GetWord get_word) const
+    {
+        size_t result = page_count_;
+
+        if (start_index < page_count_)
+        {
+            size_t word_index = GetWordIndex(start_index);
+            Word   word       = get_word(word_index) & (~Word{ 0 } << (start_index & kWordMask));
+
+            while ((word == 0) && (++word_index < active_writes_.size()))
+            {
+                word = get_word(word_index);
+            }
+
+            if (word != 0)
+            {
+                result = std::min((word_index << kWordShift) + CountTrailingZeros(word), page_count_);
+            }
+        }
+
+        return result;
+    }
 
   private:
+    size_t     page_count_;
     PageStatus active_writes_; //< Track blocks that have been written.
     PageStatus active_reads_;  //< Track blocks that have been read.
 };
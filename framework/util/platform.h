@@ -41,6 +41,7 @@
 #endif
 #include <windows.h>
 #include <direct.h>
+#include <io.h>
 #else // WIN32
 #include <dlfcn.h>
 #include <errno.h>
@@ -260,6 +261,45 @@ inline int GetSystemLastErrorCode()
     return GetLastError();
 }
 
+// Maps the entire contents of an open file for read-only access. Returns nullptr on failure.
+inline const void* MapFile(FILE* stream, size_t size)
+{
+    HANDLE file    = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(stream)));
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+    if (mapping == nullptr)
+    {
+        return nullptr;
+    }
+
+    // The view holds a reference to the mapping object, so the handle can be closed immediately.
+    void* memory = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, size);
+    CloseHandle(mapping);
+
+    return memory;
+}
+
+inline void UnmapFile(const void* memory, size_t size)
+{
+    assert(memory != nullptr);
+
+    GFXRECON_UNREFERENCED_PARAMETER(size);
+    UnmapViewOfFile(memory);
+}
+
+// Access pattern hints are not required for correctness and are not implemented for Windows.
+inline void AdviseSequentialAccess(const void* memory, size_t size)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(memory);
+    GFXRECON_UNREFERENCED_PARAMETER(size);
+}
+
+inline void AdviseWillNeed(const void* memory, size_t size)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(memory);
+    GFXRECON_UNREFERENCED_PARAMETER(size);
+}
+
 #else // !defined(WIN32)
 
 // Error value indicating string was truncated
@@ -568,6 +608,38 @@ inline int GetSystemLastErrorCode()
     return errno;
 }
 
+// Maps the entire contents of an open file for read-only access. Returns nullptr on failure.
+inline const void* MapFile(FILE* stream, size_t size)
+{
+    void* memory = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileno(stream), 0);
+
+    if (memory == MAP_FAILED)
+    {
+        return nullptr;
+    }
+
+    return memory;
+}
+
+inline void UnmapFile(const void* memory, size_t size)
+{
+    assert(memory != nullptr);
+
+    munmap(const_cast<void*>(memory), size);
+}
+
+// The memory address must be aligned to the system page size.
+inline void AdviseSequentialAccess(const void* memory, size_t size)
+{
+    madvise(const_cast<void*>(memory), size, MADV_SEQUENTIAL);
+}
+
+// The memory address must be aligned to the system page size.
+inline void AdviseWillNeed(const void* memory, size_t size)
+{
+    madvise(const_cast<void*>(memory), size, MADV_WILLNEED);
+}
+
 #endif // WIN32
 
 inline size_t GetAlignedSize(size_t size, size_t align_to)
@@ -0,0 +1,151 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_SORTED_VECTOR_H
+#define GFXRECON_UTIL_SORTED_VECTOR_H
+
+#include "util/defines.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Set and map replacements for small collections that are cleared and refilled often, such as the handles referenced
+// by a command buffer. Entries are stored in a sorted vector, which keeps its capacity when cleared, so refilling the
+// collection does not allocate. Inserting a value that sorts after all existing values, which is common for handle IDs,
+// appends it without moving other entries.
+template <typename T, typename Compare = std::less<T>>
+class SortedVectorSet
+{
+  public:
+    typedef typename std::vector<T>::const_iterator const_iterator;
+
+  public:
+    // Returns false when the value is already in the set.
+    bool insert(const T& value)
+    {
+        if (values_.empty() || Compare()(values_.back(), value))
+        {
+            values_.push_back(value);
+            return true;
+        }
+
+        auto entry = std::lower_bound(values_.begin(), values_.end(), value, Compare());
+        if (!Compare()(value, *entry))
+        {
+            return false;
+        }
+
+        values_.insert(entry, value);
+        return true;
+    }
+
+    size_t count(const T& value) const
+    {
+        return std::binary_search(values_.begin(), values_.end(), value, Compare()) ? 1 : 0;
+    }
+
+    void clear() { values_.clear(); }
+
+    bool empty() const { return values_.empty(); }
+
+    size_t size() const { return values_.size(); }
+
+    const_iterator begin() const { return values_.begin(); }
+
+    const_iterator end() const { return values_.end(); }
+
+  private:
+    std::vector<T> values_;
+};
+
+template <typename Key, typename Value, typename Compare = std::less<Key>>
+class SortedVectorMap
+{
+  public:
+    typedef std::pair<Key, Value>                            value_type;
+    typedef typename std::vector<value_type>::iterator       iterator;
+    typedef typename std::vector<value_type>::const_iterator const_iterator;
+
+  public:
+    // Returns the value for the key, inserting a default constructed value if the key is not in the map.
+    Value& operator[](const Key& key)
+    {
+        if (entries_.empty() || Compare()(entries_.back().first, key))
+        {
+            entries_.emplace_back(key, Value());
+            return entries_.back().second;
+        }
+
+        auto entry = LowerBound(key);
+        if (Compare()(key, entry->first))
+        {
+            entry = entries_.emplace(entry, key, Value());
+        }
+
+        return entry->second;
+    }
+
+    iterator find(const Key& key)
+    {
+        auto entry = LowerBound(key);
+        return ((entry != entries_.end()) && !Compare()(key, entry->first)) ? entry : entries_.end();
+    }
+
+    const_iterator find(const Key& key) const
+    {
+        auto entry = std::lower_bound(entries_.begin(), entries_.end(), key, CompareKey);
+        return ((entry != entries_.end()) && !Compare()(key, entry->first)) ? entry : entries_.end();
+    }
+
+    void clear() { entries_.clear(); }
+
+    bool empty() const { return entries_.empty(); }
+
+    size_t size() const { return entries_.size(); }
+
+    iterator begin() { return entries_.begin(); }
+
+    iterator end() { return entries_.end(); }
+
+    const_iterator begin() const { return entries_.begin(); }
+
+    const_iterator end() const { return entries_.end(); }
+
+  private:
+    static bool CompareKey(const value_type& entry, const Key& key) { return Compare()(entry.first, key); }
+
+    iterator LowerBound(const Key& key) { return std::lower_bound(entries_.begin(), entries_.end(), key, CompareKey); }
+
+  private:
+    std::vector<value_type> entries_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_SORTED_VECTOR_H
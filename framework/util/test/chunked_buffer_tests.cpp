@@ -0,0 +1,143 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/chunked_buffer.h"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+using namespace gfxrecon::util;
+
+namespace
+{
+
+std::vector<uint8_t> ReadAll(const ChunkedBuffer& buffer)
+{
+    std::vector<uint8_t> data;
+    for (const auto& chunk : buffer.GetChunks())
+    {
+        REQUIRE(chunk.size <= chunk.capacity);
+        data.insert(data.end(), chunk.data.get(), chunk.data.get() + chunk.size);
+    }
+
+    return data;
+}
+
+} // namespace
+
+TEST_CASE("ChunkedBuffer keeps each write in a single chunk", "[chunked_buffer][pre_submit]")
+{
+    const size_t kChunkSize = 64;
+
+    auto          pool = std::make_shared<ChunkedBufferPool>(kChunkSize);
+    ChunkedBuffer buffer;
+    buffer.SetPool(pool);
+
+    std::vector<uint8_t> expected;
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        // Record sizes include some that do not fit in the space left in a chunk, and some larger than a chunk.
+        std::vector<uint8_t> record(((i * 7) % 40) + ((i % 25) == 0 ? 100 : 1), static_cast<uint8_t>(i));
+
+        const size_t chunk_count = buffer.GetChunks().size();
+        buffer.Write(record.data(), record.size());
+        expected.insert(expected.end(), record.begin(), record.end());
+
+        const auto& chunk = buffer.GetChunks().back();
+        REQUIRE(std::memcmp(chunk.data.get() + chunk.size - record.size(), record.data(), record.size()) == 0);
+
+        if (record.size() > kChunkSize)
+        {
+            REQUIRE(buffer.GetChunks().size() == (chunk_count + 1));
+            REQUIRE(chunk.capacity == record.size());
+        }
+    }
+
+    REQUIRE(buffer.GetDataSize() == expected.size());
+    REQUIRE(ReadAll(buffer) == expected);
+}
+
+TEST_CASE("ChunkedBuffer returns chunks to the pool for reuse", "[chunked_buffer][pre_submit]")
+{
+    const size_t kChunkSize = 64;
+
+    auto          pool = std::make_shared<ChunkedBufferPool>(kChunkSize);
+    ChunkedBuffer first;
+    ChunkedBuffer second;
+    first.SetPool(pool);
+    second.SetPool(pool);
+
+    uint8_t record[48] = {};
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        first.Write(record, sizeof(record));
+    }
+
+    // An oversized chunk is freed rather than kept by the pool.
+    uint8_t large[kChunkSize * 2] = {};
+    first.Write(large, sizeof(large));
+
+    REQUIRE(first.GetChunks().size() == 5);
+    std::vector<const uint8_t*> chunks;
+    for (const auto& chunk : first.GetChunks())
+    {
+        chunks.push_back(chunk.data.get());
+    }
+
+    first.Clear();
+    REQUIRE(first.GetDataSize() == 0);
+    REQUIRE(first.GetChunks().empty());
+    REQUIRE(pool->GetFreeChunkCount() == 4);
+
+    // Another buffer from the same pool reuses the released chunks.
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        second.Write(record, sizeof(record));
+        REQUIRE(std::find(chunks.begin(), chunks.end(), second.GetChunks().back().data.get()) != chunks.end());
+    }
+
+    REQUIRE(pool->GetFreeChunkCount() == 0);
+
+    second.Clear();
+    pool->Trim();
+    REQUIRE(pool->GetFreeChunkCount() == 0);
+}
+
+TEST_CASE("ChunkedBuffer works without a pool", "[chunked_buffer][pre_submit]")
+{
+    ChunkedBuffer buffer;
+
+    std::vector<uint8_t> expected(ChunkedBufferPool::kDefaultChunkSize + 10, 0xab);
+    buffer.Write(expected.data(), 10);
+    buffer.Write(expected.data() + 10, ChunkedBufferPool::kDefaultChunkSize);
+
+    REQUIRE(buffer.GetChunks().size() == 2);
+    REQUIRE(ReadAll(buffer) == expected);
+
+    buffer.Clear();
+    REQUIRE(buffer.GetDataSize() == 0);
+}
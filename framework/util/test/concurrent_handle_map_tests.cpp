@@ -0,0 +1,189 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/concurrent_handle_map.h"
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <thread>
+#include <vector>
+
+using gfxrecon::util::ConcurrentHandleMap;
+
+TEST_CASE("ConcurrentHandleMap inserts, finds, and removes entries", "[concurrent_handle_map][pre_submit]")
+{
+    const uint64_t kCount = 10000;
+
+    std::vector<int>         values(kCount);
+    ConcurrentHandleMap<int> map;
+
+    REQUIRE(map.Find(1) == nullptr);
+    REQUIRE(!map.Remove(1));
+
+    for (uint64_t i = 0; i < kCount; ++i)
+    {
+        REQUIRE(map.Insert(i + 1, &values[i]));
+    }
+
+    // Existing entries are not replaced.
+    REQUIRE(!map.Insert(1, &values[1]));
+    REQUIRE(map.Find(1) == &values[0]);
+
+    for (uint64_t i = 0; i < kCount; ++i)
+    {
+        REQUIRE(map.Find(i + 1) == &values[i]);
+    }
+
+    REQUIRE(map.Find(kCount + 1) == nullptr);
+
+    for (uint64_t i = 0; i < kCount; i += 2)
+    {
+        REQUIRE(map.Remove(i + 1));
+        REQUIRE(!map.Remove(i + 1));
+    }
+
+    for (uint64_t i = 0; i < kCount; ++i)
+    {
+        REQUIRE(map.Find(i + 1) == (((i % 2) == 0) ? nullptr : &values[i]));
+    }
+
+    // Removed keys can be inserted again.
+    REQUIRE(map.Insert(1, &values[1]));
+    REQUIRE(map.Find(1) == &values[1]);
+
+    std::map<uint64_t, int*> visited;
+    map.Visit([&visited](uint64_t key, int* value) { REQUIRE(visited.emplace(key, value).second); });
+
+    REQUIRE(visited.size() == ((kCount / 2) + 1));
+    REQUIRE(visited[1] == &values[1]);
+    REQUIRE(visited[kCount] == &values[kCount - 1]);
+}
+
+TEST_CASE("ConcurrentHandleMap reclaims removed entries", "[concurrent_handle_map][pre_submit]")
+{
+    // Handle values are often reused, while handle IDs are not. Creating and destroying objects with new keys fills
+    // slots with removed entries, which must be reclaimed without losing the live entries.
+    const uint64_t kLiveCount = 100;
+    const uint64_t kCycles    = 100000;
+
+    int                      value = 0;
+    ConcurrentHandleMap<int> map;
+
+    for (uint64_t i = 0; i < kLiveCount; ++i)
+    {
+        REQUIRE(map.Insert(0x1000 + (i * 0x40), &value));
+    }
+
+    for (uint64_t i = 0; i < kCycles; ++i)
+    {
+        REQUIRE(map.Insert(0x100000 + i, &value));
+        REQUIRE(map.Remove(0x100000 + i));
+    }
+
+    size_t count = 0;
+    map.Visit([&count](uint64_t, int*) { ++count; });
+    REQUIRE(count == kLiveCount);
+
+    for (uint64_t i = 0; i < kLiveCount; ++i)
+    {
+        REQUIRE(map.Find(0x1000 + (i * 0x40)) == &value);
+    }
+}
+
+TEST_CASE("ConcurrentHandleMap finds entries while other threads modify the map", "[concurrent_handle_map][pre_submit]")
+{
+    const uint64_t kStableCount = 1000;
+    const uint64_t kWriterCount = 4;
+    const uint64_t kReaderCount = 4;
+    const uint64_t kCycles      = 20000;
+
+    std::vector<int>         values(kStableCount);
+    int                      temporary_value = 0;
+    ConcurrentHandleMap<int> map;
+
+    for (uint64_t i = 0; i < kStableCount; ++i)
+    {
+        REQUIRE(map.Insert(i + 1, &values[i]));
+    }
+
+    std::atomic<bool>     done{ false };
+    std::atomic<uint64_t> failures{ 0 };
+
+    std::vector<std::thread> readers;
+    for (uint64_t r = 0; r < kReaderCount; ++r)
+    {
+        readers.emplace_back([&]() {
+            uint64_t i = 0;
+            while (!done.load())
+            {
+                if (map.Find((i % kStableCount) + 1) != &values[i % kStableCount])
+                {
+                    ++failures;
+                }
+
+                ++i;
+            }
+        });
+    }
+
+    // Writers use disjoint keys, growing and compacting the tables that the readers probe.
+    std::vector<std::thread> writers;
+    for (uint64_t w = 0; w < kWriterCount; ++w)
+    {
+        writers.emplace_back([&, w]() {
+            const uint64_t base = (w + 1) << 32;
+            for (uint64_t i = 0; i < kCycles; ++i)
+            {
+                if (!map.Insert(base + i, &temporary_value) || (map.Find(base + i) != &temporary_value))
+                {
+                    ++failures;
+                }
+
+                if ((i % 4) != 0)
+                {
+                    map.Remove(base + i);
+                }
+            }
+        });
+    }
+
+    for (auto& writer : writers)
+    {
+        writer.join();
+    }
+
+    done = true;
+
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    REQUIRE(failures.load() == 0);
+
+    size_t count = 0;
+    map.Visit([&count](uint64_t, int*) { ++count; });
+    REQUIRE(count == (kStableCount + (kWriterCount * kCycles / 4)));
+}
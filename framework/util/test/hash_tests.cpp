@@ -0,0 +1,101 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/hash.h"
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using gfxrecon::util::hash::XxHash64;
+
+// Reference values were computed with the xxHash library's XXH64.
+TEST_CASE("XxHash64 matches reference values for strings", "[hash][pre_submit]")
+{
+    struct Vector
+    {
+        const char* input;
+        uint64_t    seed;
+        uint64_t    hash;
+    };
+
+    const Vector kVectors[] = {
+        { "", 0, 0xEF46DB3751D8E999ull },
+        { "a", 0, 0xD24EC4F1A98C6E5Bull },
+        { "abc", 0, 0x44BC2CF5AD770999ull },
+        { "abc", 1, 0xBEA9CA8199328908ull },
+        { "message digest", 0, 0x066ED728FCEEB3BEull },
+        { "abcdefghijklmnopqrstuvwxyz", 0, 0xCFE1F278FA89835Cull },
+        { "abcdefghijklmnopqrstuvwxyz", 0x9E3779B97F4A7C15ull, 0x9C220416FEA109C1ull },
+        { "12345678901234567890123456789012345678901234567890123456789012345678901234567890", 0, 0xE04A477F19EE145Dull }
+    };
+
+    for (const auto& vector : kVectors)
+    {
+        REQUIRE(XxHash64(vector.input, strlen(vector.input), vector.seed) == vector.hash);
+    }
+}
+
+// Covers inputs shorter than one 32 byte stripe, whole stripes, and 8, 4, and 1 byte tails after the stripes, read
+// from both aligned and unaligned addresses.
+TEST_CASE("XxHash64 matches reference values around stripe boundaries", "[hash][pre_submit]")
+{
+    struct Vector
+    {
+        size_t   size;
+        uint64_t aligned_hash;   // Hash of pattern[0, size).
+        uint64_t unaligned_hash; // Hash of pattern[1, size + 1).
+    };
+
+    const Vector kVectors[] = { { 31, 0xA2AA5F33CC4A6119ull, 0xA063FF51270B75E9ull },
+                                { 32, 0x23C3C17EF790FD97ull, 0x40B7DE765EAF0171ull },
+                                { 33, 0x50A7CFC7BA588784ull, 0x47C5C5A56181E28Eull },
+                                { 63, 0x5E3E54B431C7493Cull, 0xB3C1234E5451EC0Bull },
+                                { 64, 0x0EB64B3EF6EEB01Full, 0x3DD86AD1CB274819ull },
+                                { 65, 0xA383B724B2BD12F1ull, 0x77AC8541F29B215Dull },
+                                { 100, 0xA61F8D4C170FE531ull, 0x233714D9F50860F5ull } };
+
+    // Aligned to 8 bytes, so that offset 1 is unaligned for the 8 and 4 byte reads.
+    std::vector<uint64_t> storage(16);
+    uint8_t*              pattern = reinterpret_cast<uint8_t*>(storage.data());
+
+    for (size_t i = 0; i < 101; ++i)
+    {
+        pattern[i] = static_cast<uint8_t>((i * 7) + 3);
+    }
+
+    for (const auto& vector : kVectors)
+    {
+        REQUIRE(XxHash64(pattern, vector.size) == vector.aligned_hash);
+        REQUIRE(XxHash64(pattern + 1, vector.size) == vector.unaligned_hash);
+    }
+}
+
+TEST_CASE("XxHash64 hashes empty input independently of the data pointer", "[hash][pre_submit]")
+{
+    const uint8_t byte = 0xff;
+
+    REQUIRE(XxHash64(nullptr, 0) == 0xEF46DB3751D8E999ull);
+    REQUIRE(XxHash64(&byte, 0) == 0xEF46DB3751D8E999ull);
+}
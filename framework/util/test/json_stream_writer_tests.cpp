@@ -0,0 +1,182 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/json_stream_writer.h"
+#include "util/json_util.h"
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+
+using gfxrecon::util::JsonStreamWriter;
+
+static const int kIndentWidths[] = { -1, 0, gfxrecon::util::kJsonIndentWidth };
+
+static const char kEscapedText[] = "quote \" backslash \\ tab \t control \x01\x1f utf-8 \xc3\xa9";
+
+TEST_CASE("JsonStreamWriter matches nlohmann::json serialization", "[json][pre_submit]")
+{
+    nlohmann::ordered_json args;
+    args["device"]  = uint64_t{ 0x1234 };
+    args["offset"]  = int64_t{ -42 };
+    args["name"]    = kEscapedText;
+    args["enabled"] = true;
+    args["empty"]   = nlohmann::ordered_json::object();
+    args["values"]  = { 1.5, 2, "three" };
+    args["nothing"] = nullptr;
+
+    args["nested"]["a"]["b"] = nlohmann::ordered_json::array();
+
+    for (int indent_width : kIndentWidths)
+    {
+        nlohmann::ordered_json tree;
+        tree["index"] = uint64_t{ 7 };
+
+        nlohmann::ordered_json& call = tree["function"];
+        call["name"]                 = "vkCmdDraw";
+        call["thread"]               = uint64_t{ 1 };
+        call["list"]                 = { 1, -2, false };
+        call["empty_list"]           = nlohmann::ordered_json::array();
+        call["return"]               = "VK_SUCCESS";
+        call["args"]                 = args;
+
+        JsonStreamWriter writer(indent_width);
+        writer.BeginObject();
+        writer.Key("index");
+        writer.UInt(7);
+        writer.Key("function");
+        writer.BeginObject();
+        writer.Key("name");
+        writer.String("vkCmdDraw");
+        writer.Key("thread");
+        writer.UInt(1);
+        writer.Key("list");
+        writer.BeginArray();
+        writer.Int(1);
+        writer.Int(-2);
+        writer.Bool(false);
+        writer.EndArray();
+        writer.Key("empty_list");
+        writer.BeginArray();
+        writer.EndArray();
+
+        nlohmann::ordered_json members;
+        members["return"] = "VK_SUCCESS";
+        members["args"]   = args;
+        writer.Members(members);
+
+        writer.EndObject();
+        writer.EndObject();
+
+        REQUIRE(writer.GetDepth() == 0);
+        REQUIRE(writer.GetBuffer() == tree.dump(indent_width));
+
+        // The buffer is reused for the next value.
+        writer.ClearBuffer();
+        writer.BeginObject();
+        writer.Key("text \n");
+        writer.String(kEscapedText);
+        writer.Key("null");
+        writer.Null();
+        writer.Key("empty");
+        writer.BeginObject();
+        writer.EndObject();
+        writer.EndObject();
+
+        nlohmann::ordered_json small;
+        small["text \n"] = kEscapedText;
+        small["null"]    = nullptr;
+        small["empty"]   = nlohmann::ordered_json::object();
+
+        REQUIRE(writer.GetBuffer() == small.dump(indent_width));
+    }
+}
+
+TEST_CASE("JsonStreamWriter formats numbers as nlohmann::json does", "[json][pre_submit]")
+{
+    const double kValues[] = { 0.0,
+                               -0.0,
+                               1.0,
+                               -1.5,
+                               100.0,
+                               0.1,
+                               0.0001,
+                               0.00001,
+                               1e15,
+                               1e16,
+                               123456789012345.0,
+                               1234567890123456.0,
+                               1e100,
+                               -2.5e-100,
+                               5e-324,
+                               2.2250738585072014e-308,
+                               1.7976931348623157e308,
+                               static_cast<double>(0.1f),
+                               static_cast<double>(-219.6f),
+                               std::numeric_limits<double>::infinity(),
+                               std::numeric_limits<double>::quiet_NaN() };
+
+    for (double value : kValues)
+    {
+        JsonStreamWriter writer(-1);
+        writer.Double(value);
+        REQUIRE(writer.GetBuffer() == nlohmann::ordered_json(value).dump());
+    }
+
+    // Any double, including those converted from floats, which are the most common in capture files.
+    std::mt19937_64 random(1);
+
+    for (size_t i = 0; i < 100000; ++i)
+    {
+        const uint64_t bits   = random();
+        double         value  = 0;
+        float          single = 0;
+
+        std::memcpy(&value, &bits, sizeof(value));
+        std::memcpy(&single, &bits, sizeof(single));
+
+        for (double number : { value, static_cast<double>(single) })
+        {
+            JsonStreamWriter writer(-1);
+            writer.Double(number);
+            REQUIRE(writer.GetBuffer() == nlohmann::ordered_json(number).dump());
+        }
+    }
+
+    nlohmann::ordered_json tree;
+    tree["float"]    = 0.5f;
+    tree["double"]   = -1e-7;
+    tree["integer"]  = int64_t{ INT64_MIN };
+    tree["unsigned"] = uint64_t{ UINT64_MAX };
+    tree["values"]   = { 1.25, -0.0, uint64_t{ 0 }, int64_t{ -1 } };
+
+    for (int indent_width : kIndentWidths)
+    {
+        JsonStreamWriter writer(indent_width);
+        writer.Value(tree);
+        REQUIRE(writer.GetBuffer() == tree.dump(indent_width));
+    }
+}
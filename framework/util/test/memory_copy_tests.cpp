@@ -0,0 +1,125 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/memory_copy.h"
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using gfxrecon::util::MemoryCopyKernel;
+
+static const MemoryCopyKernel kKernels[] = { MemoryCopyKernel::kScalar,
+                                             MemoryCopyKernel::kSse2,
+                                             MemoryCopyKernel::kAvx2 };
+
+TEST_CASE("StreamingMemoryCopy copies unaligned ranges", "[memory_copy][pre_submit]")
+{
+    const size_t kPadding = 64;
+    const size_t kSizes[] = { 0, 1, 15, 255, 256, 257, 1000, 4096, 65536 + 33 };
+
+    std::vector<uint8_t> source(65536 + 256);
+    for (size_t i = 0; i < source.size(); ++i)
+    {
+        source[i] = static_cast<uint8_t>((i * 31) + 7);
+    }
+
+    for (auto kernel : kKernels)
+    {
+        for (auto size : kSizes)
+        {
+            for (size_t destination_offset = 0; destination_offset < 33; destination_offset += 11)
+            {
+                for (size_t source_offset = 0; source_offset < 3; ++source_offset)
+                {
+                    std::vector<uint8_t> destination(size + (kPadding * 2), 0xcd);
+
+                    gfxrecon::util::StreamingMemoryCopy(
+                        kernel, destination.data() + kPadding + destination_offset, source.data() + source_offset, size);
+
+                    REQUIRE(std::memcmp(destination.data() + kPadding + destination_offset,
+                                        source.data() + source_offset,
+                                        size) == 0);
+
+                    // Bytes outside of the destination range must not be modified.
+                    for (size_t i = 0; i < kPadding + destination_offset; ++i)
+                    {
+                        REQUIRE(destination[i] == 0xcd);
+                    }
+
+                    for (size_t i = kPadding + destination_offset + size; i < destination.size(); ++i)
+                    {
+                        REQUIRE(destination[i] == 0xcd);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Run with the "[benchmark]" tag.  Device memory cannot be mapped without a GPU, so write-combined memory is
+// approximated by a destination that is much larger than the CPU caches and is never read back.
+TEST_CASE("StreamingMemoryCopy benchmark", "[.][memory_copy][benchmark]")
+{
+    const size_t kCachedSize = 256 * 1024;
+    const size_t kColdSize   = 64 * 1024 * 1024;
+
+    std::vector<uint8_t> source(kColdSize, 0x5a);
+    std::vector<uint8_t> destination(kColdSize);
+
+    BENCHMARK("memcpy cached 256 KiB")
+    {
+        std::memcpy(destination.data(), source.data(), kCachedSize);
+        return destination[0];
+    };
+
+    BENCHMARK("memcpy cold 64 MiB")
+    {
+        std::memcpy(destination.data(), source.data(), kColdSize);
+        return destination[0];
+    };
+
+    for (auto kernel : kKernels)
+    {
+        if (gfxrecon::util::IsMemoryCopyKernelSupported(kernel))
+        {
+            const char* name = (kernel == MemoryCopyKernel::kAvx2)   ? "avx2"
+                               : (kernel == MemoryCopyKernel::kSse2) ? "sse2"
+                                                                     : "scalar";
+
+            BENCHMARK(std::string("streaming ") + name + " cached 256 KiB")
+            {
+                gfxrecon::util::StreamingMemoryCopy(kernel, destination.data(), source.data(), kCachedSize);
+                return destination[0];
+            };
+
+            BENCHMARK(std::string("streaming ") + name + " cold 64 MiB")
+            {
+                gfxrecon::util::StreamingMemoryCopy(kernel, destination.data(), source.data(), kColdSize);
+                return destination[0];
+            };
+        }
+    }
+}
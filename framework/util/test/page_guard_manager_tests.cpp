@@ -0,0 +1,292 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/logging.h"
+#include "util/page_guard_manager.h"
+#include "util/platform.h"
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+using gfxrecon::util::PageGuardManager;
+
+static const uint64_t kMemoryId = 1;
+
+static void CreatePageGuardManager(PageGuardManager::MemoryProtectionMode mode)
+{
+    PageGuardManager::Create(PageGuardManager::kDefaultEnableCopyOnMap,
+                             PageGuardManager::kDefaultEnableSeparateRead,
+                             PageGuardManager::kDefaultEnableReadWriteSamePage,
+                             PageGuardManager::kDefaultUnblockSIGSEGV,
+                             PageGuardManager::kDefaultEnableSignalHandlerWatcher,
+                             PageGuardManager::kDefaultSignalHandlerWatcherMaxRestores,
+                             mode,
+                             PageGuardManager::kDefaultEnablePageHashing);
+}
+
+// Writes one byte to every page_stride pages of the tracked memory.
+static void WritePages(uint8_t* memory, size_t size, size_t page_stride, uint8_t value)
+{
+    const size_t stride = gfxrecon::util::platform::GetSystemPageSize() * page_stride;
+
+    for (size_t offset = 0; offset < size; offset += stride)
+    {
+        memory[offset] = value;
+    }
+}
+
+TEST_CASE("PageGuardManager reports written pages", "[page_guard][pre_submit]")
+{
+    gfxrecon::util::Log::Init(gfxrecon::util::Log::kErrorSeverity);
+
+    const PageGuardManager::MemoryProtectionMode kModes[] = { PageGuardManager::kMProtectMode,
+                                                              PageGuardManager::kSoftDirtyMode };
+
+    const size_t page_size = gfxrecon::util::platform::GetSystemPageSize();
+    const size_t size      = page_size * 64;
+
+    for (auto mode : kModes)
+    {
+        CreatePageGuardManager(mode);
+
+        PageGuardManager* manager = PageGuardManager::Get();
+        REQUIRE(manager != nullptr);
+
+        std::vector<uint8_t> mapped_memory(size, 0);
+        auto                 memory = static_cast<uint8_t*>(manager->AddTrackedMemory(
+            kMemoryId, mapped_memory.data(), 0, size, PageGuardManager::kNullShadowHandle, true, false));
+
+        for (uint8_t value = 1; value <= 3; ++value)
+        {
+            WritePages(memory, size, value, value);
+
+            std::vector<bool> reported(size, false);
+            manager->ProcessMemoryEntries([&](uint64_t memory_id, void*, size_t offset, size_t range_size) {
+                REQUIRE(memory_id == kMemoryId);
+                REQUIRE((offset + range_size) <= size);
+
+                for (size_t i = offset; i < (offset + range_size); ++i)
+                {
+                    reported[i] = true;
+                }
+            });
+
+            // Every write must be reported and copied to the mapped memory.
+            for (size_t offset = 0; offset < size; offset += (page_size * value))
+            {
+                REQUIRE(reported[offset]);
+                REQUIRE(mapped_memory[offset] == value);
+            }
+        }
+
+        manager->RemoveTrackedMemory(kMemoryId);
+
+        PageGuardManager::Destroy();
+    }
+
+    gfxrecon::util::Log::Release();
+}
+
+TEST_CASE("PageGuardManager reports pages written while other threads process memory", "[page_guard][pre_submit]")
+{
+    gfxrecon::util::Log::Init(gfxrecon::util::Log::kErrorSeverity);
+
+    const PageGuardManager::MemoryProtectionMode kModes[] = { PageGuardManager::kMProtectMode,
+                                                              PageGuardManager::kSoftDirtyMode };
+
+    const size_t kProcessCount = 1000;
+    const size_t page_size     = gfxrecon::util::platform::GetSystemPageSize();
+    const size_t size          = page_size * 64;
+
+    for (auto mode : kModes)
+    {
+        CreatePageGuardManager(mode);
+
+        PageGuardManager* manager = PageGuardManager::Get();
+        REQUIRE(manager != nullptr);
+
+        std::vector<uint8_t> mapped_memory(size, 0);
+        auto                 memory = static_cast<uint8_t*>(manager->AddTrackedMemory(
+            kMemoryId, mapped_memory.data(), 0, size, PageGuardManager::kNullShadowHandle, true, false));
+
+        // Every page is written continuously, so writes are made while the modified pages are being reset.
+        std::atomic<bool> stop{ false };
+        std::thread       writer([&]() {
+            for (uint8_t value = 1; !stop.load(); ++value)
+            {
+                for (size_t offset = 0; offset < size; offset += page_size)
+                {
+                    reinterpret_cast<volatile uint8_t*>(memory)[offset] = value;
+                }
+            }
+        });
+
+        for (size_t i = 0; i < kProcessCount; ++i)
+        {
+            manager->ProcessMemoryEntries([](uint64_t, void*, size_t, size_t) {});
+        }
+
+        stop = true;
+        writer.join();
+
+        // The pages written after the last reset are reported, and all writes have been copied to the mapped memory.
+        manager->ProcessMemoryEntries([](uint64_t, void*, size_t, size_t) {});
+        REQUIRE(memcmp(memory, mapped_memory.data(), size) == 0);
+
+        manager->RemoveTrackedMemory(kMemoryId);
+
+        PageGuardManager::Destroy();
+    }
+
+    gfxrecon::util::Log::Release();
+}
+
+TEST_CASE("PageGuardManager page hashing skips unchanged content", "[page_guard][pre_submit]")
+{
+    gfxrecon::util::Log::Init(gfxrecon::util::Log::kErrorSeverity);
+
+    PageGuardManager::Create(PageGuardManager::kDefaultEnableCopyOnMap,
+                             PageGuardManager::kDefaultEnableSeparateRead,
+                             PageGuardManager::kDefaultEnableReadWriteSamePage,
+                             PageGuardManager::kDefaultUnblockSIGSEGV,
+                             PageGuardManager::kDefaultEnableSignalHandlerWatcher,
+                             PageGuardManager::kDefaultSignalHandlerWatcherMaxRestores,
+                             PageGuardManager::kMProtectMode,
+                             true);
+
+    PageGuardManager* manager = PageGuardManager::Get();
+    REQUIRE(manager != nullptr);
+
+    const size_t page_size = gfxrecon::util::platform::GetSystemPageSize();
+    const size_t size      = page_size * 8;
+
+    // The mapped memory is page aligned, so that hash blocks start at page boundaries.
+    std::vector<uint8_t> mapped_storage(size + page_size, 0);
+    uint8_t*             mapped_memory =
+        mapped_storage.data() + (page_size - (reinterpret_cast<uintptr_t>(mapped_storage.data()) % page_size));
+    auto memory = static_cast<uint8_t*>(manager->AddTrackedMemory(
+        kMemoryId, mapped_memory, 0, size, PageGuardManager::kNullShadowHandle, true, false));
+
+    std::vector<std::pair<size_t, size_t>> ranges;
+    auto                                   process_memory = [&]() {
+        ranges.clear();
+        manager->ProcessMemoryEntries(
+            [&](uint64_t, void*, size_t offset, size_t range_size) { ranges.emplace_back(offset, range_size); });
+    };
+
+    // Content that has not been reported is reported, even when it matches the initial content of the memory.
+    WritePages(memory, size, 1, 0);
+    process_memory();
+    REQUIRE(ranges.size() == 1);
+    REQUIRE(ranges[0].first == 0);
+    REQUIRE(ranges[0].second == size);
+
+    // A page written with the content that was last reported is skipped.
+    memory[page_size * 2] = 0;
+    process_memory();
+    REQUIRE(ranges.empty());
+
+    // The modified hash blocks at the end of page 3 and the start of page 4 are reported as a single range, and the
+    // unchanged page 6 is skipped.
+    memory[(page_size * 4) - 1] = 1;
+    memory[page_size * 4]       = 1;
+    memory[page_size * 6]       = 0;
+    process_memory();
+    REQUIRE(ranges.size() == 1);
+    REQUIRE(ranges[0].first > (page_size * 3));
+    REQUIRE(ranges[0].first < ((page_size * 4) - 1));
+    REQUIRE((ranges[0].first + ranges[0].second) > ((page_size * 4) + 1));
+    REQUIRE((ranges[0].first + ranges[0].second) < (page_size * 5));
+    REQUIRE(mapped_memory[(page_size * 4) - 1] == 1);
+    REQUIRE(mapped_memory[page_size * 4] == 1);
+
+    manager->RemoveTrackedMemory(kMemoryId);
+
+    PageGuardManager::Destroy();
+
+    gfxrecon::util::Log::Release();
+}
+
+// Run with the "[benchmark]" tag.  Compares modes that detect writes with access violations, paying for each written
+// page when it is first written, against modes that scan the page tables, paying for every page of tracked memory when
+// modified pages are processed.  Modes that are not supported by the system are skipped.
+TEST_CASE("PageGuardManager benchmark", "[.][page_guard][benchmark]")
+{
+    gfxrecon::util::Log::Init(gfxrecon::util::Log::kErrorSeverity);
+
+    struct ModeInfo
+    {
+        PageGuardManager::MemoryProtectionMode mode;
+        const char*                            name;
+    };
+
+    const ModeInfo kModes[]       = { { PageGuardManager::kMProtectMode, "mprotect" },
+                                      { PageGuardManager::kUserFaultFdMode, "userfaultfd" },
+                                      { PageGuardManager::kSoftDirtyMode, "soft-dirty" } };
+    const size_t   kSizes[]       = { size_t{ 1 } << 20, size_t{ 16 } << 20, size_t{ 256 } << 20 };
+    const size_t   kPageStrides[] = { 1, 8, 64 };
+
+    for (const auto& mode_info : kModes)
+    {
+        CreatePageGuardManager(mode_info.mode);
+
+        PageGuardManager* manager = PageGuardManager::Get();
+        REQUIRE(manager != nullptr);
+
+        if (manager->GetMemoryProtectionMode() == mode_info.mode)
+        {
+            for (auto size : kSizes)
+            {
+                std::vector<uint8_t> mapped_memory(size, 0);
+                auto                 memory = static_cast<uint8_t*>(manager->AddTrackedMemory(
+                    kMemoryId, mapped_memory.data(), 0, size, PageGuardManager::kNullShadowHandle, true, false));
+
+                for (auto page_stride : kPageStrides)
+                {
+                    BENCHMARK(std::string(mode_info.name) + " " + std::to_string(size >> 20) + " MiB, 1 in " +
+                              std::to_string(page_stride) + " pages written")
+                    {
+                        WritePages(memory, size, page_stride, static_cast<uint8_t>(page_stride));
+
+                        size_t reported_size = 0;
+                        manager->ProcessMemoryEntries(
+                            [&](uint64_t, void*, size_t, size_t range_size) { reported_size += range_size; });
+
+                        return reported_size;
+                    };
+                }
+
+                manager->RemoveTrackedMemory(kMemoryId);
+            }
+        }
+
+        PageGuardManager::Destroy();
+    }
+
+    gfxrecon::util::Log::Release();
+}
@@ -0,0 +1,205 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/page_status_tracker.h"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+
+using gfxrecon::util::PageStatusTracker;
+
+namespace
+{
+
+// Page by page searches, matching the scans that preceded the word based searches.
+size_t LinearFindNextActiveBlock(const PageStatusTracker& tracker, size_t page_count, size_t start_index)
+{
+    size_t index = start_index;
+    while ((index < page_count) && !tracker.IsActiveWriteBlock(index) && !tracker.IsActiveReadBlock(index))
+    {
+        ++index;
+    }
+    return std::min(index, page_count);
+}
+
+size_t LinearFindNextInactiveWriteBlock(const PageStatusTracker& tracker, size_t page_count, size_t start_index)
+{
+    size_t index = start_index;
+    while ((index < page_count) && tracker.IsActiveWriteBlock(index))
+    {
+        ++index;
+    }
+    return std::min(index, page_count);
+}
+
+size_t LinearFindNextInactiveReadOnlyBlock(const PageStatusTracker& tracker, size_t page_count, size_t start_index)
+{
+    size_t index = start_index;
+    while ((index < page_count) && !tracker.IsActiveWriteBlock(index) && tracker.IsActiveReadBlock(index))
+    {
+        ++index;
+    }
+    return std::min(index, page_count);
+}
+
+void RequireMatchesLinearScan(const PageStatusTracker& tracker, size_t page_count)
+{
+    for (size_t start_index = 0; start_index <= (page_count + 1); ++start_index)
+    {
+        REQUIRE(tracker.FindNextActiveBlock(start_index) ==
+                LinearFindNextActiveBlock(tracker, page_count, start_index));
+        REQUIRE(tracker.FindNextInactiveWriteBlock(start_index) ==
+                LinearFindNextInactiveWriteBlock(tracker, page_count, start_index));
+        REQUIRE(tracker.FindNextInactiveReadOnlyBlock(start_index) ==
+                LinearFindNextInactiveReadOnlyBlock(tracker, page_count, start_index));
+    }
+}
+
+} // namespace
+
+TEST_CASE("PageStatusTracker finds blocks at word boundaries", "[page_status_tracker][pre_submit]")
+{
+    const size_t kPageCount = 192;
+
+    PageStatusTracker tracker(kPageCount);
+
+    SECTION("Last bit of a word")
+    {
+        tracker.SetActiveWriteBlock(63, true);
+        REQUIRE(tracker.FindNextActiveBlock(0) == 63);
+        REQUIRE(tracker.FindNextActiveBlock(63) == 63);
+        REQUIRE(tracker.FindNextActiveBlock(64) == kPageCount);
+        REQUIRE(tracker.FindNextInactiveWriteBlock(63) == 64);
+    }
+
+    SECTION("First bit of a word")
+    {
+        tracker.SetActiveReadBlock(64, true);
+        REQUIRE(tracker.FindNextActiveBlock(0) == 64);
+        REQUIRE(tracker.FindNextActiveBlock(63) == 64);
+        REQUIRE(tracker.FindNextActiveBlock(65) == kPageCount);
+        REQUIRE(tracker.FindNextInactiveReadOnlyBlock(0) == 0);
+        REQUIRE(tracker.FindNextInactiveReadOnlyBlock(64) == 65);
+    }
+
+    SECTION("Run of blocks that crosses words")
+    {
+        for (size_t i = 60; i < 130; ++i)
+        {
+            tracker.SetActiveWriteBlock(i, true);
+        }
+
+        REQUIRE(tracker.FindNextActiveBlock(0) == 60);
+        REQUIRE(tracker.FindNextInactiveWriteBlock(60) == 130);
+        REQUIRE(tracker.FindNextInactiveReadOnlyBlock(60) == 60);
+
+        tracker.ClearBlocks(63, 65);
+        REQUIRE(tracker.FindNextInactiveWriteBlock(60) == 63);
+        REQUIRE(tracker.FindNextActiveBlock(63) == 65);
+    }
+
+    RequireMatchesLinearScan(tracker, kPageCount);
+}
+
+TEST_CASE("PageStatusTracker ignores the bits past the last page", "[page_status_tracker][pre_submit]")
+{
+    const size_t kPageCount = 70;
+
+    PageStatusTracker tracker(kPageCount);
+
+    tracker.SetAllBlocksActiveWrite();
+    REQUIRE(tracker.FindNextActiveBlock(0) == 0);
+    REQUIRE(tracker.FindNextActiveBlock(69) == 69);
+    REQUIRE(tracker.FindNextInactiveWriteBlock(0) == kPageCount);
+    REQUIRE(tracker.FindNextInactiveWriteBlock(64) == kPageCount);
+    RequireMatchesLinearScan(tracker, kPageCount);
+
+    tracker.SetActiveWriteBlock(69, false);
+    REQUIRE(tracker.FindNextInactiveWriteBlock(0) == 69);
+
+    tracker.ClearBlocks(0, kPageCount);
+    REQUIRE(tracker.FindNextActiveBlock(0) == kPageCount);
+    REQUIRE(tracker.FindNextActiveBlock(65) == kPageCount);
+    RequireMatchesLinearScan(tracker, kPageCount);
+}
+
+TEST_CASE("PageStatusTracker searches empty and full bitmaps", "[page_status_tracker][pre_submit]")
+{
+    const size_t kPageCounts[] = { 0, 1, 63, 64, 65, 128 };
+
+    for (auto page_count : kPageCounts)
+    {
+        PageStatusTracker tracker(page_count);
+
+        // No blocks are active.
+        REQUIRE(tracker.FindNextActiveBlock(0) == page_count);
+        REQUIRE(tracker.FindNextInactiveWriteBlock(0) == 0);
+        REQUIRE(tracker.FindNextInactiveReadOnlyBlock(0) == 0);
+        RequireMatchesLinearScan(tracker, page_count);
+
+        // Every block is written.
+        tracker.SetAllBlocksActiveWrite();
+        REQUIRE(tracker.FindNextActiveBlock(0) == 0);
+        REQUIRE(tracker.FindNextInactiveWriteBlock(0) == page_count);
+        REQUIRE(tracker.FindNextInactiveReadOnlyBlock(0) == 0);
+        RequireMatchesLinearScan(tracker, page_count);
+
+        // Every block is read and not written.
+        tracker.ClearBlocks(0, page_count);
+        for (size_t i = 0; i < page_count; ++i)
+        {
+            tracker.SetActiveReadBlock(i, true);
+        }
+        REQUIRE(tracker.FindNextActiveBlock(0) == 0);
+        REQUIRE(tracker.FindNextInactiveWriteBlock(0) == 0);
+        REQUIRE(tracker.FindNextInactiveReadOnlyBlock(0) == page_count);
+        RequireMatchesLinearScan(tracker, page_count);
+    }
+}
+
+TEST_CASE("PageStatusTracker searches match a linear scan", "[page_status_tracker][pre_submit]")
+{
+    const size_t kPageCounts[] = { 1, 63, 64, 65, 127, 128, 129, 200 };
+    const double kDensities[]  = { 0.02, 0.5, 0.98 };
+
+    std::mt19937 generator(1234);
+
+    for (auto page_count : kPageCounts)
+    {
+        for (auto density : kDensities)
+        {
+            std::bernoulli_distribution distribution(density);
+            PageStatusTracker           tracker(page_count);
+
+            for (size_t i = 0; i < page_count; ++i)
+            {
+                tracker.SetActiveWriteBlock(i, distribution(generator));
+                tracker.SetActiveReadBlock(i, distribution(generator));
+            }
+
+            RequireMatchesLinearScan(tracker, page_count);
+        }
+    }
+}
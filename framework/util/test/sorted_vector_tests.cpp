@@ -0,0 +1,90 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/sorted_vector.h"
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <vector>
+
+using namespace gfxrecon::util;
+
+TEST_CASE("SortedVectorSet matches std::set", "[sorted_vector][pre_submit]")
+{
+    SortedVectorSet<uint64_t> set;
+    std::set<uint64_t>        expected;
+
+    uint64_t value = 1;
+    for (uint32_t i = 0; i < 1000; ++i)
+    {
+        // Mostly increasing values with repeats, as when handles are referenced by consecutive commands.
+        value = ((i % 3) == 0) ? (value * 31 + 7) % 257 : value + (i % 2);
+
+        REQUIRE(set.insert(value) == expected.insert(value).second);
+        REQUIRE(set.count(value) == 1);
+    }
+
+    REQUIRE(set.size() == expected.size());
+    REQUIRE(std::vector<uint64_t>(set.begin(), set.end()) == std::vector<uint64_t>(expected.begin(), expected.end()));
+    REQUIRE(set.count(1000) == 0);
+
+    set.clear();
+    REQUIRE(set.empty());
+    REQUIRE(set.begin() == set.end());
+}
+
+TEST_CASE("SortedVectorMap matches std::map", "[sorted_vector][pre_submit]")
+{
+    SortedVectorMap<uint32_t, uint32_t> map;
+    std::map<uint32_t, uint32_t>        expected;
+
+    for (uint32_t i = 0; i < 1000; ++i)
+    {
+        const uint32_t key = (i * 37) % 101;
+
+        map[key]      = i;
+        expected[key] = i;
+    }
+
+    REQUIRE(map.size() == expected.size());
+
+    auto entry = map.begin();
+    for (const auto& expected_entry : expected)
+    {
+        REQUIRE(entry->first == expected_entry.first);
+        REQUIRE(entry->second == expected_entry.second);
+        ++entry;
+    }
+
+    REQUIRE(map.find(5) != map.end());
+    REQUIRE(map.find(5)->second == expected[5]);
+    REQUIRE(map.find(101) == map.end());
+
+    const auto& const_map = map;
+    REQUIRE(const_map.find(200) == const_map.end());
+
+    map.clear();
+    REQUIRE(map.empty());
+}
@@ -0,0 +1,83 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/varint.h"
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <limits>
+
+using namespace gfxrecon::util;
+
+TEST_CASE("Varint values round trip", "[varint][pre_submit]")
+{
+    const uint64_t kValues[] = {
+        0, 1, 0x7f, 0x80, 0x3fff, 0x4000, 0xffffffff, 0x100000000, std::numeric_limits<uint64_t>::max()
+    };
+    const size_t kSizes[] = { 1, 1, 1, 2, 2, 3, 5, 5, varint::kMaxVarintSize };
+
+    for (size_t i = 0; i < (sizeof(kValues) / sizeof(kValues[0])); ++i)
+    {
+        uint8_t buffer[varint::kMaxVarintSize] = {};
+        size_t  size                           = varint::Encode(kValues[i], buffer);
+        REQUIRE(size == kSizes[i]);
+
+        uint64_t value = 0;
+        REQUIRE(varint::Decode(buffer, sizeof(buffer), &value) == size);
+        REQUIRE(value == kValues[i]);
+    }
+}
+
+TEST_CASE("Varint decoding rejects truncated and overlong values", "[varint][pre_submit]")
+{
+    uint8_t buffer[varint::kMaxVarintSize + 1] = {};
+    size_t  size                               = varint::Encode(0x4000, buffer);
+
+    uint64_t value = 0;
+    REQUIRE(varint::Decode(buffer, size - 1, &value) == 0);
+    REQUIRE(varint::Decode(buffer, 0, &value) == 0);
+
+    for (size_t i = 0; i < sizeof(buffer); ++i)
+    {
+        buffer[i] = 0x80;
+    }
+    buffer[varint::kMaxVarintSize] = 0;
+
+    REQUIRE(varint::Decode(buffer, sizeof(buffer), &value) == 0);
+}
+
+TEST_CASE("ZigZag encoding maps small differences to small values", "[varint][pre_submit]")
+{
+    REQUIRE(varint::ZigZagEncode(0) == 0);
+    REQUIRE(varint::ZigZagEncode(-1) == 1);
+    REQUIRE(varint::ZigZagEncode(1) == 2);
+    REQUIRE(varint::ZigZagEncode(-2) == 3);
+
+    const int64_t kValues[] = { 0, 1, -1, 63, -64, std::numeric_limits<int64_t>::max(),
+                                std::numeric_limits<int64_t>::min() };
+
+    for (int64_t value : kValues)
+    {
+        REQUIRE(varint::ZigZagDecode(varint::ZigZagEncode(value)) == value);
+    }
+}
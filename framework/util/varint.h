@@ -0,0 +1,92 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+/// @file LEB128 variable length encoding of unsigned integers, used for compact parameter encoding.
+
+#ifndef GFXRECON_UTIL_VARINT_H
+#define GFXRECON_UTIL_VARINT_H
+
+#include "util/defines.h"
+
+#include <cstddef>
+#include <cstdint>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(varint)
+
+// Maximum number of bytes needed to encode a 64-bit value, with 7 bits per byte.
+const size_t kMaxVarintSize = 10;
+
+// Writes value to buffer, which must have space for kMaxVarintSize bytes.  Returns the number of bytes written.
+inline size_t Encode(uint64_t value, uint8_t* buffer)
+{
+    size_t size = 0;
+
+    while (value >= 0x80)
+    {
+        buffer[size++] = static_cast<uint8_t>(value | 0x80);
+        value >>= 7;
+    }
+
+    buffer[size++] = static_cast<uint8_t>(value);
+
+    return size;
+}
+
+// Reads a value from buffer.  Returns the number of bytes read, or 0 if the buffer ends before the last byte of the
+// value or the value is longer than kMaxVarintSize bytes.
+inline size_t Decode(const uint8_t* buffer, size_t buffer_size, uint64_t* value)
+{
+    uint64_t result = 0;
+    size_t   limit  = (buffer_size < kMaxVarintSize) ? buffer_size : kMaxVarintSize;
+
+    for (size_t i = 0; i < limit; ++i)
+    {
+        result |= static_cast<uint64_t>(buffer[i] & 0x7f) << (7 * i);
+
+        if ((buffer[i] & 0x80) == 0)
+        {
+            (*value) = result;
+            return i + 1;
+        }
+    }
+
+    return 0;
+}
+
+// Maps signed differences to unsigned values with small magnitudes, so that -1 is encoded as 1 and 1 as 2.
+inline uint64_t ZigZagEncode(int64_t value)
+{
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+inline int64_t ZigZagDecode(uint64_t value)
+{
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+GFXRECON_END_NAMESPACE(varint)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_VARINT_H
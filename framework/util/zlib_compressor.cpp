@@ -27,6 +27,8 @@
 
 #include "zlib.h"
 
+#include <algorithm>
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
@@ -56,12 +58,13 @@ size_t ZlibCompressor::Compress(const size_t          uncompressed_size,
     compress_stream.avail_in = static_cast<uInt>(uncompressed_size);
     compress_stream.next_in  = const_cast<Bytef*>(uncompressed_data);
 
-    GFXRECON_CHECK_CONVERSION_DATA_LOSS(uInt, compressed_data->size());
-    compress_stream.avail_out = static_cast<uInt>(compressed_data->size());
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(uInt, compressed_data->size() - compressed_data_offset);
+    compress_stream.avail_out = static_cast<uInt>(compressed_data->size() - compressed_data_offset);
     compress_stream.next_out  = compressed_data->data() + compressed_data_offset;
 
     // Perform the compression (deflate the data).
-    deflateInit(&compress_stream, Z_BEST_COMPRESSION);
+    deflateInit(&compress_stream,
+                (compression_level_ > 0) ? std::min(compression_level_, Z_BEST_COMPRESSION) : Z_BEST_COMPRESSION);
     deflate(&compress_stream, Z_FINISH);
     deflateEnd(&compress_stream);
 
@@ -71,10 +74,10 @@ size_t ZlibCompressor::Compress(const size_t          uncompressed_size,
     return copy_size;
 }
 
-size_t ZlibCompressor::Decompress(const size_t                compressed_size,
-                                  const std::vector<uint8_t>& compressed_data,
-                                  const size_t                expected_uncompressed_size,
-                                  std::vector<uint8_t>*       uncompressed_data)
+size_t ZlibCompressor::Decompress(const size_t   compressed_size,
+                                  const uint8_t* compressed_data,
+                                  const size_t   expected_uncompressed_size,
+                                  uint8_t*       uncompressed_data)
 {
     size_t copy_size = 0;
 
@@ -90,11 +93,11 @@ size_t ZlibCompressor::Decompress(const size_t                compressed_size,
 
     GFXRECON_CHECK_CONVERSION_DATA_LOSS(uInt, compressed_size);
     decompress_stream.avail_in = static_cast<uInt>(compressed_size);
-    decompress_stream.next_in  = const_cast<Bytef*>(compressed_data.data());
+    decompress_stream.next_in  = const_cast<Bytef*>(compressed_data);
 
     GFXRECON_CHECK_CONVERSION_DATA_LOSS(uInt, expected_uncompressed_size);
     decompress_stream.avail_out = static_cast<uInt>(expected_uncompressed_size);
-    decompress_stream.next_out  = uncompressed_data->data();
+    decompress_stream.next_out  = uncompressed_data;
 
     // Perform the decompression (inflate the data).
     inflateInit(&decompress_stream);
@@ -32,7 +32,10 @@ GFXRECON_BEGIN_NAMESPACE(util)
 class ZlibCompressor : public Compressor
 {
   public:
-    ZlibCompressor() {}
+    // Levels greater than 0 select the zlib compression level, up to 9.  The default level is 9.
+    explicit ZlibCompressor(int32_t compression_level = kDefaultCompressionLevel) :
+        compression_level_(compression_level)
+    {}
 
     virtual ~ZlibCompressor() override {}
 
@@ -41,10 +44,15 @@ class ZlibCompressor : public Compressor
                             std::vector<uint8_t>* compressed_data,
                             size_t                compressed_data_offset) override;
 
-    virtual size_t Decompress(const size_t                compressed_size,
-                              const std::vector<uint8_t>& compressed_data,
-                              const size_t                expected_uncompressed_size,
-                              std::vector<uint8_t>*       uncompressed_data) override;
+    using Compressor::Decompress;
+
+    virtual size_t Decompress(const size_t   compressed_size,
+                              const uint8_t* compressed_data,
+                              const size_t   expected_uncompressed_size,
+                              uint8_t*       uncompressed_data) override;
+
+  private:
+    int32_t compression_level_;
 };
 
 GFXRECON_END_NAMESPACE(util)
@@ -57,7 +57,7 @@ size_t ZstdCompressor::Compress(const size_t          uncompressed_size,
                       zstd_compressed_size,
                       reinterpret_cast<const char*>(uncompressed_data),
                       uncompressed_size,
-                      1);
+                      (compression_level_ > 0) ? compression_level_ : 1);
 
     if (!ZSTD_isError(compressed_size_generated))
     {
@@ -71,10 +71,10 @@ size_t ZstdCompressor::Compress(const size_t          uncompressed_size,
     return data_size;
 }
 
-size_t ZstdCompressor::Decompress(const size_t                compressed_size,
-                                  const std::vector<uint8_t>& compressed_data,
-                                  const size_t                expected_uncompressed_size,
-                                  std::vector<uint8_t>*       uncompressed_data)
+size_t ZstdCompressor::Decompress(const size_t   compressed_size,
+                                  const uint8_t* compressed_data,
+                                  const size_t   expected_uncompressed_size,
+                                  uint8_t*       uncompressed_data)
 {
     size_t data_size = 0;
 
@@ -83,9 +83,9 @@ size_t ZstdCompressor::Decompress(const size_t                compressed_size,
         return 0;
     }
 
-    size_t uncompressed_size_generated = ZSTD_decompress(reinterpret_cast<char*>(uncompressed_data->data()),
+    size_t uncompressed_size_generated = ZSTD_decompress(reinterpret_cast<char*>(uncompressed_data),
                                                          expected_uncompressed_size,
-                                                         reinterpret_cast<const char*>(compressed_data.data()),
+                                                         reinterpret_cast<const char*>(compressed_data),
                                                          compressed_size);
 
     if (!ZSTD_isError(uncompressed_size_generated))
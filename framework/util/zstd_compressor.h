@@ -31,7 +31,10 @@ GFXRECON_BEGIN_NAMESPACE(util)
 class ZstdCompressor : public Compressor
 {
   public:
-    ZstdCompressor() {}
+    // Levels greater than 0 select the Zstandard compression level.  The default level is 1.
+    explicit ZstdCompressor(int32_t compression_level = kDefaultCompressionLevel) :
+        compression_level_(compression_level)
+    {}
 
     virtual ~ZstdCompressor() override {}
 
@@ -40,10 +43,15 @@ class ZstdCompressor : public Compressor
                             std::vector<uint8_t>* compressed_data,
                             size_t                compressed_data_offset) override;
 
-    virtual size_t Decompress(const size_t                compressed_size,
-                              const std::vector<uint8_t>& compressed_data,
-                              const size_t                expected_uncompressed_size,
-                              std::vector<uint8_t>*       uncompressed_data) override;
+    using Compressor::Decompress;
+
+    virtual size_t Decompress(const size_t   compressed_size,
+                              const uint8_t* compressed_data,
+                              const size_t   expected_uncompressed_size,
+                              uint8_t*       uncompressed_data) override;
+
+  private:
+    int32_t compression_level_;
 };
 
 GFXRECON_END_NAMESPACE(util)
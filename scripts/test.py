@@ -48,6 +48,7 @@ REPO_ROOT = os.path.abspath(os.path.join(
 # List of tests to run when no test executable is passed to script
 ALL_TESTS = collections.OrderedDict({
     'gfxrecon_application_test': [],
+    'gfxrecon_compress_test': [],
     'gfxrecon_decode_test': [],
     'gfxrecon_encode_test': [],
     'gfxrecon_format_test': [],
@@ -0,0 +1,382 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "block_conversion_queue.h"
+
+#include "format/format.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <cassert>
+#include <cinttypes>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+// Block buffers larger than this are released after use instead of being recycled.
+const size_t kMaxRecycledBlockSize = 4 * 1024 * 1024;
+
+// Data from Write calls is combined into blocks of up to this size before it is queued.
+const size_t kMaxPendingDataSize = 64 * 1024;
+
+BlockConversionQueue::BlockConversionQueue(util::Compressor* source_compressor,
+                                           util::Compressor* target_compressor,
+                                           size_t            thread_count,
+                                           size_t            max_queued_bytes,
+                                           WriteFunction     write_function) :
+    source_compressor_(source_compressor), target_compressor_(target_compressor), max_queued_bytes_(max_queued_bytes),
+    write_function_(std::move(write_function)), conversion_pool_(thread_count), queued_bytes_(0), status_(kStatusOk),
+    writing_(false), exiting_(false)
+{
+    assert((thread_count > 0) && write_function_);
+
+    writer_thread_ = std::thread(&BlockConversionQueue::WriteBlocks, this);
+}
+
+BlockConversionQueue::~BlockConversionQueue()
+{
+    Flush();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        exiting_ = true;
+    }
+
+    block_ready_.notify_all();
+    writer_thread_.join();
+    conversion_pool_.join_all();
+}
+
+bool BlockConversionQueue::Write(const void* data, size_t size)
+{
+    if (GetStatus() != kStatusOk)
+    {
+        return false;
+    }
+
+    if (pending_block_ == nullptr)
+    {
+        pending_block_ = AcquireBlock(0);
+    }
+
+    auto bytes = static_cast<const uint8_t*>(data);
+    pending_block_->source.insert(pending_block_->source.end(), bytes, bytes + size);
+
+    if (pending_block_->source.size() >= kMaxPendingDataSize)
+    {
+        QueuePendingData();
+    }
+
+    return true;
+}
+
+bool BlockConversionQueue::WriteBlock(const void* uncompressed_header,
+                                      size_t      uncompressed_header_size,
+                                      const void* compressed_header,
+                                      size_t      compressed_header_size,
+                                      const void* source_data,
+                                      size_t      source_size,
+                                      bool        source_compressed,
+                                      size_t      data_size)
+{
+    assert(compressed_header_size >= sizeof(format::BlockHeader));
+
+    // Data from earlier Write calls must be written before the block.
+    QueuePendingData();
+
+    auto     block       = AcquireBlock(uncompressed_header_size + compressed_header_size + source_size);
+    uint8_t* destination = block->source.data();
+
+    util::platform::MemoryCopy(destination, uncompressed_header_size, uncompressed_header, uncompressed_header_size);
+    destination += uncompressed_header_size;
+    util::platform::MemoryCopy(destination, compressed_header_size, compressed_header, compressed_header_size);
+    destination += compressed_header_size;
+    util::platform::MemoryCopy(destination, source_size, source_data, source_size);
+
+    block->uncompressed_header_size = uncompressed_header_size;
+    block->compressed_header_size   = compressed_header_size;
+    block->data_size                = source_compressed ? data_size : source_size;
+    block->source_compressed        = source_compressed;
+
+    // The block remains in the queue until it has been converted, so the pointer remains valid for the task.
+    Block* queued_block = block.get();
+
+    if (!QueueBlock(std::move(block)))
+    {
+        return false;
+    }
+
+    conversion_pool_.post([this, queued_block]() { ConvertBlock(queued_block); });
+
+    return true;
+}
+
+bool BlockConversionQueue::Flush()
+{
+    QueuePendingData();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    block_written_.wait(lock, [this]() { return queued_blocks_.empty() && !writing_; });
+
+    return (status_ == kStatusOk);
+}
+
+BlockConversionQueue::Status BlockConversionQueue::GetStatus() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return status_;
+}
+
+std::unique_ptr<BlockConversionQueue::Block> BlockConversionQueue::AcquireBlock(size_t size)
+{
+    std::unique_ptr<Block> block;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!free_blocks_.empty())
+        {
+            block = std::move(free_blocks_.back());
+            free_blocks_.pop_back();
+        }
+    }
+
+    if (block == nullptr)
+    {
+        block = std::make_unique<Block>();
+    }
+
+    block->source.resize(size);
+    block->uncompressed_header_size = 0;
+    block->compressed_header_size   = 0;
+    block->data_size                = 0;
+    block->source_compressed        = false;
+    block->ready                    = false;
+    block->failed                   = false;
+    block->write_data[0]            = nullptr;
+    block->write_data[1]            = nullptr;
+    block->write_size[0]            = 0;
+    block->write_size[1]            = 0;
+
+    return block;
+}
+
+void BlockConversionQueue::ReleaseBlock(std::unique_ptr<Block> block)
+{
+    // Called with the lock held.
+    if ((block->source.capacity() <= kMaxRecycledBlockSize) &&
+        (block->decompressed_data.capacity() <= kMaxRecycledBlockSize) &&
+        (block->compressed_data.capacity() <= kMaxRecycledBlockSize))
+    {
+        free_blocks_.emplace_back(std::move(block));
+    }
+}
+
+void BlockConversionQueue::QueuePendingData()
+{
+    if ((pending_block_ != nullptr) && !pending_block_->source.empty())
+    {
+        pending_block_->write_data[0] = pending_block_->source.data();
+        pending_block_->write_size[0] = pending_block_->source.size();
+        pending_block_->ready         = true;
+
+        QueueBlock(std::move(pending_block_));
+    }
+}
+
+bool BlockConversionQueue::QueueBlock(std::unique_ptr<Block> block)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    // Apply back pressure to the reader when the worker threads or the writer fall behind.
+    block_written_.wait(lock, [this]() {
+        return (queued_bytes_ < max_queued_bytes_) || queued_blocks_.empty() || (status_ != kStatusOk);
+    });
+
+    if (status_ != kStatusOk)
+    {
+        ReleaseBlock(std::move(block));
+        return false;
+    }
+
+    bool ready = block->ready;
+
+    queued_bytes_ += block->source.size();
+    queued_blocks_.emplace_back(std::move(block));
+
+    if (ready)
+    {
+        block_ready_.notify_one();
+    }
+
+    return true;
+}
+
+void BlockConversionQueue::ConvertBlock(Block* block)
+{
+    const size_t   header_size = block->uncompressed_header_size + block->compressed_header_size;
+    const size_t   source_size = block->source.size() - header_size;
+    const size_t   data_size   = block->data_size;
+    const uint8_t* data        = block->source.data() + header_size;
+    bool           failed      = false;
+
+    if (block->source_compressed)
+    {
+        size_t uncompressed_size = 0;
+
+        if (source_compressor_ != nullptr)
+        {
+            if (block->decompressed_data.size() < data_size)
+            {
+                block->decompressed_data.resize(data_size);
+            }
+
+            uncompressed_size =
+                source_compressor_->Decompress(source_size, data, data_size, block->decompressed_data.data());
+        }
+
+        if (uncompressed_size == data_size)
+        {
+            data = block->decompressed_data.data();
+        }
+        else
+        {
+            GFXRECON_LOG_ERROR("Failed to decompress %" PRIuPTR " bytes of block data", source_size);
+            failed = true;
+        }
+    }
+
+    if (!failed)
+    {
+        bool compressed = false;
+
+        if (target_compressor_ != nullptr)
+        {
+            // The compressor writes the compressed data after the header, preserving the header.
+            if (block->compressed_data.size() < block->compressed_header_size)
+            {
+                block->compressed_data.resize(block->compressed_header_size);
+            }
+
+            util::platform::MemoryCopy(block->compressed_data.data(),
+                                       block->compressed_header_size,
+                                       block->source.data() + block->uncompressed_header_size,
+                                       block->compressed_header_size);
+
+            size_t compressed_size =
+                target_compressor_->Compress(data_size, data, &block->compressed_data, block->compressed_header_size);
+
+            if ((compressed_size > 0) && (compressed_size < data_size))
+            {
+                auto block_header  = reinterpret_cast<format::BlockHeader*>(block->compressed_data.data());
+                block_header->size = (block->compressed_header_size - sizeof(format::BlockHeader)) + compressed_size;
+
+                block->write_data[0] = block->compressed_data.data();
+                block->write_size[0] = block->compressed_header_size + compressed_size;
+                compressed           = true;
+            }
+        }
+
+        if (!compressed)
+        {
+            block->write_data[0] = block->source.data();
+            block->write_size[0] = block->uncompressed_header_size;
+            block->write_data[1] = data;
+            block->write_size[1] = data_size;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    block->failed = failed;
+    block->ready  = true;
+
+    if (block == queued_blocks_.front().get())
+    {
+        block_ready_.notify_one();
+    }
+}
+
+void BlockConversionQueue::WriteBlocks()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    for (;;)
+    {
+        block_ready_.wait(
+            lock, [this]() { return exiting_ || (!queued_blocks_.empty() && queued_blocks_.front()->ready); });
+
+        if (queued_blocks_.empty() || !queued_blocks_.front()->ready)
+        {
+            // Exiting, which only happens after the queue has been flushed.
+            break;
+        }
+
+        auto block = std::move(queued_blocks_.front());
+        queued_blocks_.pop_front();
+
+        // Once a block has failed, the remaining blocks are discarded.
+        bool write = (status_ == kStatusOk);
+
+        if (block->failed && write)
+        {
+            status_ = kStatusDecompressionFailed;
+            write   = false;
+        }
+
+        writing_ = true;
+
+        // The reader and the worker threads may queue and convert blocks while the output file is written.
+        lock.unlock();
+
+        bool written = true;
+
+        if (write)
+        {
+            for (size_t i = 0; (i < 2) && written; ++i)
+            {
+                if (block->write_size[i] > 0)
+                {
+                    written = write_function_(block->write_data[i], block->write_size[i]);
+                }
+            }
+
+            if (!written)
+            {
+                GFXRECON_LOG_ERROR("Failed to write %" PRIuPTR " bytes to the output file",
+                                   block->write_size[0] + block->write_size[1]);
+            }
+        }
+
+        lock.lock();
+
+        if (!written)
+        {
+            status_ = kStatusWriteFailed;
+        }
+
+        writing_ = false;
+        queued_bytes_ -= block->source.size();
+        ReleaseBlock(std::move(block));
+        block_written_.notify_all();
+    }
+}
+
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,149 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_BLOCK_CONVERSION_QUEUE_H
+#define GFXRECON_BLOCK_CONVERSION_QUEUE_H
+
+#include "util/compressor.h"
+#include "util/defines.h"
+#include "util/threadpool.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+// Converts the compression of capture file blocks on a pool of worker threads, and writes the converted blocks from a
+// dedicated writer thread in the order that they were queued.  The thread reading the source file only copies block
+// data to the queue, leaving decompression of the source data and compression of the target data to the workers.
+class BlockConversionQueue
+{
+  public:
+    enum Status
+    {
+        kStatusOk,
+        kStatusDecompressionFailed,
+        kStatusWriteFailed
+    };
+
+    // Writes data to the output file.  Only called from the writer thread.
+    typedef std::function<bool(const void* data, size_t size)> WriteFunction;
+
+  public:
+    // The source compressor decompresses block data read from the source file, and the target compressor compresses
+    // the converted block data, which is written uncompressed when target_compressor is null.  The compressors do not
+    // keep state between calls, so they are shared by the worker threads.  max_queued_bytes limits the amount of block
+    // data that may be waiting to be written.
+    BlockConversionQueue(util::Compressor* source_compressor,
+                         util::Compressor* target_compressor,
+                         size_t            thread_count,
+                         size_t            max_queued_bytes,
+                         WriteFunction     write_function);
+
+    ~BlockConversionQueue();
+
+    // Queues data to be written without conversion.  Returns false if an earlier block could not be converted or
+    // written, after which no more data is written.
+    bool Write(const void* data, size_t size);
+
+    // Queues a block to be converted.  When source_compressed is true, the source data is decompressed to data_size
+    // bytes.  The block is written as compressed_header followed by the data compressed with the target compressor,
+    // with the size in the block header at the start of compressed_header updated to match the compressed data size.
+    // When there is no target compressor or compression does not reduce the size of the data, the block is written as
+    // uncompressed_header followed by the uncompressed data.  Returns false if an earlier block could not be converted
+    // or written.
+    bool WriteBlock(const void* uncompressed_header,
+                    size_t      uncompressed_header_size,
+                    const void* compressed_header,
+                    size_t      compressed_header_size,
+                    const void* source_data,
+                    size_t      source_size,
+                    bool        source_compressed,
+                    size_t      data_size);
+
+    // Waits for all queued blocks to be written.  Returns false if a block could not be converted or written.
+    bool Flush();
+
+    Status GetStatus() const;
+
+  private:
+    struct Block
+    {
+        // Uncompressed header, compressed header, and source data, as queued.
+        std::vector<uint8_t> source;
+        std::vector<uint8_t> decompressed_data;
+        std::vector<uint8_t> compressed_data; // Compressed header and data.
+        size_t               uncompressed_header_size{ 0 };
+        size_t               compressed_header_size{ 0 };
+        size_t               data_size{ 0 };
+        bool                 source_compressed{ false };
+        bool                 ready{ false };
+        bool                 failed{ false };
+
+        // Data to write to the output file when the block is ready, which may be split in two when the header and the
+        // uncompressed data are stored in separate buffers.
+        const uint8_t* write_data[2]{};
+        size_t         write_size[2]{};
+    };
+
+  private:
+    std::unique_ptr<Block> AcquireBlock(size_t size);
+
+    void ReleaseBlock(std::unique_ptr<Block> block);
+
+    // Queues the data from Write calls that has not been queued yet.
+    void QueuePendingData();
+
+    // Adds the block to the queue, waiting for space to become available when the queue is full.
+    bool QueueBlock(std::unique_ptr<Block> block);
+
+    void ConvertBlock(Block* block);
+
+    void WriteBlocks();
+
+  private:
+    util::Compressor*                   source_compressor_;
+    util::Compressor*                   target_compressor_;
+    const size_t                        max_queued_bytes_;
+    WriteFunction                       write_function_;
+    std::unique_ptr<Block>              pending_block_;
+    util::ThreadPool                    conversion_pool_;
+    std::thread                         writer_thread_;
+    mutable std::mutex                  mutex_;
+    std::condition_variable             block_ready_;
+    std::condition_variable             block_written_;
+    std::deque<std::unique_ptr<Block>>  queued_blocks_;
+    std::vector<std::unique_ptr<Block>> free_blocks_;
+    size_t                              queued_bytes_;
+    Status                              status_;
+    bool                                writing_;
+    bool                                exiting_;
+};
+
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_BLOCK_CONVERSION_QUEUE_H
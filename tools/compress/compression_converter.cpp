@@ -26,31 +26,40 @@
 
 #include "format/format_util.h"
 #include "util/logging.h"
+#include "util/platform.h"
 
+#include <algorithm>
 #include <cassert>
 #include <numeric>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 
+// Limit for the size of the block data that each worker thread may have waiting to be converted or written.
+const size_t kMaxQueuedBytesPerThread = 32 * 1024 * 1024;
+
 CompressionConverter::CompressionConverter() :
-    decompressing_(true), target_compression_type_(format::CompressionType::kNone)
+    target_compression_type_(format::CompressionType::kNone), content_deduplication_limit_(0), thread_count_(1)
 {}
 
 CompressionConverter::~CompressionConverter() {}
 
 bool CompressionConverter::Initialize(const std::string&      input_filename,
                                       const std::string&      output_filename,
-                                      format::CompressionType target_compression_type)
+                                      format::CompressionType target_compression_type,
+                                      uint32_t                content_deduplication_limit,
+                                      uint32_t                thread_count,
+                                      int32_t                 compression_level)
 {
-    bool success = CreateCompressor(target_compression_type, &target_compressor_);
+    bool success = CreateCompressor(target_compression_type, &target_compressor_, compression_level);
 
     if (success)
     {
         // The target compression type needs to be set before FileTransformer::Initialize is called, because it invokes
         // WriteFileHeader, which depends on a valid target compression type.
-        target_compression_type_ = target_compression_type;
-        decompressing_           = (target_compression_type == format::CompressionType::kNone);
-        success                  = FileTransformer::Initialize(input_filename, output_filename, "compress");
+        target_compression_type_     = target_compression_type;
+        content_deduplication_limit_ = content_deduplication_limit;
+        thread_count_                = std::max(thread_count, 1u);
+        success                      = FileTransformer::Initialize(input_filename, output_filename, "compress");
     }
 
     return success;
@@ -60,16 +69,57 @@ bool CompressionConverter::WriteFileHeader(const format::FileHeader&
                                            const std::vector<format::FileOptionPair>& options)
 {
     std::vector<format::FileOptionPair> output_options(options);
+    bool                                deduplicated = false;
+
     for (auto& option : output_options)
     {
         if (option.key == format::FileOption::kCompressionType)
         {
             option.value = static_cast<uint32_t>(target_compression_type_);
-            break;
         }
+        else if ((option.key == format::FileOption::kContentDeduplication) && (option.value > 0))
+        {
+            deduplicated = true;
+        }
+    }
+
+    if (content_deduplication_limit_ > 0)
+    {
+        if (deduplicated)
+        {
+            // New content IDs could conflict with the IDs of the content data blocks in the file.
+            GFXRECON_LOG_WARNING("The capture file already uses content deduplication; its content data blocks will be "
+                                 "copied without further deduplication");
+        }
+        else
+        {
+            content_deduplicator_ = std::make_unique<util::ContentDeduplicator>(
+                static_cast<uint64_t>(content_deduplication_limit_) << 20);
+            output_options.push_back({ format::FileOption::kContentDeduplication, content_deduplication_limit_ });
+        }
+    }
+
+    // The source compressor is created from the file header options before the header is written.
+    conversion_queue_ = std::make_unique<BlockConversionQueue>(
+        GetCompressor(),
+        target_compressor_.get(),
+        thread_count_,
+        thread_count_ * kMaxQueuedBytesPerThread,
+        [this](const void* data, size_t size) { return FileTransformer::WriteBytes(data, size); });
+
+    if (!FileTransformer::WriteFileHeader(header, output_options))
+    {
+        return false;
+    }
+
+    // Write the header before returning, so that failures are reported by Initialize.
+    if (!conversion_queue_->Flush())
+    {
+        HandleConversionQueueError(kErrorWritingFileHeader, "Failed to write file header");
+        return false;
     }
 
-    return FileTransformer::WriteFileHeader(header, output_options);
+    return true;
 }
 
 bool CompressionConverter::ProcessFunctionCall(const format::BlockHeader& block_header, format::ApiCallId call_id)
@@ -94,16 +144,10 @@ bool CompressionConverter::ProcessFunctionCall(const format::BlockHeader& block_
 
                 GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, uncompressed_size);
 
-                size_t actual_size = 0;
-                success            = ReadCompressedParameterBuffer(
-                    parameter_buffer_size, static_cast<size_t>(uncompressed_size), &actual_size);
+                // The data is decompressed by the conversion queue.
+                success = ReadParameterBuffer(parameter_buffer_size);
 
-                if (success)
-                {
-                    assert(actual_size == uncompressed_size);
-                    parameter_buffer_size = static_cast<size_t>(uncompressed_size);
-                }
-                else
+                if (!success)
                 {
                     HandleBlockReadError(kErrorReadingCompressedBlockData,
                                          "Failed to read compressed function call block data");
@@ -117,7 +161,8 @@ bool CompressionConverter::ProcessFunctionCall(const format::BlockHeader& block_
         }
         else
         {
-            success = ReadParameterBuffer(parameter_buffer_size);
+            uncompressed_size = parameter_buffer_size;
+            success           = ReadParameterBuffer(parameter_buffer_size);
 
             if (!success)
             {
@@ -127,7 +172,11 @@ bool CompressionConverter::ProcessFunctionCall(const format::BlockHeader& block_
 
         if (success)
         {
-            success = WriteFunctionCall(call_id, thread_id, parameter_buffer_size);
+            success = WriteFunctionCall(call_id,
+                                        thread_id,
+                                        format::IsBlockCompressed(block_header.type),
+                                        parameter_buffer_size,
+                                        static_cast<size_t>(uncompressed_size));
         }
     }
     else
@@ -164,16 +213,10 @@ bool CompressionConverter::ProcessMethodCall(const format::BlockHeader& block_he
 
                 GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, uncompressed_size);
 
-                size_t actual_size = 0;
-                success            = ReadCompressedParameterBuffer(
-                    parameter_buffer_size, static_cast<size_t>(uncompressed_size), &actual_size);
+                // The data is decompressed by the conversion queue.
+                success = ReadParameterBuffer(parameter_buffer_size);
 
-                if (success)
-                {
-                    assert(actual_size == uncompressed_size);
-                    parameter_buffer_size = static_cast<size_t>(uncompressed_size);
-                }
-                else
+                if (!success)
                 {
                     HandleBlockReadError(kErrorReadingCompressedBlockData,
                                          "Failed to read compressed method call block data");
@@ -187,7 +230,8 @@ bool CompressionConverter::ProcessMethodCall(const format::BlockHeader& block_he
         }
         else
         {
-            success = ReadParameterBuffer(parameter_buffer_size);
+            uncompressed_size = parameter_buffer_size;
+            success           = ReadParameterBuffer(parameter_buffer_size);
 
             if (!success)
             {
@@ -197,7 +241,12 @@ bool CompressionConverter::ProcessMethodCall(const format::BlockHeader& block_he
 
         if (success)
         {
-            success = WriteMethodCall(call_id, object_id, thread_id, parameter_buffer_size);
+            success = WriteMethodCall(call_id,
+                                      object_id,
+                                      thread_id,
+                                      format::IsBlockCompressed(block_header.type),
+                                      parameter_buffer_size,
+                                      static_cast<size_t>(uncompressed_size));
         }
     }
     else
@@ -217,6 +266,10 @@ bool CompressionConverter::ProcessMetaData(const format::BlockHeader& block_head
     {
         return WriteFillMemoryMetaData(block_header, meta_data_id);
     }
+    else if (meta_data_type == format::MetaDataType::kContentDataCommand)
+    {
+        return WriteContentDataMetaData(block_header, meta_data_id);
+    }
     else if (meta_data_type == format::MetaDataType::kInitBufferCommand)
     {
         return WriteInitBufferMetaData(block_header, meta_data_id);
@@ -252,80 +305,38 @@ bool CompressionConverter::ProcessMetaData(const format::BlockHeader& block_head
     }
 }
 
-bool CompressionConverter::WriteFunctionCall(format::ApiCallId call_id, format::ThreadId thread_id, size_t buffer_size)
+bool CompressionConverter::WriteFunctionCall(format::ApiCallId call_id,
+                                             format::ThreadId  thread_id,
+                                             bool              data_compressed,
+                                             size_t            source_size,
+                                             size_t            data_size)
 {
-    bool        write_uncompressed = decompressing_;
-    const auto& buffer             = GetParameterBuffer();
-
-    if (!write_uncompressed)
-    {
-        assert(target_compressor_ != nullptr);
-
-        // Compress the buffer with the new compression format and write to the new file.
-        auto&  compressed_buffer = GetCompressedParameterBuffer();
-        size_t packet_size       = 0;
-        size_t compressed_size   = target_compressor_->Compress(buffer_size, buffer.data(), &compressed_buffer, 0);
-
-        if (0 < compressed_size && compressed_size < buffer_size)
-        {
-            format::CompressedFunctionCallHeader compressed_func_call_header = {};
-            compressed_func_call_header.block_header.type = format::BlockType::kCompressedFunctionCallBlock;
-            compressed_func_call_header.api_call_id       = call_id;
-            compressed_func_call_header.thread_id         = thread_id;
-            compressed_func_call_header.uncompressed_size = buffer_size;
-
-            packet_size += sizeof(compressed_func_call_header.api_call_id) +
-                           sizeof(compressed_func_call_header.thread_id) +
-                           sizeof(compressed_func_call_header.uncompressed_size) + compressed_size;
-
-            compressed_func_call_header.block_header.size = packet_size;
-
-            if (!WriteBytes(&compressed_func_call_header, sizeof(compressed_func_call_header)))
-            {
-                HandleBlockWriteError(kErrorWritingCompressedBlockHeader,
-                                      "Failed to write compressed function call block header");
-                return false;
-            }
-
-            if (!WriteBytes(compressed_buffer.data(), compressed_size))
-            {
-                HandleBlockWriteError(kErrorWritingCompressedBlockData,
-                                      "Failed to write compressed function call block data");
-                return false;
-            }
-        }
-        else
-        {
-            // It's bigger compressed than uncompressed, so write the uncompressed data.
-            write_uncompressed = true;
-        }
-    }
-
-    if (write_uncompressed)
+    format::FunctionCallHeader func_call_header = {};
+    func_call_header.block_header.type          = format::BlockType::kFunctionCallBlock;
+    func_call_header.api_call_id                = call_id;
+    func_call_header.thread_id                  = thread_id;
+
+    func_call_header.block_header.size =
+        sizeof(func_call_header.api_call_id) + sizeof(func_call_header.thread_id) + data_size;
+
+    // The block size is set by the conversion queue when the data has been compressed.
+    format::CompressedFunctionCallHeader compressed_func_call_header = {};
+    compressed_func_call_header.block_header.type = format::BlockType::kCompressedFunctionCallBlock;
+    compressed_func_call_header.api_call_id       = call_id;
+    compressed_func_call_header.thread_id         = thread_id;
+    compressed_func_call_header.uncompressed_size = data_size;
+
+    if (!conversion_queue_->WriteBlock(&func_call_header,
+                                       sizeof(func_call_header),
+                                       &compressed_func_call_header,
+                                       sizeof(compressed_func_call_header),
+                                       GetParameterBuffer().data(),
+                                       source_size,
+                                       data_compressed,
+                                       data_size))
     {
-        // Buffer is currently not compressed; it was decompressed prior to this call.
-        format::FunctionCallHeader func_call_header = {};
-        size_t                     packet_size      = 0;
-
-        func_call_header.block_header.type = format::BlockType::kFunctionCallBlock;
-        func_call_header.api_call_id       = call_id;
-        func_call_header.thread_id         = thread_id;
-
-        packet_size += sizeof(func_call_header.api_call_id) + sizeof(func_call_header.thread_id) + buffer_size;
-
-        func_call_header.block_header.size = packet_size;
-
-        if (!WriteBytes(&func_call_header, sizeof(func_call_header)))
-        {
-            HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write function call block header");
-            return false;
-        }
-
-        if (!WriteBytes(buffer.data(), buffer_size))
-        {
-            HandleBlockWriteError(kErrorWritingBlockData, "Failed to write function call block data");
-            return false;
-        }
+        HandleConversionQueueError(kErrorWritingBlockData, "Failed to write function call block");
+        return false;
     }
 
     return true;
@@ -334,156 +345,262 @@ bool CompressionConverter::WriteFunctionCall(format::ApiCallId call_id, format::
 bool CompressionConverter::WriteMethodCall(format::ApiCallId call_id,
                                            format::HandleId  object_id,
                                            format::ThreadId  thread_id,
-                                           size_t            buffer_size)
+                                           bool              data_compressed,
+                                           size_t            source_size,
+                                           size_t            data_size)
 {
-    bool        write_uncompressed = decompressing_;
-    const auto& buffer             = GetParameterBuffer();
+    format::MethodCallHeader method_call_header = {};
+    method_call_header.block_header.type        = format::BlockType::kMethodCallBlock;
+    method_call_header.api_call_id              = call_id;
+    method_call_header.object_id                = object_id;
+    method_call_header.thread_id                = thread_id;
+
+    method_call_header.block_header.size = sizeof(method_call_header.api_call_id) +
+                                           sizeof(method_call_header.object_id) +
+                                           sizeof(method_call_header.thread_id) + data_size;
+
+    // The block size is set by the conversion queue when the data has been compressed.
+    format::CompressedMethodCallHeader compressed_method_call_header = {};
+    compressed_method_call_header.block_header.type = format::BlockType::kCompressedMethodCallBlock;
+    compressed_method_call_header.api_call_id       = call_id;
+    compressed_method_call_header.object_id         = object_id;
+    compressed_method_call_header.thread_id         = thread_id;
+    compressed_method_call_header.uncompressed_size = data_size;
+
+    if (!conversion_queue_->WriteBlock(&method_call_header,
+                                       sizeof(method_call_header),
+                                       &compressed_method_call_header,
+                                       sizeof(compressed_method_call_header),
+                                       GetParameterBuffer().data(),
+                                       source_size,
+                                       data_compressed,
+                                       data_size))
+    {
+        HandleConversionQueueError(kErrorWritingBlockData, "Failed to write method call block");
+        return false;
+    }
+
+    return true;
+}
+
+bool CompressionConverter::WriteFillMemoryMetaData(const format::BlockHeader& block_header,
+                                                   format::MetaDataId         meta_data_id)
+{
+    assert(format::GetMetaDataType(meta_data_id) == format::MetaDataType::kFillMemoryCommand);
+
+    format::FillMemoryCommandHeader fill_cmd;
+
+    bool success = ReadBytes(&fill_cmd.thread_id, sizeof(fill_cmd.thread_id));
+    success      = success && ReadBytes(&fill_cmd.memory_id, sizeof(fill_cmd.memory_id));
+    success      = success && ReadBytes(&fill_cmd.memory_offset, sizeof(fill_cmd.memory_offset));
+    success      = success && ReadBytes(&fill_cmd.memory_size, sizeof(fill_cmd.memory_size));
 
-    if (!write_uncompressed)
+    if (success)
     {
-        GFXRECON_ASSERT(target_compressor_ != nullptr);
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, fill_cmd.memory_size);
+
+        size_t data_size = static_cast<size_t>(fill_cmd.memory_size);
 
-        // Compress the buffer with the new compression format and write to the new file.
-        auto&  compressed_buffer = GetCompressedParameterBuffer();
-        size_t packet_size       = 0;
-        size_t compressed_size   = target_compressor_->Compress(buffer_size, buffer.data(), &compressed_buffer, 0);
+        bool   data_compressed = format::IsBlockCompressed(block_header.type);
+        size_t source_size     = data_size;
 
-        if (0 < compressed_size && compressed_size < buffer_size)
+        if (data_compressed)
         {
-            format::CompressedMethodCallHeader compressed_method_call_header = {};
-            compressed_method_call_header.block_header.type = format::BlockType::kCompressedMethodCallBlock;
-            compressed_method_call_header.api_call_id       = call_id;
-            compressed_method_call_header.object_id         = object_id;
-            compressed_method_call_header.thread_id         = thread_id;
-            compressed_method_call_header.uncompressed_size = buffer_size;
+            source_size = static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(fill_cmd));
 
-            packet_size += sizeof(compressed_method_call_header.api_call_id) +
-                           sizeof(compressed_method_call_header.object_id) +
-                           sizeof(compressed_method_call_header.thread_id) +
-                           sizeof(compressed_method_call_header.uncompressed_size) + compressed_size;
+            if (content_deduplicator_ != nullptr)
+            {
+                // Deduplication needs the uncompressed data, so it is decompressed here instead of by the conversion
+                // queue.
+                size_t uncompressed_size = 0;
 
-            compressed_method_call_header.block_header.size = packet_size;
+                if (!ReadCompressedParameterBuffer(source_size, data_size, &uncompressed_size))
+                {
+                    HandleBlockReadError(kErrorReadingCompressedBlockData,
+                                         "Failed to read fill memory meta-data block");
+                    return false;
+                }
 
-            if (!WriteBytes(&compressed_method_call_header, sizeof(compressed_method_call_header)))
-            {
-                HandleBlockWriteError(kErrorWritingCompressedBlockHeader,
-                                      "Failed to write compressed method call block header");
-                return false;
-            }
+                assert(uncompressed_size == data_size);
 
-            if (!WriteBytes(compressed_buffer.data(), compressed_size))
+                data_compressed = false;
+                source_size     = data_size;
+            }
+            else if (!ReadParameterBuffer(source_size))
             {
-                HandleBlockWriteError(kErrorWritingCompressedBlockData,
-                                      "Failed to write compressed method call block data");
+                HandleBlockReadError(kErrorReadingCompressedBlockData, "Failed to read fill memory meta-data block");
                 return false;
             }
         }
         else
         {
-            // It's bigger compressed than uncompressed, so write the uncompressed data.
-            write_uncompressed = true;
+            if (!ReadParameterBuffer(data_size))
+            {
+                HandleBlockReadError(kErrorReadingBlockData, "Failed to read fill memory meta-data block");
+                return false;
+            }
         }
-    }
 
-    if (write_uncompressed)
-    {
-        // Buffer is currently not compressed; it was decompressed prior to this call.
-        format::MethodCallHeader method_call_header = {};
-        size_t                   packet_size        = 0;
-
-        method_call_header.block_header.type = format::BlockType::kMethodCallBlock;
-        method_call_header.api_call_id       = call_id;
-        method_call_header.object_id         = object_id;
-        method_call_header.thread_id         = thread_id;
+        const auto&    buffer       = GetParameterBuffer();
+        const uint8_t* data_address = buffer.data();
 
-        packet_size += sizeof(method_call_header.api_call_id) + sizeof(method_call_header.object_id) +
-                       sizeof(method_call_header.thread_id) + buffer_size;
+        if (content_deduplicator_ != nullptr)
+        {
+            bool written = false;
 
-        method_call_header.block_header.size = packet_size;
+            if (!WriteFillMemoryContent(fill_cmd, meta_data_id, data_address, data_size, &written))
+            {
+                return false;
+            }
 
-        if (!WriteBytes(&method_call_header, sizeof(method_call_header)))
-        {
-            HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write method call block header");
-            return false;
+            if (written)
+            {
+                return true;
+            }
         }
 
-        if (!WriteBytes(buffer.data(), buffer_size))
+        if (!WriteMetaDataBlock(
+                &fill_cmd, sizeof(fill_cmd), meta_data_id, data_address, data_compressed, source_size, data_size))
         {
-            HandleBlockWriteError(kErrorWritingBlockData, "Failed to write method call block data");
+            HandleConversionQueueError(kErrorWritingBlockData, "Failed to write fill memory meta-data block");
             return false;
         }
     }
+    else
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read fill memory meta-data block header");
+        return false;
+    }
 
     return true;
 }
 
-bool CompressionConverter::WriteFillMemoryMetaData(const format::BlockHeader& block_header,
-                                                   format::MetaDataId         meta_data_id)
+bool CompressionConverter::WriteContentDataMetaData(const format::BlockHeader& block_header,
+                                                    format::MetaDataId         meta_data_id)
 {
-    assert(format::GetMetaDataType(meta_data_id) == format::MetaDataType::kFillMemoryCommand);
+    assert(format::GetMetaDataType(meta_data_id) == format::MetaDataType::kContentDataCommand);
 
-    format::FillMemoryCommandHeader fill_cmd;
+    format::ContentDataCommandHeader content_cmd;
 
-    bool success = ReadBytes(&fill_cmd.thread_id, sizeof(fill_cmd.thread_id));
-    success      = success && ReadBytes(&fill_cmd.memory_id, sizeof(fill_cmd.memory_id));
-    success      = success && ReadBytes(&fill_cmd.memory_offset, sizeof(fill_cmd.memory_offset));
-    success      = success && ReadBytes(&fill_cmd.memory_size, sizeof(fill_cmd.memory_size));
+    bool success = ReadBytes(&content_cmd.thread_id, sizeof(content_cmd.thread_id));
+    success      = success && ReadBytes(&content_cmd.content_id, sizeof(content_cmd.content_id));
+    success      = success && ReadBytes(&content_cmd.data_size, sizeof(content_cmd.data_size));
 
     if (success)
     {
-        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, fill_cmd.memory_size);
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, content_cmd.data_size);
 
-        size_t data_size = static_cast<size_t>(fill_cmd.memory_size);
+        size_t data_size = static_cast<size_t>(content_cmd.data_size);
 
-        if (format::IsBlockCompressed(block_header.type))
+        bool   data_compressed = format::IsBlockCompressed(block_header.type);
+        size_t source_size     = data_size;
+
+        if (data_compressed)
         {
-            size_t uncompressed_size = 0;
-            size_t compressed_size =
-                static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(fill_cmd));
+            // The data is decompressed by the conversion queue.
+            source_size = static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(content_cmd));
 
-            if (!ReadCompressedParameterBuffer(compressed_size, data_size, &uncompressed_size))
+            if (!ReadParameterBuffer(source_size))
             {
-                HandleBlockReadError(kErrorReadingCompressedBlockData, "Failed to read fill memory meta-data block");
+                HandleBlockReadError(kErrorReadingCompressedBlockData, "Failed to read content data meta-data block");
                 return false;
             }
-
-            assert(uncompressed_size == data_size);
         }
         else
         {
             if (!ReadParameterBuffer(data_size))
             {
-                HandleBlockReadError(kErrorReadingBlockData, "Failed to read fill memory meta-data block");
+                HandleBlockReadError(kErrorReadingBlockData, "Failed to read content data meta-data block");
                 return false;
             }
         }
 
-        const auto&    buffer       = GetParameterBuffer();
-        const uint8_t* data_address = buffer.data();
+        if (!WriteMetaDataBlock(&content_cmd,
+                                sizeof(content_cmd),
+                                meta_data_id,
+                                GetParameterBuffer().data(),
+                                data_compressed,
+                                source_size,
+                                data_size))
+        {
+            HandleConversionQueueError(kErrorWritingBlockData, "Failed to write content data meta-data block");
+            return false;
+        }
+    }
+    else
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read content data meta-data block header");
+        return false;
+    }
 
-        PrepMetadataBlock(fill_cmd.meta_header, meta_data_id, data_address, data_size);
+    return true;
+}
+
+bool CompressionConverter::WriteFillMemoryContent(const format::FillMemoryCommandHeader& fill_cmd,
+                                                  format::MetaDataId                     meta_data_id,
+                                                  const uint8_t*                         data,
+                                                  size_t                                 data_size,
+                                                  bool*                                  written)
+{
+    assert((content_deduplicator_ != nullptr) && (written != nullptr));
+
+    *written = false;
+
+    if (!content_deduplicator_->IsCandidate(data_size))
+    {
+        return true;
+    }
 
-        // Calculate size of packet with compressed or uncompressed data size.
-        fill_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(fill_cmd) + data_size;
+    util::ContentDeduplicator::ContentKey key        = util::ContentDeduplicator::ComputeKey(data, data_size);
+    uint64_t                              content_id = 0;
+    format::ApiFamilyId                   api_family = format::GetMetaDataApi(meta_data_id);
 
-        if (!WriteBytes(&fill_cmd, sizeof(fill_cmd)))
+    if (!content_deduplicator_->Find(key, &content_id))
+    {
+        if (!content_deduplicator_->Reserve(data_size, &content_id))
         {
-            HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write fill memory meta-data block header");
-            return false;
+            return true;
         }
 
-        if (!WriteBytes(data_address, data_size))
+        format::ContentDataCommandHeader content_cmd;
+        content_cmd.thread_id  = fill_cmd.thread_id;
+        content_cmd.content_id = content_id;
+        content_cmd.data_size  = data_size;
+
+        if (!WriteMetaDataBlock(&content_cmd,
+                                sizeof(content_cmd),
+                                format::MakeMetaDataId(api_family, format::MetaDataType::kContentDataCommand),
+                                data,
+                                false,
+                                data_size,
+                                data_size))
         {
-            HandleBlockWriteError(kErrorWritingBlockData, "Failed to write fill memory meta-data block");
+            HandleConversionQueueError(kErrorWritingBlockData, "Failed to write content data meta-data block");
             return false;
         }
+
+        content_deduplicator_->Add(key, content_id);
     }
-    else
+
+    format::FillMemoryContentCommandHeader content_fill_cmd;
+    content_fill_cmd.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+    content_fill_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(content_fill_cmd);
+    content_fill_cmd.meta_header.meta_data_id =
+        format::MakeMetaDataId(api_family, format::MetaDataType::kFillMemoryContentCommand);
+    content_fill_cmd.thread_id     = fill_cmd.thread_id;
+    content_fill_cmd.memory_id     = fill_cmd.memory_id;
+    content_fill_cmd.memory_offset = fill_cmd.memory_offset;
+    content_fill_cmd.memory_size   = fill_cmd.memory_size;
+    content_fill_cmd.content_id    = content_id;
+
+    if (!WriteBytes(&content_fill_cmd, sizeof(content_fill_cmd)))
     {
-        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read fill memory meta-data block header");
+        HandleConversionQueueError(kErrorWritingBlockHeader, "Failed to write fill memory content meta-data block");
         return false;
     }
 
+    *written = true;
+
     return true;
 }
 
@@ -505,19 +622,19 @@ bool CompressionConverter::WriteInitBufferMetaData(const format::BlockHeader& bl
 
         size_t data_size = static_cast<size_t>(init_cmd.data_size);
 
-        if (format::IsBlockCompressed(block_header.type))
+        bool   data_compressed = format::IsBlockCompressed(block_header.type);
+        size_t source_size     = data_size;
+
+        if (data_compressed)
         {
-            size_t uncompressed_size = 0;
-            size_t compressed_size =
-                static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(init_cmd));
+            // The data is decompressed by the conversion queue.
+            source_size = static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(init_cmd));
 
-            if (!ReadCompressedParameterBuffer(compressed_size, data_size, &uncompressed_size))
+            if (!ReadParameterBuffer(source_size))
             {
                 HandleBlockReadError(kErrorReadingCompressedBlockData, "Failed to read init buffer meta-data block");
                 return false;
             }
-
-            assert(uncompressed_size == data_size);
         }
         else
         {
@@ -528,23 +645,15 @@ bool CompressionConverter::WriteInitBufferMetaData(const format::BlockHeader& bl
             }
         }
 
-        const auto&    buffer       = GetParameterBuffer();
-        const uint8_t* data_address = buffer.data();
-
-        PrepMetadataBlock(init_cmd.meta_header, meta_data_id, data_address, data_size);
-
-        // Calculate size of packet with compressed or uncompressed data size.
-        init_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(init_cmd) + data_size;
-
-        if (!WriteBytes(&init_cmd, sizeof(init_cmd)))
-        {
-            HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write init buffer meta-data block header");
-            return false;
-        }
-
-        if (!WriteBytes(data_address, data_size))
+        if (!WriteMetaDataBlock(&init_cmd,
+                                sizeof(init_cmd),
+                                meta_data_id,
+                                GetParameterBuffer().data(),
+                                data_compressed,
+                                source_size,
+                                data_size))
         {
-            HandleBlockWriteError(kErrorWritingBlockData, "Failed to write init buffer meta-data block");
+            HandleConversionQueueError(kErrorWritingBlockData, "Failed to write init buffer meta-data block");
             return false;
         }
     }
@@ -595,19 +704,20 @@ bool CompressionConverter::WriteInitImageMetaData(const format::BlockHeader& blo
 
             size_t data_size = static_cast<size_t>(init_cmd.data_size);
 
-            if (format::IsBlockCompressed(block_header.type))
+            bool   data_compressed = format::IsBlockCompressed(block_header.type);
+            size_t source_size     = data_size;
+
+            if (data_compressed)
             {
-                size_t uncompressed_size = 0;
-                size_t compressed_size =
+                // The data is decompressed by the conversion queue.
+                source_size =
                     static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(init_cmd)) - levels_size;
 
-                if (!ReadCompressedParameterBuffer(compressed_size, data_size, &uncompressed_size))
+                if (!ReadParameterBuffer(source_size))
                 {
                     HandleBlockReadError(kErrorReadingCompressedBlockData, "Failed to read init image meta-data block");
                     return false;
                 }
-
-                assert(uncompressed_size == data_size);
             }
             else
             {
@@ -618,30 +728,20 @@ bool CompressionConverter::WriteInitImageMetaData(const format::BlockHeader& blo
                 }
             }
 
-            const auto&    buffer       = GetParameterBuffer();
-            const uint8_t* data_address = buffer.data();
-
-            PrepMetadataBlock(init_cmd.meta_header, meta_data_id, data_address, data_size);
-
-            // Calculate size of packet with compressed or uncompressed data size.
-            init_cmd.meta_header.block_header.size =
-                format::GetMetaDataBlockBaseSize(init_cmd) + levels_size + data_size;
-
-            if (!WriteBytes(&init_cmd, sizeof(init_cmd)))
+            // The level sizes are part of the header that precedes the resource data.
+            std::vector<uint8_t> header(sizeof(init_cmd) + levels_size);
+            util::platform::MemoryCopy(header.data(), sizeof(init_cmd), &init_cmd, sizeof(init_cmd));
+            util::platform::MemoryCopy(header.data() + sizeof(init_cmd), levels_size, level_sizes.data(), levels_size);
+
+            if (!WriteMetaDataBlock(header.data(),
+                                    header.size(),
+                                    meta_data_id,
+                                    GetParameterBuffer().data(),
+                                    data_compressed,
+                                    source_size,
+                                    data_size))
             {
-                HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write init image meta-data block header");
-                return false;
-            }
-
-            if (!WriteBytes(level_sizes.data(), levels_size))
-            {
-                HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write init image meta-data block");
-                return false;
-            }
-
-            if (!WriteBytes(data_address, data_size))
-            {
-                HandleBlockWriteError(kErrorWritingBlockData, "Failed to write init image meta-data block");
+                HandleConversionQueueError(kErrorWritingBlockData, "Failed to write init image meta-data block");
                 return false;
             }
         }
@@ -654,7 +754,8 @@ bool CompressionConverter::WriteInitImageMetaData(const format::BlockHeader& blo
 
             if (!WriteBytes(&init_cmd, sizeof(init_cmd)))
             {
-                HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write init image meta-data block header");
+                HandleConversionQueueError(kErrorWritingBlockHeader,
+                                           "Failed to write init image meta-data block header");
                 return false;
             }
         }
@@ -690,20 +791,20 @@ bool CompressionConverter::WriteInitSubresourceMetaData(const format::BlockHeade
 
         size_t data_size = static_cast<size_t>(init_cmd.data_size);
 
-        if (format::IsBlockCompressed(block_header.type))
+        bool   data_compressed = format::IsBlockCompressed(block_header.type);
+        size_t source_size     = data_size;
+
+        if (data_compressed)
         {
-            size_t uncompressed_size = 0;
-            size_t compressed_size =
-                static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(init_cmd));
+            // The data is decompressed by the conversion queue.
+            source_size = static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(init_cmd));
 
-            if (!ReadCompressedParameterBuffer(compressed_size, data_size, &uncompressed_size))
+            if (!ReadParameterBuffer(source_size))
             {
                 HandleBlockReadError(kErrorReadingCompressedBlockData,
                                      "Failed to read init subresource meta-data block");
                 return false;
             }
-
-            assert(uncompressed_size == data_size);
         }
         else
         {
@@ -714,23 +815,15 @@ bool CompressionConverter::WriteInitSubresourceMetaData(const format::BlockHeade
             }
         }
 
-        const auto&    buffer       = GetParameterBuffer();
-        const uint8_t* data_address = buffer.data();
-
-        PrepMetadataBlock(init_cmd.meta_header, meta_data_id, data_address, data_size);
-
-        // Calculate size of packet with compressed or uncompressed data size.
-        init_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(init_cmd) + data_size;
-
-        if (!WriteBytes(&init_cmd, sizeof(init_cmd)))
-        {
-            HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write init subresource meta-data block header");
-            return false;
-        }
-
-        if (!WriteBytes(data_address, data_size))
+        if (!WriteMetaDataBlock(&init_cmd,
+                                sizeof(init_cmd),
+                                meta_data_id,
+                                GetParameterBuffer().data(),
+                                data_compressed,
+                                source_size,
+                                data_size))
         {
-            HandleBlockWriteError(kErrorWritingBlockData, "Failed to write init subresource meta-data block");
+            HandleConversionQueueError(kErrorWritingBlockData, "Failed to write init subresource meta-data block");
             return false;
         }
     }
@@ -791,22 +884,23 @@ bool CompressionConverter::WriteInitDx12AccelerationStructureMetaData(const form
 
         size_t data_size = static_cast<size_t>(init_cmd.inputs_data_size);
 
-        if (format::IsBlockCompressed(block_header.type))
+        bool   data_compressed = format::IsBlockCompressed(block_header.type);
+        size_t source_size     = data_size;
+
+        if (data_compressed)
         {
-            size_t uncompressed_size = 0;
-            size_t compressed_size =
+            // The data is decompressed by the conversion queue.
+            source_size =
                 static_cast<size_t>(block_header.size) -
                 (sizeof(init_cmd) - sizeof(init_cmd.meta_header.block_header)) -
                 (sizeof(format::InitDx12AccelerationStructureGeometryDesc) * init_cmd.inputs_num_geometry_descs);
 
-            if (!ReadCompressedParameterBuffer(compressed_size, data_size, &uncompressed_size))
+            if (!ReadParameterBuffer(source_size))
             {
                 HandleBlockReadError(kErrorReadingCompressedBlockData,
                                      "Failed to read init DX12 acceleration structure meta-data block");
                 return false;
             }
-
-            assert(uncompressed_size == data_size);
         }
         else
         {
@@ -818,33 +912,23 @@ bool CompressionConverter::WriteInitDx12AccelerationStructureMetaData(const form
             }
         }
 
-        const auto&    buffer       = GetParameterBuffer();
-        const uint8_t* data_address = buffer.data();
-
-        PrepMetadataBlock(init_cmd.meta_header, meta_data_id, data_address, data_size);
-
-        // Calculate size of packet with compressed or uncompressed data size.
-        init_cmd.meta_header.block_header.size =
-            format::GetMetaDataBlockBaseSize(init_cmd) + data_size +
-            (sizeof(format::InitDx12AccelerationStructureGeometryDesc) * init_cmd.inputs_num_geometry_descs);
-
-        if (!WriteBytes(&init_cmd, sizeof(init_cmd)))
+        // The geometry descriptions are part of the header that precedes the resource data.
+        size_t               geom_descs_size = sizeof(geom_descs[0]) * geom_descs.size();
+        std::vector<uint8_t> header(sizeof(init_cmd) + geom_descs_size);
+        util::platform::MemoryCopy(header.data(), sizeof(init_cmd), &init_cmd, sizeof(init_cmd));
+        util::platform::MemoryCopy(
+            header.data() + sizeof(init_cmd), geom_descs_size, geom_descs.data(), geom_descs_size);
+
+        if (!WriteMetaDataBlock(header.data(),
+                                header.size(),
+                                meta_data_id,
+                                GetParameterBuffer().data(),
+                                data_compressed,
+                                source_size,
+                                data_size))
         {
-            HandleBlockWriteError(kErrorWritingBlockHeader,
-                                  "Failed to write init DX12 acceleration structure meta-data block header");
-            return false;
-        }
-        if (!WriteBytes(geom_descs.data(),
-                        sizeof(format::InitDx12AccelerationStructureGeometryDesc) * geom_descs.size()))
-        {
-            HandleBlockWriteError(kErrorWritingBlockHeader,
-                                  "Failed to write init DX12 acceleration structure geometry block");
-            return false;
-        }
-        if (!WriteBytes(data_address, data_size))
-        {
-            HandleBlockWriteError(kErrorWritingBlockData,
-                                  "Failed to write init DX12 acceleration structure meta-data block");
+            HandleConversionQueueError(kErrorWritingBlockData,
+                                       "Failed to write init DX12 acceleration structure meta-data block");
             return false;
         }
     }
@@ -871,19 +955,20 @@ bool CompressionConverter::WriteFillMemoryResourceValueMetaData(const format::Bl
         size_t data_size =
             static_cast<size_t>(rv_cmd.resource_value_count * (sizeof(format::ResourceValueType) + sizeof(uint64_t)));
 
-        if (format::IsBlockCompressed(block_header.type))
+        bool   data_compressed = format::IsBlockCompressed(block_header.type);
+        size_t source_size     = data_size;
+
+        if (data_compressed)
         {
-            size_t uncompressed_size = 0;
-            size_t compressed_size = static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(rv_cmd));
+            // The data is decompressed by the conversion queue.
+            source_size = static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(rv_cmd));
 
-            if (!ReadCompressedParameterBuffer(compressed_size, data_size, &uncompressed_size))
+            if (!ReadParameterBuffer(source_size))
             {
                 HandleBlockReadError(kErrorReadingCompressedBlockData,
                                      "Failed to read fill memory resource value meta-data block");
                 return false;
             }
-
-            assert(uncompressed_size == data_size);
         }
         else
         {
@@ -895,23 +980,16 @@ bool CompressionConverter::WriteFillMemoryResourceValueMetaData(const format::Bl
             }
         }
 
-        const auto&    buffer       = GetParameterBuffer();
-        const uint8_t* data_address = buffer.data();
-
-        PrepMetadataBlock(rv_cmd.meta_header, meta_data_id, data_address, data_size);
-
-        // Calculate size of packet with compressed or uncompressed data size.
-        rv_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(rv_cmd) + data_size;
-
-        if (!WriteBytes(&rv_cmd, sizeof(rv_cmd)))
+        if (!WriteMetaDataBlock(&rv_cmd,
+                                sizeof(rv_cmd),
+                                meta_data_id,
+                                GetParameterBuffer().data(),
+                                data_compressed,
+                                source_size,
+                                data_size))
         {
-            HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write fill memory meta-data block header");
-            return false;
-        }
-
-        if (!WriteBytes(data_address, data_size))
-        {
-            HandleBlockWriteError(kErrorWritingBlockData, "Failed to read fill memory resource value meta-data block");
+            HandleConversionQueueError(kErrorWritingBlockData,
+                                       "Failed to write fill memory resource value meta-data block");
             return false;
         }
     }
@@ -924,27 +1002,73 @@ bool CompressionConverter::WriteFillMemoryResourceValueMetaData(const format::Bl
     return true;
 }
 
-void CompressionConverter::PrepMetadataBlock(format::MetaDataHeader& meta_data_header,
-                                             format::MetaDataId      meta_data_id,
-                                             const uint8_t*&         data_address,
-                                             size_t&                 data_size)
+bool CompressionConverter::WriteMetaDataBlock(const void*        header,
+                                              size_t             header_size,
+                                              format::MetaDataId meta_data_id,
+                                              const uint8_t*     data,
+                                              bool               data_compressed,
+                                              size_t             source_size,
+                                              size_t             data_size)
 {
-    meta_data_header.block_header.type = format::kMetaDataBlock;
-    meta_data_header.meta_data_id      = meta_data_id;
+    assert((header_size >= sizeof(format::MetaDataHeader)) && (conversion_queue_ != nullptr));
+
+    // The uncompressed and compressed headers only differ in the block type and size, with the compressed block size
+    // set by the conversion queue when the data has been compressed.
+    header_buffer_.resize(header_size * 2);
+    util::platform::MemoryCopy(header_buffer_.data(), header_size, header, header_size);
+    util::platform::MemoryCopy(header_buffer_.data() + header_size, header_size, header, header_size);
+
+    format::MetaDataHeader meta_header;
+    meta_header.block_header.type = format::kMetaDataBlock;
+    meta_header.block_header.size = (header_size - sizeof(format::BlockHeader)) + data_size;
+    meta_header.meta_data_id      = meta_data_id;
+    util::platform::MemoryCopy(header_buffer_.data(), sizeof(meta_header), &meta_header, sizeof(meta_header));
+
+    meta_header.block_header.type = format::kCompressedMetaDataBlock;
+    util::platform::MemoryCopy(
+        header_buffer_.data() + header_size, sizeof(meta_header), &meta_header, sizeof(meta_header));
+
+    return conversion_queue_->WriteBlock(header_buffer_.data(),
+                                         header_size,
+                                         header_buffer_.data() + header_size,
+                                         header_size,
+                                         data,
+                                         source_size,
+                                         data_compressed,
+                                         data_size);
+}
 
-    if (!decompressing_)
+bool CompressionConverter::WriteBytes(const void* buffer, size_t buffer_size)
+{
+    if (conversion_queue_ != nullptr)
     {
-        assert(target_compressor_ != nullptr);
+        return conversion_queue_->Write(buffer, buffer_size);
+    }
 
-        auto&  compressed_buffer = GetCompressedParameterBuffer();
-        size_t compressed_size   = target_compressor_->Compress(data_size, data_address, &compressed_buffer, 0);
+    return FileTransformer::WriteBytes(buffer, buffer_size);
+}
 
-        if ((compressed_size > 0) && (compressed_size < data_size))
-        {
-            meta_data_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+void CompressionConverter::FlushOutput()
+{
+    if ((conversion_queue_ != nullptr) && !conversion_queue_->Flush())
+    {
+        HandleConversionQueueError(kErrorWritingBlockData, "Failed to write block data");
+    }
+}
 
-            data_address = compressed_buffer.data();
-            data_size    = compressed_size;
+void CompressionConverter::HandleConversionQueueError(Error error_code, const char* error_message)
+{
+    // The error is reported by the first write that follows it, and is not reported again when processing stops.
+    if (GetErrorState() == kErrorNone)
+    {
+        if ((conversion_queue_ != nullptr) &&
+            (conversion_queue_->GetStatus() == BlockConversionQueue::kStatusDecompressionFailed))
+        {
+            HandleBlockWriteError(kErrorReadingCompressedBlockData, "Failed to decompress block data");
+        }
+        else
+        {
+            HandleBlockWriteError(error_code, error_message);
         }
     }
 }
@@ -25,9 +25,12 @@
 #ifndef GFXRECON_COMPRESSION_CONVERTER_H
 #define GFXRECON_COMPRESSION_CONVERTER_H
 
+#include "block_conversion_queue.h"
+
 #include "decode/file_transformer.h"
 #include "format/format.h"
 #include "util/compressor.h"
+#include "util/content_deduplicator.h"
 #include "util/defines.h"
 
 #include <memory>
@@ -41,9 +44,15 @@ class CompressionConverter : public decode::FileTransformer
 
     virtual ~CompressionConverter() override;
 
+    // When content_deduplication_limit is not 0, fill memory data that is written more than once is stored in content
+    // data blocks, with the specified limit in MiB for the total size of the stored data.  Blocks are decompressed and
+    // compressed by thread_count worker threads, with the compression level of the target compression type.
     bool Initialize(const std::string&      input_filename,
                     const std::string&      output_filename,
-                    format::CompressionType target_compression_type);
+                    format::CompressionType target_compression_type,
+                    uint32_t                content_deduplication_limit = 0,
+                    uint32_t                thread_count                = 1,
+                    int32_t                 compression_level           = util::kDefaultCompressionLevel);
 
   protected:
     virtual bool WriteFileHeader(const format::FileHeader&                  header,
@@ -56,16 +65,39 @@ class CompressionConverter : public decode::FileTransformer
 
     virtual bool ProcessMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id) override;
 
+    // Writes the data to the output file through the conversion queue, which orders it with the converted blocks.
+    virtual bool WriteBytes(const void* buffer, size_t buffer_size) override;
+
+    virtual void FlushOutput() override;
+
   private:
-    bool WriteFunctionCall(format::ApiCallId call_id, format::ThreadId thread_id, size_t buffer_size);
+    // The data in the parameter buffer is source_size bytes that decompress to data_size bytes when data_compressed is
+    // true.
+    bool WriteFunctionCall(format::ApiCallId call_id,
+                           format::ThreadId  thread_id,
+                           bool              data_compressed,
+                           size_t            source_size,
+                           size_t            data_size);
 
     bool WriteMethodCall(format::ApiCallId call_id,
                          format::HandleId  object_id,
                          format::ThreadId  thread_id,
-                         size_t            buffer_size);
+                         bool              data_compressed,
+                         size_t            source_size,
+                         size_t            data_size);
 
     bool WriteFillMemoryMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
 
+    bool WriteContentDataMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
+
+    // Writes a fill memory content block that references the data, writing the data to a content data block first if
+    // it has not already been written.  Sets written to false when the data cannot be deduplicated.
+    bool WriteFillMemoryContent(const format::FillMemoryCommandHeader& fill_cmd,
+                                format::MetaDataId                     meta_data_id,
+                                const uint8_t*                         data,
+                                size_t                                 data_size,
+                                bool*                                  written);
+
     bool WriteInitBufferMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
 
     bool WriteInitImageMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
@@ -77,15 +109,33 @@ class CompressionConverter : public decode::FileTransformer
 
     bool WriteFillMemoryResourceValueMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
 
-    void PrepMetadataBlock(format::MetaDataHeader& meta_data_header,
-                           format::MetaDataId      meta_data_id,
-                           const uint8_t*&         data_address,
-                           size_t&                 data_size);
+    // Queues a meta-data block to be written with the data converted to the target compression type.  The header
+    // starts with the meta-data header and includes all data that precedes the resource data, with a block size that
+    // is updated for the size of the converted data.  The data is source_size bytes that decompress to data_size bytes
+    // when data_compressed is true.
+    bool WriteMetaDataBlock(const void*        header,
+                            size_t             header_size,
+                            format::MetaDataId meta_data_id,
+                            const uint8_t*     data,
+                            bool               data_compressed,
+                            size_t             source_size,
+                            size_t             data_size);
+
+    // Reports an error from the conversion queue, which is detected by the next write following the error.
+    void HandleConversionQueueError(Error error_code, const char* error_message);
 
   private:
-    bool                              decompressing_;
     format::CompressionType           target_compression_type_;
     std::unique_ptr<util::Compressor> target_compressor_;
+    uint32_t                          content_deduplication_limit_;
+    uint32_t                          thread_count_;
+    std::vector<uint8_t>              header_buffer_;
+
+    // Created when the file header is written, after the source compression type is known.
+    std::unique_ptr<BlockConversionQueue> conversion_queue_;
+
+    // Not null when fill memory data is deduplicated by the conversion.
+    std::unique_ptr<util::ContentDeduplicator> content_deduplicator_;
 };
 
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -32,15 +32,23 @@
 
 #include "vulkan/vulkan_core.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cerrno>
+#include <climits>
 #include <cstdlib>
+#include <thread>
 
-const char kHelpShortOption[] = "-h";
-const char kHelpLongOption[]  = "--help";
-const char kVersionOption[]   = "--version";
-const char kNoDebugPopup[]    = "--no-debug-popup";
+const char kHelpShortOption[]    = "-h";
+const char kHelpLongOption[]     = "--help";
+const char kVersionOption[]      = "--version";
+const char kNoDebugPopup[]       = "--no-debug-popup";
+const char kDedupLimitArgument[] = "--dedup-limit";
+const char kThreadsArgument[]    = "--threads";
+const char kLevelArgument[]      = "--level";
 
-const char kOptions[] = "-h|--help,--version,--no-debug-popup";
+const char kOptions[]   = "-h|--help,--version,--no-debug-popup";
+const char kArguments[] = "--dedup-limit,--threads,--level";
 
 const char kArgNone[]    = "NONE";
 const char kArgLz4[]     = "LZ4";
@@ -58,8 +66,9 @@ static void PrintUsage(const char* exe_name)
     }
     GFXRECON_WRITE_CONSOLE("\n%s - A tool to compress/decompress GFXReconstruct capture files.\n", app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Usage:");
-    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] <input_file> <output_file> <compression_format>\n",
+    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] [--dedup-limit <size>] [--threads <count>]",
                            app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--level <level>] <input_file> <output_file> <compression_format>\n");
     GFXRECON_WRITE_CONSOLE("Required arguments:");
     GFXRECON_WRITE_CONSOLE("  <input_file>\t\tPath to the input file to process.");
     GFXRECON_WRITE_CONSOLE("  <output_file>\t\tPath to the output file to generate.");
@@ -78,6 +87,19 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("\nOptional arguments:");
     GFXRECON_WRITE_CONSOLE("  -h\t\t\tPrint usage information and exit (same as --help).");
     GFXRECON_WRITE_CONSOLE("  --version\t\tPrint version information and exit.");
+    GFXRECON_WRITE_CONSOLE("  --dedup-limit <size>\tStore fill memory data that is written more than once in");
+    GFXRECON_WRITE_CONSOLE("                      \tcontent data blocks that are referenced by ID.  The size");
+    GFXRECON_WRITE_CONSOLE("                      \tlimits the total size in MiB of the stored data.  Replay");
+    GFXRECON_WRITE_CONSOLE("                      \tkeeps a copy of the stored data until the end of the");
+    GFXRECON_WRITE_CONSOLE("                      \tfile, so it can use up to this much additional memory.");
+    GFXRECON_WRITE_CONSOLE("                      \tDefault is 0 (disabled).");
+    GFXRECON_WRITE_CONSOLE("  --threads <count>\tNumber of worker threads that decompress and compress");
+    GFXRECON_WRITE_CONSOLE("                      \tblocks.  Default is the number of CPU cores.");
+    GFXRECON_WRITE_CONSOLE("  --level <level>\tCompression level.  For ZSTD, levels are 1 to 22, with a");
+    GFXRECON_WRITE_CONSOLE("                      \tdefault of 1.  For LZ4, levels 1 to 12 select LZ4 HC");
+    GFXRECON_WRITE_CONSOLE("                      \tcompression, which is slower to compress but as fast");
+    GFXRECON_WRITE_CONSOLE("                      \tto decompress.  For ZLIB, levels are 1 to 9, with a");
+    GFXRECON_WRITE_CONSOLE("                      \tdefault of 9.");
 #if defined(WIN32) && defined(_DEBUG)
     GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
     GFXRECON_WRITE_CONSOLE("        \t\tdisplayed when abort() is called (Windows debug only).");
@@ -139,11 +161,58 @@ static std::string GetCompressionTypeName(uint32_t type)
     return kArgUnknown;
 }
 
+// Parses a decimal integer argument value, returning false if the value contains anything other than an integer or is
+// out of range for int32_t.
+static bool ParseIntegerArgument(const std::string& argument_value, int32_t* value)
+{
+    assert(value != nullptr);
+
+    const char* start = argument_value.c_str();
+    char*       end   = nullptr;
+
+    errno       = 0;
+    long result = std::strtol(start, &end, 10);
+
+    if ((end == start) || (*end != '\0') || (errno == ERANGE) || (result < INT32_MIN) || (result > INT32_MAX))
+    {
+        return false;
+    }
+
+    *value = static_cast<int32_t>(result);
+    return true;
+}
+
+// Returns the range of compression levels accepted by the compressor for the specified compression type.
+static bool GetCompressionLevelRange(gfxrecon::format::CompressionType type, int32_t* min_level, int32_t* max_level)
+{
+    assert((min_level != nullptr) && (max_level != nullptr));
+
+    switch (type)
+    {
+        case gfxrecon::format::CompressionType::kLz4:
+            *min_level = 1;
+            *max_level = 12;
+            return true;
+        case gfxrecon::format::CompressionType::kZlib:
+            *min_level = 1;
+            *max_level = 9;
+            return true;
+        case gfxrecon::format::CompressionType::kZstd:
+            *min_level = 1;
+            *max_level = 22;
+            return true;
+        default:
+            break;
+    }
+
+    return false;
+}
+
 int main(int argc, const char** argv)
 {
     gfxrecon::util::Log::Init();
 
-    gfxrecon::util::ArgumentParser arg_parser(argc, argv, kOptions, "");
+    gfxrecon::util::ArgumentParser arg_parser(argc, argv, kOptions, kArguments);
 
     if (CheckOptionPrintUsage(argv[0], arg_parser) || CheckOptionPrintVersion(argv[0], arg_parser))
     {
@@ -196,9 +265,76 @@ int main(int argc, const char** argv)
         }
     }
 
+    uint32_t    dedup_limit       = 0;
+    const auto& dedup_limit_value = arg_parser.GetArgumentValue(kDedupLimitArgument);
+
+    if (!dedup_limit_value.empty())
+    {
+        int32_t value = 0;
+
+        if (ParseIntegerArgument(dedup_limit_value, &value) && (value >= 0))
+        {
+            dedup_limit = static_cast<uint32_t>(value);
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid content deduplication limit \'%s\'", dedup_limit_value.c_str());
+        }
+    }
+
+    uint32_t    thread_count  = std::max(std::thread::hardware_concurrency(), 1u);
+    const auto& threads_value = arg_parser.GetArgumentValue(kThreadsArgument);
+
+    if (!threads_value.empty())
+    {
+        int32_t value = 0;
+
+        if (ParseIntegerArgument(threads_value, &value) && (value > 0))
+        {
+            thread_count = static_cast<uint32_t>(value);
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid thread count \'%s\'", threads_value.c_str());
+        }
+    }
+
+    int32_t     compression_level = gfxrecon::util::kDefaultCompressionLevel;
+    const auto& level_value       = arg_parser.GetArgumentValue(kLevelArgument);
+
+    if (!level_value.empty())
+    {
+        int32_t min_level = 0;
+        int32_t max_level = 0;
+        int32_t value     = 0;
+
+        if (!GetCompressionLevelRange(compression_type, &min_level, &max_level))
+        {
+            GFXRECON_LOG_WARNING("Ignoring compression level \'%s\', which does not apply to %s",
+                                 level_value.c_str(),
+                                 GetCompressionTypeName(compression_type).c_str());
+        }
+        else if (ParseIntegerArgument(level_value, &value) && (value >= min_level) && (value <= max_level))
+        {
+            compression_level = value;
+        }
+        else
+        {
+            GFXRECON_LOG_ERROR("Invalid compression level \'%s\' for %s, which accepts levels %d to %d",
+                               level_value.c_str(),
+                               GetCompressionTypeName(compression_type).c_str(),
+                               min_level,
+                               max_level);
+            PrintUsage(argv[0]);
+            gfxrecon::util::Log::Release();
+            exit(-1);
+        }
+    }
+
     gfxrecon::CompressionConverter file_converter;
 
-    if (file_converter.Initialize(input_filename, output_filename, compression_type))
+    if (file_converter.Initialize(
+            input_filename, output_filename, compression_type, dedup_limit, thread_count, compression_level))
     {
         if (file_converter.Process())
         {
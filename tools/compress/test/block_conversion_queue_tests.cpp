@@ -0,0 +1,315 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "block_conversion_queue.h"
+
+#include "format/format.h"
+#include "util/compressor.h"
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using gfxrecon::BlockConversionQueue;
+using gfxrecon::format::BlockHeader;
+
+namespace
+{
+
+const size_t  kThreadCount    = 4;
+const size_t  kMaxQueuedBytes = 1024 * 1024;
+const uint8_t kFailMarker     = 0xff;
+
+// "Compresses" data by keeping its first half, after a delay that varies with the first byte of the data so that the
+// worker threads finish converting blocks out of order.  Data that is too small to halve is left uncompressed.
+class HalvingCompressor : public gfxrecon::util::Compressor
+{
+  public:
+    size_t Compress(const size_t          uncompressed_size,
+                    const uint8_t*        uncompressed_data,
+                    std::vector<uint8_t>* compressed_data,
+                    size_t                compressed_data_offset) override
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(3 - (uncompressed_data[0] % 4)));
+
+        size_t compressed_size = uncompressed_size / 2;
+        compressed_data->resize(compressed_data_offset + compressed_size);
+        memcpy(compressed_data->data() + compressed_data_offset, uncompressed_data, compressed_size);
+        return compressed_size;
+    }
+
+    size_t Decompress(const size_t, const uint8_t*, const size_t, uint8_t*) override { return 0; }
+};
+
+// "Decompresses" data by copying it, failing for data that starts with kFailMarker.
+class CopyingDecompressor : public gfxrecon::util::Compressor
+{
+  public:
+    size_t Compress(const size_t, const uint8_t*, std::vector<uint8_t>*, size_t) override { return 0; }
+
+    size_t Decompress(const size_t   compressed_size,
+                      const uint8_t* compressed_data,
+                      const size_t   expected_uncompressed_size,
+                      uint8_t*       uncompressed_data) override
+    {
+        if ((compressed_size != expected_uncompressed_size) || (compressed_data[0] == kFailMarker))
+        {
+            return 0;
+        }
+
+        memcpy(uncompressed_data, compressed_data, compressed_size);
+        return compressed_size;
+    }
+};
+
+std::vector<uint8_t> MakeBlockData(size_t index, size_t size)
+{
+    std::vector<uint8_t> data(size);
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        data[i] = static_cast<uint8_t>(index + i);
+    }
+
+    return data;
+}
+
+void AppendBytes(std::vector<uint8_t>* output, const void* data, size_t size)
+{
+    auto bytes = static_cast<const uint8_t*>(data);
+    output->insert(output->end(), bytes, bytes + size);
+}
+
+// Queues a block with data that is either uncompressed or "compressed" for CopyingDecompressor, and appends the data
+// that is expected to be written for it when there is no target compressor.
+bool QueueBlock(BlockConversionQueue*       queue,
+                const std::vector<uint8_t>& data,
+                bool                        source_compressed,
+                std::vector<uint8_t>*       expected)
+{
+    BlockHeader uncompressed_header{ data.size(), gfxrecon::format::kFunctionCallBlock };
+    BlockHeader compressed_header{ data.size(), gfxrecon::format::kCompressedFunctionCallBlock };
+
+    if (!queue->WriteBlock(&uncompressed_header,
+                           sizeof(uncompressed_header),
+                           &compressed_header,
+                           sizeof(compressed_header),
+                           data.data(),
+                           data.size(),
+                           source_compressed,
+                           data.size()))
+    {
+        return false;
+    }
+
+    if (expected != nullptr)
+    {
+        AppendBytes(expected, &uncompressed_header, sizeof(uncompressed_header));
+        AppendBytes(expected, data.data(), data.size());
+    }
+
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("BlockConversionQueue writes blocks in the order that they were queued", "[compress][pre_submit]")
+{
+    const size_t kBlockCount = 64;
+
+    HalvingCompressor    compressor;
+    std::vector<uint8_t> output;
+    std::vector<uint8_t> expected;
+
+    BlockConversionQueue queue(
+        nullptr, &compressor, kThreadCount, kMaxQueuedBytes, [&output](const void* data, size_t size) {
+            AppendBytes(&output, data, size);
+            return true;
+        });
+
+    for (size_t i = 0; i < kBlockCount; ++i)
+    {
+        // Data written without conversion must stay between the blocks that it was written between.
+        uint32_t marker = static_cast<uint32_t>(i);
+        REQUIRE(queue.Write(&marker, sizeof(marker)));
+        AppendBytes(&expected, &marker, sizeof(marker));
+
+        // Every eighth block is too small to compress, and is written uncompressed.
+        auto        data = MakeBlockData(i, ((i % 8) == 0) ? 1 : 1024 + (i * 16));
+        BlockHeader uncompressed_header{ data.size(), gfxrecon::format::kFunctionCallBlock };
+        BlockHeader compressed_header{ 0, gfxrecon::format::kCompressedFunctionCallBlock };
+
+        REQUIRE(queue.WriteBlock(&uncompressed_header,
+                                 sizeof(uncompressed_header),
+                                 &compressed_header,
+                                 sizeof(compressed_header),
+                                 data.data(),
+                                 data.size(),
+                                 false,
+                                 data.size()));
+
+        if (data.size() > 1)
+        {
+            compressed_header.size = data.size() / 2;
+            AppendBytes(&expected, &compressed_header, sizeof(compressed_header));
+            AppendBytes(&expected, data.data(), data.size() / 2);
+        }
+        else
+        {
+            AppendBytes(&expected, &uncompressed_header, sizeof(uncompressed_header));
+            AppendBytes(&expected, data.data(), data.size());
+        }
+    }
+
+    REQUIRE(queue.Flush());
+    CHECK(queue.GetStatus() == BlockConversionQueue::kStatusOk);
+    CHECK(output == expected);
+}
+
+TEST_CASE("BlockConversionQueue stops writing when a block fails to convert", "[compress][pre_submit]")
+{
+    const size_t kBlockCount  = 32;
+    const size_t kFailedBlock = 20;
+
+    CopyingDecompressor  decompressor;
+    std::vector<uint8_t> output;
+    std::vector<uint8_t> expected;
+
+    BlockConversionQueue queue(
+        &decompressor, nullptr, kThreadCount, kMaxQueuedBytes, [&output](const void* data, size_t size) {
+            AppendBytes(&output, data, size);
+            return true;
+        });
+
+    for (size_t i = 0; i < kBlockCount; ++i)
+    {
+        auto data = MakeBlockData(i, 4096);
+
+        if (i == kFailedBlock)
+        {
+            data[0] = kFailMarker;
+        }
+
+        // Blocks after the failed block may be queued, and even converted, before the failure is detected, but they
+        // must not be written.
+        if (!QueueBlock(&queue, data, true, (i < kFailedBlock) ? &expected : nullptr))
+        {
+            CHECK(i > kFailedBlock);
+            break;
+        }
+    }
+
+    CHECK_FALSE(queue.Flush());
+    CHECK(queue.GetStatus() == BlockConversionQueue::kStatusDecompressionFailed);
+
+    uint32_t marker = 0;
+    CHECK_FALSE(queue.Write(&marker, sizeof(marker)));
+    CHECK_FALSE(QueueBlock(&queue, MakeBlockData(0, 16), false, nullptr));
+    CHECK_FALSE(queue.Flush());
+    CHECK(output == expected);
+}
+
+TEST_CASE("BlockConversionQueue stops writing when a write fails", "[compress][pre_submit]")
+{
+    const size_t kBlockCount = 32;
+    const size_t kFailedCall = 9;
+
+    size_t write_calls = 0;
+
+    BlockConversionQueue queue(nullptr, nullptr, kThreadCount, kMaxQueuedBytes, [&write_calls](const void*, size_t) {
+        return (write_calls++ != kFailedCall);
+    });
+
+    for (size_t i = 0; i < kBlockCount; ++i)
+    {
+        if (!QueueBlock(&queue, MakeBlockData(i, 4096), false, nullptr))
+        {
+            break;
+        }
+    }
+
+    CHECK_FALSE(queue.Flush());
+    CHECK(queue.GetStatus() == BlockConversionQueue::kStatusWriteFailed);
+    CHECK(write_calls == kFailedCall + 1);
+}
+
+TEST_CASE("BlockConversionQueue blocks the reader when the queued data limit is reached", "[compress][pre_submit]")
+{
+    const size_t kBlockCount = 8;
+    const size_t kBlockSize  = 4096;
+
+    std::mutex              mutex;
+    std::condition_variable condition;
+    bool                    writing  = false;
+    bool                    released = false;
+    std::atomic<size_t>     queued_count{ 0 };
+    std::vector<uint8_t>    output;
+    std::vector<uint8_t>    expected;
+
+    // The writer stalls on the first write until the test releases it.
+    BlockConversionQueue queue(nullptr, nullptr, kThreadCount, kBlockSize, [&](const void* data, size_t size) {
+        std::unique_lock<std::mutex> lock(mutex);
+        writing = true;
+        condition.notify_all();
+        condition.wait(lock, [&released]() { return released; });
+        AppendBytes(&output, data, size);
+        return true;
+    });
+
+    std::thread reader([&]() {
+        for (size_t i = 0; i < kBlockCount; ++i)
+        {
+            QueueBlock(&queue, MakeBlockData(i, kBlockSize), false, &expected);
+            ++queued_count;
+        }
+    });
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [&writing]() { return writing; });
+    }
+
+    // The limit is smaller than a block, so while the writer is stalled the reader can queue at most one block after
+    // the block that is being written.
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    CHECK(queued_count <= 2);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        released = true;
+    }
+
+    condition.notify_all();
+    reader.join();
+
+    REQUIRE(queue.Flush());
+    CHECK(queued_count == kBlockCount);
+    CHECK(output == expected);
+}
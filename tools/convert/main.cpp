@@ -24,12 +24,20 @@
 #include PROJECT_VERSION_HEADER_FILE
 #include "tool_settings.h"
 #include "decode/json_writer.h" /// @todo move to util?
+#include "decode/columnar_call_decoder.h"
+#include "decode/columnar_call_writer.h"
 #include "decode/decode_api_detection.h"
 #include "format/format.h"
 #include "util/file_output_stream.h"
 #include "util/file_path.h"
 #include "util/platform.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cinttypes>
+#include <thread>
+#include <vector>
+
 #include "generated/generated_vulkan_json_consumer.h"
 #include "decode/marker_json_consumer.h"
 #include "decode/metadata_json_consumer.h"
@@ -44,9 +52,15 @@ using VulkanJsonConsumer = gfxrecon::decode::MetadataJsonConsumer<
 using Dx12JsonConsumer =
     gfxrecon::decode::MetadataJsonConsumer<gfxrecon::decode::MarkerJsonConsumer<gfxrecon::decode::Dx12JsonConsumer>>;
 #endif
-const char kOptions[] = "-h|--help,--version,--no-debug-popup,--file-per-frame,--include-binaries,--expand-flags";
+const char kOptions[] =
+    "-h|--help,--version,--no-debug-popup,--file-per-frame,--include-binaries,--expand-flags,--memory-mapped-file";
+
+const char kThreadsArgument[] = "--threads";
 
-const char kArguments[] = "--output,--format";
+const char kColumnarFormat[]        = "columns";
+const char kColumnarFileExtension[] = "gfxc";
+
+const char kArguments[] = "--output,--format,--threads";
 
 static void PrintUsage(const char* exe_name)
 {
@@ -71,6 +85,10 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("  --format <format>\tJSON format to write.");
     GFXRECON_WRITE_CONSOLE("           json\t\tStandard JSON format (indented)");
     GFXRECON_WRITE_CONSOLE("           jsonl\tJSON lines format (every object in a single line)");
+    GFXRECON_WRITE_CONSOLE("           columns\tBinary table of the API calls, with the block index, call ID,");
+    GFXRECON_WRITE_CONSOLE("                  \tthread ID, frame, handle ID and parameter data size of each call");
+    GFXRECON_WRITE_CONSOLE("                  \tstored in compressed chunks of columns. Default is the input");
+    GFXRECON_WRITE_CONSOLE("                  \tfilepath with \"gfxr\" replaced by \"gfxc\".");
     GFXRECON_WRITE_CONSOLE("  --include-binaries\tDump binaries from Vulkan traces in a separate file with an unique "
                            "name. The main JSON file");
     GFXRECON_WRITE_CONSOLE("                    \twill include a reference with the file name. The binary files are "
@@ -81,6 +99,11 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE(
         "  --file-per-frame\tCreates a new file for every frame processed. Frame number is added as a suffix");
     GFXRECON_WRITE_CONSOLE("                  \tto the output file name.");
+    GFXRECON_WRITE_CONSOLE("  --threads <count>\tNumber of frames to convert at once with --file-per-frame.");
+    GFXRECON_WRITE_CONSOLE("                   \tFrames are located with the capture file's index and are");
+    GFXRECON_WRITE_CONSOLE("                   \tconverted independently by worker threads. Default is 1.");
+    GFXRECON_WRITE_CONSOLE("  --memory-mapped-file\tRead the capture file through a memory mapping, decoding");
+    GFXRECON_WRITE_CONSOLE("                      \tuncompressed block data in place.");
 
 #if defined(WIN32) && defined(_DEBUG)
     GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
@@ -90,7 +113,7 @@ static void PrintUsage(const char* exe_name)
 
 static std::string GetOutputFileName(const gfxrecon::util::ArgumentParser& arg_parser,
                                      const std::string&                    input_filename,
-                                     JsonFormat                            output_format)
+                                     const std::string&                    extension)
 {
     std::string output_filename;
     if (arg_parser.IsArgumentSet(kOutput))
@@ -106,15 +129,21 @@ static std::string GetOutputFileName(const gfxrecon::util::ArgumentParser& arg_p
         {
             output_filename = output_filename.substr(0, ext_pos);
         }
-        output_filename += "." + gfxrecon::util::get_json_format(output_format);
+        output_filename += "." + extension;
     }
     return output_filename;
 }
 
+static bool IsColumnarOutput(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    return arg_parser.IsArgumentSet(kFormatArgument) &&
+           (arg_parser.GetArgumentValue(kFormatArgument) == kColumnarFormat);
+}
+
 static gfxrecon::util::JsonFormat GetOutputFormat(const gfxrecon::util::ArgumentParser& arg_parser)
 {
     std::string output_format;
-    if (arg_parser.IsArgumentSet(kFormatArgument))
+    if (arg_parser.IsArgumentSet(kFormatArgument) && !IsColumnarOutput(arg_parser))
     {
         output_format = arg_parser.GetArgumentValue(kFormatArgument);
         return gfxrecon::util::get_json_format(output_format);
@@ -122,6 +151,13 @@ static gfxrecon::util::JsonFormat GetOutputFormat(const gfxrecon::util::Argument
     return JsonFormat::JSON;
 }
 
+static std::string GetVulkanVersion()
+{
+    return std::to_string(VK_VERSION_MAJOR(VK_HEADER_VERSION_COMPLETE)) + "." +
+           std::to_string(VK_VERSION_MINOR(VK_HEADER_VERSION_COMPLETE)) + "." +
+           std::to_string(VK_VERSION_PATCH(VK_HEADER_VERSION_COMPLETE));
+}
+
 std::string FormatFrameNumber(uint32_t frame_number)
 {
     std::ostringstream stream;
@@ -129,6 +165,166 @@ std::string FormatFrameNumber(uint32_t frame_number)
     return stream.str();
 }
 
+// Converts every frame of the capture file to its own output file, with thread_count worker threads each reading the
+// file through their own FileProcessor.  The JSON consumers do not carry state from one frame to the next, so once the
+// file index has located the frames, each frame is converted independently by seeking to its first block.
+static bool ConvertFramesInParallel(gfxrecon::decode::FileProcessor&   file_processor,
+                                    const std::string&                 input_filename,
+                                    const std::string&                 output_filename,
+                                    const gfxrecon::util::JsonOptions& json_options,
+                                    const std::string&                 vulkan_version,
+                                    bool                               use_memory_mapped_file,
+                                    uint32_t                           thread_count)
+{
+    const gfxrecon::format::FileIndex* file_index = file_processor.GetFileIndex();
+
+    if (file_index == nullptr)
+    {
+        GFXRECON_LOG_ERROR("Failed to index the frames of capture file \"%s\"", input_filename.c_str());
+        return false;
+    }
+
+    const auto&         frames = file_index->GetFrames();
+    std::atomic<size_t> next_frame{ 0 };
+    std::atomic<bool>   success{ true };
+
+    auto convert_frames = [&]() {
+        gfxrecon::decode::FileProcessor frame_processor;
+        frame_processor.SetUseMemoryMappedFile(use_memory_mapped_file);
+
+        if (!frame_processor.Initialize(input_filename))
+        {
+            success = false;
+            return;
+        }
+
+        frame_processor.SetFileIndex(*file_index);
+
+        VulkanJsonConsumer              json_consumer;
+        gfxrecon::decode::VulkanDecoder decoder;
+        decoder.AddConsumer(&json_consumer);
+        frame_processor.AddDecoder(&decoder);
+
+        gfxrecon::decode::JsonWriter json_writer{ json_options, GFXRECON_PROJECT_VERSION_STRING, input_filename };
+        frame_processor.SetAnnotationProcessor(&json_writer);
+        json_consumer.Initialize(&json_writer, vulkan_version);
+
+#ifdef D3D12_SUPPORT
+        Dx12JsonConsumer              dx12_json_consumer;
+        gfxrecon::decode::Dx12Decoder dx12_decoder;
+
+        dx12_decoder.AddConsumer(&dx12_json_consumer);
+        frame_processor.AddDecoder(&dx12_decoder);
+        dx12_json_consumer.Initialize(&json_writer);
+#endif
+
+        for (size_t i = next_frame++; (i < frames.size()) && success; i = next_frame++)
+        {
+            const uint64_t    frame_number  = frames[i].frame_number;
+            const std::string frame_postfix = FormatFrameNumber(static_cast<uint32_t>(frame_number));
+            const std::string json_filename =
+                gfxrecon::util::filepath::InsertFilenamePostfix(output_filename, "_" + frame_postfix);
+            FILE* out_file_handle = nullptr;
+
+            gfxrecon::util::platform::FileOpen(&out_file_handle, json_filename.c_str(), "w");
+
+            if (out_file_handle == nullptr)
+            {
+                GFXRECON_LOG_ERROR("Failed to create file: '%s'.", json_filename.c_str());
+                success = false;
+                break;
+            }
+
+            gfxrecon::util::FileNoLockOutputStream out_stream{ out_file_handle, false };
+
+            // Binary files are named for their frame, so the names do not depend on how frames are assigned to threads.
+            json_writer.SetFilenamePrefix(frame_postfix + "_");
+            json_writer.StartStream(&out_stream);
+
+            bool converted = frame_processor.SeekToFrame(frame_number);
+
+            if (converted)
+            {
+                frame_processor.ProcessNextFrame();
+                converted = (frame_processor.GetErrorState() == gfxrecon::decode::FileProcessor::kErrorNone);
+            }
+
+            json_writer.EndStream();
+            gfxrecon::util::platform::FileClose(out_file_handle);
+
+            if (!converted)
+            {
+                GFXRECON_LOG_ERROR("Failed to convert frame %" PRIu64, frame_number);
+                success = false;
+            }
+        }
+
+        json_consumer.Destroy();
+#ifdef D3D12_SUPPORT
+        dx12_json_consumer.Destroy();
+#endif
+    };
+
+    std::vector<std::thread> workers;
+    for (uint32_t i = 1; i < thread_count; ++i)
+    {
+        workers.emplace_back(convert_frames);
+    }
+
+    convert_frames();
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    return success;
+}
+
+// Writes a row for each API call in the capture file to a columnar call file, without decoding the call parameters.
+static bool ConvertToColumns(gfxrecon::decode::FileProcessor& file_processor, const std::string& output_filename)
+{
+    FILE* out_file_handle = nullptr;
+    gfxrecon::util::platform::FileOpen(&out_file_handle, output_filename.c_str(), "wb");
+
+    if (out_file_handle == nullptr)
+    {
+        GFXRECON_LOG_ERROR("Failed to open/create output file \"%s\"; is the path valid?", output_filename.c_str());
+        return false;
+    }
+
+#if defined(GFXRECON_ENABLE_LZ4_COMPRESSION)
+    const auto compression_type = gfxrecon::format::CompressionType::kLz4;
+#else
+    const auto compression_type = gfxrecon::format::CompressionType::kNone;
+#endif
+
+    gfxrecon::util::FileNoLockOutputStream out_stream{ out_file_handle, false };
+    gfxrecon::decode::ColumnarCallWriter   writer{ &out_stream, compression_type };
+    gfxrecon::decode::ColumnarCallDecoder  decoder{ &writer };
+    file_processor.AddDecoder(&decoder);
+
+    bool success = writer.WriteHeader();
+    bool reading = success;
+
+    while (reading)
+    {
+        decoder.SetFrameNumber(file_processor.GetCurrentFrameNumber());
+        reading = file_processor.ProcessNextFrame();
+    }
+
+    success = writer.Flush() && success;
+    gfxrecon::util::platform::FileClose(out_file_handle);
+
+    if (file_processor.GetErrorState() != gfxrecon::decode::FileProcessor::kErrorNone)
+    {
+        GFXRECON_LOG_ERROR("Failed to process trace.");
+        success = false;
+    }
+
+    return success;
+}
+
 int main(int argc, const char** argv)
 {
     int ret_code = 0;
@@ -164,7 +360,9 @@ int main(int argc, const char** argv)
     const auto& positional_arguments = arg_parser.GetPositionalArguments();
     std::string input_filename       = positional_arguments[0];
     JsonFormat  output_format        = GetOutputFormat(arg_parser);
-    std::string output_filename      = GetOutputFileName(arg_parser, input_filename, output_format);
+    bool        columnar_output      = IsColumnarOutput(arg_parser);
+    std::string output_extension     = columnar_output ? kColumnarFileExtension : get_json_format(output_format);
+    std::string output_filename      = GetOutputFileName(arg_parser, input_filename, output_extension);
     std::string filename_stem        = gfxrecon::util::filepath::GetFilenameStem(output_filename);
     std::string output_dir           = gfxrecon::util::filepath::GetBasedir(output_filename);
     std::string data_dir             = gfxrecon::util::filepath::Join(output_dir, filename_stem);
@@ -172,8 +370,26 @@ int main(int argc, const char** argv)
     bool        expand_flags         = arg_parser.IsOptionSet(kExpandFlagsOption);
     bool        file_per_frame       = arg_parser.IsOptionSet(kFilePerFrameOption);
     bool        output_to_stdout     = output_filename == "stdout";
+    bool        use_mapped_file      = arg_parser.IsOptionSet(kMemoryMappedFileOption);
+    uint32_t    thread_count         = 1;
+    const auto& threads_value        = arg_parser.GetArgumentValue(kThreadsArgument);
+
+    if (!threads_value.empty())
+    {
+        int value = std::stoi(threads_value);
+
+        if (value > 0)
+        {
+            thread_count = static_cast<uint32_t>(value);
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid thread count %d", value);
+        }
+    }
 
     gfxrecon::decode::FileProcessor file_processor;
+    file_processor.SetUseMemoryMappedFile(use_mapped_file);
 
 #ifndef D3D12_SUPPORT
     bool detected_d3d12  = false;
@@ -193,12 +409,80 @@ int main(int argc, const char** argv)
         file_per_frame = false;
     }
 
+    if (columnar_output)
+    {
+        if (output_to_stdout)
+        {
+            GFXRECON_LOG_ERROR("Columnar output must be written to a file.");
+            gfxrecon::util::Log::Release();
+            exit(1);
+        }
+
+        if (file_per_frame || dump_binaries)
+        {
+            GFXRECON_LOG_WARNING("%s and %s are ignored with --format %s.",
+                                 kFilePerFrameOption,
+                                 kIncludeBinariesOption,
+                                 kColumnarFormat);
+            file_per_frame = false;
+            dump_binaries  = false;
+        }
+    }
+
+    if ((thread_count > 1) && !file_per_frame)
+    {
+        GFXRECON_LOG_WARNING("Frames are only converted on multiple threads with %s.", kFilePerFrameOption);
+        thread_count = 1;
+    }
+
+#if defined(D3D12_SUPPORT)
+    if ((thread_count > 1) && dump_binaries)
+    {
+        // D3D12 binary files are numbered per thread, so files written by different threads would have the same names.
+        GFXRECON_LOG_WARNING("Frames are converted on a single thread when %s is set.", kIncludeBinariesOption);
+        thread_count = 1;
+    }
+#endif
+
     if (dump_binaries)
     {
         gfxrecon::util::filepath::MakeDirectory(data_dir);
     }
 
-    if (file_processor.Initialize(input_filename))
+    if (columnar_output)
+    {
+        if (file_processor.Initialize(input_filename))
+        {
+            if (!ConvertToColumns(file_processor, output_filename))
+            {
+                ret_code = 1;
+            }
+        }
+    }
+    else if (thread_count > 1)
+    {
+        gfxrecon::util::JsonOptions json_options;
+        json_options.root_dir      = output_dir;
+        json_options.data_sub_dir  = filename_stem;
+        json_options.format        = output_format;
+        json_options.dump_binaries = dump_binaries;
+        json_options.expand_flags  = expand_flags;
+
+        if (file_processor.Initialize(input_filename))
+        {
+            if (!ConvertFramesInParallel(file_processor,
+                                         input_filename,
+                                         output_filename,
+                                         json_options,
+                                         GetVulkanVersion(),
+                                         use_mapped_file,
+                                         thread_count))
+            {
+                ret_code = 1;
+            }
+        }
+    }
+    else if (file_processor.Initialize(input_filename))
     {
         std::string json_filename;
         FILE*       out_file_handle = nullptr;
@@ -244,11 +528,8 @@ int main(int argc, const char** argv)
             gfxrecon::decode::JsonWriter json_writer{ json_options, GFXRECON_PROJECT_VERSION_STRING, input_filename };
             file_processor.SetAnnotationProcessor(&json_writer);
 
-            bool              success = true;
-            const std::string vulkan_version{ std::to_string(VK_VERSION_MAJOR(VK_HEADER_VERSION_COMPLETE)) + "." +
-                                              std::to_string(VK_VERSION_MINOR(VK_HEADER_VERSION_COMPLETE)) + "." +
-                                              std::to_string(VK_VERSION_PATCH(VK_HEADER_VERSION_COMPLETE)) };
-            json_consumer.Initialize(&json_writer, vulkan_version);
+            bool success = true;
+            json_consumer.Initialize(&json_writer, GetVulkanVersion());
             json_writer.StartStream(&out_stream);
 
             // If CONVERT_EXPERIMENTAL_D3D12 was set, then add DX12 consumer/decoder
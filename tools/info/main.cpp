@@ -28,6 +28,7 @@
 #include "decode/stat_consumer_base.h"
 #include "decode/stat_decoder_base.h"
 #include "decode/file_processor.h"
+#include "format/file_index.h"
 #include "format/format.h"
 #include "format/format_util.h"
 #include "generated/generated_vulkan_consumer.h"
@@ -59,15 +60,18 @@
 
 #include <nlohmann/json.hpp>
 
-const char kHelpShortOption[]   = "-h";
-const char kHelpLongOption[]    = "--help";
-const char kVersionOption[]     = "--version";
-const char kNoDebugPopup[]      = "--no-debug-popup";
-const char kExeInfoOnlyOption[] = "--exe-info-only";
-const char kEnvVarsOnlyOption[] = "--env-vars-only";
-const char kEnumGpuIndices[]    = "--enum-gpu-indices";
+const char kHelpShortOption[]        = "-h";
+const char kHelpLongOption[]         = "--help";
+const char kVersionOption[]          = "--version";
+const char kNoDebugPopup[]           = "--no-debug-popup";
+const char kExeInfoOnlyOption[]      = "--exe-info-only";
+const char kEnvVarsOnlyOption[]      = "--env-vars-only";
+const char kEnumGpuIndices[]         = "--enum-gpu-indices";
+const char kMemoryMappedFileOption[] = "--memory-mapped-file";
+const char kWriteIndexOption[]       = "--write-index";
 
-const char kOptions[] = "-h|--help,--version,--no-debug-popup,--exe-info-only,--env-vars-only,--enum-gpu-indices";
+const char kOptions[] = "-h|--help,--version,--no-debug-popup,--exe-info-only,--env-vars-only,--enum-gpu-indices,"
+                        "--memory-mapped-file,--write-index";
 
 const char kUnrecognizedFormatString[] = "<unrecognized-format>";
 
@@ -107,6 +111,8 @@ class AnnotationRecorder : public gfxrecon::decode::AnnotationHandler
 struct ApiAgnosticStats
 {
     gfxrecon::format::CompressionType      compression_type;
+    uint32_t                               content_deduplication_limit;
+    bool                                   compact_encoding;
     uint32_t                               trim_start_frame;
     uint32_t                               frame_count;
     gfxrecon::decode::FileProcessor::Error error_state;
@@ -138,7 +144,8 @@ static void PrintUsage(const char* exe_name)
     }
     GFXRECON_WRITE_CONSOLE("\n%s - Print statistics for a GFXReconstruct capture file.\n", app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Usage:");
-    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] [--exe-info-only] <file>\n", app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] [--exe-info-only] [--write-index] <file>\n",
+                           app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Required arguments:");
     GFXRECON_WRITE_CONSOLE("  <file>\t\tThe GFXReconstruct capture file to be processed.");
     GFXRECON_WRITE_CONSOLE("\nOptional arguments:");
@@ -147,6 +154,11 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("  --exe-info-only\tQuickly exit after extracting captured application's executable name");
     GFXRECON_WRITE_CONSOLE(
         "  --env-vars-only\tQuickly exit after extracting captured application's environment variables");
+    GFXRECON_WRITE_CONSOLE("  --memory-mapped-file\tRead the capture file through a memory mapping, decoding");
+    GFXRECON_WRITE_CONSOLE("        \t\tuncompressed block data in place.");
+    GFXRECON_WRITE_CONSOLE("  --write-index\tWrite an index of frame and block locations to <file>.idx");
+    GFXRECON_WRITE_CONSOLE("        \t\tand exit.  The index allows tools to seek to frames without");
+    GFXRECON_WRITE_CONSOLE("        \t\treading the full capture file.");
 #if defined(WIN32) && defined(_DEBUG)
     GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
     GFXRECON_WRITE_CONSOLE("        \t\tdisplayed when abort() is called (Windows debug only).");
@@ -208,7 +220,9 @@ void GatherApiAgnosticStats(ApiAgnosticStats&                api_agnostic_stats,
     api_agnostic_stats.error_state = file_processor.GetErrorState();
 
     // File options.
-    gfxrecon::format::CompressionType compression_type = gfxrecon::format::CompressionType::kNone;
+    gfxrecon::format::CompressionType compression_type            = gfxrecon::format::CompressionType::kNone;
+    uint32_t                          content_deduplication_limit = 0;
+    bool                              compact_encoding            = false;
 
     auto file_options = file_processor.GetFileOptions();
     for (const auto& option : file_options)
@@ -217,11 +231,21 @@ void GatherApiAgnosticStats(ApiAgnosticStats&                api_agnostic_stats,
         {
             compression_type = static_cast<gfxrecon::format::CompressionType>(option.value);
         }
+        else if (option.key == gfxrecon::format::FileOption::kContentDeduplication)
+        {
+            content_deduplication_limit = option.value;
+        }
+        else if (option.key == gfxrecon::format::FileOption::kCompactEncoding)
+        {
+            compact_encoding = (option.value != 0);
+        }
     }
-    api_agnostic_stats.compression_type   = compression_type;
-    api_agnostic_stats.trim_start_frame   = stat_consumer.GetTrimmedStartFrame();
-    api_agnostic_stats.frame_count        = file_processor.GetCurrentFrameNumber();
-    api_agnostic_stats.uses_frame_markers = file_processor.UsesFrameMarkers();
+    api_agnostic_stats.compression_type            = compression_type;
+    api_agnostic_stats.content_deduplication_limit = content_deduplication_limit;
+    api_agnostic_stats.compact_encoding            = compact_encoding;
+    api_agnostic_stats.trim_start_frame            = stat_consumer.GetTrimmedStartFrame();
+    api_agnostic_stats.frame_count                 = file_processor.GetCurrentFrameNumber();
+    api_agnostic_stats.uses_frame_markers          = file_processor.UsesFrameMarkers();
 }
 
 std::string GetJsonValue(const nlohmann::json& json_obj, const std::string& key)
@@ -366,7 +390,9 @@ void PrintVulkanStats(const gfxrecon::decode::VulkanStatsConsumer& vulkan_stats_
     {
         GFXRECON_WRITE_CONSOLE("");
         GFXRECON_WRITE_CONSOLE("File info:");
-        gfxrecon::format::CompressionType compression_type = gfxrecon::format::CompressionType::kNone;
+        gfxrecon::format::CompressionType compression_type            = gfxrecon::format::CompressionType::kNone;
+        uint32_t                          content_deduplication_limit = 0;
+        bool                              compact_encoding            = false;
 
         auto file_options = file_processor.GetFileOptions();
         for (const auto& option : file_options)
@@ -375,6 +401,14 @@ void PrintVulkanStats(const gfxrecon::decode::VulkanStatsConsumer& vulkan_stats_
             {
                 compression_type = static_cast<gfxrecon::format::CompressionType>(option.value);
             }
+            else if (option.key == gfxrecon::format::FileOption::kContentDeduplication)
+            {
+                content_deduplication_limit = option.value;
+            }
+            else if (option.key == gfxrecon::format::FileOption::kCompactEncoding)
+            {
+                compact_encoding = (option.value != 0);
+            }
         }
 
         // Compression type.
@@ -388,6 +422,16 @@ void PrintVulkanStats(const gfxrecon::decode::VulkanStatsConsumer& vulkan_stats_
             GFXRECON_WRITE_CONSOLE("\tCompression format: %s", kUnrecognizedFormatString);
         }
 
+        if (content_deduplication_limit > 0)
+        {
+            GFXRECON_WRITE_CONSOLE("\tContent deduplication limit: %u MiB", content_deduplication_limit);
+        }
+
+        if (compact_encoding)
+        {
+            GFXRECON_WRITE_CONSOLE("\tParameter encoding: compact");
+        }
+
         // Frame counts.
         uint32_t trim_start_frame = vulkan_stats_consumer.GetTrimmedStartFrame();
         uint32_t frame_count      = file_processor.GetCurrentFrameNumber();
@@ -637,6 +681,17 @@ void PrintD3D12Stats(gfxrecon::decode::Dx12StatsConsumer& dx12_consumer,
             GFXRECON_WRITE_CONSOLE("\tCompression format: %s", kUnrecognizedFormatString);
         }
 
+        if (api_agnostic_stats.content_deduplication_limit > 0)
+        {
+            GFXRECON_WRITE_CONSOLE("\tContent deduplication limit: %u MiB",
+                                   api_agnostic_stats.content_deduplication_limit);
+        }
+
+        if (api_agnostic_stats.compact_encoding)
+        {
+            GFXRECON_WRITE_CONSOLE("\tParameter encoding: compact");
+        }
+
         if (api_agnostic_stats.trim_start_frame == 0)
         {
             // Not a trimmed file.
@@ -754,9 +809,30 @@ void GatherAndPrintEnvVars(const std::string& input_filename)
     }
 }
 
-void GatherAndPrintAllInfo(const std::string& input_filename)
+void WriteFileIndex(const std::string& input_filename)
+{
+    gfxrecon::format::FileIndex file_index;
+    std::string                 index_filename = gfxrecon::format::FileIndex::GetIndexFilename(input_filename);
+
+    if (file_index.Build(input_filename) && file_index.Save(index_filename))
+    {
+        GFXRECON_WRITE_CONSOLE("Wrote index file %s", index_filename.c_str());
+        GFXRECON_WRITE_CONSOLE("\tBlocks: %" PRIu64, file_index.GetBlockCount());
+        // The last frame entry marks the end of the file.
+        GFXRECON_WRITE_CONSOLE("\tFrames: %" PRIu64, static_cast<uint64_t>(file_index.GetFrames().size() - 1));
+        GFXRECON_WRITE_CONSOLE("\tState markers: %" PRIu64,
+                               static_cast<uint64_t>(file_index.GetStateMarkers().size()));
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("Failed to write index file %s", index_filename.c_str());
+    }
+}
+
+void GatherAndPrintAllInfo(const std::string& input_filename, bool use_memory_mapped_file)
 {
     gfxrecon::decode::FileProcessor file_processor;
+    file_processor.SetUseMemoryMappedFile(use_memory_mapped_file);
     if (file_processor.Initialize(input_filename))
     {
         gfxrecon::decode::StatDecoderBase stat_decoder;
@@ -890,9 +966,13 @@ int main(int argc, const char** argv)
     {
         GatherAndPrintEnvVars(input_filename);
     }
+    else if (arg_parser.IsOptionSet(kWriteIndexOption))
+    {
+        WriteFileIndex(input_filename);
+    }
     else
     {
-        GatherAndPrintAllInfo(input_filename);
+        GatherAndPrintAllInfo(input_filename, arg_parser.IsOptionSet(kMemoryMappedFileOption));
     }
 
     gfxrecon::util::Log::Release();
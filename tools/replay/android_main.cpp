@@ -27,6 +27,7 @@
 #include "application/android_window.h"
 #include "decode/file_processor.h"
 #include "decode/preload_file_processor.h"
+#include "decode/replay_profiler.h"
 #include "decode/vulkan_replay_options.h"
 #include "decode/vulkan_tracked_object_info_table.h"
 #include "format/format.h"
@@ -102,10 +103,22 @@ void android_main(struct android_app* app)
 
         try
         {
-            std::unique_ptr<gfxrecon::decode::FileProcessor> file_processor =
-                arg_parser.IsOptionSet(kPreloadMeasurementRangeOption)
-                    ? std::make_unique<gfxrecon::decode::PreloadFileProcessor>()
-                    : std::make_unique<gfxrecon::decode::FileProcessor>();
+            std::unique_ptr<gfxrecon::decode::FileProcessor> file_processor;
+
+            if (arg_parser.IsOptionSet(kPreloadMeasurementRangeOption))
+            {
+                auto preload_file_processor = std::make_unique<gfxrecon::decode::PreloadFileProcessor>();
+                SetPreloadMemoryBudget(arg_parser, preload_file_processor.get());
+                file_processor = std::move(preload_file_processor);
+            }
+            else
+            {
+                file_processor = std::make_unique<gfxrecon::decode::FileProcessor>();
+            }
+
+            file_processor->SetUseMemoryMappedFile(arg_parser.IsOptionSet(kMemoryMappedFileOption));
+            SetFileProcessorReadAhead(arg_parser, file_processor.get());
+            SetHandleTableType(arg_parser);
 
             if (!file_processor->Initialize(filename))
             {
@@ -113,6 +126,8 @@ void android_main(struct android_app* app)
             }
             else
             {
+                LoadFileIndex(arg_parser, file_processor.get());
+
                 auto application =
                     std::make_shared<gfxrecon::application::Application>(kApplicationName, file_processor.get());
                 application->InitializeWsiContext(VK_KHR_ANDROID_SURFACE_EXTENSION_NAME, app);
@@ -153,8 +168,19 @@ void android_main(struct android_app* app)
                                                      replay_options.preload_measurement_range,
                                                      measurement_file_name);
 
+                std::string replay_profile_file = arg_parser.GetArgumentValue(kReplayProfileArgument);
+
+                std::unique_ptr<gfxrecon::decode::ReplayProfiler> replay_profiler;
+
+                if (!replay_profile_file.empty())
+                {
+                    replay_profiler = std::make_unique<gfxrecon::decode::ReplayProfiler>();
+                    file_processor->SetReplayProfiler(replay_profiler.get());
+                }
+
                 replay_consumer.SetFatalErrorHandler([](const char* message) { throw std::runtime_error(message); });
                 replay_consumer.SetFpsInfo(&fps_info);
+                replay_consumer.SetReplayProfiler(replay_profiler.get());
 
                 decoder.AddConsumer(&replay_consumer);
                 file_processor->AddDecoder(&decoder);
@@ -177,6 +203,13 @@ void android_main(struct android_app* app)
                 // Add one so that it matches the trim range frame number semantic
                 fps_info.EndFile(file_processor->GetCurrentFrameNumber() + 1);
 
+                if (replay_profiler != nullptr)
+                {
+                    replay_profiler->EndFile();
+                    replay_profiler->LogToConsole();
+                    replay_profiler->WriteReport(replay_profile_file);
+                }
+
                 if ((file_processor->GetCurrentFrameNumber() > 0) &&
                     (file_processor->GetErrorState() == gfxrecon::decode::FileProcessor::kErrorNone))
                 {
@@ -27,6 +27,7 @@
 #include "application/application.h"
 #include "decode/file_processor.h"
 #include "decode/preload_file_processor.h"
+#include "decode/replay_profiler.h"
 #include "decode/vulkan_replay_options.h"
 #include "decode/vulkan_tracked_object_info_table.h"
 #include "generated/generated_vulkan_decoder.h"
@@ -154,19 +155,27 @@ int main(int argc, const char** argv)
 
         if (arg_parser.IsOptionSet(kPreloadMeasurementRangeOption))
         {
-            file_processor = std::make_unique<gfxrecon::decode::PreloadFileProcessor>();
+            auto preload_file_processor = std::make_unique<gfxrecon::decode::PreloadFileProcessor>();
+            SetPreloadMemoryBudget(arg_parser, preload_file_processor.get());
+            file_processor = std::move(preload_file_processor);
         }
         else
         {
             file_processor = std::make_unique<gfxrecon::decode::FileProcessor>();
         }
 
+        file_processor->SetUseMemoryMappedFile(arg_parser.IsOptionSet(kMemoryMappedFileOption));
+        SetFileProcessorReadAhead(arg_parser, file_processor.get());
+        SetHandleTableType(arg_parser);
+
         if (!file_processor->Initialize(filename))
         {
             return_code = -1;
         }
         else
         {
+            LoadFileIndex(arg_parser, file_processor.get());
+
             // Select WSI context based on CLI
             std::string wsi_extension = GetWsiExtensionName(GetWsiPlatform(arg_parser));
             auto        application   = std::make_shared<gfxrecon::application::Application>(
@@ -216,6 +225,16 @@ int main(int argc, const char** argv)
                                                  preload_measurement_frame_range,
                                                  measurement_file_name);
 
+            std::string replay_profile_file = arg_parser.GetArgumentValue(kReplayProfileArgument);
+
+            std::unique_ptr<gfxrecon::decode::ReplayProfiler> replay_profiler;
+
+            if (!replay_profile_file.empty())
+            {
+                replay_profiler = std::make_unique<gfxrecon::decode::ReplayProfiler>();
+                file_processor->SetReplayProfiler(replay_profiler.get());
+            }
+
             gfxrecon::decode::VulkanReplayConsumer vulkan_replay_consumer(application, vulkan_replay_options);
             gfxrecon::decode::VulkanDecoder        vulkan_decoder;
 
@@ -224,6 +243,7 @@ int main(int argc, const char** argv)
                 vulkan_replay_consumer.SetFatalErrorHandler(
                     [](const char* message) { throw std::runtime_error(message); });
                 vulkan_replay_consumer.SetFpsInfo(&fps_info);
+                vulkan_replay_consumer.SetReplayProfiler(replay_profiler.get());
 
                 vulkan_decoder.AddConsumer(&vulkan_replay_consumer);
                 file_processor->AddDecoder(&vulkan_decoder);
@@ -262,6 +282,7 @@ int main(int argc, const char** argv)
                 dx12_replay_consumer.SetFatalErrorHandler(
                     [](const char* message) { throw std::runtime_error(message); });
                 dx12_replay_consumer.SetFpsInfo(&fps_info);
+                dx12_replay_consumer.SetReplayProfiler(replay_profiler.get());
 
                 // check for user option if first pass tracking is enabled
                 if (dx_replay_options.enable_d3d12_two_pass_replay)
@@ -304,6 +325,13 @@ int main(int argc, const char** argv)
             // Add one so that it matches the trim range frame number semantic
             fps_info.EndFile(file_processor->GetCurrentFrameNumber() + 1);
 
+            if (replay_profiler != nullptr)
+            {
+                replay_profiler->EndFile();
+                replay_profiler->LogToConsole();
+                replay_profiler->WriteReport(replay_profile_file);
+            }
+
             if ((file_processor->GetCurrentFrameNumber() > 0) &&
                 (file_processor->GetErrorState() == gfxrecon::decode::FileProcessor::kErrorNone))
             {
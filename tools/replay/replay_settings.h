@@ -35,7 +35,8 @@ const char kOptions[] =
     "offscreen-swapchain-frame-boundary,--wait-before-present,--dump-resources-before-draw,"
     "--dump-resources-dump-depth-attachment,--dump-"
     "resources-dump-vertex-index-buffers,--dump-resources-json-output-per-command,--dump-resources-dump-immutable-"
-    "resources,--dump-resources-dump-all-image-subresources,--pbi-all,--preload-measurement-range";
+    "resources,--dump-resources-dump-all-image-subresources,--pbi-all,--preload-measurement-range,--memory-"
+    "mapped-file,--index";
 const char kArguments[] =
     "--log-level,--log-file,--gpu,--gpu-group,--pause-frame,--wsi,--surface-index,-m|--memory-translation,"
     "--replace-shaders,--screenshots,--denied-messages,--allowed-messages,--screenshot-format,--"
@@ -43,7 +44,8 @@ const char kArguments[] =
     "force-windowed,--fwo|--force-windowed-origin,--batching-memory-usage,--measurement-file,--swapchain,--sgfs|--skip-"
     "get-fence-status,--sgfr|--"
     "skip-get-fence-ranges,--dump-resources,--dump-resources-scale,--dump-resources-image-format,--dump-resources-dir,"
-    "--dump-resources-dump-color-attachment-index,--pbis,--pcj|--pipeline-creation-jobs";
+    "--dump-resources-dump-color-attachment-index,--pbis,--pcj|--pipeline-creation-jobs,--read-ahead-blocks,--"
+    "decompression-threads,--handle-table,--replay-profile,--preload-memory-budget,--resource-init-staging-size";
 
 static void PrintUsage(const char* exe_name)
 {
@@ -81,6 +83,11 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("\t\t\t[--sgfs <status> | --skip-get-fence-status <status>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--sgfr <frame-ranges> | --skip-get-fence-ranges <frame-ranges>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--pbi-all] [--pbis <index1,index2>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--memory-mapped-file] [--index]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--read-ahead-blocks <num_blocks>] [--decompression-threads <num_threads>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--handle-table <dense|sparse>] [--replay-profile <file>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--preload-measurement-range] [--preload-memory-budget <MiB>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--resource-init-staging-size <MiB>]");
 #if defined(WIN32)
     GFXRECON_WRITE_CONSOLE("\t\t\t[--dump-resources <submit-index,command-index,drawcall-index>]");
 #endif
@@ -165,6 +172,40 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("  --pbi-all\t\tPrint all block information.");
     GFXRECON_WRITE_CONSOLE(
         "  --pbis <index1,index2>\t\tPrint block information between block index1 and block index2.");
+    GFXRECON_WRITE_CONSOLE("  --memory-mapped-file\tRead the capture file through a memory mapping. Uncompressed");
+    GFXRECON_WRITE_CONSOLE("          \t\tblock data is decoded in place, without being copied to an");
+    GFXRECON_WRITE_CONSOLE("          \t\tintermediate buffer.");
+    GFXRECON_WRITE_CONSOLE("  --index\t\tLocate frames with the index file <file>.idx written by");
+    GFXRECON_WRITE_CONSOLE("          \t\tgfxrecon-info --write-index, or build the index when the file is");
+    GFXRECON_WRITE_CONSOLE("          \t\tmissing or out of date. --preload-measurement-range uses the index");
+    GFXRECON_WRITE_CONSOLE("          \t\tto find the blocks of the measurement range before loading them.");
+    GFXRECON_WRITE_CONSOLE("  --read-ahead-blocks <num_blocks>");
+    GFXRECON_WRITE_CONSOLE("          \t\tRead and decompress up to <num_blocks> blocks from the capture file");
+    GFXRECON_WRITE_CONSOLE("          \t\ton a background thread, ahead of the block being replayed.");
+    GFXRECON_WRITE_CONSOLE("          \t\tNot used with --memory-mapped-file.");
+    GFXRECON_WRITE_CONSOLE("          \t\tDefault: 0 (read blocks on the replay thread).");
+    GFXRECON_WRITE_CONSOLE("  --decompression-threads <num_threads>");
+    GFXRECON_WRITE_CONSOLE("          \t\tNumber of threads used to decompress blocks read by");
+    GFXRECON_WRITE_CONSOLE("          \t\t--read-ahead-blocks, or the resource data of state snapshots when");
+    GFXRECON_WRITE_CONSOLE("          \t\t--read-ahead-blocks is not set. If <num_threads> is negative it");
+    GFXRECON_WRITE_CONSOLE("          \t\twill be added to the number of cpu-cores.");
+    GFXRECON_WRITE_CONSOLE("          \t\tDefault: 0 (decompress on the read-ahead thread).");
+    GFXRECON_WRITE_CONSOLE("  --handle-table <dense|sparse>");
+    GFXRECON_WRITE_CONSOLE("          \t\tStorage used to map capture IDs to replay object info. Options are:");
+    GFXRECON_WRITE_CONSOLE("          \t\t  dense   Arrays indexed by capture ID, with a hash table for");
+    GFXRECON_WRITE_CONSOLE("          \t\t          very large IDs.");
+    GFXRECON_WRITE_CONSOLE("          \t\t  sparse  Hash tables.");
+    GFXRECON_WRITE_CONSOLE("          \t\tDefault: dense.");
+    GFXRECON_WRITE_CONSOLE("  --replay-profile <file>");
+    GFXRECON_WRITE_CONSOLE("          \t\tRecord the CPU time spent replaying each API call and each frame,");
+    GFXRECON_WRITE_CONSOLE("          \t\tand write a JSON report with per-call histograms and per-frame");
+    GFXRECON_WRITE_CONSOLE("          \t\tread, decode, and driver times to <file> when replay ends.");
+    GFXRECON_WRITE_CONSOLE("  --preload-measurement-range");
+    GFXRECON_WRITE_CONSOLE("          \t\tLoad the frames of the measurement frame range to memory before");
+    GFXRECON_WRITE_CONSOLE("          \t\treplaying them. Call blocks are decompressed while they are loaded.");
+    GFXRECON_WRITE_CONSOLE("  --preload-memory-budget <MiB>");
+    GFXRECON_WRITE_CONSOLE("          \t\tLimit the memory used by --preload-measurement-range. Frames past");
+    GFXRECON_WRITE_CONSOLE("          \t\tthe budget are read from the capture file. Default: 0 (no limit).");
 #if defined(WIN32)
     GFXRECON_WRITE_CONSOLE("")
     GFXRECON_WRITE_CONSOLE("Windows only:")
@@ -284,6 +325,12 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("          \t\tForce wait on completion of queue operations for all queues");
     GFXRECON_WRITE_CONSOLE("          \t\tbefore calling Present. This is needed for accurate acquisition");
     GFXRECON_WRITE_CONSOLE("          \t\tof instrumentation data on some platforms.");
+    GFXRECON_WRITE_CONSOLE("  --resource-init-staging-size <MiB>");
+    GFXRECON_WRITE_CONSOLE("          \t\tSize of the staging buffer used to batch the buffer and image");
+    GFXRECON_WRITE_CONSOLE("          \t\tuploads from the state snapshot of a trimmed capture. Uploads");
+    GFXRECON_WRITE_CONSOLE("          \t\tare submitted when a quarter of the buffer is full, and are");
+    GFXRECON_WRITE_CONSOLE("          \t\twaited on when the state snapshot ends. A size of 0 submits and");
+    GFXRECON_WRITE_CONSOLE("          \t\twaits for each upload separately. Default: 64.");
     GFXRECON_WRITE_CONSOLE("  --dump-resources <arg>");
     GFXRECON_WRITE_CONSOLE("          \t\t<arg> is BeginCommandBuffer=<n>,Draw=<m>,BeginRenderPass=<o>,");
     GFXRECON_WRITE_CONSOLE("          \t\tNextSubpass=<p>,Dispatch=<q>,TraceRays=<r>,QueueSubmit=<s>");
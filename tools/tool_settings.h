@@ -29,6 +29,8 @@
 #include "generated/generated_dx12_decoder.h"
 #endif
 #include "decode/file_processor.h"
+#include "decode/handle_info_table.h"
+#include "decode/preload_file_processor.h"
 #include "decode/vulkan_default_allocator.h"
 #include "decode/vulkan_realign_allocator.h"
 #include "decode/vulkan_rebind_allocator.h"
@@ -45,10 +47,12 @@
 
 #include "vulkan/vulkan_core.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <limits>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #ifndef GFXRECON_PLATFORM_SETTINGS_H
@@ -124,6 +128,14 @@ const char kPrintBlockInfoAllOption[]             = "--pbi-all";
 const char kPrintBlockInfosArgument[]             = "--pbis";
 const char kNumPipelineCreationJobs[]             = "--pipeline-creation-jobs";
 const char kPreloadMeasurementRangeOption[]       = "--preload-measurement-range";
+const char kMemoryMappedFileOption[]              = "--memory-mapped-file";
+const char kFileIndexOption[]                    = "--index";
+const char kReadAheadBlocksArgument[]             = "--read-ahead-blocks";
+const char kDecompressionThreadsArgument[]        = "--decompression-threads";
+const char kHandleTableArgument[]                 = "--handle-table";
+const char kReplayProfileArgument[]               = "--replay-profile";
+const char kPreloadMemoryBudgetArgument[]         = "--preload-memory-budget";
+const char kResourceInitStagingSizeArgument[]     = "--resource-init-staging-size";
 #if defined(WIN32)
 const char kDxTwoPassReplay[]             = "--dx12-two-pass-replay";
 const char kDxOverrideObjectNames[]       = "--dx12-override-object-names";
@@ -306,6 +318,120 @@ static uint32_t GetPauseFrame(const gfxrecon::util::ArgumentParser& arg_parser)
     return pause_frame;
 }
 
+static void SetFileProcessorReadAhead(const gfxrecon::util::ArgumentParser& arg_parser,
+                                      gfxrecon::decode::FileProcessor*      file_processor)
+{
+    const auto& read_ahead_blocks     = arg_parser.GetArgumentValue(kReadAheadBlocksArgument);
+    const auto& decompression_threads = arg_parser.GetArgumentValue(kDecompressionThreadsArgument);
+    size_t      queue_depth           = 0;
+    size_t      thread_count          = 0;
+
+    if (!read_ahead_blocks.empty())
+    {
+        int value = std::stoi(read_ahead_blocks);
+
+        if (value > 0)
+        {
+            queue_depth = static_cast<size_t>(value);
+        }
+        else if (value < 0)
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid read-ahead block count %d", value);
+        }
+    }
+
+    if (!decompression_threads.empty())
+    {
+        int value = std::stoi(decompression_threads);
+
+        if (value < 0)
+        {
+            // Negative values are added to the number of CPU cores, matching --pipeline-creation-jobs.
+            value += static_cast<int>(std::thread::hardware_concurrency());
+        }
+
+        thread_count = static_cast<size_t>(std::max(value, 0));
+    }
+
+    // When block read-ahead is disabled, the decompression threads are used for the resource data of state snapshots.
+    file_processor->SetBlockReadAhead(queue_depth, thread_count);
+    file_processor->SetStateSnapshotReadAhead(true);
+}
+
+static void SetPreloadMemoryBudget(const gfxrecon::util::ArgumentParser&   arg_parser,
+                                   gfxrecon::decode::PreloadFileProcessor* file_processor)
+{
+    const auto& value = arg_parser.GetArgumentValue(kPreloadMemoryBudgetArgument);
+
+    if (!value.empty())
+    {
+        int budget = std::stoi(value);
+
+        if (budget >= 0)
+        {
+            // The budget is specified in MiB.
+            file_processor->SetPreloadMemoryBudget(static_cast<size_t>(budget) << 20);
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid preload memory budget %d", budget);
+        }
+    }
+}
+
+static void LoadFileIndex(const gfxrecon::util::ArgumentParser& arg_parser,
+                          gfxrecon::decode::FileProcessor*      file_processor)
+{
+    if (arg_parser.IsOptionSet(kFileIndexOption) && (file_processor->GetFileIndex() == nullptr))
+    {
+        GFXRECON_LOG_WARNING("Failed to load or build the file index; frames will be located by reading the file");
+    }
+}
+
+static uint64_t GetResourceInitStagingSize(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    uint64_t    staging_size = gfxrecon::decode::kDefaultResourceInitStagingSize;
+    const auto& value        = arg_parser.GetArgumentValue(kResourceInitStagingSizeArgument);
+
+    if (!value.empty())
+    {
+        int size = std::stoi(value);
+
+        if (size >= 0)
+        {
+            // The size is specified in MiB.
+            staging_size = static_cast<uint64_t>(size) << 20;
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid resource init staging size %d", size);
+        }
+    }
+
+    return staging_size;
+}
+
+static void SetHandleTableType(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    const auto& value = arg_parser.GetArgumentValue(kHandleTableArgument);
+
+    if (!value.empty())
+    {
+        if (gfxrecon::util::platform::StringCompareNoCase("dense", value.c_str()) == 0)
+        {
+            gfxrecon::decode::SetHandleTableType(gfxrecon::decode::HandleTableType::kDense);
+        }
+        else if (gfxrecon::util::platform::StringCompareNoCase("sparse", value.c_str()) == 0)
+        {
+            gfxrecon::decode::SetHandleTableType(gfxrecon::decode::HandleTableType::kSparse);
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING("Ignoring unrecognized handle table type \"%s\"", value.c_str());
+        }
+    }
+}
+
 static WsiPlatform GetWsiPlatform(const gfxrecon::util::ArgumentParser& arg_parser)
 {
     WsiPlatform wsi_platform = WsiPlatform::kAuto;
@@ -1079,6 +1205,7 @@ GetVulkanReplayOptions(const gfxrecon::util::ArgumentParser&           arg_parse
     {
         replay_options.wait_before_present = true;
     }
+    replay_options.resource_init_staging_size = GetResourceInitStagingSize(arg_parser);
     if (arg_parser.IsOptionSet(kPreloadMeasurementRangeOption))
     {
         replay_options.preload_measurement_range = true;